@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/acm/ACM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/acm/model/CertificateDetail.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ACM
 {
 namespace Model
 {
-  class AWS_ACM_API DescribeCertificateResult
+  class AWS_ACM_API DescribeCertificateResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeCertificateResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/acm/ACM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ACM
 {
 namespace Model
 {
-  class AWS_ACM_API GetCertificateResult
+  class AWS_ACM_API GetCertificateResult : public AmazonWebServiceResultBase
   {
   public:
     GetCertificateResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     ListCertificatesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/acm/ACM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/acm/model/CertificateSummary.h>
@@ -34,7 +35,7 @@ namespace ACM
 {
 namespace Model
 {
-  class AWS_ACM_API ListCertificatesResult
+  class AWS_ACM_API ListCertificatesResult : public AmazonWebServiceResultBase
   {
   public:
     ListCertificatesResult();
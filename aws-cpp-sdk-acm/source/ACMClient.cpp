@@ -113,17 +113,31 @@ DeleteCertificateOutcome ACMClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::DeleteCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void ACMClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::DeleteCertificateAsyncHelper, this, request, handler, context);
-}
-
-void ACMClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertificateRequest& request) const
@@ -144,17 +158,31 @@ DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::DescribeCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void ACMClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::DescribeCertificateAsyncHelper, this, request, handler, context);
-}
-
-void ACMClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(DescribeCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& request) const
@@ -175,17 +203,31 @@ GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& req
 
 GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(const GetCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::GetCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void ACMClient::GetCertificateAsync(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::GetCertificateAsyncHelper, this, request, handler, context);
-}
-
-void ACMClient::GetCertificateAsyncHelper(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(GetCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesRequest& request) const
@@ -206,17 +248,31 @@ ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::ListCertificates, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListCertificatesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCertificates( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void ACMClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::ListCertificatesAsyncHelper, this, request, handler, context);
-}
-
-void ACMClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListCertificates(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ListCertificatesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(ListCertificatesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificateRequest& request) const
@@ -237,17 +293,31 @@ RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificate
 
 RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(const RequestCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::RequestCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RequestCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RequestCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void ACMClient::RequestCertificateAsync(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::RequestCertificateAsyncHelper, this, request, handler, context);
-}
-
-void ACMClient::RequestCertificateAsyncHelper(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, RequestCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<RequestCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RequestCertificateOutcome(RequestCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RequestCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValidationEmailRequest& request) const
@@ -268,16 +338,30 @@ ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValida
 
 ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(const ResendValidationEmailRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::ResendValidationEmail, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ResendValidationEmailOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ResendValidationEmail( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void ACMClient::ResendValidationEmailAsync(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::ResendValidationEmailAsyncHelper, this, request, handler, context);
-}
-
-void ACMClient::ResendValidationEmailAsyncHelper(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ResendValidationEmail(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ResendValidationEmailRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ResendValidationEmailOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ResendValidationEmailOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
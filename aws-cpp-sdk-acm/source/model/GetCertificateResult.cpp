@@ -35,6 +35,7 @@ GetCertificateResult::GetCertificateResult(const AmazonWebServiceResult<JsonValu
 
 GetCertificateResult& GetCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Certificate"))
   {
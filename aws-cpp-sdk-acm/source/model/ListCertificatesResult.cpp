@@ -35,6 +35,7 @@ ListCertificatesResult::ListCertificatesResult(const AmazonWebServiceResult<Json
 
 ListCertificatesResult& ListCertificatesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextToken"))
   {
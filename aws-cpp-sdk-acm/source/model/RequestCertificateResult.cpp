@@ -35,6 +35,7 @@ RequestCertificateResult::RequestCertificateResult(const AmazonWebServiceResult<
 
 RequestCertificateResult& RequestCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CertificateArn"))
   {
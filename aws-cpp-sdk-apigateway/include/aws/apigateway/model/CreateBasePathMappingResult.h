@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Represents the base path that callers of the API that must provide as part of
    * the URL after the domain name.</p>
    */
-  class AWS_APIGATEWAY_API CreateBasePathMappingResult
+  class AWS_APIGATEWAY_API CreateBasePathMappingResult : public AmazonWebServiceResultBase
   {
   public:
     CreateBasePathMappingResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Represents a domain name that is contained in a simpler, more intuitive URL
    * that can be called.</p>
    */
-  class AWS_APIGATEWAY_API CreateDomainNameResult
+  class AWS_APIGATEWAY_API CreateDomainNameResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDomainNameResult();
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateStageRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateStage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 
@@ -39,7 +40,7 @@ namespace Model
    * any <a>RestApi</a>, which indicates that the callers with the API key can make
    * requests to that stage.</p>
    */
-  class AWS_APIGATEWAY_API GetApiKeyResult
+  class AWS_APIGATEWAY_API GetApiKeyResult : public AmazonWebServiceResultBase
   {
   public:
     GetApiKeyResult();
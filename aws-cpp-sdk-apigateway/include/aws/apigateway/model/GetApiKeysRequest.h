@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     GetApiKeysRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetApiKeys"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/apigateway/model/AuthorizerType.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Represents an authorization layer for methods. If enabled on a method, API
    * Gateway will activate the authorizer when a client calls the method.</p>
    */
-  class AWS_APIGATEWAY_API GetAuthorizerResult
+  class AWS_APIGATEWAY_API GetAuthorizerResult : public AmazonWebServiceResultBase
   {
   public:
     GetAuthorizerResult();
@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     GetBasePathMappingsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetBasePathMappings"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
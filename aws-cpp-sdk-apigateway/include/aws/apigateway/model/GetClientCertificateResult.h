@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace APIGateway
 {
 namespace Model
 {
-  class AWS_APIGATEWAY_API GetClientCertificateResult
+  class AWS_APIGATEWAY_API GetClientCertificateResult : public AmazonWebServiceResultBase
   {
   public:
     GetClientCertificateResult();
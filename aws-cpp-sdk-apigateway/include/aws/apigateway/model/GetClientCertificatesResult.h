@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/apigateway/model/ClientCertificate.h>
@@ -34,7 +35,7 @@ namespace APIGateway
 {
 namespace Model
 {
-  class AWS_APIGATEWAY_API GetClientCertificatesResult
+  class AWS_APIGATEWAY_API GetClientCertificatesResult : public AmazonWebServiceResultBase
   {
   public:
     GetClientCertificatesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/apigateway/model/MethodSnapshot.h>
@@ -39,7 +40,7 @@ namespace Model
    * by users using <a>Stages</a>. A deployment must be associated with a
    * <a>Stage</a> for it to be callable over the Internet.</p>
    */
-  class AWS_APIGATEWAY_API GetDeploymentResult
+  class AWS_APIGATEWAY_API GetDeploymentResult : public AmazonWebServiceResultBase
   {
   public:
     GetDeploymentResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/apigateway/model/Deployment.h>
@@ -40,7 +41,7 @@ namespace Model
    * your collection. The collection offers a paginated view of the contained
    * deployments.</p>
    */
-  class AWS_APIGATEWAY_API GetDeploymentsResult
+  class AWS_APIGATEWAY_API GetDeploymentsResult : public AmazonWebServiceResultBase
   {
   public:
     GetDeploymentsResult();
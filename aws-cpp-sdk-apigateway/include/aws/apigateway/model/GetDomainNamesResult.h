@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/apigateway/model/DomainName.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents a collection of <a>DomainName</a> resources.</p>
    */
-  class AWS_APIGATEWAY_API GetDomainNamesResult
+  class AWS_APIGATEWAY_API GetDomainNamesResult : public AmazonWebServiceResultBase
   {
   public:
     GetDomainNamesResult();
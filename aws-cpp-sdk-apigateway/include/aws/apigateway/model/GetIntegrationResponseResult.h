@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * <a>MethodResponse</a>, and parameters and templates can be used to transform the
    * backend response.</p>
    */
-  class AWS_APIGATEWAY_API GetIntegrationResponseResult
+  class AWS_APIGATEWAY_API GetIntegrationResponseResult : public AmazonWebServiceResultBase
   {
   public:
     GetIntegrationResponseResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * to the caller as the HTTP status code. Parameters and models can be used to
    * transform the response from the method's integration.</p>
    */
-  class AWS_APIGATEWAY_API GetMethodResponseResult
+  class AWS_APIGATEWAY_API GetMethodResponseResult : public AmazonWebServiceResultBase
   {
   public:
     GetMethodResponseResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the structure of a request or response payload for a method.</p>
    */
-  class AWS_APIGATEWAY_API GetModelResult
+  class AWS_APIGATEWAY_API GetModelResult : public AmazonWebServiceResultBase
   {
   public:
     GetModelResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     GetModelTemplateRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetModelTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents a mapping template used to transform a payload.</p>
    */
-  class AWS_APIGATEWAY_API GetModelTemplateResult
+  class AWS_APIGATEWAY_API GetModelTemplateResult : public AmazonWebServiceResultBase
   {
   public:
     GetModelTemplateResult();
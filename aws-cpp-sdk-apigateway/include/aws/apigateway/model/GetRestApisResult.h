@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/apigateway/model/RestApi.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains references to your APIs and links that guide you in ways to interact
    * with your collection. A collection offers a paginated view of your APIs.</p>
    */
-  class AWS_APIGATEWAY_API GetRestApisResult
+  class AWS_APIGATEWAY_API GetRestApisResult : public AmazonWebServiceResultBase
   {
   public:
     GetRestApisResult();
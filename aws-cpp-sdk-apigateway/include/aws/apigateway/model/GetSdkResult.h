@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/Array.h>
@@ -27,7 +28,7 @@ namespace APIGateway
 {
 namespace Model
 {
-  class AWS_APIGATEWAY_API GetSdkResult
+  class AWS_APIGATEWAY_API GetSdkResult : public AmazonWebServiceResultBase
   {
   public:
     GetSdkResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/apigateway/model/Stage.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>A list of <a>Stage</a> resource that are associated with the <a>ApiKey</a>
    * resource.</p>
    */
-  class AWS_APIGATEWAY_API GetStagesResult
+  class AWS_APIGATEWAY_API GetStagesResult : public AmazonWebServiceResultBase
   {
   public:
     GetStagesResult();
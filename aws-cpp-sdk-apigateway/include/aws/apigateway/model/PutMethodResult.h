@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/apigateway/model/Integration.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Represents a method.</p>
    */
-  class AWS_APIGATEWAY_API PutMethodResult
+  class AWS_APIGATEWAY_API PutMethodResult : public AmazonWebServiceResultBase
   {
   public:
     PutMethodResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the response of the test invoke request in for a custom
    * <a>Authorizer</a></p>
    */
-  class AWS_APIGATEWAY_API TestInvokeAuthorizerResult
+  class AWS_APIGATEWAY_API TestInvokeAuthorizerResult : public AmazonWebServiceResultBase
   {
   public:
     TestInvokeAuthorizerResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the response of the test invoke request in HTTP method.</p>
    */
-  class AWS_APIGATEWAY_API TestInvokeMethodResult
+  class AWS_APIGATEWAY_API TestInvokeMethodResult : public AmazonWebServiceResultBase
   {
   public:
     TestInvokeMethodResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/apigateway/model/ThrottleSettings.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents an AWS account that is associated with Amazon API Gateway.</p>
    */
-  class AWS_APIGATEWAY_API UpdateAccountResult
+  class AWS_APIGATEWAY_API UpdateAccountResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateAccountResult();
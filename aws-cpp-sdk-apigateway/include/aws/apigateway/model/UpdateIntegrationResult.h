@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/apigateway/model/IntegrationType.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>Represents a HTTP, AWS, or Mock integration.</p>
    */
-  class AWS_APIGATEWAY_API UpdateIntegrationResult
+  class AWS_APIGATEWAY_API UpdateIntegrationResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateIntegrationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/apigateway/model/Method.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents a resource.</p>
    */
-  class AWS_APIGATEWAY_API UpdateResourceResult
+  class AWS_APIGATEWAY_API UpdateResourceResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateResourceResult();
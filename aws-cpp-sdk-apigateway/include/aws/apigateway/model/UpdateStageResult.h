@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/apigateway/APIGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/apigateway/model/CacheClusterSize.h>
 #include <aws/apigateway/model/CacheClusterStatus.h>
@@ -40,7 +41,7 @@ namespace Model
    * <p>Represents a unique identifier for a version of a deployed <a>RestApi</a>
    * that is callable by users.</p>
    */
-  class AWS_APIGATEWAY_API UpdateStageResult
+  class AWS_APIGATEWAY_API UpdateStageResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateStageResult();
@@ -182,17 +182,31 @@ CreateApiKeyOutcome APIGatewayClient::CreateApiKey(const CreateApiKeyRequest& re
 
 CreateApiKeyOutcomeCallable APIGatewayClient::CreateApiKeyCallable(const CreateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateApiKeyAsync(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateApiKeyAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateApiKeyAsyncHelper(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys";
+  auto sharedRequest = Aws::MakeShared<CreateApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateApiKeyOutcome(CreateApiKeyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateApiKeyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorizerRequest& request) const
@@ -215,17 +229,33 @@ CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorize
 
 CreateAuthorizerOutcomeCallable APIGatewayClient::CreateAuthorizerCallable(const CreateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateAuthorizerAsync(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateAuthorizerAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateAuthorizerAsyncHelper(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers";
+  auto sharedRequest = Aws::MakeShared<CreateAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAuthorizerOutcome(CreateAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAuthorizerOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const CreateBasePathMappingRequest& request) const
@@ -248,17 +278,33 @@ CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const Creat
 
 CreateBasePathMappingOutcomeCallable APIGatewayClient::CreateBasePathMappingCallable(const CreateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateBasePathMappingAsync(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateBasePathMappingAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateBasePathMappingAsyncHelper(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings";
+  auto sharedRequest = Aws::MakeShared<CreateBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateBasePathMappingOutcome(CreateBasePathMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymentRequest& request) const
@@ -281,17 +327,33 @@ CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymen
 
 CreateDeploymentOutcomeCallable APIGatewayClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateDeploymentAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments";
+  auto sharedRequest = Aws::MakeShared<CreateDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDeploymentOutcome(CreateDeploymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDeploymentOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNameRequest& request) const
@@ -312,17 +374,31 @@ CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNam
 
 CreateDomainNameOutcomeCallable APIGatewayClient::CreateDomainNameCallable(const CreateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateDomainNameAsync(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateDomainNameAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateDomainNameAsyncHelper(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames";
+  auto sharedRequest = Aws::MakeShared<CreateDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDomainNameOutcome(CreateDomainNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDomainNameOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& request) const
@@ -345,17 +421,33 @@ CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& reque
 
 CreateModelOutcomeCallable APIGatewayClient::CreateModelCallable(const CreateModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateModelAsync(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateModelAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateModelAsyncHelper(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models";
+  auto sharedRequest = Aws::MakeShared<CreateModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateModelOutcome(CreateModelResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateModelOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceRequest& request) const
@@ -379,17 +471,34 @@ CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceReque
 
 CreateResourceOutcomeCallable APIGatewayClient::CreateResourceCallable(const CreateResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateResourceAsync(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateResourceAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateResourceAsyncHelper(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetParentId();
+  auto sharedRequest = Aws::MakeShared<CreateResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateResourceOutcome(CreateResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest& request) const
@@ -410,17 +519,31 @@ CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest&
 
 CreateRestApiOutcomeCallable APIGatewayClient::CreateRestApiCallable(const CreateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateRestApiAsync(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateRestApiAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateRestApiAsyncHelper(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis";
+  auto sharedRequest = Aws::MakeShared<CreateRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateRestApiOutcome(CreateRestApiResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateRestApiOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& request) const
@@ -443,17 +566,33 @@ CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& reque
 
 CreateStageOutcomeCallable APIGatewayClient::CreateStageCallable(const CreateStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateStageAsync(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateStageAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::CreateStageAsyncHelper(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages";
+  auto sharedRequest = Aws::MakeShared<CreateStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStageOutcome(CreateStageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStageOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& request) const
@@ -475,17 +614,32 @@ DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& re
 
 DeleteApiKeyOutcomeCallable APIGatewayClient::DeleteApiKeyCallable(const DeleteApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteApiKeyAsync(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteApiKeyAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteApiKeyAsyncHelper(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys/";
+  ss << request.GetApiKey();
+  auto sharedRequest = Aws::MakeShared<DeleteApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteApiKeyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteApiKeyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorizerRequest& request) const
@@ -509,17 +663,34 @@ DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorize
 
 DeleteAuthorizerOutcomeCallable APIGatewayClient::DeleteAuthorizerCallable(const DeleteAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteAuthorizerAsync(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteAuthorizerAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteAuthorizerAsyncHelper(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+  auto sharedRequest = Aws::MakeShared<DeleteAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAuthorizerOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAuthorizerOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const DeleteBasePathMappingRequest& request) const
@@ -543,17 +714,34 @@ DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const Delet
 
 DeleteBasePathMappingOutcomeCallable APIGatewayClient::DeleteBasePathMappingCallable(const DeleteBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteBasePathMappingAsync(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteBasePathMappingAsyncHelper(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings/";
+  ss << request.GetBasePath();
+  auto sharedRequest = Aws::MakeShared<DeleteBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBasePathMappingOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const DeleteClientCertificateRequest& request) const
@@ -575,17 +763,32 @@ DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const D
 
 DeleteClientCertificateOutcomeCallable APIGatewayClient::DeleteClientCertificateCallable(const DeleteClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteClientCertificateAsync(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteClientCertificateAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteClientCertificateAsyncHelper(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates/";
+  ss << request.GetClientCertificateId();
+  auto sharedRequest = Aws::MakeShared<DeleteClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteClientCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteClientCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymentRequest& request) const
@@ -609,17 +812,34 @@ DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymen
 
 DeleteDeploymentOutcomeCallable APIGatewayClient::DeleteDeploymentCallable(const DeleteDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteDeploymentAsync(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteDeploymentAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteDeploymentAsyncHelper(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments/";
+  ss << request.GetDeploymentId();
+  auto sharedRequest = Aws::MakeShared<DeleteDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDeploymentOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDeploymentOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNameRequest& request) const
@@ -641,17 +861,32 @@ DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNam
 
 DeleteDomainNameOutcomeCallable APIGatewayClient::DeleteDomainNameCallable(const DeleteDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteDomainNameAsync(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteDomainNameAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteDomainNameAsyncHelper(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  auto sharedRequest = Aws::MakeShared<DeleteDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDomainNameOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDomainNameOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegrationRequest& request) const
@@ -678,17 +913,37 @@ DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegra
 
 DeleteIntegrationOutcomeCallable APIGatewayClient::DeleteIntegrationCallable(const DeleteIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteIntegrationAsync(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteIntegrationAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteIntegrationAsyncHelper(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+  auto sharedRequest = Aws::MakeShared<DeleteIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteIntegrationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteIntegrationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(const DeleteIntegrationResponseRequest& request) const
@@ -716,17 +971,38 @@ DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(con
 
 DeleteIntegrationResponseOutcomeCallable APIGatewayClient::DeleteIntegrationResponseCallable(const DeleteIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteIntegrationResponseAsync(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteIntegrationResponseAsyncHelper(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<DeleteIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteIntegrationResponseOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& request) const
@@ -752,17 +1028,36 @@ DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& re
 
 DeleteMethodOutcomeCallable APIGatewayClient::DeleteMethodCallable(const DeleteMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteMethodAsync(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteMethodAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteMethodAsyncHelper(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  auto sharedRequest = Aws::MakeShared<DeleteMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMethodOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMethodOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteMethodResponseRequest& request) const
@@ -790,17 +1085,38 @@ DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteM
 
 DeleteMethodResponseOutcomeCallable APIGatewayClient::DeleteMethodResponseCallable(const DeleteMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteMethodResponseAsync(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteMethodResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteMethodResponseAsyncHelper(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<DeleteMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMethodResponseOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMethodResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& request) const
@@ -824,17 +1140,34 @@ DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& reque
 
 DeleteModelOutcomeCallable APIGatewayClient::DeleteModelCallable(const DeleteModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteModelAsync(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteModelAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteModelAsyncHelper(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+  auto sharedRequest = Aws::MakeShared<DeleteModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteModelOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteModelOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceRequest& request) const
@@ -858,17 +1191,34 @@ DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceReque
 
 DeleteResourceOutcomeCallable APIGatewayClient::DeleteResourceCallable(const DeleteResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteResourceAsync(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteResourceAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteResourceAsyncHelper(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  auto sharedRequest = Aws::MakeShared<DeleteResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteResourceOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest& request) const
@@ -890,17 +1240,32 @@ DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest&
 
 DeleteRestApiOutcomeCallable APIGatewayClient::DeleteRestApiCallable(const DeleteRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteRestApiAsync(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteRestApiAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteRestApiAsyncHelper(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  auto sharedRequest = Aws::MakeShared<DeleteRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteRestApiOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteRestApiOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& request) const
@@ -924,17 +1289,34 @@ DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& reque
 
 DeleteStageOutcomeCallable APIGatewayClient::DeleteStageCallable(const DeleteStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteStageAsync(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteStageAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::DeleteStageAsyncHelper(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  auto sharedRequest = Aws::MakeShared<DeleteStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStageOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStageOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(const FlushStageAuthorizersCacheRequest& request) const
@@ -959,17 +1341,35 @@ FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(c
 
 FlushStageAuthorizersCacheOutcomeCallable APIGatewayClient::FlushStageAuthorizersCacheCallable(const FlushStageAuthorizersCacheRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::FlushStageAuthorizersCache, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< FlushStageAuthorizersCacheOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->FlushStageAuthorizersCache( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::FlushStageAuthorizersCacheAsync(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, FlushStageAuthorizersCache(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  ss << "/cache/authorizers";
+  auto sharedRequest = Aws::MakeShared<FlushStageAuthorizersCacheRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, FlushStageAuthorizersCacheOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, FlushStageAuthorizersCacheOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRequest& request) const
@@ -994,17 +1394,35 @@ FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRe
 
 FlushStageCacheOutcomeCallable APIGatewayClient::FlushStageCacheCallable(const FlushStageCacheRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::FlushStageCache, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< FlushStageCacheOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->FlushStageCache( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::FlushStageCacheAsync(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::FlushStageCacheAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::FlushStageCacheAsyncHelper(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, FlushStageCache(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  ss << "/cache/data";
+  auto sharedRequest = Aws::MakeShared<FlushStageCacheRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, FlushStageCacheOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, FlushStageCacheOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(const GenerateClientCertificateRequest& request) const
@@ -1025,17 +1443,31 @@ GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(con
 
 GenerateClientCertificateOutcomeCallable APIGatewayClient::GenerateClientCertificateCallable(const GenerateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GenerateClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GenerateClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GenerateClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GenerateClientCertificateAsync(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GenerateClientCertificateAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GenerateClientCertificateAsyncHelper(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GenerateClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates";
+  auto sharedRequest = Aws::MakeShared<GenerateClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GenerateClientCertificateOutcome(GenerateClientCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GenerateClientCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request) const
@@ -1056,17 +1488,31 @@ GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request)
 
 GetAccountOutcomeCallable APIGatewayClient::GetAccountCallable(const GetAccountRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAccount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAccountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAccount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetAccountAsync(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAccountAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetAccountAsyncHelper(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetAccount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/account";
+  auto sharedRequest = Aws::MakeShared<GetAccountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAccountOutcome(GetAccountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAccountOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) const
@@ -1088,17 +1534,32 @@ GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) co
 
 GetApiKeyOutcomeCallable APIGatewayClient::GetApiKeyCallable(const GetApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetApiKeyAsync(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetApiKeyAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetApiKeyAsyncHelper(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys/";
+  ss << request.GetApiKey();
+  auto sharedRequest = Aws::MakeShared<GetApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetApiKeyOutcome(GetApiKeyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetApiKeyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request) const
@@ -1119,17 +1580,31 @@ GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request)
 
 GetApiKeysOutcomeCallable APIGatewayClient::GetApiKeysCallable(const GetApiKeysRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetApiKeys, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetApiKeysOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetApiKeys( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetApiKeysAsync(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetApiKeysAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetApiKeysAsyncHelper(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetApiKeys(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys";
+  auto sharedRequest = Aws::MakeShared<GetApiKeysRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetApiKeysOutcome(GetApiKeysResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetApiKeysOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest& request) const
@@ -1153,17 +1628,34 @@ GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest&
 
 GetAuthorizerOutcomeCallable APIGatewayClient::GetAuthorizerCallable(const GetAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetAuthorizerAsync(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAuthorizerAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetAuthorizerAsyncHelper(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+  auto sharedRequest = Aws::MakeShared<GetAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAuthorizerOutcome(GetAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAuthorizerOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersRequest& request) const
@@ -1186,17 +1678,33 @@ GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersReque
 
 GetAuthorizersOutcomeCallable APIGatewayClient::GetAuthorizersCallable(const GetAuthorizersRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAuthorizers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAuthorizersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAuthorizers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetAuthorizersAsync(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAuthorizersAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetAuthorizersAsyncHelper(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetAuthorizers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers";
+  auto sharedRequest = Aws::MakeShared<GetAuthorizersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAuthorizersOutcome(GetAuthorizersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAuthorizersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePathMappingRequest& request) const
@@ -1220,17 +1728,34 @@ GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePath
 
 GetBasePathMappingOutcomeCallable APIGatewayClient::GetBasePathMappingCallable(const GetBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetBasePathMappingAsync(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetBasePathMappingAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetBasePathMappingAsyncHelper(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings/";
+  ss << request.GetBasePath();
+  auto sharedRequest = Aws::MakeShared<GetBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBasePathMappingOutcome(GetBasePathMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePathMappingsRequest& request) const
@@ -1253,17 +1778,33 @@ GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePa
 
 GetBasePathMappingsOutcomeCallable APIGatewayClient::GetBasePathMappingsCallable(const GetBasePathMappingsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetBasePathMappings, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBasePathMappingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBasePathMappings( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetBasePathMappingsAsync(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetBasePathMappingsAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetBasePathMappingsAsyncHelper(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetBasePathMappings(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings";
+  auto sharedRequest = Aws::MakeShared<GetBasePathMappingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBasePathMappingsOutcome(GetBasePathMappingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBasePathMappingsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClientCertificateRequest& request) const
@@ -1285,17 +1826,32 @@ GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClie
 
 GetClientCertificateOutcomeCallable APIGatewayClient::GetClientCertificateCallable(const GetClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetClientCertificateAsync(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetClientCertificateAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetClientCertificateAsyncHelper(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates/";
+  ss << request.GetClientCertificateId();
+  auto sharedRequest = Aws::MakeShared<GetClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetClientCertificateOutcome(GetClientCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetClientCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetClientCertificatesRequest& request) const
@@ -1316,17 +1872,31 @@ GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetCl
 
 GetClientCertificatesOutcomeCallable APIGatewayClient::GetClientCertificatesCallable(const GetClientCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetClientCertificates, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetClientCertificatesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetClientCertificates( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetClientCertificatesAsync(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetClientCertificatesAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetClientCertificatesAsyncHelper(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetClientCertificates(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates";
+  auto sharedRequest = Aws::MakeShared<GetClientCertificatesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetClientCertificatesOutcome(GetClientCertificatesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetClientCertificatesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest& request) const
@@ -1350,17 +1920,34 @@ GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest&
 
 GetDeploymentOutcomeCallable APIGatewayClient::GetDeploymentCallable(const GetDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDeploymentAsync(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDeploymentAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetDeploymentAsyncHelper(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments/";
+  ss << request.GetDeploymentId();
+  auto sharedRequest = Aws::MakeShared<GetDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDeploymentOutcome(GetDeploymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDeploymentOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsRequest& request) const
@@ -1383,17 +1970,33 @@ GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsReque
 
 GetDeploymentsOutcomeCallable APIGatewayClient::GetDeploymentsCallable(const GetDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDeployments, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDeploymentsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDeployments( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDeploymentsAsync(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDeploymentsAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetDeploymentsAsyncHelper(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetDeployments(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments";
+  auto sharedRequest = Aws::MakeShared<GetDeploymentsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDeploymentsOutcome(GetDeploymentsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDeploymentsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest& request) const
@@ -1415,17 +2018,32 @@ GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest&
 
 GetDomainNameOutcomeCallable APIGatewayClient::GetDomainNameCallable(const GetDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDomainNameAsync(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDomainNameAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetDomainNameAsyncHelper(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  auto sharedRequest = Aws::MakeShared<GetDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDomainNameOutcome(GetDomainNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDomainNameOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesRequest& request) const
@@ -1446,17 +2064,31 @@ GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesReque
 
 GetDomainNamesOutcomeCallable APIGatewayClient::GetDomainNamesCallable(const GetDomainNamesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDomainNames, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDomainNamesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDomainNames( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDomainNamesAsync(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDomainNamesAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetDomainNamesAsyncHelper(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetDomainNames(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames";
+  auto sharedRequest = Aws::MakeShared<GetDomainNamesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDomainNamesOutcome(GetDomainNamesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDomainNamesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) const
@@ -1482,7 +2114,13 @@ GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) co
 
 GetExportOutcomeCallable APIGatewayClient::GetExportCallable(const GetExportRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetExport, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetExportOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetExport( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetExportAsync(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1519,17 +2157,37 @@ GetIntegrationOutcome APIGatewayClient::GetIntegration(const GetIntegrationReque
 
 GetIntegrationOutcomeCallable APIGatewayClient::GetIntegrationCallable(const GetIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetIntegrationAsync(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetIntegrationAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetIntegrationAsyncHelper(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+  auto sharedRequest = Aws::MakeShared<GetIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetIntegrationOutcome(GetIntegrationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetIntegrationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const GetIntegrationResponseRequest& request) const
@@ -1557,17 +2215,38 @@ GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const Get
 
 GetIntegrationResponseOutcomeCallable APIGatewayClient::GetIntegrationResponseCallable(const GetIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetIntegrationResponseAsync(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetIntegrationResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetIntegrationResponseAsyncHelper(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<GetIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetIntegrationResponseOutcome(GetIntegrationResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) const
@@ -1593,17 +2272,36 @@ GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) co
 
 GetMethodOutcomeCallable APIGatewayClient::GetMethodCallable(const GetMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetMethodAsync(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetMethodAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetMethodAsyncHelper(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  auto sharedRequest = Aws::MakeShared<GetMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetMethodOutcome(GetMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetMethodOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResponseRequest& request) const
@@ -1631,17 +2329,38 @@ GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResp
 
 GetMethodResponseOutcomeCallable APIGatewayClient::GetMethodResponseCallable(const GetMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetMethodResponseAsync(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetMethodResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetMethodResponseAsyncHelper(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<GetMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetMethodResponseOutcome(GetMethodResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetMethodResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
@@ -1665,17 +2384,34 @@ GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
 
 GetModelOutcomeCallable APIGatewayClient::GetModelCallable(const GetModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetModelAsync(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetModelAsyncHelper(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+  auto sharedRequest = Aws::MakeShared<GetModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetModelOutcome(GetModelResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetModelOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplateRequest& request) const
@@ -1700,17 +2436,35 @@ GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplat
 
 GetModelTemplateOutcomeCallable APIGatewayClient::GetModelTemplateCallable(const GetModelTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModelTemplate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetModelTemplateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetModelTemplate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetModelTemplateAsync(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelTemplateAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetModelTemplateAsyncHelper(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetModelTemplate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+  ss << "/default_template";
+  auto sharedRequest = Aws::MakeShared<GetModelTemplateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetModelTemplateOutcome(GetModelTemplateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetModelTemplateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) const
@@ -1733,17 +2487,33 @@ GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) co
 
 GetModelsOutcomeCallable APIGatewayClient::GetModelsCallable(const GetModelsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModels, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetModelsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetModels( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetModelsAsync(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelsAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetModelsAsyncHelper(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetModels(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models";
+  auto sharedRequest = Aws::MakeShared<GetModelsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetModelsOutcome(GetModelsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetModelsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& request) const
@@ -1767,17 +2537,34 @@ GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& reque
 
 GetResourceOutcomeCallable APIGatewayClient::GetResourceCallable(const GetResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetResourceAsync(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetResourceAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetResourceAsyncHelper(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  auto sharedRequest = Aws::MakeShared<GetResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetResourceOutcome(GetResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& request) const
@@ -1800,17 +2587,33 @@ GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& re
 
 GetResourcesOutcomeCallable APIGatewayClient::GetResourcesCallable(const GetResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetResourcesAsync(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetResourcesAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetResourcesAsyncHelper(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources";
+  auto sharedRequest = Aws::MakeShared<GetResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetResourcesOutcome(GetResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetResourcesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request) const
@@ -1832,17 +2635,32 @@ GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request)
 
 GetRestApiOutcomeCallable APIGatewayClient::GetRestApiCallable(const GetRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetRestApi, this, request);
-}
-
-void APIGatewayClient::GetRestApiAsync(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit(&APIGatewayClient::GetRestApiAsyncHelper, this, request, handler, context);
+  auto task = Aws::MakeShared< std::packaged_task< GetRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
-void APIGatewayClient::GetRestApiAsyncHelper(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+void APIGatewayClient::GetRestApiAsync(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  auto sharedRequest = Aws::MakeShared<GetRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetRestApiOutcome(GetRestApiResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetRestApiOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& request) const
@@ -1863,17 +2681,31 @@ GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& reque
 
 GetRestApisOutcomeCallable APIGatewayClient::GetRestApisCallable(const GetRestApisRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetRestApis, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetRestApisOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetRestApis( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetRestApisAsync(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetRestApisAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetRestApisAsyncHelper(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetRestApis(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis";
+  auto sharedRequest = Aws::MakeShared<GetRestApisRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetRestApisOutcome(GetRestApisResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetRestApisOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
@@ -1899,7 +2731,13 @@ GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
 
 GetSdkOutcomeCallable APIGatewayClient::GetSdkCallable(const GetSdkRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetSdk, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetSdkOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetSdk( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetSdkAsync(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1933,17 +2771,34 @@ GetStageOutcome APIGatewayClient::GetStage(const GetStageRequest& request) const
 
 GetStageOutcomeCallable APIGatewayClient::GetStageCallable(const GetStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetStageAsync(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetStageAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetStageAsyncHelper(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  auto sharedRequest = Aws::MakeShared<GetStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStageOutcome(GetStageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStageOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) const
@@ -1966,17 +2821,33 @@ GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) co
 
 GetStagesOutcomeCallable APIGatewayClient::GetStagesCallable(const GetStagesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetStages, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStagesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStages( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetStagesAsync(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetStagesAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::GetStagesAsyncHelper(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetStages(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages";
+  auto sharedRequest = Aws::MakeShared<GetStagesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStagesOutcome(GetStagesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStagesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationRequest& request) const
@@ -2003,17 +2874,37 @@ PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationReque
 
 PutIntegrationOutcomeCallable APIGatewayClient::PutIntegrationCallable(const PutIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutIntegrationAsync(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutIntegrationAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::PutIntegrationAsyncHelper(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+  auto sharedRequest = Aws::MakeShared<PutIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutIntegrationOutcome(PutIntegrationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutIntegrationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const PutIntegrationResponseRequest& request) const
@@ -2041,17 +2932,38 @@ PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const Put
 
 PutIntegrationResponseOutcomeCallable APIGatewayClient::PutIntegrationResponseCallable(const PutIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutIntegrationResponseAsync(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutIntegrationResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::PutIntegrationResponseAsyncHelper(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<PutIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutIntegrationResponseOutcome(PutIntegrationResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) const
@@ -2077,17 +2989,36 @@ PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) co
 
 PutMethodOutcomeCallable APIGatewayClient::PutMethodCallable(const PutMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutMethodAsync(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutMethodAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::PutMethodAsyncHelper(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  auto sharedRequest = Aws::MakeShared<PutMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutMethodOutcome(PutMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutMethodOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResponseRequest& request) const
@@ -2115,17 +3046,38 @@ PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResp
 
 PutMethodResponseOutcomeCallable APIGatewayClient::PutMethodResponseCallable(const PutMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutMethodResponseAsync(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutMethodResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::PutMethodResponseAsyncHelper(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<PutMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutMethodResponseOutcome(PutMethodResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutMethodResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInvokeAuthorizerRequest& request) const
@@ -2149,17 +3101,34 @@ TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInv
 
 TestInvokeAuthorizerOutcomeCallable APIGatewayClient::TestInvokeAuthorizerCallable(const TestInvokeAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::TestInvokeAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TestInvokeAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TestInvokeAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::TestInvokeAuthorizerAsync(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::TestInvokeAuthorizerAsyncHelper(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, TestInvokeAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+  auto sharedRequest = Aws::MakeShared<TestInvokeAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TestInvokeAuthorizerOutcome(TestInvokeAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TestInvokeAuthorizerOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMethodRequest& request) const
@@ -2185,17 +3154,36 @@ TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMetho
 
 TestInvokeMethodOutcomeCallable APIGatewayClient::TestInvokeMethodCallable(const TestInvokeMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::TestInvokeMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TestInvokeMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TestInvokeMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::TestInvokeMethodAsync(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::TestInvokeMethodAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::TestInvokeMethodAsyncHelper(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, TestInvokeMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  auto sharedRequest = Aws::MakeShared<TestInvokeMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TestInvokeMethodOutcome(TestInvokeMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TestInvokeMethodOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest& request) const
@@ -2216,17 +3204,31 @@ UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest&
 
 UpdateAccountOutcomeCallable APIGatewayClient::UpdateAccountCallable(const UpdateAccountRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateAccount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAccountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAccount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateAccountAsync(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateAccountAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateAccountAsyncHelper(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateAccount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/account";
+  auto sharedRequest = Aws::MakeShared<UpdateAccountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAccountOutcome(UpdateAccountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAccountOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& request) const
@@ -2248,17 +3250,32 @@ UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& re
 
 UpdateApiKeyOutcomeCallable APIGatewayClient::UpdateApiKeyCallable(const UpdateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateApiKeyAsync(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateApiKeyAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateApiKeyAsyncHelper(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys/";
+  ss << request.GetApiKey();
+  auto sharedRequest = Aws::MakeShared<UpdateApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateApiKeyOutcome(UpdateApiKeyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateApiKeyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorizerRequest& request) const
@@ -2282,17 +3299,34 @@ UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorize
 
 UpdateAuthorizerOutcomeCallable APIGatewayClient::UpdateAuthorizerCallable(const UpdateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateAuthorizerAsync(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateAuthorizerAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateAuthorizerAsyncHelper(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+  auto sharedRequest = Aws::MakeShared<UpdateAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAuthorizerOutcome(UpdateAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAuthorizerOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const UpdateBasePathMappingRequest& request) const
@@ -2316,17 +3350,34 @@ UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const Updat
 
 UpdateBasePathMappingOutcomeCallable APIGatewayClient::UpdateBasePathMappingCallable(const UpdateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateBasePathMappingAsync(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateBasePathMappingAsyncHelper(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings/";
+  ss << request.GetBasePath();
+  auto sharedRequest = Aws::MakeShared<UpdateBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateBasePathMappingOutcome(UpdateBasePathMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const UpdateClientCertificateRequest& request) const
@@ -2348,17 +3399,32 @@ UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const U
 
 UpdateClientCertificateOutcomeCallable APIGatewayClient::UpdateClientCertificateCallable(const UpdateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateClientCertificateAsync(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateClientCertificateAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateClientCertificateAsyncHelper(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates/";
+  ss << request.GetClientCertificateId();
+  auto sharedRequest = Aws::MakeShared<UpdateClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateClientCertificateOutcome(UpdateClientCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateClientCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymentRequest& request) const
@@ -2382,17 +3448,34 @@ UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymen
 
 UpdateDeploymentOutcomeCallable APIGatewayClient::UpdateDeploymentCallable(const UpdateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateDeploymentAsync(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateDeploymentAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateDeploymentAsyncHelper(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments/";
+  ss << request.GetDeploymentId();
+  auto sharedRequest = Aws::MakeShared<UpdateDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDeploymentOutcome(UpdateDeploymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDeploymentOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNameRequest& request) const
@@ -2414,17 +3497,32 @@ UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNam
 
 UpdateDomainNameOutcomeCallable APIGatewayClient::UpdateDomainNameCallable(const UpdateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateDomainNameAsync(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateDomainNameAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateDomainNameAsyncHelper(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  auto sharedRequest = Aws::MakeShared<UpdateDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDomainNameOutcome(UpdateDomainNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDomainNameOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegrationRequest& request) const
@@ -2451,17 +3549,37 @@ UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegra
 
 UpdateIntegrationOutcomeCallable APIGatewayClient::UpdateIntegrationCallable(const UpdateIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateIntegrationAsync(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateIntegrationAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateIntegrationAsyncHelper(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+  auto sharedRequest = Aws::MakeShared<UpdateIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateIntegrationOutcome(UpdateIntegrationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateIntegrationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(const UpdateIntegrationResponseRequest& request) const
@@ -2489,17 +3607,38 @@ UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(con
 
 UpdateIntegrationResponseOutcomeCallable APIGatewayClient::UpdateIntegrationResponseCallable(const UpdateIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateIntegrationResponseAsync(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateIntegrationResponseAsyncHelper(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<UpdateIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateIntegrationResponseOutcome(UpdateIntegrationResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& request) const
@@ -2525,17 +3664,36 @@ UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& re
 
 UpdateMethodOutcomeCallable APIGatewayClient::UpdateMethodCallable(const UpdateMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateMethodAsync(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateMethodAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateMethodAsyncHelper(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  auto sharedRequest = Aws::MakeShared<UpdateMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateMethodOutcome(UpdateMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateMethodOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateMethodResponseRequest& request) const
@@ -2563,17 +3721,38 @@ UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateM
 
 UpdateMethodResponseOutcomeCallable APIGatewayClient::UpdateMethodResponseCallable(const UpdateMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateMethodResponseAsync(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateMethodResponseAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateMethodResponseAsyncHelper(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+  auto sharedRequest = Aws::MakeShared<UpdateMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateMethodResponseOutcome(UpdateMethodResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateMethodResponseOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& request) const
@@ -2597,17 +3776,34 @@ UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& reque
 
 UpdateModelOutcomeCallable APIGatewayClient::UpdateModelCallable(const UpdateModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateModelAsync(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateModelAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateModelAsyncHelper(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+  auto sharedRequest = Aws::MakeShared<UpdateModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateModelOutcome(UpdateModelResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateModelOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceRequest& request) const
@@ -2631,17 +3827,34 @@ UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceReque
 
 UpdateResourceOutcomeCallable APIGatewayClient::UpdateResourceCallable(const UpdateResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateResourceAsync(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateResourceAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateResourceAsyncHelper(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  auto sharedRequest = Aws::MakeShared<UpdateResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateResourceOutcome(UpdateResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest& request) const
@@ -2663,17 +3876,32 @@ UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest&
 
 UpdateRestApiOutcomeCallable APIGatewayClient::UpdateRestApiCallable(const UpdateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateRestApiAsync(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateRestApiAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateRestApiAsyncHelper(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  auto sharedRequest = Aws::MakeShared<UpdateRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateRestApiOutcome(UpdateRestApiResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateRestApiOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
 UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& request) const
@@ -2697,16 +3925,33 @@ UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& reque
 
 UpdateStageOutcomeCallable APIGatewayClient::UpdateStageCallable(const UpdateStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateStageAsync(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateStageAsyncHelper, this, request, handler, context);
-}
-
-void APIGatewayClient::UpdateStageAsyncHelper(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  auto sharedRequest = Aws::MakeShared<UpdateStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStageOutcome(UpdateStageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStageOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PATCH);
 }
 
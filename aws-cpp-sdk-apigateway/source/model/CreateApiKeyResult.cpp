@@ -41,6 +41,7 @@ CreateApiKeyResult::CreateApiKeyResult(const AmazonWebServiceResult<JsonValue>&
 
 CreateApiKeyResult& CreateApiKeyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
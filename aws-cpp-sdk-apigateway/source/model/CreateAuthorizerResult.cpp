@@ -37,6 +37,7 @@ CreateAuthorizerResult::CreateAuthorizerResult(const AmazonWebServiceResult<Json
 
 CreateAuthorizerResult& CreateAuthorizerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -35,6 +35,7 @@ CreateBasePathMappingResult::CreateBasePathMappingResult(const AmazonWebServiceR
 
 CreateBasePathMappingResult& CreateBasePathMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("basePath"))
   {
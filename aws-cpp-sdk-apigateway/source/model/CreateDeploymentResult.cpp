@@ -37,6 +37,7 @@ CreateDeploymentResult::CreateDeploymentResult(const AmazonWebServiceResult<Json
 
 CreateDeploymentResult& CreateDeploymentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -37,6 +37,7 @@ CreateDomainNameResult::CreateDomainNameResult(const AmazonWebServiceResult<Json
 
 CreateDomainNameResult& CreateDomainNameResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("domainName"))
   {
@@ -35,6 +35,7 @@ CreateModelResult::CreateModelResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateModelResult& CreateModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
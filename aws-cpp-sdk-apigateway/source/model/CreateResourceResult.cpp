@@ -35,6 +35,7 @@ CreateResourceResult::CreateResourceResult(const AmazonWebServiceResult<JsonValu
 
 CreateResourceResult& CreateResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -37,6 +37,7 @@ CreateRestApiResult::CreateRestApiResult(const AmazonWebServiceResult<JsonValue>
 
 CreateRestApiResult& CreateRestApiResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
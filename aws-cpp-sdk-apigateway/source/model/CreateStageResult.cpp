@@ -41,6 +41,7 @@ CreateStageResult::CreateStageResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateStageResult& CreateStageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentId"))
   {
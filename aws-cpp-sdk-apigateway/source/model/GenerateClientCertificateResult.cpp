@@ -39,6 +39,7 @@ GenerateClientCertificateResult::GenerateClientCertificateResult(const AmazonWeb
 
 GenerateClientCertificateResult& GenerateClientCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("clientCertificateId"))
   {
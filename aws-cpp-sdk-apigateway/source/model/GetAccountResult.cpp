@@ -35,6 +35,7 @@ GetAccountResult::GetAccountResult(const AmazonWebServiceResult<JsonValue>& resu
 
 GetAccountResult& GetAccountResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("cloudwatchRoleArn"))
   {
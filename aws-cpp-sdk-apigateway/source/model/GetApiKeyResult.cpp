@@ -41,6 +41,7 @@ GetApiKeyResult::GetApiKeyResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetApiKeyResult& GetApiKeyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
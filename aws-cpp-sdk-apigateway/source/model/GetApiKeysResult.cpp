@@ -35,6 +35,7 @@ GetApiKeysResult::GetApiKeysResult(const AmazonWebServiceResult<JsonValue>& resu
 
 GetApiKeysResult& GetApiKeysResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
@@ -37,6 +37,7 @@ GetAuthorizerResult::GetAuthorizerResult(const AmazonWebServiceResult<JsonValue>
 
 GetAuthorizerResult& GetAuthorizerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -35,6 +35,7 @@ GetAuthorizersResult::GetAuthorizersResult(const AmazonWebServiceResult<JsonValu
 
 GetAuthorizersResult& GetAuthorizersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
@@ -35,6 +35,7 @@ GetBasePathMappingResult::GetBasePathMappingResult(const AmazonWebServiceResult<
 
 GetBasePathMappingResult& GetBasePathMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("basePath"))
   {
@@ -35,6 +35,7 @@ GetBasePathMappingsResult::GetBasePathMappingsResult(const AmazonWebServiceResul
 
 GetBasePathMappingsResult& GetBasePathMappingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
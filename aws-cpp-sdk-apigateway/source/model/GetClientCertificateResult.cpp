@@ -39,6 +39,7 @@ GetClientCertificateResult::GetClientCertificateResult(const AmazonWebServiceRes
 
 GetClientCertificateResult& GetClientCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("clientCertificateId"))
   {
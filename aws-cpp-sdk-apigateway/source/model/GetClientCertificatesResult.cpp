@@ -35,6 +35,7 @@ GetClientCertificatesResult::GetClientCertificatesResult(const AmazonWebServiceR
 
 GetClientCertificatesResult& GetClientCertificatesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
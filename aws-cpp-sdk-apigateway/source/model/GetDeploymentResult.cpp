@@ -37,6 +37,7 @@ GetDeploymentResult::GetDeploymentResult(const AmazonWebServiceResult<JsonValue>
 
 GetDeploymentResult& GetDeploymentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
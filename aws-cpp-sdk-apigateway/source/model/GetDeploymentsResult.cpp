@@ -35,6 +35,7 @@ GetDeploymentsResult::GetDeploymentsResult(const AmazonWebServiceResult<JsonValu
 
 GetDeploymentsResult& GetDeploymentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
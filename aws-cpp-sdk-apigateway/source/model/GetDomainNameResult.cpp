@@ -37,6 +37,7 @@ GetDomainNameResult::GetDomainNameResult(const AmazonWebServiceResult<JsonValue>
 
 GetDomainNameResult& GetDomainNameResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("domainName"))
   {
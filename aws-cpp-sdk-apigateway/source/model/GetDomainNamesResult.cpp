@@ -35,6 +35,7 @@ GetDomainNamesResult::GetDomainNamesResult(const AmazonWebServiceResult<JsonValu
 
 GetDomainNamesResult& GetDomainNamesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
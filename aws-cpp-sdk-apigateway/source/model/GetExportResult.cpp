@@ -34,6 +34,7 @@ GetExportResult::GetExportResult(GetExportResult&& toMove) :
     m_contentDisposition(std::move(toMove.m_contentDisposition)),
     m_body(std::move(toMove.m_body))
 {
+  SetRequestTimings(toMove.GetRequestTimings());
 }
 
 GetExportResult& GetExportResult::operator=(GetExportResult&& toMove)
@@ -43,6 +44,7 @@ GetExportResult& GetExportResult::operator=(GetExportResult&& toMove)
       return *this;
    }
 
+   SetRequestTimings(toMove.GetRequestTimings());
    m_contentType = std::move(toMove.m_contentType);
    m_contentDisposition = std::move(toMove.m_contentDisposition);
    m_body = std::move(toMove.m_body);
@@ -57,6 +59,7 @@ GetExportResult::GetExportResult(AmazonWebServiceResult<ResponseStream>&& result
 
 GetExportResult& GetExportResult::operator =(AmazonWebServiceResult<ResponseStream>&& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   m_body = result.TakeOwnershipOfPayload();
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -35,6 +35,7 @@ GetIntegrationResponseResult::GetIntegrationResponseResult(const AmazonWebServic
 
 GetIntegrationResponseResult& GetIntegrationResponseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statusCode"))
   {
@@ -35,6 +35,7 @@ GetIntegrationResult::GetIntegrationResult(const AmazonWebServiceResult<JsonValu
 
 GetIntegrationResult& GetIntegrationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("type"))
   {
@@ -35,6 +35,7 @@ GetMethodResponseResult::GetMethodResponseResult(const AmazonWebServiceResult<Js
 
 GetMethodResponseResult& GetMethodResponseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statusCode"))
   {
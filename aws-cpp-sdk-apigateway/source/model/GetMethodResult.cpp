@@ -37,6 +37,7 @@ GetMethodResult::GetMethodResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetMethodResult& GetMethodResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("httpMethod"))
   {
@@ -35,6 +35,7 @@ GetModelResult::GetModelResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetModelResult& GetModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -35,6 +35,7 @@ GetModelTemplateResult::GetModelTemplateResult(const AmazonWebServiceResult<Json
 
 GetModelTemplateResult& GetModelTemplateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("value"))
   {
@@ -35,6 +35,7 @@ GetModelsResult::GetModelsResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetModelsResult& GetModelsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
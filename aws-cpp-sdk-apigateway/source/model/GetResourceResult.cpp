@@ -35,6 +35,7 @@ GetResourceResult::GetResourceResult(const AmazonWebServiceResult<JsonValue>& re
 
 GetResourceResult& GetResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -35,6 +35,7 @@ GetResourcesResult::GetResourcesResult(const AmazonWebServiceResult<JsonValue>&
 
 GetResourcesResult& GetResourcesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
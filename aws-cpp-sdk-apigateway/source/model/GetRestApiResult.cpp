@@ -37,6 +37,7 @@ GetRestApiResult::GetRestApiResult(const AmazonWebServiceResult<JsonValue>& resu
 
 GetRestApiResult& GetRestApiResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -35,6 +35,7 @@ GetRestApisResult::GetRestApisResult(const AmazonWebServiceResult<JsonValue>& re
 
 GetRestApisResult& GetRestApisResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("position"))
   {
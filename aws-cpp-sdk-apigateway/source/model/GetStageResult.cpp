@@ -41,6 +41,7 @@ GetStageResult::GetStageResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetStageResult& GetStageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentId"))
   {
@@ -35,6 +35,7 @@ GetStagesResult::GetStagesResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetStagesResult& GetStagesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("item"))
   {
@@ -35,6 +35,7 @@ PutIntegrationResponseResult::PutIntegrationResponseResult(const AmazonWebServic
 
 PutIntegrationResponseResult& PutIntegrationResponseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statusCode"))
   {
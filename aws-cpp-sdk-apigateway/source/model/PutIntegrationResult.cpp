@@ -35,6 +35,7 @@ PutIntegrationResult::PutIntegrationResult(const AmazonWebServiceResult<JsonValu
 
 PutIntegrationResult& PutIntegrationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("type"))
   {
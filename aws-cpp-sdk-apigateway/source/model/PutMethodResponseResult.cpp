@@ -35,6 +35,7 @@ PutMethodResponseResult::PutMethodResponseResult(const AmazonWebServiceResult<Js
 
 PutMethodResponseResult& PutMethodResponseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statusCode"))
   {
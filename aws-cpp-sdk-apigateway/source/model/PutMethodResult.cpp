@@ -37,6 +37,7 @@ PutMethodResult::PutMethodResult(const AmazonWebServiceResult<JsonValue>& result
 
 PutMethodResult& PutMethodResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("httpMethod"))
   {
@@ -39,6 +39,7 @@ TestInvokeAuthorizerResult::TestInvokeAuthorizerResult(const AmazonWebServiceRes
 
 TestInvokeAuthorizerResult& TestInvokeAuthorizerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("clientStatus"))
   {
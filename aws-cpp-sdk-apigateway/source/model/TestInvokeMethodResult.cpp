@@ -39,6 +39,7 @@ TestInvokeMethodResult::TestInvokeMethodResult(const AmazonWebServiceResult<Json
 
 TestInvokeMethodResult& TestInvokeMethodResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -35,6 +35,7 @@ UpdateAccountResult::UpdateAccountResult(const AmazonWebServiceResult<JsonValue>
 
 UpdateAccountResult& UpdateAccountResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("cloudwatchRoleArn"))
   {
@@ -41,6 +41,7 @@ UpdateApiKeyResult::UpdateApiKeyResult(const AmazonWebServiceResult<JsonValue>&
 
 UpdateApiKeyResult& UpdateApiKeyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
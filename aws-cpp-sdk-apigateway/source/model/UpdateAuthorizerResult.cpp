@@ -37,6 +37,7 @@ UpdateAuthorizerResult::UpdateAuthorizerResult(const AmazonWebServiceResult<Json
 
 UpdateAuthorizerResult& UpdateAuthorizerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -35,6 +35,7 @@ UpdateBasePathMappingResult::UpdateBasePathMappingResult(const AmazonWebServiceR
 
 UpdateBasePathMappingResult& UpdateBasePathMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("basePath"))
   {
@@ -39,6 +39,7 @@ UpdateClientCertificateResult::UpdateClientCertificateResult(const AmazonWebServ
 
 UpdateClientCertificateResult& UpdateClientCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("clientCertificateId"))
   {
@@ -37,6 +37,7 @@ UpdateDeploymentResult::UpdateDeploymentResult(const AmazonWebServiceResult<Json
 
 UpdateDeploymentResult& UpdateDeploymentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -37,6 +37,7 @@ UpdateDomainNameResult::UpdateDomainNameResult(const AmazonWebServiceResult<Json
 
 UpdateDomainNameResult& UpdateDomainNameResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("domainName"))
   {
@@ -35,6 +35,7 @@ UpdateIntegrationResponseResult::UpdateIntegrationResponseResult(const AmazonWeb
 
 UpdateIntegrationResponseResult& UpdateIntegrationResponseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statusCode"))
   {
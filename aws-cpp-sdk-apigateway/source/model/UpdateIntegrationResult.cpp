@@ -35,6 +35,7 @@ UpdateIntegrationResult::UpdateIntegrationResult(const AmazonWebServiceResult<Js
 
 UpdateIntegrationResult& UpdateIntegrationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("type"))
   {
@@ -35,6 +35,7 @@ UpdateMethodResponseResult::UpdateMethodResponseResult(const AmazonWebServiceRes
 
 UpdateMethodResponseResult& UpdateMethodResponseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statusCode"))
   {
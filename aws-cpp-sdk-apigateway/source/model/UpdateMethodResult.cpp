@@ -37,6 +37,7 @@ UpdateMethodResult::UpdateMethodResult(const AmazonWebServiceResult<JsonValue>&
 
 UpdateMethodResult& UpdateMethodResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("httpMethod"))
   {
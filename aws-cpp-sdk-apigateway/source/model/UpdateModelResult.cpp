@@ -35,6 +35,7 @@ UpdateModelResult::UpdateModelResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateModelResult& UpdateModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
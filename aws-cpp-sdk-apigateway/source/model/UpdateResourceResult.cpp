@@ -35,6 +35,7 @@ UpdateResourceResult::UpdateResourceResult(const AmazonWebServiceResult<JsonValu
 
 UpdateResourceResult& UpdateResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -37,6 +37,7 @@ UpdateRestApiResult::UpdateRestApiResult(const AmazonWebServiceResult<JsonValue>
 
 UpdateRestApiResult& UpdateRestApiResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("id"))
   {
@@ -41,6 +41,7 @@ UpdateStageResult::UpdateStageResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateStageResult& UpdateStageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentId"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/autoscaling/AutoScaling_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/autoscaling/model/ResponseMetadata.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace AutoScaling
 {
 namespace Model
 {
-  class AWS_AUTOSCALING_API DeleteLifecycleHookResult
+  class AWS_AUTOSCALING_API DeleteLifecycleHookResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteLifecycleHookResult();
@@ -29,6 +29,10 @@ namespace Model
   {
   public:
     DescribeAutoScalingNotificationTypesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeAutoScalingNotificationTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/autoscaling/AutoScaling_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/autoscaling/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -34,7 +35,7 @@ namespace AutoScaling
 {
 namespace Model
 {
-  class AWS_AUTOSCALING_API DescribeAutoScalingNotificationTypesResult
+  class AWS_AUTOSCALING_API DescribeAutoScalingNotificationTypesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAutoScalingNotificationTypesResult();
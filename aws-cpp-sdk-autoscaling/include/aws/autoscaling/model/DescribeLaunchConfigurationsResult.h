@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/autoscaling/AutoScaling_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/autoscaling/model/ResponseMetadata.h>
@@ -35,7 +36,7 @@ namespace AutoScaling
 {
 namespace Model
 {
-  class AWS_AUTOSCALING_API DescribeLaunchConfigurationsResult
+  class AWS_AUTOSCALING_API DescribeLaunchConfigurationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeLaunchConfigurationsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/autoscaling/AutoScaling_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/autoscaling/model/ResponseMetadata.h>
 #include <aws/autoscaling/model/LifecycleHook.h>
@@ -34,7 +35,7 @@ namespace AutoScaling
 {
 namespace Model
 {
-  class AWS_AUTOSCALING_API DescribeLifecycleHooksResult
+  class AWS_AUTOSCALING_API DescribeLifecycleHooksResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeLifecycleHooksResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeTagsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeTags"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     ExitStandbyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ExitStandby"; }
+
     Aws::String SerializePayload() const override;
 
     /**
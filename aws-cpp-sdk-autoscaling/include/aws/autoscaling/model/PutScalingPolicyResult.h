@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/autoscaling/AutoScaling_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/autoscaling/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace AutoScaling
 {
 namespace Model
 {
-  class AWS_AUTOSCALING_API PutScalingPolicyResult
+  class AWS_AUTOSCALING_API PutScalingPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     PutScalingPolicyResult();
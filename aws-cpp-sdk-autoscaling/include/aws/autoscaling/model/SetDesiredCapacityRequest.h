@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     SetDesiredCapacityRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "SetDesiredCapacity"; }
+
     Aws::String SerializePayload() const override;
 
     /**
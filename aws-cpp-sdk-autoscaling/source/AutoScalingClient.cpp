@@ -156,17 +156,31 @@ AttachInstancesOutcome AutoScalingClient::AttachInstances(const AttachInstancesR
 
 AttachInstancesOutcomeCallable AutoScalingClient::AttachInstancesCallable(const AttachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::AttachInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AttachInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AttachInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::AttachInstancesAsync(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::AttachInstancesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::AttachInstancesAsyncHelper(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, AttachInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<AttachInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AttachInstancesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AttachInstancesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 AttachLoadBalancersOutcome AutoScalingClient::AttachLoadBalancers(const AttachLoadBalancersRequest& request) const
@@ -186,17 +200,31 @@ AttachLoadBalancersOutcome AutoScalingClient::AttachLoadBalancers(const AttachLo
 
 AttachLoadBalancersOutcomeCallable AutoScalingClient::AttachLoadBalancersCallable(const AttachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::AttachLoadBalancers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AttachLoadBalancersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AttachLoadBalancers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::AttachLoadBalancersAsync(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::AttachLoadBalancersAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::AttachLoadBalancersAsyncHelper(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, AttachLoadBalancers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<AttachLoadBalancersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AttachLoadBalancersOutcome(AttachLoadBalancersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AttachLoadBalancersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CompleteLifecycleActionOutcome AutoScalingClient::CompleteLifecycleAction(const CompleteLifecycleActionRequest& request) const
@@ -216,17 +244,31 @@ CompleteLifecycleActionOutcome AutoScalingClient::CompleteLifecycleAction(const
 
 CompleteLifecycleActionOutcomeCallable AutoScalingClient::CompleteLifecycleActionCallable(const CompleteLifecycleActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CompleteLifecycleAction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CompleteLifecycleActionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CompleteLifecycleAction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CompleteLifecycleActionAsync(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::CompleteLifecycleActionAsyncHelper(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CompleteLifecycleAction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CompleteLifecycleActionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CompleteLifecycleActionOutcome(CompleteLifecycleActionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CompleteLifecycleActionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateAutoScalingGroupOutcome AutoScalingClient::CreateAutoScalingGroup(const CreateAutoScalingGroupRequest& request) const
@@ -246,17 +288,31 @@ CreateAutoScalingGroupOutcome AutoScalingClient::CreateAutoScalingGroup(const Cr
 
 CreateAutoScalingGroupOutcomeCallable AutoScalingClient::CreateAutoScalingGroupCallable(const CreateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CreateAutoScalingGroupAsync(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::CreateAutoScalingGroupAsyncHelper(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAutoScalingGroupOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateLaunchConfigurationOutcome AutoScalingClient::CreateLaunchConfiguration(const CreateLaunchConfigurationRequest& request) const
@@ -276,17 +332,31 @@ CreateLaunchConfigurationOutcome AutoScalingClient::CreateLaunchConfiguration(co
 
 CreateLaunchConfigurationOutcomeCallable AutoScalingClient::CreateLaunchConfigurationCallable(const CreateLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateLaunchConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateLaunchConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateLaunchConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CreateLaunchConfigurationAsync(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::CreateLaunchConfigurationAsyncHelper(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateLaunchConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateLaunchConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateLaunchConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateLaunchConfigurationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateOrUpdateTagsOutcome AutoScalingClient::CreateOrUpdateTags(const CreateOrUpdateTagsRequest& request) const
@@ -306,17 +376,31 @@ CreateOrUpdateTagsOutcome AutoScalingClient::CreateOrUpdateTags(const CreateOrUp
 
 CreateOrUpdateTagsOutcomeCallable AutoScalingClient::CreateOrUpdateTagsCallable(const CreateOrUpdateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateOrUpdateTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateOrUpdateTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateOrUpdateTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CreateOrUpdateTagsAsync(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::CreateOrUpdateTagsAsyncHelper(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateOrUpdateTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateOrUpdateTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateOrUpdateTagsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateOrUpdateTagsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteAutoScalingGroupOutcome AutoScalingClient::DeleteAutoScalingGroup(const DeleteAutoScalingGroupRequest& request) const
@@ -336,17 +420,31 @@ DeleteAutoScalingGroupOutcome AutoScalingClient::DeleteAutoScalingGroup(const De
 
 DeleteAutoScalingGroupOutcomeCallable AutoScalingClient::DeleteAutoScalingGroupCallable(const DeleteAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteAutoScalingGroupAsync(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeleteAutoScalingGroupAsyncHelper(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAutoScalingGroupOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteLaunchConfigurationOutcome AutoScalingClient::DeleteLaunchConfiguration(const DeleteLaunchConfigurationRequest& request) const
@@ -366,17 +464,31 @@ DeleteLaunchConfigurationOutcome AutoScalingClient::DeleteLaunchConfiguration(co
 
 DeleteLaunchConfigurationOutcomeCallable AutoScalingClient::DeleteLaunchConfigurationCallable(const DeleteLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteLaunchConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteLaunchConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteLaunchConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteLaunchConfigurationAsync(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeleteLaunchConfigurationAsyncHelper(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteLaunchConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteLaunchConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteLaunchConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteLaunchConfigurationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteLifecycleHookOutcome AutoScalingClient::DeleteLifecycleHook(const DeleteLifecycleHookRequest& request) const
@@ -396,17 +508,31 @@ DeleteLifecycleHookOutcome AutoScalingClient::DeleteLifecycleHook(const DeleteLi
 
 DeleteLifecycleHookOutcomeCallable AutoScalingClient::DeleteLifecycleHookCallable(const DeleteLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteLifecycleHook, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteLifecycleHookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteLifecycleHook( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteLifecycleHookAsync(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeleteLifecycleHookAsyncHelper(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteLifecycleHook(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteLifecycleHookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteLifecycleHookOutcome(DeleteLifecycleHookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteLifecycleHookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteNotificationConfigurationOutcome AutoScalingClient::DeleteNotificationConfiguration(const DeleteNotificationConfigurationRequest& request) const
@@ -426,17 +552,31 @@ DeleteNotificationConfigurationOutcome AutoScalingClient::DeleteNotificationConf
 
 DeleteNotificationConfigurationOutcomeCallable AutoScalingClient::DeleteNotificationConfigurationCallable(const DeleteNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteNotificationConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteNotificationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteNotificationConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteNotificationConfigurationAsync(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeleteNotificationConfigurationAsyncHelper(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteNotificationConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteNotificationConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteNotificationConfigurationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeletePolicyOutcome AutoScalingClient::DeletePolicy(const DeletePolicyRequest& request) const
@@ -456,17 +596,31 @@ DeletePolicyOutcome AutoScalingClient::DeletePolicy(const DeletePolicyRequest& r
 
 DeletePolicyOutcomeCallable AutoScalingClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeletePolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeletePolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeletePolicyAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeletePolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeletePolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeletePolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeletePolicyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteScheduledActionOutcome AutoScalingClient::DeleteScheduledAction(const DeleteScheduledActionRequest& request) const
@@ -486,17 +640,31 @@ DeleteScheduledActionOutcome AutoScalingClient::DeleteScheduledAction(const Dele
 
 DeleteScheduledActionOutcomeCallable AutoScalingClient::DeleteScheduledActionCallable(const DeleteScheduledActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteScheduledAction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteScheduledActionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteScheduledAction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteScheduledActionAsync(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteScheduledActionAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeleteScheduledActionAsyncHelper(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteScheduledAction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteScheduledActionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteScheduledActionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteScheduledActionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteTagsOutcome AutoScalingClient::DeleteTags(const DeleteTagsRequest& request) const
@@ -516,17 +684,31 @@ DeleteTagsOutcome AutoScalingClient::DeleteTags(const DeleteTagsRequest& request
 
 DeleteTagsOutcomeCallable AutoScalingClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteTagsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTagsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTagsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeAccountLimitsOutcome AutoScalingClient::DescribeAccountLimits(const DescribeAccountLimitsRequest& request) const
@@ -546,17 +728,31 @@ DescribeAccountLimitsOutcome AutoScalingClient::DescribeAccountLimits(const Desc
 
 DescribeAccountLimitsOutcomeCallable AutoScalingClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAccountLimits, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAccountLimitsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAccountLimits( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeAccountLimits(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAccountLimitsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(DescribeAccountLimitsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeAdjustmentTypesOutcome AutoScalingClient::DescribeAdjustmentTypes(const DescribeAdjustmentTypesRequest& request) const
@@ -576,17 +772,31 @@ DescribeAdjustmentTypesOutcome AutoScalingClient::DescribeAdjustmentTypes(const
 
 DescribeAdjustmentTypesOutcomeCallable AutoScalingClient::DescribeAdjustmentTypesCallable(const DescribeAdjustmentTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAdjustmentTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAdjustmentTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAdjustmentTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAdjustmentTypesAsync(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeAdjustmentTypesAsyncHelper(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeAdjustmentTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAdjustmentTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAdjustmentTypesOutcome(DescribeAdjustmentTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAdjustmentTypesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeAutoScalingGroupsOutcome AutoScalingClient::DescribeAutoScalingGroups(const DescribeAutoScalingGroupsRequest& request) const
@@ -606,17 +816,31 @@ DescribeAutoScalingGroupsOutcome AutoScalingClient::DescribeAutoScalingGroups(co
 
 DescribeAutoScalingGroupsOutcomeCallable AutoScalingClient::DescribeAutoScalingGroupsCallable(const DescribeAutoScalingGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingGroups, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAutoScalingGroupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAutoScalingGroups( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAutoScalingGroupsAsync(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeAutoScalingGroups(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAutoScalingGroupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingGroupsOutcome(DescribeAutoScalingGroupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingGroupsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeAutoScalingInstancesOutcome AutoScalingClient::DescribeAutoScalingInstances(const DescribeAutoScalingInstancesRequest& request) const
@@ -636,17 +860,31 @@ DescribeAutoScalingInstancesOutcome AutoScalingClient::DescribeAutoScalingInstan
 
 DescribeAutoScalingInstancesOutcomeCallable AutoScalingClient::DescribeAutoScalingInstancesCallable(const DescribeAutoScalingInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAutoScalingInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAutoScalingInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAutoScalingInstancesAsync(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeAutoScalingInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAutoScalingInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingInstancesOutcome(DescribeAutoScalingInstancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingInstancesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeAutoScalingNotificationTypesOutcome AutoScalingClient::DescribeAutoScalingNotificationTypes(const DescribeAutoScalingNotificationTypesRequest& request) const
@@ -666,17 +904,31 @@ DescribeAutoScalingNotificationTypesOutcome AutoScalingClient::DescribeAutoScali
 
 DescribeAutoScalingNotificationTypesOutcomeCallable AutoScalingClient::DescribeAutoScalingNotificationTypesCallable(const DescribeAutoScalingNotificationTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingNotificationTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAutoScalingNotificationTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAutoScalingNotificationTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeAutoScalingNotificationTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAutoScalingNotificationTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingNotificationTypesOutcome(DescribeAutoScalingNotificationTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingNotificationTypesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeLaunchConfigurationsOutcome AutoScalingClient::DescribeLaunchConfigurations(const DescribeLaunchConfigurationsRequest& request) const
@@ -696,17 +948,31 @@ DescribeLaunchConfigurationsOutcome AutoScalingClient::DescribeLaunchConfigurati
 
 DescribeLaunchConfigurationsOutcomeCallable AutoScalingClient::DescribeLaunchConfigurationsCallable(const DescribeLaunchConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLaunchConfigurations, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLaunchConfigurationsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLaunchConfigurations( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLaunchConfigurationsAsync(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeLaunchConfigurations(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLaunchConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLaunchConfigurationsOutcome(DescribeLaunchConfigurationsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLaunchConfigurationsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeLifecycleHookTypesOutcome AutoScalingClient::DescribeLifecycleHookTypes(const DescribeLifecycleHookTypesRequest& request) const
@@ -726,17 +992,31 @@ DescribeLifecycleHookTypesOutcome AutoScalingClient::DescribeLifecycleHookTypes(
 
 DescribeLifecycleHookTypesOutcomeCallable AutoScalingClient::DescribeLifecycleHookTypesCallable(const DescribeLifecycleHookTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLifecycleHookTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLifecycleHookTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLifecycleHookTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLifecycleHookTypesAsync(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeLifecycleHookTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLifecycleHookTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHookTypesOutcome(DescribeLifecycleHookTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHookTypesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeLifecycleHooksOutcome AutoScalingClient::DescribeLifecycleHooks(const DescribeLifecycleHooksRequest& request) const
@@ -756,17 +1036,31 @@ DescribeLifecycleHooksOutcome AutoScalingClient::DescribeLifecycleHooks(const De
 
 DescribeLifecycleHooksOutcomeCallable AutoScalingClient::DescribeLifecycleHooksCallable(const DescribeLifecycleHooksRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLifecycleHooks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLifecycleHooksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLifecycleHooks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLifecycleHooksAsync(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeLifecycleHooksAsyncHelper(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeLifecycleHooks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLifecycleHooksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHooksOutcome(DescribeLifecycleHooksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHooksOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeLoadBalancersOutcome AutoScalingClient::DescribeLoadBalancers(const DescribeLoadBalancersRequest& request) const
@@ -786,17 +1080,31 @@ DescribeLoadBalancersOutcome AutoScalingClient::DescribeLoadBalancers(const Desc
 
 DescribeLoadBalancersOutcomeCallable AutoScalingClient::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLoadBalancers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLoadBalancersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLoadBalancers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeLoadBalancers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLoadBalancersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLoadBalancersOutcome(DescribeLoadBalancersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLoadBalancersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeMetricCollectionTypesOutcome AutoScalingClient::DescribeMetricCollectionTypes(const DescribeMetricCollectionTypesRequest& request) const
@@ -816,17 +1124,31 @@ DescribeMetricCollectionTypesOutcome AutoScalingClient::DescribeMetricCollection
 
 DescribeMetricCollectionTypesOutcomeCallable AutoScalingClient::DescribeMetricCollectionTypesCallable(const DescribeMetricCollectionTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeMetricCollectionTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeMetricCollectionTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeMetricCollectionTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeMetricCollectionTypesAsync(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeMetricCollectionTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeMetricCollectionTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeMetricCollectionTypesOutcome(DescribeMetricCollectionTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeMetricCollectionTypesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeNotificationConfigurationsOutcome AutoScalingClient::DescribeNotificationConfigurations(const DescribeNotificationConfigurationsRequest& request) const
@@ -846,17 +1168,31 @@ DescribeNotificationConfigurationsOutcome AutoScalingClient::DescribeNotificatio
 
 DescribeNotificationConfigurationsOutcomeCallable AutoScalingClient::DescribeNotificationConfigurationsCallable(const DescribeNotificationConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeNotificationConfigurations, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeNotificationConfigurationsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeNotificationConfigurations( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeNotificationConfigurationsAsync(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeNotificationConfigurations(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeNotificationConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeNotificationConfigurationsOutcome(DescribeNotificationConfigurationsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeNotificationConfigurationsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribePoliciesOutcome AutoScalingClient::DescribePolicies(const DescribePoliciesRequest& request) const
@@ -876,17 +1212,31 @@ DescribePoliciesOutcome AutoScalingClient::DescribePolicies(const DescribePolici
 
 DescribePoliciesOutcomeCallable AutoScalingClient::DescribePoliciesCallable(const DescribePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribePolicies, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribePoliciesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribePolicies( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribePoliciesAsync(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribePoliciesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribePoliciesAsyncHelper(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribePolicies(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribePoliciesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribePoliciesOutcome(DescribePoliciesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribePoliciesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeScalingActivitiesOutcome AutoScalingClient::DescribeScalingActivities(const DescribeScalingActivitiesRequest& request) const
@@ -906,17 +1256,31 @@ DescribeScalingActivitiesOutcome AutoScalingClient::DescribeScalingActivities(co
 
 DescribeScalingActivitiesOutcomeCallable AutoScalingClient::DescribeScalingActivitiesCallable(const DescribeScalingActivitiesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScalingActivities, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeScalingActivitiesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeScalingActivities( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeScalingActivitiesAsync(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeScalingActivitiesAsyncHelper(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeScalingActivities(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeScalingActivitiesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeScalingActivitiesOutcome(DescribeScalingActivitiesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeScalingActivitiesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeScalingProcessTypesOutcome AutoScalingClient::DescribeScalingProcessTypes(const DescribeScalingProcessTypesRequest& request) const
@@ -936,17 +1300,31 @@ DescribeScalingProcessTypesOutcome AutoScalingClient::DescribeScalingProcessType
 
 DescribeScalingProcessTypesOutcomeCallable AutoScalingClient::DescribeScalingProcessTypesCallable(const DescribeScalingProcessTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScalingProcessTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeScalingProcessTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeScalingProcessTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeScalingProcessTypesAsync(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeScalingProcessTypesAsyncHelper(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeScalingProcessTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeScalingProcessTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeScalingProcessTypesOutcome(DescribeScalingProcessTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeScalingProcessTypesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeScheduledActionsOutcome AutoScalingClient::DescribeScheduledActions(const DescribeScheduledActionsRequest& request) const
@@ -966,17 +1344,31 @@ DescribeScheduledActionsOutcome AutoScalingClient::DescribeScheduledActions(cons
 
 DescribeScheduledActionsOutcomeCallable AutoScalingClient::DescribeScheduledActionsCallable(const DescribeScheduledActionsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScheduledActions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeScheduledActionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeScheduledActions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeScheduledActionsAsync(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeScheduledActionsAsyncHelper(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeScheduledActions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeScheduledActionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeScheduledActionsOutcome(DescribeScheduledActionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeScheduledActionsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeTagsOutcome AutoScalingClient::DescribeTags(const DescribeTagsRequest& request) const
@@ -996,17 +1388,31 @@ DescribeTagsOutcome AutoScalingClient::DescribeTags(const DescribeTagsRequest& r
 
 DescribeTagsOutcomeCallable AutoScalingClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeTagsAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTagsOutcome(DescribeTagsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTagsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeTerminationPolicyTypesOutcome AutoScalingClient::DescribeTerminationPolicyTypes(const DescribeTerminationPolicyTypesRequest& request) const
@@ -1026,17 +1432,31 @@ DescribeTerminationPolicyTypesOutcome AutoScalingClient::DescribeTerminationPoli
 
 DescribeTerminationPolicyTypesOutcomeCallable AutoScalingClient::DescribeTerminationPolicyTypesCallable(const DescribeTerminationPolicyTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeTerminationPolicyTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeTerminationPolicyTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTerminationPolicyTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeTerminationPolicyTypesAsync(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeTerminationPolicyTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeTerminationPolicyTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTerminationPolicyTypesOutcome(DescribeTerminationPolicyTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTerminationPolicyTypesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DetachInstancesOutcome AutoScalingClient::DetachInstances(const DetachInstancesRequest& request) const
@@ -1056,17 +1476,31 @@ DetachInstancesOutcome AutoScalingClient::DetachInstances(const DetachInstancesR
 
 DetachInstancesOutcomeCallable AutoScalingClient::DetachInstancesCallable(const DetachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DetachInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DetachInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DetachInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DetachInstancesAsync(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DetachInstancesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DetachInstancesAsyncHelper(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DetachInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DetachInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DetachInstancesOutcome(DetachInstancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DetachInstancesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DetachLoadBalancersOutcome AutoScalingClient::DetachLoadBalancers(const DetachLoadBalancersRequest& request) const
@@ -1086,17 +1520,31 @@ DetachLoadBalancersOutcome AutoScalingClient::DetachLoadBalancers(const DetachLo
 
 DetachLoadBalancersOutcomeCallable AutoScalingClient::DetachLoadBalancersCallable(const DetachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DetachLoadBalancers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DetachLoadBalancersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DetachLoadBalancers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DetachLoadBalancersAsync(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DetachLoadBalancersAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DetachLoadBalancersAsyncHelper(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DetachLoadBalancers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DetachLoadBalancersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DetachLoadBalancersOutcome(DetachLoadBalancersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DetachLoadBalancersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DisableMetricsCollectionOutcome AutoScalingClient::DisableMetricsCollection(const DisableMetricsCollectionRequest& request) const
@@ -1116,17 +1564,31 @@ DisableMetricsCollectionOutcome AutoScalingClient::DisableMetricsCollection(cons
 
 DisableMetricsCollectionOutcomeCallable AutoScalingClient::DisableMetricsCollectionCallable(const DisableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DisableMetricsCollection, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DisableMetricsCollectionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisableMetricsCollection( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DisableMetricsCollectionAsync(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::DisableMetricsCollectionAsyncHelper(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DisableMetricsCollection(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DisableMetricsCollectionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisableMetricsCollectionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisableMetricsCollectionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 EnableMetricsCollectionOutcome AutoScalingClient::EnableMetricsCollection(const EnableMetricsCollectionRequest& request) const
@@ -1146,17 +1608,31 @@ EnableMetricsCollectionOutcome AutoScalingClient::EnableMetricsCollection(const
 
 EnableMetricsCollectionOutcomeCallable AutoScalingClient::EnableMetricsCollectionCallable(const EnableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::EnableMetricsCollection, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EnableMetricsCollectionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EnableMetricsCollection( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::EnableMetricsCollectionAsync(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::EnableMetricsCollectionAsyncHelper(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, EnableMetricsCollection(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<EnableMetricsCollectionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EnableMetricsCollectionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EnableMetricsCollectionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 EnterStandbyOutcome AutoScalingClient::EnterStandby(const EnterStandbyRequest& request) const
@@ -1176,17 +1652,31 @@ EnterStandbyOutcome AutoScalingClient::EnterStandby(const EnterStandbyRequest& r
 
 EnterStandbyOutcomeCallable AutoScalingClient::EnterStandbyCallable(const EnterStandbyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::EnterStandby, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EnterStandbyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EnterStandby( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::EnterStandbyAsync(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::EnterStandbyAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::EnterStandbyAsyncHelper(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, EnterStandby(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<EnterStandbyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EnterStandbyOutcome(EnterStandbyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EnterStandbyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ExecutePolicyOutcome AutoScalingClient::ExecutePolicy(const ExecutePolicyRequest& request) const
@@ -1206,17 +1696,31 @@ ExecutePolicyOutcome AutoScalingClient::ExecutePolicy(const ExecutePolicyRequest
 
 ExecutePolicyOutcomeCallable AutoScalingClient::ExecutePolicyCallable(const ExecutePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ExecutePolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ExecutePolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ExecutePolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::ExecutePolicyAsync(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ExecutePolicyAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::ExecutePolicyAsyncHelper(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ExecutePolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ExecutePolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ExecutePolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ExecutePolicyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ExitStandbyOutcome AutoScalingClient::ExitStandby(const ExitStandbyRequest& request) const
@@ -1236,17 +1740,31 @@ ExitStandbyOutcome AutoScalingClient::ExitStandby(const ExitStandbyRequest& requ
 
 ExitStandbyOutcomeCallable AutoScalingClient::ExitStandbyCallable(const ExitStandbyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ExitStandby, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ExitStandbyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ExitStandby( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::ExitStandbyAsync(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ExitStandbyAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::ExitStandbyAsyncHelper(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ExitStandby(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ExitStandbyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ExitStandbyOutcome(ExitStandbyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ExitStandbyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 PutLifecycleHookOutcome AutoScalingClient::PutLifecycleHook(const PutLifecycleHookRequest& request) const
@@ -1266,17 +1784,31 @@ PutLifecycleHookOutcome AutoScalingClient::PutLifecycleHook(const PutLifecycleHo
 
 PutLifecycleHookOutcomeCallable AutoScalingClient::PutLifecycleHookCallable(const PutLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutLifecycleHook, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutLifecycleHookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutLifecycleHook( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutLifecycleHookAsync(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutLifecycleHookAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::PutLifecycleHookAsyncHelper(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutLifecycleHook(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutLifecycleHookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutLifecycleHookOutcome(PutLifecycleHookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutLifecycleHookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 PutNotificationConfigurationOutcome AutoScalingClient::PutNotificationConfiguration(const PutNotificationConfigurationRequest& request) const
@@ -1296,17 +1828,31 @@ PutNotificationConfigurationOutcome AutoScalingClient::PutNotificationConfigurat
 
 PutNotificationConfigurationOutcomeCallable AutoScalingClient::PutNotificationConfigurationCallable(const PutNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutNotificationConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutNotificationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutNotificationConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutNotificationConfigurationAsync(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::PutNotificationConfigurationAsyncHelper(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutNotificationConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutNotificationConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutNotificationConfigurationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 PutScalingPolicyOutcome AutoScalingClient::PutScalingPolicy(const PutScalingPolicyRequest& request) const
@@ -1326,17 +1872,31 @@ PutScalingPolicyOutcome AutoScalingClient::PutScalingPolicy(const PutScalingPoli
 
 PutScalingPolicyOutcomeCallable AutoScalingClient::PutScalingPolicyCallable(const PutScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutScalingPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutScalingPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutScalingPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutScalingPolicyAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::PutScalingPolicyAsyncHelper(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutScalingPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutScalingPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutScalingPolicyOutcome(PutScalingPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutScalingPolicyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 PutScheduledUpdateGroupActionOutcome AutoScalingClient::PutScheduledUpdateGroupAction(const PutScheduledUpdateGroupActionRequest& request) const
@@ -1356,17 +1916,31 @@ PutScheduledUpdateGroupActionOutcome AutoScalingClient::PutScheduledUpdateGroupA
 
 PutScheduledUpdateGroupActionOutcomeCallable AutoScalingClient::PutScheduledUpdateGroupActionCallable(const PutScheduledUpdateGroupActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutScheduledUpdateGroupAction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutScheduledUpdateGroupActionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutScheduledUpdateGroupAction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutScheduledUpdateGroupActionAsync(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, PutScheduledUpdateGroupAction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutScheduledUpdateGroupActionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutScheduledUpdateGroupActionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutScheduledUpdateGroupActionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 RecordLifecycleActionHeartbeatOutcome AutoScalingClient::RecordLifecycleActionHeartbeat(const RecordLifecycleActionHeartbeatRequest& request) const
@@ -1386,17 +1960,31 @@ RecordLifecycleActionHeartbeatOutcome AutoScalingClient::RecordLifecycleActionHe
 
 RecordLifecycleActionHeartbeatOutcomeCallable AutoScalingClient::RecordLifecycleActionHeartbeatCallable(const RecordLifecycleActionHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::RecordLifecycleActionHeartbeat, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RecordLifecycleActionHeartbeatOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RecordLifecycleActionHeartbeat( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, RecordLifecycleActionHeartbeat(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<RecordLifecycleActionHeartbeatRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RecordLifecycleActionHeartbeatOutcome(RecordLifecycleActionHeartbeatResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RecordLifecycleActionHeartbeatOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ResumeProcessesOutcome AutoScalingClient::ResumeProcesses(const ResumeProcessesRequest& request) const
@@ -1416,17 +2004,31 @@ ResumeProcessesOutcome AutoScalingClient::ResumeProcesses(const ResumeProcessesR
 
 ResumeProcessesOutcomeCallable AutoScalingClient::ResumeProcessesCallable(const ResumeProcessesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ResumeProcesses, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ResumeProcessesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ResumeProcesses( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::ResumeProcessesAsync(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ResumeProcessesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::ResumeProcessesAsyncHelper(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ResumeProcesses(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ResumeProcessesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ResumeProcessesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ResumeProcessesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 SetDesiredCapacityOutcome AutoScalingClient::SetDesiredCapacity(const SetDesiredCapacityRequest& request) const
@@ -1446,17 +2048,31 @@ SetDesiredCapacityOutcome AutoScalingClient::SetDesiredCapacity(const SetDesired
 
 SetDesiredCapacityOutcomeCallable AutoScalingClient::SetDesiredCapacityCallable(const SetDesiredCapacityRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetDesiredCapacity, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetDesiredCapacityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetDesiredCapacity( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SetDesiredCapacityAsync(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetDesiredCapacityAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::SetDesiredCapacityAsyncHelper(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, SetDesiredCapacity(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetDesiredCapacityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetDesiredCapacityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetDesiredCapacityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 SetInstanceHealthOutcome AutoScalingClient::SetInstanceHealth(const SetInstanceHealthRequest& request) const
@@ -1476,17 +2092,31 @@ SetInstanceHealthOutcome AutoScalingClient::SetInstanceHealth(const SetInstanceH
 
 SetInstanceHealthOutcomeCallable AutoScalingClient::SetInstanceHealthCallable(const SetInstanceHealthRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetInstanceHealth, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetInstanceHealthOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetInstanceHealth( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SetInstanceHealthAsync(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetInstanceHealthAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::SetInstanceHealthAsyncHelper(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, SetInstanceHealth(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetInstanceHealthRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetInstanceHealthOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetInstanceHealthOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 SetInstanceProtectionOutcome AutoScalingClient::SetInstanceProtection(const SetInstanceProtectionRequest& request) const
@@ -1506,17 +2136,31 @@ SetInstanceProtectionOutcome AutoScalingClient::SetInstanceProtection(const SetI
 
 SetInstanceProtectionOutcomeCallable AutoScalingClient::SetInstanceProtectionCallable(const SetInstanceProtectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetInstanceProtection, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetInstanceProtectionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetInstanceProtection( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SetInstanceProtectionAsync(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetInstanceProtectionAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::SetInstanceProtectionAsyncHelper(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, SetInstanceProtection(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetInstanceProtectionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetInstanceProtectionOutcome(SetInstanceProtectionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetInstanceProtectionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 SuspendProcessesOutcome AutoScalingClient::SuspendProcesses(const SuspendProcessesRequest& request) const
@@ -1536,17 +2180,31 @@ SuspendProcessesOutcome AutoScalingClient::SuspendProcesses(const SuspendProcess
 
 SuspendProcessesOutcomeCallable AutoScalingClient::SuspendProcessesCallable(const SuspendProcessesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SuspendProcesses, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SuspendProcessesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SuspendProcesses( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SuspendProcessesAsync(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SuspendProcessesAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::SuspendProcessesAsyncHelper(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, SuspendProcesses(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SuspendProcessesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SuspendProcessesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SuspendProcessesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 TerminateInstanceInAutoScalingGroupOutcome AutoScalingClient::TerminateInstanceInAutoScalingGroup(const TerminateInstanceInAutoScalingGroupRequest& request) const
@@ -1566,17 +2224,31 @@ TerminateInstanceInAutoScalingGroupOutcome AutoScalingClient::TerminateInstanceI
 
 TerminateInstanceInAutoScalingGroupOutcomeCallable AutoScalingClient::TerminateInstanceInAutoScalingGroupCallable(const TerminateInstanceInAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::TerminateInstanceInAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TerminateInstanceInAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TerminateInstanceInAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, TerminateInstanceInAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<TerminateInstanceInAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TerminateInstanceInAutoScalingGroupOutcome(TerminateInstanceInAutoScalingGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TerminateInstanceInAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 UpdateAutoScalingGroupOutcome AutoScalingClient::UpdateAutoScalingGroup(const UpdateAutoScalingGroupRequest& request) const
@@ -1596,16 +2268,30 @@ UpdateAutoScalingGroupOutcome AutoScalingClient::UpdateAutoScalingGroup(const Up
 
 UpdateAutoScalingGroupOutcomeCallable AutoScalingClient::UpdateAutoScalingGroupCallable(const UpdateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::UpdateAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::UpdateAutoScalingGroupAsync(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, this, request, handler, context);
-}
-
-void AutoScalingClient::UpdateAutoScalingGroupAsyncHelper(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<UpdateAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAutoScalingGroupOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
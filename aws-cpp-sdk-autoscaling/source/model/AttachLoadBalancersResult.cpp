@@ -37,6 +37,7 @@ AttachLoadBalancersResult::AttachLoadBalancersResult(const AmazonWebServiceResul
 
 AttachLoadBalancersResult& AttachLoadBalancersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
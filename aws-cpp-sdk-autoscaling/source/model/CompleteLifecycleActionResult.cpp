@@ -37,6 +37,7 @@ CompleteLifecycleActionResult::CompleteLifecycleActionResult(const AmazonWebServ
 
 CompleteLifecycleActionResult& CompleteLifecycleActionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteLifecycleHookResult::DeleteLifecycleHookResult(const AmazonWebServiceResul
 
 DeleteLifecycleHookResult& DeleteLifecycleHookResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
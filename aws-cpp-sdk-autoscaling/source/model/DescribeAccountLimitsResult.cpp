@@ -45,6 +45,7 @@ DescribeAccountLimitsResult::DescribeAccountLimitsResult(const AmazonWebServiceR
 
 DescribeAccountLimitsResult& DescribeAccountLimitsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
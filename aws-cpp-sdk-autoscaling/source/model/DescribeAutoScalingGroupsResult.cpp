@@ -37,6 +37,7 @@ DescribeAutoScalingGroupsResult::DescribeAutoScalingGroupsResult(const AmazonWeb
 
 DescribeAutoScalingGroupsResult& DescribeAutoScalingGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeAutoScalingInstancesResult::DescribeAutoScalingInstancesResult(const Ama
 
 DescribeAutoScalingInstancesResult& DescribeAutoScalingInstancesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeLaunchConfigurationsResult::DescribeLaunchConfigurationsResult(const Ama
 
 DescribeLaunchConfigurationsResult& DescribeLaunchConfigurationsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeLifecycleHooksResult::DescribeLifecycleHooksResult(const AmazonWebServic
 
 DescribeLifecycleHooksResult& DescribeLifecycleHooksResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
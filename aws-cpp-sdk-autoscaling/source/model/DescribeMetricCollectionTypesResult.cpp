@@ -37,6 +37,7 @@ DescribeMetricCollectionTypesResult::DescribeMetricCollectionTypesResult(const A
 
 DescribeMetricCollectionTypesResult& DescribeMetricCollectionTypesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
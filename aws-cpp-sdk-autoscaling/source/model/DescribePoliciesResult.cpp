@@ -37,6 +37,7 @@ DescribePoliciesResult::DescribePoliciesResult(const AmazonWebServiceResult<XmlD
 
 DescribePoliciesResult& DescribePoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeScalingActivitiesResult::DescribeScalingActivitiesResult(const AmazonWeb
 
 DescribeScalingActivitiesResult& DescribeScalingActivitiesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeScalingProcessTypesResult::DescribeScalingProcessTypesResult(const Amazo
 
 DescribeScalingProcessTypesResult& DescribeScalingProcessTypesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeTagsResult::DescribeTagsResult(const AmazonWebServiceResult<XmlDocument>
 
 DescribeTagsResult& DescribeTagsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DetachInstancesResult::DetachInstancesResult(const AmazonWebServiceResult<XmlDoc
 
 DetachInstancesResult& DetachInstancesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DetachLoadBalancersResult::DetachLoadBalancersResult(const AmazonWebServiceResul
 
 DetachLoadBalancersResult& DetachLoadBalancersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
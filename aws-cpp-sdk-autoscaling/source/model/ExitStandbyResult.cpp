@@ -37,6 +37,7 @@ ExitStandbyResult::ExitStandbyResult(const AmazonWebServiceResult<XmlDocument>&
 
 ExitStandbyResult& ExitStandbyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ PutLifecycleHookResult::PutLifecycleHookResult(const AmazonWebServiceResult<XmlD
 
 PutLifecycleHookResult& PutLifecycleHookResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
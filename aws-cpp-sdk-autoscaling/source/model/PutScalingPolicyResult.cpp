@@ -37,6 +37,7 @@ PutScalingPolicyResult::PutScalingPolicyResult(const AmazonWebServiceResult<XmlD
 
 PutScalingPolicyResult& PutScalingPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
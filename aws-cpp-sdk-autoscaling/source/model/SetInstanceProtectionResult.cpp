@@ -37,6 +37,7 @@ SetInstanceProtectionResult::SetInstanceProtectionResult(const AmazonWebServiceR
 
 SetInstanceProtectionResult& SetInstanceProtectionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
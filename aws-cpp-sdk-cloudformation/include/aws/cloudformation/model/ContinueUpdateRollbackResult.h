@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudformation/CloudFormation_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudformation/model/ResponseMetadata.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The output for a <a>ContinueUpdateRollback</a> action.</p>
    */
-  class AWS_CLOUDFORMATION_API ContinueUpdateRollbackResult
+  class AWS_CLOUDFORMATION_API ContinueUpdateRollbackResult : public AmazonWebServiceResultBase
   {
   public:
     ContinueUpdateRollbackResult();
@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     CreateStackRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateStack"; }
+
     Aws::String SerializePayload() const override;
 
     /**
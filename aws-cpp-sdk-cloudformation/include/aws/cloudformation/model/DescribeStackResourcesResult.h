@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudformation/CloudFormation_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudformation/model/ResponseMetadata.h>
 #include <aws/cloudformation/model/StackResource.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The output for a <a>DescribeStackResources</a> action.</p>
    */
-  class AWS_CLOUDFORMATION_API DescribeStackResourcesResult
+  class AWS_CLOUDFORMATION_API DescribeStackResourcesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeStackResourcesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudformation/CloudFormation_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudformation/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output for the <a>GetStackPolicy</a> action.</p>
    */
-  class AWS_CLOUDFORMATION_API GetStackPolicyResult
+  class AWS_CLOUDFORMATION_API GetStackPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetStackPolicyResult();
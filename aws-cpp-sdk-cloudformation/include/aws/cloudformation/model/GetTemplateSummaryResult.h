@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudformation/CloudFormation_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudformation/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>The output for the <a>GetTemplateSummary</a> action.</p>
    */
-  class AWS_CLOUDFORMATION_API GetTemplateSummaryResult
+  class AWS_CLOUDFORMATION_API GetTemplateSummaryResult : public AmazonWebServiceResultBase
   {
   public:
     GetTemplateSummaryResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudformation/CloudFormation_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudformation/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>The output for a <a>ListStackResources</a> action.</p>
    */
-  class AWS_CLOUDFORMATION_API ListStackResourcesResult
+  class AWS_CLOUDFORMATION_API ListStackResourcesResult : public AmazonWebServiceResultBase
   {
   public:
     ListStackResourcesResult();
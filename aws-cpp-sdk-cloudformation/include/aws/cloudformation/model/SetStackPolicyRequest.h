@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     SetStackPolicyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "SetStackPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -126,17 +126,31 @@ CancelUpdateStackOutcome CloudFormationClient::CancelUpdateStack(const CancelUpd
 
 CancelUpdateStackOutcomeCallable CloudFormationClient::CancelUpdateStackCallable(const CancelUpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::CancelUpdateStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CancelUpdateStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CancelUpdateStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::CancelUpdateStackAsync(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::CancelUpdateStackAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::CancelUpdateStackAsyncHelper(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CancelUpdateStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CancelUpdateStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CancelUpdateStackOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CancelUpdateStackOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ContinueUpdateRollbackOutcome CloudFormationClient::ContinueUpdateRollback(const ContinueUpdateRollbackRequest& request) const
@@ -156,17 +170,31 @@ ContinueUpdateRollbackOutcome CloudFormationClient::ContinueUpdateRollback(const
 
 ContinueUpdateRollbackOutcomeCallable CloudFormationClient::ContinueUpdateRollbackCallable(const ContinueUpdateRollbackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ContinueUpdateRollback, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ContinueUpdateRollbackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ContinueUpdateRollback( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ContinueUpdateRollbackAsync(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::ContinueUpdateRollbackAsyncHelper(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ContinueUpdateRollback(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ContinueUpdateRollbackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ContinueUpdateRollbackOutcome(ContinueUpdateRollbackResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ContinueUpdateRollbackOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateStackOutcome CloudFormationClient::CreateStack(const CreateStackRequest& request) const
@@ -186,17 +214,31 @@ CreateStackOutcome CloudFormationClient::CreateStack(const CreateStackRequest& r
 
 CreateStackOutcomeCallable CloudFormationClient::CreateStackCallable(const CreateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::CreateStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::CreateStackAsync(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::CreateStackAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::CreateStackAsyncHelper(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStackOutcome(CreateStackResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStackOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteStackOutcome CloudFormationClient::DeleteStack(const DeleteStackRequest& request) const
@@ -216,17 +258,31 @@ DeleteStackOutcome CloudFormationClient::DeleteStack(const DeleteStackRequest& r
 
 DeleteStackOutcomeCallable CloudFormationClient::DeleteStackCallable(const DeleteStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DeleteStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DeleteStackAsync(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DeleteStackAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::DeleteStackAsyncHelper(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStackOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStackOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeAccountLimitsOutcome CloudFormationClient::DescribeAccountLimits(const DescribeAccountLimitsRequest& request) const
@@ -246,17 +302,31 @@ DescribeAccountLimitsOutcome CloudFormationClient::DescribeAccountLimits(const D
 
 DescribeAccountLimitsOutcomeCallable CloudFormationClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeAccountLimits, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAccountLimitsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAccountLimits( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeAccountLimits(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAccountLimitsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(DescribeAccountLimitsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeStackEventsOutcome CloudFormationClient::DescribeStackEvents(const DescribeStackEventsRequest& request) const
@@ -276,17 +346,31 @@ DescribeStackEventsOutcome CloudFormationClient::DescribeStackEvents(const Descr
 
 DescribeStackEventsOutcomeCallable CloudFormationClient::DescribeStackEventsCallable(const DescribeStackEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackEvents, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStackEventsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStackEvents( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStackEventsAsync(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackEventsAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::DescribeStackEventsAsyncHelper(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeStackEvents(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStackEventsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStackEventsOutcome(DescribeStackEventsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStackEventsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeStackResourceOutcome CloudFormationClient::DescribeStackResource(const DescribeStackResourceRequest& request) const
@@ -306,17 +390,31 @@ DescribeStackResourceOutcome CloudFormationClient::DescribeStackResource(const D
 
 DescribeStackResourceOutcomeCallable CloudFormationClient::DescribeStackResourceCallable(const DescribeStackResourceRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStackResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStackResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStackResourceAsync(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackResourceAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::DescribeStackResourceAsyncHelper(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeStackResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStackResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStackResourceOutcome(DescribeStackResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStackResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeStackResourcesOutcome CloudFormationClient::DescribeStackResources(const DescribeStackResourcesRequest& request) const
@@ -336,17 +434,31 @@ DescribeStackResourcesOutcome CloudFormationClient::DescribeStackResources(const
 
 DescribeStackResourcesOutcomeCallable CloudFormationClient::DescribeStackResourcesCallable(const DescribeStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStackResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStackResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStackResourcesAsync(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackResourcesAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::DescribeStackResourcesAsyncHelper(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeStackResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStackResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStackResourcesOutcome(DescribeStackResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStackResourcesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DescribeStacksOutcome CloudFormationClient::DescribeStacks(const DescribeStacksRequest& request) const
@@ -366,17 +478,31 @@ DescribeStacksOutcome CloudFormationClient::DescribeStacks(const DescribeStacksR
 
 DescribeStacksOutcomeCallable CloudFormationClient::DescribeStacksCallable(const DescribeStacksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStacks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStacksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStacks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStacksAsync(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStacksAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::DescribeStacksAsyncHelper(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DescribeStacks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStacksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStacksOutcome(DescribeStacksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStacksOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 EstimateTemplateCostOutcome CloudFormationClient::EstimateTemplateCost(const EstimateTemplateCostRequest& request) const
@@ -396,17 +522,31 @@ EstimateTemplateCostOutcome CloudFormationClient::EstimateTemplateCost(const Est
 
 EstimateTemplateCostOutcomeCallable CloudFormationClient::EstimateTemplateCostCallable(const EstimateTemplateCostRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::EstimateTemplateCost, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EstimateTemplateCostOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EstimateTemplateCost( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::EstimateTemplateCostAsync(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::EstimateTemplateCostAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::EstimateTemplateCostAsyncHelper(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, EstimateTemplateCost(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<EstimateTemplateCostRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EstimateTemplateCostOutcome(EstimateTemplateCostResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EstimateTemplateCostOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 GetStackPolicyOutcome CloudFormationClient::GetStackPolicy(const GetStackPolicyRequest& request) const
@@ -426,17 +566,31 @@ GetStackPolicyOutcome CloudFormationClient::GetStackPolicy(const GetStackPolicyR
 
 GetStackPolicyOutcomeCallable CloudFormationClient::GetStackPolicyCallable(const GetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetStackPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStackPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStackPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::GetStackPolicyAsync(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetStackPolicyAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::GetStackPolicyAsyncHelper(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetStackPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetStackPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStackPolicyOutcome(GetStackPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStackPolicyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 GetTemplateOutcome CloudFormationClient::GetTemplate(const GetTemplateRequest& request) const
@@ -456,17 +610,31 @@ GetTemplateOutcome CloudFormationClient::GetTemplate(const GetTemplateRequest& r
 
 GetTemplateOutcomeCallable CloudFormationClient::GetTemplateCallable(const GetTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetTemplate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTemplateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTemplate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::GetTemplateAsync(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetTemplateAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::GetTemplateAsyncHelper(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetTemplate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetTemplateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTemplateOutcome(GetTemplateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTemplateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 GetTemplateSummaryOutcome CloudFormationClient::GetTemplateSummary(const GetTemplateSummaryRequest& request) const
@@ -486,17 +654,31 @@ GetTemplateSummaryOutcome CloudFormationClient::GetTemplateSummary(const GetTemp
 
 GetTemplateSummaryOutcomeCallable CloudFormationClient::GetTemplateSummaryCallable(const GetTemplateSummaryRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetTemplateSummary, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTemplateSummaryOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTemplateSummary( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::GetTemplateSummaryAsync(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetTemplateSummaryAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::GetTemplateSummaryAsyncHelper(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetTemplateSummary(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetTemplateSummaryRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTemplateSummaryOutcome(GetTemplateSummaryResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTemplateSummaryOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ListStackResourcesOutcome CloudFormationClient::ListStackResources(const ListStackResourcesRequest& request) const
@@ -516,17 +698,31 @@ ListStackResourcesOutcome CloudFormationClient::ListStackResources(const ListSta
 
 ListStackResourcesOutcomeCallable CloudFormationClient::ListStackResourcesCallable(const ListStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ListStackResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListStackResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStackResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ListStackResourcesAsync(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ListStackResourcesAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::ListStackResourcesAsyncHelper(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListStackResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ListStackResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStackResourcesOutcome(ListStackResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStackResourcesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ListStacksOutcome CloudFormationClient::ListStacks(const ListStacksRequest& request) const
@@ -546,17 +742,31 @@ ListStacksOutcome CloudFormationClient::ListStacks(const ListStacksRequest& requ
 
 ListStacksOutcomeCallable CloudFormationClient::ListStacksCallable(const ListStacksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ListStacks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListStacksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStacks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ListStacksAsync(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ListStacksAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::ListStacksAsyncHelper(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListStacks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ListStacksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStacksOutcome(ListStacksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStacksOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 SetStackPolicyOutcome CloudFormationClient::SetStackPolicy(const SetStackPolicyRequest& request) const
@@ -576,17 +786,31 @@ SetStackPolicyOutcome CloudFormationClient::SetStackPolicy(const SetStackPolicyR
 
 SetStackPolicyOutcomeCallable CloudFormationClient::SetStackPolicyCallable(const SetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::SetStackPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetStackPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetStackPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::SetStackPolicyAsync(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::SetStackPolicyAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::SetStackPolicyAsyncHelper(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, SetStackPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetStackPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetStackPolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetStackPolicyOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 SignalResourceOutcome CloudFormationClient::SignalResource(const SignalResourceRequest& request) const
@@ -606,17 +830,31 @@ SignalResourceOutcome CloudFormationClient::SignalResource(const SignalResourceR
 
 SignalResourceOutcomeCallable CloudFormationClient::SignalResourceCallable(const SignalResourceRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::SignalResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SignalResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SignalResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::SignalResourceAsync(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::SignalResourceAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::SignalResourceAsyncHelper(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, SignalResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SignalResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SignalResourceOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SignalResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 UpdateStackOutcome CloudFormationClient::UpdateStack(const UpdateStackRequest& request) const
@@ -636,17 +874,31 @@ UpdateStackOutcome CloudFormationClient::UpdateStack(const UpdateStackRequest& r
 
 UpdateStackOutcomeCallable CloudFormationClient::UpdateStackCallable(const UpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::UpdateStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::UpdateStackAsync(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::UpdateStackAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::UpdateStackAsyncHelper(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<UpdateStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStackOutcome(UpdateStackResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStackOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 ValidateTemplateOutcome CloudFormationClient::ValidateTemplate(const ValidateTemplateRequest& request) const
@@ -666,16 +918,30 @@ ValidateTemplateOutcome CloudFormationClient::ValidateTemplate(const ValidateTem
 
 ValidateTemplateOutcomeCallable CloudFormationClient::ValidateTemplateCallable(const ValidateTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ValidateTemplate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ValidateTemplateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ValidateTemplate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ValidateTemplateAsync(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ValidateTemplateAsyncHelper, this, request, handler, context);
-}
-
-void CloudFormationClient::ValidateTemplateAsyncHelper(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ValidateTemplate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ValidateTemplateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ValidateTemplateOutcome(ValidateTemplateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ValidateTemplateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
@@ -37,6 +37,7 @@ ContinueUpdateRollbackResult::ContinueUpdateRollbackResult(const AmazonWebServic
 
 ContinueUpdateRollbackResult& ContinueUpdateRollbackResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
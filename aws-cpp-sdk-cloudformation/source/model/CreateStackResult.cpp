@@ -37,6 +37,7 @@ CreateStackResult::CreateStackResult(const AmazonWebServiceResult<XmlDocument>&
 
 CreateStackResult& CreateStackResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
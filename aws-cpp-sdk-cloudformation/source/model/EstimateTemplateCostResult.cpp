@@ -37,6 +37,7 @@ EstimateTemplateCostResult::EstimateTemplateCostResult(const AmazonWebServiceRes
 
 EstimateTemplateCostResult& EstimateTemplateCostResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetStackPolicyResult::GetStackPolicyResult(const AmazonWebServiceResult<XmlDocum
 
 GetStackPolicyResult& GetStackPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
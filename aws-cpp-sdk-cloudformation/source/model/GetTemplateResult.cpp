@@ -37,6 +37,7 @@ GetTemplateResult::GetTemplateResult(const AmazonWebServiceResult<XmlDocument>&
 
 GetTemplateResult& GetTemplateResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
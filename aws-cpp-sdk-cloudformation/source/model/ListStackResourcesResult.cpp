@@ -37,6 +37,7 @@ ListStackResourcesResult::ListStackResourcesResult(const AmazonWebServiceResult<
 
 ListStackResourcesResult& ListStackResourcesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListStacksResult::ListStacksResult(const AmazonWebServiceResult<XmlDocument>& re
 
 ListStacksResult& ListStacksResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ UpdateStackResult::UpdateStackResult(const AmazonWebServiceResult<XmlDocument>&
 
 UpdateStackResult& UpdateStackResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     CreateDistribution2016_01_28Request();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateDistribution2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     /**
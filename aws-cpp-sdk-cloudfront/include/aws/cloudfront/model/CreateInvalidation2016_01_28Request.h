@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     CreateInvalidation2016_01_28Request();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateInvalidation2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     ListCloudFrontOriginAccessIdentities2016_01_28Request();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListCloudFrontOriginAccessIdentities2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
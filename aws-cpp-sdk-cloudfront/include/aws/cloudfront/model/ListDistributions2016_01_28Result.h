@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudfront/CloudFront_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudfront/model/DistributionList.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * The returned result of the corresponding request.
    */
-  class AWS_CLOUDFRONT_API ListDistributions2016_01_28Result
+  class AWS_CLOUDFRONT_API ListDistributions2016_01_28Result : public AmazonWebServiceResultBase
   {
   public:
     ListDistributions2016_01_28Result();
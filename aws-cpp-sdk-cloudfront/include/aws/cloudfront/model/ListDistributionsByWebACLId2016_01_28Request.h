@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     ListDistributionsByWebACLId2016_01_28Request();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListDistributionsByWebACLId2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudfront/CloudFront_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudfront/model/DistributionList.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * The response to a request to list the distributions that are associated with a
    * specified AWS WAF web ACL.
    */
-  class AWS_CLOUDFRONT_API ListDistributionsByWebACLId2016_01_28Result
+  class AWS_CLOUDFRONT_API ListDistributionsByWebACLId2016_01_28Result : public AmazonWebServiceResultBase
   {
   public:
     ListDistributionsByWebACLId2016_01_28Result();
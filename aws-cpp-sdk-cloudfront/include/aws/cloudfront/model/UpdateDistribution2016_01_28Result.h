@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudfront/CloudFront_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudfront/model/Distribution.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * The returned result of the corresponding request.
    */
-  class AWS_CLOUDFRONT_API UpdateDistribution2016_01_28Result
+  class AWS_CLOUDFRONT_API UpdateDistribution2016_01_28Result : public AmazonWebServiceResultBase
   {
   public:
     UpdateDistribution2016_01_28Result();
@@ -129,17 +129,31 @@ CreateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::CreateCl
 
 CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Callable(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
+  auto sharedRequest = Aws::MakeShared<CreateCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(CreateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_28(const CreateDistribution2016_01_28Request& request) const
@@ -159,17 +173,31 @@ CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_
 
 CreateDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateDistribution2016_01_28Callable(const CreateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateDistribution2016_01_28Async(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::CreateDistribution2016_01_28AsyncHelper(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution";
+  auto sharedRequest = Aws::MakeShared<CreateDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDistribution2016_01_28Outcome(CreateDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_28(const CreateInvalidation2016_01_28Request& request) const
@@ -191,17 +219,33 @@ CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_
 
 CreateInvalidation2016_01_28OutcomeCallable CloudFrontClient::CreateInvalidation2016_01_28Callable(const CreateInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateInvalidation2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateInvalidation2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateInvalidation2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateInvalidation2016_01_28Async(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateInvalidation2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation";
+  auto sharedRequest = Aws::MakeShared<CreateInvalidation2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateInvalidation2016_01_28Outcome(CreateInvalidation2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateInvalidation2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDistribution2016_01_28(const CreateStreamingDistribution2016_01_28Request& request) const
@@ -221,17 +265,31 @@ CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDi
 
 CreateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateStreamingDistribution2016_01_28Callable(const CreateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, CreateStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution";
+  auto sharedRequest = Aws::MakeShared<CreateStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStreamingDistribution2016_01_28Outcome(CreateStreamingDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
@@ -252,17 +310,32 @@ DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCl
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_28(const DeleteDistribution2016_01_28Request& request) const
@@ -283,17 +356,32 @@ DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_
 
 DeleteDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteDistribution2016_01_28Callable(const DeleteDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::DeleteDistribution2016_01_28Async(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDistribution2016_01_28Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDistribution2016_01_28(const DeleteStreamingDistribution2016_01_28Request& request) const
@@ -314,17 +402,32 @@ DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDi
 
 DeleteStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2016_01_28Callable(const DeleteStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, DeleteStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStreamingDistribution2016_01_28Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
@@ -345,17 +448,32 @@ GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFro
 
 GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Callable(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentity2016_01_28Outcome(GetCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
@@ -377,17 +495,33 @@ GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCl
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetCloudFrontOriginAccessIdentityConfig2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<GetCloudFrontOriginAccessIdentityConfig2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(GetCloudFrontOriginAccessIdentityConfig2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(const GetDistribution2016_01_28Request& request) const
@@ -408,17 +542,32 @@ GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(con
 
 GetDistribution2016_01_28OutcomeCallable CloudFrontClient::GetDistribution2016_01_28Callable(const GetDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetDistribution2016_01_28Async(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetDistribution2016_01_28AsyncHelper(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDistribution2016_01_28Outcome(GetDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig2016_01_28(const GetDistributionConfig2016_01_28Request& request) const
@@ -440,17 +589,33 @@ GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig20
 
 GetDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetDistributionConfig2016_01_28Callable(const GetDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetDistributionConfig2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDistributionConfig2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistributionConfig2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetDistributionConfig2016_01_28Async(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetDistributionConfig2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<GetDistributionConfig2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDistributionConfig2016_01_28Outcome(GetDistributionConfig2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDistributionConfig2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(const GetInvalidation2016_01_28Request& request) const
@@ -473,17 +638,34 @@ GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(con
 
 GetInvalidation2016_01_28OutcomeCallable CloudFrontClient::GetInvalidation2016_01_28Callable(const GetInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetInvalidation2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetInvalidation2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetInvalidation2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetInvalidation2016_01_28Async(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetInvalidation2016_01_28AsyncHelper(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetInvalidation2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetInvalidation2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetInvalidation2016_01_28Outcome(GetInvalidation2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetInvalidation2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribution2016_01_28(const GetStreamingDistribution2016_01_28Request& request) const
@@ -504,17 +686,32 @@ GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribu
 
 GetStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistribution2016_01_28Callable(const GetStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetStreamingDistribution2016_01_28Async(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStreamingDistribution2016_01_28Outcome(GetStreamingDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDistributionConfig2016_01_28(const GetStreamingDistributionConfig2016_01_28Request& request) const
@@ -536,17 +733,33 @@ GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDi
 
 GetStreamingDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2016_01_28Callable(const GetStreamingDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetStreamingDistributionConfig2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistributionConfig2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistributionConfig2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, GetStreamingDistributionConfig2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<GetStreamingDistributionConfig2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStreamingDistributionConfig2016_01_28Outcome(GetStreamingDistributionConfig2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStreamingDistributionConfig2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
@@ -566,17 +779,31 @@ ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListClou
 
 ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Callable(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListCloudFrontOriginAccessIdentities2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCloudFrontOriginAccessIdentities2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListCloudFrontOriginAccessIdentities2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
+  auto sharedRequest = Aws::MakeShared<ListCloudFrontOriginAccessIdentities2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCloudFrontOriginAccessIdentities2016_01_28Outcome(ListCloudFrontOriginAccessIdentities2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCloudFrontOriginAccessIdentities2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28(const ListDistributions2016_01_28Request& request) const
@@ -596,17 +823,31 @@ ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28
 
 ListDistributions2016_01_28OutcomeCallable CloudFrontClient::ListDistributions2016_01_28Callable(const ListDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListDistributions2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListDistributions2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributions2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListDistributions2016_01_28Async(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::ListDistributions2016_01_28AsyncHelper(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListDistributions2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution";
+  auto sharedRequest = Aws::MakeShared<ListDistributions2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDistributions2016_01_28Outcome(ListDistributions2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDistributions2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributionsByWebACLId2016_01_28(const ListDistributionsByWebACLId2016_01_28Request& request) const
@@ -627,17 +868,32 @@ ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributions
 
 ListDistributionsByWebACLId2016_01_28OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2016_01_28Callable(const ListDistributionsByWebACLId2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListDistributionsByWebACLId2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListDistributionsByWebACLId2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributionsByWebACLId2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListDistributionsByWebACLId2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distributionsByWebACLId/";
+  ss << request.GetWebACLId();
+  auto sharedRequest = Aws::MakeShared<ListDistributionsByWebACLId2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDistributionsByWebACLId2016_01_28Outcome(ListDistributionsByWebACLId2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDistributionsByWebACLId2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28(const ListInvalidations2016_01_28Request& request) const
@@ -659,17 +915,33 @@ ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28
 
 ListInvalidations2016_01_28OutcomeCallable CloudFrontClient::ListInvalidations2016_01_28Callable(const ListInvalidations2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListInvalidations2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListInvalidations2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListInvalidations2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListInvalidations2016_01_28Async(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::ListInvalidations2016_01_28AsyncHelper(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListInvalidations2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation";
+  auto sharedRequest = Aws::MakeShared<ListInvalidations2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListInvalidations2016_01_28Outcome(ListInvalidations2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListInvalidations2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistributions2016_01_28(const ListStreamingDistributions2016_01_28Request& request) const
@@ -689,17 +961,31 @@ ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistr
 
 ListStreamingDistributions2016_01_28OutcomeCallable CloudFrontClient::ListStreamingDistributions2016_01_28Callable(const ListStreamingDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListStreamingDistributions2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListStreamingDistributions2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStreamingDistributions2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListStreamingDistributions2016_01_28Async(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListStreamingDistributions2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution";
+  auto sharedRequest = Aws::MakeShared<ListStreamingDistributions2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStreamingDistributions2016_01_28Outcome(ListStreamingDistributions2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStreamingDistributions2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
@@ -721,17 +1007,33 @@ UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCl
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<UpdateCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(UpdateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_28(const UpdateDistribution2016_01_28Request& request) const
@@ -753,17 +1055,33 @@ UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_
 
 UpdateDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateDistribution2016_01_28Callable(const UpdateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::UpdateDistribution2016_01_28Async(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<UpdateDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDistribution2016_01_28Outcome(UpdateDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDistribution2016_01_28(const UpdateStreamingDistribution2016_01_28Request& request) const
@@ -785,16 +1103,32 @@ UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDi
 
 UpdateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2016_01_28Callable(const UpdateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    packagedFunction();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
-}
-
-void CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, UpdateStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<UpdateStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStreamingDistribution2016_01_28Outcome(UpdateStreamingDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
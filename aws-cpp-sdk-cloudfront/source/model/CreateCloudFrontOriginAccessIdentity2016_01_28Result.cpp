@@ -36,6 +36,7 @@ CreateCloudFrontOriginAccessIdentity2016_01_28Result::CreateCloudFrontOriginAcce
 
 CreateCloudFrontOriginAccessIdentity2016_01_28Result& CreateCloudFrontOriginAccessIdentity2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ CreateDistribution2016_01_28Result::CreateDistribution2016_01_28Result(const Ama
 
 CreateDistribution2016_01_28Result& CreateDistribution2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ CreateInvalidation2016_01_28Result::CreateInvalidation2016_01_28Result(const Ama
 
 CreateInvalidation2016_01_28Result& CreateInvalidation2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ CreateStreamingDistribution2016_01_28Result::CreateStreamingDistribution2016_01_
 
 CreateStreamingDistribution2016_01_28Result& CreateStreamingDistribution2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
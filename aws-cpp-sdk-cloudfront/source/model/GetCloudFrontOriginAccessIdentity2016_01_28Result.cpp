@@ -36,6 +36,7 @@ GetCloudFrontOriginAccessIdentity2016_01_28Result::GetCloudFrontOriginAccessIden
 
 GetCloudFrontOriginAccessIdentity2016_01_28Result& GetCloudFrontOriginAccessIdentity2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
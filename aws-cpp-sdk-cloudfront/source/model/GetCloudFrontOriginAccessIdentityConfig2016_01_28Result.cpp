@@ -36,6 +36,7 @@ GetCloudFrontOriginAccessIdentityConfig2016_01_28Result::GetCloudFrontOriginAcce
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28Result& GetCloudFrontOriginAccessIdentityConfig2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
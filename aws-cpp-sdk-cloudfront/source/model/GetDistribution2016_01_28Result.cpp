@@ -36,6 +36,7 @@ GetDistribution2016_01_28Result::GetDistribution2016_01_28Result(const AmazonWeb
 
 GetDistribution2016_01_28Result& GetDistribution2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ GetDistributionConfig2016_01_28Result::GetDistributionConfig2016_01_28Result(con
 
 GetDistributionConfig2016_01_28Result& GetDistributionConfig2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetInvalidation2016_01_28Result::GetInvalidation2016_01_28Result(const AmazonWeb
 
 GetInvalidation2016_01_28Result& GetInvalidation2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
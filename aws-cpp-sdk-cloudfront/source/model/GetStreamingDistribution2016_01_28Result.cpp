@@ -36,6 +36,7 @@ GetStreamingDistribution2016_01_28Result::GetStreamingDistribution2016_01_28Resu
 
 GetStreamingDistribution2016_01_28Result& GetStreamingDistribution2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ GetStreamingDistributionConfig2016_01_28Result::GetStreamingDistributionConfig20
 
 GetStreamingDistributionConfig2016_01_28Result& GetStreamingDistributionConfig2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
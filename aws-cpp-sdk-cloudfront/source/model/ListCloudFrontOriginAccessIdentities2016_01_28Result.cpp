@@ -35,6 +35,7 @@ ListCloudFrontOriginAccessIdentities2016_01_28Result::ListCloudFrontOriginAccess
 
 ListCloudFrontOriginAccessIdentities2016_01_28Result& ListCloudFrontOriginAccessIdentities2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ ListDistributions2016_01_28Result::ListDistributions2016_01_28Result(const Amazo
 
 ListDistributions2016_01_28Result& ListDistributions2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ ListDistributionsByWebACLId2016_01_28Result::ListDistributionsByWebACLId2016_01_
 
 ListDistributionsByWebACLId2016_01_28Result& ListDistributionsByWebACLId2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ ListInvalidations2016_01_28Result::ListInvalidations2016_01_28Result(const Amazo
 
 ListInvalidations2016_01_28Result& ListInvalidations2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
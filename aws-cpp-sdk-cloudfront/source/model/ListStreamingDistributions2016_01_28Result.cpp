@@ -35,6 +35,7 @@ ListStreamingDistributions2016_01_28Result::ListStreamingDistributions2016_01_28
 
 ListStreamingDistributions2016_01_28Result& ListStreamingDistributions2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ UpdateCloudFrontOriginAccessIdentity2016_01_28Result::UpdateCloudFrontOriginAcce
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28Result& UpdateCloudFrontOriginAccessIdentity2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ UpdateDistribution2016_01_28Result::UpdateDistribution2016_01_28Result(const Ama
 
 UpdateDistribution2016_01_28Result& UpdateDistribution2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
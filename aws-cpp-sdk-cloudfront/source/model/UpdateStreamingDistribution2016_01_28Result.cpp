@@ -36,6 +36,7 @@ UpdateStreamingDistribution2016_01_28Result::UpdateStreamingDistribution2016_01_
 
 UpdateStreamingDistribution2016_01_28Result& UpdateStreamingDistribution2016_01_28Result::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
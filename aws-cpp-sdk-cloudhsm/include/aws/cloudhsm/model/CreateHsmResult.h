@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of the <a>CreateHsm</a> operation.</p>
    */
-  class AWS_CLOUDHSM_API CreateHsmResult
+  class AWS_CLOUDHSM_API CreateHsmResult : public AmazonWebServiceResultBase
   {
   public:
     CreateHsmResult();
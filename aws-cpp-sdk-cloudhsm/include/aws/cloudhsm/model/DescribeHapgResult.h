@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudhsm/model/CloudHsmObjectState.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the output of the <a>DescribeHapg</a> action.</p>
    */
-  class AWS_CLOUDHSM_API DescribeHapgResult
+  class AWS_CLOUDHSM_API DescribeHapgResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeHapgResult();
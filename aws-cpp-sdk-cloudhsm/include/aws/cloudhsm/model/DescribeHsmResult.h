@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudhsm/model/HsmStatus.h>
 #include <aws/cloudhsm/model/SubscriptionType.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Contains the output of the <a>DescribeHsm</a> operation.</p>
    */
-  class AWS_CLOUDHSM_API DescribeHsmResult
+  class AWS_CLOUDHSM_API DescribeHsmResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeHsmResult();
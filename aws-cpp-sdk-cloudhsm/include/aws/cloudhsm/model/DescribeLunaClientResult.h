@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace CloudHSM
 {
 namespace Model
 {
-  class AWS_CLOUDHSM_API DescribeLunaClientResult
+  class AWS_CLOUDHSM_API DescribeLunaClientResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeLunaClientResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace CloudHSM
 {
 namespace Model
 {
-  class AWS_CLOUDHSM_API ListAvailableZonesResult
+  class AWS_CLOUDHSM_API ListAvailableZonesResult : public AmazonWebServiceResultBase
   {
   public:
     ListAvailableZonesResult();
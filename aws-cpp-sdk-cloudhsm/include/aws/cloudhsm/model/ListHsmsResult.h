@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the output of the <a>ListHsms</a> operation.</p>
    */
-  class AWS_CLOUDHSM_API ListHsmsResult
+  class AWS_CLOUDHSM_API ListHsmsResult : public AmazonWebServiceResultBase
   {
   public:
     ListHsmsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudhsm/CloudHSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudhsm/model/Tag.h>
 
@@ -33,7 +34,7 @@ namespace CloudHSM
 {
 namespace Model
 {
-  class AWS_CLOUDHSM_API ListTagsForResourceResult
+  class AWS_CLOUDHSM_API ListTagsForResourceResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForResourceResult();
@@ -35,6 +35,7 @@ CreateHapgResult::CreateHapgResult(const AmazonWebServiceResult<JsonValue>& resu
 
 CreateHapgResult& CreateHapgResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HapgArn"))
   {
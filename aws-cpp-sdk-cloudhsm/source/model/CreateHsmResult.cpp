@@ -35,6 +35,7 @@ CreateHsmResult::CreateHsmResult(const AmazonWebServiceResult<JsonValue>& result
 
 CreateHsmResult& CreateHsmResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HsmArn"))
   {
@@ -35,6 +35,7 @@ CreateLunaClientResult::CreateLunaClientResult(const AmazonWebServiceResult<Json
 
 CreateLunaClientResult& CreateLunaClientResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ClientArn"))
   {
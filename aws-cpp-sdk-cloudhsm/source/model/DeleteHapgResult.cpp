@@ -35,6 +35,7 @@ DeleteHapgResult::DeleteHapgResult(const AmazonWebServiceResult<JsonValue>& resu
 
 DeleteHapgResult& DeleteHapgResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Status"))
   {
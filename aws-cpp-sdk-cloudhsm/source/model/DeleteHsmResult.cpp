@@ -35,6 +35,7 @@ DeleteHsmResult::DeleteHsmResult(const AmazonWebServiceResult<JsonValue>& result
 
 DeleteHsmResult& DeleteHsmResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Status"))
   {
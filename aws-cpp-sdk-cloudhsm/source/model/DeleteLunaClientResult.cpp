@@ -35,6 +35,7 @@ DeleteLunaClientResult::DeleteLunaClientResult(const AmazonWebServiceResult<Json
 
 DeleteLunaClientResult& DeleteLunaClientResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Status"))
   {
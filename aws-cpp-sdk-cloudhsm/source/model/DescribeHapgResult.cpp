@@ -35,6 +35,7 @@ DescribeHapgResult::DescribeHapgResult(const AmazonWebServiceResult<JsonValue>&
 
 DescribeHapgResult& DescribeHapgResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HapgArn"))
   {
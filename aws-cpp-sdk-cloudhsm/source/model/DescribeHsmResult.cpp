@@ -35,6 +35,7 @@ DescribeHsmResult::DescribeHsmResult(const AmazonWebServiceResult<JsonValue>& re
 
 DescribeHsmResult& DescribeHsmResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HsmArn"))
   {
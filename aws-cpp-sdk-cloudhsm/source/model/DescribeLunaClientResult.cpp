@@ -35,6 +35,7 @@ DescribeLunaClientResult::DescribeLunaClientResult(const AmazonWebServiceResult<
 
 DescribeLunaClientResult& DescribeLunaClientResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ClientArn"))
   {
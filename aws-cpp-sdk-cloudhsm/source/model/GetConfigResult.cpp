@@ -35,6 +35,7 @@ GetConfigResult::GetConfigResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetConfigResult& GetConfigResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ConfigType"))
   {
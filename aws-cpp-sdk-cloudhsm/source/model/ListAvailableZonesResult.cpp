@@ -35,6 +35,7 @@ ListAvailableZonesResult::ListAvailableZonesResult(const AmazonWebServiceResult<
 
 ListAvailableZonesResult& ListAvailableZonesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AZList"))
   {
@@ -35,6 +35,7 @@ ListHapgsResult::ListHapgsResult(const AmazonWebServiceResult<JsonValue>& result
 
 ListHapgsResult& ListHapgsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HapgList"))
   {
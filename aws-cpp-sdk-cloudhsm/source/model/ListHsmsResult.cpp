@@ -35,6 +35,7 @@ ListHsmsResult::ListHsmsResult(const AmazonWebServiceResult<JsonValue>& result)
 
 ListHsmsResult& ListHsmsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HsmList"))
   {
@@ -35,6 +35,7 @@ ListLunaClientsResult::ListLunaClientsResult(const AmazonWebServiceResult<JsonVa
 
 ListLunaClientsResult& ListLunaClientsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ClientList"))
   {
@@ -35,6 +35,7 @@ ModifyHapgResult::ModifyHapgResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ModifyHapgResult& ModifyHapgResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HapgArn"))
   {
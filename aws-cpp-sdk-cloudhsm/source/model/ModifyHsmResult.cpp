@@ -35,6 +35,7 @@ ModifyHsmResult::ModifyHsmResult(const AmazonWebServiceResult<JsonValue>& result
 
 ModifyHsmResult& ModifyHsmResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("HsmArn"))
   {
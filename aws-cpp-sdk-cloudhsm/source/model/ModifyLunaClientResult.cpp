@@ -35,6 +35,7 @@ ModifyLunaClientResult::ModifyLunaClientResult(const AmazonWebServiceResult<Json
 
 ModifyLunaClientResult& ModifyLunaClientResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ClientArn"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The result of a <code>BuildSuggester</code> request. Contains a list of the
    * fields used for suggestions.</p>
    */
-  class AWS_CLOUDSEARCH_API BuildSuggestersResult
+  class AWS_CLOUDSEARCH_API BuildSuggestersResult : public AmazonWebServiceResultBase
   {
   public:
     BuildSuggestersResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/DomainStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>CreateDomainRequest</code>. Contains the status of a
    * newly created domain.</p>
    */
-  class AWS_CLOUDSEARCH_API CreateDomainResult
+  class AWS_CLOUDSEARCH_API CreateDomainResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDomainResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/AnalysisSchemeStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code><a>DefineAnalysisScheme</a></code> request. Contains
    * the status of the newly-configured analysis scheme.</p>
    */
-  class AWS_CLOUDSEARCH_API DefineAnalysisSchemeResult
+  class AWS_CLOUDSEARCH_API DefineAnalysisSchemeResult : public AmazonWebServiceResultBase
   {
   public:
     DefineAnalysisSchemeResult();
@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     DefineExpressionRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DefineExpression"; }
+
     Aws::String SerializePayload() const override;
 
     
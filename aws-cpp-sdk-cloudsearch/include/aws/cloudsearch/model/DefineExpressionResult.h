@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/ExpressionStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>DefineExpression</code> request. Contains the status of
    * the newly-configured expression.</p>
    */
-  class AWS_CLOUDSEARCH_API DefineExpressionResult
+  class AWS_CLOUDSEARCH_API DefineExpressionResult : public AmazonWebServiceResultBase
   {
   public:
     DefineExpressionResult();
@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     DefineIndexFieldRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DefineIndexField"; }
+
     Aws::String SerializePayload() const override;
 
     
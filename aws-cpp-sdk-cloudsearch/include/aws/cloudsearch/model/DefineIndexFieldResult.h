@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/IndexFieldStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code><a>DefineIndexField</a></code> request. Contains the
    * status of the newly-configured index field.</p>
    */
-  class AWS_CLOUDSEARCH_API DefineIndexFieldResult
+  class AWS_CLOUDSEARCH_API DefineIndexFieldResult : public AmazonWebServiceResultBase
   {
   public:
     DefineIndexFieldResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/SuggesterStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>DefineSuggester</code> request. Contains the status of
    * the newly-configured suggester.</p>
    */
-  class AWS_CLOUDSEARCH_API DefineSuggesterResult
+  class AWS_CLOUDSEARCH_API DefineSuggesterResult : public AmazonWebServiceResultBase
   {
   public:
     DefineSuggesterResult();
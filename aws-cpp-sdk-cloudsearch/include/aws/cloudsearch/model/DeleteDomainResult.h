@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/DomainStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * newly deleted domain, or no status if the domain has already been completely
    * deleted.</p>
    */
-  class AWS_CLOUDSEARCH_API DeleteDomainResult
+  class AWS_CLOUDSEARCH_API DeleteDomainResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteDomainResult();
@@ -37,6 +37,10 @@ namespace Model
   {
   public:
     DescribeAnalysisSchemesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeAnalysisSchemes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/AvailabilityOptionsStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * whether or not the Multi-AZ option is enabled for the domain specified in the
    * request. </p>
    */
-  class AWS_CLOUDSEARCH_API DescribeAvailabilityOptionsResult
+  class AWS_CLOUDSEARCH_API DescribeAvailabilityOptionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAvailabilityOptionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 #include <aws/cloudsearch/model/DomainStatus.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The result of a <code>DescribeDomains</code> request. Contains the status of
    * the domains specified in the request or all domains owned by the account.</p>
    */
-  class AWS_CLOUDSEARCH_API DescribeDomainsResult
+  class AWS_CLOUDSEARCH_API DescribeDomainsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDomainsResult();
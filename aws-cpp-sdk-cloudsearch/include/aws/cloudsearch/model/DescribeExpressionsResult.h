@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 #include <aws/cloudsearch/model/ExpressionStatus.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The result of a <code>DescribeExpressions</code> request. Contains the
    * expressions configured for the domain specified in the request.</p>
    */
-  class AWS_CLOUDSEARCH_API DescribeExpressionsResult
+  class AWS_CLOUDSEARCH_API DescribeExpressionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeExpressionsResult();
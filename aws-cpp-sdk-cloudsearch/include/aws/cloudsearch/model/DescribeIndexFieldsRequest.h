@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     DescribeIndexFieldsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeIndexFields"; }
+
     Aws::String SerializePayload() const override;
 
     /**
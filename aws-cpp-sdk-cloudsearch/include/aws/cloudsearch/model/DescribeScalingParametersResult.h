@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/ScalingParametersStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>DescribeScalingParameters</code> request. Contains the
    * scaling parameters configured for the domain specified in the request.</p>
    */
-  class AWS_CLOUDSEARCH_API DescribeScalingParametersResult
+  class AWS_CLOUDSEARCH_API DescribeScalingParametersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeScalingParametersResult();
@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     DescribeServiceAccessPoliciesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeServiceAccessPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
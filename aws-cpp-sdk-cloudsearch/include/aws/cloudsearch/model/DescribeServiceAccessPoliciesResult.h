@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/AccessPoliciesStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The result of a <code>DescribeServiceAccessPolicies</code> request.</p>
    */
-  class AWS_CLOUDSEARCH_API DescribeServiceAccessPoliciesResult
+  class AWS_CLOUDSEARCH_API DescribeServiceAccessPoliciesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeServiceAccessPoliciesResult();
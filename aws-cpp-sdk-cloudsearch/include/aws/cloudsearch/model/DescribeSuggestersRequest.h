@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     DescribeSuggestersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeSuggesters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
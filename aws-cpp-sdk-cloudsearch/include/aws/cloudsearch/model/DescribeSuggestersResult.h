@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 #include <aws/cloudsearch/model/SuggesterStatus.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The result of a <code>DescribeSuggesters</code> request.</p>
    */
-  class AWS_CLOUDSEARCH_API DescribeSuggestersResult
+  class AWS_CLOUDSEARCH_API DescribeSuggestersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeSuggestersResult();
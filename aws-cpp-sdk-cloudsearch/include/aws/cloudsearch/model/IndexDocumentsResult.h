@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The result of an <code>IndexDocuments</code> request. Contains the status of
    * the indexing operation, including the fields being indexed.</p>
    */
-  class AWS_CLOUDSEARCH_API IndexDocumentsResult
+  class AWS_CLOUDSEARCH_API IndexDocumentsResult : public AmazonWebServiceResultBase
   {
   public:
     IndexDocumentsResult();
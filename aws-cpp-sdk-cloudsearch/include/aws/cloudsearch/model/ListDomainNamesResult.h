@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The result of a <code>ListDomainNames</code> request. Contains a list of the
    * domains owned by an account.</p>
    */
-  class AWS_CLOUDSEARCH_API ListDomainNamesResult
+  class AWS_CLOUDSEARCH_API ListDomainNamesResult : public AmazonWebServiceResultBase
   {
   public:
     ListDomainNamesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/AvailabilityOptionsStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>UpdateAvailabilityOptions</code> request. Contains the
    * status of the domain's availability options. </p>
    */
-  class AWS_CLOUDSEARCH_API UpdateAvailabilityOptionsResult
+  class AWS_CLOUDSEARCH_API UpdateAvailabilityOptionsResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateAvailabilityOptionsResult();
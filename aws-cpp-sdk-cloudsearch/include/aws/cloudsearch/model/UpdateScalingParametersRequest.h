@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     UpdateScalingParametersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UpdateScalingParameters"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/ScalingParametersStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>UpdateScalingParameters</code> request. Contains the
    * status of the newly-configured scaling parameters.</p>
    */
-  class AWS_CLOUDSEARCH_API UpdateScalingParametersResult
+  class AWS_CLOUDSEARCH_API UpdateScalingParametersResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateScalingParametersResult();
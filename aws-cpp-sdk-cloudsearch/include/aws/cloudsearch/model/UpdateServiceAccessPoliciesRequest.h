@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     UpdateServiceAccessPoliciesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UpdateServiceAccessPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     
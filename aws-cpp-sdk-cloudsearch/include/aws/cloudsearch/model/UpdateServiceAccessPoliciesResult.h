@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearch/CloudSearch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearch/model/AccessPoliciesStatus.h>
 #include <aws/cloudsearch/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of an <code>UpdateServiceAccessPolicies</code> request. Contains
    * the new access policies.</p>
    */
-  class AWS_CLOUDSEARCH_API UpdateServiceAccessPoliciesResult
+  class AWS_CLOUDSEARCH_API UpdateServiceAccessPoliciesResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateServiceAccessPoliciesResult();
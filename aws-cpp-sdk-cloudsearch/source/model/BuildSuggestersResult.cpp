@@ -37,6 +37,7 @@ BuildSuggestersResult::BuildSuggestersResult(const AmazonWebServiceResult<XmlDoc
 
 BuildSuggestersResult& BuildSuggestersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
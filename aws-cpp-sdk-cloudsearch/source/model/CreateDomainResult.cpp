@@ -37,6 +37,7 @@ CreateDomainResult::CreateDomainResult(const AmazonWebServiceResult<XmlDocument>
 
 CreateDomainResult& CreateDomainResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DefineAnalysisSchemeResult::DefineAnalysisSchemeResult(const AmazonWebServiceRes
 
 DefineAnalysisSchemeResult& DefineAnalysisSchemeResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
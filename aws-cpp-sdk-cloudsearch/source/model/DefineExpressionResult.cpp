@@ -37,6 +37,7 @@ DefineExpressionResult::DefineExpressionResult(const AmazonWebServiceResult<XmlD
 
 DefineExpressionResult& DefineExpressionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DefineIndexFieldResult::DefineIndexFieldResult(const AmazonWebServiceResult<XmlD
 
 DefineIndexFieldResult& DefineIndexFieldResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
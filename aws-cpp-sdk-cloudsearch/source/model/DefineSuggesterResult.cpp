@@ -37,6 +37,7 @@ DefineSuggesterResult::DefineSuggesterResult(const AmazonWebServiceResult<XmlDoc
 
 DefineSuggesterResult& DefineSuggesterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
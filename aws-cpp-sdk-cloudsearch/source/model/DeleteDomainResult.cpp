@@ -37,6 +37,7 @@ DeleteDomainResult::DeleteDomainResult(const AmazonWebServiceResult<XmlDocument>
 
 DeleteDomainResult& DeleteDomainResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
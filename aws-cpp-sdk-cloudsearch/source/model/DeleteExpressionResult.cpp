@@ -37,6 +37,7 @@ DeleteExpressionResult::DeleteExpressionResult(const AmazonWebServiceResult<XmlD
 
 DeleteExpressionResult& DeleteExpressionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
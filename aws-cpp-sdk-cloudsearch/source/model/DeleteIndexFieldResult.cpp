@@ -37,6 +37,7 @@ DeleteIndexFieldResult::DeleteIndexFieldResult(const AmazonWebServiceResult<XmlD
 
 DeleteIndexFieldResult& DeleteIndexFieldResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeAvailabilityOptionsResult::DescribeAvailabilityOptionsResult(const Amazo
 
 DescribeAvailabilityOptionsResult& DescribeAvailabilityOptionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeExpressionsResult::DescribeExpressionsResult(const AmazonWebServiceResul
 
 DescribeExpressionsResult& DescribeExpressionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeScalingParametersResult::DescribeScalingParametersResult(const AmazonWeb
 
 DescribeScalingParametersResult& DescribeScalingParametersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeServiceAccessPoliciesResult::DescribeServiceAccessPoliciesResult(const A
 
 DescribeServiceAccessPoliciesResult& DescribeServiceAccessPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
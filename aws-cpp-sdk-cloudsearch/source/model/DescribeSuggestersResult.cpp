@@ -37,6 +37,7 @@ DescribeSuggestersResult::DescribeSuggestersResult(const AmazonWebServiceResult<
 
 DescribeSuggestersResult& DescribeSuggestersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ IndexDocumentsResult::IndexDocumentsResult(const AmazonWebServiceResult<XmlDocum
 
 IndexDocumentsResult& IndexDocumentsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListDomainNamesResult::ListDomainNamesResult(const AmazonWebServiceResult<XmlDoc
 
 ListDomainNamesResult& ListDomainNamesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ UpdateAvailabilityOptionsResult::UpdateAvailabilityOptionsResult(const AmazonWeb
 
 UpdateAvailabilityOptionsResult& UpdateAvailabilityOptionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
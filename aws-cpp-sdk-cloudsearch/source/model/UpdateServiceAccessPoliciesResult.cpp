@@ -37,6 +37,7 @@ UpdateServiceAccessPoliciesResult::UpdateServiceAccessPoliciesResult(const Amazo
 
 UpdateServiceAccessPoliciesResult& UpdateServiceAccessPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
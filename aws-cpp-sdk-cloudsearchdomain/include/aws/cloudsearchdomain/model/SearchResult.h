@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearchdomain/CloudSearchDomain_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearchdomain/model/SearchStatus.h>
 #include <aws/cloudsearchdomain/model/Hits.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
@@ -42,7 +43,7 @@ namespace Model
    * match the specified search criteria and any requested fields, highlights, and
    * facet information.</p>
    */
-  class AWS_CLOUDSEARCHDOMAIN_API SearchResult
+  class AWS_CLOUDSEARCHDOMAIN_API SearchResult : public AmazonWebServiceResultBase
   {
   public:
     SearchResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearchdomain/CloudSearchDomain_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cloudsearchdomain/model/SuggestStatus.h>
 #include <aws/cloudsearchdomain/model/SuggestModel.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>Suggest</code> request.</p>
    */
-  class AWS_CLOUDSEARCHDOMAIN_API SuggestResult
+  class AWS_CLOUDSEARCHDOMAIN_API SuggestResult : public AmazonWebServiceResultBase
   {
   public:
     SuggestResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudsearchdomain/CloudSearchDomain_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudsearchdomain/model/DocumentServiceWarning.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the response to an <code>UploadDocuments</code> request.</p>
    */
-  class AWS_CLOUDSEARCHDOMAIN_API UploadDocumentsResult
+  class AWS_CLOUDSEARCHDOMAIN_API UploadDocumentsResult : public AmazonWebServiceResultBase
   {
   public:
     UploadDocumentsResult();
@@ -35,6 +35,7 @@ SearchResult::SearchResult(const AmazonWebServiceResult<JsonValue>& result)
 
 SearchResult& SearchResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -35,6 +35,7 @@ SuggestResult::SuggestResult(const AmazonWebServiceResult<JsonValue>& result)
 
 SuggestResult& SuggestResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -39,6 +39,7 @@ UploadDocumentsResult::UploadDocumentsResult(const AmazonWebServiceResult<JsonVa
 
 UploadDocumentsResult& UploadDocumentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cloudtrail/model/Trail.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Returns the objects or data listed below if successful. Otherwise, returns an
    * error.</p>
    */
-  class AWS_CLOUDTRAIL_API DescribeTrailsResult
+  class AWS_CLOUDTRAIL_API DescribeTrailsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTrailsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Returns the objects or data listed below if successful. Otherwise, returns an
    * error.</p>
    */
-  class AWS_CLOUDTRAIL_API GetTrailStatusResult
+  class AWS_CLOUDTRAIL_API GetTrailStatusResult : public AmazonWebServiceResultBase
   {
   public:
     GetTrailStatusResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudtrail/model/PublicKey.h>
@@ -38,7 +39,7 @@ namespace Model
    * Returns the objects or data listed below if successful. Otherwise, returns an
    * error.
    */
-  class AWS_CLOUDTRAIL_API ListPublicKeysResult
+  class AWS_CLOUDTRAIL_API ListPublicKeysResult : public AmazonWebServiceResultBase
   {
   public:
     ListPublicKeysResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudtrail/model/ResourceTag.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p> Returns the objects or data listed below if successful. Otherwise, returns
    * an error. </p>
    */
-  class AWS_CLOUDTRAIL_API ListTagsResult
+  class AWS_CLOUDTRAIL_API ListTagsResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsResult();
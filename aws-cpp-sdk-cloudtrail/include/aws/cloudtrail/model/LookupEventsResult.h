@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cloudtrail/model/Event.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains a response to a LookupEvents action.</p>
    */
-  class AWS_CLOUDTRAIL_API LookupEventsResult
+  class AWS_CLOUDTRAIL_API LookupEventsResult : public AmazonWebServiceResultBase
   {
   public:
     LookupEventsResult();
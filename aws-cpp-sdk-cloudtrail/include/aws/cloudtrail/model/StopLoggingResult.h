@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -35,7 +36,7 @@ namespace Model
    * <p>Returns the objects or data listed below if successful. Otherwise, returns an
    * error.</p>
    */
-  class AWS_CLOUDTRAIL_API StopLoggingResult
+  class AWS_CLOUDTRAIL_API StopLoggingResult : public AmazonWebServiceResultBase
   {
   public:
     StopLoggingResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cloudtrail/CloudTrail_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * Returns the objects or data listed below if successful. Otherwise, returns an
    * error.
    */
-  class AWS_CLOUDTRAIL_API UpdateTrailResult
+  class AWS_CLOUDTRAIL_API UpdateTrailResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateTrailResult();
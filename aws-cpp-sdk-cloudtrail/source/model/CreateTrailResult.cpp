@@ -41,6 +41,7 @@ CreateTrailResult::CreateTrailResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateTrailResult& CreateTrailResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Name"))
   {
@@ -35,6 +35,7 @@ DeleteTrailResult::DeleteTrailResult(const AmazonWebServiceResult<JsonValue>& re
 
 DeleteTrailResult& DeleteTrailResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
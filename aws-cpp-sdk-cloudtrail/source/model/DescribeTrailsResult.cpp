@@ -35,6 +35,7 @@ DescribeTrailsResult::DescribeTrailsResult(const AmazonWebServiceResult<JsonValu
 
 DescribeTrailsResult& DescribeTrailsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("trailList"))
   {
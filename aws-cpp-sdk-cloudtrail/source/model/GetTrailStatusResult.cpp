@@ -49,6 +49,7 @@ GetTrailStatusResult::GetTrailStatusResult(const AmazonWebServiceResult<JsonValu
 
 GetTrailStatusResult& GetTrailStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IsLogging"))
   {
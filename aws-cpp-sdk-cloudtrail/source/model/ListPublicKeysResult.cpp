@@ -35,6 +35,7 @@ ListPublicKeysResult::ListPublicKeysResult(const AmazonWebServiceResult<JsonValu
 
 ListPublicKeysResult& ListPublicKeysResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("PublicKeyList"))
   {
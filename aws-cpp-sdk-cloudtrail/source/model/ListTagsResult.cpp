@@ -35,6 +35,7 @@ ListTagsResult::ListTagsResult(const AmazonWebServiceResult<JsonValue>& result)
 
 ListTagsResult& ListTagsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ResourceTagList"))
   {
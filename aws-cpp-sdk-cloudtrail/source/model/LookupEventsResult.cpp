@@ -35,6 +35,7 @@ LookupEventsResult::LookupEventsResult(const AmazonWebServiceResult<JsonValue>&
 
 LookupEventsResult& LookupEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Events"))
   {
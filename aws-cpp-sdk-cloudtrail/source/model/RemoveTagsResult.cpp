@@ -35,6 +35,7 @@ RemoveTagsResult::RemoveTagsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 RemoveTagsResult& RemoveTagsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ StartLoggingResult::StartLoggingResult(const AmazonWebServiceResult<JsonValue>&
 
 StartLoggingResult& StartLoggingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ StopLoggingResult::StopLoggingResult(const AmazonWebServiceResult<JsonValue>& re
 
 StopLoggingResult& StopLoggingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -41,6 +41,7 @@ UpdateTrailResult::UpdateTrailResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateTrailResult& UpdateTrailResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Name"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/codecommit/model/RepositoryMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a batch get repositories operation.</p>
    */
-  class AWS_CODECOMMIT_API BatchGetRepositoriesResult
+  class AWS_CODECOMMIT_API BatchGetRepositoriesResult : public AmazonWebServiceResultBase
   {
   public:
     BatchGetRepositoriesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a delete repository operation.</p>
    */
-  class AWS_CODECOMMIT_API DeleteRepositoryResult
+  class AWS_CODECOMMIT_API DeleteRepositoryResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteRepositoryResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codecommit/model/BranchInfo.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a get branch operation.</p>
    */
-  class AWS_CODECOMMIT_API GetBranchResult
+  class AWS_CODECOMMIT_API GetBranchResult : public AmazonWebServiceResultBase
   {
   public:
     GetBranchResult();
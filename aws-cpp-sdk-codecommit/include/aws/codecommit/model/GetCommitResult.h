@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codecommit/model/Commit.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a get commit operation.</p>
    */
-  class AWS_CODECOMMIT_API GetCommitResult
+  class AWS_CODECOMMIT_API GetCommitResult : public AmazonWebServiceResultBase
   {
   public:
     GetCommitResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of a list branches operation.</p>
    */
-  class AWS_CODECOMMIT_API ListBranchesResult
+  class AWS_CODECOMMIT_API ListBranchesResult : public AmazonWebServiceResultBase
   {
   public:
     ListBranchesResult();
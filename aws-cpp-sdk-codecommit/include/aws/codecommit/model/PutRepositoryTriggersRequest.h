@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     PutRepositoryTriggersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "PutRepositoryTriggers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
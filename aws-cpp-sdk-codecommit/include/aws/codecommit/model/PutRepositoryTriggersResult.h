@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a put repository triggers operation. </p>
    */
-  class AWS_CODECOMMIT_API PutRepositoryTriggersResult
+  class AWS_CODECOMMIT_API PutRepositoryTriggersResult : public AmazonWebServiceResultBase
   {
   public:
     PutRepositoryTriggersResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codecommit/CodeCommit_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/codecommit/model/RepositoryTriggerExecutionFailure.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a test repository triggers operation.</p>
    */
-  class AWS_CODECOMMIT_API TestRepositoryTriggersResult
+  class AWS_CODECOMMIT_API TestRepositoryTriggersResult : public AmazonWebServiceResultBase
   {
   public:
     TestRepositoryTriggersResult();
@@ -35,6 +35,7 @@ BatchGetRepositoriesResult::BatchGetRepositoriesResult(const AmazonWebServiceRes
 
 BatchGetRepositoriesResult& BatchGetRepositoriesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("repositories"))
   {
@@ -35,6 +35,7 @@ GetBranchResult::GetBranchResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetBranchResult& GetBranchResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("branch"))
   {
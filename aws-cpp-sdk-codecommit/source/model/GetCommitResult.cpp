@@ -35,6 +35,7 @@ GetCommitResult::GetCommitResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetCommitResult& GetCommitResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("commit"))
   {
@@ -35,6 +35,7 @@ GetRepositoryResult::GetRepositoryResult(const AmazonWebServiceResult<JsonValue>
 
 GetRepositoryResult& GetRepositoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("repositoryMetadata"))
   {
@@ -35,6 +35,7 @@ GetRepositoryTriggersResult::GetRepositoryTriggersResult(const AmazonWebServiceR
 
 GetRepositoryTriggersResult& GetRepositoryTriggersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("configurationId"))
   {
@@ -35,6 +35,7 @@ ListBranchesResult::ListBranchesResult(const AmazonWebServiceResult<JsonValue>&
 
 ListBranchesResult& ListBranchesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("branches"))
   {
@@ -35,6 +35,7 @@ ListRepositoriesResult::ListRepositoriesResult(const AmazonWebServiceResult<Json
 
 ListRepositoriesResult& ListRepositoriesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("repositories"))
   {
@@ -35,6 +35,7 @@ PutRepositoryTriggersResult::PutRepositoryTriggersResult(const AmazonWebServiceR
 
 PutRepositoryTriggersResult& PutRepositoryTriggersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("configurationId"))
   {
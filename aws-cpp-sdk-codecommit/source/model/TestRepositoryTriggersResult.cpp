@@ -35,6 +35,7 @@ TestRepositoryTriggersResult::TestRepositoryTriggersResult(const AmazonWebServic
 
 TestRepositoryTriggersResult& TestRepositoryTriggersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("successfulExecutions"))
   {
@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     AddTagsToOnPremisesInstancesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "AddTagsToOnPremisesInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
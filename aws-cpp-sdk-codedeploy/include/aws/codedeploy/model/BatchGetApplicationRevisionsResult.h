@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/codedeploy/model/RevisionInfo.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a batch get application revisions operation.</p>
    */
-  class AWS_CODEDEPLOY_API BatchGetApplicationRevisionsResult
+  class AWS_CODEDEPLOY_API BatchGetApplicationRevisionsResult : public AmazonWebServiceResultBase
   {
   public:
     BatchGetApplicationRevisionsResult();
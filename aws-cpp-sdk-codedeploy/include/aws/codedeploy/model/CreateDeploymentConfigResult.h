@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a create deployment configuration operation.</p>
    */
-  class AWS_CODEDEPLOY_API CreateDeploymentConfigResult
+  class AWS_CODEDEPLOY_API CreateDeploymentConfigResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDeploymentConfigResult();
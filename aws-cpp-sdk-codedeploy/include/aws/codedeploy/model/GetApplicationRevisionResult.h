@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/codedeploy/model/RevisionLocation.h>
 #include <aws/codedeploy/model/GenericRevisionInfo.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a get application revision operation.</p>
    */
-  class AWS_CODEDEPLOY_API GetApplicationRevisionResult
+  class AWS_CODEDEPLOY_API GetApplicationRevisionResult : public AmazonWebServiceResultBase
   {
   public:
     GetApplicationRevisionResult();
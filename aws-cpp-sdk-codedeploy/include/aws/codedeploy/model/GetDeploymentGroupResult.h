@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codedeploy/model/DeploymentGroupInfo.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a get deployment group operation.</p>
    */
-  class AWS_CODEDEPLOY_API GetDeploymentGroupResult
+  class AWS_CODEDEPLOY_API GetDeploymentGroupResult : public AmazonWebServiceResultBase
   {
   public:
     GetDeploymentGroupResult();
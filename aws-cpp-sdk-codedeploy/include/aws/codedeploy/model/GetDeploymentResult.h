@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codedeploy/model/DeploymentInfo.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a get deployment operation.</p>
    */
-  class AWS_CODEDEPLOY_API GetDeploymentResult
+  class AWS_CODEDEPLOY_API GetDeploymentResult : public AmazonWebServiceResultBase
   {
   public:
     GetDeploymentResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of a list applications operation.</p>
    */
-  class AWS_CODEDEPLOY_API ListApplicationsResult
+  class AWS_CODEDEPLOY_API ListApplicationsResult : public AmazonWebServiceResultBase
   {
   public:
     ListApplicationsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of list on-premises instances operation.</p>
    */
-  class AWS_CODEDEPLOY_API ListOnPremisesInstancesResult
+  class AWS_CODEDEPLOY_API ListOnPremisesInstancesResult : public AmazonWebServiceResultBase
   {
   public:
     ListOnPremisesInstancesResult();
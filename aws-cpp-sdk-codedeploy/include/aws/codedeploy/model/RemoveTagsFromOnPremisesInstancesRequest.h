@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     RemoveTagsFromOnPremisesInstancesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "RemoveTagsFromOnPremisesInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codedeploy/model/StopStatus.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of a stop deployment operation.</p>
    */
-  class AWS_CODEDEPLOY_API StopDeploymentResult
+  class AWS_CODEDEPLOY_API StopDeploymentResult : public AmazonWebServiceResultBase
   {
   public:
     StopDeploymentResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codedeploy/CodeDeploy_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/codedeploy/model/AutoScalingGroup.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of an update deployment group operation.</p>
    */
-  class AWS_CODEDEPLOY_API UpdateDeploymentGroupResult
+  class AWS_CODEDEPLOY_API UpdateDeploymentGroupResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateDeploymentGroupResult();
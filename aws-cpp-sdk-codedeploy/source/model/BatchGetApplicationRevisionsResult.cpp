@@ -35,6 +35,7 @@ BatchGetApplicationRevisionsResult::BatchGetApplicationRevisionsResult(const Ama
 
 BatchGetApplicationRevisionsResult& BatchGetApplicationRevisionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("applicationName"))
   {
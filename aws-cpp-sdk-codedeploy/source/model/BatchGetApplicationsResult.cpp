@@ -35,6 +35,7 @@ BatchGetApplicationsResult::BatchGetApplicationsResult(const AmazonWebServiceRes
 
 BatchGetApplicationsResult& BatchGetApplicationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("applicationsInfo"))
   {
@@ -35,6 +35,7 @@ BatchGetDeploymentGroupsResult::BatchGetDeploymentGroupsResult(const AmazonWebSe
 
 BatchGetDeploymentGroupsResult& BatchGetDeploymentGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentGroupsInfo"))
   {
@@ -35,6 +35,7 @@ BatchGetDeploymentInstancesResult::BatchGetDeploymentInstancesResult(const Amazo
 
 BatchGetDeploymentInstancesResult& BatchGetDeploymentInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("instancesSummary"))
   {
@@ -35,6 +35,7 @@ BatchGetDeploymentsResult::BatchGetDeploymentsResult(const AmazonWebServiceResul
 
 BatchGetDeploymentsResult& BatchGetDeploymentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentsInfo"))
   {
@@ -35,6 +35,7 @@ BatchGetOnPremisesInstancesResult::BatchGetOnPremisesInstancesResult(const Amazo
 
 BatchGetOnPremisesInstancesResult& BatchGetOnPremisesInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("instanceInfos"))
   {
@@ -35,6 +35,7 @@ CreateApplicationResult::CreateApplicationResult(const AmazonWebServiceResult<Js
 
 CreateApplicationResult& CreateApplicationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("applicationId"))
   {
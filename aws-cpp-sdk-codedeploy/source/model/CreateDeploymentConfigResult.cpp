@@ -35,6 +35,7 @@ CreateDeploymentConfigResult::CreateDeploymentConfigResult(const AmazonWebServic
 
 CreateDeploymentConfigResult& CreateDeploymentConfigResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentConfigId"))
   {
@@ -35,6 +35,7 @@ CreateDeploymentGroupResult::CreateDeploymentGroupResult(const AmazonWebServiceR
 
 CreateDeploymentGroupResult& CreateDeploymentGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentGroupId"))
   {
@@ -35,6 +35,7 @@ DeleteDeploymentGroupResult::DeleteDeploymentGroupResult(const AmazonWebServiceR
 
 DeleteDeploymentGroupResult& DeleteDeploymentGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("hooksNotCleanedUp"))
   {
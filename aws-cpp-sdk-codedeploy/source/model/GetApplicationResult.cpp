@@ -35,6 +35,7 @@ GetApplicationResult::GetApplicationResult(const AmazonWebServiceResult<JsonValu
 
 GetApplicationResult& GetApplicationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("application"))
   {
@@ -35,6 +35,7 @@ GetApplicationRevisionResult::GetApplicationRevisionResult(const AmazonWebServic
 
 GetApplicationRevisionResult& GetApplicationRevisionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("applicationName"))
   {
@@ -35,6 +35,7 @@ GetDeploymentConfigResult::GetDeploymentConfigResult(const AmazonWebServiceResul
 
 GetDeploymentConfigResult& GetDeploymentConfigResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentConfigInfo"))
   {
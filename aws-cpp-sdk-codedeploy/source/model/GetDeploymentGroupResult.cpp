@@ -35,6 +35,7 @@ GetDeploymentGroupResult::GetDeploymentGroupResult(const AmazonWebServiceResult<
 
 GetDeploymentGroupResult& GetDeploymentGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentGroupInfo"))
   {
@@ -35,6 +35,7 @@ GetDeploymentInstanceResult::GetDeploymentInstanceResult(const AmazonWebServiceR
 
 GetDeploymentInstanceResult& GetDeploymentInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("instanceSummary"))
   {
@@ -35,6 +35,7 @@ GetDeploymentResult::GetDeploymentResult(const AmazonWebServiceResult<JsonValue>
 
 GetDeploymentResult& GetDeploymentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentInfo"))
   {
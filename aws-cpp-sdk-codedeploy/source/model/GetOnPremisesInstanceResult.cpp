@@ -35,6 +35,7 @@ GetOnPremisesInstanceResult::GetOnPremisesInstanceResult(const AmazonWebServiceR
 
 GetOnPremisesInstanceResult& GetOnPremisesInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("instanceInfo"))
   {
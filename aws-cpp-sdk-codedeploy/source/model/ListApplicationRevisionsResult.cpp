@@ -35,6 +35,7 @@ ListApplicationRevisionsResult::ListApplicationRevisionsResult(const AmazonWebSe
 
 ListApplicationRevisionsResult& ListApplicationRevisionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("revisions"))
   {
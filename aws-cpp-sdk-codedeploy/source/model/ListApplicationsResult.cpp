@@ -35,6 +35,7 @@ ListApplicationsResult::ListApplicationsResult(const AmazonWebServiceResult<Json
 
 ListApplicationsResult& ListApplicationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("applications"))
   {
@@ -35,6 +35,7 @@ ListDeploymentConfigsResult::ListDeploymentConfigsResult(const AmazonWebServiceR
 
 ListDeploymentConfigsResult& ListDeploymentConfigsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deploymentConfigsList"))
   {
@@ -35,6 +35,7 @@ ListDeploymentGroupsResult::ListDeploymentGroupsResult(const AmazonWebServiceRes
 
 ListDeploymentGroupsResult& ListDeploymentGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("applicationName"))
   {
@@ -35,6 +35,7 @@ ListDeploymentInstancesResult::ListDeploymentInstancesResult(const AmazonWebServ
 
 ListDeploymentInstancesResult& ListDeploymentInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("instancesList"))
   {
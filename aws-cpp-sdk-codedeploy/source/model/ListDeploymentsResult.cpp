@@ -35,6 +35,7 @@ ListDeploymentsResult::ListDeploymentsResult(const AmazonWebServiceResult<JsonVa
 
 ListDeploymentsResult& ListDeploymentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("deployments"))
   {
@@ -35,6 +35,7 @@ ListOnPremisesInstancesResult::ListOnPremisesInstancesResult(const AmazonWebServ
 
 ListOnPremisesInstancesResult& ListOnPremisesInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("instanceNames"))
   {
@@ -35,6 +35,7 @@ StopDeploymentResult::StopDeploymentResult(const AmazonWebServiceResult<JsonValu
 
 StopDeploymentResult& StopDeploymentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -35,6 +35,7 @@ UpdateDeploymentGroupResult::UpdateDeploymentGroupResult(const AmazonWebServiceR
 
 UpdateDeploymentGroupResult& UpdateDeploymentGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("hooksNotCleanedUp"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codepipeline/model/JobStatus.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of an acknowledge third party job action.</p>
    */
-  class AWS_CODEPIPELINE_API AcknowledgeThirdPartyJobResult
+  class AWS_CODEPIPELINE_API AcknowledgeThirdPartyJobResult : public AmazonWebServiceResultBase
   {
   public:
     AcknowledgeThirdPartyJobResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codepipeline/model/ActionType.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a create custom action operation.</p>
    */
-  class AWS_CODEPIPELINE_API CreateCustomActionTypeResult
+  class AWS_CODEPIPELINE_API CreateCustomActionTypeResult : public AmazonWebServiceResultBase
   {
   public:
     CreateCustomActionTypeResult();
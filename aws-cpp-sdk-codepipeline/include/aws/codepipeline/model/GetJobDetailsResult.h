@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codepipeline/model/JobDetails.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a get job details action.</p>
    */
-  class AWS_CODEPIPELINE_API GetJobDetailsResult
+  class AWS_CODEPIPELINE_API GetJobDetailsResult : public AmazonWebServiceResultBase
   {
   public:
     GetJobDetailsResult();
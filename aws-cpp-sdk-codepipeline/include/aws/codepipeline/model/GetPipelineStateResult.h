@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/codepipeline/model/StageState.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a get pipeline state action.</p>
    */
-  class AWS_CODEPIPELINE_API GetPipelineStateResult
+  class AWS_CODEPIPELINE_API GetPipelineStateResult : public AmazonWebServiceResultBase
   {
   public:
     GetPipelineStateResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/codepipeline/model/ThirdPartyJobDetails.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a get third party job details action. </p>
    */
-  class AWS_CODEPIPELINE_API GetThirdPartyJobDetailsResult
+  class AWS_CODEPIPELINE_API GetThirdPartyJobDetailsResult : public AmazonWebServiceResultBase
   {
   public:
     GetThirdPartyJobDetailsResult();
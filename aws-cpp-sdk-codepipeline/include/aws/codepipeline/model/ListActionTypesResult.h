@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/codepipeline/model/ActionType.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a list action types action.</p>
    */
-  class AWS_CODEPIPELINE_API ListActionTypesResult
+  class AWS_CODEPIPELINE_API ListActionTypesResult : public AmazonWebServiceResultBase
   {
   public:
     ListActionTypesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/codepipeline/model/PipelineSummary.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output of a list pipelines action.</p>
    */
-  class AWS_CODEPIPELINE_API ListPipelinesResult
+  class AWS_CODEPIPELINE_API ListPipelinesResult : public AmazonWebServiceResultBase
   {
   public:
     ListPipelinesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/codepipeline/model/Job.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of a poll for jobs action.</p>
    */
-  class AWS_CODEPIPELINE_API PollForJobsResult
+  class AWS_CODEPIPELINE_API PollForJobsResult : public AmazonWebServiceResultBase
   {
   public:
     PollForJobsResult();
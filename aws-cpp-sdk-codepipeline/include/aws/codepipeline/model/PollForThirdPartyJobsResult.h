@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/codepipeline/model/ThirdPartyJob.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of a poll for third party jobs action.</p>
    */
-  class AWS_CODEPIPELINE_API PollForThirdPartyJobsResult
+  class AWS_CODEPIPELINE_API PollForThirdPartyJobsResult : public AmazonWebServiceResultBase
   {
   public:
     PollForThirdPartyJobsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/codepipeline/CodePipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a start pipeline execution action.</p>
    */
-  class AWS_CODEPIPELINE_API StartPipelineExecutionResult
+  class AWS_CODEPIPELINE_API StartPipelineExecutionResult : public AmazonWebServiceResultBase
   {
   public:
     StartPipelineExecutionResult();
@@ -35,6 +35,7 @@ AcknowledgeJobResult::AcknowledgeJobResult(const AmazonWebServiceResult<JsonValu
 
 AcknowledgeJobResult& AcknowledgeJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
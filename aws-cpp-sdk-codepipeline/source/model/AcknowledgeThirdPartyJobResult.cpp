@@ -35,6 +35,7 @@ AcknowledgeThirdPartyJobResult::AcknowledgeThirdPartyJobResult(const AmazonWebSe
 
 AcknowledgeThirdPartyJobResult& AcknowledgeThirdPartyJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -35,6 +35,7 @@ CreateCustomActionTypeResult::CreateCustomActionTypeResult(const AmazonWebServic
 
 CreateCustomActionTypeResult& CreateCustomActionTypeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("actionType"))
   {
@@ -35,6 +35,7 @@ CreatePipelineResult::CreatePipelineResult(const AmazonWebServiceResult<JsonValu
 
 CreatePipelineResult& CreatePipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipeline"))
   {
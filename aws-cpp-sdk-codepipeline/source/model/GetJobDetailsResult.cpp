@@ -35,6 +35,7 @@ GetJobDetailsResult::GetJobDetailsResult(const AmazonWebServiceResult<JsonValue>
 
 GetJobDetailsResult& GetJobDetailsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("jobDetails"))
   {
@@ -35,6 +35,7 @@ GetPipelineResult::GetPipelineResult(const AmazonWebServiceResult<JsonValue>& re
 
 GetPipelineResult& GetPipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipeline"))
   {
@@ -41,6 +41,7 @@ GetPipelineStateResult::GetPipelineStateResult(const AmazonWebServiceResult<Json
 
 GetPipelineStateResult& GetPipelineStateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipelineName"))
   {
@@ -35,6 +35,7 @@ GetThirdPartyJobDetailsResult::GetThirdPartyJobDetailsResult(const AmazonWebServ
 
 GetThirdPartyJobDetailsResult& GetThirdPartyJobDetailsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("jobDetails"))
   {
@@ -35,6 +35,7 @@ ListActionTypesResult::ListActionTypesResult(const AmazonWebServiceResult<JsonVa
 
 ListActionTypesResult& ListActionTypesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("actionTypes"))
   {
@@ -35,6 +35,7 @@ PollForJobsResult::PollForJobsResult(const AmazonWebServiceResult<JsonValue>& re
 
 PollForJobsResult& PollForJobsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("jobs"))
   {
@@ -35,6 +35,7 @@ PollForThirdPartyJobsResult::PollForThirdPartyJobsResult(const AmazonWebServiceR
 
 PollForThirdPartyJobsResult& PollForThirdPartyJobsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("jobs"))
   {
@@ -37,6 +37,7 @@ PutActionRevisionResult::PutActionRevisionResult(const AmazonWebServiceResult<Js
 
 PutActionRevisionResult& PutActionRevisionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("newRevision"))
   {
@@ -35,6 +35,7 @@ StartPipelineExecutionResult::StartPipelineExecutionResult(const AmazonWebServic
 
 StartPipelineExecutionResult& StartPipelineExecutionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipelineExecutionId"))
   {
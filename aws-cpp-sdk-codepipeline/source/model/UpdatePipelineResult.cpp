@@ -35,6 +35,7 @@ UpdatePipelineResult::UpdatePipelineResult(const AmazonWebServiceResult<JsonValu
 
 UpdatePipelineResult& UpdatePipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipeline"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cognito-identity/model/UnprocessedIdentityId.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Returned in response to a successful <code>DeleteIdentities</code>
    * operation.</p>
    */
-  class AWS_COGNITOIDENTITY_API DeleteIdentitiesResult
+  class AWS_COGNITOIDENTITY_API DeleteIdentitiesResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteIdentitiesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * An object representing a Cognito identity pool.
    */
-  class AWS_COGNITOIDENTITY_API DescribeIdentityPoolResult
+  class AWS_COGNITOIDENTITY_API DescribeIdentityPoolResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeIdentityPoolResult();
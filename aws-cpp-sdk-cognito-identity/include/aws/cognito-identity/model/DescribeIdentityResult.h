@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * A description of the identity.
    */
-  class AWS_COGNITOIDENTITY_API DescribeIdentityResult
+  class AWS_COGNITOIDENTITY_API DescribeIdentityResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeIdentityResult();
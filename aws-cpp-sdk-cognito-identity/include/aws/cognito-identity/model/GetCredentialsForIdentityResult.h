@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cognito-identity/model/Credentials.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Returned in response to a successful <code>GetCredentialsForIdentity</code>
    * operation.</p>
    */
-  class AWS_COGNITOIDENTITY_API GetCredentialsForIdentityResult
+  class AWS_COGNITOIDENTITY_API GetCredentialsForIdentityResult : public AmazonWebServiceResultBase
   {
   public:
     GetCredentialsForIdentityResult();
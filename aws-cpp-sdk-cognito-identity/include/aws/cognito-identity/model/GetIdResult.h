@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * Returned in response to a GetId request.
    */
-  class AWS_COGNITOIDENTITY_API GetIdResult
+  class AWS_COGNITOIDENTITY_API GetIdResult : public AmazonWebServiceResultBase
   {
   public:
     GetIdResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Returned in response to a successful <code>GetIdentityPoolRoles</code>
    * operation.</p>
    */
-  class AWS_COGNITOIDENTITY_API GetIdentityPoolRolesResult
+  class AWS_COGNITOIDENTITY_API GetIdentityPoolRolesResult : public AmazonWebServiceResultBase
   {
   public:
     GetIdentityPoolRolesResult();
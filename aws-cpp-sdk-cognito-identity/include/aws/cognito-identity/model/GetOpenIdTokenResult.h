@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * Returned in response to a successful GetOpenIdToken request.
    */
-  class AWS_COGNITOIDENTITY_API GetOpenIdTokenResult
+  class AWS_COGNITOIDENTITY_API GetOpenIdTokenResult : public AmazonWebServiceResultBase
   {
   public:
     GetOpenIdTokenResult();
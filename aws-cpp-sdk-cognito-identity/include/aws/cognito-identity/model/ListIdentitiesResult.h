@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cognito-identity/model/IdentityDescription.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * The response to a ListIdentities request.
    */
-  class AWS_COGNITOIDENTITY_API ListIdentitiesResult
+  class AWS_COGNITOIDENTITY_API ListIdentitiesResult : public AmazonWebServiceResultBase
   {
   public:
     ListIdentitiesResult();
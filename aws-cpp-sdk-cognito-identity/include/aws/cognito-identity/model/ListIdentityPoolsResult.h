@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cognito-identity/model/IdentityPoolShortDescription.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * The result of a successful ListIdentityPools action.
    */
-  class AWS_COGNITOIDENTITY_API ListIdentityPoolsResult
+  class AWS_COGNITOIDENTITY_API ListIdentityPoolsResult : public AmazonWebServiceResultBase
   {
   public:
     ListIdentityPoolsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-identity/CognitoIdentity_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Returned in response to a successful <code>MergeDeveloperIdentities</code>
    * action.</p>
    */
-  class AWS_COGNITOIDENTITY_API MergeDeveloperIdentitiesResult
+  class AWS_COGNITOIDENTITY_API MergeDeveloperIdentitiesResult : public AmazonWebServiceResultBase
   {
   public:
     MergeDeveloperIdentitiesResult();
@@ -37,6 +37,7 @@ CreateIdentityPoolResult::CreateIdentityPoolResult(const AmazonWebServiceResult<
 
 CreateIdentityPoolResult& CreateIdentityPoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
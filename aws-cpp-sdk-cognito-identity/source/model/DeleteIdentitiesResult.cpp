@@ -35,6 +35,7 @@ DeleteIdentitiesResult::DeleteIdentitiesResult(const AmazonWebServiceResult<Json
 
 DeleteIdentitiesResult& DeleteIdentitiesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UnprocessedIdentityIds"))
   {
@@ -37,6 +37,7 @@ DescribeIdentityPoolResult::DescribeIdentityPoolResult(const AmazonWebServiceRes
 
 DescribeIdentityPoolResult& DescribeIdentityPoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
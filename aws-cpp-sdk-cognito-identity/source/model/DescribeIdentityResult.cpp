@@ -39,6 +39,7 @@ DescribeIdentityResult::DescribeIdentityResult(const AmazonWebServiceResult<Json
 
 DescribeIdentityResult& DescribeIdentityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
@@ -35,6 +35,7 @@ GetCredentialsForIdentityResult::GetCredentialsForIdentityResult(const AmazonWeb
 
 GetCredentialsForIdentityResult& GetCredentialsForIdentityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
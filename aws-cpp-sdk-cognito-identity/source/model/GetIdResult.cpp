@@ -35,6 +35,7 @@ GetIdResult::GetIdResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetIdResult& GetIdResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
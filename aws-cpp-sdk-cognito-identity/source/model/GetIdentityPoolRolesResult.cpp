@@ -35,6 +35,7 @@ GetIdentityPoolRolesResult::GetIdentityPoolRolesResult(const AmazonWebServiceRes
 
 GetIdentityPoolRolesResult& GetIdentityPoolRolesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
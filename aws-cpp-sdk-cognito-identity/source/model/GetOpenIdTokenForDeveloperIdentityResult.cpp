@@ -35,6 +35,7 @@ GetOpenIdTokenForDeveloperIdentityResult::GetOpenIdTokenForDeveloperIdentityResu
 
 GetOpenIdTokenForDeveloperIdentityResult& GetOpenIdTokenForDeveloperIdentityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
@@ -35,6 +35,7 @@ GetOpenIdTokenResult::GetOpenIdTokenResult(const AmazonWebServiceResult<JsonValu
 
 GetOpenIdTokenResult& GetOpenIdTokenResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
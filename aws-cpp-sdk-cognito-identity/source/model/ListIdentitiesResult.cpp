@@ -35,6 +35,7 @@ ListIdentitiesResult::ListIdentitiesResult(const AmazonWebServiceResult<JsonValu
 
 ListIdentitiesResult& ListIdentitiesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
@@ -35,6 +35,7 @@ ListIdentityPoolsResult::ListIdentityPoolsResult(const AmazonWebServiceResult<Js
 
 ListIdentityPoolsResult& ListIdentityPoolsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPools"))
   {
@@ -35,6 +35,7 @@ LookupDeveloperIdentityResult::LookupDeveloperIdentityResult(const AmazonWebServ
 
 LookupDeveloperIdentityResult& LookupDeveloperIdentityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
@@ -35,6 +35,7 @@ MergeDeveloperIdentitiesResult::MergeDeveloperIdentitiesResult(const AmazonWebSe
 
 MergeDeveloperIdentitiesResult& MergeDeveloperIdentitiesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityId"))
   {
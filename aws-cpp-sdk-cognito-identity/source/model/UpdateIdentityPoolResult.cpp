@@ -37,6 +37,7 @@ UpdateIdentityPoolResult::UpdateIdentityPoolResult(const AmazonWebServiceResult<
 
 UpdateIdentityPoolResult& UpdateIdentityPoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * The output for the BulkPublish operation.
    */
-  class AWS_COGNITOSYNC_API BulkPublishResult
+  class AWS_COGNITOSYNC_API BulkPublishResult : public AmazonWebServiceResultBase
   {
   public:
     BulkPublishResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cognito-sync/model/Dataset.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * Response to a successful DeleteDataset request.
    */
-  class AWS_COGNITOSYNC_API DeleteDatasetResult
+  class AWS_COGNITOSYNC_API DeleteDatasetResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteDatasetResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeDatasetRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeDataset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
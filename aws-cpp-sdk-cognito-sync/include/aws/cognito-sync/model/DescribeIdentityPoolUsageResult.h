@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cognito-sync/model/IdentityPoolUsage.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * Response to a successful DescribeIdentityPoolUsage request.
    */
-  class AWS_COGNITOSYNC_API DescribeIdentityPoolUsageResult
+  class AWS_COGNITOSYNC_API DescribeIdentityPoolUsageResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeIdentityPoolUsageResult();
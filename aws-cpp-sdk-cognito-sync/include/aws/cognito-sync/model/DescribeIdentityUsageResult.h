@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/cognito-sync/model/IdentityUsage.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * The response to a successful DescribeIdentityUsage request.
    */
-  class AWS_COGNITOSYNC_API DescribeIdentityUsageResult
+  class AWS_COGNITOSYNC_API DescribeIdentityUsageResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeIdentityUsageResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cognito-sync/model/BulkPublishStatus.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * The output for the GetBulkPublishDetails operation.
    */
-  class AWS_COGNITOSYNC_API GetBulkPublishDetailsResult
+  class AWS_COGNITOSYNC_API GetBulkPublishDetailsResult : public AmazonWebServiceResultBase
   {
   public:
     GetBulkPublishDetailsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The response from the GetCognitoEvents request</p>
    */
-  class AWS_COGNITOSYNC_API GetCognitoEventsResult
+  class AWS_COGNITOSYNC_API GetCognitoEventsResult : public AmazonWebServiceResultBase
   {
   public:
     GetCognitoEventsResult();
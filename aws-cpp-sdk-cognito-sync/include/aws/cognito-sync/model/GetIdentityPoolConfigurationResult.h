@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cognito-sync/model/PushSync.h>
 #include <aws/cognito-sync/model/CognitoStreams.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The output for the GetIdentityPoolConfiguration operation.</p>
    */
-  class AWS_COGNITOSYNC_API GetIdentityPoolConfigurationResult
+  class AWS_COGNITOSYNC_API GetIdentityPoolConfigurationResult : public AmazonWebServiceResultBase
   {
   public:
     GetIdentityPoolConfigurationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/cognito-sync/model/Dataset.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * Returned for a successful ListDatasets request.
    */
-  class AWS_COGNITOSYNC_API ListDatasetsResult
+  class AWS_COGNITOSYNC_API ListDatasetsResult : public AmazonWebServiceResultBase
   {
   public:
     ListDatasetsResult();
@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     ListIdentityPoolUsageRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListIdentityPoolUsage"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
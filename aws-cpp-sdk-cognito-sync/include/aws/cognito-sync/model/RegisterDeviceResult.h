@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Response to a RegisterDevice request.</p>
    */
-  class AWS_COGNITOSYNC_API RegisterDeviceResult
+  class AWS_COGNITOSYNC_API RegisterDeviceResult : public AmazonWebServiceResultBase
   {
   public:
     RegisterDeviceResult();
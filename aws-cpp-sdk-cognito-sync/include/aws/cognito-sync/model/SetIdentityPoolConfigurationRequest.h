@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     SetIdentityPoolConfigurationRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "SetIdentityPoolConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Response to a SubscribeToDataset request.</p>
    */
-  class AWS_COGNITOSYNC_API SubscribeToDatasetResult
+  class AWS_COGNITOSYNC_API SubscribeToDatasetResult : public AmazonWebServiceResultBase
   {
   public:
     SubscribeToDatasetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/cognito-sync/CognitoSync_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/cognito-sync/model/Record.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * Returned for a successful UpdateRecordsRequest.
    */
-  class AWS_COGNITOSYNC_API UpdateRecordsResult
+  class AWS_COGNITOSYNC_API UpdateRecordsResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateRecordsResult();
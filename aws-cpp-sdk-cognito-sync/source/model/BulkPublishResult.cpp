@@ -35,6 +35,7 @@ BulkPublishResult::BulkPublishResult(const AmazonWebServiceResult<JsonValue>& re
 
 BulkPublishResult& BulkPublishResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
@@ -35,6 +35,7 @@ DeleteDatasetResult::DeleteDatasetResult(const AmazonWebServiceResult<JsonValue>
 
 DeleteDatasetResult& DeleteDatasetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Dataset"))
   {
@@ -35,6 +35,7 @@ DescribeDatasetResult::DescribeDatasetResult(const AmazonWebServiceResult<JsonVa
 
 DescribeDatasetResult& DescribeDatasetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Dataset"))
   {
@@ -35,6 +35,7 @@ DescribeIdentityPoolUsageResult::DescribeIdentityPoolUsageResult(const AmazonWeb
 
 DescribeIdentityPoolUsageResult& DescribeIdentityPoolUsageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolUsage"))
   {
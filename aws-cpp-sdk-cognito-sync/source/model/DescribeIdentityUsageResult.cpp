@@ -35,6 +35,7 @@ DescribeIdentityUsageResult::DescribeIdentityUsageResult(const AmazonWebServiceR
 
 DescribeIdentityUsageResult& DescribeIdentityUsageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityUsage"))
   {
@@ -39,6 +39,7 @@ GetBulkPublishDetailsResult::GetBulkPublishDetailsResult(const AmazonWebServiceR
 
 GetBulkPublishDetailsResult& GetBulkPublishDetailsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
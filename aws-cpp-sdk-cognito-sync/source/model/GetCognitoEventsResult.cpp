@@ -35,6 +35,7 @@ GetCognitoEventsResult::GetCognitoEventsResult(const AmazonWebServiceResult<Json
 
 GetCognitoEventsResult& GetCognitoEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Events"))
   {
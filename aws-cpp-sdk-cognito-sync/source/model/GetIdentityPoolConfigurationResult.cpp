@@ -35,6 +35,7 @@ GetIdentityPoolConfigurationResult::GetIdentityPoolConfigurationResult(const Ama
 
 GetIdentityPoolConfigurationResult& GetIdentityPoolConfigurationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
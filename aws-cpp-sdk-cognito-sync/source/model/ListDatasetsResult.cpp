@@ -37,6 +37,7 @@ ListDatasetsResult::ListDatasetsResult(const AmazonWebServiceResult<JsonValue>&
 
 ListDatasetsResult& ListDatasetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Datasets"))
   {
@@ -39,6 +39,7 @@ ListIdentityPoolUsageResult::ListIdentityPoolUsageResult(const AmazonWebServiceR
 
 ListIdentityPoolUsageResult& ListIdentityPoolUsageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolUsages"))
   {
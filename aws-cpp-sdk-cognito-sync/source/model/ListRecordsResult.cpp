@@ -43,6 +43,7 @@ ListRecordsResult::ListRecordsResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListRecordsResult& ListRecordsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Records"))
   {
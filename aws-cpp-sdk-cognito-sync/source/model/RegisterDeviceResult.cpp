@@ -35,6 +35,7 @@ RegisterDeviceResult::RegisterDeviceResult(const AmazonWebServiceResult<JsonValu
 
 RegisterDeviceResult& RegisterDeviceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DeviceId"))
   {
@@ -35,6 +35,7 @@ SetIdentityPoolConfigurationResult::SetIdentityPoolConfigurationResult(const Ama
 
 SetIdentityPoolConfigurationResult& SetIdentityPoolConfigurationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IdentityPoolId"))
   {
@@ -35,6 +35,7 @@ SubscribeToDatasetResult::SubscribeToDatasetResult(const AmazonWebServiceResult<
 
 SubscribeToDatasetResult& SubscribeToDatasetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ UnsubscribeFromDatasetResult::UnsubscribeFromDatasetResult(const AmazonWebServic
 
 UnsubscribeFromDatasetResult& UnsubscribeFromDatasetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
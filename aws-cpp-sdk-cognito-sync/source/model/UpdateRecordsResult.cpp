@@ -35,6 +35,7 @@ UpdateRecordsResult::UpdateRecordsResult(const AmazonWebServiceResult<JsonValue>
 
 UpdateRecordsResult& UpdateRecordsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Records"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p> The output for the <a>DeliverConfigSnapshot</a> action in JSON format. </p>
    */
-  class AWS_CONFIGSERVICE_API DeliverConfigSnapshotResult
+  class AWS_CONFIGSERVICE_API DeliverConfigSnapshotResult : public AmazonWebServiceResultBase
   {
   public:
     DeliverConfigSnapshotResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/config/model/ComplianceByConfigRule.h>
@@ -34,7 +35,7 @@ namespace ConfigService
 {
 namespace Model
 {
-  class AWS_CONFIGSERVICE_API DescribeComplianceByConfigRuleResult
+  class AWS_CONFIGSERVICE_API DescribeComplianceByConfigRuleResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeComplianceByConfigRuleResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/config/model/ComplianceByResource.h>
@@ -34,7 +35,7 @@ namespace ConfigService
 {
 namespace Model
 {
-  class AWS_CONFIGSERVICE_API DescribeComplianceByResourceResult
+  class AWS_CONFIGSERVICE_API DescribeComplianceByResourceResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeComplianceByResourceResult();
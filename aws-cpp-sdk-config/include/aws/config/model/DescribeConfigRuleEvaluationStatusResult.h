@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/config/model/ConfigRuleEvaluationStatus.h>
 
@@ -33,7 +34,7 @@ namespace ConfigService
 {
 namespace Model
 {
-  class AWS_CONFIGSERVICE_API DescribeConfigRuleEvaluationStatusResult
+  class AWS_CONFIGSERVICE_API DescribeConfigRuleEvaluationStatusResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeConfigRuleEvaluationStatusResult();
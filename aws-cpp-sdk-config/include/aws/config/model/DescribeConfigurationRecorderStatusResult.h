@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/config/model/ConfigurationRecorderStatus.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The output for the <a>DescribeConfigurationRecorderStatus</a> action in JSON
    * format.</p>
    */
-  class AWS_CONFIGSERVICE_API DescribeConfigurationRecorderStatusResult
+  class AWS_CONFIGSERVICE_API DescribeConfigurationRecorderStatusResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeConfigurationRecorderStatusResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/config/model/ConfigurationRecorder.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output for the <a>DescribeConfigurationRecorders</a> action.</p>
    */
-  class AWS_CONFIGSERVICE_API DescribeConfigurationRecordersResult
+  class AWS_CONFIGSERVICE_API DescribeConfigurationRecordersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeConfigurationRecordersResult();
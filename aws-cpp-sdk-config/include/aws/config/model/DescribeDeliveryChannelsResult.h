@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/config/model/DeliveryChannel.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output for the <a>DescribeDeliveryChannels</a> action.</p>
    */
-  class AWS_CONFIGSERVICE_API DescribeDeliveryChannelsResult
+  class AWS_CONFIGSERVICE_API DescribeDeliveryChannelsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDeliveryChannelsResult();
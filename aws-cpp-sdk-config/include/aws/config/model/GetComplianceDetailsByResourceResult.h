@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/config/model/EvaluationResult.h>
@@ -34,7 +35,7 @@ namespace ConfigService
 {
 namespace Model
 {
-  class AWS_CONFIGSERVICE_API GetComplianceDetailsByResourceResult
+  class AWS_CONFIGSERVICE_API GetComplianceDetailsByResourceResult : public AmazonWebServiceResultBase
   {
   public:
     GetComplianceDetailsByResourceResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/config/model/ComplianceSummary.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ConfigService
 {
 namespace Model
 {
-  class AWS_CONFIGSERVICE_API GetComplianceSummaryByConfigRuleResult
+  class AWS_CONFIGSERVICE_API GetComplianceSummaryByConfigRuleResult : public AmazonWebServiceResultBase
   {
   public:
     GetComplianceSummaryByConfigRuleResult();
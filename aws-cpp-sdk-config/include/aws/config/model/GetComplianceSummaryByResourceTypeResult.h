@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/config/model/ComplianceSummaryByResourceType.h>
 
@@ -33,7 +34,7 @@ namespace ConfigService
 {
 namespace Model
 {
-  class AWS_CONFIGSERVICE_API GetComplianceSummaryByResourceTypeResult
+  class AWS_CONFIGSERVICE_API GetComplianceSummaryByResourceTypeResult : public AmazonWebServiceResultBase
   {
   public:
     GetComplianceSummaryByResourceTypeResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/config/ConfigService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/config/model/ConfigurationItem.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The output for the <a>GetResourceConfigHistory</a> action.</p>
    */
-  class AWS_CONFIGSERVICE_API GetResourceConfigHistoryResult
+  class AWS_CONFIGSERVICE_API GetResourceConfigHistoryResult : public AmazonWebServiceResultBase
   {
   public:
     GetResourceConfigHistoryResult();
@@ -35,6 +35,7 @@ DeliverConfigSnapshotResult::DeliverConfigSnapshotResult(const AmazonWebServiceR
 
 DeliverConfigSnapshotResult& DeliverConfigSnapshotResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("configSnapshotId"))
   {
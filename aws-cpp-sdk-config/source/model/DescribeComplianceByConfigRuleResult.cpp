@@ -35,6 +35,7 @@ DescribeComplianceByConfigRuleResult::DescribeComplianceByConfigRuleResult(const
 
 DescribeComplianceByConfigRuleResult& DescribeComplianceByConfigRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ComplianceByConfigRules"))
   {
@@ -35,6 +35,7 @@ DescribeComplianceByResourceResult::DescribeComplianceByResourceResult(const Ama
 
 DescribeComplianceByResourceResult& DescribeComplianceByResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ComplianceByResources"))
   {
@@ -35,6 +35,7 @@ DescribeConfigRuleEvaluationStatusResult::DescribeConfigRuleEvaluationStatusResu
 
 DescribeConfigRuleEvaluationStatusResult& DescribeConfigRuleEvaluationStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ConfigRulesEvaluationStatus"))
   {
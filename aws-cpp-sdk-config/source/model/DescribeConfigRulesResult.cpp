@@ -35,6 +35,7 @@ DescribeConfigRulesResult::DescribeConfigRulesResult(const AmazonWebServiceResul
 
 DescribeConfigRulesResult& DescribeConfigRulesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ConfigRules"))
   {
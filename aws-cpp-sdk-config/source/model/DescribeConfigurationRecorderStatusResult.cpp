@@ -35,6 +35,7 @@ DescribeConfigurationRecorderStatusResult::DescribeConfigurationRecorderStatusRe
 
 DescribeConfigurationRecorderStatusResult& DescribeConfigurationRecorderStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ConfigurationRecordersStatus"))
   {
@@ -35,6 +35,7 @@ DescribeConfigurationRecordersResult::DescribeConfigurationRecordersResult(const
 
 DescribeConfigurationRecordersResult& DescribeConfigurationRecordersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ConfigurationRecorders"))
   {
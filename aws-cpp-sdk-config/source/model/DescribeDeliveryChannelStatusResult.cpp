@@ -35,6 +35,7 @@ DescribeDeliveryChannelStatusResult::DescribeDeliveryChannelStatusResult(const A
 
 DescribeDeliveryChannelStatusResult& DescribeDeliveryChannelStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DeliveryChannelsStatus"))
   {
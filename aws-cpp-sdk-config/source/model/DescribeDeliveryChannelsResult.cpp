@@ -35,6 +35,7 @@ DescribeDeliveryChannelsResult::DescribeDeliveryChannelsResult(const AmazonWebSe
 
 DescribeDeliveryChannelsResult& DescribeDeliveryChannelsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DeliveryChannels"))
   {
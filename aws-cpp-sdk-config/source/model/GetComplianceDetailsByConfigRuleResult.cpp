@@ -35,6 +35,7 @@ GetComplianceDetailsByConfigRuleResult::GetComplianceDetailsByConfigRuleResult(c
 
 GetComplianceDetailsByConfigRuleResult& GetComplianceDetailsByConfigRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EvaluationResults"))
   {
@@ -35,6 +35,7 @@ GetComplianceDetailsByResourceResult::GetComplianceDetailsByResourceResult(const
 
 GetComplianceDetailsByResourceResult& GetComplianceDetailsByResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EvaluationResults"))
   {
@@ -35,6 +35,7 @@ GetComplianceSummaryByConfigRuleResult::GetComplianceSummaryByConfigRuleResult(c
 
 GetComplianceSummaryByConfigRuleResult& GetComplianceSummaryByConfigRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ComplianceSummary"))
   {
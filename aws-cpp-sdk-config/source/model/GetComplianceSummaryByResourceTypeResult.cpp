@@ -35,6 +35,7 @@ GetComplianceSummaryByResourceTypeResult::GetComplianceSummaryByResourceTypeResu
 
 GetComplianceSummaryByResourceTypeResult& GetComplianceSummaryByResourceTypeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ComplianceSummariesByResourceType"))
   {
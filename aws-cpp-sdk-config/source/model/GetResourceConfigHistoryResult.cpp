@@ -35,6 +35,7 @@ GetResourceConfigHistoryResult::GetResourceConfigHistoryResult(const AmazonWebSe
 
 GetResourceConfigHistoryResult& GetResourceConfigHistoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("configurationItems"))
   {
@@ -35,6 +35,7 @@ ListDiscoveredResourcesResult::ListDiscoveredResourcesResult(const AmazonWebServ
 
 ListDiscoveredResourcesResult& ListDiscoveredResourcesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("resourceIdentifiers"))
   {
@@ -35,6 +35,7 @@ PutEvaluationsResult::PutEvaluationsResult(const AmazonWebServiceResult<JsonValu
 
 PutEvaluationsResult& PutEvaluationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedEvaluations"))
   {
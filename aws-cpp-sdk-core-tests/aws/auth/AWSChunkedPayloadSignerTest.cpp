@@ -0,0 +1,181 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSChunkedPayloadSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstring>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+
+static const char* ALLOCATION_TAG = "AWSChunkedPayloadSignerTest";
+
+namespace
+{
+
+//the example from http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+static const char* EXAMPLE_DATE = "20130524T000000Z";
+static const char* EXAMPLE_SCOPE = "20130524/us-east-1/s3/aws4_request";
+static const char* EXAMPLE_SEED_SIGNATURE = "4f232c4386841ef735655705268965c44a0e4690baa4adea153f7db9fa80a0a9";
+static const size_t EXAMPLE_BODY_LENGTH = 66560;
+
+ByteBuffer DeriveExampleSigningKey()
+{
+    Crypto::Sha256HMAC hmac;
+    Aws::String secret("AWS4wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY");
+    ByteBuffer key((unsigned char*)secret.c_str(), secret.length());
+    for (const char* part : { "20130524", "us-east-1", "s3", "aws4_request" })
+    {
+        key = hmac.Calculate(ByteBuffer((unsigned char*)part, strlen(part)), key).GetResult();
+    }
+    return key;
+}
+
+/**
+ * Pulls the whole encoded body out of encoder in readSize pieces, the way an http client would.
+ */
+Aws::String EncodeAll(ContentBodyEncoder& encoder, Aws::IStream& body, size_t readSize, size_t& totalBodyBytesRead)
+{
+    Aws::String encoded;
+    Aws::String buffer(readSize, '\0');
+    totalBodyBytesRead = 0;
+    for (;;)
+    {
+        size_t bodyBytesRead = 0;
+        size_t written = encoder.Encode(body, &buffer[0], readSize, bodyBytesRead);
+        totalBodyBytesRead += bodyBytesRead;
+        if (written == 0)
+        {
+            return encoded;
+        }
+        encoded.append(buffer.c_str(), written);
+    }
+}
+
+} // anonymous namespace
+
+TEST(AWSChunkedPayloadSignerTest, MatchesPublishedExample)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream body(Aws::String(EXAMPLE_BODY_LENGTH, 'a'));
+    AWSChunkedPayloadSigner signer(DeriveExampleSigningKey(), EXAMPLE_DATE, EXAMPLE_SCOPE, EXAMPLE_SEED_SIGNATURE, EXAMPLE_BODY_LENGTH);
+
+    size_t bodyBytesRead = 0;
+    Aws::String encoded = EncodeAll(signer, body, 16 * 1024, bodyBytesRead);
+
+    EXPECT_EQ(EXAMPLE_BODY_LENGTH, bodyBytesRead);
+    EXPECT_EQ(66824u, AWSChunkedPayloadSigner::CalculateEncodedContentLength(EXAMPLE_BODY_LENGTH));
+    ASSERT_EQ(66824u, encoded.length());
+
+    Aws::String firstChunk("10000;chunk-signature=ad80c730a21e5b8d04586a2213dd63b9a0e99e0e2307b0ade35a65485a288648\r\n");
+    Aws::String secondChunk("\r\n400;chunk-signature=0055627c9e194cb4542bae2aa5492e3c1575bbb81b612b7d234b86a503ef5497\r\n");
+    Aws::String finalChunk("\r\n0;chunk-signature=b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9\r\n\r\n");
+    EXPECT_EQ(firstChunk, encoded.substr(0, firstChunk.length()));
+    EXPECT_EQ(firstChunk.length() + 65536, encoded.find(secondChunk));
+    EXPECT_EQ(encoded.length() - finalChunk.length(), encoded.find(finalChunk));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSChunkedPayloadSignerTest, EncodedLengthMatchesOutput)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    ByteBuffer signingKey = DeriveExampleSigningKey();
+    for (size_t bodyLength : { 0, 1, 8191, 8192, 8193, 3 * 8192 })
+    {
+        Aws::StringStream body(Aws::String(bodyLength, 'b'));
+        AWSChunkedPayloadSigner signer(signingKey, EXAMPLE_DATE, EXAMPLE_SCOPE, EXAMPLE_SEED_SIGNATURE, bodyLength, 8192);
+
+        size_t bodyBytesRead = 0;
+        //an odd read size makes reads straddle chunk boundaries
+        Aws::String encoded = EncodeAll(signer, body, 1000, bodyBytesRead);
+        EXPECT_EQ(bodyLength, bodyBytesRead);
+        EXPECT_EQ(AWSChunkedPayloadSigner::CalculateEncodedContentLength(bodyLength, 8192), encoded.length()) << bodyLength;
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSChunkedPayloadSignerTest, StopsWhenBodyIsShorterThanDeclared)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream body(Aws::String(100, 'c'));
+    AWSChunkedPayloadSigner signer(DeriveExampleSigningKey(), EXAMPLE_DATE, EXAMPLE_SCOPE, EXAMPLE_SEED_SIGNATURE, 200);
+
+    size_t bodyBytesRead = 0;
+    Aws::String encoded = EncodeAll(signer, body, 16 * 1024, bodyBytesRead);
+    EXPECT_TRUE(encoded.empty());
+    EXPECT_EQ(0u, bodyBytesRead);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSChunkedPayloadSignerTest, SignerPreparesStreamingRequest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto provider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    AWSAuthV4Signer signer(provider, "s3", "us-east-1");
+
+    StandardHttpRequest request(URI("https://examplebucket.s3.amazonaws.com/chunkObject.txt"), HttpMethod::HTTP_PUT);
+    request.AddContentBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, Aws::String(EXAMPLE_BODY_LENGTH, 'a')));
+    request.SetContentLength("66560");
+    request.SetHeaderValue(CONTENT_ENCODING_HEADER, "gzip");
+    request.SetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER, STREAMING_PAYLOAD_SHA256);
+    ASSERT_TRUE(signer.SignRequest(request));
+
+    EXPECT_STREQ(STREAMING_PAYLOAD_SHA256, request.GetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER).c_str());
+    EXPECT_STREQ("66560", request.GetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH_HEADER).c_str());
+    EXPECT_STREQ("66824", request.GetContentLength().c_str());
+    EXPECT_STREQ("aws-chunked,gzip", request.GetHeaderValue(CONTENT_ENCODING_HEADER).c_str());
+    EXPECT_NE(Aws::String::npos, request.GetAwsAuthorization().find("content-encoding;content-length;"));
+    EXPECT_NE(Aws::String::npos, request.GetAwsAuthorization().find("x-amz-decoded-content-length"));
+    ASSERT_NE(nullptr, request.GetContentBodyEncoder());
+
+    size_t bodyBytesRead = 0;
+    Aws::String encoded = EncodeAll(*request.GetContentBodyEncoder(), *request.GetContentBody(), 16 * 1024, bodyBytesRead);
+    EXPECT_EQ(66824u, encoded.length());
+
+    //signing it again for a retry leaves the chunked headers as they are
+    ASSERT_TRUE(signer.SignRequest(request));
+    EXPECT_STREQ("66560", request.GetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH_HEADER).c_str());
+    EXPECT_STREQ("66824", request.GetContentLength().c_str());
+    EXPECT_STREQ("aws-chunked,gzip", request.GetHeaderValue(CONTENT_ENCODING_HEADER).c_str());
+
+    //without the streaming marker the body is hashed up front as before
+    StandardHttpRequest plainRequest(URI("https://examplebucket.s3.amazonaws.com/chunkObject.txt"), HttpMethod::HTTP_PUT);
+    plainRequest.AddContentBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, Aws::String(EXAMPLE_BODY_LENGTH, 'a')));
+    plainRequest.SetContentLength("66560");
+    ASSERT_TRUE(signer.SignRequest(plainRequest));
+    EXPECT_EQ(nullptr, plainRequest.GetContentBodyEncoder());
+    EXPECT_STREQ("66560", plainRequest.GetContentLength().c_str());
+
+    AWS_END_MEMORY_TEST
+}
@@ -23,9 +23,12 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/threading/TimerQueue.h>
 
 #include <stdlib.h>
 #include <thread>
+#include <chrono>
 #include <fstream>
 
 #ifndef _WIN32
@@ -88,6 +91,31 @@ static const char *AllocationTag = "AWSCredentialsProviderTest";
 using namespace Aws::Auth;
 using namespace Aws::Utils;
 
+//credentials are reloaded on a background thread with its own timing. Tests wait for what that thread did rather than for a fixed
+//time, and only give up on it far beyond any reasonable scheduling delay.
+static const std::chrono::seconds REFRESH_WAIT_LIMIT(30);
+
+template<typename Condition>
+static bool WaitForRefresh(Condition condition)
+{
+    auto giveUpAt = std::chrono::steady_clock::now() + REFRESH_WAIT_LIMIT;
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > giveUpAt)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+//the mock counts a call under the same lock it reads the value with, so two more calls mean a whole load ran on the value set before
+static bool WaitForLoadAfterUpdate(const MockEC2MetadataClient& client, int callsBeforeUpdate)
+{
+    return WaitForRefresh([&]() { return client.GetCallCount() >= callsBeforeUpdate + 2; });
+}
+
 #ifndef __ANDROID__
 
 TEST(ProfileConfigFileAWSCredentialsProviderTest, TestDefaultConfig)
@@ -126,7 +154,7 @@ TEST(ProfileConfigFileAWSCredentialsProviderTest, TestDefaultConfig)
     EXPECT_STREQ("DefaultSecretKey", provider.GetAWSCredentials().GetAWSSecretKey().c_str());
 
     FileSystemUtils::RemoveFileIfExists(configFileName.c_str());
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    EXPECT_TRUE(WaitForRefresh([&]() { return provider.GetAWSCredentials().GetAWSAccessKeyId().empty(); }));
 
     EXPECT_STREQ("", provider.GetAWSCredentials().GetAWSAccessKeyId().c_str());
     EXPECT_STREQ("", provider.GetAWSCredentials().GetAWSSecretKey().c_str());
@@ -317,17 +345,76 @@ TEST(InstanceProfileCredentialsProviderTest, TestThatProviderRefreshes)
     ASSERT_EQ("goodSecretKey", provider.GetAWSCredentials().GetAWSSecretKey());
 
     const char* nextSetOfCredentials = "{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\" }";
+    int callsBeforeUpdate = mockClient->GetCallCount();
     mockClient->SetMockedCredentialsValue(nextSetOfCredentials);
-    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
-    ASSERT_EQ("goodSecretKey", provider.GetAWSCredentials().GetAWSSecretKey());
+    AWSCredentials credentialsBeforeRefresh = provider.GetAWSCredentials();
+    //unless the refresh thread already got to the new value, the old credentials are still served
+    if (mockClient->GetCallCount() == callsBeforeUpdate)
+    {
+        ASSERT_EQ("goodAccessKey", credentialsBeforeRefresh.GetAWSAccessKeyId());
+        ASSERT_EQ("goodSecretKey", credentialsBeforeRefresh.GetAWSSecretKey());
+    }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_TRUE(WaitForLoadAfterUpdate(*mockClient, callsBeforeUpdate));
     ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
     ASSERT_EQ("betterSecretKey", provider.GetAWSCredentials().GetAWSSecretKey());
 
     AWS_END_MEMORY_TEST
 }
 
+TEST(InstanceProfileCredentialsProviderTest, TestThatProviderRefreshesInBackground)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials);
+
+    InstanceProfileCredentialsProvider provider(mockClient, 10);
+    //nothing is loaded, and no refresh thread started, until credentials are first asked for
+    ASSERT_EQ(0, mockClient->GetCallCount());
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    const char* nextSetOfCredentials = "{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\" }";
+    int callsBeforeUpdate = mockClient->GetCallCount();
+    mockClient->SetMockedCredentialsValue(nextSetOfCredentials);
+
+    //the reload happens on the refresh thread, without anybody asking for credentials
+    ASSERT_TRUE(WaitForLoadAfterUpdate(*mockClient, callsBeforeUpdate));
+    ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("betterToken", provider.GetAWSCredentials().GetSessionToken());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestFailedRefreshKeepsPreviousCredentials)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials);
+
+    InstanceProfileCredentialsProvider provider(mockClient, 10);
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    //a metadata service hiccup mustn't wipe out credentials that still work
+    int callsBeforeUpdate = mockClient->GetCallCount();
+    mockClient->SetMockedCredentialsValue("");
+    ASSERT_TRUE(WaitForLoadAfterUpdate(*mockClient, callsBeforeUpdate));
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("goodSecretKey", provider.GetAWSCredentials().GetAWSSecretKey());
+
+    callsBeforeUpdate = mockClient->GetCallCount();
+    mockClient->SetMockedCredentialsValue("blah blah blah, I'm bad");
+    ASSERT_TRUE(WaitForLoadAfterUpdate(*mockClient, callsBeforeUpdate));
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    AWS_END_MEMORY_TEST
+}
+
 TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientCouldntFindCredentials)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10)
@@ -363,4 +450,61 @@ TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientReturnsBadData
     AWS_END_MEMORY_TEST
 }
 
+TEST(InstanceProfileCredentialsProviderTest, TestRefreshesAheadOfExpiration)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    //due for a refresh about a second from now, long before the hour the provider would wait otherwise
+    auto expiration = std::chrono::system_clock::now() + std::chrono::milliseconds(BackgroundRefreshingAWSCredentialsProvider::REFRESH_BEFORE_EXPIRATION_MS) +
+        std::chrono::seconds(1);
+    Aws::String expirationString = DateTime::CalculateGmtTimestampAsString(std::chrono::system_clock::to_time_t(expiration), "%Y-%m-%dT%H:%M:%SZ");
+    Aws::StringStream validCredentials;
+    validCredentials << "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\", \"Expiration\": \""
+        << expirationString << "\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials.str().c_str());
+
+    InstanceProfileCredentialsProvider provider(mockClient, 1000 * 60 * 60);
+    AWSCredentials credentials = provider.GetAWSCredentials();
+    ASSERT_EQ("goodAccessKey", credentials.GetAWSAccessKeyId());
+    EXPECT_EQ(std::chrono::system_clock::to_time_t(expiration), std::chrono::system_clock::to_time_t(credentials.GetExpiration()));
+
+    int callsBeforeUpdate = mockClient->GetCallCount();
+    //still within the margin, so the refreshes keep coming as often as they are allowed to
+    Aws::StringStream betterCredentials;
+    betterCredentials << "{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\", \"Expiration\": \""
+        << expirationString << "\" }";
+    mockClient->SetMockedCredentialsValue(betterCredentials.str().c_str());
+    ASSERT_TRUE(WaitForLoadAfterUpdate(*mockClient, callsBeforeUpdate));
+    ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestProvidersShareOneRefreshThread)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }";
+    auto firstClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+    firstClient->SetMockedCredentialsValue(validCredentials);
+    auto secondClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+    secondClient->SetMockedCredentialsValue(validCredentials);
+
+    {
+        InstanceProfileCredentialsProvider firstProvider(firstClient, 1000 * 60 * 15);
+        InstanceProfileCredentialsProvider secondProvider(secondClient, 1000 * 60 * 15);
+        ASSERT_EQ("goodAccessKey", firstProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ("goodAccessKey", secondProvider.GetAWSCredentials().GetAWSAccessKeyId());
+
+        //both refreshes wait on the one shared timer queue
+        EXPECT_EQ(2u, Aws::Utils::Threading::TimerQueue::GetShared()->GetPendingCount());
+    }
+
+    //and the providers took theirs with them
+    EXPECT_EQ(0u, Aws::Utils::Threading::TimerQueue::GetShared()->GetPendingCount());
+
+    AWS_END_MEMORY_TEST
+}
 
@@ -0,0 +1,148 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/auth/CanonicalRequestBuilder.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char* PAYLOAD_HASH = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+namespace
+{
+
+StandardHttpRequest BuildRequest()
+{
+    StandardHttpRequest request(URI("https://examplebucket.s3.amazonaws.com/photos/my photo.jpg"), HttpMethod::HTTP_GET);
+    request.AddQueryStringParameter("versionId", "2");
+    request.AddQueryStringParameter("acl", "");
+    request.SetHeaderValue(HOST_HEADER, "examplebucket.s3.amazonaws.com");
+    request.SetHeaderValue("x-amz-date", "20130524T000000Z");
+    request.SetHeaderValue("x-amz-content-sha256", PAYLOAD_HASH);
+    request.CanonicalizeRequest();
+    return request;
+}
+
+} // anonymous namespace
+
+TEST(CanonicalRequestBuilderTest, BuildsCanonicalRequest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StandardHttpRequest request = BuildRequest();
+    CanonicalRequestBuilder builder;
+
+    EXPECT_STREQ("GET\n"
+                 "/photos/my%20photo.jpg\n"
+                 "acl=&versionId=2\n"
+                 "host:examplebucket.s3.amazonaws.com\n"
+                 "x-amz-content-sha256:e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855\n"
+                 "x-amz-date:20130524T000000Z\n"
+                 "\n"
+                 "host;x-amz-content-sha256;x-amz-date\n"
+                 "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                 builder.BuildCanonicalRequest(request, PAYLOAD_HASH).c_str());
+    EXPECT_STREQ("host;x-amz-content-sha256;x-amz-date", builder.GetSignedHeaders().c_str());
+
+    EXPECT_STREQ("AWS4-HMAC-SHA256\n"
+                 "20130524T000000Z\n"
+                 "20130524/us-east-1/s3/aws4_request\n"
+                 "7344ae5b7ee6c3e7e6b0fe0640412a37625d1fbfff95c48bbb2dc43964946972",
+                 builder.BuildStringToSign("20130524T000000Z", "20130524", "us-east-1", "s3",
+                     "7344ae5b7ee6c3e7e6b0fe0640412a37625d1fbfff95c48bbb2dc43964946972").c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(CanonicalRequestBuilderTest, EncodesPathLikeURI)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    CanonicalRequestBuilder builder;
+    const char* paths[] = { "/", "/a", "//double//slashes//", "/trailing/", "/unicode/\xE2\x82\xAC", "/reserved/!*'();:@&=+$,?#[]" };
+    for (const char* path : paths)
+    {
+        StandardHttpRequest request(URI("https://example.amazonaws.com/"), HttpMethod::HTTP_PUT);
+        request.GetUri().SetPath(path);
+        request.DeleteHeader(HOST_HEADER);
+
+        Aws::String expected("PUT\n");
+        expected.append(URI::URLEncodePath(path)).append("\n\n\n\n");
+        EXPECT_EQ(expected, builder.BuildCanonicalRequest(request, "")) << path;
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(CanonicalRequestBuilderTest, SignsSingleHeader)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StandardHttpRequest request = BuildRequest();
+    CanonicalRequestBuilder builder;
+
+    EXPECT_STREQ("GET\n"
+                 "/photos/my%20photo.jpg\n"
+                 "acl=&versionId=2\n"
+                 "host:examplebucket.s3.amazonaws.com\n"
+                 "\n"
+                 "host\n"
+                 "UNSIGNED-PAYLOAD",
+                 builder.BuildCanonicalRequest(request, HOST_HEADER, request.GetHeaderValue(HOST_HEADER), "UNSIGNED-PAYLOAD").c_str());
+    EXPECT_STREQ("host", builder.GetSignedHeaders().c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
+#ifdef AWS_CUSTOM_MEMORY_MANAGEMENT
+
+TEST(CanonicalRequestBuilderTest, SteadyStateBuildsDoNotAllocate)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StandardHttpRequest request = BuildRequest();
+    StandardHttpRequest presignRequest = BuildRequest();
+    const Aws::String& hostValue = presignRequest.GetHeaderValue(HOST_HEADER);
+    Aws::String payloadHash(PAYLOAD_HASH);
+    Aws::String unsignedPayload("UNSIGNED-PAYLOAD");
+    Aws::String date("20130524T000000Z");
+    Aws::String simpleDate("20130524");
+    Aws::String region("us-east-1");
+    Aws::String service("s3");
+
+    CanonicalRequestBuilder builder;
+    //the first build sizes the buffers
+    builder.BuildCanonicalRequest(request, payloadHash);
+    builder.BuildStringToSign(date, simpleDate, region, service, payloadHash);
+
+    uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount();
+    for (int i = 0; i < 1000; ++i)
+    {
+        builder.BuildCanonicalRequest(request, payloadHash);
+        builder.BuildStringToSign(date, simpleDate, region, service, payloadHash);
+        //a smaller request fits in the buffers the bigger one left behind
+        builder.BuildCanonicalRequest(presignRequest, HOST_HEADER, hostValue, unsignedPayload);
+    }
+    EXPECT_EQ(allocationsBefore, memorySystem.GetTotalAllocationCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+#endif // AWS_CUSTOM_MEMORY_MANAGEMENT
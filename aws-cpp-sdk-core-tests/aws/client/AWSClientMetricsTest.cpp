@@ -0,0 +1,702 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/AdaptiveRateLimiter.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/HistogramMetricsPublisher.h>
+#include <aws/core/client/JitteredRetryStrategy.h>
+#include <aws/core/client/RetryTokenBucket.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/PreallocatedStream.h>
+#include <aws/core/utils/threading/CancellationToken.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Threading;
+
+static const char* METRICS_TEST_TAG = "AWSClientMetricsTest";
+
+namespace
+{
+
+class MockSigner : public AWSAuthSigner
+{
+public:
+    bool SignRequest(HttpRequest&) const override { return true; }
+    bool PresignRequest(HttpRequest&, long long) const override { return true; }
+    const char* GetServiceName() const override { return "mockservice"; }
+};
+
+class MockServiceClient : public AWSClient
+{
+public:
+    MockServiceClient(const std::shared_ptr<MockHttpClientFactory>& factory, const ClientConfiguration& config) :
+        AWSClient(factory, config, Aws::MakeShared<MockSigner>(METRICS_TEST_TAG), nullptr)
+    {
+    }
+
+    HttpResponseOutcome Call(const Aws::AmazonWebServiceRequest& request, HttpMethod method = HttpMethod::HTTP_POST) const
+    {
+        return AttemptExhaustively("http://mockservice.us-east-1.amazonaws.com/", request, method);
+    }
+
+    void CallAsync(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request, const HttpResponseOutcomeReceivedHandler& handler) const
+    {
+        AttemptExhaustivelyAsync("http://mockservice.us-east-1.amazonaws.com/", request, HttpMethod::HTTP_POST, handler);
+    }
+
+protected:
+    AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<HttpResponse>& response) const override
+    {
+        if (!response)
+        {
+            return AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "", "Unable to connect to endpoint", true);
+        }
+        bool serverError = static_cast<int>(response->GetResponseCode()) >= 500;
+        return AWSError<CoreErrors>(serverError ? CoreErrors::INTERNAL_FAILURE : CoreErrors::INVALID_ACTION, serverError);
+    }
+};
+
+class PutThingRequest : public Aws::AmazonWebServiceRequest
+{
+public:
+    PutThingRequest() : m_body(Aws::MakeShared<Aws::StringStream>(METRICS_TEST_TAG, "payload")), m_bodyRequests(0) {}
+
+    std::shared_ptr<Aws::IOStream> GetBody() const override { ++m_bodyRequests; return m_body; }
+    HeaderValueCollection GetHeaders() const override { return HeaderValueCollection(); }
+    const char* GetServiceRequestName() const override { return "PutThing"; }
+
+    int GetBodyRequestCount() const { return m_bodyRequests; }
+
+private:
+    std::shared_ptr<Aws::IOStream> m_body;
+    mutable int m_bodyRequests;
+};
+
+/**
+ * Reads bytes 100-199 of an object.
+ */
+class GetThingRangeRequest : public Aws::AmazonWebServiceRequest
+{
+public:
+    std::shared_ptr<Aws::IOStream> GetBody() const override { return nullptr; }
+    HeaderValueCollection GetHeaders() const override
+    {
+        HeaderValueCollection headers;
+        headers.emplace(RANGE_HEADER, "bytes=100-199");
+        return headers;
+    }
+};
+
+std::shared_ptr<StandardHttpResponse> MakeRangeResponse(const std::shared_ptr<MockHttpClientFactory>& factory, const char* eTag,
+    const Aws::String& body, bool complete)
+{
+    auto responseRequest = factory->CreateHttpRequest(Aws::String("http://mockservice.us-east-1.amazonaws.com/"),
+        HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, *responseRequest);
+    response->SetResponseCode(HttpResponseCode::PARTIAL_CONTENT);
+    response->AddHeader(ETAG_HEADER, eTag);
+    response->GetResponseBody() << body;
+    response->SetTransferIncomplete(!complete);
+    return response;
+}
+
+/**
+ * Serves a ranged read of object in pieces: every request gets the next piece, written into a body made by the request's own
+ * response stream factory the way a real http client does, and all but the last break off. Requests marked with SlowDownRequest
+ * get a 503 with an error document instead.
+ */
+class BreakingRangeHttpClient : public HttpClient
+{
+public:
+    BreakingRangeHttpClient(const Aws::String& object, long long objectOffset, const Aws::Vector<size_t>& pieceSizes) :
+        m_object(object), m_objectOffset(objectOffset), m_pieceSizes(pieceSizes), m_served(0), m_servedPieces(0), m_requestCount(0)
+    {
+    }
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* = nullptr) const override
+    {
+        auto response = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, request);
+        if (std::find(m_slowDownRequests.begin(), m_slowDownRequests.end(), m_requestCount++) != m_slowDownRequests.end())
+        {
+            response->SetResponseCode(HttpResponseCode::SERVICE_UNAVAILABLE);
+            response->GetResponseBody() << "<Error><Code>SlowDown</Code><Message>Please reduce your request rate.</Message></Error>";
+            return response;
+        }
+
+        size_t pieceSize = m_pieceSizes[m_servedPieces++];
+        response->SetResponseCode(HttpResponseCode::PARTIAL_CONTENT);
+        response->AddHeader(ETAG_HEADER, "\"abc\"");
+        long long firstByte = m_objectOffset + static_cast<long long>(m_served);
+        long long lastByte = m_objectOffset + static_cast<long long>(m_object.length()) - 1;
+        response->AddHeader(CONTENT_RANGE_HEADER, "bytes " + Aws::Utils::StringUtils::to_string(firstByte) + "-" +
+            Aws::Utils::StringUtils::to_string(lastByte) + "/1000");
+        response->AddHeader(CONTENT_LENGTH_HEADER, Aws::Utils::StringUtils::to_string(lastByte - firstByte + 1));
+        response->GetResponseBody().write(m_object.c_str() + m_served, pieceSize);
+        m_served += pieceSize;
+        response->SetTransferIncomplete(m_served < m_object.length());
+        return response;
+    }
+
+    void SlowDownRequest(int requestIndex) { m_slowDownRequests.push_back(requestIndex); }
+    int GetRequestCount() const { return m_requestCount; }
+
+private:
+    Aws::String m_object;
+    long long m_objectOffset;
+    Aws::Vector<size_t> m_pieceSizes;
+    Aws::Vector<int> m_slowDownRequests;
+    mutable size_t m_served;
+    mutable size_t m_servedPieces;
+    mutable int m_requestCount;
+};
+
+class BreakingRangeHttpClientFactory : public MockHttpClientFactory
+{
+public:
+    BreakingRangeHttpClientFactory(const std::shared_ptr<BreakingRangeHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration&) const override { return m_client; }
+
+private:
+    std::shared_ptr<BreakingRangeHttpClient> m_client;
+};
+
+/**
+ * Stands in for an http client with an event loop: asynchronous requests wait until the test answers them, from a thread of its
+ * choosing. Blocking requests aren't expected.
+ */
+class EventLoopHttpClient : public HttpClient
+{
+public:
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest&, Aws::Utils::RateLimits::RateLimiterInterface* = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* = nullptr) const override
+    {
+        ADD_FAILURE() << "the asynchronous path made a blocking request";
+        return nullptr;
+    }
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseReceivedHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* = nullptr, Aws::Utils::RateLimits::RateLimiterInterface* = nullptr) const override
+    {
+        std::lock_guard<std::mutex> locker(m_pendingMutex);
+        m_pending.push_back(PendingRequest{ request, handler });
+        m_pendingChanged.notify_all();
+    }
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+    //waits for the next request and answers it with responseCode
+    bool Answer(HttpResponseCode responseCode, const Aws::String& body)
+    {
+        PendingRequest pending;
+        {
+            std::unique_lock<std::mutex> locker(m_pendingMutex);
+            if (!m_pendingChanged.wait_for(locker, std::chrono::seconds(10), [this]() { return !m_pending.empty(); }))
+            {
+                return false;
+            }
+            pending = m_pending.front();
+            m_pending.erase(m_pending.begin());
+        }
+
+        auto response = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, *pending.request);
+        response->SetResponseCode(responseCode);
+        response->GetResponseBody() << body;
+        pending.handler(pending.request, response);
+        return true;
+    }
+
+    size_t GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> locker(m_pendingMutex);
+        return m_pending.size();
+    }
+
+private:
+    struct PendingRequest
+    {
+        std::shared_ptr<HttpRequest> request;
+        HttpResponseReceivedHandler handler;
+    };
+
+    mutable std::mutex m_pendingMutex;
+    mutable std::condition_variable m_pendingChanged;
+    mutable Aws::Vector<PendingRequest> m_pending;
+};
+
+class EventLoopHttpClientFactory : public MockHttpClientFactory
+{
+public:
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration&) const override { return m_client; }
+
+    std::shared_ptr<EventLoopHttpClient> m_client = Aws::MakeShared<EventLoopHttpClient>(METRICS_TEST_TAG);
+};
+
+} // anonymous namespace
+
+TEST(AWSClientMetricsTest, RetriedCallIsPublishedOnce)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto publisher = Aws::MakeShared<HistogramMetricsPublisher>(METRICS_TEST_TAG);
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+    config.metricsPublisher = publisher;
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+
+        auto responseRequest = mockHttpClientFactory->CreateHttpRequest(Aws::String("http://mockservice.us-east-1.amazonaws.com/"),
+            HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto failedResponse = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, *responseRequest);
+        failedResponse->SetResponseCode(HttpResponseCode::SERVICE_UNAVAILABLE);
+        auto goodResponse = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, *responseRequest);
+        goodResponse->SetResponseCode(HttpResponseCode::OK);
+        goodResponse->GetResponseBody() << "{\"result\":1}";
+        mockHttpClient->AddResponseToReturn(failedResponse);
+        mockHttpClient->AddResponseToReturn(goodResponse);
+
+        PutThingRequest request;
+        EXPECT_TRUE(client.Call(request).IsSuccess());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+        //the retry sent the request built for the first attempt, the body was serialized once
+        EXPECT_EQ(1, request.GetBodyRequestCount());
+        EXPECT_EQ(mockHttpClient->GetAllRequestsMade()[0].GetContentBody(), mockHttpClient->GetAllRequestsMade()[1].GetContentBody());
+    }
+
+    auto metrics = publisher->GetOperationMetrics("mockservice", "PutThing");
+    ASSERT_NE(nullptr, metrics);
+    EXPECT_EQ(1u, metrics->callCount.load());
+    EXPECT_EQ(0u, metrics->failedCallCount.load());
+    EXPECT_EQ(1u, metrics->retryCount.load());
+    //the body went out with both attempts, only the last one got one back
+    EXPECT_EQ(14u, metrics->bytesSent.load());
+    EXPECT_EQ(12u, metrics->bytesReceived.load());
+    EXPECT_EQ(1u, metrics->endToEndLatency.GetCount());
+    EXPECT_EQ(1u, metrics->signingTime.GetCount());
+    EXPECT_EQ(nullptr, publisher->GetOperationMetrics("mockservice", "GetThing"));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, FailedCallWithoutRequestNameIsNamedAfterMethod)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto publisher = Aws::MakeShared<HistogramMetricsPublisher>(METRICS_TEST_TAG);
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 2, 0);
+    config.metricsPublisher = publisher;
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+        //the mock client has no responses queued, every attempt fails to connect
+        class UnnamedRequest : public Aws::AmazonWebServiceRequest
+        {
+        public:
+            std::shared_ptr<Aws::IOStream> GetBody() const override { return nullptr; }
+            HeaderValueCollection GetHeaders() const override { return HeaderValueCollection(); }
+        } request;
+        EXPECT_FALSE(client.Call(request).IsSuccess());
+    }
+
+    auto metrics = publisher->GetOperationMetrics("mockservice", "POST");
+    ASSERT_NE(nullptr, metrics);
+    EXPECT_EQ(1u, metrics->callCount.load());
+    EXPECT_EQ(1u, metrics->failedCallCount.load());
+    EXPECT_EQ(2u, metrics->retryCount.load());
+    EXPECT_EQ(0u, metrics->bytesReceived.load());
+    EXPECT_EQ(0u, metrics->firstByteLatency.GetCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, CancelledRequestIsNotSent)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto publisher = Aws::MakeShared<HistogramMetricsPublisher>(METRICS_TEST_TAG);
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+    config.metricsPublisher = publisher;
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+
+        PutThingRequest request;
+        auto token = Aws::MakeShared<CancellationToken>(METRICS_TEST_TAG);
+        token->Cancel();
+        request.SetCancellationToken(token);
+
+        auto outcome = client.Call(request);
+        ASSERT_FALSE(outcome.IsSuccess());
+        EXPECT_EQ(CoreErrors::NETWORK_CONNECTION, outcome.GetError().GetErrorType());
+        EXPECT_STREQ("RequestCancelled", outcome.GetError().GetExceptionName().c_str());
+        EXPECT_FALSE(outcome.GetError().ShouldRetry());
+        EXPECT_EQ(0u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    //it never went out, so there was no call to publish
+    EXPECT_EQ(nullptr, publisher->GetOperationMetrics("mockservice", "PutThing"));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, DeadlineCutsRetrySleepShort)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    ClientConfiguration config;
+    //the first retry goes out right away, left alone the second would wait forty seconds
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 10000);
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+
+        auto responseRequest = mockHttpClientFactory->CreateHttpRequest(Aws::String("http://mockservice.us-east-1.amazonaws.com/"),
+            HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto failedResponse = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, *responseRequest);
+        failedResponse->SetResponseCode(HttpResponseCode::SERVICE_UNAVAILABLE);
+        mockHttpClient->AddResponseToReturn(failedResponse);
+
+        PutThingRequest request;
+        auto start = std::chrono::steady_clock::now();
+        request.SetDeadline(start + std::chrono::milliseconds(200));
+
+        auto outcome = client.Call(request);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        ASSERT_FALSE(outcome.IsSuccess());
+        EXPECT_STREQ("RequestDeadlineExceeded", outcome.GetError().GetExceptionName().c_str());
+        EXPECT_FALSE(outcome.GetError().ShouldRetry());
+        EXPECT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+        EXPECT_GE(elapsed, std::chrono::milliseconds(200));
+        EXPECT_LT(elapsed, std::chrono::milliseconds(5000));
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, RetryCutShortByTheDeadlineGivesItsTokensBack)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    auto bucket = Aws::MakeShared<RetryTokenBucket>(METRICS_TEST_TAG, 20);
+    ClientConfiguration config;
+    //decorrelated jitter never waits less than the ten second base delay, so the deadline always hits during the back-off
+    config.retryStrategy = Aws::MakeShared<JitteredRetryStrategy>(METRICS_TEST_TAG, JitterMode::DECORRELATED, 3, 10000, 10000, bucket, 5, 10);
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+
+        auto responseRequest = mockHttpClientFactory->CreateHttpRequest(Aws::String("http://mockservice.us-east-1.amazonaws.com/"),
+            HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto failedResponse = Aws::MakeShared<StandardHttpResponse>(METRICS_TEST_TAG, *responseRequest);
+        failedResponse->SetResponseCode(HttpResponseCode::SERVICE_UNAVAILABLE);
+        mockHttpClient->AddResponseToReturn(failedResponse);
+
+        PutThingRequest request;
+        request.SetDeadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+
+        auto outcome = client.Call(request);
+        ASSERT_FALSE(outcome.IsSuccess());
+        EXPECT_STREQ("RequestDeadlineExceeded", outcome.GetError().GetExceptionName().c_str());
+        EXPECT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+        EXPECT_EQ(20u, bucket->GetAvailableTokens());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, DeadlineCutsSendTokenWaitShort)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    //throttled with its clock standing still, the limiter makes every request wait two seconds for a token that never comes
+    auto frozenTime = std::chrono::steady_clock::now();
+    auto rateLimiter = Aws::MakeShared<AdaptiveRateLimiter>(METRICS_TEST_TAG, [frozenTime]() { return frozenTime; });
+    rateLimiter->UpdateSendRate(true);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+    config.requestRateLimiter = rateLimiter;
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+
+        PutThingRequest request;
+        request.SetDeadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+
+        auto outcome = client.Call(request);
+        ASSERT_FALSE(outcome.IsSuccess());
+        EXPECT_STREQ("RequestDeadlineExceeded", outcome.GetError().GetExceptionName().c_str());
+        EXPECT_EQ(0u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, BrokenOffRangedReadResumesWhereItStopped)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+        Aws::String object(100, 'x');
+        mockHttpClient->AddResponseToReturn(MakeRangeResponse(mockHttpClientFactory, "\"abc\"", object.substr(0, 10), false));
+        mockHttpClient->AddResponseToReturn(MakeRangeResponse(mockHttpClientFactory, "\"abc\"", object.substr(10, 30), false));
+        mockHttpClient->AddResponseToReturn(MakeRangeResponse(mockHttpClientFactory, "\"abc\"", object.substr(40), true));
+
+        GetThingRangeRequest request;
+        auto outcome = client.Call(request, HttpMethod::HTTP_GET);
+        ASSERT_TRUE(outcome.IsSuccess());
+        EXPECT_FALSE(outcome.GetResult()->IsTransferIncomplete());
+        Aws::StringStream received;
+        received << outcome.GetResult()->GetResponseBody().rdbuf();
+        EXPECT_EQ(object, received.str());
+
+        const auto& requestsMade = mockHttpClient->GetAllRequestsMade();
+        ASSERT_EQ(3u, requestsMade.size());
+        EXPECT_STREQ("bytes=100-199", requestsMade[0].GetHeaderValue(RANGE_HEADER).c_str());
+        EXPECT_STREQ("bytes=110-199", requestsMade[1].GetHeaderValue(RANGE_HEADER).c_str());
+        EXPECT_STREQ("bytes=140-199", requestsMade[2].GetHeaderValue(RANGE_HEADER).c_str());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, RangedReadStartsOverWhenTheObjectChanged)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(METRICS_TEST_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(METRICS_TEST_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+
+    {
+        MockServiceClient client(mockHttpClientFactory, config);
+        Aws::String oldObject(100, 'o');
+        Aws::String newObject(100, 'n');
+        mockHttpClient->AddResponseToReturn(MakeRangeResponse(mockHttpClientFactory, "\"old\"", oldObject.substr(0, 10), false));
+        mockHttpClient->AddResponseToReturn(MakeRangeResponse(mockHttpClientFactory, "\"new\"", newObject.substr(10), true));
+        mockHttpClient->AddResponseToReturn(MakeRangeResponse(mockHttpClientFactory, "\"new\"", newObject, true));
+
+        GetThingRangeRequest request;
+        auto outcome = client.Call(request, HttpMethod::HTTP_GET);
+        ASSERT_TRUE(outcome.IsSuccess());
+        Aws::StringStream received;
+        received << outcome.GetResult()->GetResponseBody().rdbuf();
+        EXPECT_EQ(newObject, received.str());
+
+        const auto& requestsMade = mockHttpClient->GetAllRequestsMade();
+        ASSERT_EQ(3u, requestsMade.size());
+        EXPECT_STREQ("bytes=110-199", requestsMade[1].GetHeaderValue(RANGE_HEADER).c_str());
+        EXPECT_STREQ("bytes=100-199", requestsMade[2].GetHeaderValue(RANGE_HEADER).c_str());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, ResumedRangedReadLandsInPreallocatedBuffer)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String object;
+    for (int i = 0; i < 100; ++i)
+    {
+        object += static_cast<char>('a' + i % 26);
+    }
+    Aws::Vector<size_t> pieceSizes;
+    pieceSizes.push_back(10);
+    pieceSizes.push_back(30);
+    pieceSizes.push_back(60);
+    auto httpClient = Aws::MakeShared<BreakingRangeHttpClient>(METRICS_TEST_TAG, object, 100, pieceSizes);
+    auto httpClientFactory = Aws::MakeShared<BreakingRangeHttpClientFactory>(METRICS_TEST_TAG, httpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+
+    {
+        MockServiceClient client(httpClientFactory, config);
+        Aws::Utils::ByteBuffer buffer(object.length());
+        GetThingRangeRequest request;
+        request.SetResponseStreamFactory(Aws::Utils::Stream::PreallocatedResponseStreamFactory(buffer.GetUnderlyingData(), buffer.GetLength()));
+
+        auto outcome = client.Call(request, HttpMethod::HTTP_GET);
+        ASSERT_TRUE(outcome.IsSuccess());
+        EXPECT_EQ(3, httpClient->GetRequestCount());
+        EXPECT_EQ(object, Aws::String(reinterpret_cast<char*>(buffer.GetUnderlyingData()), buffer.GetLength()));
+        Aws::StringStream received;
+        received << outcome.GetResult()->GetResponseBody().rdbuf();
+        EXPECT_EQ(object, received.str());
+
+        //the headers describe the whole range rather than what the first attempt got
+        EXPECT_STREQ("100", outcome.GetResult()->GetHeader(CONTENT_LENGTH_HEADER).c_str());
+        EXPECT_STREQ("bytes 100-199/1000", outcome.GetResult()->GetHeader(CONTENT_RANGE_HEADER).c_str());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, ErrorBetweenResumedAttemptsStaysOutOfTheBody)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String object;
+    for (int i = 0; i < 100; ++i)
+    {
+        object += static_cast<char>('a' + i % 26);
+    }
+    Aws::Vector<size_t> pieceSizes;
+    pieceSizes.push_back(10);
+    pieceSizes.push_back(90);
+    auto httpClient = Aws::MakeShared<BreakingRangeHttpClient>(METRICS_TEST_TAG, object, 100, pieceSizes);
+    httpClient->SlowDownRequest(1);
+    auto httpClientFactory = Aws::MakeShared<BreakingRangeHttpClientFactory>(METRICS_TEST_TAG, httpClient);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+
+    {
+        MockServiceClient client(httpClientFactory, config);
+        Aws::Utils::ByteBuffer buffer(object.length());
+        GetThingRangeRequest request;
+        request.SetResponseStreamFactory(Aws::Utils::Stream::PreallocatedResponseStreamFactory(buffer.GetUnderlyingData(), buffer.GetLength()));
+
+        auto outcome = client.Call(request, HttpMethod::HTTP_GET);
+        ASSERT_TRUE(outcome.IsSuccess());
+        EXPECT_EQ(3, httpClient->GetRequestCount());
+        EXPECT_EQ(object, Aws::String(reinterpret_cast<char*>(buffer.GetUnderlyingData()), buffer.GetLength()));
+        Aws::StringStream received;
+        received << outcome.GetResult()->GetResponseBody().rdbuf();
+        EXPECT_EQ(object, received.str());
+        EXPECT_STREQ("100", outcome.GetResult()->GetHeader(CONTENT_LENGTH_HEADER).c_str());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientMetricsTest, AsyncCallHoldsNoThreadWhileInFlight)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto publisher = Aws::MakeShared<HistogramMetricsPublisher>(METRICS_TEST_TAG);
+    auto factory = Aws::MakeShared<EventLoopHttpClientFactory>(METRICS_TEST_TAG);
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(METRICS_TEST_TAG, 3, 0);
+    config.metricsPublisher = publisher;
+    config.executor = Aws::MakeShared<PooledThreadExecutor>(METRICS_TEST_TAG, 1, 16);
+
+    {
+        MockServiceClient client(factory, config);
+        std::mutex doneMutex;
+        std::condition_variable doneSignal;
+        int handlerCalls = 0;
+        bool succeeded = false;
+        Aws::String responseBody;
+        std::thread::id handlerThread;
+
+        client.CallAsync(Aws::MakeShared<PutThingRequest>(METRICS_TEST_TAG), [&](HttpResponseOutcome&& outcome)
+        {
+            std::lock_guard<std::mutex> locker(doneMutex);
+            ++handlerCalls;
+            succeeded = outcome.IsSuccess();
+            if (succeeded)
+            {
+                Aws::StringStream body;
+                body << outcome.GetResult()->GetResponseBody().rdbuf();
+                responseBody = body.str();
+            }
+            handlerThread = std::this_thread::get_id();
+            doneSignal.notify_all();
+        });
+
+        //the call returned with the request in flight
+        EXPECT_EQ(1u, factory->m_client->GetPendingCount());
+        //the retry goes out from the executor, the answer comes back on the thread that answers
+        ASSERT_TRUE(factory->m_client->Answer(HttpResponseCode::SERVICE_UNAVAILABLE, ""));
+        ASSERT_TRUE(factory->m_client->Answer(HttpResponseCode::OK, "{\"result\":1}"));
+
+        std::unique_lock<std::mutex> locker(doneMutex);
+        ASSERT_TRUE(doneSignal.wait_for(locker, std::chrono::seconds(10), [&]() { return handlerCalls > 0; }));
+        EXPECT_EQ(1, handlerCalls);
+        EXPECT_TRUE(succeeded);
+        EXPECT_EQ("{\"result\":1}", responseBody);
+        //handed on to the executor rather than run on the http client's thread
+        EXPECT_NE(std::this_thread::get_id(), handlerThread);
+    }
+
+    auto metrics = publisher->GetOperationMetrics("mockservice", "PutThing");
+    ASSERT_NE(nullptr, metrics);
+    EXPECT_EQ(1u, metrics->callCount.load());
+    EXPECT_EQ(1u, metrics->retryCount.load());
+
+    AWS_END_MEMORY_TEST
+}
@@ -19,11 +19,19 @@
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/AmazonStreamingWebServiceRequest.h>
 #include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/utils/memory/stl/AWSAllocator.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+
+#include <atomic>
+#include <thread>
 
 using namespace Aws::Client;
 using namespace Aws::Http;
@@ -71,6 +79,35 @@ private:
     bool m_shouldComputeMd5;
 };
 
+/**
+ * An md5 implementation from before running digests: it only overrides Calculate.
+ */
+class CalculateOnlyHashFactory : public Utils::Crypto::HashFactory
+{
+public:
+    CalculateOnlyHashFactory(const std::shared_ptr<Utils::Crypto::Hash>& hash) : m_hash(hash) {}
+
+    std::shared_ptr<Utils::Crypto::Hash> CreateImplementation() const override
+    {
+        return Aws::MakeShared<CalculateOnlyHash>(ALLOCATION_TAG, m_hash);
+    }
+
+private:
+    class CalculateOnlyHash : public Utils::Crypto::Hash
+    {
+    public:
+        CalculateOnlyHash(const std::shared_ptr<Utils::Crypto::Hash>& hash) : m_hash(hash) {}
+
+        Utils::Crypto::HashResult Calculate(const Aws::String& str) override { return m_hash->Calculate(str); }
+        Utils::Crypto::HashResult Calculate(Aws::IStream& stream) override { return m_hash->Calculate(stream); }
+
+    private:
+        std::shared_ptr<Utils::Crypto::Hash> m_hash;
+    };
+
+    std::shared_ptr<Utils::Crypto::Hash> m_hash;
+};
+
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10)
@@ -163,6 +200,8 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
     ASSERT_EQ("www.uri.com", finalHeaders[Http::HOST_HEADER]);
     ASSERT_EQ(hashResult, finalHeaders[Http::CONTENT_MD5_HEADER]);
     ASSERT_FALSE(finalHeaders[Http::USER_AGENT_HEADER].empty());
+    //the sha256 for the signer comes out of the same pass over the body as the md5
+    ASSERT_EQ(Utils::HashingUtils::CalculateSHA256(*ss), httpRequest->GetContentSha256Digest());
 
     Aws::StringStream contentLengthExpected;
     contentLengthExpected << ss->str().length();
@@ -171,6 +210,74 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
     AWS_END_MEMORY_TEST
 }
 
+TEST(AWSClientTest, TestBuildHttpRequestWithMemoryBody)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto buffer = Aws::MakeShared<Utils::ByteBuffer>(ALLOCATION_TAG, reinterpret_cast<const unsigned char*>("memory body"), 11);
+    AmazonStreamingWebServiceRequest request;
+    request.SetBody(buffer);
+
+    URI uri("http://www.uri.com");
+    std::shared_ptr<Standard::StandardHttpRequest> httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_PUT);
+    AccessViolatingAWSClient awsClient;
+    awsClient.InvokeBuildHttpRequest(request, httpRequest);
+
+    //the body is sent from the caller's buffer, its size comes from there as well
+    ASSERT_EQ("11", httpRequest->GetContentLength());
+    ASSERT_EQ(request.GetBody(), httpRequest->GetContentBody());
+    Aws::String body((std::istreambuf_iterator<char>(*httpRequest->GetContentBody())), std::istreambuf_iterator<char>());
+    ASSERT_EQ("memory body", body);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestContentMd5WithoutRunningDigest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    Utils::Crypto::SetMD5Factory(Aws::MakeShared<CalculateOnlyHashFactory>(ALLOCATION_TAG, Utils::Crypto::CreateMD5Implementation()));
+
+    AmazonWebServiceRequestMock request;
+    request.SetComputeContentMd5(true);
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, "test");
+    request.SetBody(body);
+
+    auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("http://www.uri.com"), HttpMethod::HTTP_PUT);
+    AccessViolatingAWSClient awsClient;
+    awsClient.InvokeBuildHttpRequest(request, httpRequest);
+    Utils::Crypto::SetMD5Factory(nullptr);
+
+    //the single pass fails without a running md5, the md5 is then computed on its own and the sha256 left to the signer
+    ASSERT_TRUE(httpRequest->HasHeader(Http::CONTENT_MD5_HEADER));
+    ASSERT_EQ(Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5("test")), httpRequest->GetHeaderValue(Http::CONTENT_MD5_HEADER));
+    ASSERT_EQ(0u, httpRequest->GetContentSha256Digest().GetLength());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestSetBodyDropsPreviousDigest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    AmazonStreamingWebServiceRequest request;
+    request.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, "first body"));
+    request.SetContentSha256Digest(Utils::HashingUtils::CalculateSHA256("first body"));
+
+    request.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, "second body"));
+    ASSERT_EQ(0u, request.GetContentSha256Digest().GetLength());
+
+    request.SetContentSha256Digest(Utils::HashingUtils::CalculateSHA256("second body"));
+    request.SetBody(reinterpret_cast<const unsigned char*>("third body"), 10);
+    ASSERT_EQ(0u, request.GetContentSha256Digest().GetLength());
+
+    request.SetContentSha256Digest(Utils::HashingUtils::CalculateSHA256("third body"));
+    request.SetBody(Aws::MakeShared<Utils::ByteBuffer>(ALLOCATION_TAG, reinterpret_cast<const unsigned char*>("fourth body"), 11));
+    ASSERT_EQ(0u, request.GetContentSha256Digest().GetLength());
+
+    AWS_END_MEMORY_TEST
+}
+
 TEST(AWSClientTest, TestHostHeaderOverride)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10);
@@ -192,3 +299,57 @@ TEST(AWSClientTest, TestHostHeaderOverride)
 
     AWS_END_MEMORY_TEST
 }
+
+TEST(AWSClientTest, TestConcurrentContentMd5)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    static const int THREAD_COUNT = 8;
+    static const int REQUESTS_PER_THREAD = 100;
+
+    //one client shared by every thread, the way a single S3Client gets used
+    AccessViolatingAWSClient awsClient;
+    std::atomic<int> mismatches(0);
+
+    Aws::Vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < THREAD_COUNT; ++threadIndex)
+    {
+        threads.emplace_back([&awsClient, &mismatches, threadIndex]()
+        {
+            for (int i = 0; i < REQUESTS_PER_THREAD; ++i)
+            {
+                //bodies big enough to take several hash updates, and different on every thread
+                Aws::String content(1000 + 97 * i, static_cast<char>('a' + threadIndex));
+                auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, content);
+
+                AmazonWebServiceRequestMock request;
+                request.SetComputeContentMd5(true);
+                request.SetBody(body);
+                //half of the requests go through the md5-only path, the other half hash md5 and sha256 together
+                if (i % 2)
+                {
+                    HeaderValueCollection headers;
+                    headers[Http::X_AMZ_CONTENT_SHA256_HEADER] = Aws::Client::STREAMING_PAYLOAD_SHA256;
+                    request.SetHeaders(headers);
+                }
+
+                auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("http://www.uri.com"), HttpMethod::HTTP_PUT);
+                awsClient.InvokeBuildHttpRequest(request, httpRequest);
+
+                if (httpRequest->GetHeaderValue(Http::CONTENT_MD5_HEADER) != Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5(content)))
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, mismatches.load());
+
+    AWS_END_MEMORY_TEST
+}
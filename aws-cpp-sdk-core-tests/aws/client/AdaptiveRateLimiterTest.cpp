@@ -0,0 +1,117 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+#include <aws/core/client/AdaptiveRateLimiter.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+
+using namespace Aws::Client;
+
+class AdaptiveRateLimiterTest : public ::testing::Test
+{
+public:
+    static AdaptiveRateLimiter::TimePointType m_currentTime;
+
+    static AdaptiveRateLimiter::TimePointType GetTestTime() { return m_currentTime; }
+
+    static void AdvanceMilliseconds(int64_t milliseconds) { m_currentTime += std::chrono::milliseconds(milliseconds); }
+
+    //sends count requests at a steady pace, all of them successful
+    static void SendSuccessfully(AdaptiveRateLimiter& limiter, int count, int64_t intervalMs)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            AdvanceMilliseconds(intervalMs);
+            limiter.AcquireSendToken();
+            limiter.UpdateSendRate(false);
+        }
+    }
+
+protected:
+    void SetUp()
+    {
+        m_currentTime = AdaptiveRateLimiter::TimePointType();
+    }
+};
+
+AdaptiveRateLimiter::TimePointType AdaptiveRateLimiterTest::m_currentTime;
+
+TEST_F(AdaptiveRateLimiterTest, LetsEverythingThroughUntilThrottled)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    AdaptiveRateLimiter limiter(AdaptiveRateLimiterTest::GetTestTime);
+    SendSuccessfully(limiter, 50, 100);
+
+    EXPECT_FALSE(limiter.IsEnabled());
+    EXPECT_EQ(0, limiter.AcquireSendToken().count());
+    EXPECT_NEAR(10.0, limiter.GetMeasuredSendRate(), 0.5);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST_F(AdaptiveRateLimiterTest, ThrottlingCutsTheRateAndQueuesRequests)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    AdaptiveRateLimiter limiter(AdaptiveRateLimiterTest::GetTestTime);
+    SendSuccessfully(limiter, 50, 100);
+
+    limiter.UpdateSendRate(true);
+    ASSERT_TRUE(limiter.IsEnabled());
+    EXPECT_NEAR(7.0, limiter.GetFillRate(), 0.5);
+
+    //the bucket starts empty, and every request waits behind the ones before it
+    auto firstDelay = limiter.AcquireSendToken();
+    auto secondDelay = limiter.AcquireSendToken();
+    EXPECT_LT(0, firstDelay.count());
+    EXPECT_NEAR(2 * firstDelay.count(), secondDelay.count(), 2);
+
+    //throttled again at the reduced rate, it drops further
+    double reducedRate = limiter.GetFillRate();
+    AdvanceMilliseconds(500);
+    limiter.UpdateSendRate(true);
+    EXPECT_GT(reducedRate, limiter.GetFillRate());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST_F(AdaptiveRateLimiterTest, RateGrowsBackPastTheThrottledRate)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    AdaptiveRateLimiter limiter(AdaptiveRateLimiterTest::GetTestTime);
+    SendSuccessfully(limiter, 50, 100);
+    limiter.UpdateSendRate(true);
+    double throttledRate = limiter.GetFillRate();
+
+    SendSuccessfully(limiter, 35, 143);
+    EXPECT_LT(10.0, limiter.GetFillRate());
+    EXPECT_LT(throttledRate, limiter.GetFillRate());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(CoreErrorsMapperTest, RecognizesThrottlingErrors)
+{
+    EXPECT_TRUE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::THROTTLING, true)));
+    EXPECT_TRUE(CoreErrorsMapper::IsThrottlingError(
+        AWSError<CoreErrors>(CoreErrors::UNKNOWN, "ProvisionedThroughputExceededException", "", true)));
+    EXPECT_TRUE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "SlowDown", "", true)));
+    EXPECT_FALSE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, "InternalFailure", "", true)));
+    EXPECT_FALSE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true)));
+}
@@ -0,0 +1,344 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/HedgingPolicy.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char* HEDGING_TEST_TAG = "HedgingPolicyTest";
+
+namespace
+{
+
+/**
+ * Sends the request body the way a real client does, then leaves the first request it gets hanging until it is cancelled
+ * and answers every other one right away.
+ */
+class StallingHttpClient : public HttpClient
+{
+public:
+    StallingHttpClient() : m_stallFirstRequest(true), m_requestCount(0), m_stalledRequestCancelled(false), m_stalledRequestDone(false) {}
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface*,
+        Aws::Utils::RateLimits::RateLimiterInterface*) const override
+    {
+        Aws::String body;
+        if (request.GetContentBody())
+        {
+            Aws::StringStream bodyStream;
+            bodyStream << request.GetContentBody()->rdbuf();
+            body = bodyStream.str();
+            if (request.GetDataSentEventHandler())
+            {
+                request.GetDataSentEventHandler()(&request, static_cast<long long>(body.size()));
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> locker(m_answeredBodyMutex);
+            m_lastRequestThread = std::this_thread::get_id();
+        }
+
+        if (m_requestCount++ == 0 && m_stallFirstRequest)
+        {
+            auto giveUpAt = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!request.IsCancelledOrExpired() && std::chrono::steady_clock::now() < giveUpAt)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            m_stalledRequestCancelled = request.IsCancelledOrExpired();
+            m_stalledRequestDone = true;
+            return nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> locker(m_answeredBodyMutex);
+            m_answeredBody = body;
+        }
+        auto response = Aws::MakeShared<StandardHttpResponse>(HEDGING_TEST_TAG, request);
+        response->SetResponseCode(HttpResponseCode::OK);
+        response->GetResponseBody() << "{}";
+        return response;
+    }
+
+    void SetStallFirstRequest(bool stallFirstRequest) { m_stallFirstRequest = stallFirstRequest; }
+    int GetRequestCount() const { return m_requestCount.load(); }
+    bool WasStalledRequestCancelled() const { return m_stalledRequestCancelled.load(); }
+    bool IsStalledRequestDone() const { return m_stalledRequestDone.load(); }
+    Aws::String GetAnsweredBody() const
+    {
+        std::lock_guard<std::mutex> locker(m_answeredBodyMutex);
+        return m_answeredBody;
+    }
+    std::thread::id GetLastRequestThread() const
+    {
+        std::lock_guard<std::mutex> locker(m_answeredBodyMutex);
+        return m_lastRequestThread;
+    }
+
+private:
+    bool m_stallFirstRequest;
+    mutable std::atomic<int> m_requestCount;
+    mutable std::atomic<bool> m_stalledRequestCancelled;
+    mutable std::atomic<bool> m_stalledRequestDone;
+    mutable std::mutex m_answeredBodyMutex;
+    mutable Aws::String m_answeredBody;
+    mutable std::thread::id m_lastRequestThread;
+};
+
+class StallingHttpClientFactory : public MockHttpClientFactory
+{
+public:
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration&) const override { return m_client; }
+
+    std::shared_ptr<StallingHttpClient> m_client = Aws::MakeShared<StallingHttpClient>(HEDGING_TEST_TAG);
+};
+
+class MockSigner : public AWSAuthSigner
+{
+public:
+    bool SignRequest(HttpRequest&) const override { return true; }
+    bool PresignRequest(HttpRequest&, long long) const override { return true; }
+    const char* GetServiceName() const override { return "mockservice"; }
+};
+
+class MockServiceClient : public AWSClient
+{
+public:
+    MockServiceClient(const std::shared_ptr<HttpClientFactory>& factory, const ClientConfiguration& config) :
+        AWSClient(factory, config, Aws::MakeShared<MockSigner>(HEDGING_TEST_TAG), nullptr)
+    {
+    }
+
+    HttpResponseOutcome Call(const Aws::AmazonWebServiceRequest& request, HttpMethod method) const
+    {
+        return AttemptExhaustively("http://mockservice.us-east-1.amazonaws.com/", request, method);
+    }
+
+protected:
+    AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<HttpResponse>&) const override
+    {
+        return AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "", "Unable to connect to endpoint", false);
+    }
+};
+
+class GetThingRequest : public Aws::AmazonWebServiceRequest
+{
+public:
+    std::shared_ptr<Aws::IOStream> GetBody() const override { return Aws::MakeShared<Aws::StringStream>(HEDGING_TEST_TAG, "{\"id\":1}"); }
+    HeaderValueCollection GetHeaders() const override { return HeaderValueCollection(); }
+};
+
+//a policy that hedges right away: a known latency of 1ms, so the hedge goes out after the 10ms minimum, and a hedge per request.
+std::shared_ptr<HedgingPolicy> EagerHedgingPolicy()
+{
+    auto policy = Aws::MakeShared<HedgingPolicy>(HEDGING_TEST_TAG, 95.0, 100.0, std::chrono::milliseconds(10), 1);
+    policy->RecordFirstByteLatency(std::chrono::milliseconds(1));
+    return policy;
+}
+
+} // anonymous namespace
+
+TEST(HedgingPolicyTest, WaitsForSamplesAndUsesThePercentile)
+{
+    HedgingPolicy policy(90.0, 5.0, std::chrono::milliseconds(10), 10);
+    for (int i = 0; i < 9; ++i)
+    {
+        policy.RecordFirstByteLatency(std::chrono::milliseconds(20));
+    }
+    EXPECT_FALSE(policy.HasEnoughSamples());
+    policy.RecordFirstByteLatency(std::chrono::milliseconds(500));
+    ASSERT_TRUE(policy.HasEnoughSamples());
+
+    //the slow one is above the 90th percentile, the histogram reports within a few percent
+    auto delay = policy.GetHedgeDelay();
+    EXPECT_GE(delay, std::chrono::milliseconds(20));
+    EXPECT_LE(delay, std::chrono::milliseconds(22));
+
+    HedgingPolicy fastPolicy(90.0, 5.0, std::chrono::milliseconds(10), 1);
+    fastPolicy.RecordFirstByteLatency(std::chrono::microseconds(300));
+    EXPECT_EQ(std::chrono::milliseconds(10), fastPolicy.GetHedgeDelay());
+}
+
+TEST(HedgingPolicyTest, BudgetCapsExtraLoad)
+{
+    HedgingPolicy policy(95.0, 25.0);
+    EXPECT_FALSE(policy.TryAcquireHedge());
+    for (int i = 0; i < 3; ++i)
+    {
+        policy.OnHedgeableRequest();
+    }
+    EXPECT_FALSE(policy.TryAcquireHedge());
+    policy.OnHedgeableRequest();
+    EXPECT_TRUE(policy.TryAcquireHedge());
+    EXPECT_FALSE(policy.TryAcquireHedge());
+
+    //a long quiet stretch only saves up for a few
+    for (int i = 0; i < 1000; ++i)
+    {
+        policy.OnHedgeableRequest();
+    }
+    int hedges = 0;
+    while (policy.TryAcquireHedge())
+    {
+        ++hedges;
+    }
+    EXPECT_EQ(10, hedges);
+    EXPECT_EQ(11u, policy.GetHedgesFired());
+    EXPECT_EQ(0u, policy.GetHedgesWon());
+}
+
+TEST(HedgingPolicyTest, HedgeAnswersForStalledRequest)
+{
+    auto factory = Aws::MakeShared<StallingHttpClientFactory>(HEDGING_TEST_TAG);
+    auto policy = EagerHedgingPolicy();
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(HEDGING_TEST_TAG, 0, 0);
+    config.hedgingPolicy = policy;
+    MockServiceClient client(factory, config);
+
+    //only the response that is handed out gets a stream of the caller's
+    std::atomic<int> callerStreamCount(0);
+    GetThingRequest request;
+    request.SetIdempotent(true);
+    request.SetResponseStreamFactory([&callerStreamCount]() -> Aws::IOStream*
+    {
+        ++callerStreamCount;
+        return Aws::New<Aws::StringStream>(HEDGING_TEST_TAG);
+    });
+    auto start = std::chrono::steady_clock::now();
+    auto outcome = client.Call(request, HttpMethod::HTTP_POST);
+    ASSERT_TRUE(outcome.IsSuccess());
+    EXPECT_EQ(HttpResponseCode::OK, outcome.GetResult()->GetResponseCode());
+    //the response still knows the request it answers
+    EXPECT_EQ(HttpMethod::HTTP_POST, outcome.GetResult()->GetOriginatingRequest().GetMethod());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    EXPECT_EQ(2, factory->m_client->GetRequestCount());
+    EXPECT_EQ(1u, policy->GetHedgesFired());
+    EXPECT_EQ(1u, policy->GetHedgesWon());
+    EXPECT_EQ(1, callerStreamCount.load());
+    Aws::StringStream responseBody;
+    responseBody << outcome.GetResult()->GetResponseBody().rdbuf();
+    EXPECT_EQ("{}", responseBody.str());
+    //the hedge got the body the stalled primary had sent
+    EXPECT_EQ("{\"id\":1}", factory->m_client->GetAnsweredBody());
+
+    //the stalled attempt was called off
+    auto giveUpAt = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!factory->m_client->IsStalledRequestDone() && std::chrono::steady_clock::now() < giveUpAt)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(factory->m_client->WasStalledRequestCancelled());
+}
+
+TEST(HedgingPolicyTest, OnlyIdempotentRequestsAreHedged)
+{
+    auto factory = Aws::MakeShared<StallingHttpClientFactory>(HEDGING_TEST_TAG);
+    factory->m_client->SetStallFirstRequest(false);
+    auto policy = EagerHedgingPolicy();
+    ClientConfiguration config;
+    config.hedgingPolicy = policy;
+    MockServiceClient client(factory, config);
+
+    GetThingRequest request;
+    EXPECT_TRUE(client.Call(request, HttpMethod::HTTP_POST).IsSuccess());
+    EXPECT_TRUE(client.Call(request, HttpMethod::HTTP_GET).IsSuccess());
+    //answered well inside the hedge delay
+    EXPECT_EQ(2, factory->m_client->GetRequestCount());
+    EXPECT_EQ(0u, policy->GetHedgesFired());
+}
+
+TEST(HedgingPolicyTest, RequestIsSentFromTheCallerIntoItsOwnStream)
+{
+    auto factory = Aws::MakeShared<StallingHttpClientFactory>(HEDGING_TEST_TAG);
+    factory->m_client->SetStallFirstRequest(false);
+    auto policy = EagerHedgingPolicy();
+    ClientConfiguration config;
+    config.hedgingPolicy = policy;
+    MockServiceClient client(factory, config);
+
+    Aws::IOStream* callerStream = nullptr;
+    int callerStreamCount = 0;
+    GetThingRequest request;
+    request.SetResponseStreamFactory([&]() -> Aws::IOStream*
+    {
+        ++callerStreamCount;
+        callerStream = Aws::New<Aws::StringStream>(HEDGING_TEST_TAG);
+        return callerStream;
+    });
+    auto outcome = client.Call(request, HttpMethod::HTTP_GET);
+    ASSERT_TRUE(outcome.IsSuccess());
+
+    //no other thread and no scratch copy for a request that needs no hedge
+    EXPECT_EQ(std::this_thread::get_id(), factory->m_client->GetLastRequestThread());
+    EXPECT_EQ(1, callerStreamCount);
+    EXPECT_EQ(callerStream, &outcome.GetResult()->GetResponseBody());
+    EXPECT_EQ(0u, policy->GetHedgesFired());
+}
+
+TEST(HedgingPolicyTest, CallFromTheExecutorsOnlyWorkerStillGoesOut)
+{
+    auto factory = Aws::MakeShared<StallingHttpClientFactory>(HEDGING_TEST_TAG);
+    factory->m_client->SetStallFirstRequest(false);
+    auto policy = EagerHedgingPolicy();
+    ClientConfiguration config;
+    config.hedgingPolicy = policy;
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(HEDGING_TEST_TAG, 1, 4);
+    config.executor = executor;
+    MockServiceClient client(factory, config);
+
+    //the call holds the executor's only worker, a hedge it queued there couldn't start until the call is done
+    std::mutex callMutex;
+    std::condition_variable callDone;
+    bool succeeded = false;
+    bool done = false;
+    GetThingRequest request;
+    ASSERT_TRUE(executor->Submit([&]()
+    {
+        bool callSucceeded = client.Call(request, HttpMethod::HTTP_GET).IsSuccess();
+        std::lock_guard<std::mutex> locker(callMutex);
+        succeeded = callSucceeded;
+        done = true;
+        callDone.notify_all();
+    }));
+
+    std::unique_lock<std::mutex> locker(callMutex);
+    ASSERT_TRUE(callDone.wait_for(locker, std::chrono::seconds(5), [&]() { return done; }));
+    EXPECT_TRUE(succeeded);
+    EXPECT_EQ(1, factory->m_client->GetRequestCount());
+    EXPECT_EQ(0u, policy->GetHedgesFired());
+}
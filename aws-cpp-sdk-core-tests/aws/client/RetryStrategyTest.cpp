@@ -0,0 +1,117 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/JitteredRetryStrategy.h>
+#include <aws/core/client/RetryTokenBucket.h>
+
+using namespace Aws::Client;
+
+static const char* RETRY_TEST_TAG = "RetryStrategyTest";
+
+static AWSError<CoreErrors> RetryableError(CoreErrors errorType = CoreErrors::INTERNAL_FAILURE)
+{
+    return AWSError<CoreErrors>(errorType, true);
+}
+
+TEST(RetryTokenBucketTest, AcquireAndReleaseStayWithinCapacity)
+{
+    RetryTokenBucket bucket(10);
+
+    EXPECT_TRUE(bucket.TryAcquire(6));
+    EXPECT_FALSE(bucket.TryAcquire(6));
+    EXPECT_EQ(4u, bucket.GetAvailableTokens());
+
+    bucket.Release(3);
+    EXPECT_EQ(7u, bucket.GetAvailableTokens());
+    bucket.Release(100);
+    EXPECT_EQ(10u, bucket.GetAvailableTokens());
+}
+
+TEST(JitteredRetryStrategyTest, FullJitterStaysUnderTheExponentialBackoff)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+    {
+        JitteredRetryStrategy strategy(JitterMode::FULL, 10, 100, 1000);
+
+        for (long retries = 0; retries < 8; ++retries)
+        {
+            long backoff = (std::min)(1000L, 100L << retries);
+            for (int i = 0; i < 50; ++i)
+            {
+                long delay = strategy.CalculateDelayBeforeNextRetry(RetryableError(), retries);
+                EXPECT_LE(0, delay);
+                EXPECT_GE(backoff, delay);
+            }
+        }
+        //large retry counts must not overflow the shift
+        EXPECT_GE(1000, strategy.CalculateDelayBeforeNextRetry(RetryableError(), 100));
+    }
+    AWS_END_MEMORY_TEST
+}
+
+TEST(JitteredRetryStrategyTest, DecorrelatedJitterGrowsFromThePreviousDelay)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+    {
+        JitteredRetryStrategy strategy(JitterMode::DECORRELATED, 10, 100, 1000);
+
+        long previousDelay = 0;
+        for (long retries = 0; retries < 20; ++retries)
+        {
+            long delay = strategy.CalculateDelayAfterPreviousDelay(RetryableError(), retries, previousDelay);
+            EXPECT_LE(100, delay);
+            EXPECT_GE((std::min)(1000L, (std::max)(100L, previousDelay) * 3), delay);
+            previousDelay = delay;
+        }
+    }
+    AWS_END_MEMORY_TEST
+}
+
+TEST(JitteredRetryStrategyTest, StopsRetryingWhenTheTokenBucketRunsDry)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+    {
+        auto bucket = Aws::MakeShared<RetryTokenBucket>(RETRY_TEST_TAG, 20);
+        JitteredRetryStrategy strategy(JitterMode::FULL, 3, 25, 20000, bucket, 5, 10);
+
+        EXPECT_FALSE(strategy.ShouldRetry(AWSError<CoreErrors>(CoreErrors::INVALID_ACTION, false), 0));
+        EXPECT_FALSE(strategy.ShouldRetry(RetryableError(), 3));
+        EXPECT_EQ(20u, bucket->GetAvailableTokens());
+
+        EXPECT_TRUE(strategy.ShouldRetry(RetryableError(CoreErrors::NETWORK_CONNECTION), 0));
+        EXPECT_EQ(10u, bucket->GetAvailableTokens());
+        EXPECT_TRUE(strategy.ShouldRetry(RetryableError(), 0));
+        EXPECT_TRUE(strategy.ShouldRetry(RetryableError(), 1));
+        EXPECT_FALSE(strategy.ShouldRetry(RetryableError(), 0));
+        EXPECT_EQ(0u, bucket->GetAvailableTokens());
+
+        //a success after retrying refunds a retry, one at the first try a single token
+        strategy.OnRequestSucceeded(2);
+        EXPECT_EQ(5u, bucket->GetAvailableTokens());
+        strategy.OnRequestSucceeded(0);
+        EXPECT_EQ(6u, bucket->GetAvailableTokens());
+        EXPECT_TRUE(strategy.ShouldRetry(RetryableError(), 0));
+        EXPECT_EQ(1u, bucket->GetAvailableTokens());
+
+        //a retry that was allowed but never sent gives its cost back
+        strategy.OnRetryAbandoned(RetryableError(), 0);
+        EXPECT_EQ(6u, bucket->GetAvailableTokens());
+    }
+    AWS_END_MEMORY_TEST
+}
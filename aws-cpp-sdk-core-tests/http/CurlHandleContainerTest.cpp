@@ -0,0 +1,135 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/http/URI.h>
+#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/curl/CurlShareHandle.h>
+
+#include <thread>
+
+using namespace Aws::Http;
+
+static const char* ENDPOINT_A = "https://bucket-a.s3.amazonaws.com:443";
+static const char* ENDPOINT_B = "https://bucket-b.s3.amazonaws.com:443";
+
+TEST(CurlHandleContainerTest, ConnectionKeyIdentifiesEndpoint)
+{
+    EXPECT_STREQ("https://bucket-a.s3.amazonaws.com:443",
+        CurlHandleContainer::GetConnectionKey(URI("https://bucket-a.s3.amazonaws.com/some/key?versionId=1")).c_str());
+    EXPECT_STREQ("http://localhost:8000", CurlHandleContainer::GetConnectionKey(URI("http://localhost:8000/")).c_str());
+}
+
+TEST(CurlHandleContainerTest, PrefersHandlesThatTalkedToTheSameEndpoint)
+{
+    CurlHandleContainer container(4);
+
+    CURL* handleA = container.AcquireCurlHandle(ENDPOINT_A);
+    CURL* handleB = container.AcquireCurlHandle(ENDPOINT_B);
+    ASSERT_NE(handleA, handleB);
+    container.ReleaseCurlHandle(handleA);
+    container.ReleaseCurlHandle(handleB);
+    EXPECT_EQ(0u, container.GetPoolHitCount());
+    EXPECT_EQ(2u, container.GetPoolMissCount());
+
+    //b was released last, but a goes back to the handle that talked to a
+    EXPECT_EQ(handleA, container.AcquireCurlHandle(ENDPOINT_A));
+    EXPECT_EQ(handleB, container.AcquireCurlHandle(ENDPOINT_B));
+    EXPECT_EQ(2u, container.GetPoolHitCount());
+    EXPECT_EQ(2u, container.GetPoolMissCount());
+
+    container.ReleaseCurlHandle(handleA);
+    container.ReleaseCurlHandle(handleB);
+}
+
+TEST(CurlHandleContainerTest, FullPoolTakesOverOtherEndpointsHandles)
+{
+    CurlHandleContainer container(1);
+
+    CURL* handle = container.AcquireCurlHandle(ENDPOINT_A);
+    container.ReleaseCurlHandle(handle);
+
+    EXPECT_EQ(handle, container.AcquireCurlHandle(ENDPOINT_B));
+    EXPECT_EQ(0u, container.GetPoolHitCount());
+    EXPECT_EQ(2u, container.GetPoolMissCount());
+    container.ReleaseCurlHandle(handle);
+
+    EXPECT_EQ(handle, container.AcquireCurlHandle(ENDPOINT_B));
+    EXPECT_EQ(1u, container.GetPoolHitCount());
+    container.ReleaseCurlHandle(handle);
+}
+
+TEST(CurlHandleContainerTest, EvictsHandlesIdlePastTimeout)
+{
+    CurlHandleContainer container(1, 3000, 1000, 50);
+
+    CURL* handle = container.AcquireCurlHandle(ENDPOINT_A);
+    container.ReleaseCurlHandle(handle);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+    //the stale handle was closed, and its place in the pool went to a fresh one
+    handle = container.AcquireCurlHandle(ENDPOINT_A);
+    ASSERT_NE(nullptr, handle);
+    EXPECT_EQ(0u, container.GetPoolHitCount());
+    EXPECT_EQ(2u, container.GetPoolMissCount());
+    container.ReleaseCurlHandle(handle);
+
+    EXPECT_EQ(handle, container.AcquireCurlHandle(ENDPOINT_A));
+    EXPECT_EQ(1u, container.GetPoolHitCount());
+    container.ReleaseCurlHandle(handle);
+}
+
+TEST(CurlHandleContainerTest, ClosesIdleHandlesWithoutFurtherCalls)
+{
+    CurlHandleContainer container(4, 3000, 1000, 50);
+
+    CURL* firstHandle = container.AcquireCurlHandle(ENDPOINT_A);
+    CURL* secondHandle = container.AcquireCurlHandle(ENDPOINT_B);
+    container.ReleaseCurlHandle(firstHandle);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    container.ReleaseCurlHandle(secondHandle);
+    EXPECT_EQ(2u, container.GetIdleHandleCount());
+
+    //nothing is acquired or released from here on, the timer closes both handles in turn
+    auto giveUpAt = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (container.GetIdleHandleCount() > 0 && std::chrono::steady_clock::now() < giveUpAt)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(0u, container.GetIdleHandleCount());
+}
+
+TEST(CurlHandleContainerTest, ContainersShareTheProcessWideCaches)
+{
+    std::shared_ptr<CurlShareHandle> shareHandle;
+    {
+        CurlHandleContainer firstContainer(1, 3000, 1000, 0, true);
+        CurlHandleContainer secondContainer(1, 3000, 1000, 0, true);
+        shareHandle = CurlShareHandle::GetProcessWideInstance();
+        ASSERT_NE(nullptr, shareHandle->GetHandle());
+        EXPECT_EQ(3, shareHandle.use_count());
+
+        CURL* handle = firstContainer.AcquireCurlHandle(ENDPOINT_A);
+        ASSERT_NE(nullptr, handle);
+        firstContainer.ReleaseCurlHandle(handle);
+    }
+    //the containers cleaned up their handles and let go of the share
+    EXPECT_EQ(1, shareHandle.use_count());
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
@@ -0,0 +1,499 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/stream/ResponseBodyStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+namespace
+{
+
+static const char OK_RESPONSE[] = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 2\r\nConnection: close\r\n\r\nok";
+
+/**
+ * Answers every connection on a loopback port with a small fixed response, a 200 unless told otherwise. With holdConnections
+ * the connections stay open after the response went out, so a response shorter than its content-length stalls.
+ */
+class LoopbackHttpServer
+{
+public:
+    LoopbackHttpServer(const char* response = OK_RESPONSE, bool holdConnections = false) :
+        m_response(response), m_holdConnections(holdConnections), m_listenSocket(-1), m_port(0), m_continue(true)
+    {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(m_listenSocket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+        listen(m_listenSocket, 64);
+
+        socklen_t addressLength = sizeof(address);
+        getsockname(m_listenSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength);
+        m_port = ntohs(address.sin_port);
+
+        m_acceptThread = std::thread([this]() { AcceptLoop(); });
+    }
+
+    ~LoopbackHttpServer()
+    {
+        m_continue = false;
+        shutdown(m_listenSocket, SHUT_RDWR);
+        close(m_listenSocket);
+        m_acceptThread.join();
+        for (int connection : m_heldConnections)
+        {
+            close(connection);
+        }
+    }
+
+    unsigned short GetPort() const { return m_port; }
+
+private:
+    void AcceptLoop()
+    {
+        while (m_continue)
+        {
+            int connection = accept(m_listenSocket, nullptr, nullptr);
+            if (connection < 0)
+            {
+                continue;
+            }
+
+            char request[4096];
+            Aws::String received;
+            ssize_t bytesRead = 0;
+            while (received.find("\r\n\r\n") == Aws::String::npos && (bytesRead = recv(connection, request, sizeof(request), 0)) > 0)
+            {
+                received.append(request, static_cast<size_t>(bytesRead));
+            }
+
+            if (send(connection, m_response, strlen(m_response), 0) < 0)
+            {
+                ADD_FAILURE() << "Loopback server failed to send a response";
+            }
+
+            if (m_holdConnections)
+            {
+                m_heldConnections.push_back(connection);
+            }
+            else
+            {
+                close(connection);
+            }
+        }
+    }
+
+    const char* m_response;
+    bool m_holdConnections;
+    //only touched by the accept thread until it is joined
+    Aws::Vector<int> m_heldConnections;
+    int m_listenSocket;
+    unsigned short m_port;
+    std::atomic<bool> m_continue;
+    std::thread m_acceptThread;
+};
+
+/**
+ * Keeps every connection open and answers each request on it with a small 200, so clients can reuse connections. Counts the
+ * connections it accepted.
+ */
+class KeepAliveHttpServer
+{
+public:
+    KeepAliveHttpServer() : m_listenSocket(-1), m_port(0), m_continue(true), m_acceptedConnections(0)
+    {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(m_listenSocket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+        listen(m_listenSocket, 64);
+
+        socklen_t addressLength = sizeof(address);
+        getsockname(m_listenSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength);
+        m_port = ntohs(address.sin_port);
+
+        m_acceptThread = std::thread([this]() { AcceptLoop(); });
+    }
+
+    ~KeepAliveHttpServer()
+    {
+        m_continue = false;
+        shutdown(m_listenSocket, SHUT_RDWR);
+        close(m_listenSocket);
+        m_acceptThread.join();
+        {
+            std::lock_guard<std::mutex> locker(m_connectionsLock);
+            for (int connection : m_connections)
+            {
+                shutdown(connection, SHUT_RDWR);
+            }
+        }
+        for (auto& connectionThread : m_connectionThreads)
+        {
+            connectionThread.join();
+        }
+        for (int connection : m_connections)
+        {
+            close(connection);
+        }
+    }
+
+    unsigned short GetPort() const { return m_port; }
+
+    int GetAcceptedConnectionCount() const { return m_acceptedConnections.load(); }
+
+private:
+    void AcceptLoop()
+    {
+        while (m_continue)
+        {
+            int connection = accept(m_listenSocket, nullptr, nullptr);
+            if (connection < 0)
+            {
+                continue;
+            }
+
+            ++m_acceptedConnections;
+            std::lock_guard<std::mutex> locker(m_connectionsLock);
+            m_connections.push_back(connection);
+            m_connectionThreads.emplace_back([this, connection]() { Serve(connection); });
+        }
+    }
+
+    void Serve(int connection)
+    {
+        static const char OK_HEADERS[] = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 2\r\n\r\n";
+        char buffer[4096];
+        Aws::String received;
+        ssize_t bytesRead = 0;
+        while ((bytesRead = recv(connection, buffer, sizeof(buffer), 0)) > 0)
+        {
+            received.append(buffer, static_cast<size_t>(bytesRead));
+            size_t requestEnd = 0;
+            while ((requestEnd = received.find("\r\n\r\n")) != Aws::String::npos)
+            {
+                //a HEAD response carries the headers of the GET response but no body
+                Aws::String response(OK_HEADERS);
+                if (received.compare(0, 5, "HEAD ") != 0)
+                {
+                    response += "ok";
+                }
+                received.erase(0, requestEnd + 4);
+                if (send(connection, response.c_str(), response.length(), 0) < 0)
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    int m_listenSocket;
+    unsigned short m_port;
+    std::atomic<bool> m_continue;
+    std::atomic<int> m_acceptedConnections;
+    std::mutex m_connectionsLock;
+    Aws::Vector<int> m_connections;
+    Aws::Vector<std::thread> m_connectionThreads;
+    std::thread m_acceptThread;
+};
+
+ClientConfiguration MultiClientConfiguration()
+{
+    ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    config.maxConnections = 4;
+    config.connectTimeoutMs = 1000;
+    config.requestTimeoutMs = 5000;
+    return config;
+}
+
+} // anonymous namespace
+
+TEST(CurlMultiHttpClientTest, FactoryHonoursOverride)
+{
+    HttpClientFactory factory;
+    auto client = factory.CreateHttpClient(MultiClientConfiguration());
+    ASSERT_NE(nullptr, client);
+    EXPECT_NE(nullptr, dynamic_cast<CurlMultiHttpClient*>(client.get()));
+
+    ClientConfiguration defaultConfig;
+    auto defaultClient = factory.CreateHttpClient(defaultConfig);
+    ASSERT_NE(nullptr, defaultClient);
+    EXPECT_EQ(nullptr, dynamic_cast<CurlMultiHttpClient*>(defaultClient.get()));
+}
+
+TEST(CurlMultiHttpClientTest, SynchronousRequestCompletes)
+{
+    LoopbackHttpServer server;
+    HttpClientFactory factory;
+    auto client = factory.CreateHttpClient(MultiClientConfiguration());
+
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << server.GetPort() << "/sync";
+    auto request = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+
+    auto response = client->MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+    EXPECT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    EXPECT_STREQ("text/plain", response->GetContentType().c_str());
+
+    //the body was sized from its content-length before it arrived
+    auto bodyBuffer = dynamic_cast<Aws::Utils::Stream::ResponseBodyStreamBuf*>(response->GetResponseBody().rdbuf());
+    ASSERT_NE(nullptr, bodyBuffer);
+    EXPECT_EQ(2u, bodyBuffer->GetCapacity());
+
+    Aws::StringStream body;
+    body << response->GetResponseBody().rdbuf();
+    EXPECT_STREQ("ok", body.str().c_str());
+}
+
+TEST(CurlMultiHttpClientTest, ResponsesCarryRequestTimings)
+{
+    LoopbackHttpServer server;
+    HttpClientFactory factory;
+    ClientConfiguration syncConfig = MultiClientConfiguration();
+    syncConfig.httpLibOverride = TransferLibType::DEFAULT_CLIENT;
+
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << server.GetPort() << "/timed";
+    for (auto client : { factory.CreateHttpClient(MultiClientConfiguration()), factory.CreateHttpClient(syncConfig) })
+    {
+        auto request = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto response = client->MakeRequest(*request);
+        ASSERT_NE(nullptr, response);
+
+        const RequestTimings& timings = response->GetRequestTimings();
+        EXPECT_LT(0, timings.totalTime.count());
+        EXPECT_LE(timings.nameLookupDone, timings.connectDone);
+        EXPECT_LE(timings.connectDone, timings.firstByteReceived);
+        EXPECT_LE(timings.firstByteReceived, timings.totalTime);
+        //plain http, no tls handshake
+        EXPECT_EQ(0, timings.tlsHandshakeDone.count());
+    }
+}
+
+TEST(CurlMultiHttpClientTest, ManyAsyncRequestsCompleteOnEventLoop)
+{
+    LoopbackHttpServer server;
+    HttpClientFactory factory;
+    auto client = factory.CreateHttpClient(MultiClientConfiguration());
+
+    static const int REQUEST_COUNT = 32;
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    int completed = 0;
+    int succeeded = 0;
+    std::thread::id callerThread = std::this_thread::get_id();
+    std::atomic<bool> calledOnCaller(false);
+
+    for (int i = 0; i < REQUEST_COUNT; ++i)
+    {
+        Aws::StringStream uri;
+        uri << "http://127.0.0.1:" << server.GetPort() << "/async/" << i;
+        auto request = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        client->MakeRequestAsync(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+        {
+            if (std::this_thread::get_id() == callerThread)
+            {
+                calledOnCaller = true;
+            }
+            std::lock_guard<std::mutex> locker(completionMutex);
+            if (response && response->GetResponseCode() == HttpResponseCode::OK)
+            {
+                ++succeeded;
+            }
+            ++completed;
+            completionSignal.notify_all();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(30), [&]() { return completed == REQUEST_COUNT; }));
+    EXPECT_EQ(REQUEST_COUNT, succeeded);
+    EXPECT_FALSE(calledOnCaller);
+}
+
+TEST(CurlMultiHttpClientTest, WarmUpParksHandlesForTheEndpoint)
+{
+    KeepAliveHttpServer server;
+    ClientConfiguration config = MultiClientConfiguration();
+    config.httpLibOverride = TransferLibType::DEFAULT_CLIENT;
+    CurlHttpClient client(config);
+
+    Aws::StringStream endpoint;
+    endpoint << "http://127.0.0.1:" << server.GetPort();
+    //capped at maxConnections
+    EXPECT_EQ(4u, client.WarmUpConnections(URI(endpoint.str()), 10));
+    EXPECT_EQ(0u, client.GetConnectionPoolHitCount());
+    EXPECT_EQ(4, server.GetAcceptedConnectionCount());
+
+    HttpClientFactory factory;
+    auto request = factory.CreateHttpRequest(endpoint.str() + "/after-warm-up", HttpMethod::HTTP_GET,
+            Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = client.MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+    EXPECT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    EXPECT_EQ(1u, client.GetConnectionPoolHitCount());
+    //the request went out over one of the warmed up connections instead of opening another
+    EXPECT_EQ(4, server.GetAcceptedConnectionCount());
+}
+
+TEST(CurlMultiHttpClientTest, FailedConnectionCompletesWithNullResponse)
+{
+    int listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listenSocket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    socklen_t addressLength = sizeof(address);
+    getsockname(listenSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength);
+    //nothing listens on the port once the socket is closed, so connects are refused
+    close(listenSocket);
+
+    HttpClientFactory factory;
+    auto client = factory.CreateHttpClient(MultiClientConfiguration());
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << ntohs(address.sin_port) << "/refused";
+    auto request = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+
+    EXPECT_EQ(nullptr, client->MakeRequest(*request));
+}
+
+TEST(CurlMultiHttpClientTest, CancelledAndExpiredTransfersStopEarly)
+{
+    //the kernel completes the handshake for the listen backlog, but nobody ever answers
+    int listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listenSocket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    socklen_t addressLength = sizeof(address);
+    getsockname(listenSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength);
+    listen(listenSocket, 16);
+
+    HttpClientFactory factory;
+    ClientConfiguration syncConfig = MultiClientConfiguration();
+    syncConfig.httpLibOverride = TransferLibType::DEFAULT_CLIENT;
+
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << ntohs(address.sin_port) << "/stalled";
+    for (auto client : { factory.CreateHttpClient(MultiClientConfiguration()), factory.CreateHttpClient(syncConfig) })
+    {
+        auto cancelledRequest = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto token = Aws::MakeShared<Aws::Utils::Threading::CancellationToken>("CurlMultiHttpClientTest");
+        cancelledRequest->SetCancellationToken(token);
+        auto start = std::chrono::steady_clock::now();
+        std::thread canceller([&token] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            token->Cancel();
+        });
+        EXPECT_EQ(nullptr, client->MakeRequest(*cancelledRequest));
+        canceller.join();
+        //well short of the five second request timeout
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(3000));
+
+        auto expiredRequest = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        start = std::chrono::steady_clock::now();
+        expiredRequest->SetDeadline(start + std::chrono::milliseconds(100));
+        EXPECT_EQ(nullptr, client->MakeRequest(*expiredRequest));
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(3000));
+    }
+
+    close(listenSocket);
+}
+
+TEST(CurlMultiHttpClientTest, StalledTransferIsAbortedAndKeptWhenAsked)
+{
+    //ten of the hundred bytes promised, then nothing
+    LoopbackHttpServer server("HTTP/1.1 206 Partial Content\r\nContent-Length: 100\r\nContent-Range: bytes 0-99/1000\r\nETag: \"abc\"\r\n\r\n0123456789", true);
+    HttpClientFactory factory;
+    ClientConfiguration multiConfig = MultiClientConfiguration();
+    multiConfig.requestTimeoutMs = 0;
+    multiConfig.lowSpeedLimit = 1024;
+    multiConfig.lowSpeedTimeMs = 1000;
+    ClientConfiguration syncConfig = multiConfig;
+    syncConfig.httpLibOverride = TransferLibType::DEFAULT_CLIENT;
+
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << server.GetPort() << "/stalled";
+    for (auto client : { factory.CreateHttpClient(multiConfig), factory.CreateHttpClient(syncConfig) })
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto request = factory.CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        EXPECT_EQ(nullptr, client->MakeRequest(*request));
+        //no request timeout, only the stall ended it
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+
+        request->SetKeepIncompleteResponse(true);
+        auto response = client->MakeRequest(*request);
+        ASSERT_NE(nullptr, response);
+        EXPECT_TRUE(response->IsTransferIncomplete());
+        EXPECT_EQ(HttpResponseCode::PARTIAL_CONTENT, response->GetResponseCode());
+        EXPECT_STREQ("\"abc\"", response->GetHeader(ETAG_HEADER).c_str());
+        Aws::StringStream received;
+        received << response->GetResponseBody().rdbuf();
+        EXPECT_STREQ("0123456789", received.str().c_str());
+    }
+}
+
+TEST(CurlMultiHttpClientTest, DestructionCompletesOutstandingRequests)
+{
+    std::atomic<int> completed(0);
+    {
+        HttpClientFactory factory;
+        auto client = factory.CreateHttpClient(MultiClientConfiguration());
+        for (int i = 0; i < 16; ++i)
+        {
+            //non routable address keeps the transfers pending until the client goes away
+            auto request = factory.CreateHttpRequest(Aws::String("http://10.255.255.1/pending"), HttpMethod::HTTP_GET,
+                    Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            client->MakeRequestAsync(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&) { ++completed; });
+        }
+    }
+    EXPECT_EQ(16, completed.load());
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
@@ -0,0 +1,161 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <streambuf>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char* ALLOCATION_TAG = "RequestBodySourceTest";
+
+namespace
+{
+
+/**
+ * A stream buffer over a fixed string that fails every seek and counts the attempts, like a pipe or socket would.
+ */
+class NonSeekableBuf : public std::streambuf
+{
+public:
+    explicit NonSeekableBuf(const Aws::String& data) : m_data(data), m_seekCount(0)
+    {
+        setg(&m_data[0], &m_data[0], &m_data[0] + m_data.size());
+    }
+
+    int GetSeekCount() const { return m_seekCount; }
+
+protected:
+    pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode) override
+    {
+        ++m_seekCount;
+        return pos_type(off_type(-1));
+    }
+
+    pos_type seekpos(pos_type, std::ios_base::openmode) override
+    {
+        ++m_seekCount;
+        return pos_type(off_type(-1));
+    }
+
+private:
+    Aws::String m_data;
+    int m_seekCount;
+};
+
+Aws::String ReadAll(RequestBodySource& source, size_t readSize)
+{
+    Aws::String result;
+    Aws::String buffer(readSize, '\0');
+    size_t amountRead = 0;
+    while ((amountRead = source.Read(&buffer[0], readSize)) > 0)
+    {
+        result.append(buffer.c_str(), amountRead);
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+TEST(RequestBodySourceTest, KnownLengthNeverSeeks)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    NonSeekableBuf buf("0123456789abcdef");
+    Aws::IOStream body(&buf);
+    RequestBodySource source(&body, 10);
+
+    ASSERT_TRUE(source.IsLengthKnown());
+    EXPECT_EQ(10u, source.GetRemainingLength());
+    //content past the declared length is left alone
+    EXPECT_EQ("0123456789", ReadAll(source, 3));
+    EXPECT_EQ(0u, source.GetRemainingLength());
+    EXPECT_EQ(0, buf.GetSeekCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestBodySourceTest, TakesLengthFromContentLengthHeader)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StandardHttpRequest request(URI("http://example.amazonaws.com/"), HttpMethod::HTTP_PUT);
+    request.AddContentBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, "hello world"));
+    request.SetContentLength("5");
+
+    RequestBodySource source(request);
+    ASSERT_TRUE(source.IsLengthKnown());
+    EXPECT_EQ("hello", ReadAll(source, 1024));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestBodySourceTest, MeasuresSeekableStreamOnceFromCurrentPosition)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream body("skipped:body");
+    body.seekg(8);
+    RequestBodySource source(&body, -1);
+
+    ASSERT_TRUE(source.IsLengthKnown());
+    EXPECT_EQ(4u, source.GetRemainingLength());
+    EXPECT_EQ("body", ReadAll(source, 1));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestBodySourceTest, UnknownLengthReadsToEnd)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    NonSeekableBuf buf("streamed without a length");
+    Aws::IOStream body(&buf);
+    RequestBodySource source(&body, -1);
+
+    EXPECT_FALSE(source.IsLengthKnown());
+    EXPECT_EQ("streamed without a length", ReadAll(source, 4));
+    //only the one attempt to measure it
+    EXPECT_EQ(1, buf.GetSeekCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(RequestBodySourceTest, ShortAndMissingBodies)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::StringStream body("short");
+    RequestBodySource shortSource(&body, 100);
+    EXPECT_EQ("short", ReadAll(shortSource, 64));
+    EXPECT_EQ(0u, shortSource.GetRemainingLength());
+
+    RequestBodySource emptySource(nullptr, -1);
+    char buffer[8];
+    EXPECT_TRUE(emptySource.IsLengthKnown());
+    EXPECT_EQ(0u, emptySource.Read(buffer, sizeof(buffer)));
+
+    StandardHttpRequest request(URI("http://example.amazonaws.com/"), HttpMethod::HTTP_GET);
+    RequestBodySource requestSource(request);
+    EXPECT_EQ(0u, requestSource.Read(buffer, sizeof(buffer)));
+
+    AWS_END_MEMORY_TEST
+}
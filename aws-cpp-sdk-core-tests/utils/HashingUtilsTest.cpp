@@ -17,6 +17,9 @@
 #include <aws/testing/MemoryTesting.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/MultiDigest.h>
+#include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 
@@ -228,4 +231,49 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     AWS_END_MEMORY_TEST
 }
 
+TEST(HashingUtilsTest, TestMultiDigestFromStream)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    //bigger than the internal read buffer so the digests are fed in several pieces
+    Aws::String value(3 * Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE + 17, 'x');
+    Aws::StringStream stream(value);
+    stream.seekg(5);
+
+    Crypto::MultiDigest digests({ Aws::MakeShared<Crypto::MD5>("HashingUtilsTest"), Aws::MakeShared<Crypto::Sha256>("HashingUtilsTest") });
+    auto results = digests.Calculate(stream);
+    ASSERT_EQ(2u, results.size());
+    ASSERT_TRUE(results[0].IsSuccess());
+    ASSERT_TRUE(results[1].IsSuccess());
+    EXPECT_EQ(5, stream.tellg());
+
+    EXPECT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateMD5(value)), HashingUtils::HexEncode(results[0].GetResult()));
+    EXPECT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256(value)), HashingUtils::HexEncode(results[1].GetResult()));
+
+    //the running digests were finished, so the same instance can be used again
+    results = digests.Calculate("abc");
+    EXPECT_STREQ("kAFQmDzST7DWlj99KOF/cg==", HashingUtils::Base64Encode(results[0].GetResult()).c_str());
+    EXPECT_STREQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", HashingUtils::HexEncode(results[1].GetResult()).c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(HashingUtilsTest, TestRunningDigest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Crypto::Sha256 sha256;
+    Aws::String first("message ");
+    Aws::String second("digest");
+    sha256.Update((unsigned char*)first.c_str(), first.length());
+    sha256.Update((unsigned char*)second.c_str(), second.length());
+    EXPECT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256("message digest")), HashingUtils::HexEncode(sha256.GetHash().GetResult()));
+
+    //with no data at all it is the digest of the empty string
+    Crypto::MD5 md5;
+    EXPECT_STREQ("1B2M2Y8AsgTpgAmY7PhCfg==", HashingUtils::Base64Encode(md5.GetHash().GetResult()).c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
 #endif // ENABLE_INJECTED_ENCRYPTION
\ No newline at end of file
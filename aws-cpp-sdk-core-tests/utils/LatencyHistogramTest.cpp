@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/LatencyHistogram.h>
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils;
+
+TEST(LatencyHistogramTest, PercentilesAreWithinBucketPrecision)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(0u, histogram.GetValueAtPercentile(50));
+
+    for (uint64_t value = 1; value <= 10000; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    EXPECT_EQ(10000u, histogram.GetCount());
+    EXPECT_EQ(10000u, histogram.GetMax());
+    EXPECT_DOUBLE_EQ(5000.5, histogram.GetMean());
+    //small values are exact
+    EXPECT_EQ(1u, histogram.GetValueAtPercentile(0));
+    EXPECT_EQ(10000u, histogram.GetValueAtPercentile(100));
+
+    uint64_t median = histogram.GetValueAtPercentile(50);
+    EXPECT_LE(5000u, median);
+    EXPECT_GE(5000u * 33 / 32, median);
+    uint64_t p99 = histogram.GetValueAtPercentile(99);
+    EXPECT_LE(9900u, p99);
+    EXPECT_GE(9900u * 33 / 32, p99);
+
+    histogram.Reset();
+    EXPECT_EQ(0u, histogram.GetCount());
+    EXPECT_EQ(0u, histogram.GetMax());
+}
+
+TEST(LatencyHistogramTest, CoversTheWholeRange)
+{
+    LatencyHistogram histogram;
+    histogram.Record(0);
+    histogram.Record(std::numeric_limits<uint64_t>::max());
+
+    EXPECT_EQ(0u, histogram.GetValueAtPercentile(50));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), histogram.GetValueAtPercentile(100));
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordsAreAllCounted)
+{
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&histogram, i]()
+        {
+            for (uint64_t value = 0; value < 10000; ++value)
+            {
+                histogram.Record(value * (i + 1));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(40000u, histogram.GetCount());
+    EXPECT_EQ(9999u * 4, histogram.GetMax());
+}
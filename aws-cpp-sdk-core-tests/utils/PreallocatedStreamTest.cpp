@@ -0,0 +1,108 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/stream/PreallocatedStream.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "PreallocatedStreamTest";
+
+TEST(PreallocatedStreamTest, WritesIntoCallerMemory)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    unsigned char buffer[8] = {};
+    PreallocatedStream stream(buffer, sizeof(buffer));
+
+    stream.write("abcd", 4);
+    EXPECT_TRUE(stream.good());
+    EXPECT_EQ(0, memcmp("abcd", buffer, 4));
+    EXPECT_EQ(4u, stream.GetBytesWritten());
+    EXPECT_EQ(4, stream.tellp());
+
+    //reads see what was written, including what is written after reading started
+    char readBack[8] = {};
+    stream.read(readBack, 2);
+    EXPECT_EQ(0, strncmp("ab", readBack, 2));
+    stream.write("ef", 2);
+    stream.read(readBack, 8);
+    EXPECT_EQ(4, stream.gcount());
+    EXPECT_EQ(0, strncmp("cdef", readBack, 4));
+
+    stream.clear();
+    stream.seekg(1);
+    EXPECT_EQ('b', stream.get());
+    stream.seekg(0, stream.end);
+    EXPECT_EQ(6, stream.tellg());
+
+    //the write position can't be moved
+    stream.seekp(0);
+    EXPECT_TRUE(stream.fail());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PreallocatedStreamTest, FailsOnceFull)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    unsigned char buffer[5] = {};
+    PreallocatedStream stream(buffer, 4);
+    stream.write("123456", 6);
+    EXPECT_TRUE(stream.bad());
+    EXPECT_EQ(4u, stream.GetBytesWritten());
+    EXPECT_EQ(0, memcmp("1234", buffer, 4));
+    EXPECT_EQ(0, buffer[4]);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PreallocatedStreamTest, ResponseFactoryWritesEachAttemptFromTheStart)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto buffer = Aws::MakeShared<ByteBuffer>(ALLOCATION_TAG, 16);
+    std::weak_ptr<ByteBuffer> weakBuffer = buffer;
+
+    StandardHttpRequest request(URI("http://example.amazonaws.com/"), HttpMethod::HTTP_GET);
+    request.SetResponseStreamFactory(PreallocatedResponseStreamFactory(buffer));
+    buffer = nullptr;
+
+    {
+        StandardHttpResponse firstAttempt(request);
+        firstAttempt.GetResponseBody() << "first attempt";
+    }
+    StandardHttpResponse secondAttempt(request);
+    secondAttempt.GetResponseBody() << "second";
+
+    ASSERT_FALSE(weakBuffer.expired());
+    auto heldBuffer = weakBuffer.lock();
+    EXPECT_EQ(0, memcmp("secondattempt", heldBuffer->GetUnderlyingData(), 13));
+    Aws::String body;
+    secondAttempt.GetResponseBody() >> body;
+    EXPECT_EQ("second", body);
+
+    AWS_END_MEMORY_TEST
+}
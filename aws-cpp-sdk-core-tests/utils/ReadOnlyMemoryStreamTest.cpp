@@ -0,0 +1,108 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/stream/ReadOnlyMemoryStream.h>
+
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "ReadOnlyMemoryStreamTest";
+
+TEST(ReadOnlyMemoryStreamTest, ReadsAndSeeksWithoutCopying)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    const char* data = "0123456789";
+    ReadOnlyMemoryStream stream(reinterpret_cast<const unsigned char*>(data), strlen(data));
+    EXPECT_EQ(10u, stream.GetSize());
+
+    char buffer[4] = {};
+    stream.read(buffer, 3);
+    EXPECT_EQ(0, strncmp("012", buffer, 3));
+    EXPECT_EQ(3, stream.tellg());
+
+    stream.seekg(-2, stream.end);
+    stream.read(buffer, 4);
+    EXPECT_EQ(2, stream.gcount());
+    EXPECT_EQ(0, strncmp("89", buffer, 2));
+    EXPECT_TRUE(stream.eof());
+
+    stream.clear();
+    stream.seekg(0, stream.end);
+    EXPECT_EQ(10, stream.tellg());
+    stream.seekg(5);
+    EXPECT_EQ('5', stream.get());
+    //the size doesn't depend on where the stream is
+    EXPECT_EQ(10u, stream.GetSize());
+
+    //out of range seeks fail and leave the stream alone
+    stream.seekg(11);
+    EXPECT_TRUE(stream.fail());
+    stream.clear();
+    EXPECT_EQ(6, stream.tellg());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ReadOnlyMemoryStreamTest, RejectsWrites)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    unsigned char data[] = { 'a', 'b', 'c' };
+    ReadOnlyMemoryStream stream(data, sizeof(data));
+    stream << "xyz";
+    stream.flush();
+    EXPECT_TRUE(stream.bad());
+    EXPECT_EQ('a', data[0]);
+
+    stream.clear();
+    stream.seekg(1);
+    stream.putback('z');
+    EXPECT_TRUE(stream.fail());
+    EXPECT_EQ('a', data[0]);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ReadOnlyMemoryStreamTest, KeepsBufferAlive)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto buffer = Aws::MakeShared<ByteBuffer>(ALLOCATION_TAG, reinterpret_cast<const unsigned char*>("hello"), 5);
+    const unsigned char* underlyingData = buffer->GetUnderlyingData();
+    auto stream = Aws::MakeShared<ReadOnlyMemoryStream>(ALLOCATION_TAG, buffer);
+    std::weak_ptr<ByteBuffer> weakBuffer = buffer;
+    buffer = nullptr;
+    ASSERT_FALSE(weakBuffer.expired());
+
+    EXPECT_EQ(5u, stream->GetSize());
+    EXPECT_EQ(HashingUtils::CalculateMD5("hello"), HashingUtils::CalculateMD5(*stream));
+    EXPECT_EQ(underlyingData, weakBuffer.lock()->GetUnderlyingData());
+
+    stream = nullptr;
+    EXPECT_TRUE(weakBuffer.expired());
+
+    ReadOnlyMemoryStream empty(std::shared_ptr<ByteBuffer>(nullptr));
+    EXPECT_EQ(0u, empty.GetSize());
+    EXPECT_EQ(std::char_traits<char>::eof(), empty.get());
+
+    AWS_END_MEMORY_TEST
+}
@@ -0,0 +1,158 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/stream/ResponseBodyBufferPool.h>
+#include <aws/core/utils/stream/ResponseBodyStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "ResponseBodyBufferPoolTest";
+
+TEST(ResponseBodyStreamBufTest, BehavesLikeAStringStream)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    DefaultUnderlyingStream stream;
+    EXPECT_EQ(0, stream.tellp());
+    for (int i = 0; i < 1000; ++i)
+    {
+        stream << i << ",";
+    }
+    EXPECT_EQ(3890, stream.tellp());
+
+    int value = -1;
+    char comma = 0;
+    stream >> value >> comma;
+    EXPECT_EQ(0, value);
+    stream.seekg(-4, stream.end);
+    stream >> value >> comma;
+    EXPECT_EQ(999, value);
+    stream.get();
+    EXPECT_TRUE(stream.eof());
+
+    stream.clear();
+    stream.seekg(0);
+    stream.seekp(0);
+    stream << "9";
+    stream >> value;
+    EXPECT_EQ(9, value);
+    //rewriting the start doesn't lose the rest
+    stream.seekp(0, stream.end);
+    EXPECT_EQ(3890, stream.tellp());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ResponseBodyStreamBufTest, ReservedBodyIsWrittenWithoutReallocating)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    ResponseBodyStreamBuf buffer;
+    Aws::IOStream stream(&buffer);
+    buffer.Reserve(1024);
+    EXPECT_EQ(1024u, buffer.GetCapacity());
+
+    Aws::String chunk(128, 'x');
+    uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount();
+    for (int i = 0; i < 8; ++i)
+    {
+        stream.write(chunk.c_str(), chunk.length());
+    }
+    EXPECT_EQ(allocationsBefore, memorySystem.GetTotalAllocationCount());
+    EXPECT_EQ(1024u, buffer.GetSize());
+    EXPECT_EQ(1024u, buffer.GetCapacity());
+
+    //past the reservation it still grows
+    stream << "y";
+    EXPECT_EQ(1025u, buffer.GetSize());
+    EXPECT_LT(1025u, buffer.GetCapacity());
+
+    //reserving again keeps what was written
+    buffer.Reserve(64 * 1024);
+    EXPECT_EQ(64u * 1024u, buffer.GetCapacity());
+    EXPECT_EQ(1025u, buffer.GetSize());
+    Aws::String readBack((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(chunk + chunk + chunk + chunk + chunk + chunk + chunk + chunk + "y", readBack);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ResponseBodyBufferPoolTest, SteadyStateResponsesReuseBuffers)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto pool = Aws::MakeShared<ResponseBodyBufferPool>(ALLOCATION_TAG, 2, 64 * 1024);
+    StandardHttpRequest request(URI("http://example.amazonaws.com/"), HttpMethod::HTTP_GET);
+    request.SetResponseStreamFactory(pool->GetResponseStreamFactory());
+
+    Aws::String body(16 * 1024, 'b');
+    {
+        StandardHttpResponse firstResponse(request);
+        firstResponse.GetResponseBody() << body;
+    }
+    EXPECT_EQ(1u, pool->GetPooledBufferCount());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        StandardHttpResponse response(request);
+        auto bodyBuffer = dynamic_cast<ResponseBodyStreamBuf*>(response.GetResponseBody().rdbuf());
+        ASSERT_NE(nullptr, bodyBuffer);
+        EXPECT_LE(body.length(), bodyBuffer->GetCapacity());
+        EXPECT_EQ(0u, bodyBuffer->GetSize());
+
+        response.GetResponseBody() << body;
+        Aws::String readBack((std::istreambuf_iterator<char>(response.GetResponseBody())), std::istreambuf_iterator<char>());
+        EXPECT_EQ(body, readBack);
+    }
+    EXPECT_EQ(10u, pool->GetReuseCount());
+    EXPECT_EQ(1u, pool->GetPooledBufferCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ResponseBodyBufferPoolTest, KeepsOnlyWhatFits)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto pool = Aws::MakeShared<ResponseBodyBufferPool>(ALLOCATION_TAG, 1, 1024);
+    pool->Release(Aws::Utils::Array<char>(4096));
+    EXPECT_EQ(0u, pool->GetPooledBufferCount());
+    pool->Release(Aws::Utils::Array<char>(512));
+    pool->Release(Aws::Utils::Array<char>(512));
+    EXPECT_EQ(1u, pool->GetPooledBufferCount());
+
+    EXPECT_EQ(512u, pool->Acquire().GetLength());
+    EXPECT_EQ(0u, pool->Acquire().GetLength());
+
+    //streams outliving their pool just free their buffer
+    auto factory = pool->GetResponseStreamFactory();
+    Aws::IOStream* stream = factory();
+    factory = nullptr;
+    pool = nullptr;
+    *stream << "orphaned";
+    Aws::Delete(stream);
+
+    AWS_END_MEMORY_TEST
+}
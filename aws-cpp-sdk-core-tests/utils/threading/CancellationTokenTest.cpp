@@ -0,0 +1,48 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/threading/CancellationToken.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+TEST(CancellationTokenTest, WaitTimesOutWhileNotCancelled)
+{
+    CancellationToken token;
+    EXPECT_FALSE(token.IsCancelled());
+    EXPECT_FALSE(token.WaitForCancellation(std::chrono::milliseconds(20)));
+}
+
+TEST(CancellationTokenTest, CancelWakesWaiters)
+{
+    CancellationToken token;
+    auto start = std::chrono::steady_clock::now();
+    std::thread canceller([&token] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        token.Cancel();
+    });
+
+    EXPECT_TRUE(token.WaitForCancellation(std::chrono::milliseconds(10000)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5000));
+    canceller.join();
+
+    EXPECT_TRUE(token.IsCancelled());
+    //once cancelled it stays cancelled
+    EXPECT_TRUE(token.WaitForCancellation(std::chrono::milliseconds(0)));
+}
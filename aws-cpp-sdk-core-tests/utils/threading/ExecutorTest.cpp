@@ -0,0 +1,445 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+
+/**
+ * Holds worker threads inside a task until Release() is called.
+ */
+class Gate
+{
+public:
+    Gate() : m_open(false) {}
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        m_signal.wait(locker, [this]() { return m_open; });
+    }
+
+    void Release()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_open = true;
+        m_signal.notify_all();
+    }
+
+private:
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+    bool m_open;
+};
+
+void WaitForQueueDepth(const PooledThreadExecutor& executor, size_t depth)
+{
+    while (executor.GetQueueDepth() != depth)
+    {
+        std::this_thread::yield();
+    }
+}
+
+} // anonymous namespace
+
+TEST(PooledThreadExecutorTest, RunsAllSubmittedTasks)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    std::atomic<int> counter(0);
+    {
+        PooledThreadExecutor executor(4, 16);
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&counter]() { ++counter; }));
+        }
+    }
+    //destruction drains the queue before joining the workers
+    EXPECT_EQ(1000, counter.load());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, RejectPolicyRefusesTasksWhenFull)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Gate gate;
+    std::atomic<int> counter(0);
+    {
+        PooledThreadExecutor executor(1, 2, OverflowPolicy::REJECT);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.Wait(); }));
+        WaitForQueueDepth(executor, 0);
+
+        EXPECT_TRUE(executor.Submit([&counter]() { ++counter; }));
+        EXPECT_TRUE(executor.Submit([&counter]() { ++counter; }));
+        EXPECT_FALSE(executor.Submit([&counter]() { ++counter; }));
+
+        EXPECT_EQ(2u, executor.GetQueueDepth());
+        EXPECT_EQ(2u, executor.GetPeakQueueDepth());
+        EXPECT_EQ(1u, executor.GetRejectedTaskCount());
+        gate.Release();
+    }
+    EXPECT_EQ(2, counter.load());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, RunOnCallerPolicyRunsOverflowSynchronously)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Gate gate;
+    std::thread::id callerThread = std::this_thread::get_id();
+    std::atomic<bool> ranOnCaller(false);
+    {
+        PooledThreadExecutor executor(1, 1, OverflowPolicy::RUN_ON_CALLER);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.Wait(); }));
+        WaitForQueueDepth(executor, 0);
+        ASSERT_TRUE(executor.Submit([]() {}));
+
+        ASSERT_TRUE(executor.Submit([&]() { ranOnCaller = std::this_thread::get_id() == callerThread; }));
+        EXPECT_TRUE(ranOnCaller.load());
+        EXPECT_EQ(1u, executor.GetCallerRunTaskCount());
+        gate.Release();
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, BlockPolicyWaitsForRoom)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Gate gate;
+    std::atomic<bool> submitted(false);
+    {
+        PooledThreadExecutor executor(1, 1, OverflowPolicy::BLOCK);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.Wait(); }));
+        WaitForQueueDepth(executor, 0);
+        ASSERT_TRUE(executor.Submit([]() {}));
+
+        std::thread submitter([&]() {
+            executor.Submit([]() {});
+            submitted = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(submitted.load());
+
+        gate.Release();
+        submitter.join();
+        EXPECT_TRUE(submitted.load());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, ReportsTaskWaitTime)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Gate gate;
+    {
+        PooledThreadExecutor executor(1, 4);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.Wait(); }));
+        WaitForQueueDepth(executor, 0);
+        ASSERT_TRUE(executor.Submit([]() {}));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        gate.Release();
+        while (executor.GetExecutedTaskCount() < 2)
+        {
+            std::this_thread::yield();
+        }
+
+        EXPECT_GE(executor.GetMaxTaskWaitTime(), std::chrono::microseconds(std::chrono::milliseconds(20)));
+        EXPECT_GE(executor.GetTotalTaskWaitTime(), executor.GetMaxTaskWaitTime());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, CanBeDestroyedByItsOwnTask)
+{
+    Gate gate;
+    std::atomic<bool> destroyed(false);
+    std::atomic<int> counter(0);
+    auto executor = Aws::MakeShared<PooledThreadExecutor>("PooledThreadExecutorTest", 2, 4);
+
+    ASSERT_TRUE(executor->Submit([&]() {
+        gate.Wait();
+        executor = nullptr;
+        destroyed = true;
+    }));
+    ASSERT_TRUE(executor->Submit([&counter]() { ++counter; }));
+    ASSERT_TRUE(executor->Submit([&counter]() { ++counter; }));
+    gate.Release();
+
+    //the worker running the destructor is detached, and it keeps going until the queue is drained
+    while (!destroyed.load() || counter.load() < 2)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(nullptr, executor);
+}
+
+namespace
+{
+
+/**
+ * Chained-submit workload: every task submits the next link of its chain until the chain is done, the way async
+ * completion handlers kick off follow-up calls.
+ */
+class ChainedSubmitWorkload
+{
+public:
+    ChainedSubmitWorkload(Executor& executor, int chainLength) :
+        m_executor(executor), m_chainLength(chainLength), m_completedLinks(0), m_completedChains(0)
+    {}
+
+    void StartChain()
+    {
+        m_executor.Submit([this]() { RunLink(1); });
+    }
+
+    void WaitForChains(int chainCount)
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        m_done.wait(locker, [&]() { return m_completedChains == chainCount; });
+    }
+
+    int GetCompletedLinks() const { return m_completedLinks.load(); }
+
+private:
+    void RunLink(int link)
+    {
+        ++m_completedLinks;
+        if (link < m_chainLength)
+        {
+            m_executor.Submit([this, link]() { RunLink(link + 1); });
+            return;
+        }
+
+        std::lock_guard<std::mutex> locker(m_lock);
+        ++m_completedChains;
+        m_done.notify_all();
+    }
+
+    Executor& m_executor;
+    int m_chainLength;
+    std::atomic<int> m_completedLinks;
+    std::mutex m_lock;
+    std::condition_variable m_done;
+    int m_completedChains;
+};
+
+std::chrono::microseconds RunChainedSubmitWorkload(Executor& executor, int chainCount, int chainLength)
+{
+    ChainedSubmitWorkload workload(executor, chainLength);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < chainCount; ++i)
+    {
+        workload.StartChain();
+    }
+    workload.WaitForChains(chainCount);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(chainCount * chainLength, workload.GetCompletedLinks());
+    return elapsed;
+}
+
+} // anonymous namespace
+
+TEST(WorkStealingThreadExecutorTest, RunsAllSubmittedTasks)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    std::atomic<int> counter(0);
+    {
+        WorkStealingThreadExecutor executor(4);
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&counter]() { ++counter; }));
+        }
+    }
+    //destruction drains the deques before joining the workers
+    EXPECT_EQ(1000, counter.load());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(WorkStealingThreadExecutorTest, IdleWorkersStealFromBusyOnes)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Gate gate;
+    std::atomic<int> counter(0);
+    {
+        WorkStealingThreadExecutor executor(2);
+        //a single task fans out from one worker, the other worker can only get work by stealing it
+        executor.Submit([&]() {
+            for (int i = 0; i < 64; ++i)
+            {
+                executor.Submit([&counter]() { ++counter; });
+            }
+            gate.Wait();
+        });
+
+        while (counter.load() < 64)
+        {
+            std::this_thread::yield();
+        }
+        //the fanning task itself may have been stolen too
+        EXPECT_GE(executor.GetStolenTaskCount(), 64u);
+        gate.Release();
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(WorkStealingThreadExecutorTest, ChainedSubmitCompletes)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    WorkStealingThreadExecutor executor(4);
+    RunChainedSubmitWorkload(executor, 64, 100);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(WorkStealingThreadExecutorTest, ChainedSubmitsStayOnTheSubmittingWorker)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    static const int CHAIN_LENGTH = 100;
+    Gate gate;
+    std::atomic<bool> gateEntered(false);
+    std::thread::id gatedThread;
+    std::mutex linkThreadsLock;
+    Aws::Vector<std::thread::id> linkThreads;
+    std::atomic<int> completedLinks(0);
+    {
+        WorkStealingThreadExecutor executor(2);
+        ASSERT_TRUE(executor.Submit([&]() {
+            gatedThread = std::this_thread::get_id();
+            gateEntered = true;
+            gate.Wait();
+        }));
+        while (!gateEntered.load())
+        {
+            std::this_thread::yield();
+        }
+
+        //with the other worker held at the gate, nobody can steal the links, and each one is pushed on the deque of the worker running it
+        std::function<void(int)> runLink;
+        runLink = [&](int link) {
+            {
+                std::lock_guard<std::mutex> locker(linkThreadsLock);
+                linkThreads.push_back(std::this_thread::get_id());
+            }
+            ++completedLinks;
+            if (link < CHAIN_LENGTH)
+            {
+                executor.Submit([&runLink, link]() { runLink(link + 1); });
+            }
+        };
+        ASSERT_TRUE(executor.Submit([&runLink]() { runLink(1); }));
+        while (completedLinks.load() < CHAIN_LENGTH)
+        {
+            std::this_thread::yield();
+        }
+
+        ASSERT_EQ(static_cast<size_t>(CHAIN_LENGTH), linkThreads.size());
+        EXPECT_NE(gatedThread, linkThreads.front());
+        EXPECT_EQ(static_cast<size_t>(CHAIN_LENGTH), static_cast<size_t>(std::count(linkThreads.begin(), linkThreads.end(), linkThreads.front())));
+        //at most the gated task and the start of the chain were taken from the other worker's deque
+        EXPECT_LE(executor.GetStolenTaskCount(), 2u);
+        gate.Release();
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(WorkStealingThreadExecutorTest, CanBeDestroyedByItsOwnTask)
+{
+    Gate gate;
+    std::atomic<bool> destroyed(false);
+    std::atomic<int> counter(0);
+    auto executor = Aws::MakeShared<WorkStealingThreadExecutor>("WorkStealingThreadExecutorTest", 2);
+
+    ASSERT_TRUE(executor->Submit([&]() {
+        gate.Wait();
+        executor = nullptr;
+        destroyed = true;
+    }));
+    ASSERT_TRUE(executor->Submit([&counter]() { ++counter; }));
+    ASSERT_TRUE(executor->Submit([&counter]() { ++counter; }));
+    gate.Release();
+
+    while (!destroyed.load() || counter.load() < 2)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(nullptr, executor);
+}
+
+//a timing comparison rather than a check, run it with --gtest_also_run_disabled_tests
+TEST(WorkStealingThreadExecutorTest, DISABLED_ChainedSubmitBenchmark)
+{
+    static const int CHAIN_COUNT = 256;
+    static const int CHAIN_LENGTH = 1000;
+    static const int ROUNDS = 5;
+    size_t poolSize = (std::max)(std::thread::hardware_concurrency(), 2u);
+
+    //best of several rounds, each executor gets a fresh pool per round
+    std::chrono::microseconds lockedQueueTime = std::chrono::microseconds::max();
+    std::chrono::microseconds workStealingTime = std::chrono::microseconds::max();
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        {
+            //one mutex around one deque, shared by every submit and every worker
+            PooledThreadExecutor lockedQueue(poolSize, CHAIN_COUNT * 2);
+            lockedQueueTime = (std::min)(lockedQueueTime, RunChainedSubmitWorkload(lockedQueue, CHAIN_COUNT, CHAIN_LENGTH));
+        }
+        {
+            WorkStealingThreadExecutor workStealing(poolSize);
+            workStealingTime = (std::min)(workStealingTime, RunChainedSubmitWorkload(workStealing, CHAIN_COUNT, CHAIN_LENGTH));
+        }
+    }
+
+    double tasks = static_cast<double>(CHAIN_COUNT) * CHAIN_LENGTH;
+    double lockedQueueNanosPerTask = lockedQueueTime.count() * 1000.0 / tasks;
+    double workStealingNanosPerTask = workStealingTime.count() * 1000.0 / tasks;
+    std::cout << "Chained submit, " << poolSize << " workers, " << CHAIN_COUNT << " chains of " << CHAIN_LENGTH << " tasks, best of "
+              << ROUNDS << ": locked queue " << lockedQueueTime.count() / 1000 << "ms (" << lockedQueueNanosPerTask << "ns/task), "
+              << "work stealing " << workStealingTime.count() / 1000 << "ms (" << workStealingNanosPerTask << "ns/task), "
+              << "speedup " << lockedQueueNanosPerTask / workStealingNanosPerTask << "x" << std::endl;
+    RecordProperty("lockedQueueMicros", static_cast<int>(lockedQueueTime.count()));
+    RecordProperty("workStealingMicros", static_cast<int>(workStealingTime.count()));
+}
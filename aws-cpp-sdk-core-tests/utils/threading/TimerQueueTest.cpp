@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/threading/TimerQueue.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+
+/**
+ * Collects the order tasks ran in and lets a test wait for a number of them.
+ */
+class RunLog
+{
+public:
+    void Add(int value)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_values.push_back(value);
+        m_changed.notify_all();
+    }
+
+    bool WaitFor(size_t count)
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        return m_changed.wait_for(locker, std::chrono::seconds(30), [&] { return m_values.size() >= count; });
+    }
+
+    Aws::Vector<int> GetValues()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_values;
+    }
+
+private:
+    std::mutex m_lock;
+    std::condition_variable m_changed;
+    Aws::Vector<int> m_values;
+};
+
+}
+
+TEST(TimerQueueTest, TasksRunInOrderOfTheirTime)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RunLog log;
+    {
+        TimerQueue timers;
+        auto now = std::chrono::steady_clock::now();
+        timers.Schedule(now + std::chrono::milliseconds(60), [&] { log.Add(3); });
+        timers.Schedule(now + std::chrono::milliseconds(20), [&] { log.Add(1); });
+        timers.Schedule(now + std::chrono::milliseconds(20), [&] { log.Add(2); });
+        timers.Schedule(now - std::chrono::milliseconds(20), [&] { log.Add(0); });
+
+        ASSERT_TRUE(log.WaitFor(4));
+        EXPECT_EQ(0u, timers.GetPendingCount());
+    }
+
+    Aws::Vector<int> expected = { 0, 1, 2, 3 };
+    EXPECT_EQ(expected, log.GetValues());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(TimerQueueTest, CancelledTaskNeverRuns)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RunLog log;
+    {
+        TimerQueue timers;
+        auto now = std::chrono::steady_clock::now();
+        auto cancelled = timers.Schedule(now + std::chrono::milliseconds(20), [&] { log.Add(1); });
+        timers.Schedule(now + std::chrono::milliseconds(40), [&] { log.Add(2); });
+        EXPECT_NE(0u, cancelled);
+
+        EXPECT_TRUE(timers.Cancel(cancelled));
+        EXPECT_FALSE(timers.Cancel(cancelled));
+        ASSERT_TRUE(log.WaitFor(1));
+    }
+
+    Aws::Vector<int> expected = { 2 };
+    EXPECT_EQ(expected, log.GetValues());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(TimerQueueTest, CancelWaitsForTheRunningTask)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    TimerQueue timers;
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+    auto timerId = timers.Schedule(std::chrono::steady_clock::now(), [&]
+    {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    });
+
+    while (!started)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_FALSE(timers.Cancel(timerId));
+    EXPECT_TRUE(finished);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(TimerQueueTest, TaskCanRescheduleAndCancelItself)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RunLog log;
+    TimerQueue timers;
+    TimerQueue::TimerId firstId = 0;
+    std::mutex idLock;
+    {
+        std::lock_guard<std::mutex> locker(idLock);
+        firstId = timers.Schedule(std::chrono::steady_clock::now(), [&]
+        {
+            std::lock_guard<std::mutex> innerLocker(idLock);
+            EXPECT_FALSE(timers.Cancel(firstId));
+            timers.Schedule(std::chrono::steady_clock::now(), [&] { log.Add(2); });
+            log.Add(1);
+        });
+    }
+
+    ASSERT_TRUE(log.WaitFor(2));
+    Aws::Vector<int> expected = { 1, 2 };
+    EXPECT_EQ(expected, log.GetValues());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(TimerQueueTest, SharedQueueIsReusedWhileHeld)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        auto first = TimerQueue::GetShared();
+        auto second = TimerQueue::GetShared();
+        EXPECT_EQ(first.get(), second.get());
+    }
+
+    AWS_END_MEMORY_TEST
+}
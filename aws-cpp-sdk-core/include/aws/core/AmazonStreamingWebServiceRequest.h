@@ -38,7 +38,7 @@ namespace Aws
         /**
          * Initializes members to defaults
          */
-        AmazonStreamingWebServiceRequest() : m_contentType(DEFAULT_CONTENT_TYPE)
+        AmazonStreamingWebServiceRequest() : m_contentType(DEFAULT_CONTENT_TYPE), m_signBodyInChunks(false)
         {
         }
 
@@ -49,9 +49,18 @@ namespace Aws
          */
         inline std::shared_ptr<Aws::IOStream> GetBody() const override { return m_bodyStream; }
         /**
-         * Set the body stream to use for the request.
+         * Set the body stream to use for the request. Each SetBody() drops a sha256 digest set for the previous body.
          */
-        inline void SetBody(const std::shared_ptr<Aws::IOStream>& body) { m_bodyStream = body; }
+        inline void SetBody(const std::shared_ptr<Aws::IOStream>& body) { m_bodyStream = body; m_contentSha256Digest = Aws::Utils::ByteBuffer(); }
+        /**
+         * Sends buffer as the body without copying it. buffer is kept alive, and must not change, until the request is done with.
+         */
+        void SetBody(const std::shared_ptr<Aws::Utils::ByteBuffer>& buffer);
+        /**
+         * Sends the length bytes at data as the body without copying them. owner, when given, is kept alive along with the body;
+         * otherwise data has to outlive the request. It must not change until the request is done with.
+         */
+        void SetBody(const unsigned char* data, size_t length, const std::shared_ptr<const void>& owner = nullptr);
         /**
          * Gets all headers that will be needed in the request. Calls GetRequestSpecificHeaders(), which is the chance for subclasses to add
          * headers from their modeled data.
@@ -72,6 +81,24 @@ namespace Aws
           * Set the content type.
           */
         void SetContentType(const Aws::String& contentType) { m_contentType = contentType; }
+        /**
+         * Sign the body in aws-chunked chunks while it is sent, so the upload starts right away and the body is only read once.
+         * Needs a service that accepts STREAMING-AWS4-HMAC-SHA256-PAYLOAD, such as S3. Defaults to false.
+         */
+        void SetSignBodyInChunks(bool signBodyInChunks) { m_signBodyInChunks = signBodyInChunks; }
+        /**
+         * Whether the body will be signed in aws-chunked chunks while it is sent.
+         */
+        bool ShouldSignBodyInChunks() const override { return m_signBodyInChunks; }
+        /**
+         * Hands over the sha256 digest (not hex encoded) of the body, when it was already computed along with another digest such as content-md5,
+         * so the signer doesn't read the body again. It has to be the digest of the body as it will be sent, so set it after SetBody().
+         */
+        void SetContentSha256Digest(const Aws::Utils::ByteBuffer& digest) { m_contentSha256Digest = digest; }
+        /**
+         * The precomputed sha256 digest of the body, empty if none was set.
+         */
+        Aws::Utils::ByteBuffer GetContentSha256Digest() const override { return m_contentSha256Digest; }
 
     protected:
         /**
@@ -82,6 +109,8 @@ namespace Aws
     private:
         std::shared_ptr<Aws::IOStream> m_bodyStream;
         Aws::String m_contentType;
+        bool m_signBodyInChunks;
+        Aws::Utils::ByteBuffer m_contentSha256Digest;
     };
 
 } // namespace Aws
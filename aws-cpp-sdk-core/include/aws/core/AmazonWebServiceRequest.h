@@ -24,6 +24,9 @@
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/threading/CancellationToken.h>
+
+#include <chrono>
 
 namespace Aws
 {
@@ -92,6 +95,52 @@ namespace Aws
          * If this is set to true, content-md5 needs to be computed and set on the request
          */
         inline virtual bool ShouldComputeContentMd5() const { return false; }
+        /**
+         * If this is set to true, the body is signed in aws-chunked chunks while it is sent instead of being hashed before the request starts
+         */
+        inline virtual bool ShouldSignBodyInChunks() const { return false; }
+        /**
+         * The sha256 digest of the body if it was computed ahead of time, e.g. in the same pass as its content-md5. Empty if the signer has to compute it.
+         */
+        inline virtual Aws::Utils::ByteBuffer GetContentSha256Digest() const { return Aws::Utils::ByteBuffer(); }
+
+        /**
+         * Name of the operation this request is for, as reported to a MetricsPublisher. nullptr lets the client work it out from the http request.
+         */
+        inline virtual const char* GetServiceRequestName() const { return nullptr; }
+
+        /**
+         * Lets the caller give up on this request from any thread. Once the token is cancelled the request isn't sent or retried
+         * any more, a transfer in flight is aborted, and the call fails with a non retryable NETWORK_CONNECTION error named RequestCancelled.
+         */
+        inline void SetCancellationToken(const std::shared_ptr<Aws::Utils::Threading::CancellationToken>& token) { m_cancellationToken = token; }
+        /**
+         * Gets the token this request can be cancelled with, nullptr if none was set.
+         */
+        inline const std::shared_ptr<Aws::Utils::Threading::CancellationToken>& GetCancellationToken() const { return m_cancellationToken; }
+        /**
+         * Sets the time by which the whole call, retries included, has to be done. Time spent queued in an executor counts. Past it the call
+         * fails with a non retryable NETWORK_CONNECTION error named RequestDeadlineExceeded, aborting the transfer in flight if there is one.
+         */
+        inline void SetDeadline(std::chrono::steady_clock::time_point deadline) { m_deadline = deadline; }
+        /**
+         * Gets the time by which the call has to be done, time_point::max() (the default) if there is none.
+         */
+        inline std::chrono::steady_clock::time_point GetDeadline() const { return m_deadline; }
+        /**
+         * Whether the caller cancelled this request or its deadline has passed.
+         */
+        bool IsCancelledOrExpired() const;
+
+        /**
+         * Marks the request as safe to have in flight more than once at a time, e.g. a DynamoDB GetItem or Query, so a client
+         * with a HedgingPolicy may hedge it. GET and HEAD requests always are. Default false.
+         */
+        inline void SetIdempotent(bool idempotent) { m_idempotent = idempotent; }
+        /**
+         * Whether the request was marked safe to have in flight more than once at a time.
+         */
+        inline bool IsIdempotent() const { return m_idempotent; }
 
 
     private:
@@ -100,6 +149,10 @@ namespace Aws
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
+
+        std::shared_ptr<Aws::Utils::Threading::CancellationToken> m_cancellationToken;
+        std::chrono::steady_clock::time_point m_deadline;
+        bool m_idempotent;
     };
 
 } // namespace Aws
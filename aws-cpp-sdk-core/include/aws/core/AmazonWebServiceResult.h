@@ -15,6 +15,7 @@
 #include <aws/core/http/HttpTypes.h>
 #include <utility>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -22,7 +23,7 @@ namespace Aws
      * Container for web response to an AWS Request.
      */
     template <typename PAYLOAD_TYPE>
-    class AmazonWebServiceResult
+    class AmazonWebServiceResult : public AmazonWebServiceResultBase
     {
     public:
         AmazonWebServiceResult() {}
@@ -46,12 +47,14 @@ namespace Aws
         {}
 
         AmazonWebServiceResult(const AmazonWebServiceResult& result) :
+            AmazonWebServiceResultBase(result),
             m_payload(result.m_payload),
             m_responseHeaders(result.m_responseHeaders),
             m_responseCode(result.m_responseCode)
         {}
 
         AmazonWebServiceResult(AmazonWebServiceResult&& result) :
+            AmazonWebServiceResultBase(result),
             m_payload(std::move(result.m_payload)),
             m_responseHeaders(std::move(result.m_responseHeaders)),
             m_responseCode(result.m_responseCode)
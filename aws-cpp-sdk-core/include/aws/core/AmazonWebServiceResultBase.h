@@ -0,0 +1,41 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/RequestTimings.h>
+
+namespace Aws
+{
+    /**
+     * What every result of a service call carries besides its payload. AmazonWebServiceResult derives from it, and so do the
+     * result types of the generated service clients, which take it over from the AmazonWebServiceResult they are built from.
+     */
+    class AWS_CORE_API AmazonWebServiceResultBase
+    {
+    public:
+        /**
+        * Get where the time of the http request that produced this result went
+        */
+        inline const Http::RequestTimings& GetRequestTimings() const { return m_requestTimings; }
+        /**
+        * Set where the time of the http request that produced this result went
+        */
+        inline void SetRequestTimings(const Http::RequestTimings& requestTimings) { m_requestTimings = requestTimings; }
+
+    private:
+        Http::RequestTimings m_requestTimings;
+    };
+}
@@ -18,9 +18,15 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/Region.h>
+#include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <atomic>
+#include <cstdint>
+#include <ctime>
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {
@@ -48,6 +54,13 @@ namespace Aws
     namespace Client
     {
         struct ClientConfiguration;
+        class CanonicalRequestBuilder;
+
+        /**
+         * x-amz-content-sha256 value asking AWSAuthV4Signer to sign the request body in aws-chunked chunks while it is sent,
+         * rather than hashing the whole body before the request starts. The request needs a content-length header.
+         */
+        extern AWS_CORE_API const char* STREAMING_PAYLOAD_SHA256;
 
         /**
          * Auth Signer interface. Takes a generic AWS request and applies crypto tamper resistent signatures on the request.
@@ -59,6 +72,7 @@ namespace Aws
 
             /**
              * Signs the request itself (usually by adding a signature header) based on info in the request and uri.
+             * A request that was signed before is signed again from scratch, so it can be sent again.
              */
             virtual bool SignRequest(Aws::Http::HttpRequest& request) const = 0;
 
@@ -67,11 +81,23 @@ namespace Aws
              * The URI can then be used in a normal HTTP call until expiration.
              */
             virtual bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds) const = 0;
+
+            /**
+             * Name of the service requests are signed for, empty if the signer doesn't know it.
+             */
+            virtual const char* GetServiceName() const { return ""; }
         };
 
         /**
          * AWS Auth v4 Signer implementation of the AWSAuthSigner interface. More information on AWS Auth v4 Can be found here:
          * http://docs.aws.amazon.com/AmazonS3/latest/API/sig-v4-authenticating-requests.html
+         *
+         * The derived signing key only depends on the credentials, the date, the region and the service, so the signer keeps the
+         * last one it derived and reuses it until the date changes or the credentials provider hands out different credentials.
+         * Canonical requests are built in pooled CanonicalRequestBuilder buffers that are reused from one request to the next.
+         *
+         * Requests that come in with x-amz-content-sha256 set to STREAMING_PAYLOAD_SHA256 get a seed signature only; their body is
+         * signed by an AWSChunkedPayloadSigner that the http client runs it through while sending.
          */
         class AWS_CORE_API AWSAuthV4Signer : public AWSAuthSigner
         {
@@ -88,6 +114,7 @@ namespace Aws
             /**
             * Signs the request itself based on info in the request and uri.
             * Uses AWS Auth V4 signing method with SHA256 HMAC algorithm.
+            * The payload hash is kept on the request, so signing it again for a retry only refreshes the date and signature.
             */
             bool SignRequest(Aws::Http::HttpRequest& request) const override;
 
@@ -99,16 +126,51 @@ namespace Aws
             */
             bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds = 0) const override;
 
+            const char* GetServiceName() const override { return m_serviceName.c_str(); }
+
+        protected:
+            /**
+            * Time a signature is dated with. The date header and the credential scope are both formatted from a single call.
+            */
+            virtual std::time_t GetSigningTime() const;
+
         private:
+            /**
+             * A derived signing key together with the inputs it was derived from. Region and service are fixed per signer.
+             * Instances are immutable once published, and only freed once no reader can still hold them, so readers never lock.
+             */
+            struct SigningKey
+            {
+                Aws::String accessKeyId;
+                Aws::String secretKey;
+                Aws::String simpleDate;
+                Aws::Utils::ByteBuffer key;
+            };
+
             Aws::String GenerateSignature(const Aws::Auth::AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate) const;
+            Aws::Utils::ByteBuffer GetSigningKey(const Aws::Auth::AWSCredentials& credentials, const Aws::String& simpleDate) const;
+            void PublishSigningKey(SigningKey* signingKey) const;
+            Aws::Utils::ByteBuffer DeriveSigningKey(const Aws::Auth::AWSCredentials& credentials, const Aws::String& simpleDate) const;
             Aws::String ComputePayloadHash(Aws::Http::HttpRequest&) const;
-            Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& canonicalRequestHash) const;
+            uint64_t PrepareChunkedPayloadHeaders(Aws::Http::HttpRequest& request) const;
+            Aws::String HashCanonicalRequest(const Aws::String& canonicalRequest) const;
+            Aws::UniquePtr<CanonicalRequestBuilder> AcquireCanonicalRequestBuilder() const;
+            void ReleaseCanonicalRequestBuilder(Aws::UniquePtr<CanonicalRequestBuilder>&& builder) const;
 
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
             Aws::String m_serviceName;
             Aws::String m_region;
             Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
             Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+            mutable std::atomic<SigningKey*> m_cachedSigningKey;
+            //readers of m_cachedSigningKey, raised before the pointer is loaded and dropped once the key is copied out
+            mutable std::atomic<size_t> m_signingKeyReaders;
+            //keys replaced while someone was reading, freed by the next replacement that finds no reader or with the signer
+            mutable std::mutex m_retiredSigningKeysMutex;
+            mutable Aws::Vector<SigningKey*> m_retiredSigningKeys;
+            //grows to the number of threads signing at the same time, builders are only freed with the signer
+            mutable std::mutex m_builderPoolMutex;
+            mutable Aws::Vector<Aws::UniquePtr<CanonicalRequestBuilder>> m_builderPool;
         };
 
     } // namespace Client
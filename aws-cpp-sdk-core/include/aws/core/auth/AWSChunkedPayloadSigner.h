@@ -0,0 +1,93 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/http/ContentBodyEncoder.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            class Sha256;
+            class Sha256HMAC;
+        } // namespace Crypto
+    } // namespace Utils
+
+    namespace Client
+    {
+        /**
+         * Signs a request body in aws-chunked chunks while the http client sends it, for requests whose seed signature was computed with
+         * the STREAMING-AWS4-HMAC-SHA256-PAYLOAD payload hash. Each chunk is framed as
+         * hex(size);chunk-signature=signature\r\n data \r\n, where the signature chains off the previous one, and the body ends with an empty chunk.
+         * More information can be found here: http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+         *
+         * The body is read exactly once, one chunk at a time, so nothing has to be hashed before the upload starts.
+         */
+        class AWS_CORE_API AWSChunkedPayloadSigner : public Aws::Http::ContentBodyEncoder
+        {
+        public:
+            /**
+             * Size of every chunk but the last one. S3 requires at least 8 KB.
+             */
+            static const size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+            /**
+             * signingKey, dateValue and scope are the ones used for the seed signature, which becomes the previous signature of the first chunk.
+             * decodedContentLength is the number of body bytes that will be read and signed.
+             */
+            AWSChunkedPayloadSigner(const Aws::Utils::ByteBuffer& signingKey, const Aws::String& dateValue, const Aws::String& scope,
+                const Aws::String& seedSignature, uint64_t decodedContentLength, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            virtual ~AWSChunkedPayloadSigner();
+
+            size_t Encode(Aws::IStream& body, char* buffer, size_t length, size_t& bodyBytesRead) override;
+
+            /**
+             * Length of the aws-chunked encoding of decodedContentLength bytes, which is what goes in the content-length header.
+             */
+            static uint64_t CalculateEncodedContentLength(uint64_t decodedContentLength, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+        private:
+            AWSChunkedPayloadSigner(const AWSChunkedPayloadSigner&) = delete;
+            AWSChunkedPayloadSigner& operator=(const AWSChunkedPayloadSigner&) = delete;
+
+            bool EncodeNextChunk(Aws::IStream& body, size_t& bodyBytesRead);
+            bool SignChunk();
+
+            Aws::Utils::ByteBuffer m_signingKey;
+            Aws::String m_stringToSignPrefix;
+            Aws::String m_previousSignature;
+            uint64_t m_remainingBodyBytes;
+            size_t m_chunkSize;
+            Aws::String m_chunkData;
+            Aws::String m_encodedChunk;
+            size_t m_encodedChunkPosition;
+            bool m_finalChunkEncoded;
+            Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
+            Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -22,6 +22,7 @@
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -31,6 +32,13 @@ namespace Aws
     {
         class EC2MetadataClient; //forward declaration;
     } // namespace Internal
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class TimerQueue;
+        } // namespace Threading
+    } // namespace Utils
     namespace Auth
     {
         static int REFRESH_THRESHOLD = 1000 * 60 * 15;
@@ -45,7 +53,8 @@ namespace Aws
              * Initializes object with accessKeyId, secretKey, and sessionToken. Session token defaults to empty.
              */
             AWSCredentials(const Aws::String& accessKeyId, const Aws::String& secretKey, const Aws::String& sessionToken = "") :
-                m_accessKeyId(accessKeyId), m_secretKey(secretKey), m_sessionToken(sessionToken)
+                m_accessKeyId(accessKeyId), m_secretKey(secretKey), m_sessionToken(sessionToken),
+                m_expiration((std::chrono::system_clock::time_point::max)())
             {
             }
 
@@ -121,10 +130,27 @@ namespace Aws
                 m_sessionToken = sessionToken;
             }
 
+            /**
+             * Gets the time the credentials stop working, the maximum time point if they don't expire
+             */
+            inline std::chrono::system_clock::time_point GetExpiration() const
+            {
+                return m_expiration;
+            }
+
+            /**
+             * Sets the time the credentials stop working
+             */
+            inline void SetExpiration(std::chrono::system_clock::time_point expiration)
+            {
+                m_expiration = expiration;
+            }
+
         private:
             Aws::String m_accessKeyId;
             Aws::String m_secretKey;
             Aws::String m_sessionToken;
+            std::chrono::system_clock::time_point m_expiration;
         };
 
         /**
@@ -160,6 +186,63 @@ namespace Aws
             long long m_lastLoadedMs;
         };
 
+        /**
+         * Base class for providers whose credentials are expensive to load, e.g. from a file or over http.
+         * The latest credentials are kept as an immutable snapshot that GetAWSCredentials() reads without taking a lock, and are reloaded in
+         * the background every refreshRateMs, or earlier, REFRESH_BEFORE_EXPIRATION_MS ahead of the snapshot's expiration. Only the first
+         * GetAWSCredentials() call waits for a load; after that signing threads never block on a refresh.
+         *
+         * The reloads of all providers run one after the other on the process wide TimerQueue::GetShared() thread, rather than on a thread
+         * per provider.
+         */
+        class AWS_CORE_API BackgroundRefreshingAWSCredentialsProvider : public AWSCredentialsProvider
+        {
+        public:
+            /**
+             * How long before the credentials expire they are reloaded.
+             */
+            static const long REFRESH_BEFORE_EXPIRATION_MS = 1000 * 60 * 5;
+
+            /**
+             * Initializes with refreshRateMs as the longest interval between background reloads.
+             */
+            BackgroundRefreshingAWSCredentialsProvider(long refreshRateMs);
+
+            virtual ~BackgroundRefreshingAWSCredentialsProvider();
+
+            /**
+             * Returns the current snapshot, loading it first if this is the first call.
+             */
+            AWSCredentials GetAWSCredentials() override;
+
+        protected:
+            /**
+             * Loads a fresh set of credentials into credentials, with their expiration if they have one. Called on the first
+             * GetAWSCredentials() call and then from the timer thread. Return false if they couldn't be loaded; the background refresh
+             * then keeps serving the previous snapshot.
+             */
+            virtual bool LoadCredentials(AWSCredentials& credentials) = 0;
+
+            /**
+             * Stops the background refresh, waiting for a reload that is running. Derived classes must call this from their destructor,
+             * as the reload calls into LoadCredentials().
+             */
+            void StopRefreshing();
+
+        private:
+            //must be called with m_refreshMutex held
+            void ScheduleRefresh(const AWSCredentials& current);
+            void Refresh();
+
+            long m_loadFrequencyMs;
+            std::shared_ptr<const AWSCredentials> m_credentials;
+            std::mutex m_initialLoadMutex;
+            std::mutex m_refreshMutex;
+            bool m_stopRefreshing;
+            std::shared_ptr<Aws::Utils::Threading::TimerQueue> m_refreshTimers;
+            unsigned long long m_refreshTimerId;
+        };
+
         /**
          * Simply a provider that always returns empty credentials. This is useful for a client that needs to make unsigned
          * calls.
@@ -230,7 +313,7 @@ namespace Aws
         * to ~/.aws/credentials and default. Optionally a user can specify the profile and it will override the environment variable
         * and defaults. To alter the file this pulls from, then the user should alter the AWS_SHARED_CREDENTIALS_FILE variable.
         */
-        class AWS_CORE_API ProfileConfigFileAWSCredentialsProvider : public AWSCredentialsProvider
+        class AWS_CORE_API ProfileConfigFileAWSCredentialsProvider : public BackgroundRefreshingAWSCredentialsProvider
         {
         public:
 
@@ -245,10 +328,7 @@ namespace Aws
             */
             ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs = REFRESH_THRESHOLD);
 
-            /**
-            * Retrieves the credentials if found, otherwise returns empty credential set.
-            */
-            AWSCredentials GetAWSCredentials() override;
+            virtual ~ProfileConfigFileAWSCredentialsProvider();
 
             /**
              * Returns the fullpath of the calculated profile file
@@ -265,26 +345,24 @@ namespace Aws
              */
             static Aws::String GetProfileDirectory();
 
-        private:
-
+        protected:
             /**
-            * Checks to see if the refresh interval has expired and reparses the file if it has.
+            * Reparses the file. Credentials that aren't found come back empty.
             */
-            void RefreshIfExpired();
+            bool LoadCredentials(AWSCredentials& credentials) override;
+
+        private:
             static Aws::Map<Aws::String, Aws::String> ParseProfileConfigFile(const Aws::String& filename);
 
             Aws::String m_fileName;
             Aws::String m_profileToUse;
-            std::shared_ptr<AWSCredentials> m_credentials;
-            mutable std::mutex m_reloadMutex;
-            long m_loadFrequencyMs;
         };
 
         /**
         * Credentials provider implementation that loads credentials from the Amazon
         * EC2 Instance Metadata Service.
         */
-        class AWS_CORE_API InstanceProfileCredentialsProvider : public AWSCredentialsProvider
+        class AWS_CORE_API InstanceProfileCredentialsProvider : public BackgroundRefreshingAWSCredentialsProvider
         {
         public:
             /**
@@ -299,18 +377,16 @@ namespace Aws
              */
             InstanceProfileCredentialsProvider(const std::shared_ptr<Internal::EC2MetadataClient>&, long refreshRateMs = REFRESH_THRESHOLD);
 
+            virtual ~InstanceProfileCredentialsProvider();
+
+        protected:
             /**
-            * Retrieves the credentials if found, otherwise returns empty credential set.
+            * Pulls credentials from the metadata service. Fails if the service can't be reached or returns something unparsable.
             */
-            AWSCredentials GetAWSCredentials() override;
+            bool LoadCredentials(AWSCredentials& credentials) override;
 
         private:
-            void RefreshIfExpired();
-
             std::shared_ptr<Internal::EC2MetadataClient> m_metadataClient;
-            std::shared_ptr<AWSCredentials> m_credentials;
-            long m_loadFrequencyMs;
-            mutable std::mutex m_reloadMutex;
         };
     } // namespace Auth
 } // namespace Aws
@@ -0,0 +1,92 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpRequest;
+    } // namespace Http
+
+    namespace Client
+    {
+        /**
+         * Builds the AWS Auth v4 canonical request, signed headers list and string to sign into buffers it owns.
+         * The buffers are cleared but keep their capacity between builds, so once a builder has seen a request of a
+         * given size it can build the same shape of request again without touching the heap.
+         *
+         * A builder is not thread safe; AWSAuthV4Signer keeps a pool of them and hands one to each signing call.
+         */
+        class AWS_CORE_API CanonicalRequestBuilder
+        {
+        public:
+            CanonicalRequestBuilder() = default;
+
+            /**
+             * Builds the canonical request for request, signing every header it has.
+             * The query string must already be canonicalized (HttpRequest::CanonicalizeRequest()).
+             */
+            const Aws::String& BuildCanonicalRequest(const Aws::Http::HttpRequest& request, const Aws::String& payloadHash);
+
+            /**
+             * Builds the canonical request for request, signing only headerName. Presigned urls only sign the host header.
+             * The query string must already be canonicalized (HttpRequest::CanonicalizeRequest()).
+             */
+            const Aws::String& BuildCanonicalRequest(const Aws::Http::HttpRequest& request, const char* headerName,
+                const Aws::String& headerValue, const Aws::String& payloadHash);
+
+            /**
+             * Builds the string to sign for the hex encoded hash of the last canonical request.
+             */
+            const Aws::String& BuildStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& region,
+                const Aws::String& serviceName, const Aws::String& canonicalRequestHash);
+
+            /**
+             * The canonical request produced by the last call to BuildCanonicalRequest.
+             */
+            inline const Aws::String& GetCanonicalRequest() const { return m_canonicalRequest; }
+
+            /**
+             * The semi-colon separated signed headers list produced by the last call to BuildCanonicalRequest.
+             */
+            inline const Aws::String& GetSignedHeaders() const { return m_signedHeaders; }
+
+            /**
+             * The string to sign produced by the last call to BuildStringToSign.
+             */
+            inline const Aws::String& GetStringToSign() const { return m_stringToSign; }
+
+        private:
+            CanonicalRequestBuilder(const CanonicalRequestBuilder&) = delete;
+            CanonicalRequestBuilder& operator=(const CanonicalRequestBuilder&) = delete;
+
+            void AppendMethodPathAndQuery(const Aws::Http::HttpRequest& request);
+            void AppendEncodedPath(const Aws::String& path);
+            void AppendHeader(const Aws::String& name, const Aws::String& value);
+            void AppendSignedHeadersAndPayloadHash(const Aws::String& payloadHash);
+
+            Aws::String m_canonicalRequest;
+            Aws::String m_signedHeaders;
+            Aws::String m_stringToSign;
+        };
+
+    } // namespace Client
+} // namespace Aws
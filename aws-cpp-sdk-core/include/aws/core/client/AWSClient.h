@@ -20,8 +20,10 @@
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/AmazonWebServiceResult.h>
+#include <functional>
 #include <memory>
 #include <atomic>
+#include <chrono>
 
 namespace Aws
 {
@@ -45,10 +47,11 @@ namespace Aws
             class RateLimiterInterface;
         } // namespace RateLimits
 
-        namespace Crypto
+        namespace Threading
         {
-            class MD5;
-        } // namespace Crypto
+            class Executor;
+            class TimerQueue;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -74,8 +77,15 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class MetricsPublisher;
+        class AdaptiveRateLimiter;
+        class HedgingPolicy;
+        struct RequestMetrics;
+        struct HedgedRequestState;
+        struct RequestAttempts;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
+        typedef std::function<void(HttpResponseOutcome&&)> HttpResponseOutcomeReceivedHandler;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
 
         /**
@@ -116,6 +126,14 @@ namespace Aws
              */
             void EnableRequestProcessing();
 
+            /**
+             * Opens up to connectionCount connections to endpoint (e.g. https://dynamodb.us-east-1.amazonaws.com) in parallel and
+             * keeps them open for the requests that follow, so the first requests after startup don't pay for dns, tcp and tls setup.
+             * Blocks until the connections are up and returns how many are. Capped at maxConnections, and returns 0 for http clients
+             * that don't pool connections.
+             */
+            size_t WarmUpConnections(const Aws::String& endpoint, size_t connectionCount);
+
         protected:
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
@@ -132,18 +150,24 @@ namespace Aws
             HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod) const;
 
             /**
-             * Constructs and Http Request from the uri and AmazonWebServiceRequest object. Signs the request, sends it accross the wire
-             * then reports the http response.
+             * Same as AttemptExhaustively, but returns right away and calls handler with the outcome on the client's executor once the
+             * request is done. With an http client that supports asynchronous requests, e.g. CurlMultiHttpClient, no thread is held
+             * while the request is in flight or waiting to be retried; the executor only signs retries and runs the handler. Other
+             * http clients would block, for them the whole request is sent from the executor. These requests aren't hedged, and a
+             * cancellation only takes effect once a retry delay is up.
              */
-            HttpResponseOutcome AttemptOneRequest(const Aws::String& uri,
-                const Aws::AmazonWebServiceRequest& request,
-                Http::HttpMethod httpMethod) const;
+            void AttemptExhaustivelyAsync(const Aws::String& uri, const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod httpMethod, const HttpResponseOutcomeReceivedHandler& handler) const;
 
             /**
-            * Constructs and Http Request from the uri and AmazonWebServiceRequest object. Signs the request, sends it accross the wire
-            * then reports the http response. This method is for payloadless requests e.g. GET, DELETE, HEAD
-            */
-            HttpResponseOutcome AttemptOneRequest(const Aws::String& uri, Http::HttpMethod httpMethod) const;
+             * Signs httpRequest, sends it accross the wire then reports the http response. AttemptExhaustively builds the http request
+             * once, so a retry only signs it again. request is the request it was built from, nullptr for payloadless requests.
+             * If metrics isn't nullptr, the attempt is added to it. If the transfer broke off and the http client handed back what
+             * arrived of the response, it is put in incompleteResponse, if that isn't nullptr.
+             */
+            HttpResponseOutcome AttemptOneRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest,
+                const Aws::AmazonWebServiceRequest* request, RequestMetrics* metrics = nullptr,
+                std::shared_ptr<Aws::Http::HttpResponse>* incompleteResponse = nullptr) const;
 
             /**
              * This is used for structureless response payloads (file streams, binary data etc...). It calls AttemptExhaustively, but upon
@@ -177,6 +201,38 @@ namespace Aws
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
                                          const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5 = false) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
+            std::shared_ptr<Aws::Http::HttpRequest> BuildRequestForAttempts(const Aws::String& uri, const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod method) const;
+            HttpResponseOutcome AttemptUntilDone(RequestAttempts& attempts) const;
+            //what AttemptUntilDone and the async path do around each attempt. PrepareAttempt returns false if the request was given up on,
+            //CollectAttempt folds an attempt into the request's outcome, DecideOnRetry returns how long to wait before the next attempt,
+            //negative when the outcome is final.
+            bool PrepareAttempt(RequestAttempts& attempts) const;
+            HttpResponseOutcome CollectAttempt(RequestAttempts& attempts, HttpResponseOutcome&& outcome) const;
+            long DecideOnRetry(RequestAttempts& attempts, const HttpResponseOutcome& outcome) const;
+            HttpResponseOutcome AbandonAttempts(RequestAttempts& attempts) const;
+            bool SignAttempt(Aws::Http::HttpRequest& httpRequest, RequestMetrics* metrics) const;
+            HttpResponseOutcome EvaluateAttempt(const Aws::Http::HttpRequest& httpRequest, const Aws::AmazonWebServiceRequest* request,
+                RequestMetrics* metrics, const std::shared_ptr<Aws::Http::HttpResponse>& httpResponse,
+                std::shared_ptr<Aws::Http::HttpResponse>* incompleteResponse) const;
+            void SendAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const;
+            void SendPreparedAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const;
+            void ContinueAfterAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts, HttpResponseOutcome&& attemptOutcome) const;
+            //runs task on the executor once delay is up, or right away on this thread if the executor turns it down
+            void RunAfterDelay(std::chrono::milliseconds delay, std::function<void()>&& task) const;
+            void HandOverAsyncOutcome(const HttpResponseOutcomeReceivedHandler& handler, HttpResponseOutcome&& outcome) const;
+            void PublishMetrics(RequestMetrics& metrics, const HttpResponseOutcome& outcome, std::chrono::steady_clock::time_point start) const;
+            //sleepTime, cut short by the request's deadline
+            std::chrono::milliseconds GetDelayForRequest(const Aws::Http::HttpRequest& httpRequest, std::chrono::milliseconds sleepTime) const;
+            //sleeps sleepTime, cut short by the request's deadline and cancellation
+            void SleepForRequest(const Aws::Http::HttpRequest& httpRequest, std::chrono::milliseconds sleepTime) const;
+            //waits for the request rate limiter, false if the request was cancelled or ran past its deadline meanwhile
+            bool WaitForSendToken(const Aws::Http::HttpRequest& httpRequest) const;
+            void UpdateSendRate(const HttpResponseOutcome& outcome) const;
+            bool IsHedgeable(const Aws::Http::HttpRequest& httpRequest, const Aws::AmazonWebServiceRequest* request) const;
+            std::shared_ptr<Aws::Http::HttpResponse> MakeHedgeableRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;
+            //runs on m_hedgeTimers at the hedge delay, hands a copy of the request to the executor if the primary is still waiting for an answer
+            void SendHedge(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const std::shared_ptr<HedgedRequestState>& state) const;
             void InitializeGlobalStatics();
             void CleanupGlobalStatics();
 
@@ -185,11 +241,18 @@ namespace Aws
             std::shared_ptr<Aws::Client::AWSAuthSigner> m_signer;
             std::shared_ptr<AWSErrorMarshaller> m_errorMarshaller;
             std::shared_ptr<RetryStrategy> m_retryStrategy;
+            std::shared_ptr<MetricsPublisher> m_metricsPublisher;
+            std::shared_ptr<AdaptiveRateLimiter> m_requestRateLimiter;
+            std::shared_ptr<HedgingPolicy> m_hedgingPolicy;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+            //only there with a hedging policy, sends the hedges of requests slow to answer
+            std::shared_ptr<Aws::Utils::Threading::TimerQueue> m_hedgeTimers;
+            //the process wide one, waits out the retry delays of asynchronous requests
+            std::shared_ptr<Aws::Utils::Threading::TimerQueue> m_retryTimers;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_writeRateLimiter;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_readRateLimiter;
             Aws::String m_userAgent;
             const char* m_hostHeaderOverride;
-            Aws::UniquePtr<Aws::Utils::Crypto::MD5> m_hash;
             static std::atomic<int> s_refCount;
         };
 
@@ -240,6 +303,18 @@ namespace Aws
             JsonOutcome MakeRequest(const Aws::String& uri,
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
 
+            /**
+             * Same as MakeRequest, but returns right away and calls handler with the Json document or the error on the client's
+             * executor once the request is done. See AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const std::function<void(JsonOutcome&&)>& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+
+        private:
+            static JsonOutcome BuildJsonOutcome(HttpResponseOutcome&& httpOutcome);
+
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
@@ -286,6 +361,18 @@ namespace Aws
              */
             XmlOutcome MakeRequest(const Aws::String& uri,
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+
+            /**
+             * Same as MakeRequest, but returns right away and calls handler with the xml document or the error on the client's
+             * executor once the request is done. See AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const std::function<void(XmlOutcome&&)>& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+
+        private:
+            static XmlOutcome BuildXmlOutcome(HttpResponseOutcome&& httpOutcome);
         };
 
     } // namespace Client
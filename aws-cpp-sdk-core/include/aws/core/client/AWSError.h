@@ -16,6 +16,7 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/RequestTimings.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -48,7 +49,8 @@ namespace Aws
 
             //by policy we enforce all clients to contain a CoreErrors alignment for their Errors.
             AWSError(const AWSError<CoreErrors>& rhs) :
-                m_errorType(static_cast<ERROR_TYPE>(rhs.GetErrorType())), m_exceptionName(rhs.GetExceptionName()), m_message(rhs.GetMessage()), m_isRetryable(rhs.ShouldRetry())
+                m_errorType(static_cast<ERROR_TYPE>(rhs.GetErrorType())), m_exceptionName(rhs.GetExceptionName()), m_message(rhs.GetMessage()), m_isRetryable(rhs.ShouldRetry()),
+                m_requestTimings(rhs.GetRequestTimings())
             {}
 
             /**
@@ -75,12 +77,21 @@ namespace Aws
              * returns whether or not this error is eligible for retry.
              */
             inline bool ShouldRetry() const { return m_isRetryable; }
+            /**
+             * Gets where the time of the http request that failed went. All zero if no response was received.
+             */
+            inline const Http::RequestTimings& GetRequestTimings() const { return m_requestTimings; }
+            /**
+             * Sets where the time of the http request that failed went.
+             */
+            inline void SetRequestTimings(const Http::RequestTimings& requestTimings) { m_requestTimings = requestTimings; }
 
         private:
             ERROR_TYPE m_errorType;
             Aws::String m_exceptionName;
             Aws::String m_message;
             bool m_isRetryable;
+            Http::RequestTimings m_requestTimings;
         };
 
     } // namespace Client
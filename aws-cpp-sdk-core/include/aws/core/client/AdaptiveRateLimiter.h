@@ -0,0 +1,91 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSFunction.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Limits the rate at which a client sends requests to what the service is willing to take. It lets everything through until the
+         * service throttles a request, then caps the send rate below the rate that got throttled and probes back up with a cubic curve:
+         * quickly back to the old rate, slowly around it, and quickly again beyond it while nothing is throttled, much like TCP CUBIC.
+         * Clients sharing one limiter share the rate. Thread safe.
+         */
+        class AWS_CORE_API AdaptiveRateLimiter
+        {
+        public:
+            using TimePointType = std::chrono::steady_clock::time_point;
+            using TimeFunctionType = std::function<TimePointType()>;
+
+            AdaptiveRateLimiter(TimeFunctionType timeFunction = AWS_BUILD_FUNCTION(std::chrono::steady_clock::now));
+
+            /**
+             * Takes the token for one request and returns how long to wait before sending it. Always zero until the first throttle.
+             */
+            std::chrono::milliseconds AcquireSendToken();
+            /**
+             * Adjusts the send rate after a response: down if the service throttled it, up otherwise.
+             */
+            void UpdateSendRate(bool throttled);
+
+            /**
+             * Whether the service has throttled us yet, and the limiter is limiting.
+             */
+            bool IsEnabled() const;
+            /**
+             * Requests per second the limiter lets through.
+             */
+            double GetFillRate() const;
+            /**
+             * Requests per second actually sent, smoothed over half second buckets.
+             */
+            double GetMeasuredSendRate() const;
+
+        private:
+            double GetElapsedSeconds() const;
+            void Refill(double now);
+            void SetFillRate(double rate, double now);
+            void UpdateMeasuredSendRate(double now);
+
+            TimeFunctionType m_timeFunction;
+            TimePointType m_start;
+
+            mutable std::mutex m_rateMutex;
+            bool m_enabled;
+            //token bucket the requests are paid from; the capacity goes negative while requests queue up behind it
+            double m_fillRate;
+            double m_maxCapacity;
+            double m_currentCapacity;
+            double m_lastRefill;
+            //send rate measurement
+            double m_measuredSendRate;
+            double m_lastSendRateBucket;
+            unsigned m_requestCount;
+            //cubic state: the rate that got throttled, when, and how long the curve takes to climb back to it
+            double m_lastMaxRate;
+            double m_lastThrottleTime;
+            double m_timeWindow;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -40,6 +40,9 @@ namespace Aws
     namespace Client
     {
         class RetryStrategy; // forward declare
+        class MetricsPublisher;
+        class AdaptiveRateLimiter;
+        class HedgingPolicy;
 
         /**
           * This mutable structure is used to configure any of the AWS clients.
@@ -77,10 +80,48 @@ namespace Aws
              * Socket connect timeout. Default 1000 ms. Unless you are very far away from your the data center you are talking to. 1000ms is more than sufficient.
              */
             long connectTimeoutMs;
+            /**
+             * Transfers slower than this many bytes per second for lowSpeedTimeMs are aborted as stalled and retried, ranged reads from where
+             * they stopped. Lets a large download run under a generous requestTimeoutMs (0 is none) without a silently stalled connection
+             * hanging for all of it. Curl client only, at a resolution of seconds. Default 0, off.
+             */
+            unsigned long lowSpeedLimit;
+            /**
+             * How long a transfer may stay below lowSpeedLimit before it is aborted. Default 10000 ms.
+             */
+            long lowSpeedTimeMs;
+            /**
+             * Pooled connections left idle longer than this are closed instead of reused, since the other end has likely dropped them already.
+             * Every time a connection is taken from or returned to the pool, idle ones to all endpoints are checked. A timer on the shared
+             * TimerQueue thread also closes them once they expire, so a client that stops making calls doesn't keep sockets open.
+             * Default 20000 ms. 0 keeps idle connections around indefinitely.
+             */
+            unsigned long connectionIdleTimeoutMs;
+            /**
+             * The connections of a client always share their dns cache and tls sessions. If set to true, all clients that set it share them
+             * as well, so a new client's first connections to an endpoint skip the dns lookup and full tls handshake. Curl client only. Default false.
+             */
+            bool shareConnectionCachesAcrossClients;
             /**
              * Strategy to use in case of failed requests. Default is DefaultRetryStrategy (e.g. exponential backoff)
              */
             std::shared_ptr<RetryStrategy> retryStrategy;
+            /**
+             * Slows the request rate down when the service throttles requests and lets it grow back as they succeed. Default none,
+             * requests are sent as fast as they are made. Share one between clients talking to the same service to share the rate.
+             */
+            std::shared_ptr<AdaptiveRateLimiter> requestRateLimiter;
+            /**
+             * Receives latency, retry, size and signing metrics for every call the client makes. Default none, nothing is measured.
+             * HistogramMetricsPublisher aggregates them per operation in memory.
+             */
+            std::shared_ptr<MetricsPublisher> metricsPublisher;
+            /**
+             * Sends a second copy of an idempotent request that is slow to respond and takes whichever answers first. Default none,
+             * nothing is hedged. The request itself is still sent from the calling thread into the caller's stream; only a hedge
+             * runs on the executor below, into a stream of its own whose body is copied over if it answers first.
+             */
+            std::shared_ptr<HedgingPolicy> hedgingPolicy;
             /**
              * override the http endpoint used to talk to a service. Use this in conjunction with authenticationRegion.
              */
@@ -103,6 +144,7 @@ namespace Aws
             Aws::String proxyPassword;
             /**
             * Threading Executor implementation. Default uses std::thread::detach()
+            * Use Aws::Utils::Threading::PooledThreadExecutor to bound the number of threads and queued async calls.
             */
             std::shared_ptr<Aws::Utils::Threading::Executor> executor;
             /**
@@ -125,6 +167,8 @@ namespace Aws
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> readRateLimiter;
             /**
              * Override the http implementation the default factory returns.
+             * CURL_MULTI_CLIENT drives all transfers of a client from a single curl_multi event loop thread instead of
+             * blocking one thread per request; it is only available when the curl client is built.
              */
             Aws::Http::TransferLibType httpLibOverride;
             /**
@@ -58,6 +58,11 @@ namespace Aws
              * Finds a CoreErrors member if possible. Otherwise, returns UNKNOWN
              */
             AWS_CORE_API AWSError<CoreErrors> GetErrorForName(const char* errorName);
+            /**
+             * Whether the service rejected the request because the caller is sending too fast, either with a core THROTTLING error
+             * or with one of the service specific throttling exceptions such as ProvisionedThroughputExceededException or SlowDown.
+             */
+            AWS_CORE_API bool IsThrottlingError(const AWSError<CoreErrors>& error);
         } // namespace CoreErrorsMapper
     } // namespace Client
 } // namespace Aws
@@ -0,0 +1,96 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/LatencyHistogram.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Tells a client when to hedge an idempotent request: if no response byte has arrived once the percentile of first byte latencies
+         * seen so far has passed, a copy goes out on another connection, the first success is taken and the other attempt is cancelled.
+         * That cuts off the tail caused by the occasional slow connection or slow server. Every hedged request earns a fraction of a hedge,
+         * so hedges add at most budgetPercent extra requests, and nothing is hedged until minSamples latencies are known.
+         * Share one between clients making the same kind of request. Thread safe.
+         */
+        class AWS_CORE_API HedgingPolicy
+        {
+        public:
+            HedgingPolicy(double percentile = 95.0, double budgetPercent = 5.0, std::chrono::milliseconds minHedgeDelay = std::chrono::milliseconds(10),
+                unsigned minSamples = 100);
+
+            /**
+             * Adds the time to first byte of a request the policy applies to.
+             */
+            void RecordFirstByteLatency(std::chrono::microseconds latency);
+            /**
+             * Whether enough latencies are known to tell a slow request from a normal one.
+             */
+            bool HasEnoughSamples() const;
+            /**
+             * How long to wait for the first byte before hedging: the percentile of the latencies seen, at least minHedgeDelay.
+             */
+            std::chrono::milliseconds GetHedgeDelay() const;
+
+            /**
+             * Credits the budget for a request that may be hedged.
+             */
+            void OnHedgeableRequest();
+            /**
+             * Takes a hedge out of the budget and counts it as fired. False if the budget is used up.
+             */
+            bool TryAcquireHedge();
+            /**
+             * Counts a hedge whose response was the one taken.
+             */
+            void OnHedgeWon();
+
+            /**
+             * Hedges sent so far.
+             */
+            inline uint64_t GetHedgesFired() const { return m_hedgesFired.load(); }
+            /**
+             * Hedges that came back first with a successful response.
+             */
+            inline uint64_t GetHedgesWon() const { return m_hedgesWon.load(); }
+
+        private:
+            HedgingPolicy(const HedgingPolicy&) = delete;
+            HedgingPolicy& operator=(const HedgingPolicy&) = delete;
+
+            double m_percentile;
+            double m_budgetPerRequest;
+            std::chrono::milliseconds m_minHedgeDelay;
+            unsigned m_minSamples;
+            Aws::Utils::LatencyHistogram m_firstByteLatencies;
+
+            std::mutex m_budgetMutex;
+            //in hedges, capped so a quiet stretch doesn't save up for a burst of them
+            double m_budget;
+
+            std::atomic<uint64_t> m_hedgesFired;
+            std::atomic<uint64_t> m_hedgesWon;
+        };
+
+    } // namespace Client
+} // namespace Aws
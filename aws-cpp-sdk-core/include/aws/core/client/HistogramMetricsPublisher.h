@@ -0,0 +1,70 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/MetricsPublisher.h>
+#include <aws/core/utils/LatencyHistogram.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Running totals and latency histograms (in microseconds) for one operation of one service.
+         */
+        struct AWS_CORE_API OperationMetrics
+        {
+            OperationMetrics();
+
+            Aws::Utils::LatencyHistogram endToEndLatency;
+            Aws::Utils::LatencyHistogram firstByteLatency;
+            Aws::Utils::LatencyHistogram signingTime;
+            Aws::Utils::LatencyHistogram serializationTime;
+            std::atomic<uint64_t> callCount;
+            std::atomic<uint64_t> failedCallCount;
+            std::atomic<uint64_t> retryCount;
+            std::atomic<uint64_t> bytesSent;
+            std::atomic<uint64_t> bytesReceived;
+        };
+
+        /**
+         * MetricsPublisher that aggregates calls per service and operation in memory, for callers to read and report themselves.
+         * Recording takes a lock only to look up the operation, the histograms and counters themselves are lock free.
+         */
+        class AWS_CORE_API HistogramMetricsPublisher : public MetricsPublisher
+        {
+        public:
+            void PublishRequestMetrics(const RequestMetrics& metrics) override;
+
+            /**
+             * Metrics for serviceName and operationName, nullptr if no such call has been published yet.
+             * The returned object keeps updating as calls are published.
+             */
+            std::shared_ptr<const OperationMetrics> GetOperationMetrics(const Aws::String& serviceName, const Aws::String& operationName) const;
+
+        private:
+            mutable std::mutex m_operationsMutex;
+            Aws::Map<Aws::String, std::shared_ptr<OperationMetrics>> m_operations;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/client/RetryTokenBucket.h>
+
+#include <memory>
+#include <mutex>
+#include <random>
+
+namespace Aws
+{
+namespace Client
+{
+
+enum class JitterMode
+{
+    /**
+     * Sleep a random time between 0 and the exponential backoff, min(maxDelay, baseDelay * 2^retries).
+     */
+    FULL,
+    /**
+     * Sleep a random time between baseDelay and three times the previous delay, capped at maxDelay.
+     */
+    DECORRELATED
+};
+
+/**
+ * Exponential backoff with jitter, so clients that were throttled together don't all retry at the same moment, plus a retry token bucket
+ * so a client stops retrying when most of its requests fail. Each retry costs retryCost tokens, or timeoutRetryCost when the request
+ * couldn't reach the service at all; a request that succeeds at the first try returns one token, one that succeeds after retrying
+ * returns retryCost. A retry that is allowed but never sent gives its cost back. Share a bucket between strategies to budget retries across several clients.
+ */
+class AWS_CORE_API JitteredRetryStrategy : public RetryStrategy
+{
+public:
+    JitteredRetryStrategy(JitterMode jitterMode = JitterMode::FULL, long maxRetries = 3, long baseDelayMs = 25, long maxDelayMs = 20000,
+        const std::shared_ptr<RetryTokenBucket>& tokenBucket = nullptr, unsigned retryCost = 5, unsigned timeoutRetryCost = 10);
+
+    bool ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    long CalculateDelayAfterPreviousDelay(const AWSError<CoreErrors>& error, long attemptedRetries, long previousDelayMs) const override;
+
+    void OnRequestSucceeded(long attemptedRetries) const override;
+
+    void OnRetryAbandoned(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    inline const std::shared_ptr<RetryTokenBucket>& GetTokenBucket() const { return m_tokenBucket; }
+
+private:
+    unsigned GetRetryCost(const AWSError<CoreErrors>& error) const;
+
+    long RandomDelayBetween(long minDelayMs, long maxDelayMs) const;
+
+    JitterMode m_jitterMode;
+    long m_maxRetries;
+    long m_baseDelayMs;
+    long m_maxDelayMs;
+    std::shared_ptr<RetryTokenBucket> m_tokenBucket;
+    unsigned m_retryCost;
+    unsigned m_timeoutRetryCost;
+
+    mutable std::mutex m_randomMutex;
+    mutable std::mt19937 m_random;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -0,0 +1,97 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/RequestTimings.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * What a single service call cost, over all of its attempts.
+         */
+        struct AWS_CORE_API RequestMetrics
+        {
+            RequestMetrics();
+
+            /**
+             * Service the client signs for, e.g. dynamodb. Empty for clients that don't sign with AWSAuthV4Signer.
+             */
+            Aws::String serviceName;
+            /**
+             * The request's GetServiceRequestName, or failing that the operation named in its x-amz-target header, or the http method.
+             */
+            Aws::String operationName;
+            /**
+             * Number of http requests made, 1 if the first one settled it.
+             */
+            unsigned attemptCount;
+            /**
+             * The delay slept before each retry.
+             */
+            Aws::Vector<std::chrono::milliseconds> retryDelays;
+            /**
+             * Whether the call ended in success.
+             */
+            bool succeeded;
+            /**
+             * Response code of the last attempt, REQUEST_NOT_MADE if it never got a response.
+             */
+            Aws::Http::HttpResponseCode httpStatus;
+            /**
+             * Request body bytes sent and response body bytes received, summed over all attempts.
+             */
+            uint64_t bytesSent;
+            uint64_t bytesReceived;
+            /**
+             * Time spent turning the request into http requests and signing them, summed over all attempts.
+             */
+            std::chrono::microseconds serializationTime;
+            std::chrono::microseconds signingTime;
+            /**
+             * From the start of the first attempt until the call returned, retry delays included.
+             */
+            std::chrono::microseconds endToEndLatency;
+            /**
+             * Where the time of the last attempt's http request went.
+             */
+            Aws::Http::RequestTimings lastAttemptTimings;
+        };
+
+        /**
+         * Receives the metrics of every call a client makes. Set one on ClientConfiguration::metricsPublisher. It is called on the
+         * thread that made the call, once the call is done, so implementations must be thread safe and should be cheap.
+         */
+        class AWS_CORE_API MetricsPublisher
+        {
+        public:
+            virtual ~MetricsPublisher() {}
+
+            /**
+             * Called once per service call, after its last attempt.
+             */
+            virtual void PublishRequestMetrics(const RequestMetrics& metrics) = 0;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 namespace Aws
 {
@@ -43,6 +44,31 @@ namespace Aws
              */
             virtual long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const = 0;
 
+            /**
+             * Same as CalculateDelayBeforeNextRetry, for strategies that base the next delay on the one before it. previousDelayMs is
+             * the delay slept before the last attempt, 0 before the first retry. Defaults to CalculateDelayBeforeNextRetry.
+             */
+            virtual long CalculateDelayAfterPreviousDelay(const AWSError<CoreErrors>& error, long attemptedRetries, long previousDelayMs) const
+            {
+                AWS_UNREFERENCED_PARAM(previousDelayMs);
+                return CalculateDelayBeforeNextRetry(error, attemptedRetries);
+            }
+
+            /**
+             * Called when a request succeeds after attemptedRetries retries, so strategies that budget retries can get some back. Does nothing by default.
+             */
+            virtual void OnRequestSucceeded(long attemptedRetries) const { AWS_UNREFERENCED_PARAM(attemptedRetries); }
+
+            /**
+             * Called when ShouldRetry allowed a retry that was then never sent, because the request was cancelled, ran past its deadline or
+             * request processing was disabled in the meantime. error and attemptedRetries are what ShouldRetry was called with. Does nothing by default.
+             */
+            virtual void OnRetryAbandoned(const AWSError<CoreErrors>& error, long attemptedRetries) const
+            {
+                AWS_UNREFERENCED_PARAM(error);
+                AWS_UNREFERENCED_PARAM(attemptedRetries);
+            }
+
         };
 
     } // namespace Client
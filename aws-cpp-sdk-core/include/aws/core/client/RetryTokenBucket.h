@@ -0,0 +1,58 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <atomic>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Budget of retries for a client. Every retry takes tokens out and every successful request puts some back, so while most
+         * requests succeed retries are free, but once the failure rate climbs the bucket runs dry and failed requests are returned
+         * to the caller instead of being retried, rather than multiplying the load on a service that is already struggling.
+         * Thread safe and lock free.
+         */
+        class AWS_CORE_API RetryTokenBucket
+        {
+        public:
+            /**
+             * Starts full with capacity tokens.
+             */
+            RetryTokenBucket(unsigned capacity = 500);
+
+            /**
+             * Takes cost tokens out if there are that many, returns whether it did.
+             */
+            bool TryAcquire(unsigned cost);
+            /**
+             * Puts amount tokens back, up to the capacity.
+             */
+            void Release(unsigned amount);
+
+            inline unsigned GetAvailableTokens() const { return m_availableTokens.load(); }
+            inline unsigned GetCapacity() const { return m_capacity; }
+
+        private:
+            unsigned m_capacity;
+            std::atomic<unsigned> m_availableTokens;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -0,0 +1,47 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Transforms a request's content body while the http client sends it, e.g. aws-chunked framing and signing.
+         * An encoder is stateful and good for a single transmission of a single request. The content-length header of
+         * the request has to be the length of the encoded body.
+         */
+        class AWS_CORE_API ContentBodyEncoder
+        {
+        public:
+            virtual ~ContentBodyEncoder() = default;
+
+            /**
+             * Reads the body sequentially from its current position and writes up to length bytes of the encoded body into buffer.
+             * Returns the number of bytes written to buffer, 0 once the whole encoded body has been written.
+             * bodyBytesRead is set to the number of bytes consumed from body by this call, which is what data sent events report.
+             */
+            virtual size_t Encode(Aws::IStream& body, char* buffer, size_t length, size_t& bodyBytesRead) = 0;
+        };
+
+    } // namespace Http
+} // namespace Aws
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <memory>
+#include <functional>
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
@@ -36,6 +37,12 @@ namespace Aws
     {
         class HttpRequest;
         class HttpResponse;
+        class URI;
+
+        /**
+         * Invoked once an asynchronously issued request has completed. The response is nullptr if the request failed at the transport level.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)> HttpResponseReceivedHandler;
 
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
@@ -53,6 +60,27 @@ namespace Aws
                 Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
                 Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const = 0;
 
+            /*
+            * Makes an http request without blocking the calling thread and calls handler with the response once it is done.
+            * The default implementation makes the request synchronously on the calling thread, clients built around an
+            * event loop override it.
+            */
+            virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseReceivedHandler& handler,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
+            /*
+            * Whether MakeRequestAsync returns before the request is done. The default implementation doesn't.
+            */
+            virtual bool SupportsAsyncRequests() const { return false; }
+
+            /**
+             * Opens up to connectionCount connections to endpoint in parallel and keeps them for the requests that follow,
+             * so those don't pay for dns, tcp and tls setup. Blocks until every connection is up or has failed and returns
+             * the number that came up. The default implementation doesn't keep connections and returns 0.
+             */
+            virtual size_t WarmUpConnections(const URI& endpoint, size_t connectionCount) const;
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
@@ -19,9 +19,12 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/threading/CancellationToken.h>
+#include <chrono>
 #include <memory>
 #include <functional>
 
@@ -46,7 +49,14 @@ namespace Aws
         extern AWS_CORE_API const char* AMZ_TARGET_HEADER;
         extern AWS_CORE_API const char* X_AMZ_EXPIRES_HEADER;
         extern AWS_CORE_API const char* CONTENT_MD5_HEADER;
+        extern AWS_CORE_API const char* CONTENT_ENCODING_HEADER;
+        extern AWS_CORE_API const char* X_AMZ_CONTENT_SHA256_HEADER;
+        extern AWS_CORE_API const char* X_AMZ_DECODED_CONTENT_LENGTH_HEADER;
+        extern AWS_CORE_API const char* RANGE_HEADER;
+        extern AWS_CORE_API const char* ETAG_HEADER;
+        extern AWS_CORE_API const char* CONTENT_RANGE_HEADER;
 
+        class ContentBodyEncoder;
         class HttpRequest;
         class HttpResponse;
 
@@ -58,6 +68,10 @@ namespace Aws
          * closure type for receiving notifications that data has been sent.
          */
         typedef std::function<void(const HttpRequest*, long long)> DataSentEventHandler;
+        /**
+         * Closure type for visiting the headers of a request by name and value.
+         */
+        typedef std::function<void(const Aws::String&, const Aws::String&)> HeaderVisitor;
 
         /**
           * Abstract class for representing an HttpRequest.
@@ -69,7 +83,7 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
+                m_uri(uri), m_method(method), m_deadline(std::chrono::steady_clock::time_point::max()), m_keepIncompleteResponse(false)
             {}
 
             virtual ~HttpRequest() {}
@@ -78,6 +92,17 @@ namespace Aws
              * Get All headers for this request.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Calls visitor with every header name and value, in header name order. Unlike GetHeaders(), implementations
+             * are not expected to copy the header collection, so this is what hot paths such as signing should use.
+             */
+            virtual void VisitHeaders(const HeaderVisitor& visitor) const
+            {
+                for (const auto& header : GetHeaders())
+                {
+                    visitor(header.first, header.second);
+                }
+            }
             /**
              * Get the value for a Header based on its name.
              */
@@ -365,12 +390,67 @@ namespace Aws
              * Gets the closure for receiving events when data is sent to the server.
              */
             inline const DataSentEventHandler& GetDataSentEventHandler() const { return onDataSent; }
+            /**
+             * Sets the encoder the http client runs the content body through while sending it. Signers use this for aws-chunked payloads.
+             */
+            inline void SetContentBodyEncoder(const std::shared_ptr<ContentBodyEncoder>& encoder) { m_contentBodyEncoder = encoder; }
+            /**
+             * Gets the encoder for the content body, nullptr when the body is sent as is.
+             */
+            inline const std::shared_ptr<ContentBodyEncoder>& GetContentBodyEncoder() const { return m_contentBodyEncoder; }
+            /**
+             * Sets the sha256 digest (not hex encoded) of the content body, when it was computed along with other digests in a single pass over the body.
+             * Signers use it instead of reading the body again. It has to be set again whenever the body changes.
+             */
+            inline void SetContentSha256Digest(const Aws::Utils::ByteBuffer& digest) { m_contentSha256Digest = digest; }
+            /**
+             * Gets the precomputed sha256 digest of the content body, empty if none was computed.
+             */
+            inline const Aws::Utils::ByteBuffer& GetContentSha256Digest() const { return m_contentSha256Digest; }
+            /**
+             * Sets the token the caller can cancel this request with, http clients abort the transfer once it is cancelled.
+             */
+            inline void SetCancellationToken(const std::shared_ptr<Aws::Utils::Threading::CancellationToken>& token) { m_cancellationToken = token; }
+            /**
+             * Gets the token the caller can cancel this request with, nullptr if it can't be cancelled.
+             */
+            inline const std::shared_ptr<Aws::Utils::Threading::CancellationToken>& GetCancellationToken() const { return m_cancellationToken; }
+            /**
+             * Sets when the caller stops waiting for this request, http clients abort the transfer past it.
+             */
+            inline void SetDeadline(std::chrono::steady_clock::time_point deadline) { m_deadline = deadline; }
+            /**
+             * Gets when the caller stops waiting for this request, time_point::max() if it waits as long as the request takes.
+             */
+            inline std::chrono::steady_clock::time_point GetDeadline() const { return m_deadline; }
+            /**
+             * Whether the caller cancelled the request or its deadline passed, so it shouldn't be sent or waited on any longer.
+             */
+            inline bool IsCancelledOrExpired() const
+            {
+                return (m_cancellationToken && m_cancellationToken->IsCancelled()) ||
+                    (m_deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= m_deadline);
+            }
+            /**
+             * Asks the http client to hand back what arrived of a successful response whose transfer broke off, e.g. stalled, marked with
+             * HttpResponse::IsTransferIncomplete(), rather than no response at all. Lets a ranged read be resumed from where it stopped.
+             */
+            inline void SetKeepIncompleteResponse(bool keepIncompleteResponse) { m_keepIncompleteResponse = keepIncompleteResponse; }
+            /**
+             * Whether the http client should hand back what arrived of a response whose transfer broke off.
+             */
+            inline bool ShouldKeepIncompleteResponse() const { return m_keepIncompleteResponse; }
 
         private:
             URI m_uri;
             HttpMethod m_method;
             DataReceivedEventHandler onDataReceived;
             DataSentEventHandler onDataSent;
+            std::shared_ptr<ContentBodyEncoder> m_contentBodyEncoder;
+            Aws::Utils::ByteBuffer m_contentSha256Digest;
+            std::shared_ptr<Aws::Utils::Threading::CancellationToken> m_cancellationToken;
+            std::chrono::steady_clock::time_point m_deadline;
+            bool m_keepIncompleteResponse;
 
         };
 
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/RequestTimings.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 
@@ -125,7 +126,8 @@ namespace Aws
              */
             HttpResponse(const HttpRequest&  originatingRequest) :
                 httpRequest(originatingRequest),
-                responseCode(REQUEST_NOT_MADE)
+                responseCode(REQUEST_NOT_MADE),
+                transferIncomplete(false)
             {}
 
             virtual ~HttpResponse() = default;
@@ -176,6 +178,17 @@ namespace Aws
              * Sets the content type header on the http response object.
              */
             virtual void SetContentType(const Aws::String& contentType) { AddHeader("content-type", contentType); };
+            /**
+             * Where the time of the request went, as far as the http client measured it.
+             */
+            virtual inline const RequestTimings& GetRequestTimings() const { return requestTimings; }
+            virtual inline void SetRequestTimings(const RequestTimings& timings) { requestTimings = timings; }
+            /**
+             * Whether the transfer broke off before the whole body arrived. Only handed back for requests that asked for it with
+             * HttpRequest::SetKeepIncompleteResponse(); the body holds what did arrive.
+             */
+            virtual inline bool IsTransferIncomplete() const { return transferIncomplete; }
+            virtual inline void SetTransferIncomplete(bool incomplete) { transferIncomplete = incomplete; }
 
         private:
             HttpResponse(const HttpResponse&);
@@ -183,6 +196,8 @@ namespace Aws
 
             const HttpRequest& httpRequest;
             HttpResponseCode responseCode;
+            RequestTimings requestTimings;
+            bool transferIncomplete;
         };
 
 
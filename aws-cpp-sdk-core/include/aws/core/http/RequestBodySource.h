@@ -0,0 +1,76 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpRequest;
+
+        /**
+         * Reads a request's content body sequentially into an http client's send buffer.
+         * How much there is to read is worked out once, up front: from the content-length header when the request has one,
+         * otherwise by seeking the stream once. Reads themselves never seek, so streams that can't seek work fine as long as
+         * their length is known.
+         */
+        class AWS_CORE_API RequestBodySource
+        {
+        public:
+            /**
+             * Reads body from its current position. bodyLength is the number of bytes to send from there;
+             * a negative bodyLength means unknown, in which case it is measured by seeking, or if that fails the body is read to its end.
+             * body may be nullptr for requests without one.
+             */
+            RequestBodySource(Aws::IStream* body, int64_t bodyLength);
+
+            /**
+             * Reads the content body of request, taking its length from the content-length header when there is one.
+             */
+            explicit RequestBodySource(const HttpRequest& request);
+
+            /**
+             * Reads up to length bytes into buffer. Returns the number of bytes read, 0 once the body is exhausted.
+             */
+            size_t Read(char* buffer, size_t length);
+
+            /**
+             * Whether the number of bytes left is known.
+             */
+            inline bool IsLengthKnown() const { return m_lengthKnown; }
+
+            /**
+             * Number of bytes left to read. Only meaningful if IsLengthKnown().
+             */
+            inline uint64_t GetRemainingLength() const { return m_remainingLength; }
+
+        private:
+            void Initialize(int64_t bodyLength);
+
+            Aws::IStream* m_body;
+            uint64_t m_remainingLength;
+            bool m_lengthKnown;
+        };
+
+    } // namespace Http
+} // namespace Aws
@@ -0,0 +1,63 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <chrono>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Where the time of a single http request went. Except for the connection acquire time, each value is measured from the
+         * start of the transfer, the way curl reports them, so e.g. the tls handshake took tlsHandshakeDone - connectDone.
+         * Steps that didn't happen, such as the dns lookup on a reused connection, are zero. Http clients that don't measure
+         * a step leave it zero as well.
+         */
+        struct RequestTimings
+        {
+            RequestTimings() :
+                connectionAcquireTime(0), nameLookupDone(0), connectDone(0), tlsHandshakeDone(0), firstByteReceived(0), totalTime(0)
+            {}
+
+            /**
+             * Time spent waiting for a connection from the client's pool before the transfer started.
+             */
+            std::chrono::microseconds connectionAcquireTime;
+            /**
+             * Until the dns lookup completed.
+             */
+            std::chrono::microseconds nameLookupDone;
+            /**
+             * Until the tcp connection (or the one to the proxy) was established.
+             */
+            std::chrono::microseconds connectDone;
+            /**
+             * Until the tls handshake completed.
+             */
+            std::chrono::microseconds tlsHandshakeDone;
+            /**
+             * Until the first byte of the response arrived.
+             */
+            std::chrono::microseconds firstByteReceived;
+            /**
+             * Until the transfer completed.
+             */
+            std::chrono::microseconds totalTime;
+        };
+
+    } // namespace Http
+} // namespace Aws
@@ -15,9 +15,16 @@
 
 #pragma once
 
+#include <aws/core/http/curl/CurlShareHandle.h>
+#include <aws/core/utils/threading/TimerQueue.h>
 #include <aws/core/utils/memory/stl/AWSStack.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
 
 #include <utility>
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
 #include <curl/curl.h>
@@ -26,12 +33,19 @@ namespace Aws
 {
 namespace Http
 {
+class URI;
 
 /**
   * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
   * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
   * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
   * needed up to the maximum amount of connections.
+  *
+  * Released handles are kept per endpoint (scheme, host and port), since each one holds on to its open connection
+  * to the endpoint it last talked to. Acquiring for an endpoint prefers those handles, then unused ones, and only then
+  * takes the longest idle handle of another endpoint. Handles idle past the idle timeout are closed, by every acquire and
+  * release, and by a timer on the shared TimerQueue so that a pool nobody uses anymore lets go of its connections as well.
+  * All handles share their dns cache and tls sessions through a CurlShareHandle, which can be shared with other containers.
   */
 class CurlHandleContainer
 {
@@ -40,35 +54,87 @@ public:
       * Initializes an empty stack of CURL handles. If you are only making synchronous calls via your http client
       * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
       */
-    CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000);
+    CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000, unsigned long idleTimeout = 0,
+        bool useProcessWideShare = false);
     ~CurlHandleContainer();
 
     /**
       * Blocks until a curl handle from the pool is available for use.
       */
     CURL* AcquireCurlHandle();
+    /**
+      * Blocks until a curl handle from the pool is available for use, preferring one whose connection to
+      * the endpoint identified by connectionKey (see GetConnectionKey) is still open.
+      */
+    CURL* AcquireCurlHandle(const Aws::String& connectionKey);
     /**
       * Returns a handle to the pool for reuse. It is imperative that this is called
       * after you are finished with the handle.
       */
     void ReleaseCurlHandle(CURL* handle);
 
+    /**
+      * Key identifying the endpoint a request to uri connects to.
+      */
+    static Aws::String GetConnectionKey(const URI& uri);
+
+    /**
+      * Number of acquires that got a handle which last talked to the same endpoint.
+      */
+    inline uint64_t GetPoolHitCount() const { return m_poolHits.load(); }
+    /**
+      * Number of acquires that had to use a fresh handle or one that last talked to another endpoint.
+      */
+    inline uint64_t GetPoolMissCount() const { return m_poolMisses.load(); }
+    /**
+      * Most handles this container will ever hand out at once.
+      */
+    inline unsigned GetMaxPoolSize() const { return m_maxPoolSize; }
+    /**
+      * Number of released handles still holding on to the connection they last used.
+      */
+    size_t GetIdleHandleCount() const;
+
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&) = delete;
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
+    struct IdleHandle
+    {
+        CURL* handle;
+        std::chrono::steady_clock::time_point idleSince;
+    };
+
     bool CheckAndGrowPool();
     void SetDefaultOptionsOnHandle(void* handle);
+    void EvictIdleHandles();
+    void ScheduleEviction();
+    void EvictOnTimer();
+    bool TakeLongestIdleHandle(CURL*& handle);
 
+    //handles that haven't made a request yet
     Aws::Stack<CURL*> m_handleContainer;
-    std::mutex m_handleContainerMutex;
+    //released handles by the endpoint they last talked to, longest idle first
+    Aws::Map<Aws::String, Aws::Deque<IdleHandle>> m_idleHandles;
+    //endpoint each handle in use was acquired for
+    Aws::Map<CURL*, Aws::String> m_handleConnectionKeys;
+    mutable std::mutex m_handleContainerMutex;
     std::condition_variable m_conditionVariable;
     unsigned m_maxPoolSize;
     unsigned long m_requestTimeout;
     unsigned long m_connectTimeout;
     unsigned m_poolSize;
+    std::chrono::milliseconds m_idleTimeout;
+    //only set with an idle timeout. At most one eviction is scheduled at a time, for when the longest idle handle expires.
+    std::shared_ptr<Aws::Utils::Threading::TimerQueue> m_evictionTimers;
+    Aws::Utils::Threading::TimerQueue::TimerId m_evictionTimerId;
+    bool m_shuttingDown;
+    //released after the destructor has cleaned up every handle attached to it
+    std::shared_ptr<CurlShareHandle> m_shareHandle;
+    std::atomic<uint64_t> m_poolHits;
+    std::atomic<uint64_t> m_poolMisses;
     static bool isInit;
 };
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/RequestBodySource.h>
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -39,8 +40,63 @@ public:
     std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
             Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
 
-private:
+    //Sends a HEAD request to the root of endpoint on up to connectionCount handles at once, capped at maxConnections, and
+    //parks the handles for that endpoint. The responses don't matter, only that the connections stay open.
+    size_t WarmUpConnections(const URI& endpoint, size_t connectionCount) const override;
+
+    //Number of requests that got a pooled connection which last talked to the same endpoint
+    inline uint64_t GetConnectionPoolHitCount() const { return m_curlHandleContainer.GetPoolHitCount(); }
+    //Number of requests that had to use a new connection or take over one to another endpoint
+    inline uint64_t GetConnectionPoolMissCount() const { return m_curlHandleContainer.GetPoolMissCount(); }
+
+protected:
+    //State handed to the WriteData callback for a single transfer
+    struct CurlWriteCallbackContext
+    {
+        CurlWriteCallbackContext(const CurlHttpClient* client,
+                                 HttpRequest* request,
+                                 HttpResponse* response,
+                                 Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+            m_client(client),
+            m_request(request),
+            m_response(response),
+            m_rateLimiter(rateLimiter)
+        {}
+
+        const CurlHttpClient* m_client;
+        HttpRequest* m_request;
+        HttpResponse* m_response;
+        Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    };
+
+    //State handed to the ReadBody callback for a single transfer. The body's length is taken once, here, not on every callback.
+    struct CurlReadCallbackContext
+    {
+        CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request) :
+            m_client(client),
+            m_request(request),
+            m_bodySource(*request)
+        {}
+
+        const CurlHttpClient* m_client;
+        HttpRequest* m_request;
+        RequestBodySource m_bodySource;
+    };
+
+    //Builds the curl header list for request. The caller frees it with curl_slist_free_all once the transfer is done.
+    static struct curl_slist* BuildHeaderList(const HttpRequest& request);
+    //Sets url, method, headers, tls, proxy and callback options for a transfer of request on connectionHandle.
+    void SetTransferOptions(CURL* connectionHandle, const HttpRequest& request, const Aws::String& url, struct curl_slist* headers,
+            CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const;
+    //Copies the response code and content type of a successfully completed transfer onto response.
+    static void ReadTransferResults(CURL* connectionHandle, HttpResponse& response);
+    //Whether the response of a transfer that failed is still handed back: its request asked for that, and a successful status and
+    //part of the body arrived before it broke off. Marks the response incomplete if so.
+    static bool KeepIncompleteResponse(CURL* connectionHandle, const HttpRequest& request, HttpResponse& response);
+
     mutable CurlHandleContainer m_curlHandleContainer;
+
+private:
     bool m_isUsingProxy;
     Aws::String m_proxyUserName;
     Aws::String m_proxyPassword;
@@ -49,6 +105,9 @@ private:
     bool m_verifySSL;
     Aws::String m_caPath;
     bool m_allowRedirects;
+    long m_requestTimeout;
+    long m_lowSpeedLimit;
+    long m_lowSpeedTime;
 
     //Callback to read the content from the content body of the request
     static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata);
@@ -56,6 +115,8 @@ private:
     static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata);
     //callback to write the headers from the response to the response
     static size_t WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata);
+    //progress callback, aborts the transfer once its request is cancelled or past its deadline
+    static int CheckTransferProgress(void* userdata, curl_off_t downloadTotal, curl_off_t downloaded, curl_off_t uploadTotal, curl_off_t uploaded);
 
 };
 
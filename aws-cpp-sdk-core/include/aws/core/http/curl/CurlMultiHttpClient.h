@@ -0,0 +1,96 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+  * Curl implementation of an http client that drives every transfer from a single event loop thread using
+  * curl_multi_poll, which is woken up through curl_multi_wakeup when new work is queued. With curl older than 7.68 the
+  * loop can't be woken up and instead comes back every few milliseconds. MakeRequestAsync queues a transfer and returns immediately; the handler is called on the
+  * event loop thread when the transfer completes, so it should hand off any heavy work. MakeRequest is kept for
+  * callers that expect the blocking interface and simply waits for its own transfer.
+  *
+  * At most maxConnections transfers are in flight at a time, the rest wait in a queue. Note that a read rate limiter
+  * is applied on the event loop thread, so it throttles all transfers of this client together.
+  *
+  * curl_multi_poll hands curl's whole set of sockets to poll() on every pass of the loop, so each pass costs time linear in
+  * the number of transfers in flight. That is cheap for the hundreds of connections a client usually has; thousands of
+  * concurrent transfers would want curl_multi_socket_action driven by epoll/kqueue instead.
+  */
+class CurlMultiHttpClient : public CurlHttpClient
+{
+public:
+    using Base = CurlHttpClient;
+
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    /**
+      * Stops the event loop. Transfers still queued or in flight are completed with a nullptr response.
+      */
+    ~CurlMultiHttpClient();
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseReceivedHandler& handler,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+private:
+    struct Transfer;
+    typedef std::function<void(const std::shared_ptr<HttpResponse>&)> TransferCompletedHandler;
+
+    void QueueTransfer(HttpRequest& request, const std::shared_ptr<HttpRequest>& requestOwner, const TransferCompletedHandler& onCompleted,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const;
+    void WakeUpEventLoop() const;
+
+    void EventLoop();
+    void StartQueuedTransfers();
+    void PollAndDispatch();
+    void CompleteFinishedTransfers();
+    void FinishTransfer(Transfer* transfer, CURLcode result);
+    void FailOutstandingTransfers();
+
+    CURLM* m_multiHandle;
+    unsigned m_maxInFlight;
+    std::atomic<bool> m_continue;
+
+    mutable std::mutex m_queueMutex;
+    mutable Aws::Queue<Transfer*> m_queuedTransfers;
+
+    //only touched by the event loop thread
+    Aws::Set<Transfer*> m_inFlightTransfers;
+
+    std::thread m_eventLoopThread;
+};
+
+} // namespace Http
+} // namespace Aws
+
@@ -0,0 +1,66 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <curl/curl.h>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+  * Owns a curl share handle that lets curl handles share their DNS cache and TLS sessions, so a new connection to an
+  * endpoint another handle already talked to skips the lookup and resumes the TLS session instead of doing a full handshake.
+  * Curl calls back into it to lock each kind of shared data, so handles may use it from any thread.
+  * Connections themselves are not shared: curl does not support that for handles running on different threads, and the
+  * handle container already hands out handles with a live connection to the right endpoint.
+  * Every curl handle attached to it must be cleaned up before it is destroyed.
+  */
+class CurlShareHandle
+{
+public:
+    /**
+      * curl_global_init must have been called already.
+      */
+    CurlShareHandle();
+    ~CurlShareHandle();
+
+    /**
+      * Handle to set as CURLOPT_SHARE, nullptr if curl failed to create it.
+      */
+    inline CURLSH* GetHandle() const { return m_shareHandle; }
+
+    /**
+      * The share handle used by every client that asks for the process wide one. It lives as long as any of them holds on to it.
+      */
+    static std::shared_ptr<CurlShareHandle> GetProcessWideInstance();
+
+private:
+    CurlShareHandle(const CurlShareHandle&) = delete;
+    CurlShareHandle& operator = (const CurlShareHandle&) = delete;
+
+    static void LockData(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData);
+    static void UnlockData(CURL* handle, curl_lock_data data, void* userData);
+
+    CURLSH* m_shareHandle;
+    std::mutex m_dataLocks[CURL_LOCK_DATA_LAST];
+};
+
+} // namespace Http
+} // namespace Aws
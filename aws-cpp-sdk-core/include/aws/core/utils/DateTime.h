@@ -19,6 +19,8 @@
 
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <chrono>
+#include <ctime>
 #include <mutex>
 
 namespace Aws
@@ -42,6 +44,11 @@ namespace Aws
             */
             static Aws::String CalculateGmtTimestampAsString(const char* formatStr);
 
+            /**
+            * Formats time as a gmt timestamp and returns it as a string
+            */
+            static Aws::String CalculateGmtTimestampAsString(std::time_t time, const char* formatStr);
+
             /**
             * Calculates the current hour of the day in localtime.
             */
@@ -62,6 +69,12 @@ namespace Aws
             */
             static Aws::String ComputeCurrentDateInISO8601Format();
 
+            /**
+            * Parses a gmt timestamp in the ISO-8601 format ComputeCurrentTimestampInISO8601Format() produces, e.g. "2016-04-01T10:20:30Z",
+            * into time. Fractional seconds are ignored. Returns false, leaving time alone, if timestamp isn't in that format.
+            */
+            static bool ParseISO8601Timestamp(const Aws::String& timestamp, std::chrono::system_clock::time_point& time);
+
         private:
             static std::mutex timeMutex;
         };
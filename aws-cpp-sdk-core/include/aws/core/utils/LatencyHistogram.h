@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Histogram of non negative integer values, e.g. latencies in microseconds, with HDR style log linear buckets: every power of two
+         * range is split into 32 equal buckets, so any recorded value is reported within about 3% of itself over the whole 64 bit range.
+         * Record is lock free and wait free apart from keeping the max, so it can be called from any number of threads at once.
+         * Reads see a consistent enough view for reporting, but aren't a snapshot of a single instant while recording goes on.
+         */
+        class AWS_CORE_API LatencyHistogram
+        {
+        public:
+            LatencyHistogram();
+
+            /**
+             * Adds value to the histogram.
+             */
+            void Record(uint64_t value);
+
+            /**
+             * Number of values recorded.
+             */
+            inline uint64_t GetCount() const { return m_count.load(std::memory_order_relaxed); }
+            /**
+             * Largest value recorded, exactly.
+             */
+            inline uint64_t GetMax() const { return m_max.load(std::memory_order_relaxed); }
+            /**
+             * Mean of the values recorded, 0 if there are none.
+             */
+            double GetMean() const;
+            /**
+             * The value that percentile percent (0 - 100) of the recorded values are at or below, as the upper end of the bucket it fell into.
+             * 0 if nothing has been recorded.
+             */
+            uint64_t GetValueAtPercentile(double percentile) const;
+            /**
+             * Clears all recorded values. Values recorded while this runs may or may not survive it.
+             */
+            void Reset();
+
+        private:
+            LatencyHistogram(const LatencyHistogram&) = delete;
+            LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+            static size_t GetBucketIndex(uint64_t value);
+            static uint64_t GetBucketUpperBound(size_t bucketIndex);
+
+            static const unsigned SUB_BUCKET_BITS = 5;
+            static const size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+            //values below twice the sub bucket count get a bucket each, every higher power of two gets SUB_BUCKET_COUNT buckets
+            static const size_t BUCKET_COUNT = 2 * SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS - 1) * SUB_BUCKET_COUNT;
+
+            std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+            std::atomic<uint64_t> m_count;
+            std::atomic<uint64_t> m_sum;
+            std::atomic<uint64_t> m_max;
+        };
+
+    } // namespace Utils
+} // namespace Aws
@@ -46,6 +46,18 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) = 0;
 
+                /**
+                * Adds bufferSize bytes of buffer to a running digest. Call GetHash() once all of the data has been added.
+                * Hashes that don't keep a running digest leave this alone, and their GetHash() fails.
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize);
+
+                /**
+                * Finishes the running digest started by Update() and returns it. The next Update() starts a new digest.
+                * The default implementation has no running digest and returns a failed result, callers then fall back to Calculate().
+                */
+                virtual HashResult GetHash();
+
                 // when hashing streams, this is the size of our internal buffer we read the stream into
                 static const uint32_t INTERNAL_HASH_STREAM_BUFFER_SIZE = 8192;
             };
@@ -65,6 +65,16 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                * Adds buffer to a running MD5 digest
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the running MD5 digest and returns it
+                */
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr<Hash> m_hashImpl;
@@ -0,0 +1,64 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * Computes several hash digests with a single read of the data, e.g. the md5 and sha256 of a request body.
+             * The hashes are driven through their running digest (Hash::Update/Hash::GetHash), so an instance
+             * must not be used from more than one thread at a time.
+             */
+            class AWS_CORE_API MultiDigest
+            {
+            public:
+                /**
+                 * Every hash in hashes sees the same data. Results come back in the same order.
+                 */
+                MultiDigest(const Aws::Vector<std::shared_ptr<Hash>>& hashes);
+
+                /**
+                 * Calculates every digest of str.
+                 */
+                Aws::Vector<HashResult> Calculate(const Aws::String& str);
+
+                /**
+                 * Calculates every digest on the stream (the entire stream is read, once) and restores its position.
+                 * All results are failures if the stream could not be read to the end.
+                 */
+                Aws::Vector<HashResult> Calculate(Aws::IStream& stream);
+
+            private:
+                Aws::Vector<HashResult> GetHashes(bool success);
+
+                Aws::Vector<std::shared_ptr<Hash>> m_hashes;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
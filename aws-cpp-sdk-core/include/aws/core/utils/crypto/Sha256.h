@@ -64,6 +64,16 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                * Adds buffer to a running sha256 digest
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the running sha256 digest and returns it
+                */
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr< Hash > m_hashImpl;
@@ -60,6 +60,16 @@ namespace Aws
                  */
                 HashResult Calculate(Aws::IStream& stream);
 
+                /**
+                 * Adds data to a running hash, starting one if needed.
+                 */
+                void Update(PBYTE data, ULONG dataLength);
+
+                /**
+                 * Finishes the running hash and returns it.
+                 */
+                HashResult GetHash();
+
             private:
 
                 bool IsValid() const;
@@ -75,6 +85,11 @@ namespace Aws
                 DWORD m_hashObjectLength;
                 PBYTE m_hashObject;
 
+                // the running hash of Update()/GetHash(). It lets bcrypt allocate its own hash object,
+                // so one-shot calculations can keep reusing m_hashObject in the meantime.
+                BCryptHashContext* m_runningContext;
+                bool m_runningHashFailed;
+
                 //I'm 99% sure the algorithm handle for windows is not thread safe, but I can't 
                 //prove or disprove that theory. Therefore, we have to lock to be safe.
                 std::mutex m_algorithmMutex;
@@ -101,6 +116,16 @@ namespace Aws
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                 * Adds buffer to a running md5 hash.
+                 */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                 * Finishes the running md5 hash and returns it.
+                 */
+                virtual HashResult GetHash() override;
+
             private:
                 BCryptHashImpl m_impl;
             };
@@ -126,6 +151,16 @@ namespace Aws
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                 * Adds buffer to a running sha256 hash.
+                 */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                 * Finishes the running sha256 hash and returns it.
+                 */
+                virtual HashResult GetHash() override;
+
             private:
                 BCryptHashImpl m_impl;
             };
@@ -2,6 +2,8 @@
 
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
+#include <openssl/md5.h>
+#include <openssl/sha.h>
 
 namespace Aws
 {
@@ -14,25 +16,43 @@ namespace Aws
             {
             public:
 
-                MD5OpenSSLImpl() {}
+                MD5OpenSSLImpl() : m_updateStarted(false) {}
                 virtual ~MD5OpenSSLImpl() {}
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+
+                MD5_CTX m_ctx;
+                bool m_updateStarted;
+
             };
 
             class Sha256OpenSSLImpl : public Hash
             {
             public:
 
-                Sha256OpenSSLImpl() {}
+                Sha256OpenSSLImpl() : m_updateStarted(false) {}
                 virtual ~Sha256OpenSSLImpl() {}
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+
+                SHA256_CTX m_ctx;
+                bool m_updateStarted;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
@@ -0,0 +1,114 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstddef>
+#include <memory>
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * Stream buffer that writes straight into a fixed block of memory somebody else owns, and reads back what was written.
+             * It never allocates or grows: once the memory is full further writes fail.
+             */
+            class AWS_CORE_API PreallocatedStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * buffer has to hold capacity bytes and stay valid for as long as this is used. owner, when given, is held on to so
+                 * whatever owns buffer lives at least as long as this.
+                 */
+                PreallocatedStreamBuf(unsigned char* buffer, size_t capacity, const std::shared_ptr<void>& owner = nullptr);
+
+                PreallocatedStreamBuf(const PreallocatedStreamBuf&) = delete;
+                PreallocatedStreamBuf& operator=(const PreallocatedStreamBuf&) = delete;
+
+                /**
+                 * Number of bytes written so far.
+                 */
+                inline size_t GetBytesWritten() const { return static_cast<size_t>(pptr() - pbase()); }
+
+                /**
+                 * Size of the memory being written to.
+                 */
+                inline size_t GetCapacity() const { return m_capacity; }
+
+            protected:
+                int_type underflow() override;
+                /**
+                 * Reads can seek anywhere in what was written. The write position can be queried but not moved.
+                 */
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                char* m_begin;
+                size_t m_capacity;
+                std::shared_ptr<void> m_owner;
+            };
+
+            /**
+             * IOStream over a PreallocatedStreamBuf. Used as a response stream, the response body lands directly in the caller's
+             * memory: no intermediate copies and no reallocations.
+             */
+            class AWS_CORE_API PreallocatedStream : public Aws::IOStream
+            {
+            public:
+                using Base = Aws::IOStream;
+
+                /**
+                 * Writes into the whole of buffer, keeping it alive for the life of the stream.
+                 */
+                PreallocatedStream(const std::shared_ptr<Aws::Utils::ByteBuffer>& buffer);
+
+                /**
+                 * Writes into the capacity bytes at buffer. See PreallocatedStreamBuf for owner.
+                 */
+                PreallocatedStream(unsigned char* buffer, size_t capacity, const std::shared_ptr<void>& owner = nullptr);
+
+                /**
+                 * Number of bytes written so far.
+                 */
+                inline size_t GetBytesWritten() const { return m_streamBuf.GetBytesWritten(); }
+
+            private:
+                PreallocatedStreamBuf m_streamBuf;
+            };
+
+            /**
+             * Response stream factory that writes response bodies into the capacity bytes at buffer. Every attempt at a request starts
+             * writing at the beginning of buffer again. A body longer than capacity is cut short and leaves the stream bad, so this fits
+             * best with requests whose response size is known up front, such as ranged gets.
+             */
+            AWS_CORE_API Aws::IOStreamFactory PreallocatedResponseStreamFactory(unsigned char* buffer, size_t capacity, const std::shared_ptr<void>& owner = nullptr);
+
+            /**
+             * Response stream factory that writes response bodies into buffer, keeping it alive as long as the factory or any stream it made is.
+             */
+            AWS_CORE_API Aws::IOStreamFactory PreallocatedResponseStreamFactory(const std::shared_ptr<Aws::Utils::ByteBuffer>& buffer);
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
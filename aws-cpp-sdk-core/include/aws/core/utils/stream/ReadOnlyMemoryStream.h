@@ -0,0 +1,94 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstddef>
+#include <memory>
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * Stream buffer that reads straight out of memory somebody else owns, without copying it. It can seek anywhere within
+             * the memory, but can't be written to.
+             */
+            class AWS_CORE_API ReadOnlyMemoryStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * data has to stay valid and unchanged for as long as this buffer is read. owner, when given, is held on to so
+                 * whatever owns data lives at least as long as this buffer.
+                 */
+                ReadOnlyMemoryStreamBuf(const unsigned char* data, size_t length, const std::shared_ptr<const void>& owner = nullptr);
+
+                ReadOnlyMemoryStreamBuf(const ReadOnlyMemoryStreamBuf&) = delete;
+                ReadOnlyMemoryStreamBuf& operator=(const ReadOnlyMemoryStreamBuf&) = delete;
+
+                /**
+                 * Total length of the memory, regardless of the read position.
+                 */
+                inline size_t GetSize() const { return m_length; }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                std::streamsize showmanyc() override;
+
+            private:
+                char* m_begin;
+                size_t m_length;
+                std::shared_ptr<const void> m_owner;
+            };
+
+            /**
+             * IOStream over memory the caller already holds, so a request body can be sent from it without first copying it into
+             * a string stream. Writing to it fails. Its size is known up front, so the content-length doesn't need a seek.
+             */
+            class AWS_CORE_API ReadOnlyMemoryStream : public Aws::IOStream
+            {
+            public:
+                using Base = Aws::IOStream;
+
+                /**
+                 * Reads the whole of buffer, keeping it alive for the life of the stream.
+                 */
+                ReadOnlyMemoryStream(const std::shared_ptr<Aws::Utils::ByteBuffer>& buffer);
+
+                /**
+                 * Reads length bytes starting at data. See ReadOnlyMemoryStreamBuf for owner.
+                 */
+                ReadOnlyMemoryStream(const unsigned char* data, size_t length, const std::shared_ptr<const void>& owner = nullptr);
+
+                /**
+                 * Total number of bytes in the stream, regardless of the read position.
+                 */
+                inline size_t GetSize() const { return m_streamBuf.GetSize(); }
+
+            private:
+                ReadOnlyMemoryStreamBuf m_streamBuf;
+            };
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
@@ -0,0 +1,84 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * Recycles the storage of response bodies, so a loop making the same kind of request over and over stops allocating
+             * (and regrowing) a body buffer for every response.
+             * Set the factory from GetResponseStreamFactory() as the response stream factory of the requests that should share buffers.
+             * When a response body stream is destroyed its storage goes back to the pool, unless the pool is full or the storage is too big to keep.
+             * The pool is thread safe, and streams may outlive it.
+             */
+            class AWS_CORE_API ResponseBodyBufferPool : public std::enable_shared_from_this<ResponseBodyBufferPool>
+            {
+            public:
+                /**
+                 * Keeps at most maxPooledBuffers buffers, none bigger than maxPooledBufferSize bytes.
+                 */
+                ResponseBodyBufferPool(size_t maxPooledBuffers = 16, size_t maxPooledBufferSize = 4 * 1024 * 1024);
+
+                /**
+                 * Response stream factory whose streams write into pooled buffers. The factory holds a reference to the pool.
+                 */
+                Aws::IOStreamFactory GetResponseStreamFactory();
+
+                /**
+                 * Takes a buffer out of the pool, or an empty one if the pool has none.
+                 */
+                Aws::Utils::Array<char> Acquire();
+
+                /**
+                 * Gives buffer back to the pool for the next Acquire().
+                 */
+                void Release(Aws::Utils::Array<char>&& buffer);
+
+                /**
+                 * Number of buffers currently in the pool.
+                 */
+                size_t GetPooledBufferCount() const;
+
+                /**
+                 * Number of Acquire() calls that got a buffer out of the pool.
+                 */
+                inline uint64_t GetReuseCount() const { return m_reuseCount.load(); }
+
+            private:
+                size_t m_maxPooledBuffers;
+                size_t m_maxPooledBufferSize;
+                mutable std::mutex m_poolMutex;
+                Aws::Vector<Aws::Utils::Array<char>> m_pool;
+                std::atomic<uint64_t> m_reuseCount;
+            };
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
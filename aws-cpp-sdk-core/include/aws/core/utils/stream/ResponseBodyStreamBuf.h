@@ -0,0 +1,87 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+
+#include <cstddef>
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * In-memory stream buffer for response bodies. It grows like a string buffer, but can also be told up front how big the body
+             * is going to be, so the body is written once instead of being copied on every reallocation. Storage beyond what was written
+             * is left uninitialized, so reserving a large body doesn't cost a pass over it. Its storage can be handed over to the next
+             * response, see ResponseBodyBufferPool.
+             */
+            class AWS_CORE_API ResponseBodyStreamBuf : public std::streambuf
+            {
+            public:
+                ResponseBodyStreamBuf();
+
+                /**
+                 * Writes into storage, which may be left over from a previous response. Its contents are ignored, its size is
+                 * what can be written before the buffer has to grow.
+                 */
+                explicit ResponseBodyStreamBuf(Aws::Utils::Array<char>&& storage);
+
+                ResponseBodyStreamBuf(const ResponseBodyStreamBuf&) = delete;
+                ResponseBodyStreamBuf& operator=(const ResponseBodyStreamBuf&) = delete;
+
+                /**
+                 * Makes room for at least size bytes of body in total, so writing that much won't reallocate.
+                 */
+                void Reserve(size_t size);
+
+                /**
+                 * Number of body bytes written.
+                 */
+                size_t GetSize() const;
+
+                /**
+                 * Number of bytes that can be written before the buffer has to grow.
+                 */
+                inline size_t GetCapacity() const { return m_storage.GetLength(); }
+
+                /**
+                 * Takes the storage out of the buffer, which is left empty.
+                 */
+                Aws::Utils::Array<char> ReleaseStorage();
+
+            protected:
+                int_type overflow(int_type ch) override;
+                int_type underflow() override;
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                void Resize(size_t newCapacity);
+                void SetPutOffset(size_t offset);
+                void UpdateHighWaterMark();
+
+                Aws::Utils::Array<char> m_storage;
+                size_t m_highWaterMark;
+            };
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
@@ -62,6 +62,9 @@ namespace Aws
                 Aws::IOStream* m_underlyingStream;
             };
 
+            /**
+             * Keeps the response body in memory, in a ResponseBodyStreamBuf, so http clients can size it from the content-length up front.
+             */
             class AWS_CORE_API DefaultUnderlyingStream : public Aws::IOStream
             {
             public:
@@ -0,0 +1,71 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * Lets a caller give up on work it started, e.g. requests it handed to a client. Set it on any number of requests and call
+             * Cancel() from any thread: transfers in flight are aborted, retry sleeps end, and requests that haven't been sent yet
+             * fail without being sent. Once cancelled it stays cancelled.
+             */
+            class AWS_CORE_API CancellationToken
+            {
+            public:
+                CancellationToken();
+                /**
+                 * A token that is also cancelled whenever parent is, e.g. to call off one of several requests made on behalf of
+                 * a caller who may cancel all of them. Waiting on it only wakes up for Cancel() on the token itself.
+                 */
+                explicit CancellationToken(const std::shared_ptr<CancellationToken>& parent);
+
+                /**
+                 * Cancels everything that carries this token and wakes up whoever is waiting on it.
+                 */
+                void Cancel();
+
+                inline bool IsCancelled() const { return m_cancelled.load() || (m_parent && m_parent->IsCancelled()); }
+
+                /**
+                 * Blocks for up to timeToWait, returning early when the token is cancelled. Returns whether it is cancelled.
+                 */
+                bool WaitForCancellation(std::chrono::milliseconds timeToWait) const;
+
+            private:
+                CancellationToken(const CancellationToken&) = delete;
+                CancellationToken& operator=(const CancellationToken&) = delete;
+
+                std::shared_ptr<CancellationToken> m_parent;
+                std::atomic<bool> m_cancelled;
+                mutable std::mutex m_signalLock;
+                mutable std::condition_variable m_signal;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
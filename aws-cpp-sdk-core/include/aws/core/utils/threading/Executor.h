@@ -20,7 +20,16 @@
 
 
 #include <functional>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
 #include <aws/core/utils/memory/stl/AWSFunction.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
 namespace Aws
 {
@@ -66,6 +75,186 @@ namespace Aws
                 bool SubmitToThread(std::function<void()>&&);
             };
 
+            /**
+            * What a PooledThreadExecutor does with a task submitted while its queue is full.
+            */
+            enum class OverflowPolicy
+            {
+                /**
+                * Block the submitting thread until there is room in the queue.
+                */
+                BLOCK,
+                /**
+                * Refuse the task, Submit() returns false.
+                */
+                REJECT,
+                /**
+                * Run the task synchronously on the submitting thread.
+                */
+                RUN_ON_CALLER
+            };
+
+            /**
+            * Executor with a fixed number of worker threads pulling tasks from a bounded queue. Unlike DefaultExecutor
+            * it never creates threads after construction, so a burst of async calls is queued up (or pushed back on, depending on
+            * the overflow policy) instead of spawning a thread per call.
+            *
+            * A worker thread that submits into its own full queue always runs the task itself, since blocking there could
+            * leave no worker free to drain the queue.
+            *
+            * On destruction, tasks already queued are still run before the workers are joined. The executor may be destroyed
+            * by one of its own tasks; that worker is detached and finishes on its own, holding on to the queue until it does.
+            */
+            class AWS_CORE_API PooledThreadExecutor : public Executor
+            {
+            public:
+                PooledThreadExecutor(size_t poolSize, size_t maxQueueSize, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK);
+                ~PooledThreadExecutor();
+
+                /**
+                * Number of tasks currently waiting for a worker.
+                */
+                size_t GetQueueDepth() const;
+                /**
+                * Highest queue depth seen since construction.
+                */
+                size_t GetPeakQueueDepth() const { return m_state->peakQueueDepth.load(); }
+                /**
+                * Number of tasks that have been run by the worker threads.
+                */
+                unsigned long long GetExecutedTaskCount() const { return m_state->executedTaskCount.load(); }
+                /**
+                * Number of tasks refused because the queue was full and the policy is REJECT, or because the executor was shutting down.
+                */
+                unsigned long long GetRejectedTaskCount() const { return m_state->rejectedTaskCount.load(); }
+                /**
+                * Number of tasks run on the submitting thread because the queue was full.
+                */
+                unsigned long long GetCallerRunTaskCount() const { return m_state->callerRunTaskCount.load(); }
+                /**
+                * Sum, over all tasks run by the workers, of the time between Submit() and the start of the task.
+                */
+                std::chrono::microseconds GetTotalTaskWaitTime() const { return std::chrono::microseconds(m_state->totalTaskWaitMicros.load()); }
+                /**
+                * Longest time a single task spent in the queue.
+                */
+                std::chrono::microseconds GetMaxTaskWaitTime() const { return std::chrono::microseconds(m_state->maxTaskWaitMicros.load()); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                PooledThreadExecutor(const PooledThreadExecutor&) = delete;
+                PooledThreadExecutor& operator =(const PooledThreadExecutor&) = delete;
+
+                struct QueuedTask
+                {
+                    std::function<void()> task;
+                    std::chrono::steady_clock::time_point submitted;
+                };
+
+                /**
+                * Everything the workers touch. Each worker holds a reference, so it stays valid for a worker that outlives the executor.
+                */
+                struct PoolState
+                {
+                    PoolState(size_t maxQueueSize, OverflowPolicy overflowPolicy);
+
+                    void RecordWaitTime(std::chrono::steady_clock::time_point submitted);
+
+                    Aws::Queue<QueuedTask> tasks;
+                    size_t maxQueueSize;
+                    OverflowPolicy overflowPolicy;
+                    bool continueRunning;
+
+                    mutable std::mutex queueLock;
+                    std::condition_variable queueNotEmpty;
+                    std::condition_variable queueNotFull;
+
+                    std::atomic<size_t> peakQueueDepth;
+                    std::atomic<unsigned long long> executedTaskCount;
+                    std::atomic<unsigned long long> rejectedTaskCount;
+                    std::atomic<unsigned long long> callerRunTaskCount;
+                    std::atomic<unsigned long long> totalTaskWaitMicros;
+                    std::atomic<unsigned long long> maxTaskWaitMicros;
+                };
+
+                static void WorkerLoop(std::shared_ptr<PoolState> state);
+                bool IsWorkerThread() const;
+
+                std::shared_ptr<PoolState> m_state;
+                Aws::Vector<std::thread> m_workers;
+            };
+
+
+            /**
+            * Executor with a fixed number of worker threads, each owning its own task deque. A task submitted from one of
+            * the workers (e.g. an async completion handler starting the next call of a chain) goes onto that worker's deque and
+            * is picked up by the same thread, newest first. Tasks submitted from any other thread are spread round robin across
+            * the workers. A worker whose deque is empty steals the oldest task from another worker before going to sleep.
+            *
+            * This avoids every submit and every dequeue contending on one queue lock when handlers chain further calls. Submit
+            * only takes the shared sleep lock when some worker is asleep. The deques are unbounded; use PooledThreadExecutor
+            * if you need backpressure.
+            *
+            * On destruction, tasks already submitted are still run before the workers are joined. As with PooledThreadExecutor,
+            * the executor may be destroyed by one of its own tasks.
+            */
+            class AWS_CORE_API WorkStealingThreadExecutor : public Executor
+            {
+            public:
+                WorkStealingThreadExecutor(size_t poolSize);
+                ~WorkStealingThreadExecutor();
+
+                /**
+                * Number of tasks a worker took from another worker's deque.
+                */
+                unsigned long long GetStolenTaskCount() const { return m_state->stolenTaskCount.load(); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                WorkStealingThreadExecutor(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor& operator =(const WorkStealingThreadExecutor&) = delete;
+
+                struct WorkerQueue
+                {
+                    std::mutex lock;
+                    Aws::Deque<std::function<void()>> tasks;
+                };
+
+                /**
+                * Everything the workers touch. Each worker holds a reference, so it stays valid for a worker that outlives the executor.
+                */
+                struct StealingState
+                {
+                    StealingState(size_t poolSize);
+
+                    bool PopLocal(size_t workerIndex, std::function<void()>& task);
+                    bool Steal(size_t workerIndex, std::function<void()>& task);
+
+                    Aws::Vector<Aws::UniquePtr<WorkerQueue>> queues;
+                    //submitted tasks no worker has taken yet, raised before the push so it never drops below the real count
+                    std::atomic<size_t> pendingTasks;
+                    //raised after every push; a worker only sleeps while this still has the value it read before its last search
+                    std::atomic<unsigned long long> pushedTasks;
+                    std::atomic<size_t> sleepingWorkers;
+                    std::atomic<unsigned long long> stolenTaskCount;
+                    std::atomic<bool> continueRunning;
+
+                    std::mutex sleepLock;
+                    std::condition_variable workAvailable;
+                };
+
+                static void WorkerLoop(std::shared_ptr<StealingState> state, size_t workerIndex);
+                //returns the index of the calling worker thread, or the number of workers if the caller is not one of ours
+                size_t CurrentWorkerIndex() const;
+
+                std::shared_ptr<StealingState> m_state;
+                Aws::Vector<std::thread> m_workers;
+                std::atomic<size_t> m_nextQueue;
+            };
 
         } // namespace Threading
     } // namespace Utils
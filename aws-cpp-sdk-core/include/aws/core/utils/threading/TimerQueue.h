@@ -0,0 +1,105 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Runs tasks at given points in time, all of them on a single thread of its own. Tasks due at the same time run in the order
+            * they were scheduled. They should be short; a task that takes a while holds up the ones due after it, so anything slow is
+            * better handed on to an Executor from the task.
+            *
+            * On destruction, tasks that haven't run yet are dropped and a task that is running is waited for. The queue may be destroyed
+            * by one of its own tasks; its thread is then detached and exits on its own once that task returns.
+            */
+            class AWS_CORE_API TimerQueue
+            {
+            public:
+                typedef unsigned long long TimerId;
+
+                TimerQueue();
+                ~TimerQueue();
+
+                TimerQueue(const TimerQueue&) = delete;
+                TimerQueue& operator=(const TimerQueue&) = delete;
+
+                /**
+                * Runs task at runAt, or as soon as possible if that has passed. Returns an id for Cancel(), never 0.
+                */
+                TimerId Schedule(std::chrono::steady_clock::time_point runAt, std::function<void()>&& task);
+
+                /**
+                * Drops the task with timerId and returns true if it hasn't started yet. Otherwise returns false, once the task is done if it
+                * is running right now, so nothing it uses goes away under it. Called from the task itself, it returns right away.
+                */
+                bool Cancel(TimerId timerId);
+
+                /**
+                * Number of tasks waiting for their time.
+                */
+                size_t GetPendingCount() const;
+
+                /**
+                * The queue shared by everything in the process that only needs an occasional timer, e.g. credential refreshes. It is started
+                * on first use and stopped once nobody holds a reference to it anymore.
+                */
+                static std::shared_ptr<TimerQueue> GetShared();
+
+            private:
+                typedef std::pair<std::chrono::steady_clock::time_point, TimerId> ScheduleKey;
+
+                /**
+                * Everything the thread touches. It holds a reference, so it stays valid for a thread that outlives the queue.
+                */
+                struct TimerState
+                {
+                    TimerState() : nextTimerId(1), runningTimerId(0), continueRunning(true) {}
+
+                    Aws::Map<ScheduleKey, std::function<void()>> tasks;
+                    Aws::Map<TimerId, std::chrono::steady_clock::time_point> dueTimes;
+                    TimerId nextTimerId;
+                    TimerId runningTimerId;
+                    bool continueRunning;
+                    std::thread::id timerThreadId;
+
+                    mutable std::mutex stateLock;
+                    std::condition_variable tasksChanged;
+                    std::condition_variable taskDone;
+                };
+
+                static void TimerLoop(std::shared_ptr<TimerState> state);
+
+                std::shared_ptr<TimerState> m_state;
+                std::thread m_thread;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -15,8 +15,24 @@
 
 #include <aws/core/AmazonStreamingWebServiceRequest.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ReadOnlyMemoryStream.h>
 
 using namespace Aws;
+using namespace Aws::Utils::Stream;
+
+static const char* STREAMING_REQUEST_TAG = "AmazonStreamingWebServiceRequest";
 
 AmazonStreamingWebServiceRequest::~AmazonStreamingWebServiceRequest() {}
 
+void AmazonStreamingWebServiceRequest::SetBody(const std::shared_ptr<Aws::Utils::ByteBuffer>& buffer)
+{
+    m_bodyStream = Aws::MakeShared<ReadOnlyMemoryStream>(STREAMING_REQUEST_TAG, buffer);
+    m_contentSha256Digest = Aws::Utils::ByteBuffer();
+}
+
+void AmazonStreamingWebServiceRequest::SetBody(const unsigned char* data, size_t length, const std::shared_ptr<const void>& owner)
+{
+    m_bodyStream = Aws::MakeShared<ReadOnlyMemoryStream>(STREAMING_REQUEST_TAG, data, length, owner);
+    m_contentSha256Digest = Aws::Utils::ByteBuffer();
+}
+
@@ -22,7 +22,15 @@ using namespace Aws;
 AmazonWebServiceRequest::AmazonWebServiceRequest() :
     m_responseStreamFactory(AWS_BUILD_FUNCTION(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod)),
     m_onDataReceived(nullptr),
-    m_onDataSent(nullptr)
+    m_onDataSent(nullptr),
+    m_deadline(std::chrono::steady_clock::time_point::max()),
+    m_idempotent(false)
 {
 }
 
+bool AmazonWebServiceRequest::IsCancelledOrExpired() const
+{
+    return (m_cancellationToken && m_cancellationToken->IsCancelled()) ||
+        (m_deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= m_deadline);
+}
+
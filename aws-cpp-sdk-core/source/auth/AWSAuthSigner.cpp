@@ -15,7 +15,9 @@
 
 #include <aws/core/auth/AWSAuthSigner.h>
 
+#include <aws/core/auth/AWSChunkedPayloadSigner.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/CanonicalRequestBuilder.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
@@ -46,7 +48,6 @@ static const char* AWS_HMAC_SHA256 = "AWS4-HMAC-SHA256";
 static const char* AWS4_REQUEST = "aws4_request";
 static const char* SIGNED_HEADERS = "SignedHeaders";
 static const char* CREDENTIAL = "Credential";
-static const char* NEWLINE = "\n";
 static const char* X_AMZ_SIGNED_HEADERS = "X-Amz-SignedHeaders";
 static const char* X_AMZ_ALGORITHM = "X-Amz-Algorithm";
 static const char* X_AMZ_CREDENTIAL = "X-Amz-Credential";
@@ -56,31 +57,17 @@ static const char* SIGNING_KEY = "AWS4";
 static const char* LONG_DATE_FORMAT_STR = "%Y%m%dT%H%M%SZ";
 static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
 
+static const char* AWS_CHUNKED = "aws-chunked";
+
 static const char* v4LogTag = "AWSAuthV4Signer";
 
-Aws::String CanonicalizeRequestSigningString(HttpRequest& request)
+namespace Aws
 {
-    request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
-
-    signingStringStream << NEWLINE << request.GetUri().GetURLEncodedPath() << NEWLINE;
-
-    if (request.GetQueryString().size() > 1 && request.GetQueryString().find("=") != std::string::npos)
-    {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
-    }
-    else if (request.GetQueryString().size() > 1)
-    {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
-    }
-    else
+    namespace Client
     {
-        signingStringStream << NEWLINE;
-    }
-
-    return signingStringStream.str();
-}
+        const char* STREAMING_PAYLOAD_SHA256 = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+    } // namespace Client
+} // namespace Aws
 
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
     const char* serviceName,
@@ -89,13 +76,20 @@ AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvi
     m_serviceName(serviceName),
     m_region(region),
     m_hash(Aws::MakeUnique<Aws::Utils::Crypto::Sha256>(v4LogTag)),
-    m_HMAC(Aws::MakeUnique<Aws::Utils::Crypto::Sha256HMAC>(v4LogTag))
+    m_HMAC(Aws::MakeUnique<Aws::Utils::Crypto::Sha256HMAC>(v4LogTag)),
+    m_cachedSigningKey(nullptr),
+    m_signingKeyReaders(0)
 {
 }
 
 AWSAuthV4Signer::~AWSAuthV4Signer()
 {
-    // empty destructor in .cpp file to keep from needing the implementation of (AWSCredentialsProvider, Sha256, Sha256HMAC) in the header file 
+    // destructor in .cpp file to keep from needing the implementation of (AWSCredentialsProvider, Sha256, Sha256HMAC) in the header file 
+    Aws::Delete(m_cachedSigningKey.load());
+    for (auto retiredKey : m_retiredSigningKeys)
+    {
+        Aws::Delete(retiredKey);
+    }
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
@@ -113,68 +107,77 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
         request.SetAwsSessionToken(credentials.GetSessionToken());
     }
 
+    //a retry is signed again, and its previous signature must not end up among the signed headers
+    request.DeleteHeader(AWS_AUTHORIZATION_HEADER);
+
     //calculate date header to use in internal signature (this also goes into date header).
-    Aws::String dateHeaderValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
+    std::time_t signingTime = GetSigningTime();
+    Aws::String dateHeaderValue = DateTime::CalculateGmtTimestampAsString(signingTime, LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::String payloadHash(ComputePayloadHash(request));
-    if (payloadHash.empty())
+    //the body is signed chunk by chunk while it is sent, as long as we know up front how much of it there is
+    bool signBodyInChunks = request.GetContentBody() && request.HasHeader(CONTENT_LENGTH_HEADER)
+        && request.HasHeader(X_AMZ_CONTENT_SHA256_HEADER) && request.GetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER) == STREAMING_PAYLOAD_SHA256;
+
+    Aws::String payloadHash;
+    uint64_t decodedContentLength = 0;
+    if (signBodyInChunks)
     {
-        return false;
+        payloadHash = STREAMING_PAYLOAD_SHA256;
+        decodedContentLength = PrepareChunkedPayloadHeaders(request);
     }
-
-    request.SetHeaderValue("x-amz-content-sha256", payloadHash);
-
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : request.GetHeaders())
+    else
     {
-        headersStream << header.first << ":" << header.second << NEWLINE;
-        signedHeadersStream << header.first << ";";
+        payloadHash = ComputePayloadHash(request);
+        if (payloadHash.empty())
+        {
+            return false;
+        }
     }
 
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    signedHeadersValue.erase(signedHeadersValue.length() - 1);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+    request.SetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER, payloadHash);
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
+    request.CanonicalizeRequest();
+    auto builder = AcquireCanonicalRequestBuilder();
+    const Aws::String& canonicalRequestString = builder->BuildCanonicalRequest(request, payloadHash);
+    const Aws::String& signedHeadersValue = builder->GetSignedHeaders();
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
-    if (!hashResult.IsSuccess())
+    Aws::String cannonicalRequestHash = HashCanonicalRequest(canonicalRequestString);
+    if (cannonicalRequestHash.empty())
     {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
+    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(signingTime, SIMPLE_DATE_FORMAT_STR);
 
-    Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash);
+    const Aws::String& stringToSign = builder->BuildStringToSign(dateHeaderValue, simpleDate, m_region, m_serviceName, cannonicalRequestHash);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
+    if (signBodyInChunks)
+    {
+        auto signingKey = GetSigningKey(credentials, simpleDate);
+        if (signingKey.GetLength() == 0 || finalSignature.empty())
+        {
+            return false;
+        }
+
+        Aws::String scope(simpleDate);
+        scope.append("/").append(m_region).append("/").append(m_serviceName).append("/").append(AWS4_REQUEST);
+        request.SetContentBodyEncoder(Aws::MakeShared<AWSChunkedPayloadSigner>(v4LogTag, signingKey, dateHeaderValue, scope,
+            finalSignature, decodedContentLength));
+    }
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    Aws::String awsAuthString;
+    awsAuthString.reserve(256);
+    awsAuthString.append(AWS_HMAC_SHA256).append(" ").append(CREDENTIAL).append(EQ).append(credentials.GetAWSAccessKeyId());
+    awsAuthString.append("/").append(simpleDate).append("/").append(m_region).append("/").append(m_serviceName).append("/").append(AWS4_REQUEST);
+    awsAuthString.append(", ").append(SIGNED_HEADERS).append(EQ).append(signedHeadersValue);
+    awsAuthString.append(", ").append(SIGNATURE).append(EQ).append(finalSignature);
+    ReleaseCanonicalRequestBuilder(std::move(builder));
 
-    auto awsAuthString = ss.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
 
@@ -201,23 +204,18 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     }
 
     //calculate date header to use in internal signature (this also goes into date header).
-    Aws::String dateQueryValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
+    std::time_t signingTime = GetSigningTime();
+    Aws::String dateQueryValue = DateTime::CalculateGmtTimestampAsString(signingTime, LONG_DATE_FORMAT_STR);
     request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
 
-    Aws::StringStream ss;
-    ss << Http::HOST_HEADER << ":" << request.GetHeaderValue(Http::HOST_HEADER) << NEWLINE;
-    Aws::String canonicalHeadersString(ss.str());
-    ss.str("");
-
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
     //calculate signed headers parameter
     Aws::String signedHeadersValue(Http::HOST_HEADER);
     request.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, signedHeadersValue);
     
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
 
-    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
+    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(signingTime, SIMPLE_DATE_FORMAT_STR);
+    Aws::StringStream ss;
     ss << credentials.GetAWSAccessKeyId() << "/" << simpleDate
         << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST;
 
@@ -226,30 +224,23 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     ss.str("");
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(UNSIGNED_PAYLOAD);
+    request.CanonicalizeRequest();
+    auto builder = AcquireCanonicalRequestBuilder();
+    const Aws::String& canonicalRequestString = builder->BuildCanonicalRequest(request, Http::HOST_HEADER,
+        request.GetHeaderValue(Http::HOST_HEADER), UNSIGNED_PAYLOAD);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
-    if (!hashResult.IsSuccess())
+    Aws::String cannonicalRequestHash = HashCanonicalRequest(canonicalRequestString);
+    if (cannonicalRequestHash.empty())
     {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    auto cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);   
-
-    auto stringToSign = GenerateStringToSign(dateQueryValue, simpleDate, cannonicalRequestHash);
+    const Aws::String& stringToSign = builder->BuildStringToSign(dateQueryValue, simpleDate, m_region, m_serviceName, cannonicalRequestHash);
 
     auto finalSigningHash = GenerateSignature(credentials, stringToSign, simpleDate);
+    ReleaseCanonicalRequestBuilder(std::move(builder));
     if (finalSigningHash.empty())
     {
         return false;
@@ -261,12 +252,91 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     return true;
 }
 
+std::time_t AWSAuthV4Signer::GetSigningTime() const
+{
+    return std::time(nullptr);
+}
+
 Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate) const
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
+    auto signingKey = GetSigningKey(credentials, simpleDate);
+    if (signingKey.GetLength() == 0)
+    {
+        return "";
+    }
 
+    auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), signingKey);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
+        return "";
+    }
+
+    //now we finally sign our request string with our hex encoded derived hash.
+    auto finalSigningDigest = hashResult.GetResult();
+
+    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
+
+    return finalSigningHash;
+}
+
+ByteBuffer AWSAuthV4Signer::GetSigningKey(const AWSCredentials& credentials, const Aws::String& simpleDate) const
+{
+    //a reader is counted before it loads the pointer, so a key swapped out while the count is zero can't be held by anyone
+    ++m_signingKeyReaders;
+    const SigningKey* cachedKey = m_cachedSigningKey.load();
+    if (cachedKey && cachedKey->simpleDate == simpleDate && cachedKey->accessKeyId == credentials.GetAWSAccessKeyId()
+        && cachedKey->secretKey == credentials.GetAWSSecretKey())
+    {
+        ByteBuffer key(cachedKey->key);
+        --m_signingKeyReaders;
+        return key;
+    }
+    --m_signingKeyReaders;
+
+    //date rolled over or credentials rotated. Racing threads may both derive the key, the last one published wins.
+    ByteBuffer key = DeriveSigningKey(credentials, simpleDate);
+    if (key.GetLength() == 0)
+    {
+        return key;
+    }
+
+    SigningKey* derivedKey = Aws::New<SigningKey>(v4LogTag);
+    derivedKey->accessKeyId = credentials.GetAWSAccessKeyId();
+    derivedKey->secretKey = credentials.GetAWSSecretKey();
+    derivedKey->simpleDate = simpleDate;
+    derivedKey->key = key;
+    PublishSigningKey(derivedKey);
+    return key;
+}
+
+void AWSAuthV4Signer::PublishSigningKey(SigningKey* signingKey) const
+{
+    SigningKey* replacedKey = m_cachedSigningKey.exchange(signingKey);
+    if (!replacedKey)
+    {
+        return;
+    }
+
+    //only taken when the key changes, about once a day per signer. Under steady signing load the count may rarely be seen
+    //at zero, so replaced keys can pile up until a quiet moment or until the signer goes away.
+    std::lock_guard<std::mutex> locker(m_retiredSigningKeysMutex);
+    m_retiredSigningKeys.push_back(replacedKey);
+    if (m_signingKeyReaders.load() == 0)
+    {
+        for (auto retiredKey : m_retiredSigningKeys)
+        {
+            Aws::Delete(retiredKey);
+        }
+        m_retiredSigningKeys.clear();
+    }
+}
+
+ByteBuffer AWSAuthV4Signer::DeriveSigningKey(const AWSCredentials& credentials, const Aws::String& simpleDate) const
+{
     //now we do the complicated part of deriving a signing key.
     Aws::String signingKey(SIGNING_KEY);
     signingKey.append(credentials.GetAWSSecretKey());
@@ -277,7 +347,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) date string \"" << simpleDate << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kDate = hashResult.GetResult();
@@ -285,7 +355,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) region string \"" << m_region << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kRegion = hashResult.GetResult();
@@ -293,7 +363,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) service string \"" << m_serviceName << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kService = hashResult.GetResult();
@@ -301,28 +371,22 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) request string \"" << AWS4_REQUEST << "\"");
-        return "";
+        return ByteBuffer();
     }
 
-    auto kSigning = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), kSigning);
-    if (!hashResult.IsSuccess())
-    {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
-        return "";
-    }
-
-    //now we finally sign our request string with our hex encoded derived hash.
-    auto finalSigningDigest = hashResult.GetResult();
-
-    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
-
-    return finalSigningHash;
+    return hashResult.GetResult();
 }
 
 Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request) const
 {
+    //the body's sha256 may have been computed already in the same pass as its content-md5
+    if (request.GetContentBody() && request.GetContentSha256Digest().GetLength() > 0)
+    {
+        Aws::String payloadHash(HashingUtils::HexEncode(request.GetContentSha256Digest()));
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "Using precomputed sha256 " << payloadHash << " for payload.");
+        return payloadHash;
+    }
+
     //compute hash on payload if it exists.
     auto hashResult = request.GetContentBody() ? m_hash->Calculate(*request.GetContentBody())
         : m_hash->Calculate("");
@@ -336,16 +400,69 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
 
     Aws::String payloadHash(HashingUtils::HexEncode(sha256Digest));
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Calculated sha256 " << payloadHash << " for payload.");
+    //so signing a retry doesn't read the whole body again
+    if (request.GetContentBody())
+    {
+        request.SetContentSha256Digest(sha256Digest);
+    }
     return payloadHash;
 }
 
-Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& canonicalRequestHash) const
+uint64_t AWSAuthV4Signer::PrepareChunkedPayloadHeaders(Aws::Http::HttpRequest& request) const
 {
-    //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
+    //headers of a request signed before already describe the chunked body
+    if (request.HasHeader(X_AMZ_DECODED_CONTENT_LENGTH_HEADER))
+    {
+        return static_cast<uint64_t>(StringUtils::ConvertToInt64(request.GetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH_HEADER).c_str()));
+    }
+
+    //content-length becomes the length on the wire, the original one moves to x-amz-decoded-content-length
+    Aws::String decodedContentLength(request.GetContentLength());
+    uint64_t decodedLength = static_cast<uint64_t>(StringUtils::ConvertToInt64(decodedContentLength.c_str()));
+    request.SetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH_HEADER, decodedContentLength);
+    request.SetContentLength(StringUtils::to_string(AWSChunkedPayloadSigner::CalculateEncodedContentLength(decodedLength)));
 
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << m_region << "/"
-        << m_serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    //aws-chunked has to be applied last, so it is listed first
+    Aws::String contentEncoding(AWS_CHUNKED);
+    if (request.HasHeader(CONTENT_ENCODING_HEADER) && !request.GetHeaderValue(CONTENT_ENCODING_HEADER).empty())
+    {
+        contentEncoding.append(",").append(request.GetHeaderValue(CONTENT_ENCODING_HEADER));
+    }
+    request.SetHeaderValue(CONTENT_ENCODING_HEADER, contentEncoding);
+
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing " << decodedLength << " byte body in aws-chunked chunks, content-length " << request.GetContentLength());
+    return decodedLength;
+}
 
-    return ss.str();
+Aws::String AWSAuthV4Signer::HashCanonicalRequest(const Aws::String& canonicalRequest) const
+{
+    auto hashResult = m_hash->Calculate(canonicalRequest);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequest << "\"");
+        return "";
+    }
+
+    return HashingUtils::HexEncode(hashResult.GetResult());
+}
+
+Aws::UniquePtr<CanonicalRequestBuilder> AWSAuthV4Signer::AcquireCanonicalRequestBuilder() const
+{
+    {
+        std::lock_guard<std::mutex> locker(m_builderPoolMutex);
+        if (!m_builderPool.empty())
+        {
+            auto builder = std::move(m_builderPool.back());
+            m_builderPool.pop_back();
+            return builder;
+        }
+    }
+
+    return Aws::MakeUnique<CanonicalRequestBuilder>(v4LogTag);
+}
+
+void AWSAuthV4Signer::ReleaseCanonicalRequestBuilder(Aws::UniquePtr<CanonicalRequestBuilder>&& builder) const
+{
+    std::lock_guard<std::mutex> locker(m_builderPoolMutex);
+    m_builderPool.push_back(std::move(builder));
 }
@@ -0,0 +1,175 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/AWSChunkedPayloadSigner.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+static const char* CHUNKED_LOG_TAG = "AWSChunkedPayloadSigner";
+static const char* AWS_HMAC_SHA256_PAYLOAD = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char* CHUNK_SIGNATURE = ";chunk-signature=";
+static const char* CHUNK_END = "\r\n";
+//sha256 of the empty string, every chunk signs it in place of the (empty) chunk headers
+static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static const size_t SIGNATURE_LENGTH = 64;
+static const char* HEX_DIGITS = "0123456789abcdef";
+
+static size_t CountHexDigits(uint64_t value)
+{
+    size_t digits = 1;
+    while (value >>= 4)
+    {
+        ++digits;
+    }
+    return digits;
+}
+
+static size_t EncodedChunkLength(uint64_t dataLength)
+{
+    return CountHexDigits(dataLength) + strlen(CHUNK_SIGNATURE) + SIGNATURE_LENGTH + strlen(CHUNK_END)
+        + static_cast<size_t>(dataLength) + strlen(CHUNK_END);
+}
+
+AWSChunkedPayloadSigner::AWSChunkedPayloadSigner(const ByteBuffer& signingKey, const Aws::String& dateValue, const Aws::String& scope,
+    const Aws::String& seedSignature, uint64_t decodedContentLength, size_t chunkSize) :
+    m_signingKey(signingKey),
+    m_previousSignature(seedSignature),
+    m_remainingBodyBytes(decodedContentLength),
+    m_chunkSize(chunkSize),
+    m_encodedChunkPosition(0),
+    m_finalChunkEncoded(false),
+    m_hash(Aws::MakeUnique<Crypto::Sha256>(CHUNKED_LOG_TAG)),
+    m_HMAC(Aws::MakeUnique<Crypto::Sha256HMAC>(CHUNKED_LOG_TAG))
+{
+    m_stringToSignPrefix.append(AWS_HMAC_SHA256_PAYLOAD).append("\n");
+    m_stringToSignPrefix.append(dateValue).append("\n");
+    m_stringToSignPrefix.append(scope).append("\n");
+}
+
+AWSChunkedPayloadSigner::~AWSChunkedPayloadSigner()
+{
+    // empty destructor in .cpp file to keep from needing the implementation of (Sha256, Sha256HMAC) in the header file
+}
+
+uint64_t AWSChunkedPayloadSigner::CalculateEncodedContentLength(uint64_t decodedContentLength, size_t chunkSize)
+{
+    uint64_t fullChunks = decodedContentLength / chunkSize;
+    uint64_t lastChunkLength = decodedContentLength % chunkSize;
+
+    uint64_t encodedLength = fullChunks * EncodedChunkLength(chunkSize);
+    if (lastChunkLength > 0)
+    {
+        encodedLength += EncodedChunkLength(lastChunkLength);
+    }
+
+    return encodedLength + EncodedChunkLength(0);
+}
+
+size_t AWSChunkedPayloadSigner::Encode(Aws::IStream& body, char* buffer, size_t length, size_t& bodyBytesRead)
+{
+    bodyBytesRead = 0;
+    size_t written = 0;
+
+    while (written < length)
+    {
+        if (m_encodedChunkPosition == m_encodedChunk.size())
+        {
+            if (m_finalChunkEncoded || !EncodeNextChunk(body, bodyBytesRead))
+            {
+                break;
+            }
+        }
+
+        size_t toCopy = (std::min)(length - written, m_encodedChunk.size() - m_encodedChunkPosition);
+        memcpy(buffer + written, m_encodedChunk.data() + m_encodedChunkPosition, toCopy);
+        m_encodedChunkPosition += toCopy;
+        written += toCopy;
+    }
+
+    return written;
+}
+
+bool AWSChunkedPayloadSigner::EncodeNextChunk(Aws::IStream& body, size_t& bodyBytesRead)
+{
+    size_t dataLength = static_cast<size_t>((std::min)(static_cast<uint64_t>(m_chunkSize), m_remainingBodyBytes));
+    m_chunkData.resize(dataLength);
+    if (dataLength > 0)
+    {
+        body.read(&m_chunkData[0], dataLength);
+        if (static_cast<size_t>(body.gcount()) != dataLength)
+        {
+            AWS_LOGSTREAM_ERROR(CHUNKED_LOG_TAG, "Request body ended " << m_remainingBodyBytes - body.gcount()
+                << " bytes short of its declared length");
+            return false;
+        }
+        bodyBytesRead += dataLength;
+        m_remainingBodyBytes -= dataLength;
+    }
+
+    if (!SignChunk())
+    {
+        return false;
+    }
+
+    m_encodedChunk.clear();
+    m_encodedChunk.reserve(EncodedChunkLength(dataLength));
+    for (size_t digit = CountHexDigits(dataLength); digit > 0; --digit)
+    {
+        m_encodedChunk.append(1, HEX_DIGITS[(dataLength >> ((digit - 1) * 4)) & 0x0F]);
+    }
+    m_encodedChunk.append(CHUNK_SIGNATURE).append(m_previousSignature).append(CHUNK_END);
+    m_encodedChunk.append(m_chunkData).append(CHUNK_END);
+    m_encodedChunkPosition = 0;
+    m_finalChunkEncoded = dataLength == 0;
+
+    return true;
+}
+
+bool AWSChunkedPayloadSigner::SignChunk()
+{
+    auto hashResult = m_hash->Calculate(m_chunkData);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOG_ERROR(CHUNKED_LOG_TAG, "Failed to hash (sha256) request body chunk");
+        return false;
+    }
+
+    Aws::String stringToSign(m_stringToSignPrefix);
+    stringToSign.append(m_previousSignature).append("\n");
+    stringToSign.append(EMPTY_STRING_SHA256).append("\n");
+    stringToSign.append(HashingUtils::HexEncode(hashResult.GetResult()));
+
+    auto signatureResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), m_signingKey);
+    if (!signatureResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CHUNKED_LOG_TAG, "Unable to hmac (sha256) chunk string \"" << stringToSign << "\"");
+        return false;
+    }
+
+    m_previousSignature = HashingUtils::HexEncode(signatureResult.GetResult());
+    AWS_LOGSTREAM_TRACE(CHUNKED_LOG_TAG, "Signed " << m_chunkData.size() << " byte chunk: " << m_previousSignature);
+    return true;
+}
@@ -22,7 +22,10 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/internal/EC2MetadataClient.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/threading/TimerQueue.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <chrono>
 #include <fstream>
@@ -37,6 +40,7 @@
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
+using namespace Aws::Utils::Threading;
 using namespace Aws::Auth;
 using namespace Aws::Internal;
 
@@ -79,6 +83,115 @@ bool AWSCredentialsProvider::IsTimeToRefresh(long reloadFrequency)
 }
 
 
+static const char* refreshingLogTag = "BackgroundRefreshingAWSCredentialsProvider";
+//keeps a snapshot that is already past its refresh time, or as good as, from being reloaded back to back
+static const std::chrono::seconds MIN_REFRESH_INTERVAL(1);
+
+const long BackgroundRefreshingAWSCredentialsProvider::REFRESH_BEFORE_EXPIRATION_MS;
+
+BackgroundRefreshingAWSCredentialsProvider::BackgroundRefreshingAWSCredentialsProvider(long refreshRateMs) :
+    m_loadFrequencyMs(refreshRateMs),
+    m_credentials(nullptr),
+    m_stopRefreshing(false),
+    m_refreshTimerId(0)
+{
+}
+
+BackgroundRefreshingAWSCredentialsProvider::~BackgroundRefreshingAWSCredentialsProvider()
+{
+    StopRefreshing();
+}
+
+AWSCredentials BackgroundRefreshingAWSCredentialsProvider::GetAWSCredentials()
+{
+    auto credentials = std::atomic_load(&m_credentials);
+    if (credentials)
+    {
+        return *credentials;
+    }
+
+    //only the very first caller(s) get here; everyone after that reads the snapshot the background refresh keeps up to date.
+    std::lock_guard<std::mutex> locker(m_initialLoadMutex);
+    credentials = std::atomic_load(&m_credentials);
+    if (!credentials)
+    {
+        AWSCredentials loadedCredentials("", "");
+        LoadCredentials(loadedCredentials);
+        credentials = Aws::MakeShared<AWSCredentials>(refreshingLogTag, loadedCredentials);
+        std::atomic_store(&m_credentials, credentials);
+
+        std::lock_guard<std::mutex> refreshLocker(m_refreshMutex);
+        if (!m_stopRefreshing)
+        {
+            m_refreshTimers = TimerQueue::GetShared();
+            ScheduleRefresh(*credentials);
+        }
+    }
+
+    return *credentials;
+}
+
+void BackgroundRefreshingAWSCredentialsProvider::StopRefreshing()
+{
+    std::shared_ptr<TimerQueue> refreshTimers;
+    TimerQueue::TimerId refreshTimerId = 0;
+    {
+        std::lock_guard<std::mutex> locker(m_refreshMutex);
+        m_stopRefreshing = true;
+        refreshTimers = m_refreshTimers;
+        refreshTimerId = m_refreshTimerId;
+    }
+
+    //a refresh that is running finds m_stopRefreshing set once it is done and doesn't schedule another one
+    if (refreshTimers)
+    {
+        refreshTimers->Cancel(refreshTimerId);
+    }
+
+    std::lock_guard<std::mutex> locker(m_refreshMutex);
+    m_refreshTimers = nullptr;
+}
+
+void BackgroundRefreshingAWSCredentialsProvider::ScheduleRefresh(const AWSCredentials& current)
+{
+    auto now = std::chrono::system_clock::now();
+    std::chrono::system_clock::duration refreshIn = std::chrono::milliseconds(m_loadFrequencyMs);
+    if (current.GetExpiration() != (std::chrono::system_clock::time_point::max)())
+    {
+        //short lived credentials are reloaded ahead of their expiration rather than whenever the interval comes around
+        auto untilExpiration = current.GetExpiration() - now - std::chrono::milliseconds(REFRESH_BEFORE_EXPIRATION_MS);
+        refreshIn = (std::min)(refreshIn, (std::max)(untilExpiration, std::chrono::duration_cast<std::chrono::system_clock::duration>(MIN_REFRESH_INTERVAL)));
+    }
+
+    AWS_LOGSTREAM_DEBUG(refreshingLogTag, "Next credentials refresh in " << std::chrono::duration_cast<std::chrono::milliseconds>(refreshIn).count() << " ms.");
+    m_refreshTimerId = m_refreshTimers->Schedule(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(refreshIn),
+        [this]() { Refresh(); });
+}
+
+void BackgroundRefreshingAWSCredentialsProvider::Refresh()
+{
+    AWS_LOG_DEBUG(refreshingLogTag, "Refreshing credentials in the background.");
+    AWSCredentials loadedCredentials("", "");
+    std::shared_ptr<const AWSCredentials> credentials;
+    if (LoadCredentials(loadedCredentials))
+    {
+        credentials = Aws::MakeShared<AWSCredentials>(refreshingLogTag, loadedCredentials);
+        std::atomic_store(&m_credentials, credentials);
+    }
+    else
+    {
+        AWS_LOG_WARN(refreshingLogTag, "Failed to refresh credentials, keeping the previous ones until the next refresh.");
+        credentials = std::atomic_load(&m_credentials);
+    }
+
+    std::lock_guard<std::mutex> locker(m_refreshMutex);
+    if (!m_stopRefreshing)
+    {
+        ScheduleRefresh(*credentials);
+    }
+}
+
+
 static const char* environmentLogTag = "EnvironmentAWSCredentialsProvider";
 
 
@@ -167,9 +280,8 @@ static const char* profileLogTag = "ProfileConfigFileAWSCredentialsProvider";
 
 
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(long refreshRateMs) :
-        m_fileName(GetProfileFilename()),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
+        m_fileName(GetProfileFilename())
 {
     char* profileFromVar = std::getenv(AWS_PROFILE_ENVIRONMENT_VARIABLE);
     if (profileFromVar)
@@ -187,54 +299,49 @@ ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider
 }
 
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs) :
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
         m_fileName(GetProfileFilename()),
-        m_profileToUse(profile),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_profileToUse(profile)
 {
     AWS_LOGSTREAM_INFO(profileLogTag, "Setting provider to read credentials from " << m_fileName
                                       << ", for use with profile " << m_profileToUse);
 }
 
-AWSCredentials ProfileConfigFileAWSCredentialsProvider::GetAWSCredentials()
+ProfileConfigFileAWSCredentialsProvider::~ProfileConfigFileAWSCredentialsProvider()
 {
-    RefreshIfExpired();
-    assert(m_credentials != nullptr);
-    return *m_credentials;
+    StopRefreshing();
 }
 
 
-void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
+bool ProfileConfigFileAWSCredentialsProvider::LoadCredentials(AWSCredentials& credentials)
 {
-    std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
-    {
-        AWS_LOG_DEBUG(profileLogTag, "Refreshing credentials.");
+    AWS_LOG_DEBUG(profileLogTag, "Refreshing credentials.");
 
-        Aws::Map<Aws::String, Aws::String> propertyValueMap = ParseProfileConfigFile(m_fileName);
+    Aws::Map<Aws::String, Aws::String> propertyValueMap = ParseProfileConfigFile(m_fileName);
 
-        Aws::String accessKey, secretKey, sessionToken;
-        auto accessKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_ACCESS_KEY_ID);
-        auto secretKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SECRET_ACCESS_KEY);
-        auto sessionTokenIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SESSION_TOKEN);
+    Aws::String accessKey, secretKey, sessionToken;
+    auto accessKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_ACCESS_KEY_ID);
+    auto secretKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SECRET_ACCESS_KEY);
+    auto sessionTokenIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SESSION_TOKEN);
 
-        if (accessKeyIter != propertyValueMap.end())
-            accessKey = accessKeyIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Access key for profile not found.");
+    if (accessKeyIter != propertyValueMap.end())
+        accessKey = accessKeyIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Access key for profile not found.");
 
-        if (secretKeyIter != propertyValueMap.end())
-            secretKey = secretKeyIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Secret key for profile not found.");
+    if (secretKeyIter != propertyValueMap.end())
+        secretKey = secretKeyIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Secret key for profile not found.");
 
-        if (sessionTokenIter != propertyValueMap.end())
-            sessionToken = sessionTokenIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
+    if (sessionTokenIter != propertyValueMap.end())
+        sessionToken = sessionTokenIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(profileLogTag, accessKey, secretKey, sessionToken);
-    }
+    //credentials removed from the file are meant to go away, so a parse always replaces the snapshot
+    credentials = AWSCredentials(accessKey, secretKey, sessionToken);
+    return true;
 }
 
 
@@ -286,8 +393,7 @@ Aws::Map<Aws::String, Aws::String> ProfileConfigFileAWSCredentialsProvider::Pars
 static const char* instanceLogTag = "InstanceProfileCredentialsProvider";
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(instanceLogTag, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
 
@@ -297,60 +403,52 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refr
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std::shared_ptr<EC2MetadataClient>& mdClient,
                                                                        long refreshRateMs) :
-        m_metadataClient(mdClient),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
+        m_metadataClient(mdClient)
 {
     AWS_LOGSTREAM_INFO(instanceLogTag, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
 }
 
 
-AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
+InstanceProfileCredentialsProvider::~InstanceProfileCredentialsProvider()
 {
-    RefreshIfExpired();
-    return *m_credentials;
+    StopRefreshing();
 }
 
 
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+bool InstanceProfileCredentialsProvider::LoadCredentials(AWSCredentials& credentials)
 {
-    AWS_LOG_DEBUG(instanceLogTag, "Checking if latest credential pull has expired.");
+    AWS_LOG_INFO(instanceLogTag, "Pulling credentials from EC2 Metadata Service.");
+    Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
 
-    std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
+    if (mdRet.empty())
     {
-        AWS_LOG_INFO(instanceLogTag, "Credentials have expired attempting to repull from EC2 Metadata Service.");
-        Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
-
-        if (mdRet.empty())
-        {
-            AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service, returning empty credentials.");
-            m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, "", "");
-            return;
-        }
+        AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service.");
+        return false;
+    }
 
-        const char* accessKeyId = "AccessKeyId";
-        const char* secretAccessKey = "SecretAccessKey";
-        Aws::String accessKey, secretKey, token;
+    const char* accessKeyId = "AccessKeyId";
+    const char* secretAccessKey = "SecretAccessKey";
 
-        using namespace Aws::Utils::Json;
-        JsonValue jsonValue(mdRet);
+    using namespace Aws::Utils::Json;
+    JsonValue jsonValue(mdRet);
 
-        if (jsonValue.WasParseSuccessful())
-        {
-            accessKey = jsonValue.GetString(accessKeyId);
-            AWS_LOGSTREAM_INFO(instanceLogTag, "Successfully pulled credentials from metadata service with access key " << accessKey);
+    if (!jsonValue.WasParseSuccessful())
+    {
+        AWS_LOGSTREAM_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error " << jsonValue.GetErrorMessage());
+        return false;
+    }
 
-            secretKey = jsonValue.GetString(secretAccessKey);
-            token = jsonValue.GetString("Token");
-        }
-        else
-        {
-            AWS_LOGSTREAM_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error " << jsonValue.GetErrorMessage());
-        }
+    Aws::String accessKey = jsonValue.GetString(accessKeyId);
+    AWS_LOGSTREAM_INFO(instanceLogTag, "Successfully pulled credentials from metadata service with access key " << accessKey);
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, accessKey, secretKey, token);
+    credentials = AWSCredentials(accessKey, jsonValue.GetString(secretAccessKey), jsonValue.GetString("Token"));
+    std::chrono::system_clock::time_point expiration;
+    if (DateTime::ParseISO8601Timestamp(jsonValue.GetString("Expiration"), expiration))
+    {
+        credentials.SetExpiration(expiration);
     }
+    return true;
 }
 
 
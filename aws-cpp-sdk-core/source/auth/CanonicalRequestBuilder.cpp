@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/CanonicalRequestBuilder.h>
+
+#include <aws/core/http/HttpRequest.h>
+
+#include <cctype>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char NEWLINE = '\n';
+static const char* AWS_HMAC_SHA256 = "AWS4-HMAC-SHA256";
+static const char* AWS4_REQUEST = "aws4_request";
+static const char* HEX_DIGITS = "0123456789ABCDEF";
+
+const Aws::String& CanonicalRequestBuilder::BuildCanonicalRequest(const HttpRequest& request, const Aws::String& payloadHash)
+{
+    m_canonicalRequest.clear();
+    m_signedHeaders.clear();
+
+    AppendMethodPathAndQuery(request);
+    request.VisitHeaders([this](const Aws::String& name, const Aws::String& value) { AppendHeader(name, value); });
+    AppendSignedHeadersAndPayloadHash(payloadHash);
+
+    return m_canonicalRequest;
+}
+
+const Aws::String& CanonicalRequestBuilder::BuildCanonicalRequest(const HttpRequest& request, const char* headerName,
+    const Aws::String& headerValue, const Aws::String& payloadHash)
+{
+    m_canonicalRequest.clear();
+    m_signedHeaders.clear();
+
+    AppendMethodPathAndQuery(request);
+    m_canonicalRequest.append(headerName).append(1, ':').append(headerValue).append(1, NEWLINE);
+    m_signedHeaders.append(headerName).append(1, ';');
+    AppendSignedHeadersAndPayloadHash(payloadHash);
+
+    return m_canonicalRequest;
+}
+
+const Aws::String& CanonicalRequestBuilder::BuildStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate,
+    const Aws::String& region, const Aws::String& serviceName, const Aws::String& canonicalRequestHash)
+{
+    m_stringToSign.clear();
+    m_stringToSign.append(AWS_HMAC_SHA256).append(1, NEWLINE);
+    m_stringToSign.append(dateValue).append(1, NEWLINE);
+    m_stringToSign.append(simpleDate).append(1, '/').append(region).append(1, '/').append(serviceName).append(1, '/');
+    m_stringToSign.append(AWS4_REQUEST).append(1, NEWLINE);
+    m_stringToSign.append(canonicalRequestHash);
+
+    return m_stringToSign;
+}
+
+void CanonicalRequestBuilder::AppendMethodPathAndQuery(const HttpRequest& request)
+{
+    m_canonicalRequest.append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod())).append(1, NEWLINE);
+    AppendEncodedPath(request.GetUri().GetPath());
+    m_canonicalRequest.append(1, NEWLINE);
+
+    //the query string still carries its leading '?'. A lone key is signed as "key=".
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
+    {
+        m_canonicalRequest.append(queryString, 1, Aws::String::npos);
+        if (queryString.find('=') == Aws::String::npos)
+        {
+            m_canonicalRequest.append(1, '=');
+        }
+    }
+    m_canonicalRequest.append(1, NEWLINE);
+}
+
+void CanonicalRequestBuilder::AppendEncodedPath(const Aws::String& path)
+{
+    //same result as URI::URLEncodePath: empty segments are dropped, a trailing slash is kept.
+    bool segmentStarted = false;
+    for (char c : path)
+    {
+        if (c == '/')
+        {
+            segmentStarted = false;
+            continue;
+        }
+
+        if (!segmentStarted)
+        {
+            m_canonicalRequest.append(1, '/');
+            segmentStarted = true;
+        }
+
+        int value = c;
+        //MSVC 2015 asserts on negative values in isalnum(), which is what multi byte characters are.
+        if (value >= 0 && (isalnum(value) || c == '-' || c == '_' || c == '.' || c == '~'))
+        {
+            m_canonicalRequest.append(1, c);
+        }
+        else
+        {
+            unsigned char byte = static_cast<unsigned char>(c);
+            m_canonicalRequest.append(1, '%').append(1, HEX_DIGITS[byte >> 4]).append(1, HEX_DIGITS[byte & 0x0F]);
+        }
+    }
+
+    if (path.empty() || path[path.length() - 1] == '/')
+    {
+        m_canonicalRequest.append(1, '/');
+    }
+}
+
+void CanonicalRequestBuilder::AppendHeader(const Aws::String& name, const Aws::String& value)
+{
+    m_canonicalRequest.append(name).append(1, ':').append(value).append(1, NEWLINE);
+    m_signedHeaders.append(name).append(1, ';');
+}
+
+void CanonicalRequestBuilder::AppendSignedHeadersAndPayloadHash(const Aws::String& payloadHash)
+{
+    //remove the last semi-colon
+    if (!m_signedHeaders.empty())
+    {
+        m_signedHeaders.erase(m_signedHeaders.length() - 1);
+    }
+
+    m_canonicalRequest.append(1, NEWLINE);
+    m_canonicalRequest.append(m_signedHeaders).append(1, NEWLINE);
+    m_canonicalRequest.append(payloadHash);
+}
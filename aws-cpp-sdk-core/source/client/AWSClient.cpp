@@ -15,25 +15,39 @@
 
 #include <aws/core/client/AWSClient.h>
 #include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/client/AdaptiveRateLimiter.h>
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/AWSErrorMarshaller.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/HedgingPolicy.h>
+#include <aws/core/client/MetricsPublisher.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/stream/ReadOnlyMemoryStream.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/CancellationToken.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/TimerQueue.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/MultiDigest.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <aws/core/utils/HashingUtils.h>
 
@@ -98,11 +112,16 @@ AWSClient::AWSClient(const std::shared_ptr<Aws::Http::HttpClientFactory const>&
     m_signer(signer),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
+    m_metricsPublisher(configuration.metricsPublisher),
+    m_requestRateLimiter(configuration.requestRateLimiter),
+    m_hedgingPolicy(configuration.hedgingPolicy),
+    m_executor(configuration.executor),
+    m_hedgeTimers(configuration.hedgingPolicy ? Aws::MakeShared<Aws::Utils::Threading::TimerQueue>(LOG_TAG) : nullptr),
+    m_retryTimers(Aws::Utils::Threading::TimerQueue::GetShared()),
     m_writeRateLimiter(configuration.writeRateLimiter),
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
-    m_hostHeaderOverride(hostHeaderOverride),
-    m_hash(Aws::MakeUnique<Aws::Utils::Crypto::MD5>(LOG_TAG))
+    m_hostHeaderOverride(hostHeaderOverride)
 {
     InitializeGlobalStatics();
 }
@@ -122,52 +141,569 @@ void AWSClient::EnableRequestProcessing()
     m_httpClient->EnableRequestProcessing();
 }
 
+size_t AWSClient::WarmUpConnections(const Aws::String& endpoint, size_t connectionCount)
+{
+    return m_httpClient->WarmUpConnections(URI(endpoint), connectionCount);
+}
+
+static std::chrono::microseconds MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+//the caller gave up on the request, there's no point in retrying it.
+static AWSError<CoreErrors> BuildAbandonedRequestError(const std::shared_ptr<Aws::Utils::Threading::CancellationToken>& cancellationToken)
+{
+    if (cancellationToken && cancellationToken->IsCancelled())
+    {
+        return AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "RequestCancelled", "Request was cancelled by the caller", false);
+    }
+
+    return AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "RequestDeadlineExceeded", "Request did not complete before its deadline", false);
+}
+
+//the first byte of a GET for a single "bytes=first-last" or "bytes=first-" range, and its last ("" if open ended), the only reads
+//that can pick up where they broke off.
+static bool ParseResumableRange(const HttpRequest& httpRequest, long long& rangeFirst, Aws::String& rangeLast)
+{
+    static const char BYTES_UNIT[] = "bytes=";
+    if (httpRequest.GetMethod() != HttpMethod::HTTP_GET || !httpRequest.HasHeader(RANGE_HEADER))
+    {
+        return false;
+    }
+
+    const Aws::String& range = httpRequest.GetHeaderValue(RANGE_HEADER);
+    auto separator = range.find('-');
+    if (range.compare(0, sizeof(BYTES_UNIT) - 1, BYTES_UNIT) != 0 || separator == Aws::String::npos || range.find(',') != Aws::String::npos)
+    {
+        return false;
+    }
+
+    Aws::String first = range.substr(sizeof(BYTES_UNIT) - 1, separator - (sizeof(BYTES_UNIT) - 1));
+    rangeLast = range.substr(separator + 1);
+    auto isNumber = [](const Aws::String& value) { return std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; }); };
+    if (first.empty() || !isNumber(first) || !isNumber(rangeLast))
+    {
+        //e.g. a suffix range, "bytes=-500"
+        return false;
+    }
+
+    rangeFirst = StringUtils::ConvertToInt64(first.c_str());
+    return true;
+}
+
+static bool HaveSameETag(const HttpResponse& first, const HttpResponse& second)
+{
+    if (!first.HasHeader(ETAG_HEADER) || !second.HasHeader(ETAG_HEADER))
+    {
+        return !first.HasHeader(ETAG_HEADER) && !second.HasHeader(ETAG_HEADER);
+    }
+    return first.GetHeader(ETAG_HEADER) == second.GetHeader(ETAG_HEADER);
+}
+
+//the headers of the first attempt describe its own range, after the read was resumed they have to describe all of it
+static void DescribeWholeRange(HttpResponse& partialResponse, const HttpResponse& lastResponse, long long rangeFirst)
+{
+    partialResponse.AddHeader(CONTENT_LENGTH_HEADER, StringUtils::to_string(static_cast<long long>(partialResponse.GetResponseBody().tellp())));
+    if (lastResponse.HasHeader(CONTENT_RANGE_HEADER))
+    {
+        //"bytes first-last/total", the resumed attempt started at a later first
+        const Aws::String& lastRange = lastResponse.GetHeader(CONTENT_RANGE_HEADER);
+        auto separator = lastRange.find('-');
+        if (separator != Aws::String::npos)
+        {
+            partialResponse.AddHeader(CONTENT_RANGE_HEADER, "bytes " + StringUtils::to_string(rangeFirst) + lastRange.substr(separator));
+        }
+    }
+}
+
+//folds an attempt of a ranged read into partialResponse, which holds what arrived of the read across the attempts that broke off,
+//and returns what the attempt amounts to for the whole read. An attempt that resumes the read got a scratch body of its own, only
+//payload of the same object is appended to what arrived before.
+static HttpResponseOutcome ResumeRangedRead(HttpResponseOutcome&& outcome, const std::shared_ptr<HttpResponse>& incompleteResponse,
+    std::shared_ptr<HttpResponse>& partialResponse, long long rangeFirst)
+{
+    std::shared_ptr<HttpResponse> received = outcome.IsSuccess() ? outcome.GetResult() : incompleteResponse;
+    if (!received || (!outcome.IsSuccess() && received->GetResponseCode() != HttpResponseCode::PARTIAL_CONTENT))
+    {
+        //nothing of the payload arrived, e.g. an error document, the next attempt picks up from the same place
+        return std::move(outcome);
+    }
+
+    if (!partialResponse)
+    {
+        if (incompleteResponse && incompleteResponse->GetResponseCode() == HttpResponseCode::PARTIAL_CONTENT)
+        {
+            partialResponse = incompleteResponse;
+        }
+        return std::move(outcome);
+    }
+
+    if (received->GetResponseCode() != HttpResponseCode::PARTIAL_CONTENT || !HaveSameETag(*partialResponse, *received))
+    {
+        AWS_LOG_WARN(LOG_TAG, "Object changed while resuming a ranged read, starting it over.");
+        partialResponse = nullptr;
+        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "IncompleteTransfer",
+            "Object changed before the ranged read could be resumed", true));
+    }
+
+    if (received->GetResponseBody().tellp() > 0)
+    {
+        partialResponse->GetResponseBody() << received->GetResponseBody().rdbuf();
+    }
+    partialResponse->GetResponseBody().flush();
+    AWS_LOGSTREAM_DEBUG(LOG_TAG, "Resumed ranged read has " << partialResponse->GetResponseBody().tellp() << " bytes now.");
+
+    if (!outcome.IsSuccess())
+    {
+        return std::move(outcome);
+    }
+
+    partialResponse->SetTransferIncomplete(false);
+    DescribeWholeRange(*partialResponse, *received, rangeFirst);
+    HttpResponseOutcome completed(partialResponse);
+    partialResponse = nullptr;
+    return completed;
+}
+
+namespace Aws
+{
+namespace Client
+{
+
+//what the attempts of one request carry over from one to the next
+struct RequestAttempts
+{
+    RequestAttempts(const std::shared_ptr<HttpRequest>& attemptedRequest, const Aws::AmazonWebServiceRequest* originalRequest,
+        std::chrono::steady_clock::time_point requestStart) :
+        httpRequest(attemptedRequest), request(originalRequest), start(requestStart), body(attemptedRequest->GetContentBody()),
+        bodyStart(body ? body->tellg() : std::streampos(0)), retries(0), previousDelayMillis(0), rangeFirst(0),
+        resumable(ParseResumableRange(*attemptedRequest, rangeFirst, rangeLast)),
+        originalRange(resumable ? attemptedRequest->GetHeaderValue(RANGE_HEADER) : ""),
+        originalResponseStreamFactory(attemptedRequest->GetResponseStreamFactory())
+    {
+        httpRequest->SetKeepIncompleteResponse(resumable);
+    }
+
+    std::shared_ptr<HttpRequest> httpRequest;
+    //what httpRequest was built from, nullptr for payloadless requests
+    const Aws::AmazonWebServiceRequest* request;
+    //the async path holds on to the request and the handler, its caller doesn't wait for it
+    std::shared_ptr<const Aws::AmazonWebServiceRequest> ownedRequest;
+    HttpResponseOutcomeReceivedHandler handler;
+    RequestMetrics metrics;
+    std::chrono::steady_clock::time_point start;
+    //every attempt sends the body from where the first one started
+    std::shared_ptr<Aws::IOStream> body;
+    std::streampos bodyStart;
+    long retries;
+    long previousDelayMillis;
+    //a ranged read that breaks off carries on from where it stopped rather than starting over
+    long long rangeFirst;
+    Aws::String rangeLast;
+    bool resumable;
+    Aws::String originalRange;
+    Aws::IOStreamFactory originalResponseStreamFactory;
+    std::shared_ptr<HttpResponse> partialResponse;
+    //what the last attempt got of a response that broke off
+    std::shared_ptr<HttpResponse> incompleteResponse;
+    //the error the retry strategy last allowed a retry for, until that retry is sent
+    Aws::UniquePtr<AWSError<CoreErrors>> retryError;
+};
+
+} // namespace Client
+} // namespace Aws
+
+std::shared_ptr<HttpRequest> AWSClient::BuildRequestForAttempts(const Aws::String& uri, const Aws::AmazonWebServiceRequest& request,
+    HttpMethod method) const
+{
+    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
+    BuildHttpRequest(request, httpRequest);
+    httpRequest->SetCancellationToken(request.GetCancellationToken());
+    httpRequest->SetDeadline(request.GetDeadline());
+    return httpRequest;
+}
+
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method) const
 {
-    for (long retries = 0;; retries++)
+    auto start = std::chrono::steady_clock::now();
+    //e.g. waited in an executor's queue until after its caller gave up
+    if (request.IsCancelledOrExpired())
+    {
+        AWS_LOG_DEBUG(LOG_TAG, "Request was cancelled or ran past its deadline before it was built, not sending it.");
+        return HttpResponseOutcome(BuildAbandonedRequestError(request.GetCancellationToken()));
+    }
+
+    RequestAttempts attempts(BuildRequestForAttempts(uri, request, method), &request, start);
+    attempts.metrics.serializationTime = MicrosecondsSince(start);
+    return AttemptUntilDone(attempts);
+}
+
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method) const
+{
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
+    AddCommonHeaders(*httpRequest);
+
+    RequestAttempts attempts(httpRequest, nullptr, start);
+    return AttemptUntilDone(attempts);
+}
+
+void AWSClient::AttemptExhaustivelyAsync(const Aws::String& uri, const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    HttpMethod method, const HttpResponseOutcomeReceivedHandler& handler) const
+{
+    if (!m_httpClient->SupportsAsyncRequests())
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, method);
-        if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+        //the http client would hold this thread for the whole request, it's sent from the executor instead
+        RunAfterDelay(std::chrono::milliseconds(0), [this, uri, request, method, handler]() { handler(AttemptExhaustively(uri, *request, method)); });
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (request->IsCancelledOrExpired())
+    {
+        AWS_LOG_DEBUG(LOG_TAG, "Request was cancelled or ran past its deadline before it was built, not sending it.");
+        HandOverAsyncOutcome(handler, HttpResponseOutcome(BuildAbandonedRequestError(request->GetCancellationToken())));
+        return;
+    }
+
+    auto attempts = Aws::MakeShared<RequestAttempts>(LOG_TAG, BuildRequestForAttempts(uri, *request, method), request.get(), start);
+    attempts->metrics.serializationTime = MicrosecondsSince(start);
+    attempts->ownedRequest = request;
+    attempts->handler = handler;
+    SendAttemptAsync(attempts);
+}
+
+HttpResponseOutcome AWSClient::AttemptUntilDone(RequestAttempts& attempts) const
+{
+    RequestMetrics* attemptMetrics = m_metricsPublisher ? &attempts.metrics : nullptr;
+    for (;; attempts.retries++)
+    {
+        if (!PrepareAttempt(attempts) || !WaitForSendToken(*attempts.httpRequest))
         {
-            AWS_LOG_TRACE(LOG_TAG, "Request was either successful, or we are now out of retries.");
-            return outcome;
+            return AbandonAttempts(attempts);
         }
-        else if(!m_httpClient->IsRequestProcessingEnabled())
+
+        HttpResponseOutcome outcome = CollectAttempt(attempts, AttemptOneRequest(attempts.httpRequest, attempts.request, attemptMetrics,
+            attempts.resumable ? &attempts.incompleteResponse : nullptr));
+        long sleepMillis = DecideOnRetry(attempts, outcome);
+        if (sleepMillis < 0)
         {
-            AWS_LOG_TRACE(LOG_TAG, "Request was cancelled externally.");
             return outcome;
         }
-        else
+        SleepForRequest(*attempts.httpRequest, std::chrono::milliseconds(sleepMillis));
+    }
+}
+
+bool AWSClient::PrepareAttempt(RequestAttempts& attempts) const
+{
+    HttpRequest& httpRequest = *attempts.httpRequest;
+    if (httpRequest.IsCancelledOrExpired())
+    {
+        return false;
+    }
+
+    if (attempts.retries > 0 && attempts.body && attempts.bodyStart >= 0)
+    {
+        attempts.body->clear();
+        attempts.body->seekg(attempts.bodyStart);
+    }
+    if (attempts.retries > 0 && attempts.resumable)
+    {
+        const auto& partialResponse = attempts.partialResponse;
+        auto received = partialResponse ? static_cast<long long>(partialResponse->GetResponseBody().tellp()) : 0;
+        httpRequest.SetHeaderValue(RANGE_HEADER,
+            partialResponse ? "bytes=" + StringUtils::to_string(attempts.rangeFirst + received) + "-" + attempts.rangeLast : attempts.originalRange);
+        //a new stream from the caller's factory would start at the beginning of the body again, e.g. of a preallocated buffer,
+        //and whatever the attempt gets, error documents included, would land in it
+        if (partialResponse)
         {
-            long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-            AWS_LOG_WARN(LOG_TAG, "Request failed, now waiting %d ms before attempting again.", sleepMillis);
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            httpRequest.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
         }
     }
+    return true;
 }
 
-HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method) const
+HttpResponseOutcome AWSClient::CollectAttempt(RequestAttempts& attempts, HttpResponseOutcome&& outcome) const
+{
+    //the retry it was held for has been sent
+    attempts.retryError = nullptr;
+    if (!attempts.resumable)
+    {
+        return std::move(outcome);
+    }
+
+    auto incompleteResponse = attempts.incompleteResponse;
+    attempts.incompleteResponse = nullptr;
+    attempts.httpRequest->SetResponseStreamFactory(attempts.originalResponseStreamFactory);
+    return ResumeRangedRead(std::move(outcome), incompleteResponse, attempts.partialResponse, attempts.rangeFirst);
+}
+
+long AWSClient::DecideOnRetry(RequestAttempts& attempts, const HttpResponseOutcome& outcome) const
+{
+    UpdateSendRate(outcome);
+    if (outcome.IsSuccess())
+    {
+        m_retryStrategy->OnRequestSucceeded(attempts.retries);
+    }
+    else if (attempts.httpRequest->IsCancelledOrExpired())
+    {
+        //the transfer was most likely aborted for it, reported before the next attempt rather than retried
+        return 0;
+    }
+
+    if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), attempts.retries))
+    {
+        AWS_LOG_TRACE(LOG_TAG, "Request was either successful, or we are now out of retries.");
+        PublishMetrics(attempts.metrics, outcome, attempts.start);
+        return -1;
+    }
+
+    if (!m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOG_TRACE(LOG_TAG, "Request was cancelled externally.");
+        m_retryStrategy->OnRetryAbandoned(outcome.GetError(), attempts.retries);
+        PublishMetrics(attempts.metrics, outcome, attempts.start);
+        return -1;
+    }
+
+    long sleepMillis = m_retryStrategy->CalculateDelayAfterPreviousDelay(outcome.GetError(), attempts.retries, attempts.previousDelayMillis);
+    attempts.previousDelayMillis = sleepMillis;
+    AWS_LOG_WARN(LOG_TAG, "Request failed, now waiting %d ms before attempting again.", sleepMillis);
+    attempts.metrics.retryDelays.push_back(std::chrono::milliseconds(sleepMillis));
+    attempts.retryError = Aws::MakeUnique<AWSError<CoreErrors>>(LOG_TAG, outcome.GetError());
+    return sleepMillis;
+}
+
+HttpResponseOutcome AWSClient::AbandonAttempts(RequestAttempts& attempts) const
 {
-    for (long retries = 0;; retries++)
+    AWS_LOG_DEBUG(LOG_TAG, "Request was cancelled or ran past its deadline, not sending it again.");
+    if (attempts.retryError)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, method);
-        if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+        m_retryStrategy->OnRetryAbandoned(*attempts.retryError, attempts.retries - 1);
+    }
+    HttpResponseOutcome outcome(BuildAbandonedRequestError(attempts.httpRequest->GetCancellationToken()));
+    PublishMetrics(attempts.metrics, outcome, attempts.start);
+    return outcome;
+}
+
+void AWSClient::SendAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const
+{
+    if (!PrepareAttempt(*attempts))
+    {
+        HandOverAsyncOutcome(attempts->handler, AbandonAttempts(*attempts));
+        return;
+    }
+
+    auto sendDelay = m_requestRateLimiter ? m_requestRateLimiter->AcquireSendToken() : std::chrono::milliseconds(0);
+    if (sendDelay.count() > 0)
+    {
+        AWS_LOGSTREAM_DEBUG(LOG_TAG, "Service is throttling, waiting " << sendDelay.count() << " ms before sending.");
+        RunAfterDelay(GetDelayForRequest(*attempts->httpRequest, sendDelay), [this, attempts]() { SendPreparedAttemptAsync(attempts); });
+        return;
+    }
+    SendPreparedAttemptAsync(attempts);
+}
+
+void AWSClient::SendPreparedAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const
+{
+    if (attempts->httpRequest->IsCancelledOrExpired())
+    {
+        HandOverAsyncOutcome(attempts->handler, AbandonAttempts(*attempts));
+        return;
+    }
+
+    RequestMetrics* attemptMetrics = m_metricsPublisher ? &attempts->metrics : nullptr;
+    if (!SignAttempt(*attempts->httpRequest, attemptMetrics))
+    {
+        ContinueAfterAttemptAsync(attempts, HttpResponseOutcome()); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+        return;
+    }
+
+    //called on the http client's event loop, anything that takes a while is handed on to the executor from here
+    m_httpClient->MakeRequestAsync(attempts->httpRequest, [this, attempts, attemptMetrics](const std::shared_ptr<HttpRequest>& httpRequest,
+        const std::shared_ptr<HttpResponse>& httpResponse)
+    {
+        ContinueAfterAttemptAsync(attempts, EvaluateAttempt(*httpRequest, attempts->request, attemptMetrics, httpResponse,
+            attempts->resumable ? &attempts->incompleteResponse : nullptr));
+    }, m_readRateLimiter.get(), m_writeRateLimiter.get());
+}
+
+void AWSClient::ContinueAfterAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts, HttpResponseOutcome&& attemptOutcome) const
+{
+    HttpResponseOutcome outcome = CollectAttempt(*attempts, std::move(attemptOutcome));
+    long sleepMillis = DecideOnRetry(*attempts, outcome);
+    if (sleepMillis < 0)
+    {
+        HandOverAsyncOutcome(attempts->handler, std::move(outcome));
+        return;
+    }
+
+    attempts->retries++;
+    RunAfterDelay(GetDelayForRequest(*attempts->httpRequest, std::chrono::milliseconds(sleepMillis)), [this, attempts]() { SendAttemptAsync(attempts); });
+}
+
+void AWSClient::RunAfterDelay(std::chrono::milliseconds delay, std::function<void()>&& task) const
+{
+    std::function<void()> submitTask = [this, task]()
+    {
+        if (!m_executor || !m_executor->Submit(task))
         {
-            return outcome;
+            task();
         }
-        else
+    };
+
+    if (delay.count() > 0)
+    {
+        m_retryTimers->Schedule(std::chrono::steady_clock::now() + delay, std::move(submitTask));
+    }
+    else
+    {
+        submitTask();
+    }
+}
+
+void AWSClient::HandOverAsyncOutcome(const HttpResponseOutcomeReceivedHandler& handler, HttpResponseOutcome&& outcome) const
+{
+    //the handler parses the response and runs the caller's code, neither belongs on the http client's event loop
+    auto sharedOutcome = Aws::MakeShared<HttpResponseOutcome>(LOG_TAG, std::move(outcome));
+    RunAfterDelay(std::chrono::milliseconds(0), [handler, sharedOutcome]() { handler(std::move(*sharedOutcome)); });
+}
+
+std::chrono::milliseconds AWSClient::GetDelayForRequest(const HttpRequest& httpRequest, std::chrono::milliseconds sleepTime) const
+{
+    //no point in waiting past the deadline, the request won't be sent after it anyway
+    if (httpRequest.GetDeadline() != std::chrono::steady_clock::time_point::max())
+    {
+        auto remaining = httpRequest.GetDeadline() - std::chrono::steady_clock::now();
+        //rounded up, waking just short of the deadline would send one more attempt
+        auto untilDeadline = std::chrono::duration_cast<std::chrono::milliseconds>(remaining);
+        if (untilDeadline < remaining)
         {
-            long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            untilDeadline += std::chrono::milliseconds(1);
         }
+        sleepTime = (std::max)(std::chrono::milliseconds(0), (std::min)(sleepTime, untilDeadline));
+    }
+    return sleepTime;
+}
+
+void AWSClient::SleepForRequest(const HttpRequest& httpRequest, std::chrono::milliseconds sleepTime) const
+{
+    sleepTime = GetDelayForRequest(httpRequest, sleepTime);
+
+    //wakes up when the request is cancelled, DisableRequestProcessing() is checked right after
+    const auto& cancellationToken = httpRequest.GetCancellationToken();
+    if (cancellationToken)
+    {
+        cancellationToken->WaitForCancellation(sleepTime);
+    }
+    else
+    {
+        m_httpClient->RetryRequestSleep(sleepTime);
     }
 }
 
+bool AWSClient::WaitForSendToken(const HttpRequest& httpRequest) const
+{
+    if (!m_requestRateLimiter)
+    {
+        return true;
+    }
+
+    auto sendDelay = m_requestRateLimiter->AcquireSendToken();
+    if (sendDelay.count() > 0)
+    {
+        AWS_LOGSTREAM_DEBUG(LOG_TAG, "Service is throttling, waiting " << sendDelay.count() << " ms before sending.");
+        SleepForRequest(httpRequest, sendDelay);
+        return !httpRequest.IsCancelledOrExpired();
+    }
+    return true;
+}
+
+void AWSClient::UpdateSendRate(const HttpResponseOutcome& outcome) const
+{
+    if (m_requestRateLimiter)
+    {
+        m_requestRateLimiter->UpdateSendRate(!outcome.IsSuccess() && CoreErrorsMapper::IsThrottlingError(outcome.GetError()));
+    }
+}
+
+void AWSClient::PublishMetrics(RequestMetrics& metrics, const HttpResponseOutcome& outcome, std::chrono::steady_clock::time_point start) const
+{
+    if (!m_metricsPublisher)
+    {
+        return;
+    }
+
+    metrics.serviceName = m_signer->GetServiceName();
+    metrics.succeeded = outcome.IsSuccess();
+    metrics.endToEndLatency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    m_metricsPublisher->PublishRequestMetrics(metrics);
+}
+
+//names the operation after the request itself, json protocol services name it in x-amz-target, everything else falls back to the http method.
+static Aws::String GetOperationName(const Aws::AmazonWebServiceRequest* request, const HttpRequest& httpRequest)
+{
+    const char* requestName = request ? request->GetServiceRequestName() : nullptr;
+    if (requestName)
+    {
+        return requestName;
+    }
+
+    if (httpRequest.HasHeader(AMZ_TARGET_HEADER))
+    {
+        const Aws::String& target = httpRequest.GetHeaderValue(AMZ_TARGET_HEADER);
+        auto separator = target.rfind('.');
+        return separator == Aws::String::npos ? target : target.substr(separator + 1);
+    }
+
+    return HttpMethodMapper::GetNameForHttpMethod(httpRequest.GetMethod());
+}
+
+//adds what one attempt sent and received to metrics.
+static void RecordAttempt(RequestMetrics& metrics, const Aws::AmazonWebServiceRequest* request, const HttpRequest& httpRequest,
+    const std::shared_ptr<HttpResponse>& httpResponse)
+{
+    if (metrics.attemptCount++ == 0)
+    {
+        metrics.operationName = GetOperationName(request, httpRequest);
+    }
+
+    if (httpRequest.HasHeader(CONTENT_LENGTH_HEADER))
+    {
+        metrics.bytesSent += StringUtils::ConvertToInt64(httpRequest.GetHeaderValue(CONTENT_LENGTH_HEADER).c_str());
+    }
+
+    if (httpResponse)
+    {
+        metrics.httpStatus = httpResponse->GetResponseCode();
+        metrics.lastAttemptTimings = httpResponse->GetRequestTimings();
+        auto received = httpResponse->GetResponseBody().tellp();
+        if (received > 0)
+        {
+            metrics.bytesReceived += static_cast<uint64_t>(received);
+        }
+    }
+    else
+    {
+        metrics.httpStatus = HttpResponseCode::REQUEST_NOT_MADE;
+        metrics.lastAttemptTimings = RequestTimings();
+    }
+}
+
+//results only carry the payload, headers and code by construction, this adds where the request's time went.
+template<typename PAYLOAD_TYPE>
+static AmazonWebServiceResult<PAYLOAD_TYPE> WithRequestTimings(AmazonWebServiceResult<PAYLOAD_TYPE>&& result, const HttpResponse& httpResponse)
+{
+    result.SetRequestTimings(httpResponse.GetRequestTimings());
+    return std::move(result);
+}
+
 static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& response)
 {
-    if (!response) return true;
+    if (!response || response->IsTransferIncomplete()) return true;
 
     int responseCode = static_cast<int>(response->GetResponseCode());
     return response == nullptr || responseCode < SUCCESS_RESPONSE_MIN || responseCode > SUCCESS_RESPONSE_MAX;
@@ -175,27 +711,67 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 }
 
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    HttpMethod method) const
+bool AWSClient::SignAttempt(HttpRequest& httpRequest, RequestMetrics* metrics) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
-    BuildHttpRequest(request, httpRequest);
+    auto signingStart = std::chrono::steady_clock::now();
+    bool wasSigned = m_signer->SignRequest(httpRequest);
+    if (metrics)
+    {
+        metrics->signingTime += MicrosecondsSince(signingStart);
+    }
 
-    if (!m_signer->SignRequest(*httpRequest))
+    if (!wasSigned)
     {
         AWS_LOG_ERROR(LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+        return false;
     }
 
     AWS_LOG_DEBUG(LOG_TAG, "Request Successfully signed");
-    std::shared_ptr<HttpResponse> httpResponse(
+    return true;
+}
+
+HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
+    const Aws::AmazonWebServiceRequest* request, RequestMetrics* metrics, std::shared_ptr<HttpResponse>* incompleteResponse) const
+{
+    if (!SignAttempt(*httpRequest, metrics))
+    {
+        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+    }
+
+    std::shared_ptr<HttpResponse> httpResponse(IsHedgeable(*httpRequest, request) ? MakeHedgeableRequest(httpRequest) :
         m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    return EvaluateAttempt(*httpRequest, request, metrics, httpResponse, incompleteResponse);
+}
+
+HttpResponseOutcome AWSClient::EvaluateAttempt(const HttpRequest& httpRequest, const Aws::AmazonWebServiceRequest* request,
+    RequestMetrics* metrics, const std::shared_ptr<HttpResponse>& httpResponse, std::shared_ptr<HttpResponse>* incompleteResponse) const
+{
+    if (metrics)
+    {
+        RecordAttempt(*metrics, request, httpRequest, httpResponse);
+    }
+
+    if (httpResponse && httpResponse->IsTransferIncomplete())
+    {
+        //the body is what arrived of the payload, not an error document
+        AWS_LOG_DEBUG(LOG_TAG, "Transfer broke off before the whole response arrived.");
+        if (incompleteResponse)
+        {
+            *incompleteResponse = httpResponse;
+        }
+        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "IncompleteTransfer",
+            "Transfer broke off before the whole response arrived", true));
+    }
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOG_DEBUG(LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        AWSError<CoreErrors> error = BuildAWSError(httpResponse);
+        if (httpResponse)
+        {
+            error.SetRequestTimings(httpResponse->GetRequestTimings());
+        }
+        return HttpResponseOutcome(error);
     }
 
     AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
@@ -203,30 +779,309 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
     return HttpResponseOutcome(httpResponse);
 }
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method) const
+bool AWSClient::IsHedgeable(const HttpRequest& httpRequest, const Aws::AmazonWebServiceRequest* request) const
+{
+    if (!m_hedgingPolicy || httpRequest.GetContentBodyEncoder())
+    {
+        //chunked signing chains each chunk's signature to the one before, a copy can't be sent alongside
+        return false;
+    }
+
+    HttpMethod method = httpRequest.GetMethod();
+    return method == HttpMethod::HTTP_GET || method == HttpMethod::HTTP_HEAD || (request && request->IsIdempotent());
+}
+
+namespace Aws
+{
+namespace Client
 {
-    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
-    AddCommonHeaders(*httpRequest);
 
-    if (!m_signer->SignRequest(*httpRequest))
+//what the primary attempt, the hedge and the timer that sends it share. The primary is the caller's own request, sent from the
+//caller's thread into the caller's stream; only a hedge has a request and a stream of its own.
+struct HedgedRequestState
+{
+    HedgedRequestState() : receivingAttempt(-1), bodyBytesSent(0), bodyLength(0), bodyStart(0), primaryDone(false), hedgeStarted(false), hedgeDone(false) {}
+
+    std::mutex stateMutex;
+    std::condition_variable stateChanged;
+    //the first attempt any response data arrived for, 0 for the primary, 1 for the hedge, -1 until then
+    std::atomic<int> receivingAttempt;
+    //how much of the request body the primary attempt has sent
+    std::atomic<long long> bodyBytesSent;
+    //-1 if the request doesn't say
+    long long bodyLength;
+    std::streampos bodyStart;
+    //what the caller had set on the request before the primary was given its own
+    std::shared_ptr<Aws::Utils::Threading::CancellationToken> callerToken;
+    DataReceivedEventHandler dataReceivedHandler;
+    //the primary's token for this attempt only, the hedge calls the primary off with it when it answers first
+    std::shared_ptr<Aws::Utils::Threading::CancellationToken> primaryToken;
+    //set once the primary is back, no hedge goes out after that
+    bool primaryDone;
+    //null unless a hedge was sent
+    std::shared_ptr<HttpRequest> hedge;
+    //claimed by whichever of an executor thread and the waiting caller gets to it first
+    std::atomic<bool> hedgeStarted;
+    bool hedgeDone;
+    std::shared_ptr<HttpResponse> hedgeResponse;
+};
+
+} // namespace Client
+} // namespace Aws
+
+//the client's own measurement if it has one, otherwise until the whole response was in.
+static void RecordFirstByteLatency(HedgingPolicy& policy, const std::shared_ptr<HttpResponse>& httpResponse, std::chrono::steady_clock::time_point start)
+{
+    if (!httpResponse)
     {
-        AWS_LOG_ERROR(LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+        //says nothing about how long the service takes
+        return;
     }
 
-    AWS_LOG_DEBUG(LOG_TAG, "Request Successfully signed");
-    std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    auto firstByteReceived = httpResponse->GetRequestTimings().firstByteReceived;
+    policy.RecordFirstByteLatency(firstByteReceived.count() > 0 ? firstByteReceived : MicrosecondsSince(start));
+}
 
-    if (DoesResponseGenerateError(httpResponse))
+//the body the primary attempt sent, read again from where it started. The primary is done with the stream by then and finds it where it left it.
+static std::shared_ptr<Aws::IOStream> CopyBodyForHedge(Aws::IOStream& body, std::streampos bodyStart)
+{
+    auto sentUpTo = body.tellg();
+    auto bodyCopy = Aws::MakeShared<Aws::StringStream>(LOG_TAG);
+    body.clear();
+    body.seekg(bodyStart);
+    *bodyCopy << body.rdbuf();
+    body.clear();
+    body.seekg(sentUpTo);
+    return bodyCopy;
+}
+
+//the caller's handler only hears about the attempt that started receiving first.
+//the state holds on to the hedge, so the attempts only get a weak reference back to it.
+static DataReceivedEventHandler ReportFirstReceivingAttempt(const std::weak_ptr<HedgedRequestState>& weakState, int attemptIndex,
+    const DataReceivedEventHandler& dataReceivedHandler)
+{
+    return [weakState, attemptIndex, dataReceivedHandler](const HttpRequest* request, HttpResponse* response, long long bytes)
     {
-        AWS_LOG_DEBUG(LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        auto state = weakState.lock();
+        if (!state)
+        {
+            return;
+        }
+
+        int receivingAttempt = -1;
+        if (state->receivingAttempt.compare_exchange_strong(receivingAttempt, attemptIndex))
+        {
+            receivingAttempt = attemptIndex;
+        }
+
+        if (dataReceivedHandler && receivingAttempt == attemptIndex)
+        {
+            dataReceivedHandler(request, response, bytes);
+        }
+    };
+}
+
+//a copy of the signed httpRequest with a cancellation token of its own, so it can be sent and called off independently.
+//its response goes to a scratch stream, the caller's stream only gets its body if it answers first.
+static std::shared_ptr<HttpRequest> CopyForHedge(const HttpClientFactory& clientFactory, const HttpRequest& httpRequest,
+    const std::shared_ptr<Aws::IOStream>& body, const std::shared_ptr<HedgedRequestState>& state)
+{
+    auto hedge = clientFactory.CreateHttpRequest(httpRequest.GetUri(), httpRequest.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    for (const auto& header : httpRequest.GetHeaders())
+    {
+        hedge->SetHeaderValue(header.first, header.second);
+    }
+    if (body)
+    {
+        hedge->AddContentBody(body);
     }
+    hedge->SetCancellationToken(Aws::MakeShared<Aws::Utils::Threading::CancellationToken>(LOG_TAG, state->callerToken));
+    hedge->SetDeadline(httpRequest.GetDeadline());
+    hedge->SetDataReceivedEventHandler(ReportFirstReceivingAttempt(state, 1, state->dataReceivedHandler));
+    return hedge;
+}
 
-    AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
+//sends the hedge unless the caller has given up on it already, and calls the primary off once it has an answer.
+static void RunHedge(const HttpClient& httpClient, HedgedRequestState& state,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter)
+{
+    bool started = false;
+    if (!state.hedgeStarted.compare_exchange_strong(started, true))
+    {
+        return;
+    }
 
-    return HttpResponseOutcome(httpResponse);
+    //one that lost before it got going isn't sent at all
+    auto response = state.hedge->IsCancelledOrExpired() ? nullptr : httpClient.MakeRequest(*state.hedge, readLimiter, writeLimiter);
+    {
+        std::lock_guard<std::mutex> locker(state.stateMutex);
+        if (!DoesResponseGenerateError(response))
+        {
+            state.primaryToken->Cancel();
+        }
+        state.hedgeResponse = response;
+        state.hedgeDone = true;
+    }
+    state.stateChanged.notify_all();
+}
+
+//the hedge's response as the answer to httpRequest, with its body copied into a stream from the caller's factory.
+static std::shared_ptr<HttpResponse> AnswerWithHedge(const HttpRequest& httpRequest, const std::shared_ptr<HttpResponse>& hedgeResponse)
+{
+    auto httpResponse = Aws::MakeShared<Standard::StandardHttpResponse>(LOG_TAG, httpRequest);
+    httpResponse->SetResponseCode(hedgeResponse->GetResponseCode());
+    for (const auto& header : hedgeResponse->GetHeaders())
+    {
+        httpResponse->AddHeader(header.first, header.second);
+    }
+    httpResponse->SetRequestTimings(hedgeResponse->GetRequestTimings());
+    httpResponse->SetTransferIncomplete(hedgeResponse->IsTransferIncomplete());
+
+    auto& hedgeBody = hedgeResponse->GetResponseBody();
+    if (hedgeBody.peek() != std::char_traits<char>::eof())
+    {
+        httpResponse->GetResponseBody() << hedgeBody.rdbuf();
+    }
+    return httpResponse;
+}
+
+void AWSClient::SendHedge(const std::shared_ptr<HttpRequest>& httpRequest, const std::shared_ptr<HedgedRequestState>& state) const
+{
+    {
+        std::lock_guard<std::mutex> locker(state->stateMutex);
+        if (state->primaryDone || state->receivingAttempt.load() >= 0)
+        {
+            return;
+        }
+        //without a length there is no telling when the primary is through with the body, and no hedge
+        if (state->bodyLength < 0 || state->bodyBytesSent.load() < state->bodyLength)
+        {
+            AWS_LOG_DEBUG(LOG_TAG, "Request still sending its body at the hedge delay, not hedging it.");
+            return;
+        }
+        if (!m_hedgingPolicy->TryAcquireHedge())
+        {
+            return;
+        }
+
+        AWS_LOG_DEBUG(LOG_TAG, "No response yet, sending a hedged copy of the request.");
+        auto hedgeBody = state->bodyLength > 0 ? CopyBodyForHedge(*httpRequest->GetContentBody(), state->bodyStart) : nullptr;
+        state->hedge = CopyForHedge(*m_clientFactory, *httpRequest, hedgeBody, state);
+    }
+
+    //the task holds on to everything it uses, should the client be gone before a hedge that lost is done
+    auto httpClient = m_httpClient;
+    auto readLimiter = m_readRateLimiter;
+    auto writeLimiter = m_writeRateLimiter;
+    if (!m_executor || !m_executor->Submit([=]() { RunHedge(*httpClient, *state, readLimiter.get(), writeLimiter.get()); }))
+    {
+        //the caller finds it never started and doesn't wait for it
+        AWS_LOG_DEBUG(LOG_TAG, "Executor turned the hedge down.");
+    }
+}
+
+std::shared_ptr<HttpResponse> AWSClient::MakeHedgeableRequest(const std::shared_ptr<HttpRequest>& httpRequest) const
+{
+    auto start = std::chrono::steady_clock::now();
+    m_hedgingPolicy->OnHedgeableRequest();
+    if (!m_hedgingPolicy->HasEnoughSamples())
+    {
+        //nothing to tell a slow request from a normal one yet
+        auto httpResponse = m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get());
+        RecordFirstByteLatency(*m_hedgingPolicy, httpResponse, start);
+        return httpResponse;
+    }
+
+    auto state = Aws::MakeShared<HedgedRequestState>(LOG_TAG);
+    const auto& body = httpRequest->GetContentBody();
+    if (body)
+    {
+        state->bodyStart = body->tellg();
+        state->bodyLength = httpRequest->HasHeader(Http::CONTENT_LENGTH_HEADER) ?
+            StringUtils::ConvertToInt64(httpRequest->GetHeaderValue(Http::CONTENT_LENGTH_HEADER).c_str()) : -1;
+    }
+
+    //the primary is the caller's request itself, for this attempt with a token the hedge can call it off with and handlers that
+    //keep track of it. They are put back once it is done.
+    auto callerToken = httpRequest->GetCancellationToken();
+    auto dataReceivedHandler = httpRequest->GetDataReceivedEventHandler();
+    auto dataSentHandler = httpRequest->GetDataSentEventHandler();
+    state->callerToken = callerToken;
+    state->dataReceivedHandler = dataReceivedHandler;
+    state->primaryToken = Aws::MakeShared<Aws::Utils::Threading::CancellationToken>(LOG_TAG, callerToken);
+    httpRequest->SetCancellationToken(state->primaryToken);
+    std::weak_ptr<HedgedRequestState> weakState(state);
+    httpRequest->SetDataReceivedEventHandler(ReportFirstReceivingAttempt(weakState, 0, dataReceivedHandler));
+    httpRequest->SetDataSentEventHandler([weakState, dataSentHandler](const HttpRequest* request, long long bytes)
+    {
+        if (dataSentHandler)
+        {
+            dataSentHandler(request, bytes);
+        }
+        auto state = weakState.lock();
+        if (state)
+        {
+            state->bodyBytesSent += bytes;
+        }
+    });
+
+    auto hedgeTimerId = m_hedgeTimers->Schedule(start + m_hedgingPolicy->GetHedgeDelay(), [this, httpRequest, state]() { SendHedge(httpRequest, state); });
+    auto primaryResponse = m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get());
+    {
+        std::lock_guard<std::mutex> locker(state->stateMutex);
+        state->primaryDone = true;
+    }
+    //waits for the timer if it is sending the hedge right now, so the hedge is either out or won't go out after this
+    m_hedgeTimers->Cancel(hedgeTimerId);
+
+    httpRequest->SetCancellationToken(callerToken);
+    httpRequest->SetDataReceivedEventHandler(dataReceivedHandler);
+    httpRequest->SetDataSentEventHandler(dataSentHandler);
+
+    std::shared_ptr<HttpRequest> hedge;
+    {
+        std::lock_guard<std::mutex> locker(state->stateMutex);
+        hedge = state->hedge;
+    }
+    bool primaryCalledOff = state->primaryToken->IsCancelled() && !(callerToken && callerToken->IsCancelled());
+    if (!primaryCalledOff)
+    {
+        RecordFirstByteLatency(*m_hedgingPolicy, primaryResponse, start);
+    }
+
+    if (!hedge || !DoesResponseGenerateError(primaryResponse))
+    {
+        if (hedge)
+        {
+            hedge->GetCancellationToken()->Cancel();
+        }
+        return primaryResponse;
+    }
+
+    bool hedgeStarted = false;
+    if (state->hedgeStarted.compare_exchange_strong(hedgeStarted, true))
+    {
+        //still queued, e.g. behind this very thread on an executor with a single worker. Nothing is gained from sending it now.
+        AWS_LOG_DEBUG(LOG_TAG, "Hedge was still queued when the request failed, not sending it.");
+        return primaryResponse;
+    }
+
+    std::unique_lock<std::mutex> locker(state->stateMutex);
+    state->stateChanged.wait(locker, [&]() { return state->hedgeDone; });
+    if (DoesResponseGenerateError(state->hedgeResponse))
+    {
+        //the primary's failure is reported the way it would have been without hedging
+        return primaryResponse;
+    }
+
+    if (primaryCalledOff)
+    {
+        //the primary took at least this long
+        m_hedgingPolicy->RecordFirstByteLatency(MicrosecondsSince(start));
+    }
+    AWS_LOGSTREAM_DEBUG(LOG_TAG, "Hedged request answered first after " << MicrosecondsSince(start).count() << " us.");
+    m_hedgingPolicy->OnHedgeWon();
+    return AnswerWithHedge(*httpRequest, state->hedgeResponse);
 }
 
 StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
@@ -236,9 +1091,10 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
     HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method);
     if (httpResponseOutcome.IsSuccess())
     {
-        return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
+        return StreamOutcome(WithRequestTimings(AmazonWebServiceResult<Stream::ResponseStream>(
             httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
-            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()));
+            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()),
+            *httpResponseOutcome.GetResult()));
     }
 
     return StreamOutcome(httpResponseOutcome.GetError());
@@ -273,9 +1129,19 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
     if (body && !httpRequest->HasHeader(Http::CONTENT_LENGTH_HEADER))
     {
         AWS_LOG_TRACE(LOG_TAG, "Found body, but content-length has not been set, attempting to compute content-length");
-        body->seekg(0, body->end);
-        auto streamSize = body->tellg();
-        body->seekg(0, body->beg);
+        std::streamoff streamSize = 0;
+        //a body sent straight from memory already knows its size
+        auto memoryStream = dynamic_cast<Aws::Utils::Stream::ReadOnlyMemoryStream*>(body.get());
+        if (memoryStream)
+        {
+            streamSize = static_cast<std::streamoff>(memoryStream->GetSize());
+        }
+        else
+        {
+            body->seekg(0, body->end);
+            streamSize = body->tellg();
+            body->seekg(0, body->beg);
+        }
         if (streamSize > 0)
         {
             Aws::StringStream ss;
@@ -289,11 +1155,30 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
         AWS_LOGSTREAM_TRACE(LOG_TAG, "Found body, and content-md5 needs to be set" <<
            ", attempting to compute content-md5");
 
-        //changing the internal state of the hash computation is not a logical state
-        //change as far as constness goes for this class. Due to the platform specificness
-        //of hash computations, we can't control the fact that computing a hash mutates
-        //state on some platforms such as windows (but that isn't a concern of this class.
-        auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
+        //unless the body is signed chunk by chunk, the signer is going to need its sha256 as well,
+        //so compute both while the body is read for the md5 rather than reading it twice.
+        bool needsSha256 = httpRequest->GetContentSha256Digest().GetLength() == 0 &&
+            !(httpRequest->HasHeader(Http::X_AMZ_CONTENT_SHA256_HEADER) &&
+              httpRequest->GetHeaderValue(Http::X_AMZ_CONTENT_SHA256_HEADER) == STREAMING_PAYLOAD_SHA256);
+        if (needsSha256)
+        {
+            Aws::Utils::Crypto::MultiDigest digests({ Aws::MakeShared<Aws::Utils::Crypto::MD5>(LOG_TAG),
+                Aws::MakeShared<Aws::Utils::Crypto::Sha256>(LOG_TAG) });
+            auto hashResults = digests.Calculate(*body);
+            if (hashResults[0].IsSuccess() && hashResults[1].IsSuccess())
+            {
+                httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(hashResults[0].GetResult()));
+                httpRequest->SetContentSha256Digest(hashResults[1].GetResult());
+                return;
+            }
+
+            //e.g. a hash factory whose hashes can't keep a running digest. The signer hashes the body itself.
+            AWS_LOGSTREAM_DEBUG(LOG_TAG, "Single pass md5 and sha256 failed, computing content-md5 on its own");
+        }
+
+        //each call gets its own hash context, so any number of threads can share this client.
+        Aws::Utils::Crypto::MD5 md5;
+        auto md5HashResult = md5.Calculate(*body);
         if(md5HashResult.IsSuccess())
         {
             httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
@@ -306,6 +1191,11 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
 {
     //do headers first since the request likely will set content-length as it's own header.
     AddHeadersToRequest(httpRequest, request.GetHeaders());
+    if (request.ShouldSignBodyInChunks() && request.GetBody())
+    {
+        httpRequest->SetHeaderValue(Http::X_AMZ_CONTENT_SHA256_HEADER, STREAMING_PAYLOAD_SHA256);
+    }
+    httpRequest->SetContentSha256Digest(request.GetContentSha256Digest());
     AddContentBodyToRequest(httpRequest, request.GetBody(), request.ShouldComputeContentMd5());
 
     // Pass along handlers for processing data sent/received in bytes
@@ -346,11 +1236,8 @@ AWSJsonClient::AWSJsonClient(const std::shared_ptr<Aws::Http::HttpClientFactory
 {
 }
 
-JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method) const
+JsonOutcome AWSJsonClient::BuildJsonOutcome(HttpResponseOutcome&& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(httpOutcome.GetError());
@@ -358,12 +1245,30 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
+        return JsonOutcome(WithRequestTimings(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
         httpOutcome.GetResult()->GetHeaders(),
-        httpOutcome.GetResult()->GetResponseCode()));
+        httpOutcome.GetResult()->GetResponseCode()), *httpOutcome.GetResult()));
 
     else
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+        return JsonOutcome(WithRequestTimings(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()), *httpOutcome.GetResult()));
+}
+
+JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method) const
+{
+    return BuildJsonOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
+}
+
+void AWSJsonClient::MakeRequestAsync(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::function<void(JsonOutcome&&)>& handler,
+    Http::HttpMethod method) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, [handler](HttpResponseOutcome&& httpOutcome)
+    {
+        handler(BuildJsonOutcome(std::move(httpOutcome)));
+    });
 }
 
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
@@ -384,12 +1289,12 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
         }
 
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
+        return JsonOutcome(WithRequestTimings(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
             httpOutcome.GetResult()->GetHeaders(),
-            httpOutcome.GetResult()->GetResponseCode()));
+            httpOutcome.GetResult()->GetResponseCode()), *httpOutcome.GetResult()));
     }
 
-    return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    return JsonOutcome(WithRequestTimings(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()), *httpOutcome.GetResult()));
 }
 
 const char* MESSAGE_LOWER_CASE = "message";
@@ -445,11 +1350,8 @@ AWSXMLClient::AWSXMLClient(const std::shared_ptr<Aws::Http::HttpClientFactory co
 {
 }
 
-XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method) const
+XmlOutcome AWSXMLClient::BuildXmlOutcome(HttpResponseOutcome&& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
     if (!httpOutcome.IsSuccess())
     {
         return XmlOutcome(httpOutcome.GetError());
@@ -465,11 +1367,29 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
             return AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", xmlDoc.GetErrorMessage(), false);
         }
 
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
-            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
+        return XmlOutcome(WithRequestTimings(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()), *httpOutcome.GetResult()));
     }
 
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+    return XmlOutcome(WithRequestTimings(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()), *httpOutcome.GetResult()));
+}
+
+XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method) const
+{
+    return BuildXmlOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::function<void(XmlOutcome&&)>& handler,
+    Http::HttpMethod method) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, [handler](HttpResponseOutcome&& httpOutcome)
+    {
+        handler(BuildXmlOutcome(std::move(httpOutcome)));
+    });
 }
 
 XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
@@ -483,12 +1403,12 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
+        return XmlOutcome(WithRequestTimings(AmazonWebServiceResult<XmlDocument>(
             XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
-            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()), *httpOutcome.GetResult()));
     }
 
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+    return XmlOutcome(WithRequestTimings(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()), *httpOutcome.GetResult()));
 }
 
 AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::HttpResponse>& httpResponse) const
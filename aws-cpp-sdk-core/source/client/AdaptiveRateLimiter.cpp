@@ -0,0 +1,149 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/AdaptiveRateLimiter.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Aws::Client;
+
+static const char* ADAPTIVE_RATE_LIMITER_TAG = "AdaptiveRateLimiter";
+
+static const double MIN_FILL_RATE = 0.5;
+static const double MIN_CAPACITY = 1.0;
+//weight of the latest half second when smoothing the measured send rate
+static const double SMOOTHING = 0.8;
+//the rate drops to this fraction of the throttled rate
+static const double BETA = 0.7;
+static const double SCALE_CONSTANT = 0.4;
+
+AdaptiveRateLimiter::AdaptiveRateLimiter(TimeFunctionType timeFunction) :
+    m_timeFunction(timeFunction),
+    m_start(m_timeFunction()),
+    m_enabled(false),
+    m_fillRate(MIN_FILL_RATE),
+    m_maxCapacity(MIN_CAPACITY),
+    m_currentCapacity(0),
+    m_lastRefill(0),
+    m_measuredSendRate(0),
+    m_lastSendRateBucket(0),
+    m_requestCount(0),
+    m_lastMaxRate(0),
+    m_lastThrottleTime(0),
+    m_timeWindow(0)
+{
+}
+
+std::chrono::milliseconds AdaptiveRateLimiter::AcquireSendToken()
+{
+    std::lock_guard<std::mutex> locker(m_rateMutex);
+    if (!m_enabled)
+    {
+        return std::chrono::milliseconds(0);
+    }
+
+    Refill(GetElapsedSeconds());
+    double missingTokens = 1.0 - m_currentCapacity;
+    m_currentCapacity -= 1.0;
+    if (missingTokens <= 0)
+    {
+        return std::chrono::milliseconds(0);
+    }
+
+    return std::chrono::milliseconds(static_cast<long long>(std::ceil(missingTokens / m_fillRate * 1000)));
+}
+
+void AdaptiveRateLimiter::UpdateSendRate(bool throttled)
+{
+    std::lock_guard<std::mutex> locker(m_rateMutex);
+    double now = GetElapsedSeconds();
+    UpdateMeasuredSendRate(now);
+
+    double calculatedRate;
+    if (throttled)
+    {
+        double throttledRate = m_enabled ? (std::min)(m_measuredSendRate, m_fillRate) : m_measuredSendRate;
+        m_lastMaxRate = throttledRate;
+        m_lastThrottleTime = now;
+        calculatedRate = throttledRate * BETA;
+        if (!m_enabled)
+        {
+            AWS_LOGSTREAM_INFO(ADAPTIVE_RATE_LIMITER_TAG, "Throttled at " << throttledRate << " requests per second, limiting the send rate.");
+            m_enabled = true;
+            m_currentCapacity = 0;
+            m_lastRefill = now;
+        }
+    }
+    else
+    {
+        calculatedRate = SCALE_CONSTANT * std::pow(now - m_lastThrottleTime - m_timeWindow, 3) + m_lastMaxRate;
+    }
+    m_timeWindow = std::cbrt(m_lastMaxRate * (1.0 - BETA) / SCALE_CONSTANT);
+
+    //never probe faster than twice what we are actually sending
+    SetFillRate((std::min)(calculatedRate, 2.0 * m_measuredSendRate), now);
+}
+
+bool AdaptiveRateLimiter::IsEnabled() const
+{
+    std::lock_guard<std::mutex> locker(m_rateMutex);
+    return m_enabled;
+}
+
+double AdaptiveRateLimiter::GetFillRate() const
+{
+    std::lock_guard<std::mutex> locker(m_rateMutex);
+    return m_fillRate;
+}
+
+double AdaptiveRateLimiter::GetMeasuredSendRate() const
+{
+    std::lock_guard<std::mutex> locker(m_rateMutex);
+    return m_measuredSendRate;
+}
+
+double AdaptiveRateLimiter::GetElapsedSeconds() const
+{
+    return std::chrono::duration<double>(m_timeFunction() - m_start).count();
+}
+
+void AdaptiveRateLimiter::Refill(double now)
+{
+    m_currentCapacity = (std::min)(m_maxCapacity, m_currentCapacity + (now - m_lastRefill) * m_fillRate);
+    m_lastRefill = now;
+}
+
+void AdaptiveRateLimiter::SetFillRate(double rate, double now)
+{
+    Refill(now);
+    m_fillRate = (std::max)(rate, MIN_FILL_RATE);
+    m_maxCapacity = (std::max)(rate, MIN_CAPACITY);
+    m_currentCapacity = (std::min)(m_currentCapacity, m_maxCapacity);
+}
+
+void AdaptiveRateLimiter::UpdateMeasuredSendRate(double now)
+{
+    double bucket = std::floor(now * 2.0) / 2.0;
+    ++m_requestCount;
+    if (bucket > m_lastSendRateBucket)
+    {
+        double currentRate = m_requestCount / (bucket - m_lastSendRateBucket);
+        m_measuredSendRate = currentRate * SMOOTHING + m_measuredSendRate * (1.0 - SMOOTHING);
+        m_requestCount = 0;
+        m_lastSendRateBucket = bucket;
+    }
+}
@@ -44,6 +44,10 @@ ClientConfiguration::ClientConfiguration() :
     maxConnections(25), 
     requestTimeoutMs(3000), 
     connectTimeoutMs(1000),
+    lowSpeedLimit(0),
+    lowSpeedTimeMs(10000),
+    connectionIdleTimeoutMs(20000),
+    shareConnectionCachesAcrossClients(false),
     retryStrategy(Aws::MakeShared<DefaultRetryStrategy>(allocationTag)),
     proxyPort(0),
     executor(Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(allocationTag)),
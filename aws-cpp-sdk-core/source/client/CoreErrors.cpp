@@ -55,6 +55,17 @@ static const int RESOURCE_NOT_FOUND_EXCEPTION_HASH = HashingUtils::HashString("R
 static const int UNRECOGNIZED_CLIENT_HASH = HashingUtils::HashString("UnrecognizedClient");
 static const int UNRECOGNIZED_CLIENT_EXCEPTION_HASH = HashingUtils::HashString("UnrecognizedClientException");
 
+//service specific exceptions that mean the caller is sending too fast
+static const int THROTTLED_EXCEPTION_HASH = HashingUtils::HashString("ThrottledException");
+static const int REQUEST_THROTTLED_HASH = HashingUtils::HashString("RequestThrottled");
+static const int REQUEST_THROTTLED_EXCEPTION_HASH = HashingUtils::HashString("RequestThrottledException");
+static const int TOO_MANY_REQUESTS_EXCEPTION_HASH = HashingUtils::HashString("TooManyRequestsException");
+static const int PROVISIONED_THROUGHPUT_EXCEEDED_EXCEPTION_HASH = HashingUtils::HashString("ProvisionedThroughputExceededException");
+static const int REQUEST_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RequestLimitExceeded");
+static const int BANDWIDTH_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("BandwidthLimitExceeded");
+static const int SLOW_DOWN_HASH = HashingUtils::HashString("SlowDown");
+static const int PRIOR_REQUEST_NOT_COMPLETE_HASH = HashingUtils::HashString("PriorRequestNotComplete");
+
 AWSError<CoreErrors> CoreErrorsMapper::GetErrorForName(const char* errorName)
 {
   int errorHash = HashingUtils::HashString(errorName);
@@ -134,3 +145,19 @@ AWSError<CoreErrors> CoreErrorsMapper::GetErrorForName(const char* errorName)
 
   return AWSError<CoreErrors>(CoreErrors::UNKNOWN, false);
 }
+
+bool CoreErrorsMapper::IsThrottlingError(const AWSError<CoreErrors>& error)
+{
+  if (error.GetErrorType() == CoreErrors::THROTTLING)
+  {
+    return true;
+  }
+
+  int errorHash = HashingUtils::HashString(error.GetExceptionName().c_str());
+  return errorHash == THROTTLING_HASH || errorHash == THROTTLING_EXCEPTION_HASH ||
+      errorHash == THROTTLED_EXCEPTION_HASH || errorHash == REQUEST_THROTTLED_HASH ||
+      errorHash == REQUEST_THROTTLED_EXCEPTION_HASH || errorHash == TOO_MANY_REQUESTS_EXCEPTION_HASH ||
+      errorHash == PROVISIONED_THROUGHPUT_EXCEEDED_EXCEPTION_HASH || errorHash == REQUEST_LIMIT_EXCEEDED_HASH ||
+      errorHash == BANDWIDTH_LIMIT_EXCEEDED_HASH || errorHash == SLOW_DOWN_HASH ||
+      errorHash == PRIOR_REQUEST_NOT_COMPLETE_HASH;
+}
@@ -0,0 +1,77 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/HedgingPolicy.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+
+//most hedges the budget saves up for
+static const double MAX_BUDGET = 10.0;
+
+HedgingPolicy::HedgingPolicy(double percentile, double budgetPercent, std::chrono::milliseconds minHedgeDelay, unsigned minSamples) :
+    m_percentile(percentile),
+    m_budgetPerRequest((std::max)(budgetPercent, 0.0) / 100.0),
+    m_minHedgeDelay(minHedgeDelay),
+    m_minSamples(minSamples),
+    m_budget(0),
+    m_hedgesFired(0),
+    m_hedgesWon(0)
+{
+}
+
+void HedgingPolicy::RecordFirstByteLatency(std::chrono::microseconds latency)
+{
+    m_firstByteLatencies.Record(static_cast<uint64_t>((std::max)(latency.count(), static_cast<std::chrono::microseconds::rep>(0))));
+}
+
+bool HedgingPolicy::HasEnoughSamples() const
+{
+    return m_firstByteLatencies.GetCount() >= m_minSamples;
+}
+
+std::chrono::milliseconds HedgingPolicy::GetHedgeDelay() const
+{
+    //rounded up to whole milliseconds
+    auto percentileMillis = std::chrono::milliseconds((m_firstByteLatencies.GetValueAtPercentile(m_percentile) + 999) / 1000);
+    return (std::max)(m_minHedgeDelay, percentileMillis);
+}
+
+void HedgingPolicy::OnHedgeableRequest()
+{
+    std::lock_guard<std::mutex> locker(m_budgetMutex);
+    m_budget = (std::min)(MAX_BUDGET, m_budget + m_budgetPerRequest);
+}
+
+bool HedgingPolicy::TryAcquireHedge()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_budgetMutex);
+        if (m_budget < 1.0)
+        {
+            return false;
+        }
+        m_budget -= 1.0;
+    }
+
+    ++m_hedgesFired;
+    return true;
+}
+
+void HedgingPolicy::OnHedgeWon()
+{
+    ++m_hedgesWon;
+}
@@ -0,0 +1,74 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/HistogramMetricsPublisher.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Client;
+
+static const char* HISTOGRAM_PUBLISHER_TAG = "HistogramMetricsPublisher";
+
+OperationMetrics::OperationMetrics() :
+    callCount(0),
+    failedCallCount(0),
+    retryCount(0),
+    bytesSent(0),
+    bytesReceived(0)
+{
+}
+
+static Aws::String GetOperationKey(const Aws::String& serviceName, const Aws::String& operationName)
+{
+    return serviceName + "/" + operationName;
+}
+
+void HistogramMetricsPublisher::PublishRequestMetrics(const RequestMetrics& metrics)
+{
+    std::shared_ptr<OperationMetrics> operation;
+    {
+        std::lock_guard<std::mutex> locker(m_operationsMutex);
+        auto& entry = m_operations[GetOperationKey(metrics.serviceName, metrics.operationName)];
+        if (!entry)
+        {
+            entry = Aws::MakeShared<OperationMetrics>(HISTOGRAM_PUBLISHER_TAG);
+        }
+        operation = entry;
+    }
+
+    operation->endToEndLatency.Record(static_cast<uint64_t>(metrics.endToEndLatency.count()));
+    operation->signingTime.Record(static_cast<uint64_t>(metrics.signingTime.count()));
+    operation->serializationTime.Record(static_cast<uint64_t>(metrics.serializationTime.count()));
+    if (metrics.lastAttemptTimings.firstByteReceived.count() > 0)
+    {
+        operation->firstByteLatency.Record(static_cast<uint64_t>(metrics.lastAttemptTimings.firstByteReceived.count()));
+    }
+
+    operation->callCount.fetch_add(1, std::memory_order_relaxed);
+    if (!metrics.succeeded)
+    {
+        operation->failedCallCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    operation->retryCount.fetch_add(metrics.retryDelays.size(), std::memory_order_relaxed);
+    operation->bytesSent.fetch_add(metrics.bytesSent, std::memory_order_relaxed);
+    operation->bytesReceived.fetch_add(metrics.bytesReceived, std::memory_order_relaxed);
+}
+
+std::shared_ptr<const OperationMetrics> HistogramMetricsPublisher::GetOperationMetrics(const Aws::String& serviceName,
+    const Aws::String& operationName) const
+{
+    std::lock_guard<std::mutex> locker(m_operationsMutex);
+    auto entry = m_operations.find(GetOperationKey(serviceName, operationName));
+    return entry == m_operations.end() ? nullptr : entry->second;
+}
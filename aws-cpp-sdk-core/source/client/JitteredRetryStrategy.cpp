@@ -0,0 +1,109 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/JitteredRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+
+using namespace Aws;
+using namespace Aws::Client;
+
+static const char* JITTERED_RETRY_TAG = "JitteredRetryStrategy";
+//past this many doublings the backoff is above any sensible max delay anyway
+static const long MAX_BACKOFF_EXPONENT = 30;
+
+JitteredRetryStrategy::JitteredRetryStrategy(JitterMode jitterMode, long maxRetries, long baseDelayMs, long maxDelayMs,
+    const std::shared_ptr<RetryTokenBucket>& tokenBucket, unsigned retryCost, unsigned timeoutRetryCost) :
+    m_jitterMode(jitterMode),
+    m_maxRetries(maxRetries),
+    m_baseDelayMs(baseDelayMs),
+    m_maxDelayMs((std::max)(maxDelayMs, baseDelayMs)),
+    m_tokenBucket(tokenBucket ? tokenBucket : Aws::MakeShared<RetryTokenBucket>(JITTERED_RETRY_TAG)),
+    m_retryCost(retryCost),
+    m_timeoutRetryCost(timeoutRetryCost),
+    m_random(std::random_device()())
+{
+}
+
+bool JitteredRetryStrategy::ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    if (attemptedRetries >= m_maxRetries || !error.ShouldRetry())
+    {
+        return false;
+    }
+
+    if (!m_tokenBucket->TryAcquire(GetRetryCost(error)))
+    {
+        AWS_LOGSTREAM_WARN(JITTERED_RETRY_TAG, "Retry quota exhausted with " << m_tokenBucket->GetAvailableTokens()
+            << " tokens left, not retrying.");
+        return false;
+    }
+
+    return true;
+}
+
+long JitteredRetryStrategy::CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    return CalculateDelayAfterPreviousDelay(error, attemptedRetries, 0);
+}
+
+long JitteredRetryStrategy::CalculateDelayAfterPreviousDelay(const AWSError<CoreErrors>& error, long attemptedRetries, long previousDelayMs) const
+{
+    AWS_UNREFERENCED_PARAM(error);
+
+    if (m_jitterMode == JitterMode::DECORRELATED)
+    {
+        long previous = (std::max)(previousDelayMs, m_baseDelayMs);
+        long upper = previous > m_maxDelayMs / 3 ? m_maxDelayMs : previous * 3;
+        return RandomDelayBetween(m_baseDelayMs, upper);
+    }
+
+    long exponent = (std::min)((std::max)(attemptedRetries, 0L), MAX_BACKOFF_EXPONENT);
+    long backoff = m_baseDelayMs > (m_maxDelayMs >> exponent) ? m_maxDelayMs : m_baseDelayMs << exponent;
+    return RandomDelayBetween(0, backoff);
+}
+
+void JitteredRetryStrategy::OnRequestSucceeded(long attemptedRetries) const
+{
+    m_tokenBucket->Release(attemptedRetries > 0 ? m_retryCost : 1);
+}
+
+void JitteredRetryStrategy::OnRetryAbandoned(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    AWS_UNREFERENCED_PARAM(attemptedRetries);
+    m_tokenBucket->Release(GetRetryCost(error));
+}
+
+unsigned JitteredRetryStrategy::GetRetryCost(const AWSError<CoreErrors>& error) const
+{
+    return error.GetErrorType() == CoreErrors::NETWORK_CONNECTION ? m_timeoutRetryCost : m_retryCost;
+}
+
+long JitteredRetryStrategy::RandomDelayBetween(long minDelayMs, long maxDelayMs) const
+{
+    if (maxDelayMs <= minDelayMs)
+    {
+        return minDelayMs;
+    }
+
+    std::uniform_int_distribution<long> distribution(minDelayMs, maxDelayMs);
+    std::lock_guard<std::mutex> locker(m_randomMutex);
+    return distribution(m_random);
+}
@@ -0,0 +1,30 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/MetricsPublisher.h>
+
+using namespace Aws::Client;
+
+RequestMetrics::RequestMetrics() :
+    attemptCount(0),
+    succeeded(false),
+    httpStatus(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE),
+    bytesSent(0),
+    bytesReceived(0),
+    serializationTime(0),
+    signingTime(0),
+    endToEndLatency(0)
+{
+}
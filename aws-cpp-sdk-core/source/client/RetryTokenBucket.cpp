@@ -0,0 +1,49 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/RetryTokenBucket.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+
+RetryTokenBucket::RetryTokenBucket(unsigned capacity) :
+    m_capacity(capacity),
+    m_availableTokens(capacity)
+{
+}
+
+bool RetryTokenBucket::TryAcquire(unsigned cost)
+{
+    unsigned available = m_availableTokens.load();
+    do
+    {
+        if (available < cost)
+        {
+            return false;
+        }
+    } while (!m_availableTokens.compare_exchange_weak(available, available - cost));
+
+    return true;
+}
+
+void RetryTokenBucket::Release(unsigned amount)
+{
+    unsigned available = m_availableTokens.load();
+    while (available < m_capacity &&
+        !m_availableTokens.compare_exchange_weak(available, (std::min)(m_capacity, available + (std::min)(amount, m_capacity))))
+    {
+    }
+}
@@ -14,6 +14,8 @@
   */
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
 
 using namespace Aws;
 using namespace Aws::Http;
@@ -46,3 +48,18 @@ void HttpClient::RetryRequestSleep(std::chrono::milliseconds sleepTime)
     std::unique_lock< std::mutex > signalLocker(m_requestProcessingSignalLock);
     m_requestProcessingSignal.wait_for(signalLocker, sleepTime, [this](){ return m_disableRequestProcessing.load() == true; });
 }
+
+size_t HttpClient::WarmUpConnections(const URI&, size_t) const
+{
+    return 0;
+}
+
+void HttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseReceivedHandler& handler,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    std::shared_ptr<HttpResponse> response = MakeRequest(*request, readLimiter, writeLimiter);
+    if (handler)
+    {
+        handler(request, response);
+    }
+}
@@ -17,6 +17,7 @@
 
 #if ENABLE_CURL_CLIENT
     #include <aws/core/http/curl/CurlHttpClient.h>
+    #include <aws/core/http/curl/CurlMultiHttpClient.h>
 #elif ENABLE_WINDOWS_CLIENT
     #include <aws/core/http/windows/WinINetSyncHttpClient.h>
     #include <aws/core/http/windows/WinHttpSyncHttpClient.h>
@@ -48,7 +49,14 @@ std::shared_ptr<HttpClient> HttpClientFactory::CreateHttpClient(const ClientConf
             return Aws::MakeShared<WinHttpSyncHttpClient>(allocationTag, clientConfiguration);
     }
 #elif ENABLE_CURL_CLIENT
-    return Aws::MakeShared<CurlHttpClient>(allocationTag, clientConfiguration);
+    switch (clientConfiguration.httpLibOverride)
+    {
+        case TransferLibType::CURL_MULTI_CLIENT:
+            return Aws::MakeShared<CurlMultiHttpClient>(allocationTag, clientConfiguration);
+
+        default:
+            return Aws::MakeShared<CurlHttpClient>(allocationTag, clientConfiguration);
+    }
 #else
     return nullptr;
 #endif
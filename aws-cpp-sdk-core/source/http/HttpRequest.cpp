@@ -37,6 +37,12 @@ const char* HOST_HEADER = "host";
 const char* AMZ_TARGET_HEADER = "x-amz-target";
 const char* X_AMZ_EXPIRES_HEADER = "X-Amz-Expires";
 const char* CONTENT_MD5_HEADER = "content-md5";
+const char* CONTENT_ENCODING_HEADER = "content-encoding";
+const char* X_AMZ_CONTENT_SHA256_HEADER = "x-amz-content-sha256";
+const char* X_AMZ_DECODED_CONTENT_LENGTH_HEADER = "x-amz-decoded-content-length";
+const char* RANGE_HEADER = "range";
+const char* ETAG_HEADER = "etag";
+const char* CONTENT_RANGE_HEADER = "content-range";
 
 } // Http
 } // Aws
@@ -0,0 +1,116 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/RequestBodySource.h>
+
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <istream>
+
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char* BODY_SOURCE_LOG_TAG = "RequestBodySource";
+
+RequestBodySource::RequestBodySource(Aws::IStream* body, int64_t bodyLength) :
+    m_body(body),
+    m_remainingLength(0),
+    m_lengthKnown(false)
+{
+    Initialize(bodyLength);
+}
+
+RequestBodySource::RequestBodySource(const HttpRequest& request) :
+    m_body(request.GetContentBody().get()),
+    m_remainingLength(0),
+    m_lengthKnown(false)
+{
+    int64_t bodyLength = -1;
+    if (m_body && request.HasHeader(CONTENT_LENGTH_HEADER))
+    {
+        bodyLength = StringUtils::ConvertToInt64(request.GetContentLength().c_str());
+    }
+
+    Initialize(bodyLength);
+}
+
+void RequestBodySource::Initialize(int64_t bodyLength)
+{
+    if (!m_body)
+    {
+        m_lengthKnown = true;
+        return;
+    }
+
+    if (bodyLength >= 0)
+    {
+        m_remainingLength = static_cast<uint64_t>(bodyLength);
+        m_lengthKnown = true;
+        return;
+    }
+
+    auto currentPos = m_body->tellg();
+    if (currentPos >= 0)
+    {
+        m_body->seekg(0, m_body->end);
+        auto endPos = m_body->tellg();
+        m_body->seekg(currentPos, m_body->beg);
+        if (endPos >= currentPos)
+        {
+            m_remainingLength = static_cast<uint64_t>(endPos - currentPos);
+            m_lengthKnown = true;
+            return;
+        }
+    }
+
+    m_body->clear();
+    AWS_LOG_DEBUG(BODY_SOURCE_LOG_TAG, "Request body can't seek and has no content-length, it will be read until it ends.");
+}
+
+size_t RequestBodySource::Read(char* buffer, size_t length)
+{
+    if (!m_body)
+    {
+        return 0;
+    }
+
+    size_t amountToRead = length;
+    if (m_lengthKnown)
+    {
+        amountToRead = static_cast<size_t>((std::min)(static_cast<uint64_t>(length), m_remainingLength));
+    }
+
+    if (amountToRead == 0)
+    {
+        return 0;
+    }
+
+    m_body->read(buffer, static_cast<std::streamsize>(amountToRead));
+    size_t amountRead = static_cast<size_t>(m_body->gcount());
+    if (m_lengthKnown)
+    {
+        m_remainingLength -= amountRead;
+        if (amountRead < amountToRead)
+        {
+            AWS_LOGSTREAM_WARN(BODY_SOURCE_LOG_TAG, "Request body ended " << m_remainingLength << " bytes short of its length");
+            m_remainingLength = 0;
+        }
+    }
+
+    return amountRead;
+}
@@ -14,7 +14,9 @@
   */
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/URI.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 #undef min
 
@@ -127,9 +129,11 @@ static char* strdup_callback(const char* str)
 
 
 
-CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout) :
+CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, unsigned long idleTimeout, bool useProcessWideShare) :
                 m_maxPoolSize(maxSize), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
-                m_poolSize(0)
+                m_poolSize(0), m_idleTimeout(idleTimeout),
+                m_evictionTimers(idleTimeout > 0 ? Aws::Utils::Threading::TimerQueue::GetShared() : nullptr),
+                m_evictionTimerId(0), m_shuttingDown(false), m_poolHits(0), m_poolMisses(0)
 {
     AWS_LOGSTREAM_INFO(CurlTag, "Initializing CurlHandleContainer with size " << maxSize);
     if (!isInit)
@@ -142,38 +146,110 @@ CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout,
         curl_global_init(CURL_GLOBAL_ALL);
 #endif
     }
+
+    m_shareHandle = useProcessWideShare ? CurlShareHandle::GetProcessWideInstance() : Aws::MakeShared<CurlShareHandle>(CurlTag);
 }
 
 CurlHandleContainer::~CurlHandleContainer()
 {
     AWS_LOG_INFO(CurlTag, "Cleaning up CurlHandleContainer.");
+    if (m_evictionTimers)
+    {
+        //an eviction that already started holds the mutex and reschedules unless it sees the shutdown, so cancel outside of it.
+        //Cancel waits for an eviction that is running.
+        Aws::Utils::Threading::TimerQueue::TimerId evictionTimerId = 0;
+        {
+            std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+            m_shuttingDown = true;
+            evictionTimerId = m_evictionTimerId;
+        }
+        if (evictionTimerId)
+        {
+            m_evictionTimers->Cancel(evictionTimerId);
+        }
+    }
+
     while (m_handleContainer.size() > 0)
     {
         AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", m_handleContainer.top());
         curl_easy_cleanup(m_handleContainer.top());
         m_handleContainer.pop();
     }
+
+    for (auto& endpointHandles : m_idleHandles)
+    {
+        for (auto& idleHandle : endpointHandles.second)
+        {
+            AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", idleHandle.handle);
+            curl_easy_cleanup(idleHandle.handle);
+        }
+    }
+}
+
+Aws::String CurlHandleContainer::GetConnectionKey(const URI& uri)
+{
+    Aws::StringStream key;
+    key << SchemeMapper::ToString(uri.GetScheme()) << "://" << uri.GetAuthority() << ":" << uri.GetPort();
+    return key.str();
 }
 
 CURL* CurlHandleContainer::AcquireCurlHandle()
+{
+    return AcquireCurlHandle("");
+}
+
+CURL* CurlHandleContainer::AcquireCurlHandle(const Aws::String& connectionKey)
 {
     AWS_LOG_DEBUG(CurlTag, "Attempting to acquire curl connection.");
     std::unique_lock<std::mutex> locker(m_handleContainerMutex);
 
-    while (m_handleContainer.size() == 0)
+    CURL* handle = nullptr;
+    for (;;)
     {
-        AWS_LOG_DEBUG(CurlTag, "No current connections available in pool. Attempting to create new connections.");
-        if (!CheckAndGrowPool())
+        EvictIdleHandles();
+
+        auto endpointHandles = m_idleHandles.find(connectionKey);
+        if (endpointHandles != m_idleHandles.end())
         {
-            AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
-            m_conditionVariable.wait(locker);
-            AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
+            //the most recently used connection is the least likely to have been dropped
+            handle = endpointHandles->second.back().handle;
+            endpointHandles->second.pop_back();
+            if (endpointHandles->second.empty())
+            {
+                m_idleHandles.erase(endpointHandles);
+            }
+            ++m_poolHits;
+            break;
         }
+
+        if (m_handleContainer.size() == 0)
+        {
+            AWS_LOG_DEBUG(CurlTag, "No current connections available in pool. Attempting to create new connections.");
+            CheckAndGrowPool();
+        }
+
+        if (m_handleContainer.size() > 0)
+        {
+            handle = m_handleContainer.top();
+            m_handleContainer.pop();
+            ++m_poolMisses;
+            break;
+        }
+
+        if (TakeLongestIdleHandle(handle))
+        {
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Taking over idle connection handle " << handle << " from another endpoint.");
+            ++m_poolMisses;
+            break;
+        }
+
+        AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
+        m_conditionVariable.wait(locker);
+        AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
     }
 
-    CURL* handle = m_handleContainer.top();
+    m_handleConnectionKeys[handle] = connectionKey;
     AWS_LOGSTREAM_DEBUG(CurlTag, "Returning connection handle " << handle);
-    m_handleContainer.pop();
     return handle;
 }
 
@@ -181,11 +257,21 @@ void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
 {
     if (handle)
     {
+        //reset only clears the options, the handle keeps its open connections.
         curl_easy_reset(handle);
         SetDefaultOptionsOnHandle(handle);
         AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << handle);
         std::unique_lock<std::mutex> locker(m_handleContainerMutex);
-        m_handleContainer.push(handle);
+        Aws::String connectionKey;
+        auto keyIter = m_handleConnectionKeys.find(handle);
+        if (keyIter != m_handleConnectionKeys.end())
+        {
+            connectionKey = keyIter->second;
+            m_handleConnectionKeys.erase(keyIter);
+        }
+        EvictIdleHandles();
+        m_idleHandles[connectionKey].push_back(IdleHandle { handle, std::chrono::steady_clock::now() });
+        ScheduleEviction();
         locker.unlock();
         AWS_LOG_DEBUG(CurlTag, "Notifying waiting threads.");
         m_conditionVariable.notify_one();
@@ -228,6 +314,109 @@ bool CurlHandleContainer::CheckAndGrowPool()
     return false;
 }
 
+void CurlHandleContainer::EvictIdleHandles()
+{
+    if (m_idleTimeout.count() == 0)
+    {
+        return;
+    }
+
+    auto evictBefore = std::chrono::steady_clock::now() - m_idleTimeout;
+    for (auto endpointHandles = m_idleHandles.begin(); endpointHandles != m_idleHandles.end();)
+    {
+        auto& idleHandles = endpointHandles->second;
+        while (!idleHandles.empty() && idleHandles.front().idleSince < evictBefore)
+        {
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Closing connection handle " << idleHandles.front().handle << " to " << endpointHandles->first
+                << " after being idle past the idle timeout.");
+            curl_easy_cleanup(idleHandles.front().handle);
+            idleHandles.pop_front();
+            //makes room for a fresh handle when the pool next needs one
+            --m_poolSize;
+        }
+
+        if (idleHandles.empty())
+        {
+            endpointHandles = m_idleHandles.erase(endpointHandles);
+        }
+        else
+        {
+            ++endpointHandles;
+        }
+    }
+}
+
+void CurlHandleContainer::ScheduleEviction()
+{
+    if (!m_evictionTimers || m_evictionTimerId || m_shuttingDown)
+    {
+        return;
+    }
+
+    //each deque is longest idle first, so its front is the next handle of that endpoint to expire
+    auto longestIdle = m_idleHandles.end();
+    for (auto endpointHandles = m_idleHandles.begin(); endpointHandles != m_idleHandles.end(); ++endpointHandles)
+    {
+        if (longestIdle == m_idleHandles.end() || endpointHandles->second.front().idleSince < longestIdle->second.front().idleSince)
+        {
+            longestIdle = endpointHandles;
+        }
+    }
+
+    if (longestIdle == m_idleHandles.end())
+    {
+        return;
+    }
+
+    //just past the expiry, EvictIdleHandles only closes handles idle for longer than the timeout
+    auto evictAt = longestIdle->second.front().idleSince + m_idleTimeout + std::chrono::milliseconds(1);
+    m_evictionTimerId = m_evictionTimers->Schedule(evictAt, [this]() { EvictOnTimer(); });
+}
+
+void CurlHandleContainer::EvictOnTimer()
+{
+    std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+    m_evictionTimerId = 0;
+    EvictIdleHandles();
+    ScheduleEviction();
+}
+
+size_t CurlHandleContainer::GetIdleHandleCount() const
+{
+    std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+    size_t idleHandleCount = 0;
+    for (const auto& endpointHandles : m_idleHandles)
+    {
+        idleHandleCount += endpointHandles.second.size();
+    }
+    return idleHandleCount;
+}
+
+bool CurlHandleContainer::TakeLongestIdleHandle(CURL*& handle)
+{
+    auto longestIdle = m_idleHandles.end();
+    for (auto endpointHandles = m_idleHandles.begin(); endpointHandles != m_idleHandles.end(); ++endpointHandles)
+    {
+        if (longestIdle == m_idleHandles.end() || endpointHandles->second.front().idleSince < longestIdle->second.front().idleSince)
+        {
+            longestIdle = endpointHandles;
+        }
+    }
+
+    if (longestIdle == m_idleHandles.end())
+    {
+        return false;
+    }
+
+    handle = longestIdle->second.front().handle;
+    longestIdle->second.pop_front();
+    if (longestIdle->second.empty())
+    {
+        m_idleHandles.erase(longestIdle);
+    }
+    return true;
+}
+
 void CurlHandleContainer::SetDefaultOptionsOnHandle(void* handle)
 {
     //for timeouts to work in a multi-threaded context,
@@ -236,4 +425,8 @@ void CurlHandleContainer::SetDefaultOptionsOnHandle(void* handle)
     curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
     curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
     curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
+    if (m_shareHandle && m_shareHandle->GetHandle())
+    {
+        curl_easy_setopt(handle, CURLOPT_SHARE, m_shareHandle->GetHandle());
+    }
 }
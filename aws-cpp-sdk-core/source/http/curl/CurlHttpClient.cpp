@@ -16,13 +16,19 @@
 #include <aws/core/http/curl/CurlHttpClient.h>
 
 
+#include <aws/core/http/ContentBodyEncoder.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/stream/ResponseBodyStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <cassert>
 #include <algorithm>
+#include <thread>
 
 
 using namespace Aws::Client;
@@ -32,35 +38,6 @@ using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
 
 
-struct CurlWriteCallbackContext
-{
-    CurlWriteCallbackContext(const CurlHttpClient* client,
-                             HttpRequest* request, 
-                             HttpResponse* response, 
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
-        m_client(client),
-        m_request(request),
-        m_response(response),
-        m_rateLimiter(rateLimiter)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-    HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-};
-
-struct CurlReadCallbackContext
-{
-    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request) :
-        m_client(client),
-        m_request(request)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-};
-
 static const char* CurlTag = "CurlHttpClient";
 
 void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
@@ -111,10 +88,15 @@ void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
 
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),   
-    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs),
+    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.connectionIdleTimeoutMs,
+        clientConfig.shareConnectionCachesAcrossClients),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyHost(clientConfig.proxyHost),
-    m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath), m_allowRedirects(clientConfig.followRedirects)
+    m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath), m_allowRedirects(clientConfig.followRedirects),
+    m_requestTimeout(clientConfig.requestTimeoutMs),
+    m_lowSpeedLimit(static_cast<long>(clientConfig.lowSpeedLimit)),
+    //curl counts it in whole seconds
+    m_lowSpeedTime((std::max)(1L, (clientConfig.lowSpeedTimeMs + 999) / 1000))
 {
 }
 
@@ -128,13 +110,158 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
     Aws::String url = uri.GetURIString();
 
     AWS_LOGSTREAM_TRACE(CurlTag, "Making request to " << url);
-    struct curl_slist* headers = NULL;
 
     if (writeLimiter != nullptr)
     {
         writeLimiter->ApplyAndPayForCost(request.GetSize());
     }
 
+    struct curl_slist* headers = BuildHeaderList(request);
+
+    std::shared_ptr<HttpResponse> response(nullptr);
+    auto acquireStart = std::chrono::steady_clock::now();
+    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle(CurlHandleContainer::GetConnectionKey(request.GetUri()));
+    RequestTimings timings;
+    timings.connectionAcquireTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - acquireStart);
+
+    if (connectionHandle)
+    {
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
+
+        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
+        response->SetRequestTimings(timings);
+        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
+        CurlReadCallbackContext readContext(this, &request);
+
+        SetTransferOptions(connectionHandle, request, url, headers, writeContext, readContext);
+
+        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        if (curlResponseCode != CURLE_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CurlTag, "Curl returned error code " << curlResponseCode);
+            if (!KeepIncompleteResponse(connectionHandle, request, *response))
+            {
+                response = nullptr;
+            }
+        }
+        else
+        {
+            ReadTransferResults(connectionHandle, *response);
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
+        }
+
+        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
+        //go ahead and flush the response body stream
+        if(response)
+        {
+            response->GetResponseBody().flush();
+        }
+    }
+
+    if (headers)
+    {
+        curl_slist_free_all(headers);
+    }
+
+    return response;
+}
+
+size_t CurlHttpClient::WarmUpConnections(const URI& endpoint, size_t connectionCount) const
+{
+    connectionCount = (std::min)(connectionCount, static_cast<size_t>(m_curlHandleContainer.GetMaxPoolSize()));
+    if (connectionCount == 0)
+    {
+        return 0;
+    }
+
+    URI rootUri;
+    rootUri.SetScheme(endpoint.GetScheme());
+    rootUri.SetAuthority(endpoint.GetAuthority());
+    rootUri.SetPort(endpoint.GetPort());
+    rootUri.SetPath("/");
+    Aws::String url = rootUri.GetURIString();
+    Aws::String connectionKey = CurlHandleContainer::GetConnectionKey(rootUri);
+    AWS_LOGSTREAM_INFO(CurlTag, "Warming up " << connectionCount << " connections to " << connectionKey);
+
+    //each handle needs its own request, response and callback contexts while the transfers run
+    struct WarmUpTransfer
+    {
+        WarmUpTransfer(const CurlHttpClient* client, const URI& uri) :
+            request(MakeWarmUpRequest(uri)),
+            response(request),
+            writeContext(client, &request, &response, nullptr),
+            readContext(client, &request),
+            handle(nullptr),
+            result(CURLE_OK)
+        {}
+
+        static StandardHttpRequest MakeWarmUpRequest(const URI& uri)
+        {
+            StandardHttpRequest warmUpRequest(uri, HttpMethod::HTTP_HEAD);
+            warmUpRequest.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            return warmUpRequest;
+        }
+
+        StandardHttpRequest request;
+        StandardHttpResponse response;
+        CurlWriteCallbackContext writeContext;
+        CurlReadCallbackContext readContext;
+        CURL* handle;
+        CURLcode result;
+    };
+
+    //all handles are taken before any transfer starts, so no two of them share a connection. Each one is performed on its own
+    //and keeps its connection in its own cache, a shared multi handle would own the connections and close them on cleanup.
+    struct curl_slist* headers = nullptr;
+    Aws::Vector<std::shared_ptr<WarmUpTransfer>> transfers;
+    for (size_t i = 0; i < connectionCount; ++i)
+    {
+        auto transfer = Aws::MakeShared<WarmUpTransfer>(CurlTag, this, rootUri);
+        if (!headers)
+        {
+            headers = BuildHeaderList(transfer->request);
+        }
+        transfer->handle = m_curlHandleContainer.AcquireCurlHandle(connectionKey);
+        SetTransferOptions(transfer->handle, transfer->request, url, headers, transfer->writeContext, transfer->readContext);
+        transfers.push_back(transfer);
+    }
+
+    Aws::Vector<std::thread> performers;
+    performers.reserve(transfers.size() - 1);
+    for (size_t i = 1; i < transfers.size(); ++i)
+    {
+        auto transfer = transfers[i];
+        performers.emplace_back([transfer]() { transfer->result = curl_easy_perform(transfer->handle); });
+    }
+    transfers[0]->result = curl_easy_perform(transfers[0]->handle);
+    for (auto& performer : performers)
+    {
+        performer.join();
+    }
+
+    size_t warmedUp = 0;
+    for (auto& transfer : transfers)
+    {
+        if (transfer->result == CURLE_OK)
+        {
+            ++warmedUp;
+        }
+        else
+        {
+            AWS_LOGSTREAM_WARN(CurlTag, "Warming up a connection to " << connectionKey << " failed with curl error code " << transfer->result);
+        }
+        m_curlHandleContainer.ReleaseCurlHandle(transfer->handle);
+    }
+    curl_slist_free_all(headers);
+
+    AWS_LOGSTREAM_INFO(CurlTag, "Warmed up " << warmedUp << " of " << connectionCount << " connections to " << connectionKey);
+    return warmedUp;
+}
+
+struct curl_slist* CurlHttpClient::BuildHeaderList(const HttpRequest& request)
+{
+    struct curl_slist* headers = NULL;
+
     Aws::StringStream headerStream;
     HeaderValueCollection requestHeaders = request.GetHeaders();
 
@@ -159,122 +286,170 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
         headers = curl_slist_append(headers, "content-type:");
     }
 
-    std::shared_ptr<HttpResponse> response(nullptr);
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    return headers;
+}
 
-    if (connectionHandle)
+void CurlHttpClient::SetTransferOptions(CURL* connectionHandle, const HttpRequest& request, const Aws::String& url, struct curl_slist* headers,
+                                        CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const
+{
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
-
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
-
-        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
+    SetOptCodeForHttpMethod(connectionHandle, request);
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, writeContext.m_response);
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
-        }
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
-        //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
+    //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
 
-        if (m_isUsingProxy)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-        }
+    if (m_isUsingProxy)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+    }
 
-        if (request.GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-        }
+    if (request.GetContentBody())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
+    }
 
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        if (curlResponseCode != CURLE_OK)
-        {
-            response = nullptr;
-            AWS_LOGSTREAM_ERROR(CurlTag, "Curl returned error code " << curlResponseCode);
-        }
-        else
-        {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
-            {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
-            }
+    //handles are reused, so the timeout and progress options are set for every transfer, not only for the ones that need them
+    long timeout = m_requestTimeout;
+    if (request.GetDeadline() != std::chrono::steady_clock::time_point::max())
+    {
+        auto untilDeadline = std::chrono::duration_cast<std::chrono::milliseconds>(request.GetDeadline() - std::chrono::steady_clock::now()).count();
+        //0 would mean no timeout at all
+        long deadlineTimeout = static_cast<long>((std::max)(static_cast<decltype(untilDeadline)>(1), untilDeadline));
+        timeout = timeout > 0 ? (std::min)(timeout, deadlineTimeout) : deadlineTimeout;
+    }
+    curl_easy_setopt(connectionHandle, CURLOPT_TIMEOUT_MS, timeout);
+    //a transfer stuck below the limit that long fails as timed out, for the caller to retry
+    curl_easy_setopt(connectionHandle, CURLOPT_LOW_SPEED_LIMIT, m_lowSpeedLimit);
+    curl_easy_setopt(connectionHandle, CURLOPT_LOW_SPEED_TIME, m_lowSpeedLimit > 0 ? m_lowSpeedTime : 0L);
+
+#if LIBCURL_VERSION_NUM >= 0x072000
+    bool canBeAbandoned = request.GetCancellationToken() || request.GetDeadline() != std::chrono::steady_clock::time_point::max();
+    if (canBeAbandoned)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_XFERINFOFUNCTION, &CurlHttpClient::CheckTransferProgress);
+        curl_easy_setopt(connectionHandle, CURLOPT_XFERINFODATA, &readContext);
+    }
+    curl_easy_setopt(connectionHandle, CURLOPT_NOPROGRESS, canBeAbandoned ? 0L : 1L);
+#endif //LIBCURL_VERSION_NUM
+}
 
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
-        }
+//reads one of curl's transfer timers, which are reported in seconds
+static std::chrono::microseconds GetTransferTime(CURL* connectionHandle, CURLINFO info)
+{
+    double seconds = 0.0;
+    if (curl_easy_getinfo(connectionHandle, info, &seconds) != CURLE_OK)
+    {
+        return std::chrono::microseconds(0);
+    }
+    return std::chrono::microseconds(static_cast<int64_t>(seconds * 1000000.0));
+}
 
-        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
-        //go ahead and flush the response body stream
-        if(response)
-        {
-            response->GetResponseBody().flush();
-        }
+void CurlHttpClient::ReadTransferResults(CURL* connectionHandle, HttpResponse& response)
+{
+    long responseCode;
+    curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+    response.SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
+
+    char* contentType = nullptr;
+    curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+    if (contentType)
+    {
+        response.SetContentType(contentType);
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
     }
 
-    if (headers)
+    RequestTimings timings = response.GetRequestTimings();
+    timings.nameLookupDone = GetTransferTime(connectionHandle, CURLINFO_NAMELOOKUP_TIME);
+    timings.connectDone = GetTransferTime(connectionHandle, CURLINFO_CONNECT_TIME);
+    timings.tlsHandshakeDone = GetTransferTime(connectionHandle, CURLINFO_APPCONNECT_TIME);
+    timings.firstByteReceived = GetTransferTime(connectionHandle, CURLINFO_STARTTRANSFER_TIME);
+    timings.totalTime = GetTransferTime(connectionHandle, CURLINFO_TOTAL_TIME);
+    response.SetRequestTimings(timings);
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Request took " << timings.totalTime.count() << "us, first byte after " << timings.firstByteReceived.count()
+            << "us, waited " << timings.connectionAcquireTime.count() << "us for a connection");
+}
+
+bool CurlHttpClient::KeepIncompleteResponse(CURL* connectionHandle, const HttpRequest& request, HttpResponse& response)
+{
+    if (!request.ShouldKeepIncompleteResponse())
     {
-        curl_slist_free_all(headers);
+        return false;
     }
 
-    return response;
+    ReadTransferResults(connectionHandle, response);
+    int responseCode = static_cast<int>(response.GetResponseCode());
+    auto received = response.GetResponseBody().tellp();
+    if (responseCode < 200 || responseCode > 299 || received <= 0)
+    {
+        return false;
+    }
+
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Handing back the " << received << " bytes of the response received before the transfer broke off.");
+    response.SetTransferIncomplete(true);
+    return true;
 }
 
+int CurlHttpClient::CheckTransferProgress(void* userdata, curl_off_t, curl_off_t, curl_off_t, curl_off_t)
+{
+    CurlReadCallbackContext* context = reinterpret_cast<CurlReadCallbackContext*>(userdata);
+    if (!context->m_client->IsRequestProcessingEnabled() || context->m_request->IsCancelledOrExpired())
+    {
+        AWS_LOG_DEBUG(CurlTag, "Request was cancelled or ran past its deadline, aborting the transfer.");
+        return 1;
+    }
+
+    return 0;
+}
 
 size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
@@ -308,6 +483,30 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
     return 0;
 }
 
+//a content-length past this is not trusted enough to allocate for before the body shows up, the body grows as it arrives instead.
+static const int64_t MAX_RESPONSE_BODY_RESERVATION = 64 * 1024 * 1024;
+
+//sizes an in memory response body from its content-length, so it is written once instead of being copied every time it grows.
+static void ReserveResponseBody(HttpResponse& response, const Aws::String& contentLength)
+{
+    if (response.GetOriginatingRequest().GetMethod() == HttpMethod::HTTP_HEAD)
+    {
+        return;
+    }
+
+    auto bodyBuffer = dynamic_cast<Aws::Utils::Stream::ResponseBodyStreamBuf*>(response.GetResponseBody().rdbuf());
+    if (bodyBuffer == nullptr)
+    {
+        return;
+    }
+
+    int64_t length = StringUtils::ConvertToInt64(contentLength.c_str());
+    if (length > 0 && length <= MAX_RESPONSE_BODY_RESERVATION)
+    {
+        bodyBuffer->Reserve(static_cast<size_t>(length));
+    }
+}
+
 size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
@@ -329,6 +528,11 @@ size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* u
 
 
             response->AddHeader(headerName, headerValue);
+
+            if (StringUtils::ToLower(headerName.c_str()) == CONTENT_LENGTH_HEADER)
+            {
+                ReserveResponseBody(*response, headerValue);
+            }
         }
         return size * nmemb;
     }
@@ -355,20 +559,28 @@ size_t CurlHttpClient::ReadBody(char* ptr, size_t size, size_t nmemb, void* user
 
     if (ioStream != nullptr && size * nmemb)
     {
-        auto currentPos = ioStream->tellg();
-        ioStream->seekg(0, ioStream->end);
-        auto length = ioStream->tellg();
-        ioStream->seekg(currentPos, ioStream->beg);
-        size_t amountToRead = static_cast< size_t >(std::min<decltype(length)>(length - currentPos, size * nmemb));
+        const auto& encoder = request->GetContentBodyEncoder();
+        if (encoder)
+        {
+            size_t bodyBytesRead = 0;
+            size_t amountWritten = encoder->Encode(*ioStream, ptr, size * nmemb, bodyBytesRead);
+            auto& sentHandler = request->GetDataSentEventHandler();
+            if (sentHandler && bodyBytesRead > 0)
+            {
+                sentHandler(request, static_cast<long long>(bodyBytesRead));
+            }
+
+            return amountWritten;
+        }
 
-        ioStream->read(ptr, amountToRead);
+        size_t amountRead = context->m_bodySource.Read(ptr, size * nmemb);
         auto& sentHandler = request->GetDataSentEventHandler();
-        if (sentHandler)
+        if (sentHandler && amountRead > 0)
         {
-            sentHandler(request, amountToRead);
+            sentHandler(request, static_cast<long long>(amountRead));
         }
 
-        return amountToRead;
+        return amountRead;
     }
 
     return 0;
@@ -0,0 +1,315 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+
+#include <algorithm>
+#include <condition_variable>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Logging;
+using namespace Aws::Utils::RateLimits;
+
+static const char* CurlMultiTag = "CurlMultiHttpClient";
+
+//upper bound on a single wait, curl shortens it to its own timers and a wake up ends it early
+static const int MAX_POLL_WAIT_MS = 1000;
+//curl before 7.68 can't be woken up from another thread, so the loop comes back this often to pick up new transfers
+static const int UNWAKEABLE_POLL_WAIT_MS = 10;
+
+struct CurlMultiHttpClient::Transfer
+{
+    Transfer(const CurlMultiHttpClient* client, HttpRequest& request, const std::shared_ptr<HttpRequest>& owner,
+             const TransferCompletedHandler& completedHandler, RateLimiterInterface* readLimiter) :
+        requestOwner(owner),
+        response(Aws::MakeShared<StandardHttpResponse>(CurlMultiTag, request)),
+        headers(nullptr),
+        handle(nullptr),
+        onCompleted(completedHandler),
+        writeContext(client, &request, response.get(), readLimiter),
+        readContext(client, &request),
+        queuedAt(std::chrono::steady_clock::now())
+    {}
+
+    std::shared_ptr<HttpRequest> requestOwner;
+    std::shared_ptr<HttpResponse> response;
+    Aws::String url;
+    struct curl_slist* headers;
+    CURL* handle;
+    TransferCompletedHandler onCompleted;
+    CurlWriteCallbackContext writeContext;
+    CurlReadCallbackContext readContext;
+    std::chrono::steady_clock::time_point queuedAt;
+};
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig),
+    m_multiHandle(nullptr),
+    m_maxInFlight((std::max)(clientConfig.maxConnections, 1u)),
+    m_continue(true)
+{
+    m_multiHandle = curl_multi_init();
+    m_eventLoopThread = std::thread(&CurlMultiHttpClient::EventLoop, this);
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    m_continue = false;
+    WakeUpEventLoop();
+    if (m_eventLoopThread.joinable())
+    {
+        m_eventLoopThread.join();
+    }
+
+    curl_multi_cleanup(m_multiHandle);
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(HttpRequest& request, RateLimiterInterface* readLimiter,
+                                                               RateLimiterInterface* writeLimiter) const
+{
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    bool completed = false;
+    std::shared_ptr<HttpResponse> result;
+
+    QueueTransfer(request, nullptr, [&](const std::shared_ptr<HttpResponse>& response)
+    {
+        std::lock_guard<std::mutex> locker(completionMutex);
+        result = response;
+        completed = true;
+        completionSignal.notify_one();
+    }, readLimiter, writeLimiter);
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    completionSignal.wait(locker, [&](){ return completed; });
+    return result;
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseReceivedHandler& handler,
+                                           RateLimiterInterface* readLimiter, RateLimiterInterface* writeLimiter) const
+{
+    QueueTransfer(*request, request, [request, handler](const std::shared_ptr<HttpResponse>& response)
+    {
+        if (handler)
+        {
+            handler(request, response);
+        }
+    }, readLimiter, writeLimiter);
+}
+
+void CurlMultiHttpClient::QueueTransfer(HttpRequest& request, const std::shared_ptr<HttpRequest>& requestOwner, const TransferCompletedHandler& onCompleted,
+                                        RateLimiterInterface* readLimiter, RateLimiterInterface* writeLimiter) const
+{
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request.GetSize());
+    }
+
+    Transfer* transfer = Aws::New<Transfer>(CurlMultiTag, this, request, requestOwner, onCompleted, readLimiter);
+
+    //handle uri encoding at last second. Otherwise, the signer and the http layer will mismatch.
+    URI uri = request.GetUri();
+    uri.SetPath(URI::URLEncodePath(uri.GetPath()));
+    transfer->url = uri.GetURIString();
+    transfer->headers = BuildHeaderList(request);
+
+    AWS_LOGSTREAM_TRACE(CurlMultiTag, "Queueing request to " << transfer->url);
+    {
+        std::lock_guard<std::mutex> locker(m_queueMutex);
+        if (m_continue)
+        {
+            m_queuedTransfers.push(transfer);
+            transfer = nullptr;
+        }
+    }
+
+    if (transfer)
+    {
+        AWS_LOG_ERROR(CurlMultiTag, "Client is shutting down, failing request.");
+        curl_slist_free_all(transfer->headers);
+        transfer->onCompleted(nullptr);
+        Aws::Delete(transfer);
+        return;
+    }
+
+    WakeUpEventLoop();
+}
+
+void CurlMultiHttpClient::WakeUpEventLoop() const
+{
+#if LIBCURL_VERSION_NUM >= 0x074400
+    curl_multi_wakeup(m_multiHandle);
+#endif
+}
+
+void CurlMultiHttpClient::EventLoop()
+{
+    AWS_LOG_INFO(CurlMultiTag, "Starting curl multi event loop.");
+    while (m_continue)
+    {
+        StartQueuedTransfers();
+        PollAndDispatch();
+        CompleteFinishedTransfers();
+    }
+
+    FailOutstandingTransfers();
+    AWS_LOG_INFO(CurlMultiTag, "Curl multi event loop stopped.");
+}
+
+void CurlMultiHttpClient::StartQueuedTransfers()
+{
+    Aws::Vector<Transfer*> transfersToStart;
+    {
+        std::lock_guard<std::mutex> locker(m_queueMutex);
+        while (!m_queuedTransfers.empty() && m_inFlightTransfers.size() + transfersToStart.size() < m_maxInFlight)
+        {
+            transfersToStart.push_back(m_queuedTransfers.front());
+            m_queuedTransfers.pop();
+        }
+    }
+
+    for (Transfer* transfer : transfersToStart)
+    {
+        //the in flight cap matches the pool size, so this never blocks.
+        transfer->handle = m_curlHandleContainer.AcquireCurlHandle(CurlHandleContainer::GetConnectionKey(transfer->readContext.m_request->GetUri()));
+        AWS_LOGSTREAM_DEBUG(CurlMultiTag, "Obtained connection handle " << transfer->handle);
+        //waiting in the queue is this client's wait for a pooled connection
+        RequestTimings timings;
+        timings.connectionAcquireTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - transfer->queuedAt);
+        transfer->response->SetRequestTimings(timings);
+
+        SetTransferOptions(transfer->handle, *transfer->readContext.m_request, transfer->url, transfer->headers,
+                transfer->writeContext, transfer->readContext);
+        curl_easy_setopt(transfer->handle, CURLOPT_PRIVATE, transfer);
+
+        CURLMcode addResult = curl_multi_add_handle(m_multiHandle, transfer->handle);
+        if (addResult == CURLM_OK)
+        {
+            m_inFlightTransfers.insert(transfer);
+        }
+        else
+        {
+            AWS_LOGSTREAM_ERROR(CurlMultiTag, "Curl multi returned error code " << addResult << " adding handle.");
+            FinishTransfer(transfer, CURLE_FAILED_INIT);
+        }
+    }
+}
+
+void CurlMultiHttpClient::PollAndDispatch()
+{
+    //curl waits on the sockets of all transfers itself, which keeps the loop free of any platform specific polling.
+#if LIBCURL_VERSION_NUM >= 0x074400
+    CURLMcode pollResult = curl_multi_poll(m_multiHandle, nullptr, 0, MAX_POLL_WAIT_MS, nullptr);
+#else
+    CURLMcode pollResult = curl_multi_wait(m_multiHandle, nullptr, 0, UNWAKEABLE_POLL_WAIT_MS, nullptr);
+#endif
+    if (pollResult != CURLM_OK)
+    {
+        AWS_LOGSTREAM_ERROR(CurlMultiTag, "Curl multi returned error code " << pollResult << " waiting for transfers.");
+    }
+
+    int runningHandles = 0;
+    curl_multi_perform(m_multiHandle, &runningHandles);
+}
+
+void CurlMultiHttpClient::CompleteFinishedTransfers()
+{
+    int messagesLeft = 0;
+    CURLMsg* message = nullptr;
+    while ((message = curl_multi_info_read(m_multiHandle, &messagesLeft)) != nullptr)
+    {
+        if (message->msg != CURLMSG_DONE)
+        {
+            continue;
+        }
+
+        char* privateData = nullptr;
+        curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &privateData);
+        Transfer* transfer = reinterpret_cast<Transfer*>(privateData);
+        CURLcode result = message->data.result;
+
+        curl_multi_remove_handle(m_multiHandle, message->easy_handle);
+        m_inFlightTransfers.erase(transfer);
+        FinishTransfer(transfer, result);
+    }
+}
+
+void CurlMultiHttpClient::FinishTransfer(Transfer* transfer, CURLcode result)
+{
+    std::shared_ptr<HttpResponse> response = transfer->response;
+    if (result != CURLE_OK)
+    {
+        AWS_LOGSTREAM_ERROR(CurlMultiTag, "Curl returned error code " << result);
+        if (!transfer->handle || !KeepIncompleteResponse(transfer->handle, *transfer->writeContext.m_request, *response))
+        {
+            response = nullptr;
+        }
+    }
+    else
+    {
+        ReadTransferResults(transfer->handle, *response);
+    }
+
+    if (transfer->handle)
+    {
+        AWS_LOGSTREAM_DEBUG(CurlMultiTag, "Releasing curl handle " << transfer->handle);
+        m_curlHandleContainer.ReleaseCurlHandle(transfer->handle);
+    }
+
+    if (transfer->headers)
+    {
+        curl_slist_free_all(transfer->headers);
+    }
+
+    //go ahead and flush the response body stream
+    if (response)
+    {
+        response->GetResponseBody().flush();
+    }
+
+    transfer->onCompleted(response);
+    Aws::Delete(transfer);
+}
+
+void CurlMultiHttpClient::FailOutstandingTransfers()
+{
+    for (Transfer* transfer : m_inFlightTransfers)
+    {
+        curl_multi_remove_handle(m_multiHandle, transfer->handle);
+        FinishTransfer(transfer, CURLE_ABORTED_BY_CALLBACK);
+    }
+    m_inFlightTransfers.clear();
+
+    Aws::Queue<Transfer*> queuedTransfers;
+    {
+        std::lock_guard<std::mutex> locker(m_queueMutex);
+        std::swap(queuedTransfers, m_queuedTransfers);
+    }
+
+    while (!queuedTransfers.empty())
+    {
+        FinishTransfer(queuedTransfers.front(), CURLE_ABORTED_BY_CALLBACK);
+        queuedTransfers.pop();
+    }
+}
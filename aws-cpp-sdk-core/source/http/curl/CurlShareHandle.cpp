@@ -0,0 +1,77 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlShareHandle.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Http;
+
+static const char* CurlShareTag = "CurlShareHandle";
+
+CurlShareHandle::CurlShareHandle() :
+    m_shareHandle(curl_share_init())
+{
+    if (!m_shareHandle)
+    {
+        AWS_LOG_ERROR(CurlShareTag, "curl_share_init failed, handles won't share dns or tls session caches.");
+        return;
+    }
+
+    curl_share_setopt(m_shareHandle, CURLSHOPT_LOCKFUNC, &CurlShareHandle::LockData);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_UNLOCKFUNC, &CurlShareHandle::UnlockData);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+}
+
+CurlShareHandle::~CurlShareHandle()
+{
+    if (m_shareHandle)
+    {
+        CURLSHcode result = curl_share_cleanup(m_shareHandle);
+        if (result != CURLSHE_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CurlShareTag, "curl_share_cleanup returned error code " << result);
+        }
+    }
+}
+
+std::shared_ptr<CurlShareHandle> CurlShareHandle::GetProcessWideInstance()
+{
+    static std::mutex instanceMutex;
+    static std::weak_ptr<CurlShareHandle> instance;
+
+    std::lock_guard<std::mutex> locker(instanceMutex);
+    auto shareHandle = instance.lock();
+    if (!shareHandle)
+    {
+        AWS_LOG_INFO(CurlShareTag, "Creating the process wide curl share handle.");
+        shareHandle = Aws::MakeShared<CurlShareHandle>(CurlShareTag);
+        instance = shareHandle;
+    }
+    return shareHandle;
+}
+
+void CurlShareHandle::LockData(CURL*, curl_lock_data data, curl_lock_access, void* userData)
+{
+    //shared and single access are treated alike, the critical sections are short.
+    reinterpret_cast<CurlShareHandle*>(userData)->m_dataLocks[data].lock();
+}
+
+void CurlShareHandle::UnlockData(CURL*, curl_lock_data data, void* userData)
+{
+    reinterpret_cast<CurlShareHandle*>(userData)->m_dataLocks[data].unlock();
+}
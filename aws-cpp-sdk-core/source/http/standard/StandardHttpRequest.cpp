@@ -44,6 +44,14 @@ HeaderValueCollection StandardHttpRequest::GetHeaders() const
     return headers;
 }
 
+void StandardHttpRequest::VisitHeaders(const HeaderVisitor& visitor) const
+{
+    for (HeaderValueCollection::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
+    {
+        visitor(iter->first, iter->second);
+    }
+}
+
 const Aws::String& StandardHttpRequest::GetHeaderValue(const char* headerName) const
 {
     return headerMap.find(headerName)->second;
@@ -15,6 +15,8 @@
 
 #include <aws/core/http/windows/WinSyncHttpClient.h>
 #include <aws/core/Http/HttpRequest.h>
+#include <aws/core/http/ContentBodyEncoder.h>
+#include <aws/core/http/RequestBodySource.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -103,12 +105,22 @@ bool WinSyncHttpClient::StreamPayloadToRequest(const HttpRequest& request, void*
     {
         auto startingPos = payloadStream->tellg();
 
+        const auto& encoder = request.GetContentBodyEncoder();
+        RequestBodySource bodySource(request);
         char streamBuffer[ HTTP_REQUEST_WRITE_BUFFER_LENGTH ];
         bool done = false;
         while(success && !done)
         {
-            payloadStream->read(streamBuffer, HTTP_REQUEST_WRITE_BUFFER_LENGTH);
-            std::streamsize bytesRead = payloadStream->gcount();
+            std::streamsize bytesRead = 0;
+            size_t bodyBytesRead = 0;
+            if (encoder)
+            {
+                bytesRead = static_cast<std::streamsize>(encoder->Encode(*payloadStream, streamBuffer, HTTP_REQUEST_WRITE_BUFFER_LENGTH, bodyBytesRead));
+            }
+            else
+            {
+                bytesRead = static_cast<std::streamsize>(bodySource.Read(streamBuffer, HTTP_REQUEST_WRITE_BUFFER_LENGTH));
+            }
             success = !payloadStream->bad();
 
             uint64_t bytesWritten = 0;
@@ -122,12 +134,13 @@ bool WinSyncHttpClient::StreamPayloadToRequest(const HttpRequest& request, void*
             }
 
             auto& sentHandler = request.GetDataSentEventHandler();
-            if (sentHandler)
+            if (sentHandler && bytesRead > 0)
             {
-                sentHandler(&request, (long long)bytesWritten);
+                //with an encoder the wire also carries its framing, report how much of the body itself went out
+                sentHandler(&request, encoder ? (long long)bodyBytesRead : (long long)bytesWritten);
             }
 
-            if(!payloadStream->good())
+            if(bytesRead == 0)
             {
                 done = true;
             }
@@ -136,7 +149,10 @@ bool WinSyncHttpClient::StreamPayloadToRequest(const HttpRequest& request, void*
         }
 
         payloadStream->clear();
-        payloadStream->seekg(startingPos, payloadStream->beg);
+        if (startingPos >= 0)
+        {
+            payloadStream->seekg(startingPos, payloadStream->beg);
+        }
     }
 
     if(success)
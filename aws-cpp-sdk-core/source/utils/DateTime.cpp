@@ -15,6 +15,7 @@
 
 #include <aws/core/utils/DateTime.h>
 
+#include <cstdio>
 #include <ctime>
 
 #ifdef _WIN32
@@ -47,9 +48,13 @@ Aws::String DateTime::CalculateLocalTimestampAsString(const char* formatStr)
 }
 
 Aws::String DateTime::CalculateGmtTimestampAsString(const char* formatStr)
+{
+    return CalculateGmtTimestampAsString(std::time(nullptr), formatStr);
+}
+
+Aws::String DateTime::CalculateGmtTimestampAsString(std::time_t time, const char* formatStr)
 {
     std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
     struct tm* timestamp = std::gmtime(&time);
 
     if(timestamp)
@@ -90,3 +95,26 @@ Aws::String DateTime::ComputeCurrentDateInISO8601Format()
 {
     return CalculateGmtTimestampAsString(ISO_8601_SIMPLE_DATE_FORMAT_STR);
 }
+
+bool DateTime::ParseISO8601Timestamp(const Aws::String& timestamp, std::chrono::system_clock::time_point& time)
+{
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    char separator = 0;
+    if (std::sscanf(timestamp.c_str(), "%4d-%2d-%2d%c%2d:%2d:%2d", &year, &month, &day, &separator, &hour, &minute, &second) != 7 ||
+        (separator != 'T' && separator != 't') || month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60)
+    {
+        return false;
+    }
+
+    //days since 1970-01-01 in the proleptic gregorian calendar, without going through the (local time) mktime
+    int shiftedYear = month <= 2 ? year - 1 : year;
+    int era = (shiftedYear >= 0 ? shiftedYear : shiftedYear - 399) / 400;
+    int yearOfEra = shiftedYear - era * 400;
+    int dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    long long daysSinceEpoch = static_cast<long long>(era) * 146097 + dayOfEra - 719468;
+
+    time = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::seconds(daysSinceEpoch * 86400 + hour * 3600 + minute * 60 + second)));
+    return true;
+}
@@ -0,0 +1,127 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/LatencyHistogram.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Aws::Utils;
+
+//index of the highest set bit, value must not be 0
+static unsigned HighestBit(uint64_t value)
+{
+    unsigned bit = 0;
+    if (value >> 32) { value >>= 32; bit += 32; }
+    if (value >> 16) { value >>= 16; bit += 16; }
+    if (value >> 8) { value >>= 8; bit += 8; }
+    if (value >> 4) { value >>= 4; bit += 4; }
+    if (value >> 2) { value >>= 2; bit += 2; }
+    if (value >> 1) { bit += 1; }
+    return bit;
+}
+
+LatencyHistogram::LatencyHistogram() :
+    m_count(0),
+    m_sum(0),
+    m_max(0)
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t LatencyHistogram::GetBucketIndex(uint64_t value)
+{
+    if (value < 2 * SUB_BUCKET_COUNT)
+    {
+        return static_cast<size_t>(value);
+    }
+
+    //keep the SUB_BUCKET_BITS bits below the highest one, they pick the bucket within its power of two
+    unsigned highestBit = HighestBit(value);
+    unsigned shift = highestBit - SUB_BUCKET_BITS;
+    size_t subBucket = static_cast<size_t>(value >> shift) - SUB_BUCKET_COUNT;
+    return 2 * SUB_BUCKET_COUNT + (highestBit - SUB_BUCKET_BITS - 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(size_t bucketIndex)
+{
+    if (bucketIndex < 2 * SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+
+    size_t offset = bucketIndex - 2 * SUB_BUCKET_COUNT;
+    unsigned shift = static_cast<unsigned>(offset / SUB_BUCKET_COUNT) + 1;
+    uint64_t lowerBound = static_cast<uint64_t>(SUB_BUCKET_COUNT + offset % SUB_BUCKET_COUNT) << shift;
+    return lowerBound + ((static_cast<uint64_t>(1) << shift) - 1);
+}
+
+void LatencyHistogram::Record(uint64_t value)
+{
+    m_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t currentMax = m_max.load(std::memory_order_relaxed);
+    while (value > currentMax && !m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+double LatencyHistogram::GetMean() const
+{
+    uint64_t count = GetCount();
+    return count == 0 ? 0.0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / count;
+}
+
+uint64_t LatencyHistogram::GetValueAtPercentile(double percentile) const
+{
+    uint64_t count = GetCount();
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * count));
+    rank = (std::max)(rank, static_cast<uint64_t>(1));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return (std::min)(GetBucketUpperBound(i), GetMax());
+        }
+    }
+
+    //count ran ahead of the buckets while recording went on
+    return GetMax();
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,77 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/MultiDigest.h>
+
+#include <istream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+MultiDigest::MultiDigest(const Aws::Vector<std::shared_ptr<Hash>>& hashes) :
+    m_hashes(hashes)
+{
+}
+
+Aws::Vector<HashResult> MultiDigest::Calculate(const Aws::String& str)
+{
+    for (auto& hash : m_hashes)
+    {
+        hash->Update((unsigned char*)str.c_str(), str.length());
+    }
+
+    return GetHashes(true);
+}
+
+Aws::Vector<HashResult> MultiDigest::Calculate(Aws::IStream& stream)
+{
+    auto currentPos = stream.tellg();
+    stream.seekg(0, stream.beg);
+
+    char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+    while (stream.good())
+    {
+        stream.read(streamBuffer, Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
+
+        if (bytesRead > 0)
+        {
+            for (auto& hash : m_hashes)
+            {
+                hash->Update((unsigned char*)streamBuffer, static_cast<size_t>(bytesRead));
+            }
+        }
+    }
+
+    bool success = stream.eof();
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    return GetHashes(success);
+}
+
+Aws::Vector<HashResult> MultiDigest::GetHashes(bool success)
+{
+    Aws::Vector<HashResult> results;
+    results.reserve(m_hashes.size());
+    for (auto& hash : m_hashes)
+    {
+        //always finish the running digest so the hash is ready for the next calculation
+        auto result = hash->GetHash();
+        results.push_back(success ? std::move(result) : HashResult());
+    }
+
+    return results;
+}
@@ -79,6 +79,8 @@ BCryptHashImpl::BCryptHashImpl(LPCWSTR algorithmName, bool isHMAC) :
     m_hashBuffer(nullptr),
     m_hashObjectLength(0),
     m_hashObject(nullptr),
+    m_runningContext(nullptr),
+    m_runningHashFailed(false),
     m_algorithmMutex()
 {
     NTSTATUS status = BCryptOpenAlgorithmProvider(&m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, isHMAC ? BCRYPT_ALG_HANDLE_HMAC_FLAG : 0);
@@ -121,6 +123,7 @@ BCryptHashImpl::BCryptHashImpl(LPCWSTR algorithmName, bool isHMAC) :
 
 BCryptHashImpl::~BCryptHashImpl()
 {
+    Aws::Delete(m_runningContext);
     Aws::DeleteArray(m_hashObject);
     Aws::DeleteArray(m_hashBuffer);
 
@@ -261,6 +264,74 @@ HashResult BCryptHashImpl::Calculate(Aws::IStream& stream)
     return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
 }
 
+void BCryptHashImpl::Update(PBYTE data, ULONG dataLength)
+{
+    if(!IsValid())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<BCryptHashContext>(logTag, m_algorithmHandle, nullptr, 0);
+        m_runningHashFailed = !m_runningContext->IsValid();
+        if (m_runningHashFailed)
+        {
+            AWS_LOG_ERROR(logTag, "Error creating hash handle.");
+        }
+    }
+
+    if (m_runningHashFailed)
+    {
+        return;
+    }
+
+    NTSTATUS status = BCryptHashData(m_runningContext->m_hashHandle, data, dataLength, 0);
+    if (!NT_SUCCESS(status))
+    {
+        AWS_LOG_ERROR(logTag, "Error computing hash.");
+        m_runningHashFailed = true;
+    }
+}
+
+HashResult BCryptHashImpl::GetHash()
+{
+    if(!IsValid())
+    {
+        return HashResult();
+    }
+
+    std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<BCryptHashContext>(logTag, m_algorithmHandle, nullptr, 0);
+        m_runningHashFailed = !m_runningContext->IsValid();
+    }
+
+    HashResult result;
+    if (!m_runningHashFailed)
+    {
+        NTSTATUS status = BCryptFinishHash(m_runningContext->m_hashHandle, m_hashBuffer, m_hashBufferLength, 0);
+        if (NT_SUCCESS(status))
+        {
+            result = HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
+        }
+        else
+        {
+            AWS_LOG_ERROR(logTag, "Error obtaining computed hash");
+        }
+    }
+
+    Aws::Delete(m_runningContext);
+    m_runningContext = nullptr;
+    m_runningHashFailed = false;
+
+    return result;
+}
+
 MD5BcryptImpl::MD5BcryptImpl() :
     m_impl(BCRYPT_MD5_ALGORITHM, false)
 {
@@ -276,6 +347,16 @@ HashResult MD5BcryptImpl::Calculate(Aws::IStream& stream)
     return m_impl.Calculate(stream); 
 }
 
+void MD5BcryptImpl::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_impl.Update(static_cast<PBYTE>(buffer), static_cast<ULONG>(bufferSize));
+}
+
+HashResult MD5BcryptImpl::GetHash()
+{
+    return m_impl.GetHash();
+}
+
 Sha256BcryptImpl::Sha256BcryptImpl() :
     m_impl(BCRYPT_SHA256_ALGORITHM, false)
 {
@@ -291,6 +372,16 @@ HashResult Sha256BcryptImpl::Calculate(Aws::IStream& stream)
     return m_impl.Calculate(stream); 
 }
 
+void Sha256BcryptImpl::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_impl.Update(static_cast<PBYTE>(buffer), static_cast<ULONG>(bufferSize));
+}
+
+HashResult Sha256BcryptImpl::GetHash()
+{
+    return m_impl.GetHash();
+}
+
 Sha256HMACBcryptImpl::Sha256HMACBcryptImpl() :
     m_impl(BCRYPT_SHA256_ALGORITHM, true)
 {
@@ -60,6 +60,31 @@ HashResult MD5CommonCryptoImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+void MD5CommonCryptoImpl::Update(unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_updateStarted)
+    {
+        CC_MD5_Init(&m_ctx);
+        m_updateStarted = true;
+    }
+
+    CC_MD5_Update(&m_ctx, buffer, static_cast<CC_LONG>(bufferSize));
+}
+
+HashResult MD5CommonCryptoImpl::GetHash()
+{
+    if (!m_updateStarted)
+    {
+        CC_MD5_Init(&m_ctx);
+    }
+    m_updateStarted = false;
+
+    ByteBuffer hash(CC_MD5_DIGEST_LENGTH);
+    CC_MD5_Final(hash.GetUnderlyingData(), &m_ctx);
+
+    return HashResult(std::move(hash));
+}
+
 HashResult Sha256CommonCryptoImpl::Calculate(const Aws::String& str)
 {
     ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
@@ -97,6 +122,31 @@ HashResult Sha256CommonCryptoImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+void Sha256CommonCryptoImpl::Update(unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_updateStarted)
+    {
+        CC_SHA256_Init(&m_ctx);
+        m_updateStarted = true;
+    }
+
+    CC_SHA256_Update(&m_ctx, buffer, static_cast<CC_LONG>(bufferSize));
+}
+
+HashResult Sha256CommonCryptoImpl::GetHash()
+{
+    if (!m_updateStarted)
+    {
+        CC_SHA256_Init(&m_ctx);
+    }
+    m_updateStarted = false;
+
+    ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
+    CC_SHA256_Final(hash.GetUnderlyingData(), &m_ctx);
+
+    return HashResult(std::move(hash));
+}
+
 HashResult Sha256HMACCommonCryptoImpl::Calculate(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
     unsigned int length = CC_SHA256_DIGEST_LENGTH;
@@ -65,6 +65,31 @@ HashResult MD5OpenSSLImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+void MD5OpenSSLImpl::Update(unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_updateStarted)
+    {
+        MD5_Init(&m_ctx);
+        m_updateStarted = true;
+    }
+
+    MD5_Update(&m_ctx, buffer, bufferSize);
+}
+
+HashResult MD5OpenSSLImpl::GetHash()
+{
+    if (!m_updateStarted)
+    {
+        MD5_Init(&m_ctx);
+    }
+    m_updateStarted = false;
+
+    ByteBuffer hash(MD5_DIGEST_LENGTH);
+    MD5_Final(hash.GetUnderlyingData(), &m_ctx);
+
+    return HashResult(std::move(hash));
+}
+
 HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
 {
     SHA256_CTX sha256;
@@ -106,6 +131,31 @@ HashResult Sha256OpenSSLImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+void Sha256OpenSSLImpl::Update(unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_updateStarted)
+    {
+        SHA256_Init(&m_ctx);
+        m_updateStarted = true;
+    }
+
+    SHA256_Update(&m_ctx, buffer, bufferSize);
+}
+
+HashResult Sha256OpenSSLImpl::GetHash()
+{
+    if (!m_updateStarted)
+    {
+        SHA256_Init(&m_ctx);
+    }
+    m_updateStarted = false;
+
+    ByteBuffer hash(SHA256_DIGEST_LENGTH);
+    SHA256_Final(hash.GetUnderlyingData(), &m_ctx);
+
+    return HashResult(std::move(hash));
+}
+
 HashResult Sha256HMACOpenSSLImpl::Calculate(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
     unsigned int length = SHA256_DIGEST_LENGTH;
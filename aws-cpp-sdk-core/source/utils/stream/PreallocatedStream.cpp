@@ -0,0 +1,107 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/PreallocatedStream.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* PREALLOCATED_STREAM_TAG = "PreallocatedStream";
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(unsigned char* buffer, size_t capacity, const std::shared_ptr<void>& owner) :
+    m_begin(reinterpret_cast<char*>(buffer)),
+    m_capacity(buffer ? capacity : 0),
+    m_owner(owner)
+{
+    setp(m_begin, m_begin + m_capacity);
+    setg(m_begin, m_begin, m_begin);
+}
+
+PreallocatedStreamBuf::int_type PreallocatedStreamBuf::underflow()
+{
+    //whatever was written since the last read becomes readable
+    setg(m_begin, gptr(), pptr());
+    return gptr() < egptr() ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    off_type written = static_cast<off_type>(GetBytesWritten());
+    if (which & std::ios_base::out)
+    {
+        off_type newPos = off + (dir == std::ios_base::beg ? 0 : written);
+        if (newPos != written || (which & std::ios_base::in))
+        {
+            return pos_type(off_type(-1));
+        }
+        return pos_type(written);
+    }
+
+    if ((which & std::ios_base::in) == 0)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = static_cast<off_type>(gptr() - m_begin);
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = written;
+    }
+
+    off_type newPos = base + off;
+    if (newPos < 0 || newPos > written)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    setg(m_begin, m_begin + newPos, pptr());
+    return pos_type(newPos);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+PreallocatedStream::PreallocatedStream(const std::shared_ptr<ByteBuffer>& buffer) :
+    Base(nullptr),
+    m_streamBuf(buffer ? buffer->GetUnderlyingData() : nullptr, buffer ? buffer->GetLength() : 0, buffer)
+{
+    rdbuf(&m_streamBuf);
+}
+
+PreallocatedStream::PreallocatedStream(unsigned char* buffer, size_t capacity, const std::shared_ptr<void>& owner) :
+    Base(nullptr),
+    m_streamBuf(buffer, capacity, owner)
+{
+    rdbuf(&m_streamBuf);
+}
+
+Aws::IOStreamFactory Aws::Utils::Stream::PreallocatedResponseStreamFactory(unsigned char* buffer, size_t capacity, const std::shared_ptr<void>& owner)
+{
+    return [buffer, capacity, owner]() -> Aws::IOStream*
+    {
+        return Aws::New<PreallocatedStream>(PREALLOCATED_STREAM_TAG, buffer, capacity, owner);
+    };
+}
+
+Aws::IOStreamFactory Aws::Utils::Stream::PreallocatedResponseStreamFactory(const std::shared_ptr<ByteBuffer>& buffer)
+{
+    return PreallocatedResponseStreamFactory(buffer ? buffer->GetUnderlyingData() : nullptr, buffer ? buffer->GetLength() : 0, buffer);
+}
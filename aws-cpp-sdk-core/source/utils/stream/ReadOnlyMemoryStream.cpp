@@ -0,0 +1,80 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/ReadOnlyMemoryStream.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+ReadOnlyMemoryStreamBuf::ReadOnlyMemoryStreamBuf(const unsigned char* data, size_t length, const std::shared_ptr<const void>& owner) :
+    //there is no put area and pbackfail is left as is, so nothing is ever written through this pointer
+    m_begin(reinterpret_cast<char*>(const_cast<unsigned char*>(data))),
+    m_length(data ? length : 0),
+    m_owner(owner)
+{
+    setg(m_begin, m_begin, m_begin + m_length);
+}
+
+ReadOnlyMemoryStreamBuf::pos_type ReadOnlyMemoryStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    if ((which & std::ios_base::in) == 0)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = static_cast<off_type>(gptr() - m_begin);
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = static_cast<off_type>(m_length);
+    }
+
+    off_type newPos = base + off;
+    if (newPos < 0 || newPos > static_cast<off_type>(m_length))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    setg(m_begin, m_begin + newPos, m_begin + m_length);
+    return pos_type(newPos);
+}
+
+ReadOnlyMemoryStreamBuf::pos_type ReadOnlyMemoryStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+std::streamsize ReadOnlyMemoryStreamBuf::showmanyc()
+{
+    std::streamsize remaining = static_cast<std::streamsize>(egptr() - gptr());
+    return remaining > 0 ? remaining : -1;
+}
+
+ReadOnlyMemoryStream::ReadOnlyMemoryStream(const std::shared_ptr<ByteBuffer>& buffer) :
+    Base(nullptr),
+    m_streamBuf(buffer ? buffer->GetUnderlyingData() : nullptr, buffer ? buffer->GetLength() : 0, buffer)
+{
+    rdbuf(&m_streamBuf);
+}
+
+ReadOnlyMemoryStream::ReadOnlyMemoryStream(const unsigned char* data, size_t length, const std::shared_ptr<const void>& owner) :
+    Base(nullptr),
+    m_streamBuf(data, length, owner)
+{
+    rdbuf(&m_streamBuf);
+}
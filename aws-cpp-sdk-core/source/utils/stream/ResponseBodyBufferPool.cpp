@@ -0,0 +1,104 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/ResponseBodyBufferPool.h>
+#include <aws/core/utils/stream/ResponseBodyStreamBuf.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* POOL_ALLOCATION_TAG = "ResponseBodyBufferPool";
+
+namespace
+{
+    /**
+     * Response body stream that hands its storage back to the pool it came from when it is destroyed.
+     */
+    class PooledResponseStream : public Aws::IOStream
+    {
+    public:
+        PooledResponseStream(const std::shared_ptr<ResponseBodyBufferPool>& pool) :
+            Aws::IOStream(nullptr),
+            m_streamBuf(pool->Acquire()),
+            m_pool(pool)
+        {
+            rdbuf(&m_streamBuf);
+        }
+
+        ~PooledResponseStream()
+        {
+            auto pool = m_pool.lock();
+            if (pool)
+            {
+                pool->Release(m_streamBuf.ReleaseStorage());
+            }
+        }
+
+    private:
+        ResponseBodyStreamBuf m_streamBuf;
+        std::weak_ptr<ResponseBodyBufferPool> m_pool;
+    };
+}
+
+ResponseBodyBufferPool::ResponseBodyBufferPool(size_t maxPooledBuffers, size_t maxPooledBufferSize) :
+    m_maxPooledBuffers(maxPooledBuffers),
+    m_maxPooledBufferSize(maxPooledBufferSize),
+    m_reuseCount(0)
+{
+    m_pool.reserve(maxPooledBuffers);
+}
+
+Aws::IOStreamFactory ResponseBodyBufferPool::GetResponseStreamFactory()
+{
+    auto pool = shared_from_this();
+    return [pool]() -> Aws::IOStream*
+    {
+        return Aws::New<PooledResponseStream>(POOL_ALLOCATION_TAG, pool);
+    };
+}
+
+Array<char> ResponseBodyBufferPool::Acquire()
+{
+    std::lock_guard<std::mutex> locker(m_poolMutex);
+    if (m_pool.empty())
+    {
+        return Array<char>();
+    }
+
+    Array<char> buffer(std::move(m_pool.back()));
+    m_pool.pop_back();
+    ++m_reuseCount;
+    return buffer;
+}
+
+void ResponseBodyBufferPool::Release(Array<char>&& buffer)
+{
+    if (buffer.GetLength() == 0 || buffer.GetLength() > m_maxPooledBufferSize)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_poolMutex);
+    if (m_pool.size() < m_maxPooledBuffers)
+    {
+        m_pool.push_back(std::move(buffer));
+    }
+}
+
+size_t ResponseBodyBufferPool::GetPooledBufferCount() const
+{
+    std::lock_guard<std::mutex> locker(m_poolMutex);
+    return m_pool.size();
+}
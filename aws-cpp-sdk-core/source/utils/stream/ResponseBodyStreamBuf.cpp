@@ -0,0 +1,169 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/ResponseBodyStreamBuf.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+//smallest amount the buffer grows by when it runs out of room
+static const size_t MIN_GROWTH = 256;
+
+ResponseBodyStreamBuf::ResponseBodyStreamBuf() :
+    m_highWaterMark(0)
+{
+    setp(nullptr, nullptr);
+    setg(nullptr, nullptr, nullptr);
+}
+
+ResponseBodyStreamBuf::ResponseBodyStreamBuf(Array<char>&& storage) :
+    m_storage(std::move(storage)),
+    m_highWaterMark(0)
+{
+    char* base = m_storage.GetUnderlyingData();
+    setp(base, base + m_storage.GetLength());
+    setg(base, base, base);
+}
+
+void ResponseBodyStreamBuf::Reserve(size_t size)
+{
+    if (size > m_storage.GetLength())
+    {
+        Resize(size);
+    }
+}
+
+size_t ResponseBodyStreamBuf::GetSize() const
+{
+    return (std::max)(m_highWaterMark, static_cast<size_t>(pptr() - pbase()));
+}
+
+Array<char> ResponseBodyStreamBuf::ReleaseStorage()
+{
+    Array<char> storage(std::move(m_storage));
+    m_storage = Array<char>();
+    m_highWaterMark = 0;
+    setp(nullptr, nullptr);
+    setg(nullptr, nullptr, nullptr);
+    return storage;
+}
+
+void ResponseBodyStreamBuf::UpdateHighWaterMark()
+{
+    m_highWaterMark = GetSize();
+}
+
+void ResponseBodyStreamBuf::SetPutOffset(size_t offset)
+{
+    char* base = m_storage.GetUnderlyingData();
+    setp(base, base + m_storage.GetLength());
+    //pbump only takes an int
+    while (offset > 0)
+    {
+        int step = static_cast<int>((std::min)(offset, static_cast<size_t>(INT_MAX)));
+        pbump(step);
+        offset -= static_cast<size_t>(step);
+    }
+}
+
+void ResponseBodyStreamBuf::Resize(size_t newCapacity)
+{
+    UpdateHighWaterMark();
+    size_t putOffset = static_cast<size_t>(pptr() - pbase());
+    size_t getOffset = static_cast<size_t>(gptr() - eback());
+
+    //only the bytes written so far are carried over, the rest of the new storage stays uninitialized
+    Array<char> newStorage(newCapacity);
+    if (m_highWaterMark > 0)
+    {
+        std::memcpy(newStorage.GetUnderlyingData(), m_storage.GetUnderlyingData(), m_highWaterMark);
+    }
+    m_storage = std::move(newStorage);
+
+    SetPutOffset(putOffset);
+    char* base = m_storage.GetUnderlyingData();
+    setg(base, base + getOffset, base + m_highWaterMark);
+}
+
+ResponseBodyStreamBuf::int_type ResponseBodyStreamBuf::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        return traits_type::not_eof(ch);
+    }
+
+    Resize((std::max)(m_storage.GetLength() * 2, m_storage.GetLength() + MIN_GROWTH));
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+    return ch;
+}
+
+ResponseBodyStreamBuf::int_type ResponseBodyStreamBuf::underflow()
+{
+    //whatever was written since the last read becomes readable
+    UpdateHighWaterMark();
+    setg(eback(), gptr(), pbase() + m_highWaterMark);
+    return gptr() < egptr() ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+ResponseBodyStreamBuf::pos_type ResponseBodyStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    bool seekIn = (which & std::ios_base::in) != 0;
+    bool seekOut = (which & std::ios_base::out) != 0;
+    if ((!seekIn && !seekOut) || (seekIn && seekOut && dir == std::ios_base::cur))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    UpdateHighWaterMark();
+    char* base = m_storage.GetUnderlyingData();
+    off_type size = static_cast<off_type>(m_highWaterMark);
+
+    off_type origin = 0;
+    if (dir == std::ios_base::cur)
+    {
+        origin = seekIn ? static_cast<off_type>(gptr() - eback()) : static_cast<off_type>(pptr() - pbase());
+    }
+    else if (dir == std::ios_base::end)
+    {
+        origin = size;
+    }
+
+    off_type newPos = origin + off;
+    if (newPos < 0 || newPos > size)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (seekIn)
+    {
+        setg(base, base + newPos, base + size);
+    }
+    if (seekOut)
+    {
+        SetPutOffset(static_cast<size_t>(newPos));
+    }
+
+    return pos_type(newPos);
+}
+
+ResponseBodyStreamBuf::pos_type ResponseBodyStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
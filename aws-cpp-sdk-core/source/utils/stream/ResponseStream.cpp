@@ -14,7 +14,7 @@
   */
 
 #include <aws/core/utils/stream/ResponseStream.h>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseBodyStreamBuf.h>
 
 using namespace Aws::Utils::Stream;
 
@@ -66,7 +66,7 @@ void ResponseStream::ReleaseStream()
 static const char *DEFAULT_STREAM_TAG = "DefaultUnderlyingStream";
 
 DefaultUnderlyingStream::DefaultUnderlyingStream() :
-    Base( Aws::New< Aws::StringBuf >( DEFAULT_STREAM_TAG ) )
+    Base( Aws::New< ResponseBodyStreamBuf >( DEFAULT_STREAM_TAG ) )
 {}
 
 DefaultUnderlyingStream::~DefaultUnderlyingStream()
@@ -0,0 +1,45 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/CancellationToken.h>
+
+using namespace Aws::Utils::Threading;
+
+CancellationToken::CancellationToken() :
+    m_cancelled(false)
+{
+}
+
+CancellationToken::CancellationToken(const std::shared_ptr<CancellationToken>& parent) :
+    m_parent(parent),
+    m_cancelled(false)
+{
+}
+
+void CancellationToken::Cancel()
+{
+    {
+        //taken so a waiter can't check the flag, miss the notification and then sleep through it
+        std::lock_guard<std::mutex> locker(m_signalLock);
+        m_cancelled = true;
+    }
+    m_signal.notify_all();
+}
+
+bool CancellationToken::WaitForCancellation(std::chrono::milliseconds timeToWait) const
+{
+    std::unique_lock<std::mutex> locker(m_signalLock);
+    return m_signal.wait_for(locker, timeToWait, [this]() { return m_cancelled.load(); });
+}
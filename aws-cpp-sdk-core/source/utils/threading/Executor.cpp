@@ -14,15 +14,337 @@
   */
 
 #include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/logging/LogMacros.h>
 
 
+#include <algorithm>
 #include <thread>
 
 using namespace Aws::Utils::Threading;
 
+static const char* POOLED_EXECUTOR_TAG = "PooledThreadExecutor";
+static const char* WORK_STEALING_EXECUTOR_TAG = "WorkStealingThreadExecutor";
+
+//the work-stealing executor state and worker index of the calling thread, set once by each worker as it starts
+static thread_local const void* currentStealingState = nullptr;
+static thread_local size_t currentStealingWorker = 0;
+
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
     std::thread t(fx);
     t.detach();
     return true;
-}
\ No newline at end of file
+}
+
+PooledThreadExecutor::PoolState::PoolState(size_t maxQueueSize, OverflowPolicy overflowPolicy) :
+    maxQueueSize((std::max)(maxQueueSize, static_cast<size_t>(1))),
+    overflowPolicy(overflowPolicy),
+    continueRunning(true),
+    peakQueueDepth(0),
+    executedTaskCount(0),
+    rejectedTaskCount(0),
+    callerRunTaskCount(0),
+    totalTaskWaitMicros(0),
+    maxTaskWaitMicros(0)
+{
+}
+
+void PooledThreadExecutor::PoolState::RecordWaitTime(std::chrono::steady_clock::time_point submitted)
+{
+    auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - submitted).count();
+    unsigned long long waitedMicros = static_cast<unsigned long long>((std::max)(waited, static_cast<decltype(waited)>(0)));
+    totalTaskWaitMicros += waitedMicros;
+
+    unsigned long long currentMax = maxTaskWaitMicros.load();
+    while (waitedMicros > currentMax && !maxTaskWaitMicros.compare_exchange_weak(currentMax, waitedMicros)) {}
+}
+
+PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, size_t maxQueueSize, OverflowPolicy overflowPolicy) :
+    m_state(Aws::MakeShared<PoolState>(POOLED_EXECUTOR_TAG, maxQueueSize, overflowPolicy))
+{
+    poolSize = (std::max)(poolSize, static_cast<size_t>(1));
+    AWS_LOGSTREAM_INFO(POOLED_EXECUTOR_TAG, "Starting " << poolSize << " worker threads with a queue of " << m_state->maxQueueSize << " tasks.");
+
+    m_workers.reserve(poolSize);
+    for (size_t i = 0; i < poolSize; ++i)
+    {
+        m_workers.emplace_back(&PooledThreadExecutor::WorkerLoop, m_state);
+    }
+}
+
+PooledThreadExecutor::~PooledThreadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_state->queueLock);
+        m_state->continueRunning = false;
+    }
+    m_state->queueNotEmpty.notify_all();
+    m_state->queueNotFull.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.get_id() == std::this_thread::get_id())
+        {
+            //the last reference was dropped by one of our own tasks. That worker can't be joined from here, it drains
+            //what is left of the queue through its own reference to the pool state and exits.
+            worker.detach();
+        }
+        else if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+size_t PooledThreadExecutor::GetQueueDepth() const
+{
+    std::lock_guard<std::mutex> locker(m_state->queueLock);
+    return m_state->tasks.size();
+}
+
+bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fx)
+{
+    PoolState& state = *m_state;
+    bool runOnCaller = false;
+    {
+        std::unique_lock<std::mutex> locker(state.queueLock);
+        if (state.continueRunning && state.tasks.size() >= state.maxQueueSize)
+        {
+            if (state.overflowPolicy == OverflowPolicy::RUN_ON_CALLER || IsWorkerThread())
+            {
+                runOnCaller = true;
+            }
+            else if (state.overflowPolicy == OverflowPolicy::REJECT)
+            {
+                ++state.rejectedTaskCount;
+                AWS_LOG_WARN(POOLED_EXECUTOR_TAG, "Task queue is full, rejecting task.");
+                return false;
+            }
+            else
+            {
+                state.queueNotFull.wait(locker, [&state]() { return !state.continueRunning || state.tasks.size() < state.maxQueueSize; });
+            }
+        }
+
+        if (!state.continueRunning)
+        {
+            ++state.rejectedTaskCount;
+            AWS_LOG_WARN(POOLED_EXECUTOR_TAG, "Executor is shutting down, rejecting task.");
+            return false;
+        }
+
+        if (!runOnCaller)
+        {
+            QueuedTask queuedTask;
+            queuedTask.task = std::move(fx);
+            queuedTask.submitted = std::chrono::steady_clock::now();
+            state.tasks.push(std::move(queuedTask));
+
+            size_t depth = state.tasks.size();
+            size_t peak = state.peakQueueDepth.load();
+            while (depth > peak && !state.peakQueueDepth.compare_exchange_weak(peak, depth)) {}
+        }
+    }
+
+    if (runOnCaller)
+    {
+        ++state.callerRunTaskCount;
+        fx();
+        return true;
+    }
+
+    state.queueNotEmpty.notify_one();
+    return true;
+}
+
+void PooledThreadExecutor::WorkerLoop(std::shared_ptr<PoolState> state)
+{
+    for (;;)
+    {
+        QueuedTask queuedTask;
+        {
+            std::unique_lock<std::mutex> locker(state->queueLock);
+            state->queueNotEmpty.wait(locker, [&state]() { return !state->continueRunning || !state->tasks.empty(); });
+            if (state->tasks.empty())
+            {
+                return;
+            }
+
+            queuedTask = std::move(state->tasks.front());
+            state->tasks.pop();
+        }
+        state->queueNotFull.notify_one();
+
+        state->RecordWaitTime(queuedTask.submitted);
+        queuedTask.task();
+        ++state->executedTaskCount;
+    }
+}
+
+bool PooledThreadExecutor::IsWorkerThread() const
+{
+    auto currentThread = std::this_thread::get_id();
+    for (auto& worker : m_workers)
+    {
+        if (worker.get_id() == currentThread)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+WorkStealingThreadExecutor::StealingState::StealingState(size_t poolSize) :
+    pendingTasks(0),
+    pushedTasks(0),
+    sleepingWorkers(0),
+    stolenTaskCount(0),
+    continueRunning(true)
+{
+    queues.reserve(poolSize);
+    for (size_t i = 0; i < poolSize; ++i)
+    {
+        queues.push_back(Aws::MakeUnique<WorkerQueue>(WORK_STEALING_EXECUTOR_TAG));
+    }
+}
+
+WorkStealingThreadExecutor::WorkStealingThreadExecutor(size_t poolSize) :
+    m_nextQueue(0)
+{
+    poolSize = (std::max)(poolSize, static_cast<size_t>(1));
+    AWS_LOGSTREAM_INFO(WORK_STEALING_EXECUTOR_TAG, "Starting " << poolSize << " worker threads.");
+
+    m_state = Aws::MakeShared<StealingState>(WORK_STEALING_EXECUTOR_TAG, poolSize);
+    m_workers.reserve(poolSize);
+    for (size_t i = 0; i < poolSize; ++i)
+    {
+        m_workers.emplace_back(&WorkStealingThreadExecutor::WorkerLoop, m_state, i);
+    }
+}
+
+WorkStealingThreadExecutor::~WorkStealingThreadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_state->sleepLock);
+        m_state->continueRunning = false;
+    }
+    m_state->workAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.get_id() == std::this_thread::get_id())
+        {
+            //the last reference was dropped by one of our own tasks. That worker can't be joined from here, it finishes
+            //through its own reference to the shared state.
+            worker.detach();
+        }
+        else if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+bool WorkStealingThreadExecutor::SubmitToThread(std::function<void()>&& fx)
+{
+    StealingState& state = *m_state;
+    size_t queueIndex = CurrentWorkerIndex();
+    if (queueIndex == state.queues.size())
+    {
+        queueIndex = m_nextQueue++ % state.queues.size();
+    }
+
+    ++state.pendingTasks;
+    {
+        std::lock_guard<std::mutex> locker(state.queues[queueIndex]->lock);
+        state.queues[queueIndex]->tasks.push_back(std::move(fx));
+    }
+    ++state.pushedTasks;
+
+    //a worker bumps sleepingWorkers before it checks pushedTasks, so one of the two sides always sees the other.
+    if (state.sleepingWorkers > 0)
+    {
+        std::lock_guard<std::mutex> locker(state.sleepLock);
+        state.workAvailable.notify_one();
+    }
+    return true;
+}
+
+void WorkStealingThreadExecutor::WorkerLoop(std::shared_ptr<StealingState> state, size_t workerIndex)
+{
+    //the worker keeps the state alive, so no other executor's state can take its address while this is set
+    currentStealingState = state.get();
+    currentStealingWorker = workerIndex;
+
+    std::function<void()> task;
+    for (;;)
+    {
+        unsigned long long pushedBeforeSearch = state->pushedTasks.load();
+        if (state->PopLocal(workerIndex, task) || state->Steal(workerIndex, task))
+        {
+            if (--state->pendingTasks == 0 && !state->continueRunning)
+            {
+                //workers waiting to shut down are waiting for the last task to be taken.
+                std::lock_guard<std::mutex> locker(state->sleepLock);
+                state->workAvailable.notify_all();
+            }
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(state->sleepLock);
+        if (!state->continueRunning && state->pendingTasks == 0)
+        {
+            return;
+        }
+
+        //nothing was found. Any task pushed since the search started bumped pushedTasks, and pending tasks that aren't
+        //pushed yet will, so sleeping until then can't strand a task.
+        ++state->sleepingWorkers;
+        state->workAvailable.wait(locker, [&]()
+        {
+            return state->pushedTasks != pushedBeforeSearch || (!state->continueRunning && state->pendingTasks == 0);
+        });
+        --state->sleepingWorkers;
+    }
+}
+
+bool WorkStealingThreadExecutor::StealingState::PopLocal(size_t workerIndex, std::function<void()>& task)
+{
+    WorkerQueue& queue = *queues[workerIndex];
+    std::lock_guard<std::mutex> locker(queue.lock);
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingThreadExecutor::StealingState::Steal(size_t workerIndex, std::function<void()>& task)
+{
+    //victims are locked rather than tried, a worker that skipped a busy deque could go to sleep while it still holds work.
+    for (size_t offset = 1; offset < queues.size(); ++offset)
+    {
+        WorkerQueue& victim = *queues[(workerIndex + offset) % queues.size()];
+        std::lock_guard<std::mutex> locker(victim.lock);
+        if (victim.tasks.empty())
+        {
+            continue;
+        }
+
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        ++stolenTaskCount;
+        return true;
+    }
+    return false;
+}
+
+size_t WorkStealingThreadExecutor::CurrentWorkerIndex() const
+{
+    return currentStealingState == m_state.get() ? currentStealingWorker : m_state->queues.size();
+}
@@ -0,0 +1,156 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/TimerQueue.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSAllocator.h>
+
+using namespace Aws::Utils::Threading;
+
+static const char* TIMER_QUEUE_TAG = "TimerQueue";
+
+static std::mutex s_sharedTimerQueueLock;
+static std::weak_ptr<TimerQueue> s_sharedTimerQueue;
+
+TimerQueue::TimerQueue() :
+    m_state(Aws::MakeShared<TimerState>(TIMER_QUEUE_TAG))
+{
+    std::lock_guard<std::mutex> locker(m_state->stateLock);
+    m_thread = std::thread(&TimerQueue::TimerLoop, m_state);
+    m_state->timerThreadId = m_thread.get_id();
+}
+
+TimerQueue::~TimerQueue()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_state->stateLock);
+        m_state->continueRunning = false;
+        m_state->tasks.clear();
+        m_state->dueTimes.clear();
+    }
+    m_state->tasksChanged.notify_all();
+
+    if (m_thread.get_id() == std::this_thread::get_id())
+    {
+        //the last reference was dropped by one of our own tasks, the thread exits through its own reference to the state once it returns
+        m_thread.detach();
+    }
+    else if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+TimerQueue::TimerId TimerQueue::Schedule(std::chrono::steady_clock::time_point runAt, std::function<void()>&& task)
+{
+    TimerId timerId = 0;
+    bool runsFirst = false;
+    {
+        std::lock_guard<std::mutex> locker(m_state->stateLock);
+        timerId = m_state->nextTimerId++;
+        m_state->tasks.emplace(ScheduleKey(runAt, timerId), std::move(task));
+        m_state->dueTimes.emplace(timerId, runAt);
+        runsFirst = m_state->tasks.begin()->first.second == timerId;
+    }
+
+    //the thread only needs to wake up if it is waiting for a later task
+    if (runsFirst)
+    {
+        m_state->tasksChanged.notify_one();
+    }
+    return timerId;
+}
+
+bool TimerQueue::Cancel(TimerId timerId)
+{
+    std::unique_lock<std::mutex> locker(m_state->stateLock);
+    auto dueTime = m_state->dueTimes.find(timerId);
+    if (dueTime != m_state->dueTimes.end())
+    {
+        m_state->tasks.erase(ScheduleKey(dueTime->second, timerId));
+        m_state->dueTimes.erase(dueTime);
+        return true;
+    }
+
+    if (std::this_thread::get_id() != m_state->timerThreadId)
+    {
+        m_state->taskDone.wait(locker, [&]() { return m_state->runningTimerId != timerId; });
+    }
+    return false;
+}
+
+size_t TimerQueue::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> locker(m_state->stateLock);
+    return m_state->tasks.size();
+}
+
+std::shared_ptr<TimerQueue> TimerQueue::GetShared()
+{
+    std::lock_guard<std::mutex> locker(s_sharedTimerQueueLock);
+    auto timerQueue = s_sharedTimerQueue.lock();
+    if (!timerQueue)
+    {
+        //the reference kept here is dropped along with the queue, so nothing of it is left over once the queue is gone
+        timerQueue = std::shared_ptr<TimerQueue>(Aws::New<TimerQueue>(TIMER_QUEUE_TAG), [](TimerQueue* expiredTimerQueue)
+        {
+            {
+                std::lock_guard<std::mutex> sharedLocker(s_sharedTimerQueueLock);
+                //a new queue may have been handed out in the meantime
+                if (s_sharedTimerQueue.expired())
+                {
+                    s_sharedTimerQueue.reset();
+                }
+            }
+            Aws::Delete(expiredTimerQueue);
+        }, Aws::Allocator<TimerQueue>());
+        s_sharedTimerQueue = timerQueue;
+    }
+    return timerQueue;
+}
+
+void TimerQueue::TimerLoop(std::shared_ptr<TimerState> state)
+{
+    std::unique_lock<std::mutex> locker(state->stateLock);
+    while (state->continueRunning)
+    {
+        if (state->tasks.empty())
+        {
+            state->tasksChanged.wait(locker);
+            continue;
+        }
+
+        auto next = state->tasks.begin();
+        if (next->first.first > std::chrono::steady_clock::now())
+        {
+            state->tasksChanged.wait_until(locker, next->first.first);
+            continue;
+        }
+
+        std::function<void()> task = std::move(next->second);
+        state->runningTimerId = next->first.second;
+        state->dueTimes.erase(next->first.second);
+        state->tasks.erase(next);
+
+        locker.unlock();
+        task();
+        //whatever the task holds on to goes before anybody waiting in Cancel() is let go
+        task = nullptr;
+        locker.lock();
+
+        state->runningTimerId = 0;
+        state->taskDone.notify_all();
+    }
+}
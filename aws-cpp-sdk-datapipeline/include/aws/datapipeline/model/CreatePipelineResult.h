@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of CreatePipeline.</p>
    */
-  class AWS_DATAPIPELINE_API CreatePipelineResult
+  class AWS_DATAPIPELINE_API CreatePipelineResult : public AmazonWebServiceResultBase
   {
   public:
     CreatePipelineResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/datapipeline/model/PipelineObject.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the output of DescribeObjects.</p>
    */
-  class AWS_DATAPIPELINE_API DescribeObjectsResult
+  class AWS_DATAPIPELINE_API DescribeObjectsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeObjectsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of EvaluateExpression.</p>
    */
-  class AWS_DATAPIPELINE_API EvaluateExpressionResult
+  class AWS_DATAPIPELINE_API EvaluateExpressionResult : public AmazonWebServiceResultBase
   {
   public:
     EvaluateExpressionResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/datapipeline/model/PipelineObject.h>
 #include <aws/datapipeline/model/ParameterObject.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Contains the output of GetPipelineDefinition.</p>
    */
-  class AWS_DATAPIPELINE_API GetPipelineDefinitionResult
+  class AWS_DATAPIPELINE_API GetPipelineDefinitionResult : public AmazonWebServiceResultBase
   {
   public:
     GetPipelineDefinitionResult();
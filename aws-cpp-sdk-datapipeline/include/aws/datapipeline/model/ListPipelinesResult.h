@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/datapipeline/model/PipelineIdName.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the output of ListPipelines.</p>
    */
-  class AWS_DATAPIPELINE_API ListPipelinesResult
+  class AWS_DATAPIPELINE_API ListPipelinesResult : public AmazonWebServiceResultBase
   {
   public:
     ListPipelinesResult();
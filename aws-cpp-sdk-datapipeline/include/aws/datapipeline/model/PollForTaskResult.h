@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/datapipeline/model/TaskObject.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of PollForTask.</p>
    */
-  class AWS_DATAPIPELINE_API PollForTaskResult
+  class AWS_DATAPIPELINE_API PollForTaskResult : public AmazonWebServiceResultBase
   {
   public:
     PollForTaskResult();
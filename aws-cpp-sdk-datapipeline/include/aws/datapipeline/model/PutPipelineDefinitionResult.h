@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/datapipeline/model/ValidationError.h>
 #include <aws/datapipeline/model/ValidationWarning.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the output of PutPipelineDefinition.</p>
    */
-  class AWS_DATAPIPELINE_API PutPipelineDefinitionResult
+  class AWS_DATAPIPELINE_API PutPipelineDefinitionResult : public AmazonWebServiceResultBase
   {
   public:
     PutPipelineDefinitionResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the output of QueryObjects.</p>
    */
-  class AWS_DATAPIPELINE_API QueryObjectsResult
+  class AWS_DATAPIPELINE_API QueryObjectsResult : public AmazonWebServiceResultBase
   {
   public:
     QueryObjectsResult();
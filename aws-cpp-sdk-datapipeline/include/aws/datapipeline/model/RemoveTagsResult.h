@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the output of RemoveTags.</p>
    */
-  class AWS_DATAPIPELINE_API RemoveTagsResult
+  class AWS_DATAPIPELINE_API RemoveTagsResult : public AmazonWebServiceResultBase
   {
   public:
     RemoveTagsResult();
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     ReportTaskProgressRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ReportTaskProgress"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/datapipeline/DataPipeline_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the output of SetTaskStatus.</p>
    */
-  class AWS_DATAPIPELINE_API SetTaskStatusResult
+  class AWS_DATAPIPELINE_API SetTaskStatusResult : public AmazonWebServiceResultBase
   {
   public:
     SetTaskStatusResult();
@@ -35,6 +35,7 @@ ActivatePipelineResult::ActivatePipelineResult(const AmazonWebServiceResult<Json
 
 ActivatePipelineResult& ActivatePipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
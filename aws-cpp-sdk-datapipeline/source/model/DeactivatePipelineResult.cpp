@@ -35,6 +35,7 @@ DeactivatePipelineResult::DeactivatePipelineResult(const AmazonWebServiceResult<
 
 DeactivatePipelineResult& DeactivatePipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -37,6 +37,7 @@ DescribeObjectsResult::DescribeObjectsResult(const AmazonWebServiceResult<JsonVa
 
 DescribeObjectsResult& DescribeObjectsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipelineObjects"))
   {
@@ -35,6 +35,7 @@ DescribePipelinesResult::DescribePipelinesResult(const AmazonWebServiceResult<Js
 
 DescribePipelinesResult& DescribePipelinesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipelineDescriptionList"))
   {
@@ -35,6 +35,7 @@ EvaluateExpressionResult::EvaluateExpressionResult(const AmazonWebServiceResult<
 
 EvaluateExpressionResult& EvaluateExpressionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("evaluatedExpression"))
   {
@@ -35,6 +35,7 @@ GetPipelineDefinitionResult::GetPipelineDefinitionResult(const AmazonWebServiceR
 
 GetPipelineDefinitionResult& GetPipelineDefinitionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipelineObjects"))
   {
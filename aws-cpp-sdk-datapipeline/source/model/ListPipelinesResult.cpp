@@ -37,6 +37,7 @@ ListPipelinesResult::ListPipelinesResult(const AmazonWebServiceResult<JsonValue>
 
 ListPipelinesResult& ListPipelinesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("pipelineIdList"))
   {
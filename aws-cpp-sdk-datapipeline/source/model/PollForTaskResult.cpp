@@ -35,6 +35,7 @@ PollForTaskResult::PollForTaskResult(const AmazonWebServiceResult<JsonValue>& re
 
 PollForTaskResult& PollForTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskObject"))
   {
@@ -37,6 +37,7 @@ PutPipelineDefinitionResult::PutPipelineDefinitionResult(const AmazonWebServiceR
 
 PutPipelineDefinitionResult& PutPipelineDefinitionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("validationErrors"))
   {
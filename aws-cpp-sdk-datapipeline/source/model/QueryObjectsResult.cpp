@@ -37,6 +37,7 @@ QueryObjectsResult::QueryObjectsResult(const AmazonWebServiceResult<JsonValue>&
 
 QueryObjectsResult& QueryObjectsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ids"))
   {
@@ -37,6 +37,7 @@ ReportTaskProgressResult::ReportTaskProgressResult(const AmazonWebServiceResult<
 
 ReportTaskProgressResult& ReportTaskProgressResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("canceled"))
   {
@@ -37,6 +37,7 @@ ReportTaskRunnerHeartbeatResult::ReportTaskRunnerHeartbeatResult(const AmazonWeb
 
 ReportTaskRunnerHeartbeatResult& ReportTaskRunnerHeartbeatResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("terminate"))
   {
@@ -35,6 +35,7 @@ SetTaskStatusResult::SetTaskStatusResult(const AmazonWebServiceResult<JsonValue>
 
 SetTaskStatusResult& SetTaskStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
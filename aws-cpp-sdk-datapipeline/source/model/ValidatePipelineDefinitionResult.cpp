@@ -37,6 +37,7 @@ ValidatePipelineDefinitionResult::ValidatePipelineDefinitionResult(const AmazonW
 
 ValidatePipelineDefinitionResult& ValidatePipelineDefinitionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("validationErrors"))
   {
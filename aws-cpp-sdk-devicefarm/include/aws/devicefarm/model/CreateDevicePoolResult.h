@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/DevicePool.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the result of a create device pool request.</p>
    */
-  class AWS_DEVICEFARM_API CreateDevicePoolResult
+  class AWS_DEVICEFARM_API CreateDevicePoolResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDevicePoolResult();
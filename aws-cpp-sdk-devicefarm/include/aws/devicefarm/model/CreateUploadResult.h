@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/Upload.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the result of a create upload request.</p>
    */
-  class AWS_DEVICEFARM_API CreateUploadResult
+  class AWS_DEVICEFARM_API CreateUploadResult : public AmazonWebServiceResultBase
   {
   public:
     CreateUploadResult();
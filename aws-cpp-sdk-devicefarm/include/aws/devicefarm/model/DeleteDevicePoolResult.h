@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Represents the result of a delete device pool request.</p>
    */
-  class AWS_DEVICEFARM_API DeleteDevicePoolResult
+  class AWS_DEVICEFARM_API DeleteDevicePoolResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteDevicePoolResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/AccountSettings.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Represents the account settings return values from the
    * <code>GetAccountSettings</code> request.</p>
    */
-  class AWS_DEVICEFARM_API GetAccountSettingsResult
+  class AWS_DEVICEFARM_API GetAccountSettingsResult : public AmazonWebServiceResultBase
   {
   public:
     GetAccountSettingsResult();
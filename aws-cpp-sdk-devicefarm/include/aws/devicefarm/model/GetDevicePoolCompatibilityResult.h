@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/devicefarm/model/DevicePoolCompatibilityResult.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the result of describe device pool compatibility request.</p>
    */
-  class AWS_DEVICEFARM_API GetDevicePoolCompatibilityResult
+  class AWS_DEVICEFARM_API GetDevicePoolCompatibilityResult : public AmazonWebServiceResultBase
   {
   public:
     GetDevicePoolCompatibilityResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/devicefarm/model/OfferingStatus.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Returns the status result for a device offering.</p>
    */
-  class AWS_DEVICEFARM_API GetOfferingStatusResult
+  class AWS_DEVICEFARM_API GetOfferingStatusResult : public AmazonWebServiceResultBase
   {
   public:
     GetOfferingStatusResult();
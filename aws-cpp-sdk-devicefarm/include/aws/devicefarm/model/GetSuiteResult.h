@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/Suite.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the result of a get suite request.</p>
    */
-  class AWS_DEVICEFARM_API GetSuiteResult
+  class AWS_DEVICEFARM_API GetSuiteResult : public AmazonWebServiceResultBase
   {
   public:
     GetSuiteResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/Upload.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the result of a get upload request.</p>
    */
-  class AWS_DEVICEFARM_API GetUploadResult
+  class AWS_DEVICEFARM_API GetUploadResult : public AmazonWebServiceResultBase
   {
   public:
     GetUploadResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/devicefarm/model/Device.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the result of a list devices operation.</p>
    */
-  class AWS_DEVICEFARM_API ListDevicesResult
+  class AWS_DEVICEFARM_API ListDevicesResult : public AmazonWebServiceResultBase
   {
   public:
     ListDevicesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/devicefarm/model/OfferingTransaction.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Returns the transaction log of the specified offerings.</p>
    */
-  class AWS_DEVICEFARM_API ListOfferingTransactionsResult
+  class AWS_DEVICEFARM_API ListOfferingTransactionsResult : public AmazonWebServiceResultBase
   {
   public:
     ListOfferingTransactionsResult();
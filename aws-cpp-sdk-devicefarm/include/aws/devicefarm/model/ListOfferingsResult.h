@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/devicefarm/model/Offering.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the return values of the list of offerings.</p>
    */
-  class AWS_DEVICEFARM_API ListOfferingsResult
+  class AWS_DEVICEFARM_API ListOfferingsResult : public AmazonWebServiceResultBase
   {
   public:
     ListOfferingsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/devicefarm/model/Test.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the result of a list tests request.</p>
    */
-  class AWS_DEVICEFARM_API ListTestsResult
+  class AWS_DEVICEFARM_API ListTestsResult : public AmazonWebServiceResultBase
   {
   public:
     ListTestsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/devicefarm/model/ExecutionResult.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>Represents the result of a list unique problems request.</p>
    */
-  class AWS_DEVICEFARM_API ListUniqueProblemsResult
+  class AWS_DEVICEFARM_API ListUniqueProblemsResult : public AmazonWebServiceResultBase
   {
   public:
     ListUniqueProblemsResult();
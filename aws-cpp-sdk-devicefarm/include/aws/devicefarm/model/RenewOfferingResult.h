@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/OfferingTransaction.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The result of a renewal offering.</p>
    */
-  class AWS_DEVICEFARM_API RenewOfferingResult
+  class AWS_DEVICEFARM_API RenewOfferingResult : public AmazonWebServiceResultBase
   {
   public:
     RenewOfferingResult();
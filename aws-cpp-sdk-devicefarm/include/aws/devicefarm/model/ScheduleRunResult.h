@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/Run.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the result of a schedule run request.</p>
    */
-  class AWS_DEVICEFARM_API ScheduleRunResult
+  class AWS_DEVICEFARM_API ScheduleRunResult : public AmazonWebServiceResultBase
   {
   public:
     ScheduleRunResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/Run.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the results of your stop run attempt.</p>
    */
-  class AWS_DEVICEFARM_API StopRunResult
+  class AWS_DEVICEFARM_API StopRunResult : public AmazonWebServiceResultBase
   {
   public:
     StopRunResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/devicefarm/DeviceFarm_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/devicefarm/model/Project.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the result of an update project request.</p>
    */
-  class AWS_DEVICEFARM_API UpdateProjectResult
+  class AWS_DEVICEFARM_API UpdateProjectResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateProjectResult();
@@ -35,6 +35,7 @@ CreateDevicePoolResult::CreateDevicePoolResult(const AmazonWebServiceResult<Json
 
 CreateDevicePoolResult& CreateDevicePoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("devicePool"))
   {
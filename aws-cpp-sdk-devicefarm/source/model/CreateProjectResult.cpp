@@ -35,6 +35,7 @@ CreateProjectResult::CreateProjectResult(const AmazonWebServiceResult<JsonValue>
 
 CreateProjectResult& CreateProjectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("project"))
   {
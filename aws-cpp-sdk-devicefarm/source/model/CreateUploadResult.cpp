@@ -35,6 +35,7 @@ CreateUploadResult::CreateUploadResult(const AmazonWebServiceResult<JsonValue>&
 
 CreateUploadResult& CreateUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("upload"))
   {
@@ -35,6 +35,7 @@ DeleteDevicePoolResult::DeleteDevicePoolResult(const AmazonWebServiceResult<Json
 
 DeleteDevicePoolResult& DeleteDevicePoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DeleteProjectResult::DeleteProjectResult(const AmazonWebServiceResult<JsonValue>
 
 DeleteProjectResult& DeleteProjectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DeleteUploadResult::DeleteUploadResult(const AmazonWebServiceResult<JsonValue>&
 
 DeleteUploadResult& DeleteUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
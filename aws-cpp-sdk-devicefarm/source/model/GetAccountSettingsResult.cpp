@@ -35,6 +35,7 @@ GetAccountSettingsResult::GetAccountSettingsResult(const AmazonWebServiceResult<
 
 GetAccountSettingsResult& GetAccountSettingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("accountSettings"))
   {
@@ -35,6 +35,7 @@ GetDevicePoolCompatibilityResult::GetDevicePoolCompatibilityResult(const AmazonW
 
 GetDevicePoolCompatibilityResult& GetDevicePoolCompatibilityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("compatibleDevices"))
   {
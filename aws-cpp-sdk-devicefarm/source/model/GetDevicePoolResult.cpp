@@ -35,6 +35,7 @@ GetDevicePoolResult::GetDevicePoolResult(const AmazonWebServiceResult<JsonValue>
 
 GetDevicePoolResult& GetDevicePoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("devicePool"))
   {
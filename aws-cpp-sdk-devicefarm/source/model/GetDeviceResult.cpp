@@ -35,6 +35,7 @@ GetDeviceResult::GetDeviceResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetDeviceResult& GetDeviceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("device"))
   {
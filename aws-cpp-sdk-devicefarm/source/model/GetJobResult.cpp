@@ -35,6 +35,7 @@ GetJobResult::GetJobResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetJobResult& GetJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("job"))
   {
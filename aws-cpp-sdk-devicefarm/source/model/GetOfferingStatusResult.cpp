@@ -35,6 +35,7 @@ GetOfferingStatusResult::GetOfferingStatusResult(const AmazonWebServiceResult<Js
 
 GetOfferingStatusResult& GetOfferingStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("current"))
   {
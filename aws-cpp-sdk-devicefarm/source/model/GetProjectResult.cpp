@@ -35,6 +35,7 @@ GetProjectResult::GetProjectResult(const AmazonWebServiceResult<JsonValue>& resu
 
 GetProjectResult& GetProjectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("project"))
   {
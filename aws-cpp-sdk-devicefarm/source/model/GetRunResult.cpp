@@ -35,6 +35,7 @@ GetRunResult::GetRunResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetRunResult& GetRunResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("run"))
   {
@@ -35,6 +35,7 @@ GetSuiteResult::GetSuiteResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetSuiteResult& GetSuiteResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("suite"))
   {
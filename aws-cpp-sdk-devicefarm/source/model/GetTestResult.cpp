@@ -35,6 +35,7 @@ GetTestResult::GetTestResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetTestResult& GetTestResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("test"))
   {
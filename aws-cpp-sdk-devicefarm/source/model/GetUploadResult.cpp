@@ -35,6 +35,7 @@ GetUploadResult::GetUploadResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetUploadResult& GetUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("upload"))
   {
@@ -35,6 +35,7 @@ ListArtifactsResult::ListArtifactsResult(const AmazonWebServiceResult<JsonValue>
 
 ListArtifactsResult& ListArtifactsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("artifacts"))
   {
@@ -35,6 +35,7 @@ ListDevicePoolsResult::ListDevicePoolsResult(const AmazonWebServiceResult<JsonVa
 
 ListDevicePoolsResult& ListDevicePoolsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("devicePools"))
   {
@@ -35,6 +35,7 @@ ListDevicesResult::ListDevicesResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListDevicesResult& ListDevicesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("devices"))
   {
@@ -35,6 +35,7 @@ ListOfferingTransactionsResult::ListOfferingTransactionsResult(const AmazonWebSe
 
 ListOfferingTransactionsResult& ListOfferingTransactionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("offeringTransactions"))
   {
@@ -35,6 +35,7 @@ ListOfferingsResult::ListOfferingsResult(const AmazonWebServiceResult<JsonValue>
 
 ListOfferingsResult& ListOfferingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("offerings"))
   {
@@ -35,6 +35,7 @@ ListProjectsResult::ListProjectsResult(const AmazonWebServiceResult<JsonValue>&
 
 ListProjectsResult& ListProjectsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("projects"))
   {
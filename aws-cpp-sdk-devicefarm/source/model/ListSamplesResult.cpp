@@ -35,6 +35,7 @@ ListSamplesResult::ListSamplesResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListSamplesResult& ListSamplesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("samples"))
   {
@@ -35,6 +35,7 @@ ListSuitesResult::ListSuitesResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListSuitesResult& ListSuitesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("suites"))
   {
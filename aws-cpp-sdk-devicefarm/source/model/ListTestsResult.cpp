@@ -35,6 +35,7 @@ ListTestsResult::ListTestsResult(const AmazonWebServiceResult<JsonValue>& result
 
 ListTestsResult& ListTestsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("tests"))
   {
@@ -35,6 +35,7 @@ ListUniqueProblemsResult::ListUniqueProblemsResult(const AmazonWebServiceResult<
 
 ListUniqueProblemsResult& ListUniqueProblemsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("uniqueProblems"))
   {
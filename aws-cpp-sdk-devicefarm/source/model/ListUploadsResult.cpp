@@ -35,6 +35,7 @@ ListUploadsResult::ListUploadsResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListUploadsResult& ListUploadsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("uploads"))
   {
@@ -35,6 +35,7 @@ PurchaseOfferingResult::PurchaseOfferingResult(const AmazonWebServiceResult<Json
 
 PurchaseOfferingResult& PurchaseOfferingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("offeringTransaction"))
   {
@@ -35,6 +35,7 @@ RenewOfferingResult::RenewOfferingResult(const AmazonWebServiceResult<JsonValue>
 
 RenewOfferingResult& RenewOfferingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("offeringTransaction"))
   {
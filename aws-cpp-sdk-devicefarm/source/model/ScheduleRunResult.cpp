@@ -35,6 +35,7 @@ ScheduleRunResult::ScheduleRunResult(const AmazonWebServiceResult<JsonValue>& re
 
 ScheduleRunResult& ScheduleRunResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("run"))
   {
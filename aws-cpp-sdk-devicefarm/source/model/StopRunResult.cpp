@@ -35,6 +35,7 @@ StopRunResult::StopRunResult(const AmazonWebServiceResult<JsonValue>& result)
 
 StopRunResult& StopRunResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("run"))
   {
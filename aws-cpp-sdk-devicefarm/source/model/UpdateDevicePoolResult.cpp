@@ -35,6 +35,7 @@ UpdateDevicePoolResult::UpdateDevicePoolResult(const AmazonWebServiceResult<Json
 
 UpdateDevicePoolResult& UpdateDevicePoolResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("devicePool"))
   {
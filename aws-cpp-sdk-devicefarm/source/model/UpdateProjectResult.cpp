@@ -35,6 +35,7 @@ UpdateProjectResult::UpdateProjectResult(const AmazonWebServiceResult<JsonValue>
 
 UpdateProjectResult& UpdateProjectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("project"))
   {
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     AllocatePrivateVirtualInterfaceRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "AllocatePrivateVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
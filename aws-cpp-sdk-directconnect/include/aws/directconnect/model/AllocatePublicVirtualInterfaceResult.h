@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/directconnect/model/VirtualInterfaceState.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p>A virtual interface (VLAN) transmits the traffic between the AWS Direct
    * Connect location and the customer.</p>
    */
-  class AWS_DIRECTCONNECT_API AllocatePublicVirtualInterfaceResult
+  class AWS_DIRECTCONNECT_API AllocatePublicVirtualInterfaceResult : public AmazonWebServiceResultBase
   {
   public:
     AllocatePublicVirtualInterfaceResult();
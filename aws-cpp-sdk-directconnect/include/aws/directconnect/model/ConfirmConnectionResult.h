@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/directconnect/model/ConnectionState.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The response received when ConfirmConnection is called.</p>
    */
-  class AWS_DIRECTCONNECT_API ConfirmConnectionResult
+  class AWS_DIRECTCONNECT_API ConfirmConnectionResult : public AmazonWebServiceResultBase
   {
   public:
     ConfirmConnectionResult();
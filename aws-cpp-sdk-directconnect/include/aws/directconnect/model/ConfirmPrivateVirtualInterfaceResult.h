@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/directconnect/model/VirtualInterfaceState.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The response received when ConfirmPrivateVirtualInterface is called.</p>
    */
-  class AWS_DIRECTCONNECT_API ConfirmPrivateVirtualInterfaceResult
+  class AWS_DIRECTCONNECT_API ConfirmPrivateVirtualInterfaceResult : public AmazonWebServiceResultBase
   {
   public:
     ConfirmPrivateVirtualInterfaceResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/directconnect/model/VirtualInterfaceState.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The response received when ConfirmPublicVirtualInterface is called.</p>
    */
-  class AWS_DIRECTCONNECT_API ConfirmPublicVirtualInterfaceResult
+  class AWS_DIRECTCONNECT_API ConfirmPublicVirtualInterfaceResult : public AmazonWebServiceResultBase
   {
   public:
     ConfirmPublicVirtualInterfaceResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/directconnect/model/InterconnectState.h>
 
@@ -44,7 +45,7 @@ namespace Model
    * numbers, are shared by all of the hosted connections on the interconnect, and
    * the owner of the interconnect determines how these resources are assigned.</p>
    */
-  class AWS_DIRECTCONNECT_API CreateInterconnectResult
+  class AWS_DIRECTCONNECT_API CreateInterconnectResult : public AmazonWebServiceResultBase
   {
   public:
     CreateInterconnectResult();
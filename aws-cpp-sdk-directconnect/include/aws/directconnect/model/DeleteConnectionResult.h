@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/directconnect/model/ConnectionState.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>A connection represents the physical network connection between the AWS
    * Direct Connect location and the customer.</p>
    */
-  class AWS_DIRECTCONNECT_API DeleteConnectionResult
+  class AWS_DIRECTCONNECT_API DeleteConnectionResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteConnectionResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/directconnect/model/InterconnectState.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The response received when DeleteInterconnect is called.</p>
    */
-  class AWS_DIRECTCONNECT_API DeleteInterconnectResult
+  class AWS_DIRECTCONNECT_API DeleteInterconnectResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteInterconnectResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/directconnect/model/Connection.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>A structure containing a list of connections.</p>
    */
-  class AWS_DIRECTCONNECT_API DescribeConnectionsResult
+  class AWS_DIRECTCONNECT_API DescribeConnectionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeConnectionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/directconnect/model/Interconnect.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>A structure containing a list of interconnects.</p>
    */
-  class AWS_DIRECTCONNECT_API DescribeInterconnectsResult
+  class AWS_DIRECTCONNECT_API DescribeInterconnectsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeInterconnectsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/directconnect/DirectConnect_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/directconnect/model/Location.h>
 
@@ -40,7 +41,7 @@ namespace Model
    * Locations include a name and facility code, and must be provided when creating a
    * connection.</p>
    */
-  class AWS_DIRECTCONNECT_API DescribeLocationsResult
+  class AWS_DIRECTCONNECT_API DescribeLocationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeLocationsResult();
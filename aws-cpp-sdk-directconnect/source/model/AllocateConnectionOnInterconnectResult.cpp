@@ -37,6 +37,7 @@ AllocateConnectionOnInterconnectResult::AllocateConnectionOnInterconnectResult(c
 
 AllocateConnectionOnInterconnectResult& AllocateConnectionOnInterconnectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ownerAccount"))
   {
@@ -39,6 +39,7 @@ AllocatePublicVirtualInterfaceResult::AllocatePublicVirtualInterfaceResult(const
 
 AllocatePublicVirtualInterfaceResult& AllocatePublicVirtualInterfaceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ownerAccount"))
   {
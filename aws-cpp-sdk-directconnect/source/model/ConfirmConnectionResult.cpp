@@ -35,6 +35,7 @@ ConfirmConnectionResult::ConfirmConnectionResult(const AmazonWebServiceResult<Js
 
 ConfirmConnectionResult& ConfirmConnectionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("connectionState"))
   {
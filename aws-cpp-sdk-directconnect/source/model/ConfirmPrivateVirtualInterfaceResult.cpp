@@ -35,6 +35,7 @@ ConfirmPrivateVirtualInterfaceResult::ConfirmPrivateVirtualInterfaceResult(const
 
 ConfirmPrivateVirtualInterfaceResult& ConfirmPrivateVirtualInterfaceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("virtualInterfaceState"))
   {
@@ -35,6 +35,7 @@ ConfirmPublicVirtualInterfaceResult::ConfirmPublicVirtualInterfaceResult(const A
 
 ConfirmPublicVirtualInterfaceResult& ConfirmPublicVirtualInterfaceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("virtualInterfaceState"))
   {
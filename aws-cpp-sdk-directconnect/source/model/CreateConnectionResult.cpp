@@ -37,6 +37,7 @@ CreateConnectionResult::CreateConnectionResult(const AmazonWebServiceResult<Json
 
 CreateConnectionResult& CreateConnectionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ownerAccount"))
   {
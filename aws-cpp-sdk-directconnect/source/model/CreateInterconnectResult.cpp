@@ -35,6 +35,7 @@ CreateInterconnectResult::CreateInterconnectResult(const AmazonWebServiceResult<
 
 CreateInterconnectResult& CreateInterconnectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("interconnectId"))
   {
@@ -39,6 +39,7 @@ CreatePrivateVirtualInterfaceResult::CreatePrivateVirtualInterfaceResult(const A
 
 CreatePrivateVirtualInterfaceResult& CreatePrivateVirtualInterfaceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ownerAccount"))
   {
@@ -39,6 +39,7 @@ CreatePublicVirtualInterfaceResult::CreatePublicVirtualInterfaceResult(const Ama
 
 CreatePublicVirtualInterfaceResult& CreatePublicVirtualInterfaceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ownerAccount"))
   {
@@ -37,6 +37,7 @@ DeleteConnectionResult::DeleteConnectionResult(const AmazonWebServiceResult<Json
 
 DeleteConnectionResult& DeleteConnectionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ownerAccount"))
   {
@@ -35,6 +35,7 @@ DeleteInterconnectResult::DeleteInterconnectResult(const AmazonWebServiceResult<
 
 DeleteInterconnectResult& DeleteInterconnectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("interconnectState"))
   {
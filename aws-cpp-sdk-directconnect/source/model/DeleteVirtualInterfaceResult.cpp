@@ -35,6 +35,7 @@ DeleteVirtualInterfaceResult::DeleteVirtualInterfaceResult(const AmazonWebServic
 
 DeleteVirtualInterfaceResult& DeleteVirtualInterfaceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("virtualInterfaceState"))
   {
@@ -35,6 +35,7 @@ DescribeConnectionsOnInterconnectResult::DescribeConnectionsOnInterconnectResult
 
 DescribeConnectionsOnInterconnectResult& DescribeConnectionsOnInterconnectResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("connections"))
   {
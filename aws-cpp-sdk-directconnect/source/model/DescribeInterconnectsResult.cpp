@@ -35,6 +35,7 @@ DescribeInterconnectsResult::DescribeInterconnectsResult(const AmazonWebServiceR
 
 DescribeInterconnectsResult& DescribeInterconnectsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("interconnects"))
   {
@@ -35,6 +35,7 @@ DescribeLocationsResult::DescribeLocationsResult(const AmazonWebServiceResult<Js
 
 DescribeLocationsResult& DescribeLocationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("locations"))
   {
@@ -35,6 +35,7 @@ DescribeVirtualGatewaysResult::DescribeVirtualGatewaysResult(const AmazonWebServ
 
 DescribeVirtualGatewaysResult& DescribeVirtualGatewaysResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("virtualGateways"))
   {
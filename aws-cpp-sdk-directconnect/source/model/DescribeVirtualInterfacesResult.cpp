@@ -35,6 +35,7 @@ DescribeVirtualInterfacesResult::DescribeVirtualInterfacesResult(const AmazonWeb
 
 DescribeVirtualInterfacesResult& DescribeVirtualInterfacesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("virtualInterfaces"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dms/DatabaseMigrationService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/dms/model/AccountQuota.h>
 
@@ -33,7 +34,7 @@ namespace DatabaseMigrationService
 {
 namespace Model
 {
-  class AWS_DATABASEMIGRATIONSERVICE_API DescribeAccountAttributesResult
+  class AWS_DATABASEMIGRATIONSERVICE_API DescribeAccountAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAccountAttributesResult();
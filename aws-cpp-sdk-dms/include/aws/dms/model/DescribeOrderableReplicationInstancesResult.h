@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dms/DatabaseMigrationService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/dms/model/OrderableReplicationInstance.h>
@@ -34,7 +35,7 @@ namespace DatabaseMigrationService
 {
 namespace Model
 {
-  class AWS_DATABASEMIGRATIONSERVICE_API DescribeOrderableReplicationInstancesResult
+  class AWS_DATABASEMIGRATIONSERVICE_API DescribeOrderableReplicationInstancesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeOrderableReplicationInstancesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dms/DatabaseMigrationService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/dms/model/Tag.h>
 
@@ -33,7 +34,7 @@ namespace DatabaseMigrationService
 {
 namespace Model
 {
-  class AWS_DATABASEMIGRATIONSERVICE_API ListTagsForResourceResult
+  class AWS_DATABASEMIGRATIONSERVICE_API ListTagsForResourceResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForResourceResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dms/DatabaseMigrationService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/dms/model/ReplicationSubnetGroup.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace DatabaseMigrationService
 {
 namespace Model
 {
-  class AWS_DATABASEMIGRATIONSERVICE_API ModifyReplicationSubnetGroupResult
+  class AWS_DATABASEMIGRATIONSERVICE_API ModifyReplicationSubnetGroupResult : public AmazonWebServiceResultBase
   {
   public:
     ModifyReplicationSubnetGroupResult();
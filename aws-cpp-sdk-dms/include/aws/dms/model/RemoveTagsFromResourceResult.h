@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dms/DatabaseMigrationService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -31,7 +32,7 @@ namespace DatabaseMigrationService
 {
 namespace Model
 {
-  class AWS_DATABASEMIGRATIONSERVICE_API RemoveTagsFromResourceResult
+  class AWS_DATABASEMIGRATIONSERVICE_API RemoveTagsFromResourceResult : public AmazonWebServiceResultBase
   {
   public:
     RemoveTagsFromResourceResult();
@@ -35,6 +35,7 @@ AddTagsToResourceResult::AddTagsToResourceResult(const AmazonWebServiceResult<Js
 
 AddTagsToResourceResult& AddTagsToResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ CreateEndpointResult::CreateEndpointResult(const AmazonWebServiceResult<JsonValu
 
 CreateEndpointResult& CreateEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Endpoint"))
   {
@@ -35,6 +35,7 @@ CreateReplicationInstanceResult::CreateReplicationInstanceResult(const AmazonWeb
 
 CreateReplicationInstanceResult& CreateReplicationInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationInstance"))
   {
@@ -35,6 +35,7 @@ CreateReplicationSubnetGroupResult::CreateReplicationSubnetGroupResult(const Ama
 
 CreateReplicationSubnetGroupResult& CreateReplicationSubnetGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationSubnetGroup"))
   {
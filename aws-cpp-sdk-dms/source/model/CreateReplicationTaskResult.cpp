@@ -35,6 +35,7 @@ CreateReplicationTaskResult::CreateReplicationTaskResult(const AmazonWebServiceR
 
 CreateReplicationTaskResult& CreateReplicationTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationTask"))
   {
@@ -35,6 +35,7 @@ DeleteEndpointResult::DeleteEndpointResult(const AmazonWebServiceResult<JsonValu
 
 DeleteEndpointResult& DeleteEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Endpoint"))
   {
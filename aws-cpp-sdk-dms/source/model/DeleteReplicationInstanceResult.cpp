@@ -35,6 +35,7 @@ DeleteReplicationInstanceResult::DeleteReplicationInstanceResult(const AmazonWeb
 
 DeleteReplicationInstanceResult& DeleteReplicationInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationInstance"))
   {
@@ -35,6 +35,7 @@ DeleteReplicationSubnetGroupResult::DeleteReplicationSubnetGroupResult(const Ama
 
 DeleteReplicationSubnetGroupResult& DeleteReplicationSubnetGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
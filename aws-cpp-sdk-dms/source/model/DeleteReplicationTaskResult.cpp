@@ -35,6 +35,7 @@ DeleteReplicationTaskResult::DeleteReplicationTaskResult(const AmazonWebServiceR
 
 DeleteReplicationTaskResult& DeleteReplicationTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationTask"))
   {
@@ -35,6 +35,7 @@ DescribeAccountAttributesResult::DescribeAccountAttributesResult(const AmazonWeb
 
 DescribeAccountAttributesResult& DescribeAccountAttributesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AccountQuotas"))
   {
@@ -35,6 +35,7 @@ DescribeConnectionsResult::DescribeConnectionsResult(const AmazonWebServiceResul
 
 DescribeConnectionsResult& DescribeConnectionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
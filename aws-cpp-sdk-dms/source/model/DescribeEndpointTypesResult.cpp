@@ -35,6 +35,7 @@ DescribeEndpointTypesResult::DescribeEndpointTypesResult(const AmazonWebServiceR
 
 DescribeEndpointTypesResult& DescribeEndpointTypesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -35,6 +35,7 @@ DescribeEndpointsResult::DescribeEndpointsResult(const AmazonWebServiceResult<Js
 
 DescribeEndpointsResult& DescribeEndpointsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -35,6 +35,7 @@ DescribeOrderableReplicationInstancesResult::DescribeOrderableReplicationInstanc
 
 DescribeOrderableReplicationInstancesResult& DescribeOrderableReplicationInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OrderableReplicationInstances"))
   {
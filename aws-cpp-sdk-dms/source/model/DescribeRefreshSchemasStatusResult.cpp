@@ -35,6 +35,7 @@ DescribeRefreshSchemasStatusResult::DescribeRefreshSchemasStatusResult(const Ama
 
 DescribeRefreshSchemasStatusResult& DescribeRefreshSchemasStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("RefreshSchemasStatus"))
   {
@@ -35,6 +35,7 @@ DescribeReplicationInstancesResult::DescribeReplicationInstancesResult(const Ama
 
 DescribeReplicationInstancesResult& DescribeReplicationInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
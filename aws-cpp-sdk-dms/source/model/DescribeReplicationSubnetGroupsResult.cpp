@@ -35,6 +35,7 @@ DescribeReplicationSubnetGroupsResult::DescribeReplicationSubnetGroupsResult(con
 
 DescribeReplicationSubnetGroupsResult& DescribeReplicationSubnetGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -35,6 +35,7 @@ DescribeReplicationTasksResult::DescribeReplicationTasksResult(const AmazonWebSe
 
 DescribeReplicationTasksResult& DescribeReplicationTasksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -35,6 +35,7 @@ DescribeSchemasResult::DescribeSchemasResult(const AmazonWebServiceResult<JsonVa
 
 DescribeSchemasResult& DescribeSchemasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
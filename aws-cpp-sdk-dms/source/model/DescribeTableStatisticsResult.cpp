@@ -35,6 +35,7 @@ DescribeTableStatisticsResult::DescribeTableStatisticsResult(const AmazonWebServ
 
 DescribeTableStatisticsResult& DescribeTableStatisticsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationTaskArn"))
   {
@@ -35,6 +35,7 @@ ModifyEndpointResult::ModifyEndpointResult(const AmazonWebServiceResult<JsonValu
 
 ModifyEndpointResult& ModifyEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Endpoint"))
   {
@@ -35,6 +35,7 @@ ModifyReplicationInstanceResult::ModifyReplicationInstanceResult(const AmazonWeb
 
 ModifyReplicationInstanceResult& ModifyReplicationInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationInstance"))
   {
@@ -35,6 +35,7 @@ ModifyReplicationSubnetGroupResult::ModifyReplicationSubnetGroupResult(const Ama
 
 ModifyReplicationSubnetGroupResult& ModifyReplicationSubnetGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationSubnetGroup"))
   {
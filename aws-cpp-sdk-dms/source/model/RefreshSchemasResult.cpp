@@ -35,6 +35,7 @@ RefreshSchemasResult::RefreshSchemasResult(const AmazonWebServiceResult<JsonValu
 
 RefreshSchemasResult& RefreshSchemasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("RefreshSchemasStatus"))
   {
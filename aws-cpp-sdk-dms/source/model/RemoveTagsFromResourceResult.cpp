@@ -35,6 +35,7 @@ RemoveTagsFromResourceResult::RemoveTagsFromResourceResult(const AmazonWebServic
 
 RemoveTagsFromResourceResult& RemoveTagsFromResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
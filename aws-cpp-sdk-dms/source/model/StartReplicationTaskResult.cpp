@@ -35,6 +35,7 @@ StartReplicationTaskResult::StartReplicationTaskResult(const AmazonWebServiceRes
 
 StartReplicationTaskResult& StartReplicationTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationTask"))
   {
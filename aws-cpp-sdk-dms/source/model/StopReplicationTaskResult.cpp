@@ -35,6 +35,7 @@ StopReplicationTaskResult::StopReplicationTaskResult(const AmazonWebServiceResul
 
 StopReplicationTaskResult& StopReplicationTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ReplicationTask"))
   {
@@ -35,6 +35,7 @@ TestConnectionResult::TestConnectionResult(const AmazonWebServiceResult<JsonValu
 
 TestConnectionResult& TestConnectionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Connection"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ds/model/Computer.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the results for the <a>CreateComputer</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API CreateComputerResult
+  class AWS_DIRECTORYSERVICE_API CreateComputerResult : public AmazonWebServiceResultBase
   {
   public:
     CreateComputerResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>CreateDirectory</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API CreateDirectoryResult
+  class AWS_DIRECTORYSERVICE_API CreateDirectoryResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDirectoryResult();
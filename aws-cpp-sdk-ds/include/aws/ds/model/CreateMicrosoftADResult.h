@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace DirectoryService
 {
 namespace Model
 {
-  class AWS_DIRECTORYSERVICE_API CreateMicrosoftADResult
+  class AWS_DIRECTORYSERVICE_API CreateMicrosoftADResult : public AmazonWebServiceResultBase
   {
   public:
     CreateMicrosoftADResult();
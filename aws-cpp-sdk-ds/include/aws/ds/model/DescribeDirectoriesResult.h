@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ds/model/DirectoryDescription.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>DescribeDirectories</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API DescribeDirectoriesResult
+  class AWS_DIRECTORYSERVICE_API DescribeDirectoriesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDirectoriesResult();
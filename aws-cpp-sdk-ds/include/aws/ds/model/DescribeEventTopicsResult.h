@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ds/model/EventTopic.h>
 
@@ -33,7 +34,7 @@ namespace DirectoryService
 {
 namespace Model
 {
-  class AWS_DIRECTORYSERVICE_API DescribeEventTopicsResult
+  class AWS_DIRECTORYSERVICE_API DescribeEventTopicsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEventTopicsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ds/model/Trust.h>
@@ -34,7 +35,7 @@ namespace DirectoryService
 {
 namespace Model
 {
-  class AWS_DIRECTORYSERVICE_API DescribeTrustsResult
+  class AWS_DIRECTORYSERVICE_API DescribeTrustsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTrustsResult();
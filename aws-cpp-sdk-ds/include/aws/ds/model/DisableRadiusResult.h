@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>DisableRadius</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API DisableRadiusResult
+  class AWS_DIRECTORYSERVICE_API DisableRadiusResult : public AmazonWebServiceResultBase
   {
   public:
     DisableRadiusResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>EnableRadius</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API EnableRadiusResult
+  class AWS_DIRECTORYSERVICE_API EnableRadiusResult : public AmazonWebServiceResultBase
   {
   public:
     EnableRadiusResult();
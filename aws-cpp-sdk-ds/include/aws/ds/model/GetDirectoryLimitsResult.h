@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ds/model/DirectoryLimits.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>GetDirectoryLimits</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API GetDirectoryLimitsResult
+  class AWS_DIRECTORYSERVICE_API GetDirectoryLimitsResult : public AmazonWebServiceResultBase
   {
   public:
     GetDirectoryLimitsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ds/model/SnapshotLimits.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>GetSnapshotLimits</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API GetSnapshotLimitsResult
+  class AWS_DIRECTORYSERVICE_API GetSnapshotLimitsResult : public AmazonWebServiceResultBase
   {
   public:
     GetSnapshotLimitsResult();
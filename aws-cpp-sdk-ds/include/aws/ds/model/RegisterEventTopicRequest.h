@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     RegisterEventTopicRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "RegisterEventTopic"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -31,7 +32,7 @@ namespace DirectoryService
 {
 namespace Model
 {
-  class AWS_DIRECTORYSERVICE_API RegisterEventTopicResult
+  class AWS_DIRECTORYSERVICE_API RegisterEventTopicResult : public AmazonWebServiceResultBase
   {
   public:
     RegisterEventTopicResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ds/DirectoryService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>UpdateRadius</a> operation.</p>
    */
-  class AWS_DIRECTORYSERVICE_API UpdateRadiusResult
+  class AWS_DIRECTORYSERVICE_API UpdateRadiusResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateRadiusResult();
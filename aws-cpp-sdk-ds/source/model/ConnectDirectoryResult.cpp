@@ -35,6 +35,7 @@ ConnectDirectoryResult::ConnectDirectoryResult(const AmazonWebServiceResult<Json
 
 ConnectDirectoryResult& ConnectDirectoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DirectoryId"))
   {
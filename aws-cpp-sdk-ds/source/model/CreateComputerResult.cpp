@@ -35,6 +35,7 @@ CreateComputerResult::CreateComputerResult(const AmazonWebServiceResult<JsonValu
 
 CreateComputerResult& CreateComputerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Computer"))
   {
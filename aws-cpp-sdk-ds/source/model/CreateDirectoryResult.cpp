@@ -35,6 +35,7 @@ CreateDirectoryResult::CreateDirectoryResult(const AmazonWebServiceResult<JsonVa
 
 CreateDirectoryResult& CreateDirectoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DirectoryId"))
   {
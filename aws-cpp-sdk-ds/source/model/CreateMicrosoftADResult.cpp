@@ -35,6 +35,7 @@ CreateMicrosoftADResult::CreateMicrosoftADResult(const AmazonWebServiceResult<Js
 
 CreateMicrosoftADResult& CreateMicrosoftADResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DirectoryId"))
   {
@@ -35,6 +35,7 @@ CreateSnapshotResult::CreateSnapshotResult(const AmazonWebServiceResult<JsonValu
 
 CreateSnapshotResult& CreateSnapshotResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SnapshotId"))
   {
@@ -35,6 +35,7 @@ CreateTrustResult::CreateTrustResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateTrustResult& CreateTrustResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TrustId"))
   {
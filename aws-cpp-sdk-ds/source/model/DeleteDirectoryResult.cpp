@@ -35,6 +35,7 @@ DeleteDirectoryResult::DeleteDirectoryResult(const AmazonWebServiceResult<JsonVa
 
 DeleteDirectoryResult& DeleteDirectoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DirectoryId"))
   {
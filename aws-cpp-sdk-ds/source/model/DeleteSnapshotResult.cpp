@@ -35,6 +35,7 @@ DeleteSnapshotResult::DeleteSnapshotResult(const AmazonWebServiceResult<JsonValu
 
 DeleteSnapshotResult& DeleteSnapshotResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SnapshotId"))
   {
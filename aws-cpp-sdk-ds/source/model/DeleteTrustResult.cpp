@@ -35,6 +35,7 @@ DeleteTrustResult::DeleteTrustResult(const AmazonWebServiceResult<JsonValue>& re
 
 DeleteTrustResult& DeleteTrustResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TrustId"))
   {
@@ -35,6 +35,7 @@ DeregisterEventTopicResult::DeregisterEventTopicResult(const AmazonWebServiceRes
 
 DeregisterEventTopicResult& DeregisterEventTopicResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
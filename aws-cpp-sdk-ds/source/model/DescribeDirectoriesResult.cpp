@@ -35,6 +35,7 @@ DescribeDirectoriesResult::DescribeDirectoriesResult(const AmazonWebServiceResul
 
 DescribeDirectoriesResult& DescribeDirectoriesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DirectoryDescriptions"))
   {
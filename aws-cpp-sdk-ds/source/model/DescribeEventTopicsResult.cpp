@@ -35,6 +35,7 @@ DescribeEventTopicsResult::DescribeEventTopicsResult(const AmazonWebServiceResul
 
 DescribeEventTopicsResult& DescribeEventTopicsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EventTopics"))
   {
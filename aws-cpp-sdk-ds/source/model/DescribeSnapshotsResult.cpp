@@ -35,6 +35,7 @@ DescribeSnapshotsResult::DescribeSnapshotsResult(const AmazonWebServiceResult<Js
 
 DescribeSnapshotsResult& DescribeSnapshotsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Snapshots"))
   {
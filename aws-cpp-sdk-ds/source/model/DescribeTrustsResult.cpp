@@ -35,6 +35,7 @@ DescribeTrustsResult::DescribeTrustsResult(const AmazonWebServiceResult<JsonValu
 
 DescribeTrustsResult& DescribeTrustsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Trusts"))
   {
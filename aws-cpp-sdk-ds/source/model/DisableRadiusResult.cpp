@@ -35,6 +35,7 @@ DisableRadiusResult::DisableRadiusResult(const AmazonWebServiceResult<JsonValue>
 
 DisableRadiusResult& DisableRadiusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
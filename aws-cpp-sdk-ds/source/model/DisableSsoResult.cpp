@@ -35,6 +35,7 @@ DisableSsoResult::DisableSsoResult(const AmazonWebServiceResult<JsonValue>& resu
 
 DisableSsoResult& DisableSsoResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ EnableRadiusResult::EnableRadiusResult(const AmazonWebServiceResult<JsonValue>&
 
 EnableRadiusResult& EnableRadiusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ EnableSsoResult::EnableSsoResult(const AmazonWebServiceResult<JsonValue>& result
 
 EnableSsoResult& EnableSsoResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
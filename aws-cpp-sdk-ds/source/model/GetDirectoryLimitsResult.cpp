@@ -35,6 +35,7 @@ GetDirectoryLimitsResult::GetDirectoryLimitsResult(const AmazonWebServiceResult<
 
 GetDirectoryLimitsResult& GetDirectoryLimitsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DirectoryLimits"))
   {
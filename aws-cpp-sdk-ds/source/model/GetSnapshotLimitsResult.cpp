@@ -35,6 +35,7 @@ GetSnapshotLimitsResult::GetSnapshotLimitsResult(const AmazonWebServiceResult<Js
 
 GetSnapshotLimitsResult& GetSnapshotLimitsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SnapshotLimits"))
   {
@@ -35,6 +35,7 @@ RegisterEventTopicResult::RegisterEventTopicResult(const AmazonWebServiceResult<
 
 RegisterEventTopicResult& RegisterEventTopicResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ RestoreFromSnapshotResult::RestoreFromSnapshotResult(const AmazonWebServiceResul
 
 RestoreFromSnapshotResult& RestoreFromSnapshotResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
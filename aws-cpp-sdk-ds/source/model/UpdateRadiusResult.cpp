@@ -35,6 +35,7 @@ UpdateRadiusResult::UpdateRadiusResult(const AmazonWebServiceResult<JsonValue>&
 
 UpdateRadiusResult& UpdateRadiusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ VerifyTrustResult::VerifyTrustResult(const AmazonWebServiceResult<JsonValue>& re
 
 VerifyTrustResult& VerifyTrustResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TrustId"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -40,7 +41,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>BatchGetItem</i> operation.</p>
    */
-  class AWS_DYNAMODB_API BatchGetItemResult
+  class AWS_DYNAMODB_API BatchGetItemResult : public AmazonWebServiceResultBase
   {
   public:
     BatchGetItemResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/dynamodb/model/ItemCollectionMetrics.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>DeleteItem</i> operation.</p>
    */
-  class AWS_DYNAMODB_API DeleteItemResult
+  class AWS_DYNAMODB_API DeleteItemResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteItemResult();
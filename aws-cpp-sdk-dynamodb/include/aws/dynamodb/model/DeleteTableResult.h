@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/dynamodb/model/TableDescription.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>DeleteTable</i> operation.</p>
    */
-  class AWS_DYNAMODB_API DeleteTableResult
+  class AWS_DYNAMODB_API DeleteTableResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteTableResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>DescribeLimits</i> operation.</p>
    */
-  class AWS_DYNAMODB_API DescribeLimitsResult
+  class AWS_DYNAMODB_API DescribeLimitsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeLimitsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>GetItem</i> operation.</p>
    */
-  class AWS_DYNAMODB_API GetItemResult
+  class AWS_DYNAMODB_API GetItemResult : public AmazonWebServiceResultBase
   {
   public:
     GetItemResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>ListTables</i> operation.</p>
    */
-  class AWS_DYNAMODB_API ListTablesResult
+  class AWS_DYNAMODB_API ListTablesResult : public AmazonWebServiceResultBase
   {
   public:
     ListTablesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/dynamodb/model/ConsumedCapacity.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>Scan</i> operation.</p>
    */
-  class AWS_DYNAMODB_API ScanResult
+  class AWS_DYNAMODB_API ScanResult : public AmazonWebServiceResultBase
   {
   public:
     ScanResult();
@@ -35,6 +35,7 @@ BatchGetItemResult::BatchGetItemResult(const AmazonWebServiceResult<JsonValue>&
 
 BatchGetItemResult& BatchGetItemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Responses"))
   {
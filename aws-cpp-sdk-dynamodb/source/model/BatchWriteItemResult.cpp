@@ -35,6 +35,7 @@ BatchWriteItemResult::BatchWriteItemResult(const AmazonWebServiceResult<JsonValu
 
 BatchWriteItemResult& BatchWriteItemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UnprocessedItems"))
   {
@@ -35,6 +35,7 @@ CreateTableResult::CreateTableResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateTableResult& CreateTableResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TableDescription"))
   {
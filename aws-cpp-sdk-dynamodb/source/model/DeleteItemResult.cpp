@@ -35,6 +35,7 @@ DeleteItemResult::DeleteItemResult(const AmazonWebServiceResult<JsonValue>& resu
 
 DeleteItemResult& DeleteItemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Attributes"))
   {
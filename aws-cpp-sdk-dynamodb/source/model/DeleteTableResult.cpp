@@ -35,6 +35,7 @@ DeleteTableResult::DeleteTableResult(const AmazonWebServiceResult<JsonValue>& re
 
 DeleteTableResult& DeleteTableResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TableDescription"))
   {
@@ -43,6 +43,7 @@ DescribeLimitsResult::DescribeLimitsResult(const AmazonWebServiceResult<JsonValu
 
 DescribeLimitsResult& DescribeLimitsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AccountMaxReadCapacityUnits"))
   {
@@ -35,6 +35,7 @@ DescribeTableResult::DescribeTableResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeTableResult& DescribeTableResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Table"))
   {
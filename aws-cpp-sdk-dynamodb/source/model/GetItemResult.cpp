@@ -35,6 +35,7 @@ GetItemResult::GetItemResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetItemResult& GetItemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Item"))
   {
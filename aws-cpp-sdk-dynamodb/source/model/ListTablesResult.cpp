@@ -35,6 +35,7 @@ ListTablesResult::ListTablesResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListTablesResult& ListTablesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TableNames"))
   {
@@ -35,6 +35,7 @@ PutItemResult::PutItemResult(const AmazonWebServiceResult<JsonValue>& result)
 
 PutItemResult& PutItemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Attributes"))
   {
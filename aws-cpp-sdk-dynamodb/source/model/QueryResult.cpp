@@ -39,6 +39,7 @@ QueryResult::QueryResult(const AmazonWebServiceResult<JsonValue>& result) :
 
 QueryResult& QueryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Items"))
   {
@@ -39,6 +39,7 @@ ScanResult::ScanResult(const AmazonWebServiceResult<JsonValue>& result) :
 
 ScanResult& ScanResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Items"))
   {
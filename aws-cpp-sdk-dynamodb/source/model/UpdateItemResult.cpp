@@ -35,6 +35,7 @@ UpdateItemResult::UpdateItemResult(const AmazonWebServiceResult<JsonValue>& resu
 
 UpdateItemResult& UpdateItemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Attributes"))
   {
@@ -35,6 +35,7 @@ UpdateTableResult::UpdateTableResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateTableResult& UpdateTableResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TableDescription"))
   {
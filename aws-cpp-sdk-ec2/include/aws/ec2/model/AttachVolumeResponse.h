@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ec2/model/VolumeAttachmentState.h>
 #include <aws/ec2/model/ResponseMetadata.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Describes volume attachment details.</p>
    */
-  class AWS_EC2_API AttachVolumeResponse
+  class AWS_EC2_API AttachVolumeResponse : public AmazonWebServiceResultBase
   {
   public:
     AttachVolumeResponse();
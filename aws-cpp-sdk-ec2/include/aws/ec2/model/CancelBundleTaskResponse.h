@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ec2/model/BundleTask.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace EC2
 {
 namespace Model
 {
-  class AWS_EC2_API CancelBundleTaskResponse
+  class AWS_EC2_API CancelBundleTaskResponse : public AmazonWebServiceResultBase
   {
   public:
     CancelBundleTaskResponse();
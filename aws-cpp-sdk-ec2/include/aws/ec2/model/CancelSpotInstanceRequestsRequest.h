@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     CancelSpotInstanceRequestsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CancelSpotInstanceRequests"; }
+
     Aws::String SerializePayload() const override;
 
     /**
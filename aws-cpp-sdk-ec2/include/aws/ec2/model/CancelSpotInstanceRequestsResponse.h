@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 #include <aws/ec2/model/CancelledSpotInstanceRequest.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the output of CancelSpotInstanceRequests.</p>
    */
-  class AWS_EC2_API CancelSpotInstanceRequestsResponse
+  class AWS_EC2_API CancelSpotInstanceRequestsResponse : public AmazonWebServiceResultBase
   {
   public:
     CancelSpotInstanceRequestsResponse();
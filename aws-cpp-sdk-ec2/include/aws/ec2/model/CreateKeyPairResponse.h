@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Describes a key pair.</p>
    */
-  class AWS_EC2_API CreateKeyPairResponse
+  class AWS_EC2_API CreateKeyPairResponse : public AmazonWebServiceResultBase
   {
   public:
     CreateKeyPairResponse();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     CreateSecurityGroupRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ec2/model/SpotDatafeedSubscription.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the output of CreateSpotDatafeedSubscription.</p>
    */
-  class AWS_EC2_API CreateSpotDatafeedSubscriptionResponse
+  class AWS_EC2_API CreateSpotDatafeedSubscriptionResponse : public AmazonWebServiceResultBase
   {
   public:
     CreateSpotDatafeedSubscriptionResponse();
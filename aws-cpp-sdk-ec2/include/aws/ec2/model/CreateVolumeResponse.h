@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ec2/model/VolumeState.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -41,7 +42,7 @@ namespace Model
   /**
    * <p>Describes a volume.</p>
    */
-  class AWS_EC2_API CreateVolumeResponse
+  class AWS_EC2_API CreateVolumeResponse : public AmazonWebServiceResultBase
   {
   public:
     CreateVolumeResponse();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteNetworkAclEntryRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteNetworkAclEntry"; }
+
     Aws::String SerializePayload() const override;
 
     /**
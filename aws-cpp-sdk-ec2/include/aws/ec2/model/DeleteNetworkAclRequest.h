@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteNetworkAclRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteNetworkAcl"; }
+
     Aws::String SerializePayload() const override;
 
     /**
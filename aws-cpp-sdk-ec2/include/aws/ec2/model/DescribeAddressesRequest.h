@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeAddressesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeAddresses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 #include <aws/ec2/model/CustomerGateway.h>
@@ -34,7 +35,7 @@ namespace EC2
 {
 namespace Model
 {
-  class AWS_EC2_API DescribeCustomerGatewaysResponse
+  class AWS_EC2_API DescribeCustomerGatewaysResponse : public AmazonWebServiceResultBase
   {
   public:
     DescribeCustomerGatewaysResponse();
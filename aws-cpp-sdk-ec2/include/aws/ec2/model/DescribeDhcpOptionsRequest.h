@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeDhcpOptionsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeDhcpOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ec2/model/AttributeValue.h>
@@ -41,7 +42,7 @@ namespace Model
   /**
    * <p>Describes an image attribute.</p>
    */
-  class AWS_EC2_API DescribeImageAttributeResponse
+  class AWS_EC2_API DescribeImageAttributeResponse : public AmazonWebServiceResultBase
   {
   public:
     DescribeImageAttributeResponse();
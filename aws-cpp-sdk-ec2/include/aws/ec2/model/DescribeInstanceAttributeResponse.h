@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ec2/model/AttributeValue.h>
 #include <aws/ec2/model/AttributeBooleanValue.h>
@@ -42,7 +43,7 @@ namespace Model
   /**
    * <p>Describes an instance attribute.</p>
    */
-  class AWS_EC2_API DescribeInstanceAttributeResponse
+  class AWS_EC2_API DescribeInstanceAttributeResponse : public AmazonWebServiceResultBase
   {
   public:
     DescribeInstanceAttributeResponse();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ec2/model/AttributeValue.h>
 #include <aws/ec2/model/AttributeBooleanValue.h>
@@ -38,7 +39,7 @@ namespace EC2
 {
 namespace Model
 {
-  class AWS_EC2_API DescribeNetworkInterfaceAttributeResponse
+  class AWS_EC2_API DescribeNetworkInterfaceAttributeResponse : public AmazonWebServiceResultBase
   {
   public:
     DescribeNetworkInterfaceAttributeResponse();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeRegionsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeRegions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     DescribeReservedInstancesOfferingsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedInstancesOfferings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
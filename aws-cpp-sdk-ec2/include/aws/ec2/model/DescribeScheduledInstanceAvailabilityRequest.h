@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     DescribeScheduledInstanceAvailabilityRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeScheduledInstanceAvailability"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ec2/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Contains the output of DescribeScheduledInstances.</p>
    */
-  class AWS_EC2_API DescribeScheduledInstancesResponse
+  class AWS_EC2_API DescribeScheduledInstancesResponse : public AmazonWebServiceResultBase
   {
   public:
     DescribeScheduledInstancesResponse();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ec2/model/ResponseMetadata.h>
@@ -36,7 +37,7 @@ namespace EC2
 {
 namespace Model
 {
-  class AWS_EC2_API DescribeSnapshotAttributeResponse
+  class AWS_EC2_API DescribeSnapshotAttributeResponse : public AmazonWebServiceResultBase
   {
   public:
     DescribeSnapshotAttributeResponse();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DescribeSpotDatafeedSubscriptionRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotDatafeedSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeSpotFleetRequestHistoryRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotFleetRequestHistory"; }
+
     Aws::String SerializePayload() const override;
 
     /**
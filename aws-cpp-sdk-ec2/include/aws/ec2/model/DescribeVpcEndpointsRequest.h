@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeVpcEndpointsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcEndpoints"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DetachInternetGatewayRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DetachInternetGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     ImportInstanceRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ImportInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
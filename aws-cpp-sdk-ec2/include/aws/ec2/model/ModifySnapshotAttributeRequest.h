@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     ModifySnapshotAttributeRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ModifySnapshotAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of ModifySpotFleetRequest.</p>
    */
-  class AWS_EC2_API ModifySpotFleetRequestResponse
+  class AWS_EC2_API ModifySpotFleetRequestResponse : public AmazonWebServiceResultBase
   {
   public:
     ModifySpotFleetRequestResponse();
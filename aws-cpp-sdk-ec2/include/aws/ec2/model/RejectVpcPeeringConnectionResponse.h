@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ec2/model/ResponseMetadata.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace EC2
 {
 namespace Model
 {
-  class AWS_EC2_API RejectVpcPeeringConnectionResponse
+  class AWS_EC2_API RejectVpcPeeringConnectionResponse : public AmazonWebServiceResultBase
   {
   public:
     RejectVpcPeeringConnectionResponse();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     ReplaceNetworkAclAssociationRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ReplaceNetworkAclAssociation"; }
+
     Aws::String SerializePayload() const override;
 
     /**
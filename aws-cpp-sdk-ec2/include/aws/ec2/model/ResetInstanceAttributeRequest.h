@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     ResetInstanceAttributeRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ResetInstanceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -38,6 +38,10 @@ namespace Model
   {
   public:
     RunInstancesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "RunInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ec2/EC2_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ec2/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>Describes a reservation.</p>
    */
-  class AWS_EC2_API RunInstancesResponse
+  class AWS_EC2_API RunInstancesResponse : public AmazonWebServiceResultBase
   {
   public:
     RunInstancesResponse();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     RunScheduledInstancesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "RunScheduledInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
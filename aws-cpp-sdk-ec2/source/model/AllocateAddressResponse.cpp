@@ -37,6 +37,7 @@ AllocateAddressResponse::AllocateAddressResponse(const AmazonWebServiceResult<Xm
 
 AllocateAddressResponse& AllocateAddressResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
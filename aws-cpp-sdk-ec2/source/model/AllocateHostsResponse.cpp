@@ -37,6 +37,7 @@ AllocateHostsResponse::AllocateHostsResponse(const AmazonWebServiceResult<XmlDoc
 
 AllocateHostsResponse& AllocateHostsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ AssociateAddressResponse::AssociateAddressResponse(const AmazonWebServiceResult<
 
 AssociateAddressResponse& AssociateAddressResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ AttachClassicLinkVpcResponse::AttachClassicLinkVpcResponse(const AmazonWebServic
 
 AttachClassicLinkVpcResponse& AttachClassicLinkVpcResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ AttachNetworkInterfaceResponse::AttachNetworkInterfaceResponse(const AmazonWebSe
 
 AttachNetworkInterfaceResponse& AttachNetworkInterfaceResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -41,6 +41,7 @@ AttachVolumeResponse::AttachVolumeResponse(const AmazonWebServiceResult<XmlDocum
 
 AttachVolumeResponse& AttachVolumeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
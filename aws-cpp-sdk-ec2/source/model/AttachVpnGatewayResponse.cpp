@@ -37,6 +37,7 @@ AttachVpnGatewayResponse::AttachVpnGatewayResponse(const AmazonWebServiceResult<
 
 AttachVpnGatewayResponse& AttachVpnGatewayResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ BundleInstanceResponse::BundleInstanceResponse(const AmazonWebServiceResult<XmlD
 
 BundleInstanceResponse& BundleInstanceResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CancelBundleTaskResponse::CancelBundleTaskResponse(const AmazonWebServiceResult<
 
 CancelBundleTaskResponse& CancelBundleTaskResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CancelImportTaskResponse::CancelImportTaskResponse(const AmazonWebServiceResult<
 
 CancelImportTaskResponse& CancelImportTaskResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
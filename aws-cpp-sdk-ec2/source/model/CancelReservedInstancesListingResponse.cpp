@@ -37,6 +37,7 @@ CancelReservedInstancesListingResponse::CancelReservedInstancesListingResponse(c
 
 CancelReservedInstancesListingResponse& CancelReservedInstancesListingResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CancelSpotFleetRequestsResponse::CancelSpotFleetRequestsResponse(const AmazonWeb
 
 CancelSpotFleetRequestsResponse& CancelSpotFleetRequestsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CancelSpotInstanceRequestsResponse::CancelSpotInstanceRequestsResponse(const Ama
 
 CancelSpotInstanceRequestsResponse& CancelSpotInstanceRequestsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
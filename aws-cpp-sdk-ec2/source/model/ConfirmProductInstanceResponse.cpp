@@ -39,6 +39,7 @@ ConfirmProductInstanceResponse::ConfirmProductInstanceResponse(const AmazonWebSe
 
 ConfirmProductInstanceResponse& ConfirmProductInstanceResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
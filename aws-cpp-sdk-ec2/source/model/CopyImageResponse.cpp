@@ -37,6 +37,7 @@ CopyImageResponse::CopyImageResponse(const AmazonWebServiceResult<XmlDocument>&
 
 CopyImageResponse& CopyImageResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
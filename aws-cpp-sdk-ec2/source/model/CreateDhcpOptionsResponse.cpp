@@ -37,6 +37,7 @@ CreateDhcpOptionsResponse::CreateDhcpOptionsResponse(const AmazonWebServiceResul
 
 CreateDhcpOptionsResponse& CreateDhcpOptionsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateFlowLogsResponse::CreateFlowLogsResponse(const AmazonWebServiceResult<XmlD
 
 CreateFlowLogsResponse& CreateFlowLogsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateImageResponse::CreateImageResponse(const AmazonWebServiceResult<XmlDocumen
 
 CreateImageResponse& CreateImageResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
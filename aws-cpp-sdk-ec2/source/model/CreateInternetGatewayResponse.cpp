@@ -37,6 +37,7 @@ CreateInternetGatewayResponse::CreateInternetGatewayResponse(const AmazonWebServ
 
 CreateInternetGatewayResponse& CreateInternetGatewayResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateKeyPairResponse::CreateKeyPairResponse(const AmazonWebServiceResult<XmlDoc
 
 CreateKeyPairResponse& CreateKeyPairResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
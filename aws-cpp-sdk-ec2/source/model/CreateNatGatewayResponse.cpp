@@ -37,6 +37,7 @@ CreateNatGatewayResponse::CreateNatGatewayResponse(const AmazonWebServiceResult<
 
 CreateNatGatewayResponse& CreateNatGatewayResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateNetworkInterfaceResponse::CreateNetworkInterfaceResponse(const AmazonWebSe
 
 CreateNetworkInterfaceResponse& CreateNetworkInterfaceResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ CreateRouteResponse::CreateRouteResponse(const AmazonWebServiceResult<XmlDocumen
 
 CreateRouteResponse& CreateRouteResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateRouteTableResponse::CreateRouteTableResponse(const AmazonWebServiceResult<
 
 CreateRouteTableResponse& CreateRouteTableResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
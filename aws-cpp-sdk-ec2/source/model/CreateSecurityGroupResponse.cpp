@@ -37,6 +37,7 @@ CreateSecurityGroupResponse::CreateSecurityGroupResponse(const AmazonWebServiceR
 
 CreateSecurityGroupResponse& CreateSecurityGroupResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
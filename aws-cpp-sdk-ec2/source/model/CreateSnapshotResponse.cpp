@@ -43,6 +43,7 @@ CreateSnapshotResponse::CreateSnapshotResponse(const AmazonWebServiceResult<XmlD
 
 CreateSnapshotResponse& CreateSnapshotResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
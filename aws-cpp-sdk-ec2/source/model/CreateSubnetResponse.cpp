@@ -37,6 +37,7 @@ CreateSubnetResponse::CreateSubnetResponse(const AmazonWebServiceResult<XmlDocum
 
 CreateSubnetResponse& CreateSubnetResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -45,6 +45,7 @@ CreateVolumeResponse::CreateVolumeResponse(const AmazonWebServiceResult<XmlDocum
 
 CreateVolumeResponse& CreateVolumeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateVpcPeeringConnectionResponse::CreateVpcPeeringConnectionResponse(const Ama
 
 CreateVpcPeeringConnectionResponse& CreateVpcPeeringConnectionResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
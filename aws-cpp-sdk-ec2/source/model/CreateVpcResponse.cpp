@@ -37,6 +37,7 @@ CreateVpcResponse::CreateVpcResponse(const AmazonWebServiceResult<XmlDocument>&
 
 CreateVpcResponse& CreateVpcResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateVpnConnectionResponse::CreateVpnConnectionResponse(const AmazonWebServiceR
 
 CreateVpnConnectionResponse& CreateVpnConnectionResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateVpnGatewayResponse::CreateVpnGatewayResponse(const AmazonWebServiceResult<
 
 CreateVpnGatewayResponse& CreateVpnGatewayResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
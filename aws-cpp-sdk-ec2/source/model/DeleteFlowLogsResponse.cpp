@@ -37,6 +37,7 @@ DeleteFlowLogsResponse::DeleteFlowLogsResponse(const AmazonWebServiceResult<XmlD
 
 DeleteFlowLogsResponse& DeleteFlowLogsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
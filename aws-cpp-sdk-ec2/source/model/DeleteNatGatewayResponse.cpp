@@ -37,6 +37,7 @@ DeleteNatGatewayResponse::DeleteNatGatewayResponse(const AmazonWebServiceResult<
 
 DeleteNatGatewayResponse& DeleteNatGatewayResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteVpcEndpointsResponse::DeleteVpcEndpointsResponse(const AmazonWebServiceRes
 
 DeleteVpcEndpointsResponse& DeleteVpcEndpointsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ DeleteVpcPeeringConnectionResponse::DeleteVpcPeeringConnectionResponse(const Ama
 
 DeleteVpcPeeringConnectionResponse& DeleteVpcPeeringConnectionResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeAccountAttributesResponse::DescribeAccountAttributesResponse(const Amazo
 
 DescribeAccountAttributesResponse& DescribeAccountAttributesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
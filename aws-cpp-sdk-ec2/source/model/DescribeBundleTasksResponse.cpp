@@ -37,6 +37,7 @@ DescribeBundleTasksResponse::DescribeBundleTasksResponse(const AmazonWebServiceR
 
 DescribeBundleTasksResponse& DescribeBundleTasksResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeClassicLinkInstancesResponse::DescribeClassicLinkInstancesResponse(const
 
 DescribeClassicLinkInstancesResponse& DescribeClassicLinkInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeExportTasksResponse::DescribeExportTasksResponse(const AmazonWebServiceR
 
 DescribeExportTasksResponse& DescribeExportTasksResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
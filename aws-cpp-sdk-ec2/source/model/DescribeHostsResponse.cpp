@@ -37,6 +37,7 @@ DescribeHostsResponse::DescribeHostsResponse(const AmazonWebServiceResult<XmlDoc
 
 DescribeHostsResponse& DescribeHostsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeIdFormatResponse::DescribeIdFormatResponse(const AmazonWebServiceResult<
 
 DescribeIdFormatResponse& DescribeIdFormatResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeImageAttributeResponse::DescribeImageAttributeResponse(const AmazonWebSe
 
 DescribeImageAttributeResponse& DescribeImageAttributeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeImagesResponse::DescribeImagesResponse(const AmazonWebServiceResult<XmlD
 
 DescribeImagesResponse& DescribeImagesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeImportImageTasksResponse::DescribeImportImageTasksResponse(const AmazonW
 
 DescribeImportImageTasksResponse& DescribeImportImageTasksResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeInstanceAttributeResponse::DescribeInstanceAttributeResponse(const Amazo
 
 DescribeInstanceAttributeResponse& DescribeInstanceAttributeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
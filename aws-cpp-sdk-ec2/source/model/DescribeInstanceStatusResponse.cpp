@@ -37,6 +37,7 @@ DescribeInstanceStatusResponse::DescribeInstanceStatusResponse(const AmazonWebSe
 
 DescribeInstanceStatusResponse& DescribeInstanceStatusResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeInstancesResponse::DescribeInstancesResponse(const AmazonWebServiceResul
 
 DescribeInstancesResponse& DescribeInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeInternetGatewaysResponse::DescribeInternetGatewaysResponse(const AmazonW
 
 DescribeInternetGatewaysResponse& DescribeInternetGatewaysResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeMovingAddressesResponse::DescribeMovingAddressesResponse(const AmazonWeb
 
 DescribeMovingAddressesResponse& DescribeMovingAddressesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
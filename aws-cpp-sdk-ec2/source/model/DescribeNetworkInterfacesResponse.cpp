@@ -37,6 +37,7 @@ DescribeNetworkInterfacesResponse::DescribeNetworkInterfacesResponse(const Amazo
 
 DescribeNetworkInterfacesResponse& DescribeNetworkInterfacesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribePlacementGroupsResponse::DescribePlacementGroupsResponse(const AmazonWeb
 
 DescribePlacementGroupsResponse& DescribePlacementGroupsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeRegionsResponse::DescribeRegionsResponse(const AmazonWebServiceResult<Xm
 
 DescribeRegionsResponse& DescribeRegionsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
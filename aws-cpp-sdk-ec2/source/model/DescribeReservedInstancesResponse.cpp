@@ -37,6 +37,7 @@ DescribeReservedInstancesResponse::DescribeReservedInstancesResponse(const Amazo
 
 DescribeReservedInstancesResponse& DescribeReservedInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
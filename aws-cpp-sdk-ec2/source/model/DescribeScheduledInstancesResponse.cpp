@@ -37,6 +37,7 @@ DescribeScheduledInstancesResponse::DescribeScheduledInstancesResponse(const Ama
 
 DescribeScheduledInstancesResponse& DescribeScheduledInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeSnapshotAttributeResponse::DescribeSnapshotAttributeResponse(const Amazo
 
 DescribeSnapshotAttributeResponse& DescribeSnapshotAttributeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
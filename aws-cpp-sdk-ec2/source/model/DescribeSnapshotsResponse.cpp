@@ -37,6 +37,7 @@ DescribeSnapshotsResponse::DescribeSnapshotsResponse(const AmazonWebServiceResul
 
 DescribeSnapshotsResponse& DescribeSnapshotsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
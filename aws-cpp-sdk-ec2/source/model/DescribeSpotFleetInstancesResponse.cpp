@@ -37,6 +37,7 @@ DescribeSpotFleetInstancesResponse::DescribeSpotFleetInstancesResponse(const Ama
 
 DescribeSpotFleetInstancesResponse& DescribeSpotFleetInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
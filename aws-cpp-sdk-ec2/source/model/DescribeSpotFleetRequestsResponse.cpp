@@ -37,6 +37,7 @@ DescribeSpotFleetRequestsResponse::DescribeSpotFleetRequestsResponse(const Amazo
 
 DescribeSpotFleetRequestsResponse& DescribeSpotFleetRequestsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeSubnetsResponse::DescribeSubnetsResponse(const AmazonWebServiceResult<Xm
 
 DescribeSubnetsResponse& DescribeSubnetsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
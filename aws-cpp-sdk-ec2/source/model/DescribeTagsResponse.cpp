@@ -37,6 +37,7 @@ DescribeTagsResponse::DescribeTagsResponse(const AmazonWebServiceResult<XmlDocum
 
 DescribeTagsResponse& DescribeTagsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeVolumeAttributeResponse::DescribeVolumeAttributeResponse(const AmazonWeb
 
 DescribeVolumeAttributeResponse& DescribeVolumeAttributeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
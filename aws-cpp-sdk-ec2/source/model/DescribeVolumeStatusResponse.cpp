@@ -37,6 +37,7 @@ DescribeVolumeStatusResponse::DescribeVolumeStatusResponse(const AmazonWebServic
 
 DescribeVolumeStatusResponse& DescribeVolumeStatusResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
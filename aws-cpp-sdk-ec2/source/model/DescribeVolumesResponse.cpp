@@ -37,6 +37,7 @@ DescribeVolumesResponse::DescribeVolumesResponse(const AmazonWebServiceResult<Xm
 
 DescribeVolumesResponse& DescribeVolumesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
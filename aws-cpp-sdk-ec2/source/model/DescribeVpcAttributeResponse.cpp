@@ -37,6 +37,7 @@ DescribeVpcAttributeResponse::DescribeVpcAttributeResponse(const AmazonWebServic
 
 DescribeVpcAttributeResponse& DescribeVpcAttributeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeVpcClassicLinkResponse::DescribeVpcClassicLinkResponse(const AmazonWebSe
 
 DescribeVpcClassicLinkResponse& DescribeVpcClassicLinkResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
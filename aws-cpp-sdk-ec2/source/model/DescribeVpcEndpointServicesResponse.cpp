@@ -37,6 +37,7 @@ DescribeVpcEndpointServicesResponse::DescribeVpcEndpointServicesResponse(const A
 
 DescribeVpcEndpointServicesResponse& DescribeVpcEndpointServicesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeVpcsResponse::DescribeVpcsResponse(const AmazonWebServiceResult<XmlDocum
 
 DescribeVpcsResponse& DescribeVpcsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
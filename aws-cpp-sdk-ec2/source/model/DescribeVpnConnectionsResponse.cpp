@@ -37,6 +37,7 @@ DescribeVpnConnectionsResponse::DescribeVpnConnectionsResponse(const AmazonWebSe
 
 DescribeVpnConnectionsResponse& DescribeVpnConnectionsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
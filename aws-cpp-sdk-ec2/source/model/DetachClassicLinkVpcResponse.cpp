@@ -39,6 +39,7 @@ DetachClassicLinkVpcResponse::DetachClassicLinkVpcResponse(const AmazonWebServic
 
 DetachClassicLinkVpcResponse& DetachClassicLinkVpcResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -41,6 +41,7 @@ DetachVolumeResponse::DetachVolumeResponse(const AmazonWebServiceResult<XmlDocum
 
 DetachVolumeResponse& DetachVolumeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
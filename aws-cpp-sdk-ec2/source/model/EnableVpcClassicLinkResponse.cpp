@@ -39,6 +39,7 @@ EnableVpcClassicLinkResponse::EnableVpcClassicLinkResponse(const AmazonWebServic
 
 EnableVpcClassicLinkResponse& EnableVpcClassicLinkResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ GetConsoleOutputResponse::GetConsoleOutputResponse(const AmazonWebServiceResult<
 
 GetConsoleOutputResponse& GetConsoleOutputResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ GetPasswordDataResponse::GetPasswordDataResponse(const AmazonWebServiceResult<Xm
 
 GetPasswordDataResponse& GetPasswordDataResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ImportInstanceResponse::ImportInstanceResponse(const AmazonWebServiceResult<XmlD
 
 ImportInstanceResponse& ImportInstanceResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
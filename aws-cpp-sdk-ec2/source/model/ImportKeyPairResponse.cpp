@@ -37,6 +37,7 @@ ImportKeyPairResponse::ImportKeyPairResponse(const AmazonWebServiceResult<XmlDoc
 
 ImportKeyPairResponse& ImportKeyPairResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
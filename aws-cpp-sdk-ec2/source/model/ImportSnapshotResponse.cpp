@@ -37,6 +37,7 @@ ImportSnapshotResponse::ImportSnapshotResponse(const AmazonWebServiceResult<XmlD
 
 ImportSnapshotResponse& ImportSnapshotResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ImportVolumeResponse::ImportVolumeResponse(const AmazonWebServiceResult<XmlDocum
 
 ImportVolumeResponse& ImportVolumeResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
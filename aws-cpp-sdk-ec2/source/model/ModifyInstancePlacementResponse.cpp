@@ -39,6 +39,7 @@ ModifyInstancePlacementResponse::ModifyInstancePlacementResponse(const AmazonWeb
 
 ModifyInstancePlacementResponse& ModifyInstancePlacementResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
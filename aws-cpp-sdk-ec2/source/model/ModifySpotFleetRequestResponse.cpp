@@ -39,6 +39,7 @@ ModifySpotFleetRequestResponse::ModifySpotFleetRequestResponse(const AmazonWebSe
 
 ModifySpotFleetRequestResponse& ModifySpotFleetRequestResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
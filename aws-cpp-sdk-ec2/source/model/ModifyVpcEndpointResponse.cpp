@@ -39,6 +39,7 @@ ModifyVpcEndpointResponse::ModifyVpcEndpointResponse(const AmazonWebServiceResul
 
 ModifyVpcEndpointResponse& ModifyVpcEndpointResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
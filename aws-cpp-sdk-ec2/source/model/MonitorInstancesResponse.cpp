@@ -37,6 +37,7 @@ MonitorInstancesResponse::MonitorInstancesResponse(const AmazonWebServiceResult<
 
 MonitorInstancesResponse& MonitorInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ MoveAddressToVpcResponse::MoveAddressToVpcResponse(const AmazonWebServiceResult<
 
 MoveAddressToVpcResponse& MoveAddressToVpcResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ PurchaseScheduledInstancesResponse::PurchaseScheduledInstancesResponse(const Ama
 
 PurchaseScheduledInstancesResponse& PurchaseScheduledInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RegisterImageResponse::RegisterImageResponse(const AmazonWebServiceResult<XmlDoc
 
 RegisterImageResponse& RegisterImageResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ RejectVpcPeeringConnectionResponse::RejectVpcPeeringConnectionResponse(const Ama
 
 RejectVpcPeeringConnectionResponse& RejectVpcPeeringConnectionResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ReleaseHostsResponse::ReleaseHostsResponse(const AmazonWebServiceResult<XmlDocum
 
 ReleaseHostsResponse& ReleaseHostsResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
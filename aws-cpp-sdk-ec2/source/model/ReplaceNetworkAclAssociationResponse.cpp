@@ -37,6 +37,7 @@ ReplaceNetworkAclAssociationResponse::ReplaceNetworkAclAssociationResponse(const
 
 ReplaceNetworkAclAssociationResponse& ReplaceNetworkAclAssociationResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
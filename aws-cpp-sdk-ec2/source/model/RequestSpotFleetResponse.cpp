@@ -37,6 +37,7 @@ RequestSpotFleetResponse::RequestSpotFleetResponse(const AmazonWebServiceResult<
 
 RequestSpotFleetResponse& RequestSpotFleetResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RequestSpotInstancesResponse::RequestSpotInstancesResponse(const AmazonWebServic
 
 RequestSpotInstancesResponse& RequestSpotInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RestoreAddressToClassicResponse::RestoreAddressToClassicResponse(const AmazonWeb
 
 RestoreAddressToClassicResponse& RestoreAddressToClassicResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RunInstancesResponse::RunInstancesResponse(const AmazonWebServiceResult<XmlDocum
 
 RunInstancesResponse& RunInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
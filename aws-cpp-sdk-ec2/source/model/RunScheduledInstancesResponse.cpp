@@ -37,6 +37,7 @@ RunScheduledInstancesResponse::RunScheduledInstancesResponse(const AmazonWebServ
 
 RunScheduledInstancesResponse& RunScheduledInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
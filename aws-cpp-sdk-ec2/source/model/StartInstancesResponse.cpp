@@ -37,6 +37,7 @@ StartInstancesResponse::StartInstancesResponse(const AmazonWebServiceResult<XmlD
 
 StartInstancesResponse& StartInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ StopInstancesResponse::StopInstancesResponse(const AmazonWebServiceResult<XmlDoc
 
 StopInstancesResponse& StopInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ UnmonitorInstancesResponse::UnmonitorInstancesResponse(const AmazonWebServiceRes
 
 UnmonitorInstancesResponse& UnmonitorInstancesResponse::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
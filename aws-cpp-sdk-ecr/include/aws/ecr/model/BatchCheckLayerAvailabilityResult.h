@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecr/ECR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ecr/model/Layer.h>
 #include <aws/ecr/model/LayerFailure.h>
@@ -34,7 +35,7 @@ namespace ECR
 {
 namespace Model
 {
-  class AWS_ECR_API BatchCheckLayerAvailabilityResult
+  class AWS_ECR_API BatchCheckLayerAvailabilityResult : public AmazonWebServiceResultBase
   {
   public:
     BatchCheckLayerAvailabilityResult();
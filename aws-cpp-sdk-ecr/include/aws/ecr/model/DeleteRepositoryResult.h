@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecr/ECR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ecr/model/Repository.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ECR
 {
 namespace Model
 {
-  class AWS_ECR_API DeleteRepositoryResult
+  class AWS_ECR_API DeleteRepositoryResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteRepositoryResult();
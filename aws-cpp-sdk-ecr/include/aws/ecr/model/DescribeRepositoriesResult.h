@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecr/ECR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ecr/model/Repository.h>
@@ -34,7 +35,7 @@ namespace ECR
 {
 namespace Model
 {
-  class AWS_ECR_API DescribeRepositoriesResult
+  class AWS_ECR_API DescribeRepositoriesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeRepositoriesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecr/ECR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ecr/model/AuthorizationData.h>
 
@@ -33,7 +34,7 @@ namespace ECR
 {
 namespace Model
 {
-  class AWS_ECR_API GetAuthorizationTokenResult
+  class AWS_ECR_API GetAuthorizationTokenResult : public AmazonWebServiceResultBase
   {
   public:
     GetAuthorizationTokenResult();
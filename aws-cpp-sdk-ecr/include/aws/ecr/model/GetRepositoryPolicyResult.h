@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecr/ECR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ECR
 {
 namespace Model
 {
-  class AWS_ECR_API GetRepositoryPolicyResult
+  class AWS_ECR_API GetRepositoryPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetRepositoryPolicyResult();
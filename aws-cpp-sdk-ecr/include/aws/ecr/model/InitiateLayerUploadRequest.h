@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     InitiateLayerUploadRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "InitiateLayerUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
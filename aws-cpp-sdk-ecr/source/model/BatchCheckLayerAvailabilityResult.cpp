@@ -35,6 +35,7 @@ BatchCheckLayerAvailabilityResult::BatchCheckLayerAvailabilityResult(const Amazo
 
 BatchCheckLayerAvailabilityResult& BatchCheckLayerAvailabilityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("layers"))
   {
@@ -35,6 +35,7 @@ BatchDeleteImageResult::BatchDeleteImageResult(const AmazonWebServiceResult<Json
 
 BatchDeleteImageResult& BatchDeleteImageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("imageIds"))
   {
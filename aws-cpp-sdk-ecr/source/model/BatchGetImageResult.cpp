@@ -35,6 +35,7 @@ BatchGetImageResult::BatchGetImageResult(const AmazonWebServiceResult<JsonValue>
 
 BatchGetImageResult& BatchGetImageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("images"))
   {
@@ -35,6 +35,7 @@ CompleteLayerUploadResult::CompleteLayerUploadResult(const AmazonWebServiceResul
 
 CompleteLayerUploadResult& CompleteLayerUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("registryId"))
   {
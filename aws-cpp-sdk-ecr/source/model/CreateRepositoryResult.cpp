@@ -35,6 +35,7 @@ CreateRepositoryResult::CreateRepositoryResult(const AmazonWebServiceResult<Json
 
 CreateRepositoryResult& CreateRepositoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("repository"))
   {
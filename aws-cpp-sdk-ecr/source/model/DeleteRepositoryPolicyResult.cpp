@@ -35,6 +35,7 @@ DeleteRepositoryPolicyResult::DeleteRepositoryPolicyResult(const AmazonWebServic
 
 DeleteRepositoryPolicyResult& DeleteRepositoryPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("registryId"))
   {
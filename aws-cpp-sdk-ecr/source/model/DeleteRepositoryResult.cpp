@@ -35,6 +35,7 @@ DeleteRepositoryResult::DeleteRepositoryResult(const AmazonWebServiceResult<Json
 
 DeleteRepositoryResult& DeleteRepositoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("repository"))
   {
@@ -35,6 +35,7 @@ DescribeRepositoriesResult::DescribeRepositoriesResult(const AmazonWebServiceRes
 
 DescribeRepositoriesResult& DescribeRepositoriesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("repositories"))
   {
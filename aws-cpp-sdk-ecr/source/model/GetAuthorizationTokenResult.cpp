@@ -35,6 +35,7 @@ GetAuthorizationTokenResult::GetAuthorizationTokenResult(const AmazonWebServiceR
 
 GetAuthorizationTokenResult& GetAuthorizationTokenResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("authorizationData"))
   {
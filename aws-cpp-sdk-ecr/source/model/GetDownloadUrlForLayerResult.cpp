@@ -35,6 +35,7 @@ GetDownloadUrlForLayerResult::GetDownloadUrlForLayerResult(const AmazonWebServic
 
 GetDownloadUrlForLayerResult& GetDownloadUrlForLayerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("downloadUrl"))
   {
@@ -35,6 +35,7 @@ GetRepositoryPolicyResult::GetRepositoryPolicyResult(const AmazonWebServiceResul
 
 GetRepositoryPolicyResult& GetRepositoryPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("registryId"))
   {
@@ -37,6 +37,7 @@ InitiateLayerUploadResult::InitiateLayerUploadResult(const AmazonWebServiceResul
 
 InitiateLayerUploadResult& InitiateLayerUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("uploadId"))
   {
@@ -35,6 +35,7 @@ ListImagesResult::ListImagesResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListImagesResult& ListImagesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("imageIds"))
   {
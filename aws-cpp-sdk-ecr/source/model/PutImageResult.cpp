@@ -35,6 +35,7 @@ PutImageResult::PutImageResult(const AmazonWebServiceResult<JsonValue>& result)
 
 PutImageResult& PutImageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("image"))
   {
@@ -35,6 +35,7 @@ SetRepositoryPolicyResult::SetRepositoryPolicyResult(const AmazonWebServiceResul
 
 SetRepositoryPolicyResult& SetRepositoryPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("registryId"))
   {
@@ -37,6 +37,7 @@ UploadLayerPartResult::UploadLayerPartResult(const AmazonWebServiceResult<JsonVa
 
 UploadLayerPartResult& UploadLayerPartResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("registryId"))
   {
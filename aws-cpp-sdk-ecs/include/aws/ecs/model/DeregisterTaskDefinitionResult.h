@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecs/ECS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ecs/model/TaskDefinition.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ECS
 {
 namespace Model
 {
-  class AWS_ECS_API DeregisterTaskDefinitionResult
+  class AWS_ECS_API DeregisterTaskDefinitionResult : public AmazonWebServiceResultBase
   {
   public:
     DeregisterTaskDefinitionResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecs/ECS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ecs/model/Service.h>
 #include <aws/ecs/model/Failure.h>
@@ -34,7 +35,7 @@ namespace ECS
 {
 namespace Model
 {
-  class AWS_ECS_API DescribeServicesResult
+  class AWS_ECS_API DescribeServicesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeServicesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecs/ECS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ecs/model/Task.h>
 #include <aws/ecs/model/Failure.h>
@@ -34,7 +35,7 @@ namespace ECS
 {
 namespace Model
 {
-  class AWS_ECS_API DescribeTasksResult
+  class AWS_ECS_API DescribeTasksResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTasksResult();
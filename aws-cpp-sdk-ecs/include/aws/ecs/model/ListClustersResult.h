@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecs/ECS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace ECS
 {
 namespace Model
 {
-  class AWS_ECS_API ListClustersResult
+  class AWS_ECS_API ListClustersResult : public AmazonWebServiceResultBase
   {
   public:
     ListClustersResult();
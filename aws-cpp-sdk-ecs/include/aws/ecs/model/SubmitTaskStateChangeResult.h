@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ecs/ECS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ECS
 {
 namespace Model
 {
-  class AWS_ECS_API SubmitTaskStateChangeResult
+  class AWS_ECS_API SubmitTaskStateChangeResult : public AmazonWebServiceResultBase
   {
   public:
     SubmitTaskStateChangeResult();
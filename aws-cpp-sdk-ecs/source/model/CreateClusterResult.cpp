@@ -35,6 +35,7 @@ CreateClusterResult::CreateClusterResult(const AmazonWebServiceResult<JsonValue>
 
 CreateClusterResult& CreateClusterResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("cluster"))
   {
@@ -35,6 +35,7 @@ CreateServiceResult::CreateServiceResult(const AmazonWebServiceResult<JsonValue>
 
 CreateServiceResult& CreateServiceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("service"))
   {
@@ -35,6 +35,7 @@ DeleteClusterResult::DeleteClusterResult(const AmazonWebServiceResult<JsonValue>
 
 DeleteClusterResult& DeleteClusterResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("cluster"))
   {
@@ -35,6 +35,7 @@ DeleteServiceResult::DeleteServiceResult(const AmazonWebServiceResult<JsonValue>
 
 DeleteServiceResult& DeleteServiceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("service"))
   {
@@ -35,6 +35,7 @@ DeregisterContainerInstanceResult::DeregisterContainerInstanceResult(const Amazo
 
 DeregisterContainerInstanceResult& DeregisterContainerInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("containerInstance"))
   {
@@ -35,6 +35,7 @@ DeregisterTaskDefinitionResult::DeregisterTaskDefinitionResult(const AmazonWebSe
 
 DeregisterTaskDefinitionResult& DeregisterTaskDefinitionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskDefinition"))
   {
@@ -35,6 +35,7 @@ DescribeClustersResult::DescribeClustersResult(const AmazonWebServiceResult<Json
 
 DescribeClustersResult& DescribeClustersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("clusters"))
   {
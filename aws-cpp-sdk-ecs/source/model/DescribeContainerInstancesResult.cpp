@@ -35,6 +35,7 @@ DescribeContainerInstancesResult::DescribeContainerInstancesResult(const AmazonW
 
 DescribeContainerInstancesResult& DescribeContainerInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("containerInstances"))
   {
@@ -35,6 +35,7 @@ DescribeServicesResult::DescribeServicesResult(const AmazonWebServiceResult<Json
 
 DescribeServicesResult& DescribeServicesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("services"))
   {
@@ -35,6 +35,7 @@ DescribeTaskDefinitionResult::DescribeTaskDefinitionResult(const AmazonWebServic
 
 DescribeTaskDefinitionResult& DescribeTaskDefinitionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskDefinition"))
   {
@@ -35,6 +35,7 @@ DescribeTasksResult::DescribeTasksResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeTasksResult& DescribeTasksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("tasks"))
   {
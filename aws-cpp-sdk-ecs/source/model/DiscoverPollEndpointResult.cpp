@@ -35,6 +35,7 @@ DiscoverPollEndpointResult::DiscoverPollEndpointResult(const AmazonWebServiceRes
 
 DiscoverPollEndpointResult& DiscoverPollEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("endpoint"))
   {
@@ -35,6 +35,7 @@ ListContainerInstancesResult::ListContainerInstancesResult(const AmazonWebServic
 
 ListContainerInstancesResult& ListContainerInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("containerInstanceArns"))
   {
@@ -35,6 +35,7 @@ ListServicesResult::ListServicesResult(const AmazonWebServiceResult<JsonValue>&
 
 ListServicesResult& ListServicesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("serviceArns"))
   {
@@ -35,6 +35,7 @@ ListTaskDefinitionFamiliesResult::ListTaskDefinitionFamiliesResult(const AmazonW
 
 ListTaskDefinitionFamiliesResult& ListTaskDefinitionFamiliesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("families"))
   {
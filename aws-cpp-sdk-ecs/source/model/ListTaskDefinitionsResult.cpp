@@ -35,6 +35,7 @@ ListTaskDefinitionsResult::ListTaskDefinitionsResult(const AmazonWebServiceResul
 
 ListTaskDefinitionsResult& ListTaskDefinitionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskDefinitionArns"))
   {
@@ -35,6 +35,7 @@ ListTasksResult::ListTasksResult(const AmazonWebServiceResult<JsonValue>& result
 
 ListTasksResult& ListTasksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskArns"))
   {
@@ -35,6 +35,7 @@ RegisterContainerInstanceResult::RegisterContainerInstanceResult(const AmazonWeb
 
 RegisterContainerInstanceResult& RegisterContainerInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("containerInstance"))
   {
@@ -35,6 +35,7 @@ RegisterTaskDefinitionResult::RegisterTaskDefinitionResult(const AmazonWebServic
 
 RegisterTaskDefinitionResult& RegisterTaskDefinitionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskDefinition"))
   {
@@ -35,6 +35,7 @@ RunTaskResult::RunTaskResult(const AmazonWebServiceResult<JsonValue>& result)
 
 RunTaskResult& RunTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("tasks"))
   {
@@ -35,6 +35,7 @@ StartTaskResult::StartTaskResult(const AmazonWebServiceResult<JsonValue>& result
 
 StartTaskResult& StartTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("tasks"))
   {
@@ -35,6 +35,7 @@ StopTaskResult::StopTaskResult(const AmazonWebServiceResult<JsonValue>& result)
 
 StopTaskResult& StopTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("task"))
   {
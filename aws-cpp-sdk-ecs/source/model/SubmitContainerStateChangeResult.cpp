@@ -35,6 +35,7 @@ SubmitContainerStateChangeResult::SubmitContainerStateChangeResult(const AmazonW
 
 SubmitContainerStateChangeResult& SubmitContainerStateChangeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("acknowledgment"))
   {
@@ -35,6 +35,7 @@ SubmitTaskStateChangeResult::SubmitTaskStateChangeResult(const AmazonWebServiceR
 
 SubmitTaskStateChangeResult& SubmitTaskStateChangeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("acknowledgment"))
   {
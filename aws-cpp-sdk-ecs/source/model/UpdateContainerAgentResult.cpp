@@ -35,6 +35,7 @@ UpdateContainerAgentResult::UpdateContainerAgentResult(const AmazonWebServiceRes
 
 UpdateContainerAgentResult& UpdateContainerAgentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("containerInstance"))
   {
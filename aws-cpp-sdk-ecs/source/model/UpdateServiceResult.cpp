@@ -35,6 +35,7 @@ UpdateServiceResult::UpdateServiceResult(const AmazonWebServiceResult<JsonValue>
 
 UpdateServiceResult& UpdateServiceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("service"))
   {
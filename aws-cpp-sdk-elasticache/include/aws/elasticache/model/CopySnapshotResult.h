@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticache/model/Snapshot.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace ElastiCache
 {
 namespace Model
 {
-  class AWS_ELASTICACHE_API CopySnapshotResult
+  class AWS_ELASTICACHE_API CopySnapshotResult : public AmazonWebServiceResultBase
   {
   public:
     CopySnapshotResult();
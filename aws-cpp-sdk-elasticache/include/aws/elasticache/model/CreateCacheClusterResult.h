@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticache/model/CacheCluster.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace ElastiCache
 {
 namespace Model
 {
-  class AWS_ELASTICACHE_API CreateCacheClusterResult
+  class AWS_ELASTICACHE_API CreateCacheClusterResult : public AmazonWebServiceResultBase
   {
   public:
     CreateCacheClusterResult();
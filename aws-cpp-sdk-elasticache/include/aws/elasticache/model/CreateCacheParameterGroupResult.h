@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticache/model/CacheParameterGroup.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace ElastiCache
 {
 namespace Model
 {
-  class AWS_ELASTICACHE_API CreateCacheParameterGroupResult
+  class AWS_ELASTICACHE_API CreateCacheParameterGroupResult : public AmazonWebServiceResultBase
   {
   public:
     CreateCacheParameterGroupResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Represents the output of a <i>DescribeCacheSecurityGroups</i> action.</p>
    */
-  class AWS_ELASTICACHE_API DescribeCacheSecurityGroupsResult
+  class AWS_ELASTICACHE_API DescribeCacheSecurityGroupsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeCacheSecurityGroupsResult();
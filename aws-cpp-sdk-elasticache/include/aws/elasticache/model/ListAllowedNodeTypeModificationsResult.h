@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the allowed node types you can use to modify your cache cluster or
    * replication group.</p>
    */
-  class AWS_ELASTICACHE_API ListAllowedNodeTypeModificationsResult
+  class AWS_ELASTICACHE_API ListAllowedNodeTypeModificationsResult : public AmazonWebServiceResultBase
   {
   public:
     ListAllowedNodeTypeModificationsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
 #include <aws/elasticache/model/Tag.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the output from the <i>AddTagsToResource</i>,
    * <i>ListTagsOnResource</i>, and <i>RemoveTagsFromResource</i> actions.</p>
    */
-  class AWS_ELASTICACHE_API ListTagsForResourceResult
+  class AWS_ELASTICACHE_API ListTagsForResourceResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForResourceResult();
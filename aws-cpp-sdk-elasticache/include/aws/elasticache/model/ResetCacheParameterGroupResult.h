@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticache/ElastiCache_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticache/model/ResponseMetadata.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * <i>ModifyCacheParameterGroup</i> </li> <li> <i>ResetCacheParameterGroup</i>
    * </li> </ul>
    */
-  class AWS_ELASTICACHE_API ResetCacheParameterGroupResult
+  class AWS_ELASTICACHE_API ResetCacheParameterGroupResult : public AmazonWebServiceResultBase
   {
   public:
     ResetCacheParameterGroupResult();
@@ -37,6 +37,7 @@ AddTagsToResourceResult::AddTagsToResourceResult(const AmazonWebServiceResult<Xm
 
 AddTagsToResourceResult& AddTagsToResourceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
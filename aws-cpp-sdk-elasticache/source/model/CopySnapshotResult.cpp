@@ -37,6 +37,7 @@ CopySnapshotResult::CopySnapshotResult(const AmazonWebServiceResult<XmlDocument>
 
 CopySnapshotResult& CopySnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
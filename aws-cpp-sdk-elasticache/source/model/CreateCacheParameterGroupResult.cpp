@@ -37,6 +37,7 @@ CreateCacheParameterGroupResult::CreateCacheParameterGroupResult(const AmazonWeb
 
 CreateCacheParameterGroupResult& CreateCacheParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateCacheSecurityGroupResult::CreateCacheSecurityGroupResult(const AmazonWebSe
 
 CreateCacheSecurityGroupResult& CreateCacheSecurityGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateCacheSubnetGroupResult::CreateCacheSubnetGroupResult(const AmazonWebServic
 
 CreateCacheSubnetGroupResult& CreateCacheSubnetGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
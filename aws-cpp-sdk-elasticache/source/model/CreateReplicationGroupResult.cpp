@@ -37,6 +37,7 @@ CreateReplicationGroupResult::CreateReplicationGroupResult(const AmazonWebServic
 
 CreateReplicationGroupResult& CreateReplicationGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
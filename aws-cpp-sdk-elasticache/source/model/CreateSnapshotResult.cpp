@@ -37,6 +37,7 @@ CreateSnapshotResult::CreateSnapshotResult(const AmazonWebServiceResult<XmlDocum
 
 CreateSnapshotResult& CreateSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
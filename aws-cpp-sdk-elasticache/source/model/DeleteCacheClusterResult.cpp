@@ -37,6 +37,7 @@ DeleteCacheClusterResult::DeleteCacheClusterResult(const AmazonWebServiceResult<
 
 DeleteCacheClusterResult& DeleteCacheClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteReplicationGroupResult::DeleteReplicationGroupResult(const AmazonWebServic
 
 DeleteReplicationGroupResult& DeleteReplicationGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
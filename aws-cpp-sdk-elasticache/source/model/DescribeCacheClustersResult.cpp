@@ -37,6 +37,7 @@ DescribeCacheClustersResult::DescribeCacheClustersResult(const AmazonWebServiceR
 
 DescribeCacheClustersResult& DescribeCacheClustersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeCacheEngineVersionsResult::DescribeCacheEngineVersionsResult(const Amazo
 
 DescribeCacheEngineVersionsResult& DescribeCacheEngineVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
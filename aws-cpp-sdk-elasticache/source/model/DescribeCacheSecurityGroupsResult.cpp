@@ -37,6 +37,7 @@ DescribeCacheSecurityGroupsResult::DescribeCacheSecurityGroupsResult(const Amazo
 
 DescribeCacheSecurityGroupsResult& DescribeCacheSecurityGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
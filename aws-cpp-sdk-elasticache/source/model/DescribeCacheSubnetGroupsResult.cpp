@@ -37,6 +37,7 @@ DescribeCacheSubnetGroupsResult::DescribeCacheSubnetGroupsResult(const AmazonWeb
 
 DescribeCacheSubnetGroupsResult& DescribeCacheSubnetGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeReplicationGroupsResult::DescribeReplicationGroupsResult(const AmazonWeb
 
 DescribeReplicationGroupsResult& DescribeReplicationGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
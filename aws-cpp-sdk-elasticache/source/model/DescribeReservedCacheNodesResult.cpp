@@ -37,6 +37,7 @@ DescribeReservedCacheNodesResult::DescribeReservedCacheNodesResult(const AmazonW
 
 DescribeReservedCacheNodesResult& DescribeReservedCacheNodesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeSnapshotsResult::DescribeSnapshotsResult(const AmazonWebServiceResult<Xm
 
 DescribeSnapshotsResult& DescribeSnapshotsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyCacheClusterResult::ModifyCacheClusterResult(const AmazonWebServiceResult<
 
 ModifyCacheClusterResult& ModifyCacheClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyCacheParameterGroupResult::ModifyCacheParameterGroupResult(const AmazonWeb
 
 ModifyCacheParameterGroupResult& ModifyCacheParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyReplicationGroupResult::ModifyReplicationGroupResult(const AmazonWebServic
 
 ModifyReplicationGroupResult& ModifyReplicationGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RebootCacheClusterResult::RebootCacheClusterResult(const AmazonWebServiceResult<
 
 RebootCacheClusterResult& RebootCacheClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
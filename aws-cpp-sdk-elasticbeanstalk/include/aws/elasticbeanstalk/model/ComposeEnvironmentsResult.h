@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/elasticbeanstalk/model/EnvironmentDescription.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Result message containing a list of environment descriptions.</p>
    */
-  class AWS_ELASTICBEANSTALK_API ComposeEnvironmentsResult
+  class AWS_ELASTICBEANSTALK_API ComposeEnvironmentsResult : public AmazonWebServiceResultBase
   {
   public:
     ComposeEnvironmentsResult();
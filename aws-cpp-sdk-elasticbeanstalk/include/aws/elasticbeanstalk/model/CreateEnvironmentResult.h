@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticbeanstalk/model/EnvironmentStatus.h>
 #include <aws/elasticbeanstalk/model/EnvironmentHealth.h>
@@ -43,7 +44,7 @@ namespace Model
   /**
    * <p>Describes the properties of an environment.</p>
    */
-  class AWS_ELASTICBEANSTALK_API CreateEnvironmentResult
+  class AWS_ELASTICBEANSTALK_API CreateEnvironmentResult : public AmazonWebServiceResultBase
   {
   public:
     CreateEnvironmentResult();
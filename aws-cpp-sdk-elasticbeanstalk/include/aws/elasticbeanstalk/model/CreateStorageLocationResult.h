@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Results of a <a>CreateStorageLocationResult</a> call.</p>
    */
-  class AWS_ELASTICBEANSTALK_API CreateStorageLocationResult
+  class AWS_ELASTICBEANSTALK_API CreateStorageLocationResult : public AmazonWebServiceResultBase
   {
   public:
     CreateStorageLocationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/elasticbeanstalk/model/ApplicationVersionDescription.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Result message wrapping a list of application version descriptions.</p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeApplicationVersionsResult
+  class AWS_ELASTICBEANSTALK_API DescribeApplicationVersionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeApplicationVersionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/elasticbeanstalk/model/ApplicationDescription.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Result message containing a list of application descriptions.</p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeApplicationsResult
+  class AWS_ELASTICBEANSTALK_API DescribeApplicationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeApplicationsResult();
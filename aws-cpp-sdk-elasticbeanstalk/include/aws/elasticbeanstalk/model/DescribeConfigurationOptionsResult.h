@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Describes the settings for a specified configuration set.</p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeConfigurationOptionsResult
+  class AWS_ELASTICBEANSTALK_API DescribeConfigurationOptionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeConfigurationOptionsResult();
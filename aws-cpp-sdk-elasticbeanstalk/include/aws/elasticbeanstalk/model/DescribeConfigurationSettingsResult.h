@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/elasticbeanstalk/model/ConfigurationSettingsDescription.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The results from a request to change the configuration settings of an
    * environment.</p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeConfigurationSettingsResult
+  class AWS_ELASTICBEANSTALK_API DescribeConfigurationSettingsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeConfigurationSettingsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticbeanstalk/model/EnvironmentHealth.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -40,7 +41,7 @@ namespace Model
   /**
    * <p>See the example below for a sample response.</p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeEnvironmentHealthResult
+  class AWS_ELASTICBEANSTALK_API DescribeEnvironmentHealthResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEnvironmentHealthResult();
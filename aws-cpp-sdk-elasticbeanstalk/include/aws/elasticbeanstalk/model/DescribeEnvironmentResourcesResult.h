@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticbeanstalk/model/EnvironmentResourceDescription.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Result message containing a list of environment resource descriptions. </p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeEnvironmentResourcesResult
+  class AWS_ELASTICBEANSTALK_API DescribeEnvironmentResourcesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEnvironmentResourcesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Result message wrapping a list of event descriptions.</p>
    */
-  class AWS_ELASTICBEANSTALK_API DescribeEventsResult
+  class AWS_ELASTICBEANSTALK_API DescribeEventsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEventsResult();
@@ -29,6 +29,10 @@ namespace Model
   {
   public:
     ListAvailableSolutionStacksRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListAvailableSolutionStacks"; }
+
     Aws::String SerializePayload() const override;
 
   };
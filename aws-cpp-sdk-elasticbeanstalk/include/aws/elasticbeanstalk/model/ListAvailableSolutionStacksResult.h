@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>A list of available AWS Elastic Beanstalk solution stacks. </p>
    */
-  class AWS_ELASTICBEANSTALK_API ListAvailableSolutionStacksResult
+  class AWS_ELASTICBEANSTALK_API ListAvailableSolutionStacksResult : public AmazonWebServiceResultBase
   {
   public:
     ListAvailableSolutionStacksResult();
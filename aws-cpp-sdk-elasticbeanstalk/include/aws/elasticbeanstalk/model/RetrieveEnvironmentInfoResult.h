@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/elasticbeanstalk/model/EnvironmentInfoDescription.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Result message containing a description of the requested environment
    * info.</p>
    */
-  class AWS_ELASTICBEANSTALK_API RetrieveEnvironmentInfoResult
+  class AWS_ELASTICBEANSTALK_API RetrieveEnvironmentInfoResult : public AmazonWebServiceResultBase
   {
   public:
     RetrieveEnvironmentInfoResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticbeanstalk/model/ApplicationDescription.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Result message containing a single description of an application.</p>
    */
-  class AWS_ELASTICBEANSTALK_API UpdateApplicationResult
+  class AWS_ELASTICBEANSTALK_API UpdateApplicationResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateApplicationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticbeanstalk/model/ApplicationVersionDescription.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p> Result message wrapping a single description of an application version. </p>
    */
-  class AWS_ELASTICBEANSTALK_API UpdateApplicationVersionResult
+  class AWS_ELASTICBEANSTALK_API UpdateApplicationVersionResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateApplicationVersionResult();
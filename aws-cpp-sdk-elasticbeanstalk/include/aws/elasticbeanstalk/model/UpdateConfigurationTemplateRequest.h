@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     UpdateConfigurationTemplateRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UpdateConfigurationTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
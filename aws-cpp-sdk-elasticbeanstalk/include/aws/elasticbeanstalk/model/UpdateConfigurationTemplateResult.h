@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticbeanstalk/model/ConfigurationDeploymentStatus.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p> Describes the settings for a configuration set. </p>
    */
-  class AWS_ELASTICBEANSTALK_API UpdateConfigurationTemplateResult
+  class AWS_ELASTICBEANSTALK_API UpdateConfigurationTemplateResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateConfigurationTemplateResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticbeanstalk/ElasticBeanstalk_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticbeanstalk/model/ResponseMetadata.h>
 #include <aws/elasticbeanstalk/model/ValidationMessage.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Provides a list of validation messages.</p>
    */
-  class AWS_ELASTICBEANSTALK_API ValidateConfigurationSettingsResult
+  class AWS_ELASTICBEANSTALK_API ValidateConfigurationSettingsResult : public AmazonWebServiceResultBase
   {
   public:
     ValidateConfigurationSettingsResult();
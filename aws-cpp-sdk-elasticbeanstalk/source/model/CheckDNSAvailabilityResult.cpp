@@ -39,6 +39,7 @@ CheckDNSAvailabilityResult::CheckDNSAvailabilityResult(const AmazonWebServiceRes
 
 CheckDNSAvailabilityResult& CheckDNSAvailabilityResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateApplicationResult::CreateApplicationResult(const AmazonWebServiceResult<Xm
 
 CreateApplicationResult& CreateApplicationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateApplicationVersionResult::CreateApplicationVersionResult(const AmazonWebSe
 
 CreateApplicationVersionResult& CreateApplicationVersionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -41,6 +41,7 @@ CreateConfigurationTemplateResult::CreateConfigurationTemplateResult(const Amazo
 
 CreateConfigurationTemplateResult& CreateConfigurationTemplateResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -43,6 +43,7 @@ CreateEnvironmentResult::CreateEnvironmentResult(const AmazonWebServiceResult<Xm
 
 CreateEnvironmentResult& CreateEnvironmentResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateStorageLocationResult::CreateStorageLocationResult(const AmazonWebServiceR
 
 CreateStorageLocationResult& CreateStorageLocationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeApplicationVersionsResult::DescribeApplicationVersionsResult(const Amazo
 
 DescribeApplicationVersionsResult& DescribeApplicationVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
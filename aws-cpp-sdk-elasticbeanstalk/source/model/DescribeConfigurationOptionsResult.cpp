@@ -37,6 +37,7 @@ DescribeConfigurationOptionsResult::DescribeConfigurationOptionsResult(const Ama
 
 DescribeConfigurationOptionsResult& DescribeConfigurationOptionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeConfigurationSettingsResult::DescribeConfigurationSettingsResult(const A
 
 DescribeConfigurationSettingsResult& DescribeConfigurationSettingsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ DescribeEnvironmentHealthResult::DescribeEnvironmentHealthResult(const AmazonWeb
 
 DescribeEnvironmentHealthResult& DescribeEnvironmentHealthResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
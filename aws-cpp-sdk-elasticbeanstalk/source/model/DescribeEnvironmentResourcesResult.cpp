@@ -37,6 +37,7 @@ DescribeEnvironmentResourcesResult::DescribeEnvironmentResourcesResult(const Ama
 
 DescribeEnvironmentResourcesResult& DescribeEnvironmentResourcesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeEnvironmentsResult::DescribeEnvironmentsResult(const AmazonWebServiceRes
 
 DescribeEnvironmentsResult& DescribeEnvironmentsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
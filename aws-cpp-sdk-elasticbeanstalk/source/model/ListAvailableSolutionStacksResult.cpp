@@ -37,6 +37,7 @@ ListAvailableSolutionStacksResult::ListAvailableSolutionStacksResult(const Amazo
 
 ListAvailableSolutionStacksResult& ListAvailableSolutionStacksResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RetrieveEnvironmentInfoResult::RetrieveEnvironmentInfoResult(const AmazonWebServ
 
 RetrieveEnvironmentInfoResult& RetrieveEnvironmentInfoResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
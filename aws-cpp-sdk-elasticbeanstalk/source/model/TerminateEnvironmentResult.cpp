@@ -43,6 +43,7 @@ TerminateEnvironmentResult::TerminateEnvironmentResult(const AmazonWebServiceRes
 
 TerminateEnvironmentResult& TerminateEnvironmentResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ UpdateApplicationResult::UpdateApplicationResult(const AmazonWebServiceResult<Xm
 
 UpdateApplicationResult& UpdateApplicationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ UpdateApplicationVersionResult::UpdateApplicationVersionResult(const AmazonWebSe
 
 UpdateApplicationVersionResult& UpdateApplicationVersionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -41,6 +41,7 @@ UpdateConfigurationTemplateResult::UpdateConfigurationTemplateResult(const Amazo
 
 UpdateConfigurationTemplateResult& UpdateConfigurationTemplateResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -43,6 +43,7 @@ UpdateEnvironmentResult::UpdateEnvironmentResult(const AmazonWebServiceResult<Xm
 
 UpdateEnvironmentResult& UpdateEnvironmentResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ValidateConfigurationSettingsResult::ValidateConfigurationSettingsResult(const A
 
 ValidateConfigurationSettingsResult& ValidateConfigurationSettingsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
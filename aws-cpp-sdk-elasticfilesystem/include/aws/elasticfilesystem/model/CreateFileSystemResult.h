@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticfilesystem/EFS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticfilesystem/model/LifeCycleState.h>
 #include <aws/elasticfilesystem/model/FileSystemSize.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>This object provides description of a file system.</p>
    */
-  class AWS_EFS_API CreateFileSystemResult
+  class AWS_EFS_API CreateFileSystemResult : public AmazonWebServiceResultBase
   {
   public:
     CreateFileSystemResult();
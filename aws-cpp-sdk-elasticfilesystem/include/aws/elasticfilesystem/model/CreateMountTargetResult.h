@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticfilesystem/EFS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticfilesystem/model/LifeCycleState.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>This object provides description of a mount target.</p>
    */
-  class AWS_EFS_API CreateMountTargetResult
+  class AWS_EFS_API CreateMountTargetResult : public AmazonWebServiceResultBase
   {
   public:
     CreateMountTargetResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DescribeMountTargetSecurityGroupsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeMountTargetSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
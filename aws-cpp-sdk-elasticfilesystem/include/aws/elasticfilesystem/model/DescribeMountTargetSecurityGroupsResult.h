@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticfilesystem/EFS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace EFS
 {
 namespace Model
 {
-  class AWS_EFS_API DescribeMountTargetSecurityGroupsResult
+  class AWS_EFS_API DescribeMountTargetSecurityGroupsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeMountTargetSecurityGroupsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticfilesystem/EFS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticfilesystem/model/Tag.h>
@@ -34,7 +35,7 @@ namespace EFS
 {
 namespace Model
 {
-  class AWS_EFS_API DescribeTagsResult
+  class AWS_EFS_API DescribeTagsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTagsResult();
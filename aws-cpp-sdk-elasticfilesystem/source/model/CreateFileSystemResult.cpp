@@ -39,6 +39,7 @@ CreateFileSystemResult::CreateFileSystemResult(const AmazonWebServiceResult<Json
 
 CreateFileSystemResult& CreateFileSystemResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OwnerId"))
   {
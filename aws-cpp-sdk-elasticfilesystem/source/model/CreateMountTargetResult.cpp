@@ -35,6 +35,7 @@ CreateMountTargetResult::CreateMountTargetResult(const AmazonWebServiceResult<Js
 
 CreateMountTargetResult& CreateMountTargetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OwnerId"))
   {
@@ -35,6 +35,7 @@ DescribeFileSystemsResult::DescribeFileSystemsResult(const AmazonWebServiceResul
 
 DescribeFileSystemsResult& DescribeFileSystemsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -35,6 +35,7 @@ DescribeMountTargetSecurityGroupsResult::DescribeMountTargetSecurityGroupsResult
 
 DescribeMountTargetSecurityGroupsResult& DescribeMountTargetSecurityGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SecurityGroups"))
   {
@@ -35,6 +35,7 @@ DescribeMountTargetsResult::DescribeMountTargetsResult(const AmazonWebServiceRes
 
 DescribeMountTargetsResult& DescribeMountTargetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -35,6 +35,7 @@ DescribeTagsResult::DescribeTagsResult(const AmazonWebServiceResult<JsonValue>&
 
 DescribeTagsResult& DescribeTagsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Marker"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticloadbalancing/ElasticLoadBalancing_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticloadbalancing/model/HealthCheck.h>
 #include <aws/elasticloadbalancing/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace ElasticLoadBalancing
 {
 namespace Model
 {
-  class AWS_ELASTICLOADBALANCING_API ConfigureHealthCheckResult
+  class AWS_ELASTICLOADBALANCING_API ConfigureHealthCheckResult : public AmazonWebServiceResultBase
   {
   public:
     ConfigureHealthCheckResult();
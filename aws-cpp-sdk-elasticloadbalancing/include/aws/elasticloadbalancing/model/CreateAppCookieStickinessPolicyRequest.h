@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     CreateAppCookieStickinessPolicyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateAppCookieStickinessPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticloadbalancing/ElasticLoadBalancing_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticloadbalancing/model/ResponseMetadata.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace ElasticLoadBalancing
 {
 namespace Model
 {
-  class AWS_ELASTICLOADBALANCING_API CreateLBCookieStickinessPolicyResult
+  class AWS_ELASTICLOADBALANCING_API CreateLBCookieStickinessPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     CreateLBCookieStickinessPolicyResult();
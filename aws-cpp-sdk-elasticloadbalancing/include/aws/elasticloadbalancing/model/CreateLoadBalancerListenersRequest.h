@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     CreateLoadBalancerListenersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateLoadBalancerListeners"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticloadbalancing/ElasticLoadBalancing_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticloadbalancing/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace ElasticLoadBalancing
 {
 namespace Model
 {
-  class AWS_ELASTICLOADBALANCING_API CreateLoadBalancerResult
+  class AWS_ELASTICLOADBALANCING_API CreateLoadBalancerResult : public AmazonWebServiceResultBase
   {
   public:
     CreateLoadBalancerResult();
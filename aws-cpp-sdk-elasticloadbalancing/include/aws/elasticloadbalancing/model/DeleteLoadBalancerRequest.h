@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteLoadBalancerRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
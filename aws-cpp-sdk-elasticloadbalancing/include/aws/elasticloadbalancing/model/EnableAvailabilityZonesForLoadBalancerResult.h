@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticloadbalancing/ElasticLoadBalancing_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elasticloadbalancing/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -34,7 +35,7 @@ namespace ElasticLoadBalancing
 {
 namespace Model
 {
-  class AWS_ELASTICLOADBALANCING_API EnableAvailabilityZonesForLoadBalancerResult
+  class AWS_ELASTICLOADBALANCING_API EnableAvailabilityZonesForLoadBalancerResult : public AmazonWebServiceResultBase
   {
   public:
     EnableAvailabilityZonesForLoadBalancerResult();
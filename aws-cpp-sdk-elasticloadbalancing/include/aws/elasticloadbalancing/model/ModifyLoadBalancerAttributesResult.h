@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticloadbalancing/ElasticLoadBalancing_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticloadbalancing/model/LoadBalancerAttributes.h>
 #include <aws/elasticloadbalancing/model/ResponseMetadata.h>
@@ -34,7 +35,7 @@ namespace ElasticLoadBalancing
 {
 namespace Model
 {
-  class AWS_ELASTICLOADBALANCING_API ModifyLoadBalancerAttributesResult
+  class AWS_ELASTICLOADBALANCING_API ModifyLoadBalancerAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     ModifyLoadBalancerAttributesResult();
@@ -37,6 +37,7 @@ AddTagsResult::AddTagsResult(const AmazonWebServiceResult<XmlDocument>& result)
 
 AddTagsResult& AddTagsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
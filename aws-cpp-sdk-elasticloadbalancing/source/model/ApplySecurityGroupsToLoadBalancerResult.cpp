@@ -37,6 +37,7 @@ ApplySecurityGroupsToLoadBalancerResult::ApplySecurityGroupsToLoadBalancerResult
 
 ApplySecurityGroupsToLoadBalancerResult& ApplySecurityGroupsToLoadBalancerResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ AttachLoadBalancerToSubnetsResult::AttachLoadBalancerToSubnetsResult(const Amazo
 
 AttachLoadBalancerToSubnetsResult& AttachLoadBalancerToSubnetsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
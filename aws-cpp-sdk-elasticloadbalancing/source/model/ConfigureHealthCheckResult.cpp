@@ -37,6 +37,7 @@ ConfigureHealthCheckResult::ConfigureHealthCheckResult(const AmazonWebServiceRes
 
 ConfigureHealthCheckResult& ConfigureHealthCheckResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
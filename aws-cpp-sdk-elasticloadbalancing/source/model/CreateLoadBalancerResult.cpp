@@ -37,6 +37,7 @@ CreateLoadBalancerResult::CreateLoadBalancerResult(const AmazonWebServiceResult<
 
 CreateLoadBalancerResult& CreateLoadBalancerResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteLoadBalancerListenersResult::DeleteLoadBalancerListenersResult(const Amazo
 
 DeleteLoadBalancerListenersResult& DeleteLoadBalancerListenersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteLoadBalancerPolicyResult::DeleteLoadBalancerPolicyResult(const AmazonWebSe
 
 DeleteLoadBalancerPolicyResult& DeleteLoadBalancerPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeInstanceHealthResult::DescribeInstanceHealthResult(const AmazonWebServic
 
 DescribeInstanceHealthResult& DescribeInstanceHealthResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
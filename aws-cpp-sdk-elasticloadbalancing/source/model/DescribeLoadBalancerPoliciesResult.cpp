@@ -37,6 +37,7 @@ DescribeLoadBalancerPoliciesResult::DescribeLoadBalancerPoliciesResult(const Ama
 
 DescribeLoadBalancerPoliciesResult& DescribeLoadBalancerPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
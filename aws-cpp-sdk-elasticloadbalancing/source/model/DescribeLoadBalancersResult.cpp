@@ -37,6 +37,7 @@ DescribeLoadBalancersResult::DescribeLoadBalancersResult(const AmazonWebServiceR
 
 DescribeLoadBalancersResult& DescribeLoadBalancersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
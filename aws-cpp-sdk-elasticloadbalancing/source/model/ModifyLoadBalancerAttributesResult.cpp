@@ -37,6 +37,7 @@ ModifyLoadBalancerAttributesResult::ModifyLoadBalancerAttributesResult(const Ama
 
 ModifyLoadBalancerAttributesResult& ModifyLoadBalancerAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
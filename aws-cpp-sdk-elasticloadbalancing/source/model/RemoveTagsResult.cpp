@@ -37,6 +37,7 @@ RemoveTagsResult::RemoveTagsResult(const AmazonWebServiceResult<XmlDocument>& re
 
 RemoveTagsResult& RemoveTagsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
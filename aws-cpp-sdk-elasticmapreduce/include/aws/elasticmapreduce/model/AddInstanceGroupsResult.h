@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Output from an AddInstanceGroups call.</p>
    */
-  class AWS_EMR_API AddInstanceGroupsResult
+  class AWS_EMR_API AddInstanceGroupsResult : public AmazonWebServiceResultBase
   {
   public:
     AddInstanceGroupsResult();
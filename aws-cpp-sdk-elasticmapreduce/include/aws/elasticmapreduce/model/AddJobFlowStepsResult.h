@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p> The output for the <a>AddJobFlowSteps</a> operation. </p>
    */
-  class AWS_EMR_API AddJobFlowStepsResult
+  class AWS_EMR_API AddJobFlowStepsResult : public AmazonWebServiceResultBase
   {
   public:
     AddJobFlowStepsResult();
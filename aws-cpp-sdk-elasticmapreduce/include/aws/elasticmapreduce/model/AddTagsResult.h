@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>This output indicates the result of adding tags to a resource. </p>
    */
-  class AWS_EMR_API AddTagsResult
+  class AWS_EMR_API AddTagsResult : public AmazonWebServiceResultBase
   {
   public:
     AddTagsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elasticmapreduce/model/Step.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>This output contains the description of the cluster step.</p>
    */
-  class AWS_EMR_API DescribeStepResult
+  class AWS_EMR_API DescribeStepResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeStepResult();
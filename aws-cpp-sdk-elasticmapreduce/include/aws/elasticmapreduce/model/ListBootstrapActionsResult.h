@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticmapreduce/model/Command.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>This output contains the boostrap actions detail .</p>
    */
-  class AWS_EMR_API ListBootstrapActionsResult
+  class AWS_EMR_API ListBootstrapActionsResult : public AmazonWebServiceResultBase
   {
   public:
     ListBootstrapActionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticmapreduce/model/ClusterSummary.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>This contains a ClusterSummaryList with the cluster details; for example, the
    * cluster IDs, names, and status.</p>
    */
-  class AWS_EMR_API ListClustersResult
+  class AWS_EMR_API ListClustersResult : public AmazonWebServiceResultBase
   {
   public:
     ListClustersResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticmapreduce/model/InstanceGroup.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>This input determines which instance groups to retrieve.</p>
    */
-  class AWS_EMR_API ListInstanceGroupsResult
+  class AWS_EMR_API ListInstanceGroupsResult : public AmazonWebServiceResultBase
   {
   public:
     ListInstanceGroupsResult();
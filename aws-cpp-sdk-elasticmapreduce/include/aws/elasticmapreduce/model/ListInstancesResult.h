@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elasticmapreduce/model/Instance.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>This output contains the list of instances.</p>
    */
-  class AWS_EMR_API ListInstancesResult
+  class AWS_EMR_API ListInstancesResult : public AmazonWebServiceResultBase
   {
   public:
     ListInstancesResult();
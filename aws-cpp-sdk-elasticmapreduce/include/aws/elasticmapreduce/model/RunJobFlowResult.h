@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elasticmapreduce/EMR_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p> The result of the <a>RunJobFlow</a> operation. </p>
    */
-  class AWS_EMR_API RunJobFlowResult
+  class AWS_EMR_API RunJobFlowResult : public AmazonWebServiceResultBase
   {
   public:
     RunJobFlowResult();
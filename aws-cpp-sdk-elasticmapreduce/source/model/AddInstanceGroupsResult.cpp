@@ -35,6 +35,7 @@ AddInstanceGroupsResult::AddInstanceGroupsResult(const AmazonWebServiceResult<Js
 
 AddInstanceGroupsResult& AddInstanceGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("JobFlowId"))
   {
@@ -35,6 +35,7 @@ AddJobFlowStepsResult::AddJobFlowStepsResult(const AmazonWebServiceResult<JsonVa
 
 AddJobFlowStepsResult& AddJobFlowStepsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StepIds"))
   {
@@ -35,6 +35,7 @@ AddTagsResult::AddTagsResult(const AmazonWebServiceResult<JsonValue>& result)
 
 AddTagsResult& AddTagsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DescribeClusterResult::DescribeClusterResult(const AmazonWebServiceResult<JsonVa
 
 DescribeClusterResult& DescribeClusterResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Cluster"))
   {
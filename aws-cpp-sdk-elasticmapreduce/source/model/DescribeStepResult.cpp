@@ -35,6 +35,7 @@ DescribeStepResult::DescribeStepResult(const AmazonWebServiceResult<JsonValue>&
 
 DescribeStepResult& DescribeStepResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Step"))
   {
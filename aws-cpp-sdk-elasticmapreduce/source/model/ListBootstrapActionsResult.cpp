@@ -35,6 +35,7 @@ ListBootstrapActionsResult::ListBootstrapActionsResult(const AmazonWebServiceRes
 
 ListBootstrapActionsResult& ListBootstrapActionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("BootstrapActions"))
   {
@@ -35,6 +35,7 @@ ListClustersResult::ListClustersResult(const AmazonWebServiceResult<JsonValue>&
 
 ListClustersResult& ListClustersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Clusters"))
   {
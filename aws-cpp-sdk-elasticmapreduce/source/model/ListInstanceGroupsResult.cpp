@@ -35,6 +35,7 @@ ListInstanceGroupsResult::ListInstanceGroupsResult(const AmazonWebServiceResult<
 
 ListInstanceGroupsResult& ListInstanceGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("InstanceGroups"))
   {
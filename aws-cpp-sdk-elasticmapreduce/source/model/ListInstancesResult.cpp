@@ -35,6 +35,7 @@ ListInstancesResult::ListInstancesResult(const AmazonWebServiceResult<JsonValue>
 
 ListInstancesResult& ListInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Instances"))
   {
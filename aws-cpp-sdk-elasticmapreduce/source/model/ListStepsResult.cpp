@@ -35,6 +35,7 @@ ListStepsResult::ListStepsResult(const AmazonWebServiceResult<JsonValue>& result
 
 ListStepsResult& ListStepsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Steps"))
   {
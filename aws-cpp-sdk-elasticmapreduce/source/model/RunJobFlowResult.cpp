@@ -35,6 +35,7 @@ RunJobFlowResult::RunJobFlowResult(const AmazonWebServiceResult<JsonValue>& resu
 
 RunJobFlowResult& RunJobFlowResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("JobFlowId"))
   {
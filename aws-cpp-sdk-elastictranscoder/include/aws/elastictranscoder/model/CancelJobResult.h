@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -35,7 +36,7 @@ namespace Model
    * <p>The response body contains a JSON object. If the job is successfully
    * canceled, the value of <code>Success</code> is <code>true</code>.</p>
    */
-  class AWS_ELASTICTRANSCODER_API CancelJobResult
+  class AWS_ELASTICTRANSCODER_API CancelJobResult : public AmazonWebServiceResultBase
   {
   public:
     CancelJobResult();
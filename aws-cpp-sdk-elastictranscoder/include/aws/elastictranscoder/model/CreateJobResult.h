@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Job.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The CreateJobResponse structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API CreateJobResult
+  class AWS_ELASTICTRANSCODER_API CreateJobResult : public AmazonWebServiceResultBase
   {
   public:
     CreateJobResult();
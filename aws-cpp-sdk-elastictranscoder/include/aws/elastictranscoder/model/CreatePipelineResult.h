@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Pipeline.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elastictranscoder/model/Warning.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>When you create a pipeline, Elastic Transcoder returns the values that you
    * specified in the request.</p>
    */
-  class AWS_ELASTICTRANSCODER_API CreatePipelineResult
+  class AWS_ELASTICTRANSCODER_API CreatePipelineResult : public AmazonWebServiceResultBase
   {
   public:
     CreatePipelineResult();
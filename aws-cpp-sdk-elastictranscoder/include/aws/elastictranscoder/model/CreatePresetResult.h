@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Preset.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The <code>CreatePresetResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API CreatePresetResult
+  class AWS_ELASTICTRANSCODER_API CreatePresetResult : public AmazonWebServiceResultBase
   {
   public:
     CreatePresetResult();
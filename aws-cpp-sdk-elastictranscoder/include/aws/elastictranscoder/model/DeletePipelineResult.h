@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>The <code>DeletePipelineResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API DeletePipelineResult
+  class AWS_ELASTICTRANSCODER_API DeletePipelineResult : public AmazonWebServiceResultBase
   {
   public:
     DeletePipelineResult();
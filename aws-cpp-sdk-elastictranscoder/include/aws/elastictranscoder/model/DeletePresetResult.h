@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>The <code>DeletePresetResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API DeletePresetResult
+  class AWS_ELASTICTRANSCODER_API DeletePresetResult : public AmazonWebServiceResultBase
   {
   public:
     DeletePresetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elastictranscoder/model/Job.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The <code>ListJobsByPipelineResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API ListJobsByPipelineResult
+  class AWS_ELASTICTRANSCODER_API ListJobsByPipelineResult : public AmazonWebServiceResultBase
   {
   public:
     ListJobsByPipelineResult();
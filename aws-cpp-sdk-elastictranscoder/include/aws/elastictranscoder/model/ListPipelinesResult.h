@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/elastictranscoder/model/Pipeline.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>A list of the pipelines associated with the current AWS account.</p>
    */
-  class AWS_ELASTICTRANSCODER_API ListPipelinesResult
+  class AWS_ELASTICTRANSCODER_API ListPipelinesResult : public AmazonWebServiceResultBase
   {
   public:
     ListPipelinesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Pipeline.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elastictranscoder/model/Warning.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The <code>ReadPipelineResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API ReadPipelineResult
+  class AWS_ELASTICTRANSCODER_API ReadPipelineResult : public AmazonWebServiceResultBase
   {
   public:
     ReadPipelineResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The <code>TestRoleResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API TestRoleResult
+  class AWS_ELASTICTRANSCODER_API TestRoleResult : public AmazonWebServiceResultBase
   {
   public:
     TestRoleResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     UpdatePipelineNotificationsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UpdatePipelineNotifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Pipeline.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The <code>UpdatePipelineNotificationsResponse</code> structure.</p>
    */
-  class AWS_ELASTICTRANSCODER_API UpdatePipelineNotificationsResult
+  class AWS_ELASTICTRANSCODER_API UpdatePipelineNotificationsResult : public AmazonWebServiceResultBase
   {
   public:
     UpdatePipelineNotificationsResult();
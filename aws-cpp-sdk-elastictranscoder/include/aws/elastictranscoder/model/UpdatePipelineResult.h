@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Pipeline.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/elastictranscoder/model/Warning.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>When you update a pipeline, Elastic Transcoder returns the values that you
    * specified in the request. </p>
    */
-  class AWS_ELASTICTRANSCODER_API UpdatePipelineResult
+  class AWS_ELASTICTRANSCODER_API UpdatePipelineResult : public AmazonWebServiceResultBase
   {
   public:
     UpdatePipelineResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/elastictranscoder/ElasticTranscoder_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/elastictranscoder/model/Pipeline.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * When you update status for a pipeline, Elastic Transcoder returns the values
    * that you specified in the request.
    */
-  class AWS_ELASTICTRANSCODER_API UpdatePipelineStatusResult
+  class AWS_ELASTICTRANSCODER_API UpdatePipelineStatusResult : public AmazonWebServiceResultBase
   {
   public:
     UpdatePipelineStatusResult();
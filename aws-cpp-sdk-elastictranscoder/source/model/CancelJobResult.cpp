@@ -35,6 +35,7 @@ CancelJobResult::CancelJobResult(const AmazonWebServiceResult<JsonValue>& result
 
 CancelJobResult& CancelJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ CreateJobResult::CreateJobResult(const AmazonWebServiceResult<JsonValue>& result
 
 CreateJobResult& CreateJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Job"))
   {
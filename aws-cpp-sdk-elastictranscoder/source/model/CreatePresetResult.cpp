@@ -35,6 +35,7 @@ CreatePresetResult::CreatePresetResult(const AmazonWebServiceResult<JsonValue>&
 
 CreatePresetResult& CreatePresetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Preset"))
   {
@@ -35,6 +35,7 @@ DeletePipelineResult::DeletePipelineResult(const AmazonWebServiceResult<JsonValu
 
 DeletePipelineResult& DeletePipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
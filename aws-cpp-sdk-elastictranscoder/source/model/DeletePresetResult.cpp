@@ -35,6 +35,7 @@ DeletePresetResult::DeletePresetResult(const AmazonWebServiceResult<JsonValue>&
 
 DeletePresetResult& DeletePresetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ ListJobsByPipelineResult::ListJobsByPipelineResult(const AmazonWebServiceResult<
 
 ListJobsByPipelineResult& ListJobsByPipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Jobs"))
   {
@@ -35,6 +35,7 @@ ListJobsByStatusResult::ListJobsByStatusResult(const AmazonWebServiceResult<Json
 
 ListJobsByStatusResult& ListJobsByStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Jobs"))
   {
@@ -35,6 +35,7 @@ ListPresetsResult::ListPresetsResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListPresetsResult& ListPresetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Presets"))
   {
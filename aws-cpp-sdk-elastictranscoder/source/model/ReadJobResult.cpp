@@ -35,6 +35,7 @@ ReadJobResult::ReadJobResult(const AmazonWebServiceResult<JsonValue>& result)
 
 ReadJobResult& ReadJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Job"))
   {
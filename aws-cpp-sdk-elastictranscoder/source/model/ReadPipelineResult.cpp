@@ -35,6 +35,7 @@ ReadPipelineResult::ReadPipelineResult(const AmazonWebServiceResult<JsonValue>&
 
 ReadPipelineResult& ReadPipelineResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Pipeline"))
   {
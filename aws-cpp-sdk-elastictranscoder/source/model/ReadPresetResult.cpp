@@ -35,6 +35,7 @@ ReadPresetResult::ReadPresetResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ReadPresetResult& ReadPresetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Preset"))
   {
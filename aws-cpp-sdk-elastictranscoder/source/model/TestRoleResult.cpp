@@ -35,6 +35,7 @@ TestRoleResult::TestRoleResult(const AmazonWebServiceResult<JsonValue>& result)
 
 TestRoleResult& TestRoleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Success"))
   {
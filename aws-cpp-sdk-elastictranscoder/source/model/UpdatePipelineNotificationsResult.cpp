@@ -35,6 +35,7 @@ UpdatePipelineNotificationsResult::UpdatePipelineNotificationsResult(const Amazo
 
 UpdatePipelineNotificationsResult& UpdatePipelineNotificationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Pipeline"))
   {
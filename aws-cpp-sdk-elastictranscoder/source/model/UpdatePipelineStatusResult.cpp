@@ -35,6 +35,7 @@ UpdatePipelineStatusResult::UpdatePipelineStatusResult(const AmazonWebServiceRes
 
 UpdatePipelineStatusResult& UpdatePipelineStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Pipeline"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/email/model/ResponseMetadata.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API CloneReceiptRuleSetResult
+  class AWS_SES_API CloneReceiptRuleSetResult : public AmazonWebServiceResultBase
   {
   public:
     CloneReceiptRuleSetResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteReceiptRuleSetRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/email/model/ReceiptRule.h>
 #include <aws/email/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API DescribeReceiptRuleResult
+  class AWS_SES_API DescribeReceiptRuleResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeReceiptRuleResult();
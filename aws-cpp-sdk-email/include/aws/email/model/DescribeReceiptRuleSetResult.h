@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/email/model/ReceiptRuleSetMetadata.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/email/model/ResponseMetadata.h>
@@ -35,7 +36,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API DescribeReceiptRuleSetResult
+  class AWS_SES_API DescribeReceiptRuleSetResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeReceiptRuleSetResult();
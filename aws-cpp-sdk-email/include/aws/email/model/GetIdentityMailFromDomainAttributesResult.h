@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/email/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -35,7 +36,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API GetIdentityMailFromDomainAttributesResult
+  class AWS_SES_API GetIdentityMailFromDomainAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     GetIdentityMailFromDomainAttributesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/email/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -34,7 +35,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API ListIdentityPoliciesResult
+  class AWS_SES_API ListIdentityPoliciesResult : public AmazonWebServiceResultBase
   {
   public:
     ListIdentityPoliciesResult();
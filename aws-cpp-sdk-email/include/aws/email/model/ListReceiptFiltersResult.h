@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/email/model/ResponseMetadata.h>
 #include <aws/email/model/ReceiptFilter.h>
@@ -34,7 +35,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API ListReceiptFiltersResult
+  class AWS_SES_API ListReceiptFiltersResult : public AmazonWebServiceResultBase
   {
   public:
     ListReceiptFiltersResult();
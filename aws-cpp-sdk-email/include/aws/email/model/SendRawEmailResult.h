@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/email/SES_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/email/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace SES
 {
 namespace Model
 {
-  class AWS_SES_API SendRawEmailResult
+  class AWS_SES_API SendRawEmailResult : public AmazonWebServiceResultBase
   {
   public:
     SendRawEmailResult();
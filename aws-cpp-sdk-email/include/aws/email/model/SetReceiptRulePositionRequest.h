@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     SetReceiptRulePositionRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "SetReceiptRulePosition"; }
+
     Aws::String SerializePayload() const override;
 
     /**
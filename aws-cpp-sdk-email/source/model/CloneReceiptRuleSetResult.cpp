@@ -37,6 +37,7 @@ CloneReceiptRuleSetResult::CloneReceiptRuleSetResult(const AmazonWebServiceResul
 
 CloneReceiptRuleSetResult& CloneReceiptRuleSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
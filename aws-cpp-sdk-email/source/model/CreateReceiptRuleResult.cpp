@@ -37,6 +37,7 @@ CreateReceiptRuleResult::CreateReceiptRuleResult(const AmazonWebServiceResult<Xm
 
 CreateReceiptRuleResult& CreateReceiptRuleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateReceiptRuleSetResult::CreateReceiptRuleSetResult(const AmazonWebServiceRes
 
 CreateReceiptRuleSetResult& CreateReceiptRuleSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
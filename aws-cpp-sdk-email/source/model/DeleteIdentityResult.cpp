@@ -37,6 +37,7 @@ DeleteIdentityResult::DeleteIdentityResult(const AmazonWebServiceResult<XmlDocum
 
 DeleteIdentityResult& DeleteIdentityResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteReceiptFilterResult::DeleteReceiptFilterResult(const AmazonWebServiceResul
 
 DeleteReceiptFilterResult& DeleteReceiptFilterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteReceiptRuleResult::DeleteReceiptRuleResult(const AmazonWebServiceResult<Xm
 
 DeleteReceiptRuleResult& DeleteReceiptRuleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
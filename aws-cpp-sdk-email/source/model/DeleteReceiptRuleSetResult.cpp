@@ -37,6 +37,7 @@ DeleteReceiptRuleSetResult::DeleteReceiptRuleSetResult(const AmazonWebServiceRes
 
 DeleteReceiptRuleSetResult& DeleteReceiptRuleSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
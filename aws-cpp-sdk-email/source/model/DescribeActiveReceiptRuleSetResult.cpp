@@ -37,6 +37,7 @@ DescribeActiveReceiptRuleSetResult::DescribeActiveReceiptRuleSetResult(const Ama
 
 DescribeActiveReceiptRuleSetResult& DescribeActiveReceiptRuleSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetIdentityDkimAttributesResult::GetIdentityDkimAttributesResult(const AmazonWeb
 
 GetIdentityDkimAttributesResult& GetIdentityDkimAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -43,6 +43,7 @@ GetSendQuotaResult::GetSendQuotaResult(const AmazonWebServiceResult<XmlDocument>
 
 GetSendQuotaResult& GetSendQuotaResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
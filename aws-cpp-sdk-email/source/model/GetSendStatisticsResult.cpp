@@ -37,6 +37,7 @@ GetSendStatisticsResult::GetSendStatisticsResult(const AmazonWebServiceResult<Xm
 
 GetSendStatisticsResult& GetSendStatisticsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
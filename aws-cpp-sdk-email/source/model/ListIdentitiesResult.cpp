@@ -37,6 +37,7 @@ ListIdentitiesResult::ListIdentitiesResult(const AmazonWebServiceResult<XmlDocum
 
 ListIdentitiesResult& ListIdentitiesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListIdentityPoliciesResult::ListIdentityPoliciesResult(const AmazonWebServiceRes
 
 ListIdentityPoliciesResult& ListIdentityPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
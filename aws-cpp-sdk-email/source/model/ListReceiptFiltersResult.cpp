@@ -37,6 +37,7 @@ ListReceiptFiltersResult::ListReceiptFiltersResult(const AmazonWebServiceResult<
 
 ListReceiptFiltersResult& ListReceiptFiltersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
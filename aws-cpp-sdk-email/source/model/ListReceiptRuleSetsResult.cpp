@@ -37,6 +37,7 @@ ListReceiptRuleSetsResult::ListReceiptRuleSetsResult(const AmazonWebServiceResul
 
 ListReceiptRuleSetsResult& ListReceiptRuleSetsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListVerifiedEmailAddressesResult::ListVerifiedEmailAddressesResult(const AmazonW
 
 ListVerifiedEmailAddressesResult& ListVerifiedEmailAddressesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ PutIdentityPolicyResult::PutIdentityPolicyResult(const AmazonWebServiceResult<Xm
 
 PutIdentityPolicyResult& PutIdentityPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
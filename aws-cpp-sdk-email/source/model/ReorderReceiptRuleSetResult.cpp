@@ -37,6 +37,7 @@ ReorderReceiptRuleSetResult::ReorderReceiptRuleSetResult(const AmazonWebServiceR
 
 ReorderReceiptRuleSetResult& ReorderReceiptRuleSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ SendBounceResult::SendBounceResult(const AmazonWebServiceResult<XmlDocument>& re
 
 SendBounceResult& SendBounceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
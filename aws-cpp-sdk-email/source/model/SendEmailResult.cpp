@@ -37,6 +37,7 @@ SendEmailResult::SendEmailResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 SendEmailResult& SendEmailResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
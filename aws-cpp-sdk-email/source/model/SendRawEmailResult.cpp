@@ -37,6 +37,7 @@ SendRawEmailResult::SendRawEmailResult(const AmazonWebServiceResult<XmlDocument>
 
 SendRawEmailResult& SendRawEmailResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
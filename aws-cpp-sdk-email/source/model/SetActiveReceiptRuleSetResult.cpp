@@ -37,6 +37,7 @@ SetActiveReceiptRuleSetResult::SetActiveReceiptRuleSetResult(const AmazonWebServ
 
 SetActiveReceiptRuleSetResult& SetActiveReceiptRuleSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ SetIdentityDkimEnabledResult::SetIdentityDkimEnabledResult(const AmazonWebServic
 
 SetIdentityDkimEnabledResult& SetIdentityDkimEnabledResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
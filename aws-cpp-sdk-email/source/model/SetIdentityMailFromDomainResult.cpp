@@ -37,6 +37,7 @@ SetIdentityMailFromDomainResult::SetIdentityMailFromDomainResult(const AmazonWeb
 
 SetIdentityMailFromDomainResult& SetIdentityMailFromDomainResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ SetIdentityNotificationTopicResult::SetIdentityNotificationTopicResult(const Ama
 
 SetIdentityNotificationTopicResult& SetIdentityNotificationTopicResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
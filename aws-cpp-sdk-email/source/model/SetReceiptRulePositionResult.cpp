@@ -37,6 +37,7 @@ SetReceiptRulePositionResult::SetReceiptRulePositionResult(const AmazonWebServic
 
 SetReceiptRulePositionResult& SetReceiptRulePositionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ UpdateReceiptRuleResult::UpdateReceiptRuleResult(const AmazonWebServiceResult<Xm
 
 UpdateReceiptRuleResult& UpdateReceiptRuleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
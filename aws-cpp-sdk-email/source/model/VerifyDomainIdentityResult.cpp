@@ -37,6 +37,7 @@ VerifyDomainIdentityResult::VerifyDomainIdentityResult(const AmazonWebServiceRes
 
 VerifyDomainIdentityResult& VerifyDomainIdentityResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
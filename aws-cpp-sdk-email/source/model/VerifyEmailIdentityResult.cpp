@@ -37,6 +37,7 @@ VerifyEmailIdentityResult::VerifyEmailIdentityResult(const AmazonWebServiceResul
 
 VerifyEmailIdentityResult& VerifyEmailIdentityResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/es/model/ElasticsearchDomainStatus.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The result of a <code>CreateElasticsearchDomain</code> operation. Contains
    * the status of the newly created Elasticsearch domain.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API CreateElasticsearchDomainResult
+  class AWS_ELASTICSEARCHSERVICE_API CreateElasticsearchDomainResult : public AmazonWebServiceResultBase
   {
   public:
     CreateElasticsearchDomainResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/es/model/ElasticsearchDomainStatus.h>
 
 namespace Aws
@@ -37,7 +38,7 @@ namespace Model
    * status of the pending deletion, or no status if the domain and all of its
    * resources have been deleted.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API DeleteElasticsearchDomainResult
+  class AWS_ELASTICSEARCHSERVICE_API DeleteElasticsearchDomainResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteElasticsearchDomainResult();
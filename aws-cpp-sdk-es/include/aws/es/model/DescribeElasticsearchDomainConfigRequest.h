@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     DescribeElasticsearchDomainConfigRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeElasticsearchDomainConfig"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/es/model/ElasticsearchDomainConfig.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The result of a <code>DescribeElasticsearchDomainConfig</code> request.
    * Contains the configuration information of the requested domain.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API DescribeElasticsearchDomainConfigResult
+  class AWS_ELASTICSEARCHSERVICE_API DescribeElasticsearchDomainConfigResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeElasticsearchDomainConfigResult();
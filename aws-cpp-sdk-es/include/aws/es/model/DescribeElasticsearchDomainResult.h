@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/es/model/ElasticsearchDomainStatus.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The result of a <code>DescribeElasticsearchDomain</code> request. Contains
    * the status of the domain specified in the request.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API DescribeElasticsearchDomainResult
+  class AWS_ELASTICSEARCHSERVICE_API DescribeElasticsearchDomainResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeElasticsearchDomainResult();
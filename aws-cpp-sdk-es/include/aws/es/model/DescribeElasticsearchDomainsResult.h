@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/es/model/ElasticsearchDomainStatus.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>DescribeElasticsearchDomains</code> request. Contains
    * the status of the specified domains or all domains owned by the account.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API DescribeElasticsearchDomainsResult
+  class AWS_ELASTICSEARCHSERVICE_API DescribeElasticsearchDomainsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeElasticsearchDomainsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/es/model/DomainInfo.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>ListDomainNames</code> operation. Contains the names of
    * all Elasticsearch domains owned by this account.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API ListDomainNamesResult
+  class AWS_ELASTICSEARCHSERVICE_API ListDomainNamesResult : public AmazonWebServiceResultBase
   {
   public:
     ListDomainNamesResult();
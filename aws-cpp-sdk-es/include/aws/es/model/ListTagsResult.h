@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/es/model/Tag.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The result of a <code>ListTags</code> operation. Contains tags for all
    * requested Elasticsearch domains.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API ListTagsResult
+  class AWS_ELASTICSEARCHSERVICE_API ListTagsResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/es/ElasticsearchService_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/es/model/ElasticsearchDomainConfig.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The result of an <code>UpdateElasticsearchDomain</code> request. Contains the
    * status of the Elasticsearch domain being updated.</p>
    */
-  class AWS_ELASTICSEARCHSERVICE_API UpdateElasticsearchDomainConfigResult
+  class AWS_ELASTICSEARCHSERVICE_API UpdateElasticsearchDomainConfigResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateElasticsearchDomainConfigResult();
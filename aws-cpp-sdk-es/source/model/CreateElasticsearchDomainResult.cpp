@@ -35,6 +35,7 @@ CreateElasticsearchDomainResult::CreateElasticsearchDomainResult(const AmazonWeb
 
 CreateElasticsearchDomainResult& CreateElasticsearchDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainStatus"))
   {
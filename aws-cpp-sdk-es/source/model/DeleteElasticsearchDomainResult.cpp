@@ -35,6 +35,7 @@ DeleteElasticsearchDomainResult::DeleteElasticsearchDomainResult(const AmazonWeb
 
 DeleteElasticsearchDomainResult& DeleteElasticsearchDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainStatus"))
   {
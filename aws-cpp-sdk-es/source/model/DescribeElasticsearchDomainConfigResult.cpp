@@ -35,6 +35,7 @@ DescribeElasticsearchDomainConfigResult::DescribeElasticsearchDomainConfigResult
 
 DescribeElasticsearchDomainConfigResult& DescribeElasticsearchDomainConfigResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainConfig"))
   {
@@ -35,6 +35,7 @@ DescribeElasticsearchDomainResult::DescribeElasticsearchDomainResult(const Amazo
 
 DescribeElasticsearchDomainResult& DescribeElasticsearchDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainStatus"))
   {
@@ -35,6 +35,7 @@ DescribeElasticsearchDomainsResult::DescribeElasticsearchDomainsResult(const Ama
 
 DescribeElasticsearchDomainsResult& DescribeElasticsearchDomainsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainStatusList"))
   {
@@ -35,6 +35,7 @@ ListDomainNamesResult::ListDomainNamesResult(const AmazonWebServiceResult<JsonVa
 
 ListDomainNamesResult& ListDomainNamesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainNames"))
   {
@@ -35,6 +35,7 @@ UpdateElasticsearchDomainConfigResult::UpdateElasticsearchDomainConfigResult(con
 
 UpdateElasticsearchDomainConfigResult& UpdateElasticsearchDomainConfigResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainConfig"))
   {
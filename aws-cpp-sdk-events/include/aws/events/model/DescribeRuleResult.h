@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/events/model/RuleState.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The result of the <a>DescribeRule</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API DescribeRuleResult
+  class AWS_CLOUDWATCHEVENTS_API DescribeRuleResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeRuleResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The result of the <a>ListRuleNamesByTarget</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API ListRuleNamesByTargetResult
+  class AWS_CLOUDWATCHEVENTS_API ListRuleNamesByTargetResult : public AmazonWebServiceResultBase
   {
   public:
     ListRuleNamesByTargetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/events/model/Rule.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The result of the <a>ListRules</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API ListRulesResult
+  class AWS_CLOUDWATCHEVENTS_API ListRulesResult : public AmazonWebServiceResultBase
   {
   public:
     ListRulesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/events/model/PutEventsResultEntry.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The result of the <a>PutEvents</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API PutEventsResult
+  class AWS_CLOUDWATCHEVENTS_API PutEventsResult : public AmazonWebServiceResultBase
   {
   public:
     PutEventsResult();
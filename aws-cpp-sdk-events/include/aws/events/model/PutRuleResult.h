@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The result of the <a>PutRule</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API PutRuleResult
+  class AWS_CLOUDWATCHEVENTS_API PutRuleResult : public AmazonWebServiceResultBase
   {
   public:
     PutRuleResult();
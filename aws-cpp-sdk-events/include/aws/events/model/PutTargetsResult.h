@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/events/model/PutTargetsResultEntry.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The result of the <a>PutTargets</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API PutTargetsResult
+  class AWS_CLOUDWATCHEVENTS_API PutTargetsResult : public AmazonWebServiceResultBase
   {
   public:
     PutTargetsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/events/CloudWatchEvents_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>The result of the <a>TestEventPattern</a> operation.</p>
    */
-  class AWS_CLOUDWATCHEVENTS_API TestEventPatternResult
+  class AWS_CLOUDWATCHEVENTS_API TestEventPatternResult : public AmazonWebServiceResultBase
   {
   public:
     TestEventPatternResult();
@@ -35,6 +35,7 @@ DescribeRuleResult::DescribeRuleResult(const AmazonWebServiceResult<JsonValue>&
 
 DescribeRuleResult& DescribeRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Name"))
   {
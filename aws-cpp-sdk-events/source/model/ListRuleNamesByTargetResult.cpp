@@ -35,6 +35,7 @@ ListRuleNamesByTargetResult::ListRuleNamesByTargetResult(const AmazonWebServiceR
 
 ListRuleNamesByTargetResult& ListRuleNamesByTargetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("RuleNames"))
   {
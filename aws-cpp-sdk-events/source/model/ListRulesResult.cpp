@@ -35,6 +35,7 @@ ListRulesResult::ListRulesResult(const AmazonWebServiceResult<JsonValue>& result
 
 ListRulesResult& ListRulesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Rules"))
   {
@@ -35,6 +35,7 @@ ListTargetsByRuleResult::ListTargetsByRuleResult(const AmazonWebServiceResult<Js
 
 ListTargetsByRuleResult& ListTargetsByRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Targets"))
   {
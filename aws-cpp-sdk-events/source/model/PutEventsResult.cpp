@@ -37,6 +37,7 @@ PutEventsResult::PutEventsResult(const AmazonWebServiceResult<JsonValue>& result
 
 PutEventsResult& PutEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedEntryCount"))
   {
@@ -35,6 +35,7 @@ PutRuleResult::PutRuleResult(const AmazonWebServiceResult<JsonValue>& result)
 
 PutRuleResult& PutRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("RuleArn"))
   {
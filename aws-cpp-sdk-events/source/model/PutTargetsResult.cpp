@@ -37,6 +37,7 @@ PutTargetsResult::PutTargetsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 PutTargetsResult& PutTargetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedEntryCount"))
   {
@@ -37,6 +37,7 @@ RemoveTargetsResult::RemoveTargetsResult(const AmazonWebServiceResult<JsonValue>
 
 RemoveTargetsResult& RemoveTargetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedEntryCount"))
   {
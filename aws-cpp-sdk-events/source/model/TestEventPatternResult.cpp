@@ -37,6 +37,7 @@ TestEventPatternResult::TestEventPatternResult(const AmazonWebServiceResult<Json
 
 TestEventPatternResult& TestEventPatternResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Result"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/firehose/Firehose_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of <a>CreateDeliveryStream</a>.</p>
    */
-  class AWS_FIREHOSE_API CreateDeliveryStreamResult
+  class AWS_FIREHOSE_API CreateDeliveryStreamResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDeliveryStreamResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/firehose/Firehose_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/firehose/model/DeliveryStreamDescription.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of <a>DescribeDeliveryStream</a>.</p>
    */
-  class AWS_FIREHOSE_API DescribeDeliveryStreamResult
+  class AWS_FIREHOSE_API DescribeDeliveryStreamResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDeliveryStreamResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/firehose/Firehose_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/firehose/model/PutRecordBatchResponseEntry.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the output of <a>PutRecordBatch</a>.</p>
    */
-  class AWS_FIREHOSE_API PutRecordBatchResult
+  class AWS_FIREHOSE_API PutRecordBatchResult : public AmazonWebServiceResultBase
   {
   public:
     PutRecordBatchResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/firehose/Firehose_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the output of <a>PutRecord</a>.</p>
    */
-  class AWS_FIREHOSE_API PutRecordResult
+  class AWS_FIREHOSE_API PutRecordResult : public AmazonWebServiceResultBase
   {
   public:
     PutRecordResult();
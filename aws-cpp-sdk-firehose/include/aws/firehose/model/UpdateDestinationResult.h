@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/firehose/Firehose_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the output of <a>UpdateDestination</a>.</p>
    */
-  class AWS_FIREHOSE_API UpdateDestinationResult
+  class AWS_FIREHOSE_API UpdateDestinationResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateDestinationResult();
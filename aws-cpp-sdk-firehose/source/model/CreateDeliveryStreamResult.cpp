@@ -35,6 +35,7 @@ CreateDeliveryStreamResult::CreateDeliveryStreamResult(const AmazonWebServiceRes
 
 CreateDeliveryStreamResult& CreateDeliveryStreamResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DeliveryStreamARN"))
   {
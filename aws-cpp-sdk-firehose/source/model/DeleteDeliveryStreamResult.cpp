@@ -35,6 +35,7 @@ DeleteDeliveryStreamResult::DeleteDeliveryStreamResult(const AmazonWebServiceRes
 
 DeleteDeliveryStreamResult& DeleteDeliveryStreamResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DescribeDeliveryStreamResult::DescribeDeliveryStreamResult(const AmazonWebServic
 
 DescribeDeliveryStreamResult& DescribeDeliveryStreamResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DeliveryStreamDescription"))
   {
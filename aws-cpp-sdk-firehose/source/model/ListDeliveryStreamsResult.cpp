@@ -37,6 +37,7 @@ ListDeliveryStreamsResult::ListDeliveryStreamsResult(const AmazonWebServiceResul
 
 ListDeliveryStreamsResult& ListDeliveryStreamsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DeliveryStreamNames"))
   {
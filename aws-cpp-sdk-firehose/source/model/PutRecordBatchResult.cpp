@@ -37,6 +37,7 @@ PutRecordBatchResult::PutRecordBatchResult(const AmazonWebServiceResult<JsonValu
 
 PutRecordBatchResult& PutRecordBatchResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedPutCount"))
   {
@@ -35,6 +35,7 @@ UpdateDestinationResult::UpdateDestinationResult(const AmazonWebServiceResult<Js
 
 UpdateDestinationResult& UpdateDestinationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/gamelift/GameLift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/gamelift/model/Alias.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the returned data in response to a request action.</p>
    */
-  class AWS_GAMELIFT_API CreateAliasResult
+  class AWS_GAMELIFT_API CreateAliasResult : public AmazonWebServiceResultBase
   {
   public:
     CreateAliasResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/gamelift/GameLift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/gamelift/model/Build.h>
 #include <aws/gamelift/model/AwsCredentials.h>
 #include <aws/gamelift/model/S3Location.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the returned data in response to a request action.</p>
    */
-  class AWS_GAMELIFT_API CreateBuildResult
+  class AWS_GAMELIFT_API CreateBuildResult : public AmazonWebServiceResultBase
   {
   public:
     CreateBuildResult();
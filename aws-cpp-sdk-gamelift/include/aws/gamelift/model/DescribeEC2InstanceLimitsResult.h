@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/gamelift/GameLift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/gamelift/model/EC2InstanceLimit.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the returned data in response to a request action.</p>
    */
-  class AWS_GAMELIFT_API DescribeEC2InstanceLimitsResult
+  class AWS_GAMELIFT_API DescribeEC2InstanceLimitsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEC2InstanceLimitsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/gamelift/GameLift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/gamelift/model/FleetCapacity.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the returned data in response to a request action.</p>
    */
-  class AWS_GAMELIFT_API DescribeFleetCapacityResult
+  class AWS_GAMELIFT_API DescribeFleetCapacityResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeFleetCapacityResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/gamelift/GameLift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/gamelift/model/IpPermission.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the returned data in response to a request action.</p>
    */
-  class AWS_GAMELIFT_API DescribeFleetPortSettingsResult
+  class AWS_GAMELIFT_API DescribeFleetPortSettingsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeFleetPortSettingsResult();
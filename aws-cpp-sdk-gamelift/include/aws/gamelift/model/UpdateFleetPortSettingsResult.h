@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/gamelift/GameLift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the returned data in response to a request action.</p>
    */
-  class AWS_GAMELIFT_API UpdateFleetPortSettingsResult
+  class AWS_GAMELIFT_API UpdateFleetPortSettingsResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateFleetPortSettingsResult();
@@ -35,6 +35,7 @@ CreateAliasResult::CreateAliasResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateAliasResult& CreateAliasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Alias"))
   {
@@ -35,6 +35,7 @@ CreateBuildResult::CreateBuildResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateBuildResult& CreateBuildResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Build"))
   {
@@ -35,6 +35,7 @@ CreateFleetResult::CreateFleetResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateFleetResult& CreateFleetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetAttributes"))
   {
@@ -35,6 +35,7 @@ CreateGameSessionResult::CreateGameSessionResult(const AmazonWebServiceResult<Js
 
 CreateGameSessionResult& CreateGameSessionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GameSession"))
   {
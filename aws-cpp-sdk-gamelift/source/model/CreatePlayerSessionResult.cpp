@@ -35,6 +35,7 @@ CreatePlayerSessionResult::CreatePlayerSessionResult(const AmazonWebServiceResul
 
 CreatePlayerSessionResult& CreatePlayerSessionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("PlayerSession"))
   {
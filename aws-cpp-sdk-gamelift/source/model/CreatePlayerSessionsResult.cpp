@@ -35,6 +35,7 @@ CreatePlayerSessionsResult::CreatePlayerSessionsResult(const AmazonWebServiceRes
 
 CreatePlayerSessionsResult& CreatePlayerSessionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("PlayerSessions"))
   {
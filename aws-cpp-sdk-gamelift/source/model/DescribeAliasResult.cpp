@@ -35,6 +35,7 @@ DescribeAliasResult::DescribeAliasResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeAliasResult& DescribeAliasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Alias"))
   {
@@ -35,6 +35,7 @@ DescribeBuildResult::DescribeBuildResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeBuildResult& DescribeBuildResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Build"))
   {
@@ -35,6 +35,7 @@ DescribeEC2InstanceLimitsResult::DescribeEC2InstanceLimitsResult(const AmazonWeb
 
 DescribeEC2InstanceLimitsResult& DescribeEC2InstanceLimitsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EC2InstanceLimits"))
   {
@@ -35,6 +35,7 @@ DescribeFleetAttributesResult::DescribeFleetAttributesResult(const AmazonWebServ
 
 DescribeFleetAttributesResult& DescribeFleetAttributesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetAttributes"))
   {
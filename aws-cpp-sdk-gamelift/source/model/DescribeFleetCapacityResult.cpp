@@ -35,6 +35,7 @@ DescribeFleetCapacityResult::DescribeFleetCapacityResult(const AmazonWebServiceR
 
 DescribeFleetCapacityResult& DescribeFleetCapacityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetCapacity"))
   {
@@ -35,6 +35,7 @@ DescribeFleetEventsResult::DescribeFleetEventsResult(const AmazonWebServiceResul
 
 DescribeFleetEventsResult& DescribeFleetEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Events"))
   {
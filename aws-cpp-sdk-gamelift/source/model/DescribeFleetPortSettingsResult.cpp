@@ -35,6 +35,7 @@ DescribeFleetPortSettingsResult::DescribeFleetPortSettingsResult(const AmazonWeb
 
 DescribeFleetPortSettingsResult& DescribeFleetPortSettingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("InboundPermissions"))
   {
@@ -35,6 +35,7 @@ DescribeFleetUtilizationResult::DescribeFleetUtilizationResult(const AmazonWebSe
 
 DescribeFleetUtilizationResult& DescribeFleetUtilizationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetUtilization"))
   {
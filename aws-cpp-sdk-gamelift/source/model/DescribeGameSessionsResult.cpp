@@ -35,6 +35,7 @@ DescribeGameSessionsResult::DescribeGameSessionsResult(const AmazonWebServiceRes
 
 DescribeGameSessionsResult& DescribeGameSessionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GameSessions"))
   {
@@ -35,6 +35,7 @@ DescribePlayerSessionsResult::DescribePlayerSessionsResult(const AmazonWebServic
 
 DescribePlayerSessionsResult& DescribePlayerSessionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("PlayerSessions"))
   {
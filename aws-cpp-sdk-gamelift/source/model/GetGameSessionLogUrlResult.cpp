@@ -35,6 +35,7 @@ GetGameSessionLogUrlResult::GetGameSessionLogUrlResult(const AmazonWebServiceRes
 
 GetGameSessionLogUrlResult& GetGameSessionLogUrlResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("PreSignedUrl"))
   {
@@ -35,6 +35,7 @@ ListAliasesResult::ListAliasesResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListAliasesResult& ListAliasesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Aliases"))
   {
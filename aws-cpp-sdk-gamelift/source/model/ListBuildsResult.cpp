@@ -35,6 +35,7 @@ ListBuildsResult::ListBuildsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListBuildsResult& ListBuildsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Builds"))
   {
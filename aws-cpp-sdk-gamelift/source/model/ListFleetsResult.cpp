@@ -35,6 +35,7 @@ ListFleetsResult::ListFleetsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListFleetsResult& ListFleetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetIds"))
   {
@@ -35,6 +35,7 @@ RequestUploadCredentialsResult::RequestUploadCredentialsResult(const AmazonWebSe
 
 RequestUploadCredentialsResult& RequestUploadCredentialsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UploadCredentials"))
   {
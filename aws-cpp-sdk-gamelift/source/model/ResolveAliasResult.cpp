@@ -35,6 +35,7 @@ ResolveAliasResult::ResolveAliasResult(const AmazonWebServiceResult<JsonValue>&
 
 ResolveAliasResult& ResolveAliasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetId"))
   {
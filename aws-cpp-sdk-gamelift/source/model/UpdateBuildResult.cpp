@@ -35,6 +35,7 @@ UpdateBuildResult::UpdateBuildResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateBuildResult& UpdateBuildResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Build"))
   {
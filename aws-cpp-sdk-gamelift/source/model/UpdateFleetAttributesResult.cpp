@@ -35,6 +35,7 @@ UpdateFleetAttributesResult::UpdateFleetAttributesResult(const AmazonWebServiceR
 
 UpdateFleetAttributesResult& UpdateFleetAttributesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetId"))
   {
@@ -35,6 +35,7 @@ UpdateFleetCapacityResult::UpdateFleetCapacityResult(const AmazonWebServiceResul
 
 UpdateFleetCapacityResult& UpdateFleetCapacityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetId"))
   {
@@ -35,6 +35,7 @@ UpdateFleetPortSettingsResult::UpdateFleetPortSettingsResult(const AmazonWebServ
 
 UpdateFleetPortSettingsResult& UpdateFleetPortSettingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FleetId"))
   {
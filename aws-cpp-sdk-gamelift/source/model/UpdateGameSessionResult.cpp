@@ -35,6 +35,7 @@ UpdateGameSessionResult::UpdateGameSessionResult(const AmazonWebServiceResult<Js
 
 UpdateGameSessionResult& UpdateGameSessionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GameSession"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -40,7 +41,7 @@ namespace Model
    * href="http://docs.aws.amazon.com/amazonglacier/latest/dev/working-with-archives.html">Working
    * with Archives in Amazon Glacier</a>.</p>
    */
-  class AWS_GLACIER_API CompleteMultipartUploadResult
+  class AWS_GLACIER_API CompleteMultipartUploadResult : public AmazonWebServiceResultBase
   {
   public:
     CompleteMultipartUploadResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/glacier/model/ActionCode.h>
 #include <aws/glacier/model/StatusCode.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Describes an Amazon Glacier job.</p>
    */
-  class AWS_GLACIER_API DescribeJobResult
+  class AWS_GLACIER_API DescribeJobResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeJobResult();
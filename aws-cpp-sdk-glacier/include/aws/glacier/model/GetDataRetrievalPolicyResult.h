@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/glacier/model/DataRetrievalPolicy.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Contains the Amazon Glacier response to the
    * <code>GetDataRetrievalPolicy</code> request.</p>
    */
-  class AWS_GLACIER_API GetDataRetrievalPolicyResult
+  class AWS_GLACIER_API GetDataRetrievalPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetDataRetrievalPolicyResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -30,7 +31,7 @@ namespace Model
   /**
    * <p>Contains the Amazon Glacier response to your request.</p>
    */
-  class AWS_GLACIER_API GetJobOutputResult
+  class AWS_GLACIER_API GetJobOutputResult : public AmazonWebServiceResultBase
   {
   public:
     GetJobOutputResult();
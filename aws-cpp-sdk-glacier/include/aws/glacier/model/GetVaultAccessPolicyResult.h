@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/glacier/model/VaultAccessPolicy.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Output for GetVaultAccessPolicy.</p>
    */
-  class AWS_GLACIER_API GetVaultAccessPolicyResult
+  class AWS_GLACIER_API GetVaultAccessPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetVaultAccessPolicyResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the Amazon Glacier response to your request.</p>
    */
-  class AWS_GLACIER_API GetVaultLockResult
+  class AWS_GLACIER_API GetVaultLockResult : public AmazonWebServiceResultBase
   {
   public:
     GetVaultLockResult();
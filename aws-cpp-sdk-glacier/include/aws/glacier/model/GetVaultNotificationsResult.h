@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/glacier/model/VaultNotificationConfig.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the Amazon Glacier response to your request.</p>
    */
-  class AWS_GLACIER_API GetVaultNotificationsResult
+  class AWS_GLACIER_API GetVaultNotificationsResult : public AmazonWebServiceResultBase
   {
   public:
     GetVaultNotificationsResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     InitiateJobRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "InitiateJob"; }
+
     Aws::String SerializePayload() const override;
 
     /**
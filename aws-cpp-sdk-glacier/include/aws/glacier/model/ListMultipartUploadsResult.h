@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/glacier/Glacier_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/glacier/model/UploadListElement.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the Amazon Glacier response to your request.</p>
    */
-  class AWS_GLACIER_API ListMultipartUploadsResult
+  class AWS_GLACIER_API ListMultipartUploadsResult : public AmazonWebServiceResultBase
   {
   public:
     ListMultipartUploadsResult();
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     UploadArchiveRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UploadArchive"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     /**
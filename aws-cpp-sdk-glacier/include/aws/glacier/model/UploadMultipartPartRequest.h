@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     UploadMultipartPartRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UploadMultipartPart"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     /**
@@ -36,6 +36,7 @@ CompleteMultipartUploadResult::CompleteMultipartUploadResult(const AmazonWebServ
 
 CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
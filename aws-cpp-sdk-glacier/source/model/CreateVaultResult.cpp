@@ -36,6 +36,7 @@ CreateVaultResult::CreateVaultResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateVaultResult& CreateVaultResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
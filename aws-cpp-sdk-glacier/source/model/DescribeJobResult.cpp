@@ -41,6 +41,7 @@ DescribeJobResult::DescribeJobResult(const AmazonWebServiceResult<JsonValue>& re
 
 DescribeJobResult& DescribeJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("JobId"))
   {
@@ -39,6 +39,7 @@ DescribeVaultResult::DescribeVaultResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeVaultResult& DescribeVaultResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VaultARN"))
   {
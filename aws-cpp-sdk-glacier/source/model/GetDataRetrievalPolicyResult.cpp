@@ -35,6 +35,7 @@ GetDataRetrievalPolicyResult::GetDataRetrievalPolicyResult(const AmazonWebServic
 
 GetDataRetrievalPolicyResult& GetDataRetrievalPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Policy"))
   {
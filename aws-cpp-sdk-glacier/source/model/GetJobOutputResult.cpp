@@ -39,6 +39,7 @@ GetJobOutputResult::GetJobOutputResult(GetJobOutputResult&& toMove) :
     m_contentType(std::move(toMove.m_contentType)),
     m_archiveDescription(std::move(toMove.m_archiveDescription))
 {
+  SetRequestTimings(toMove.GetRequestTimings());
 }
 
 GetJobOutputResult& GetJobOutputResult::operator=(GetJobOutputResult&& toMove)
@@ -48,6 +49,7 @@ GetJobOutputResult& GetJobOutputResult::operator=(GetJobOutputResult&& toMove)
       return *this;
    }
 
+   SetRequestTimings(toMove.GetRequestTimings());
    m_body = std::move(toMove.m_body);
    m_checksum = std::move(toMove.m_checksum);
    m_status = toMove.m_status;
@@ -67,6 +69,7 @@ GetJobOutputResult::GetJobOutputResult(AmazonWebServiceResult<ResponseStream>&&
 
 GetJobOutputResult& GetJobOutputResult::operator =(AmazonWebServiceResult<ResponseStream>&& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   m_body = result.TakeOwnershipOfPayload();
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -35,6 +35,7 @@ GetVaultAccessPolicyResult::GetVaultAccessPolicyResult(const AmazonWebServiceRes
 
 GetVaultAccessPolicyResult& GetVaultAccessPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policy"))
   {
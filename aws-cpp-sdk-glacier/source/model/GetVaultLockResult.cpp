@@ -35,6 +35,7 @@ GetVaultLockResult::GetVaultLockResult(const AmazonWebServiceResult<JsonValue>&
 
 GetVaultLockResult& GetVaultLockResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Policy"))
   {
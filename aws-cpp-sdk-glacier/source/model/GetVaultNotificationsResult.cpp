@@ -35,6 +35,7 @@ GetVaultNotificationsResult::GetVaultNotificationsResult(const AmazonWebServiceR
 
 GetVaultNotificationsResult& GetVaultNotificationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("vaultNotificationConfig"))
   {
@@ -36,6 +36,7 @@ InitiateJobResult::InitiateJobResult(const AmazonWebServiceResult<JsonValue>& re
 
 InitiateJobResult& InitiateJobResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -36,6 +36,7 @@ InitiateMultipartUploadResult::InitiateMultipartUploadResult(const AmazonWebServ
 
 InitiateMultipartUploadResult& InitiateMultipartUploadResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -36,6 +36,7 @@ InitiateVaultLockResult::InitiateVaultLockResult(const AmazonWebServiceResult<Js
 
 InitiateVaultLockResult& InitiateVaultLockResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
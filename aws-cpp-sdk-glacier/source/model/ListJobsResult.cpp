@@ -35,6 +35,7 @@ ListJobsResult::ListJobsResult(const AmazonWebServiceResult<JsonValue>& result)
 
 ListJobsResult& ListJobsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("JobList"))
   {
@@ -35,6 +35,7 @@ ListMultipartUploadsResult::ListMultipartUploadsResult(const AmazonWebServiceRes
 
 ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UploadsList"))
   {
@@ -37,6 +37,7 @@ ListPartsResult::ListPartsResult(const AmazonWebServiceResult<JsonValue>& result
 
 ListPartsResult& ListPartsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MultipartUploadId"))
   {
@@ -35,6 +35,7 @@ ListTagsForVaultResult::ListTagsForVaultResult(const AmazonWebServiceResult<Json
 
 ListTagsForVaultResult& ListTagsForVaultResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Tags"))
   {
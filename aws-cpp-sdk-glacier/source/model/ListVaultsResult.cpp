@@ -35,6 +35,7 @@ ListVaultsResult::ListVaultsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListVaultsResult& ListVaultsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VaultList"))
   {
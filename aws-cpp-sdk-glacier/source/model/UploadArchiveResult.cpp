@@ -36,6 +36,7 @@ UploadArchiveResult::UploadArchiveResult(const AmazonWebServiceResult<JsonValue>
 
 UploadArchiveResult& UploadArchiveResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -36,6 +36,7 @@ UploadMultipartPartResult::UploadMultipartPartResult(const AmazonWebServiceResul
 
 UploadMultipartPartResult& UploadMultipartPartResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
   const auto& headers = result.GetHeaderValueCollection();
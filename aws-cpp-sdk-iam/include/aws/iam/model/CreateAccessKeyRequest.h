@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     CreateAccessKeyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateAccessKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/iam/model/Group.h>
 #include <aws/iam/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the response to a successful <a>CreateGroup</a> request. </p>
    */
-  class AWS_IAM_API CreateGroupResult
+  class AWS_IAM_API CreateGroupResult : public AmazonWebServiceResultBase
   {
   public:
     CreateGroupResult();
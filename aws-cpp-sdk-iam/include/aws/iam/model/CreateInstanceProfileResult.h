@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/iam/model/InstanceProfile.h>
 #include <aws/iam/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Contains the response to a successful <a>CreateInstanceProfile</a> request.
    * </p>
    */
-  class AWS_IAM_API CreateInstanceProfileResult
+  class AWS_IAM_API CreateInstanceProfileResult : public AmazonWebServiceResultBase
   {
   public:
     CreateInstanceProfileResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/iam/model/Role.h>
 #include <aws/iam/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the response to a successful <a>CreateRole</a> request. </p>
    */
-  class AWS_IAM_API CreateRoleResult
+  class AWS_IAM_API CreateRoleResult : public AmazonWebServiceResultBase
   {
   public:
     CreateRoleResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteGroupPolicyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteGroupPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
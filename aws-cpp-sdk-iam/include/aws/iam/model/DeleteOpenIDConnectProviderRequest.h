@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteOpenIDConnectProviderRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteOpenIDConnectProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
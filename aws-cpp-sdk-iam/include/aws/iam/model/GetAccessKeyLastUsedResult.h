@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iam/model/AccessKeyLastUsed.h>
 #include <aws/iam/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * is also returned as a member of the <a>AccessKeyMetaData</a> structure returned
    * by the <a>ListAccessKeys</a> action.</p>
    */
-  class AWS_IAM_API GetAccessKeyLastUsedResult
+  class AWS_IAM_API GetAccessKeyLastUsedResult : public AmazonWebServiceResultBase
   {
   public:
     GetAccessKeyLastUsedResult();
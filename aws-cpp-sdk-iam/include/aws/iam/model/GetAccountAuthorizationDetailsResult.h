@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iam/model/ResponseMetadata.h>
@@ -42,7 +43,7 @@ namespace Model
    * <p>Contains the response to a successful <a>GetAccountAuthorizationDetails</a>
    * request. </p>
    */
-  class AWS_IAM_API GetAccountAuthorizationDetailsResult
+  class AWS_IAM_API GetAccountAuthorizationDetailsResult : public AmazonWebServiceResultBase
   {
   public:
     GetAccountAuthorizationDetailsResult();
@@ -29,6 +29,10 @@ namespace Model
   {
   public:
     GetAccountPasswordPolicyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetAccountPasswordPolicy"; }
+
     Aws::String SerializePayload() const override;
 
   };
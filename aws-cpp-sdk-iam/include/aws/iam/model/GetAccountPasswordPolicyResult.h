@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/iam/model/PasswordPolicy.h>
 #include <aws/iam/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Contains the response to a successful <a>GetAccountPasswordPolicy</a>
    * request. </p>
    */
-  class AWS_IAM_API GetAccountPasswordPolicyResult
+  class AWS_IAM_API GetAccountPasswordPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetAccountPasswordPolicyResult();
@@ -29,6 +29,10 @@ namespace Model
   {
   public:
     GetAccountSummaryRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetAccountSummary"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/iam/model/ResponseMetadata.h>
 #include <aws/iam/model/SummaryKeyType.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the response to a successful <a>GetAccountSummary</a> request. </p>
    */
-  class AWS_IAM_API GetAccountSummaryResult
+  class AWS_IAM_API GetAccountSummaryResult : public AmazonWebServiceResultBase
   {
   public:
     GetAccountSummaryResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/iam/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains the response to a successful <a>GetContextKeysForPrincipalPolicy</a>
    * or <a>GetContextKeysForCustomPolicy</a> request. </p>
    */
-  class AWS_IAM_API GetContextKeysForCustomPolicyResult
+  class AWS_IAM_API GetContextKeysForCustomPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetContextKeysForCustomPolicyResult();
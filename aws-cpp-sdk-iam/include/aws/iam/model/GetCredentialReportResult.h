@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/Array.h>
 #include <aws/iam/model/ReportFormatType.h>
 #include <aws/iam/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains the response to a successful <a>GetCredentialReport</a> request.
    * </p>
    */
-  class AWS_IAM_API GetCredentialReportResult
+  class AWS_IAM_API GetCredentialReportResult : public AmazonWebServiceResultBase
   {
   public:
     GetCredentialReportResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/iam/model/Group.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * <p>Contains the response to a successful <a>GetGroup</a> request. </p>
    */
-  class AWS_IAM_API GetGroupResult
+  class AWS_IAM_API GetGroupResult : public AmazonWebServiceResultBase
   {
   public:
     GetGroupResult();
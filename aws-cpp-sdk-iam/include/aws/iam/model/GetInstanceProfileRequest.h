@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     GetInstanceProfileRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetInstanceProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     GetLoginProfileRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetLoginProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/iam/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains the response to a successful <a>GetOpenIDConnectProvider</a>
    * request. </p>
    */
-  class AWS_IAM_API GetOpenIDConnectProviderResult
+  class AWS_IAM_API GetOpenIDConnectProviderResult : public AmazonWebServiceResultBase
   {
   public:
     GetOpenIDConnectProviderResult();
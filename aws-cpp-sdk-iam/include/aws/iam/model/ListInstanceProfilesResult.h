@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iam/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p>Contains the response to a successful <a>ListInstanceProfiles</a> request.
    * </p>
    */
-  class AWS_IAM_API ListInstanceProfilesResult
+  class AWS_IAM_API ListInstanceProfilesResult : public AmazonWebServiceResultBase
   {
   public:
     ListInstanceProfilesResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     ListMFADevicesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListMFADevices"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,10 @@ namespace Model
   {
   public:
     ListOpenIDConnectProvidersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListOpenIDConnectProviders"; }
+
     Aws::String SerializePayload() const override;
 
   };
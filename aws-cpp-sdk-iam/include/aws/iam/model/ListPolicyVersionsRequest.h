@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     ListPolicyVersionsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListPolicyVersions"; }
+
     Aws::String SerializePayload() const override;
 
     
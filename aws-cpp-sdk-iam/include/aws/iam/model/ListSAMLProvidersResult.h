@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iam/IAM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/iam/model/ResponseMetadata.h>
 #include <aws/iam/model/SAMLProviderListEntry.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the response to a successful <a>ListSAMLProviders</a> request. </p>
    */
-  class AWS_IAM_API ListSAMLProvidersResult
+  class AWS_IAM_API ListSAMLProvidersResult : public AmazonWebServiceResultBase
   {
   public:
     ListSAMLProvidersResult();
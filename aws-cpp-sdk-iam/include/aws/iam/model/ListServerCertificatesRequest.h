@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     ListServerCertificatesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListServerCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     UpdateSAMLProviderRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UpdateSAMLProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -37,6 +37,7 @@ CreateGroupResult::CreateGroupResult(const AmazonWebServiceResult<XmlDocument>&
 
 CreateGroupResult& CreateGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
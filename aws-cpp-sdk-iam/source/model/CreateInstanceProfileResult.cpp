@@ -37,6 +37,7 @@ CreateInstanceProfileResult::CreateInstanceProfileResult(const AmazonWebServiceR
 
 CreateInstanceProfileResult& CreateInstanceProfileResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
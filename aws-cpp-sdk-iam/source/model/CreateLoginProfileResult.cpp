@@ -37,6 +37,7 @@ CreateLoginProfileResult::CreateLoginProfileResult(const AmazonWebServiceResult<
 
 CreateLoginProfileResult& CreateLoginProfileResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
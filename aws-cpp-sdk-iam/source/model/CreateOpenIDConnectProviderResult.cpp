@@ -37,6 +37,7 @@ CreateOpenIDConnectProviderResult::CreateOpenIDConnectProviderResult(const Amazo
 
 CreateOpenIDConnectProviderResult& CreateOpenIDConnectProviderResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreatePolicyResult::CreatePolicyResult(const AmazonWebServiceResult<XmlDocument>
 
 CreatePolicyResult& CreatePolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreatePolicyVersionResult::CreatePolicyVersionResult(const AmazonWebServiceResul
 
 CreatePolicyVersionResult& CreatePolicyVersionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateRoleResult::CreateRoleResult(const AmazonWebServiceResult<XmlDocument>& re
 
 CreateRoleResult& CreateRoleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
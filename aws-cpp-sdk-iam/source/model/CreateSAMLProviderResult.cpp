@@ -37,6 +37,7 @@ CreateSAMLProviderResult::CreateSAMLProviderResult(const AmazonWebServiceResult<
 
 CreateSAMLProviderResult& CreateSAMLProviderResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
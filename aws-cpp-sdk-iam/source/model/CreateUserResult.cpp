@@ -37,6 +37,7 @@ CreateUserResult::CreateUserResult(const AmazonWebServiceResult<XmlDocument>& re
 
 CreateUserResult& CreateUserResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
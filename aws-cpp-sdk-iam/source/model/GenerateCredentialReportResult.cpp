@@ -37,6 +37,7 @@ GenerateCredentialReportResult::GenerateCredentialReportResult(const AmazonWebSe
 
 GenerateCredentialReportResult& GenerateCredentialReportResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ GetAccountAuthorizationDetailsResult::GetAccountAuthorizationDetailsResult(const
 
 GetAccountAuthorizationDetailsResult& GetAccountAuthorizationDetailsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetAccountPasswordPolicyResult::GetAccountPasswordPolicyResult(const AmazonWebSe
 
 GetAccountPasswordPolicyResult& GetAccountPasswordPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
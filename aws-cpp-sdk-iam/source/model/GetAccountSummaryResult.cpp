@@ -37,6 +37,7 @@ GetAccountSummaryResult::GetAccountSummaryResult(const AmazonWebServiceResult<Xm
 
 GetAccountSummaryResult& GetAccountSummaryResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
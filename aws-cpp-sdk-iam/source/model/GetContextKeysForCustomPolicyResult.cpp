@@ -37,6 +37,7 @@ GetContextKeysForCustomPolicyResult::GetContextKeysForCustomPolicyResult(const A
 
 GetContextKeysForCustomPolicyResult& GetContextKeysForCustomPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
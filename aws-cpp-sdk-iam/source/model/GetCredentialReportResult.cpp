@@ -40,6 +40,7 @@ GetCredentialReportResult::GetCredentialReportResult(const AmazonWebServiceResul
 
 GetCredentialReportResult& GetCredentialReportResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
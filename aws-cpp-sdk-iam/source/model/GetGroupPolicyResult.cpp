@@ -37,6 +37,7 @@ GetGroupPolicyResult::GetGroupPolicyResult(const AmazonWebServiceResult<XmlDocum
 
 GetGroupPolicyResult& GetGroupPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ GetGroupResult::GetGroupResult(const AmazonWebServiceResult<XmlDocument>& result
 
 GetGroupResult& GetGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
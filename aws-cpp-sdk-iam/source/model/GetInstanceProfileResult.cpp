@@ -37,6 +37,7 @@ GetInstanceProfileResult::GetInstanceProfileResult(const AmazonWebServiceResult<
 
 GetInstanceProfileResult& GetInstanceProfileResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetLoginProfileResult::GetLoginProfileResult(const AmazonWebServiceResult<XmlDoc
 
 GetLoginProfileResult& GetLoginProfileResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
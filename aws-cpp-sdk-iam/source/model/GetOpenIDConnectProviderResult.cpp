@@ -39,6 +39,7 @@ GetOpenIDConnectProviderResult::GetOpenIDConnectProviderResult(const AmazonWebSe
 
 GetOpenIDConnectProviderResult& GetOpenIDConnectProviderResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetPolicyResult::GetPolicyResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 GetPolicyResult& GetPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetPolicyVersionResult::GetPolicyVersionResult(const AmazonWebServiceResult<XmlD
 
 GetPolicyVersionResult& GetPolicyVersionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetRoleResult::GetRoleResult(const AmazonWebServiceResult<XmlDocument>& result)
 
 GetRoleResult& GetRoleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
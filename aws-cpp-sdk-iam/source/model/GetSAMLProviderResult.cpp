@@ -41,6 +41,7 @@ GetSAMLProviderResult::GetSAMLProviderResult(const AmazonWebServiceResult<XmlDoc
 
 GetSAMLProviderResult& GetSAMLProviderResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
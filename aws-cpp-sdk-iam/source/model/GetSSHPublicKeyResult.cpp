@@ -37,6 +37,7 @@ GetSSHPublicKeyResult::GetSSHPublicKeyResult(const AmazonWebServiceResult<XmlDoc
 
 GetSSHPublicKeyResult& GetSSHPublicKeyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetUserResult::GetUserResult(const AmazonWebServiceResult<XmlDocument>& result)
 
 GetUserResult& GetUserResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListAccessKeysResult::ListAccessKeysResult(const AmazonWebServiceResult<XmlDocum
 
 ListAccessKeysResult& ListAccessKeysResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListAccountAliasesResult::ListAccountAliasesResult(const AmazonWebServiceResult<
 
 ListAccountAliasesResult& ListAccountAliasesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListAttachedGroupPoliciesResult::ListAttachedGroupPoliciesResult(const AmazonWeb
 
 ListAttachedGroupPoliciesResult& ListAttachedGroupPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListAttachedRolePoliciesResult::ListAttachedRolePoliciesResult(const AmazonWebSe
 
 ListAttachedRolePoliciesResult& ListAttachedRolePoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
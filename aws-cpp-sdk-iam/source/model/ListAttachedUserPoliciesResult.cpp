@@ -39,6 +39,7 @@ ListAttachedUserPoliciesResult::ListAttachedUserPoliciesResult(const AmazonWebSe
 
 ListAttachedUserPoliciesResult& ListAttachedUserPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListEntitiesForPolicyResult::ListEntitiesForPolicyResult(const AmazonWebServiceR
 
 ListEntitiesForPolicyResult& ListEntitiesForPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListGroupPoliciesResult::ListGroupPoliciesResult(const AmazonWebServiceResult<Xm
 
 ListGroupPoliciesResult& ListGroupPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
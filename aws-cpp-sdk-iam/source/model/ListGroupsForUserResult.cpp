@@ -39,6 +39,7 @@ ListGroupsForUserResult::ListGroupsForUserResult(const AmazonWebServiceResult<Xm
 
 ListGroupsForUserResult& ListGroupsForUserResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
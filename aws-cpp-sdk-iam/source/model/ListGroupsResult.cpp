@@ -39,6 +39,7 @@ ListGroupsResult::ListGroupsResult(const AmazonWebServiceResult<XmlDocument>& re
 
 ListGroupsResult& ListGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
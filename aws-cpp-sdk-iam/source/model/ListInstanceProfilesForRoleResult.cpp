@@ -39,6 +39,7 @@ ListInstanceProfilesForRoleResult::ListInstanceProfilesForRoleResult(const Amazo
 
 ListInstanceProfilesForRoleResult& ListInstanceProfilesForRoleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
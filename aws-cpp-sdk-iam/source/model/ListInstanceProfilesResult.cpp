@@ -39,6 +39,7 @@ ListInstanceProfilesResult::ListInstanceProfilesResult(const AmazonWebServiceRes
 
 ListInstanceProfilesResult& ListInstanceProfilesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
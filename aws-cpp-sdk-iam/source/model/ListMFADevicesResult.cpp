@@ -39,6 +39,7 @@ ListMFADevicesResult::ListMFADevicesResult(const AmazonWebServiceResult<XmlDocum
 
 ListMFADevicesResult& ListMFADevicesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
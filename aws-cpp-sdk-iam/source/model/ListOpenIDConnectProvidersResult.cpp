@@ -37,6 +37,7 @@ ListOpenIDConnectProvidersResult::ListOpenIDConnectProvidersResult(const AmazonW
 
 ListOpenIDConnectProvidersResult& ListOpenIDConnectProvidersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
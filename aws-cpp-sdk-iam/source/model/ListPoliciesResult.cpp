@@ -39,6 +39,7 @@ ListPoliciesResult::ListPoliciesResult(const AmazonWebServiceResult<XmlDocument>
 
 ListPoliciesResult& ListPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
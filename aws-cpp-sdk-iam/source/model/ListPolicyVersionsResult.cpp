@@ -39,6 +39,7 @@ ListPolicyVersionsResult::ListPolicyVersionsResult(const AmazonWebServiceResult<
 
 ListPolicyVersionsResult& ListPolicyVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListRolePoliciesResult::ListRolePoliciesResult(const AmazonWebServiceResult<XmlD
 
 ListRolePoliciesResult& ListRolePoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
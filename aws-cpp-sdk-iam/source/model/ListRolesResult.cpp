@@ -39,6 +39,7 @@ ListRolesResult::ListRolesResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 ListRolesResult& ListRolesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
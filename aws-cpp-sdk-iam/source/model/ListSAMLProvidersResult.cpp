@@ -37,6 +37,7 @@ ListSAMLProvidersResult::ListSAMLProvidersResult(const AmazonWebServiceResult<Xm
 
 ListSAMLProvidersResult& ListSAMLProvidersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
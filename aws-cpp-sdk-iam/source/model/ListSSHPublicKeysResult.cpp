@@ -39,6 +39,7 @@ ListSSHPublicKeysResult::ListSSHPublicKeysResult(const AmazonWebServiceResult<Xm
 
 ListSSHPublicKeysResult& ListSSHPublicKeysResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListSigningCertificatesResult::ListSigningCertificatesResult(const AmazonWebServ
 
 ListSigningCertificatesResult& ListSigningCertificatesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
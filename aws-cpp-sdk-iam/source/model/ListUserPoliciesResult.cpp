@@ -39,6 +39,7 @@ ListUserPoliciesResult::ListUserPoliciesResult(const AmazonWebServiceResult<XmlD
 
 ListUserPoliciesResult& ListUserPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ ListUsersResult::ListUsersResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 ListUsersResult& ListUsersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
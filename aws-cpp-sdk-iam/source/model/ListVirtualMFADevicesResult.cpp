@@ -39,6 +39,7 @@ ListVirtualMFADevicesResult::ListVirtualMFADevicesResult(const AmazonWebServiceR
 
 ListVirtualMFADevicesResult& ListVirtualMFADevicesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ SimulateCustomPolicyResult::SimulateCustomPolicyResult(const AmazonWebServiceRes
 
 SimulateCustomPolicyResult& SimulateCustomPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ SimulatePrincipalPolicyResult::SimulatePrincipalPolicyResult(const AmazonWebServ
 
 SimulatePrincipalPolicyResult& SimulatePrincipalPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
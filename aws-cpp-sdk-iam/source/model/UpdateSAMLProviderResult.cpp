@@ -37,6 +37,7 @@ UpdateSAMLProviderResult::UpdateSAMLProviderResult(const AmazonWebServiceResult<
 
 UpdateSAMLProviderResult& UpdateSAMLProviderResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
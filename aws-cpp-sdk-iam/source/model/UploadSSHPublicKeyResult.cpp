@@ -37,6 +37,7 @@ UploadSSHPublicKeyResult::UploadSSHPublicKeyResult(const AmazonWebServiceResult<
 
 UploadSSHPublicKeyResult& UploadSSHPublicKeyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
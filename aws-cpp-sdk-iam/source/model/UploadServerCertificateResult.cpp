@@ -37,6 +37,7 @@ UploadServerCertificateResult::UploadServerCertificateResult(const AmazonWebServ
 
 UploadServerCertificateResult& UploadServerCertificateResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
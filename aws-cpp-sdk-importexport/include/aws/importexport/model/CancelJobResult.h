@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/importexport/ImportExport_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/importexport/model/ResponseMetadata.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * Output structure for the CancelJob operation.
    */
-  class AWS_IMPORTEXPORT_API CancelJobResult
+  class AWS_IMPORTEXPORT_API CancelJobResult : public AmazonWebServiceResultBase
   {
   public:
     CancelJobResult();
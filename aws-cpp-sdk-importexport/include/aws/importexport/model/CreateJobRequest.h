@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     CreateJobRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateJob"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/importexport/ImportExport_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/importexport/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace ImportExport
 {
 namespace Model
 {
-  class AWS_IMPORTEXPORT_API GetShippingLabelResult
+  class AWS_IMPORTEXPORT_API GetShippingLabelResult : public AmazonWebServiceResultBase
   {
   public:
     GetShippingLabelResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/importexport/ImportExport_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/importexport/model/JobType.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -39,7 +40,7 @@ namespace Model
   /**
    * Output structure for the GetStatus operation.
    */
-  class AWS_IMPORTEXPORT_API GetStatusResult
+  class AWS_IMPORTEXPORT_API GetStatusResult : public AmazonWebServiceResultBase
   {
   public:
     GetStatusResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/importexport/ImportExport_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/importexport/model/ResponseMetadata.h>
 #include <aws/importexport/model/Job.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * Output structure for the ListJobs operation.
    */
-  class AWS_IMPORTEXPORT_API ListJobsResult
+  class AWS_IMPORTEXPORT_API ListJobsResult : public AmazonWebServiceResultBase
   {
   public:
     ListJobsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/importexport/ImportExport_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/importexport/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * Output structure for the UpateJob operation.
    */
-  class AWS_IMPORTEXPORT_API UpdateJobResult
+  class AWS_IMPORTEXPORT_API UpdateJobResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateJobResult();
@@ -39,6 +39,7 @@ CancelJobResult::CancelJobResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 CancelJobResult& CancelJobResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
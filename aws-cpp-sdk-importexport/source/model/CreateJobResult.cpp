@@ -37,6 +37,7 @@ CreateJobResult::CreateJobResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 CreateJobResult& CreateJobResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetShippingLabelResult::GetShippingLabelResult(const AmazonWebServiceResult<XmlD
 
 GetShippingLabelResult& GetShippingLabelResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
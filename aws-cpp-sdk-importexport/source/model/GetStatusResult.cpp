@@ -41,6 +41,7 @@ GetStatusResult::GetStatusResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 GetStatusResult& GetStatusResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
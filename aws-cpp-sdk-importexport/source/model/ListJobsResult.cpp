@@ -39,6 +39,7 @@ ListJobsResult::ListJobsResult(const AmazonWebServiceResult<XmlDocument>& result
 
 ListJobsResult& ListJobsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ UpdateJobResult::UpdateJobResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 UpdateJobResult& UpdateJobResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
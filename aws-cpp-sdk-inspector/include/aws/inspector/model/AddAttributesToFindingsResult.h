@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/inspector/Inspector_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace Inspector
 {
 namespace Model
 {
-  class AWS_INSPECTOR_API AddAttributesToFindingsResult
+  class AWS_INSPECTOR_API AddAttributesToFindingsResult : public AmazonWebServiceResultBase
   {
   public:
     AddAttributesToFindingsResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     AttachAssessmentAndRulesPackageRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "AttachAssessmentAndRulesPackage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/inspector/Inspector_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/inspector/model/Telemetry.h>
 
@@ -33,7 +34,7 @@ namespace Inspector
 {
 namespace Model
 {
-  class AWS_INSPECTOR_API GetAssessmentTelemetryResult
+  class AWS_INSPECTOR_API GetAssessmentTelemetryResult : public AmazonWebServiceResultBase
   {
   public:
     GetAssessmentTelemetryResult();
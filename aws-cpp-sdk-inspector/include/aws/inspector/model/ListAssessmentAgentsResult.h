@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/inspector/Inspector_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/inspector/model/Agent.h>
@@ -34,7 +35,7 @@ namespace Inspector
 {
 namespace Model
 {
-  class AWS_INSPECTOR_API ListAssessmentAgentsResult
+  class AWS_INSPECTOR_API ListAssessmentAgentsResult : public AmazonWebServiceResultBase
   {
   public:
     ListAssessmentAgentsResult();
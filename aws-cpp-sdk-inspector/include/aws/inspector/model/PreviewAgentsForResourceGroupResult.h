@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/inspector/Inspector_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/inspector/model/AgentPreview.h>
@@ -34,7 +35,7 @@ namespace Inspector
 {
 namespace Model
 {
-  class AWS_INSPECTOR_API PreviewAgentsForResourceGroupResult
+  class AWS_INSPECTOR_API PreviewAgentsForResourceGroupResult : public AmazonWebServiceResultBase
   {
   public:
     PreviewAgentsForResourceGroupResult();
@@ -35,6 +35,7 @@ AddAttributesToFindingsResult::AddAttributesToFindingsResult(const AmazonWebServ
 
 AddAttributesToFindingsResult& AddAttributesToFindingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ AttachAssessmentAndRulesPackageResult::AttachAssessmentAndRulesPackageResult(con
 
 AttachAssessmentAndRulesPackageResult& AttachAssessmentAndRulesPackageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ CreateAssessmentResult::CreateAssessmentResult(const AmazonWebServiceResult<Json
 
 CreateAssessmentResult& CreateAssessmentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("assessmentArn"))
   {
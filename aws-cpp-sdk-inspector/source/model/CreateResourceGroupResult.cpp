@@ -35,6 +35,7 @@ CreateResourceGroupResult::CreateResourceGroupResult(const AmazonWebServiceResul
 
 CreateResourceGroupResult& CreateResourceGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("resourceGroupArn"))
   {
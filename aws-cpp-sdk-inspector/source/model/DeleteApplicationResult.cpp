@@ -35,6 +35,7 @@ DeleteApplicationResult::DeleteApplicationResult(const AmazonWebServiceResult<Js
 
 DeleteApplicationResult& DeleteApplicationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
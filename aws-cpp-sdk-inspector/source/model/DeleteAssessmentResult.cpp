@@ -35,6 +35,7 @@ DeleteAssessmentResult::DeleteAssessmentResult(const AmazonWebServiceResult<Json
 
 DeleteAssessmentResult& DeleteAssessmentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ DeleteRunResult::DeleteRunResult(const AmazonWebServiceResult<JsonValue>& result
 
 DeleteRunResult& DeleteRunResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ DescribeApplicationResult::DescribeApplicationResult(const AmazonWebServiceResul
 
 DescribeApplicationResult& DescribeApplicationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("application"))
   {
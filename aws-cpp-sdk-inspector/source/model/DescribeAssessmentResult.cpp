@@ -35,6 +35,7 @@ DescribeAssessmentResult::DescribeAssessmentResult(const AmazonWebServiceResult<
 
 DescribeAssessmentResult& DescribeAssessmentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("assessment"))
   {
@@ -37,6 +37,7 @@ DescribeCrossAccountAccessRoleResult::DescribeCrossAccountAccessRoleResult(const
 
 DescribeCrossAccountAccessRoleResult& DescribeCrossAccountAccessRoleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("roleArn"))
   {
@@ -35,6 +35,7 @@ DescribeFindingResult::DescribeFindingResult(const AmazonWebServiceResult<JsonVa
 
 DescribeFindingResult& DescribeFindingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("finding"))
   {
@@ -35,6 +35,7 @@ DescribeResourceGroupResult::DescribeResourceGroupResult(const AmazonWebServiceR
 
 DescribeResourceGroupResult& DescribeResourceGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("resourceGroup"))
   {
@@ -35,6 +35,7 @@ DescribeRulesPackageResult::DescribeRulesPackageResult(const AmazonWebServiceRes
 
 DescribeRulesPackageResult& DescribeRulesPackageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("rulesPackage"))
   {
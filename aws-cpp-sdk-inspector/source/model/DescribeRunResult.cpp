@@ -35,6 +35,7 @@ DescribeRunResult::DescribeRunResult(const AmazonWebServiceResult<JsonValue>& re
 
 DescribeRunResult& DescribeRunResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("run"))
   {
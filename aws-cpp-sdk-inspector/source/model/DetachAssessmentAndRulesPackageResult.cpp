@@ -35,6 +35,7 @@ DetachAssessmentAndRulesPackageResult::DetachAssessmentAndRulesPackageResult(con
 
 DetachAssessmentAndRulesPackageResult& DetachAssessmentAndRulesPackageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ GetAssessmentTelemetryResult::GetAssessmentTelemetryResult(const AmazonWebServic
 
 GetAssessmentTelemetryResult& GetAssessmentTelemetryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("telemetry"))
   {
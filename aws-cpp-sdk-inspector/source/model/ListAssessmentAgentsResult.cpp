@@ -35,6 +35,7 @@ ListAssessmentAgentsResult::ListAssessmentAgentsResult(const AmazonWebServiceRes
 
 ListAssessmentAgentsResult& ListAssessmentAgentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("agentList"))
   {
@@ -35,6 +35,7 @@ ListAssessmentsResult::ListAssessmentsResult(const AmazonWebServiceResult<JsonVa
 
 ListAssessmentsResult& ListAssessmentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("assessmentArnList"))
   {
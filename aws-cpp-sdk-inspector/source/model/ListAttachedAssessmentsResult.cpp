@@ -35,6 +35,7 @@ ListAttachedAssessmentsResult::ListAttachedAssessmentsResult(const AmazonWebServ
 
 ListAttachedAssessmentsResult& ListAttachedAssessmentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("assessmentArnList"))
   {
@@ -35,6 +35,7 @@ ListAttachedRulesPackagesResult::ListAttachedRulesPackagesResult(const AmazonWeb
 
 ListAttachedRulesPackagesResult& ListAttachedRulesPackagesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("rulesPackageArnList"))
   {
@@ -35,6 +35,7 @@ ListFindingsResult::ListFindingsResult(const AmazonWebServiceResult<JsonValue>&
 
 ListFindingsResult& ListFindingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("findingArnList"))
   {
@@ -35,6 +35,7 @@ ListRulesPackagesResult::ListRulesPackagesResult(const AmazonWebServiceResult<Js
 
 ListRulesPackagesResult& ListRulesPackagesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("rulesPackageArnList"))
   {
@@ -35,6 +35,7 @@ ListRunsResult::ListRunsResult(const AmazonWebServiceResult<JsonValue>& result)
 
 ListRunsResult& ListRunsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("runArnList"))
   {
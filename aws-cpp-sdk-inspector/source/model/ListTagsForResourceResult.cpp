@@ -35,6 +35,7 @@ ListTagsForResourceResult::ListTagsForResourceResult(const AmazonWebServiceResul
 
 ListTagsForResourceResult& ListTagsForResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("tagList"))
   {
@@ -35,6 +35,7 @@ LocalizeTextResult::LocalizeTextResult(const AmazonWebServiceResult<JsonValue>&
 
 LocalizeTextResult& LocalizeTextResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ PreviewAgentsForResourceGroupResult::PreviewAgentsForResourceGroupResult(const A
 
 PreviewAgentsForResourceGroupResult& PreviewAgentsForResourceGroupResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("agentPreviewList"))
   {
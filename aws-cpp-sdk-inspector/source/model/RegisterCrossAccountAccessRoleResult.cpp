@@ -35,6 +35,7 @@ RegisterCrossAccountAccessRoleResult::RegisterCrossAccountAccessRoleResult(const
 
 RegisterCrossAccountAccessRoleResult& RegisterCrossAccountAccessRoleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
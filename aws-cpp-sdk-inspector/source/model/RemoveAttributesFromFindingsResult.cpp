@@ -35,6 +35,7 @@ RemoveAttributesFromFindingsResult::RemoveAttributesFromFindingsResult(const Ama
 
 RemoveAttributesFromFindingsResult& RemoveAttributesFromFindingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ RunAssessmentResult::RunAssessmentResult(const AmazonWebServiceResult<JsonValue>
 
 RunAssessmentResult& RunAssessmentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("runArn"))
   {
@@ -35,6 +35,7 @@ SetTagsForResourceResult::SetTagsForResourceResult(const AmazonWebServiceResult<
 
 SetTagsForResourceResult& SetTagsForResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
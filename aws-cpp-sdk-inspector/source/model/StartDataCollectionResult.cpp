@@ -35,6 +35,7 @@ StartDataCollectionResult::StartDataCollectionResult(const AmazonWebServiceResul
 
 StartDataCollectionResult& StartDataCollectionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ StopDataCollectionResult::StopDataCollectionResult(const AmazonWebServiceResult<
 
 StopDataCollectionResult& StopDataCollectionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -35,6 +35,7 @@ UpdateApplicationResult::UpdateApplicationResult(const AmazonWebServiceResult<Js
 
 UpdateApplicationResult& UpdateApplicationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
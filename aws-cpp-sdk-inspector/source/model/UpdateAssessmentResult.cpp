@@ -35,6 +35,7 @@ UpdateAssessmentResult::UpdateAssessmentResult(const AmazonWebServiceResult<Json
 
 UpdateAssessmentResult& UpdateAssessmentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("message"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iot/model/KeyPair.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output of the CreateKeysAndCertificate operation.</p>
    */
-  class AWS_IOT_API CreateKeysAndCertificateResult
+  class AWS_IOT_API CreateKeysAndCertificateResult : public AmazonWebServiceResultBase
   {
   public:
     CreateKeysAndCertificateResult();
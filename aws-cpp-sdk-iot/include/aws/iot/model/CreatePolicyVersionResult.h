@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The output of the CreatePolicyVersion operation.</p>
    */
-  class AWS_IOT_API CreatePolicyVersionResult
+  class AWS_IOT_API CreatePolicyVersionResult : public AmazonWebServiceResultBase
   {
   public:
     CreatePolicyVersionResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/iot/model/CertificateDescription.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The output of the DescribeCertificate operation.</p>
    */
-  class AWS_IOT_API DescribeCertificateResult
+  class AWS_IOT_API DescribeCertificateResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeCertificateResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DescribeEndpointRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
   };
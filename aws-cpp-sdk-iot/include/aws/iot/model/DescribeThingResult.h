@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output from the DescribeThing operation.</p>
    */
-  class AWS_IOT_API DescribeThingResult
+  class AWS_IOT_API DescribeThingResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeThingResult();
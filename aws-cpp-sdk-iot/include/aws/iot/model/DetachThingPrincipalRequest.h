@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     DetachThingPrincipalRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DetachThingPrincipal"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>The output from the DetachThingPrincipal operation.</p>
    */
-  class AWS_IOT_API DetachThingPrincipalResult
+  class AWS_IOT_API DetachThingPrincipalResult : public AmazonWebServiceResultBase
   {
   public:
     DetachThingPrincipalResult();
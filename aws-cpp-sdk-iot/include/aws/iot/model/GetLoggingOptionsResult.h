@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iot/model/LogLevel.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output from the GetLoggingOptions operation.</p>
    */
-  class AWS_IOT_API GetLoggingOptionsResult
+  class AWS_IOT_API GetLoggingOptionsResult : public AmazonWebServiceResultBase
   {
   public:
     GetLoggingOptionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The output from the GetPolicy operation.</p>
    */
-  class AWS_IOT_API GetPolicyResult
+  class AWS_IOT_API GetPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetPolicyResult();
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     GetPolicyVersionRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetPolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
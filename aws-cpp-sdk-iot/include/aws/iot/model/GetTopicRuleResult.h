@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iot/model/TopicRule.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output from the GetTopicRule operation.</p>
    */
-  class AWS_IOT_API GetTopicRuleResult
+  class AWS_IOT_API GetTopicRuleResult : public AmazonWebServiceResultBase
   {
   public:
     GetTopicRuleResult();
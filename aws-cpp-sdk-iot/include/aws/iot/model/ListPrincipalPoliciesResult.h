@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/iot/model/Policy.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The output from the ListPrincipalPolicies operation.</p>
    */
-  class AWS_IOT_API ListPrincipalPoliciesResult
+  class AWS_IOT_API ListPrincipalPoliciesResult : public AmazonWebServiceResultBase
   {
   public:
     ListPrincipalPoliciesResult();
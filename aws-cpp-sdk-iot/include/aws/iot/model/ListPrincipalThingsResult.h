@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output from the ListPrincipalThings operation.</p>
    */
-  class AWS_IOT_API ListPrincipalThingsResult
+  class AWS_IOT_API ListPrincipalThingsResult : public AmazonWebServiceResultBase
   {
   public:
     ListPrincipalThingsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The output from the ListThingPrincipals operation.</p>
    */
-  class AWS_IOT_API ListThingPrincipalsResult
+  class AWS_IOT_API ListThingPrincipalsResult : public AmazonWebServiceResultBase
   {
   public:
     ListThingPrincipalsResult();
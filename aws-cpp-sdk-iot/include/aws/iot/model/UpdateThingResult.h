@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/iot/IoT_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>The output from the UpdateThing operation.</p>
    */
-  class AWS_IOT_API UpdateThingResult
+  class AWS_IOT_API UpdateThingResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateThingResult();
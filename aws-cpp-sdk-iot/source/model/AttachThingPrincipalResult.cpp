@@ -35,6 +35,7 @@ AttachThingPrincipalResult::AttachThingPrincipalResult(const AmazonWebServiceRes
 
 AttachThingPrincipalResult& AttachThingPrincipalResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ CreateCertificateFromCsrResult::CreateCertificateFromCsrResult(const AmazonWebSe
 
 CreateCertificateFromCsrResult& CreateCertificateFromCsrResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("certificateArn"))
   {
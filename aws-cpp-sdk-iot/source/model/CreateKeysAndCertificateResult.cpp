@@ -35,6 +35,7 @@ CreateKeysAndCertificateResult::CreateKeysAndCertificateResult(const AmazonWebSe
 
 CreateKeysAndCertificateResult& CreateKeysAndCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("certificateArn"))
   {
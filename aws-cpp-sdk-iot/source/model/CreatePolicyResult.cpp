@@ -35,6 +35,7 @@ CreatePolicyResult::CreatePolicyResult(const AmazonWebServiceResult<JsonValue>&
 
 CreatePolicyResult& CreatePolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policyName"))
   {
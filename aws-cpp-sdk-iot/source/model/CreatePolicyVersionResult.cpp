@@ -37,6 +37,7 @@ CreatePolicyVersionResult::CreatePolicyVersionResult(const AmazonWebServiceResul
 
 CreatePolicyVersionResult& CreatePolicyVersionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policyArn"))
   {
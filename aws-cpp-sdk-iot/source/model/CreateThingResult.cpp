@@ -35,6 +35,7 @@ CreateThingResult::CreateThingResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateThingResult& CreateThingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("thingName"))
   {
@@ -35,6 +35,7 @@ DeleteThingResult::DeleteThingResult(const AmazonWebServiceResult<JsonValue>& re
 
 DeleteThingResult& DeleteThingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
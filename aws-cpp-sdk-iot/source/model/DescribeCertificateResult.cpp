@@ -35,6 +35,7 @@ DescribeCertificateResult::DescribeCertificateResult(const AmazonWebServiceResul
 
 DescribeCertificateResult& DescribeCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("certificateDescription"))
   {
@@ -35,6 +35,7 @@ DescribeEndpointResult::DescribeEndpointResult(const AmazonWebServiceResult<Json
 
 DescribeEndpointResult& DescribeEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("endpointAddress"))
   {
@@ -35,6 +35,7 @@ DescribeThingResult::DescribeThingResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeThingResult& DescribeThingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("defaultClientId"))
   {
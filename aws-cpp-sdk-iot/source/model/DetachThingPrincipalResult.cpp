@@ -35,6 +35,7 @@ DetachThingPrincipalResult::DetachThingPrincipalResult(const AmazonWebServiceRes
 
 DetachThingPrincipalResult& DetachThingPrincipalResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
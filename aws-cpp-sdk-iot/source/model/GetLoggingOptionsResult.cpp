@@ -35,6 +35,7 @@ GetLoggingOptionsResult::GetLoggingOptionsResult(const AmazonWebServiceResult<Js
 
 GetLoggingOptionsResult& GetLoggingOptionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("roleArn"))
   {
@@ -37,6 +37,7 @@ GetPolicyVersionResult::GetPolicyVersionResult(const AmazonWebServiceResult<Json
 
 GetPolicyVersionResult& GetPolicyVersionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policyArn"))
   {
@@ -35,6 +35,7 @@ GetTopicRuleResult::GetTopicRuleResult(const AmazonWebServiceResult<JsonValue>&
 
 GetTopicRuleResult& GetTopicRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ruleArn"))
   {
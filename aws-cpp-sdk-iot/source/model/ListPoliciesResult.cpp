@@ -35,6 +35,7 @@ ListPoliciesResult::ListPoliciesResult(const AmazonWebServiceResult<JsonValue>&
 
 ListPoliciesResult& ListPoliciesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policies"))
   {
@@ -35,6 +35,7 @@ ListPolicyVersionsResult::ListPolicyVersionsResult(const AmazonWebServiceResult<
 
 ListPolicyVersionsResult& ListPolicyVersionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policyVersions"))
   {
@@ -35,6 +35,7 @@ ListPrincipalPoliciesResult::ListPrincipalPoliciesResult(const AmazonWebServiceR
 
 ListPrincipalPoliciesResult& ListPrincipalPoliciesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("policies"))
   {
@@ -35,6 +35,7 @@ ListPrincipalThingsResult::ListPrincipalThingsResult(const AmazonWebServiceResul
 
 ListPrincipalThingsResult& ListPrincipalThingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("things"))
   {
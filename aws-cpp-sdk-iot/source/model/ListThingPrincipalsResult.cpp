@@ -35,6 +35,7 @@ ListThingPrincipalsResult::ListThingPrincipalsResult(const AmazonWebServiceResul
 
 ListThingPrincipalsResult& ListThingPrincipalsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("principals"))
   {
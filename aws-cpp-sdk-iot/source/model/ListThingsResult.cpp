@@ -35,6 +35,7 @@ ListThingsResult::ListThingsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListThingsResult& ListThingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("things"))
   {
@@ -35,6 +35,7 @@ ListTopicRulesResult::ListTopicRulesResult(const AmazonWebServiceResult<JsonValu
 
 ListTopicRulesResult& ListTopicRulesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("rules"))
   {
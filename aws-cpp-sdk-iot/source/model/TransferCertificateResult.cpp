@@ -35,6 +35,7 @@ TransferCertificateResult::TransferCertificateResult(const AmazonWebServiceResul
 
 TransferCertificateResult& TransferCertificateResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("transferredCertificateArn"))
   {
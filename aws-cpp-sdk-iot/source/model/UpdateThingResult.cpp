@@ -35,6 +35,7 @@ UpdateThingResult::UpdateThingResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateThingResult& UpdateThingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kinesis/Kinesis_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/kinesis/model/StreamDescription.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output for <code>DescribeStream</code>.</p>
    */
-  class AWS_KINESIS_API DescribeStreamResult
+  class AWS_KINESIS_API DescribeStreamResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeStreamResult();
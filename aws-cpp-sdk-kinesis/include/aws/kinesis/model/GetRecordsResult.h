@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kinesis/Kinesis_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/kinesis/model/Record.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Represents the output for <a>GetRecords</a>.</p>
    */
-  class AWS_KINESIS_API GetRecordsResult
+  class AWS_KINESIS_API GetRecordsResult : public AmazonWebServiceResultBase
   {
   public:
     GetRecordsResult();
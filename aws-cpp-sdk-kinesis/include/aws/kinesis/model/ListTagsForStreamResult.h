@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kinesis/Kinesis_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/kinesis/model/Tag.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Represents the output for <code>ListTagsForStream</code>.</p>
    */
-  class AWS_KINESIS_API ListTagsForStreamResult
+  class AWS_KINESIS_API ListTagsForStreamResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForStreamResult();
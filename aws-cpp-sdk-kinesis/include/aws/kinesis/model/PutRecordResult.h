@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kinesis/Kinesis_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Represents the output for <code>PutRecord</code>.</p>
    */
-  class AWS_KINESIS_API PutRecordResult
+  class AWS_KINESIS_API PutRecordResult : public AmazonWebServiceResultBase
   {
   public:
     PutRecordResult();
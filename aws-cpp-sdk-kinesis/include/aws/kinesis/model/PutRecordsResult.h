@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kinesis/Kinesis_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/kinesis/model/PutRecordsResultEntry.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p><code>PutRecords</code> results.</p>
    */
-  class AWS_KINESIS_API PutRecordsResult
+  class AWS_KINESIS_API PutRecordsResult : public AmazonWebServiceResultBase
   {
   public:
     PutRecordsResult();
@@ -35,6 +35,7 @@ DescribeStreamResult::DescribeStreamResult(const AmazonWebServiceResult<JsonValu
 
 DescribeStreamResult& DescribeStreamResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StreamDescription"))
   {
@@ -37,6 +37,7 @@ GetRecordsResult::GetRecordsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 GetRecordsResult& GetRecordsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Records"))
   {
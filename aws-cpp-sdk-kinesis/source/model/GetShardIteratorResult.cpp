@@ -35,6 +35,7 @@ GetShardIteratorResult::GetShardIteratorResult(const AmazonWebServiceResult<Json
 
 GetShardIteratorResult& GetShardIteratorResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ShardIterator"))
   {
@@ -37,6 +37,7 @@ ListStreamsResult::ListStreamsResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListStreamsResult& ListStreamsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StreamNames"))
   {
@@ -37,6 +37,7 @@ ListTagsForStreamResult::ListTagsForStreamResult(const AmazonWebServiceResult<Js
 
 ListTagsForStreamResult& ListTagsForStreamResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Tags"))
   {
@@ -35,6 +35,7 @@ PutRecordResult::PutRecordResult(const AmazonWebServiceResult<JsonValue>& result
 
 PutRecordResult& PutRecordResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ShardId"))
   {
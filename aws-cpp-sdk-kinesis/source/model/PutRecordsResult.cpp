@@ -37,6 +37,7 @@ PutRecordsResult::PutRecordsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 PutRecordsResult& PutRecordsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedRecordCount"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kms/KMS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace KMS
 {
 namespace Model
 {
-  class AWS_KMS_API CreateGrantResult
+  class AWS_KMS_API CreateGrantResult : public AmazonWebServiceResultBase
   {
   public:
     CreateGrantResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kms/KMS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/Array.h>
 
@@ -33,7 +34,7 @@ namespace KMS
 {
 namespace Model
 {
-  class AWS_KMS_API DecryptResult
+  class AWS_KMS_API DecryptResult : public AmazonWebServiceResultBase
   {
   public:
     DecryptResult();
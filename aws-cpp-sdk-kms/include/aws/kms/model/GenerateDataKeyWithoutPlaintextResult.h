@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kms/KMS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace KMS
 {
 namespace Model
 {
-  class AWS_KMS_API GenerateDataKeyWithoutPlaintextResult
+  class AWS_KMS_API GenerateDataKeyWithoutPlaintextResult : public AmazonWebServiceResultBase
   {
   public:
     GenerateDataKeyWithoutPlaintextResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kms/KMS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -31,7 +32,7 @@ namespace KMS
 {
 namespace Model
 {
-  class AWS_KMS_API GetKeyRotationStatusResult
+  class AWS_KMS_API GetKeyRotationStatusResult : public AmazonWebServiceResultBase
   {
   public:
     GetKeyRotationStatusResult();
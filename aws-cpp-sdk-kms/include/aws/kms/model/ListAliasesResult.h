@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kms/KMS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/kms/model/AliasListEntry.h>
@@ -34,7 +35,7 @@ namespace KMS
 {
 namespace Model
 {
-  class AWS_KMS_API ListAliasesResult
+  class AWS_KMS_API ListAliasesResult : public AmazonWebServiceResultBase
   {
   public:
     ListAliasesResult();
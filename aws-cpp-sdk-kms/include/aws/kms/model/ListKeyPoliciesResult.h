@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/kms/KMS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace KMS
 {
 namespace Model
 {
-  class AWS_KMS_API ListKeyPoliciesResult
+  class AWS_KMS_API ListKeyPoliciesResult : public AmazonWebServiceResultBase
   {
   public:
     ListKeyPoliciesResult();
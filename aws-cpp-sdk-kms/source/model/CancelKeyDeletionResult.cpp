@@ -35,6 +35,7 @@ CancelKeyDeletionResult::CancelKeyDeletionResult(const AmazonWebServiceResult<Js
 
 CancelKeyDeletionResult& CancelKeyDeletionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("KeyId"))
   {
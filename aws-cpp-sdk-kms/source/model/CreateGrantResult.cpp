@@ -35,6 +35,7 @@ CreateGrantResult::CreateGrantResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateGrantResult& CreateGrantResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GrantToken"))
   {
@@ -35,6 +35,7 @@ CreateKeyResult::CreateKeyResult(const AmazonWebServiceResult<JsonValue>& result
 
 CreateKeyResult& CreateKeyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("KeyMetadata"))
   {
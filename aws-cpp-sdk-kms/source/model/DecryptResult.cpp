@@ -36,6 +36,7 @@ DecryptResult::DecryptResult(const AmazonWebServiceResult<JsonValue>& result)
 
 DecryptResult& DecryptResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("KeyId"))
   {
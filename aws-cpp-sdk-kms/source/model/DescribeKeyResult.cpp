@@ -35,6 +35,7 @@ DescribeKeyResult::DescribeKeyResult(const AmazonWebServiceResult<JsonValue>& re
 
 DescribeKeyResult& DescribeKeyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("KeyMetadata"))
   {
@@ -36,6 +36,7 @@ EncryptResult::EncryptResult(const AmazonWebServiceResult<JsonValue>& result)
 
 EncryptResult& EncryptResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CiphertextBlob"))
   {
@@ -36,6 +36,7 @@ GenerateDataKeyResult::GenerateDataKeyResult(const AmazonWebServiceResult<JsonVa
 
 GenerateDataKeyResult& GenerateDataKeyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CiphertextBlob"))
   {
@@ -36,6 +36,7 @@ GenerateDataKeyWithoutPlaintextResult::GenerateDataKeyWithoutPlaintextResult(con
 
 GenerateDataKeyWithoutPlaintextResult& GenerateDataKeyWithoutPlaintextResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CiphertextBlob"))
   {
@@ -36,6 +36,7 @@ GenerateRandomResult::GenerateRandomResult(const AmazonWebServiceResult<JsonValu
 
 GenerateRandomResult& GenerateRandomResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Plaintext"))
   {
@@ -35,6 +35,7 @@ GetKeyPolicyResult::GetKeyPolicyResult(const AmazonWebServiceResult<JsonValue>&
 
 GetKeyPolicyResult& GetKeyPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Policy"))
   {
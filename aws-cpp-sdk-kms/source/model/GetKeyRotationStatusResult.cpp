@@ -37,6 +37,7 @@ GetKeyRotationStatusResult::GetKeyRotationStatusResult(const AmazonWebServiceRes
 
 GetKeyRotationStatusResult& GetKeyRotationStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("KeyRotationEnabled"))
   {
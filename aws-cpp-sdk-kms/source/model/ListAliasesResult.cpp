@@ -37,6 +37,7 @@ ListAliasesResult::ListAliasesResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListAliasesResult& ListAliasesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Aliases"))
   {
@@ -37,6 +37,7 @@ ListGrantsResult::ListGrantsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListGrantsResult& ListGrantsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Grants"))
   {
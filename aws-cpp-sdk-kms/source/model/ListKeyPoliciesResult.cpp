@@ -37,6 +37,7 @@ ListKeyPoliciesResult::ListKeyPoliciesResult(const AmazonWebServiceResult<JsonVa
 
 ListKeyPoliciesResult& ListKeyPoliciesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("PolicyNames"))
   {
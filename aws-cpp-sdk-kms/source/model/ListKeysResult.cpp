@@ -37,6 +37,7 @@ ListKeysResult::ListKeysResult(const AmazonWebServiceResult<JsonValue>& result)
 
 ListKeysResult& ListKeysResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Keys"))
   {
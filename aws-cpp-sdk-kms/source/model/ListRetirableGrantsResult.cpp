@@ -37,6 +37,7 @@ ListRetirableGrantsResult::ListRetirableGrantsResult(const AmazonWebServiceResul
 
 ListRetirableGrantsResult& ListRetirableGrantsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Grants"))
   {
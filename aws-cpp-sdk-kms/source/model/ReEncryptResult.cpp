@@ -36,6 +36,7 @@ ReEncryptResult::ReEncryptResult(const AmazonWebServiceResult<JsonValue>& result
 
 ReEncryptResult& ReEncryptResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CiphertextBlob"))
   {
@@ -37,6 +37,7 @@ ScheduleKeyDeletionResult::ScheduleKeyDeletionResult(const AmazonWebServiceResul
 
 ScheduleKeyDeletionResult& ScheduleKeyDeletionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("KeyId"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace Lambda
 {
 namespace Model
 {
-  class AWS_LAMBDA_API AddPermissionResult
+  class AWS_LAMBDA_API AddPermissionResult : public AmazonWebServiceResultBase
   {
   public:
     AddPermissionResult();
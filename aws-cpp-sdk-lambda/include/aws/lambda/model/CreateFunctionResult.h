@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/lambda/model/Runtime.h>
 #include <aws/lambda/model/VpcConfigResponse.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>A complex type that describes function metadata.</p>
    */
-  class AWS_LAMBDA_API CreateFunctionResult
+  class AWS_LAMBDA_API CreateFunctionResult : public AmazonWebServiceResultBase
   {
   public:
     CreateFunctionResult();
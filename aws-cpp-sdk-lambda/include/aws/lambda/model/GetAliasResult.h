@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Provides configuration information about a Lambda function version alias.</p>
    */
-  class AWS_LAMBDA_API GetAliasResult
+  class AWS_LAMBDA_API GetAliasResult : public AmazonWebServiceResultBase
   {
   public:
     GetAliasResult();
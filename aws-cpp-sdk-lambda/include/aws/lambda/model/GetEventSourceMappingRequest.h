@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     GetEventSourceMappingRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetEventSourceMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Describes mapping between an Amazon Kinesis stream and a Lambda function.</p>
    */
-  class AWS_LAMBDA_API GetEventSourceMappingResult
+  class AWS_LAMBDA_API GetEventSourceMappingResult : public AmazonWebServiceResultBase
   {
   public:
     GetEventSourceMappingResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/lambda/model/FunctionConfiguration.h>
 #include <aws/lambda/model/FunctionCodeLocation.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>This response contains the object for the Lambda function location (see
    * <a>API_FunctionCodeLocation</a>.</p>
    */
-  class AWS_LAMBDA_API GetFunctionResult
+  class AWS_LAMBDA_API GetFunctionResult : public AmazonWebServiceResultBase
   {
   public:
     GetFunctionResult();
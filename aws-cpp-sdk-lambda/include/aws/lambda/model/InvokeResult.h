@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/Array.h>
@@ -30,7 +31,7 @@ namespace Model
   /**
    * <p>Upon success, returns an empty response. Otherwise, throws an exception.</p>
    */
-  class AWS_LAMBDA_API InvokeResult
+  class AWS_LAMBDA_API InvokeResult : public AmazonWebServiceResultBase
   {
   public:
     InvokeResult();
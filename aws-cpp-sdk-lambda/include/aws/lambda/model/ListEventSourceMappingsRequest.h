@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     ListEventSourceMappingsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListEventSourceMappings"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
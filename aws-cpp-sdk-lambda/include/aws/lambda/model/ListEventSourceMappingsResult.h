@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/lambda/model/EventSourceMappingConfiguration.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains a list of event sources (see
    * <a>API_EventSourceMappingConfiguration</a>)</p>
    */
-  class AWS_LAMBDA_API ListEventSourceMappingsResult
+  class AWS_LAMBDA_API ListEventSourceMappingsResult : public AmazonWebServiceResultBase
   {
   public:
     ListEventSourceMappingsResult();
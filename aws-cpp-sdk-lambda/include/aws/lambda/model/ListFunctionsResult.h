@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/lambda/model/FunctionConfiguration.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains a list of AWS Lambda function configurations (see
    * <a>FunctionConfiguration</a>.</p>
    */
-  class AWS_LAMBDA_API ListFunctionsResult
+  class AWS_LAMBDA_API ListFunctionsResult : public AmazonWebServiceResultBase
   {
   public:
     ListFunctionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/lambda/Lambda_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/lambda/model/FunctionConfiguration.h>
@@ -34,7 +35,7 @@ namespace Lambda
 {
 namespace Model
 {
-  class AWS_LAMBDA_API ListVersionsByFunctionResult
+  class AWS_LAMBDA_API ListVersionsByFunctionResult : public AmazonWebServiceResultBase
   {
   public:
     ListVersionsByFunctionResult();
@@ -35,6 +35,7 @@ AddPermissionResult::AddPermissionResult(const AmazonWebServiceResult<JsonValue>
 
 AddPermissionResult& AddPermissionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Statement"))
   {
@@ -39,6 +39,7 @@ CreateEventSourceMappingResult::CreateEventSourceMappingResult(const AmazonWebSe
 
 CreateEventSourceMappingResult& CreateEventSourceMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UUID"))
   {
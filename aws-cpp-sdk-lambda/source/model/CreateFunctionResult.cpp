@@ -41,6 +41,7 @@ CreateFunctionResult::CreateFunctionResult(const AmazonWebServiceResult<JsonValu
 
 CreateFunctionResult& CreateFunctionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FunctionName"))
   {
@@ -39,6 +39,7 @@ DeleteEventSourceMappingResult::DeleteEventSourceMappingResult(const AmazonWebSe
 
 DeleteEventSourceMappingResult& DeleteEventSourceMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UUID"))
   {
@@ -35,6 +35,7 @@ GetAliasResult::GetAliasResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetAliasResult& GetAliasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AliasArn"))
   {
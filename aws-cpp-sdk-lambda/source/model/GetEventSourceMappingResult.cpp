@@ -39,6 +39,7 @@ GetEventSourceMappingResult::GetEventSourceMappingResult(const AmazonWebServiceR
 
 GetEventSourceMappingResult& GetEventSourceMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UUID"))
   {
@@ -41,6 +41,7 @@ GetFunctionConfigurationResult::GetFunctionConfigurationResult(const AmazonWebSe
 
 GetFunctionConfigurationResult& GetFunctionConfigurationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FunctionName"))
   {
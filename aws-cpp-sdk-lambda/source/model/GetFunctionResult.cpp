@@ -35,6 +35,7 @@ GetFunctionResult::GetFunctionResult(const AmazonWebServiceResult<JsonValue>& re
 
 GetFunctionResult& GetFunctionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Configuration"))
   {
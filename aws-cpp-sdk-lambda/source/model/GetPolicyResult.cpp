@@ -35,6 +35,7 @@ GetPolicyResult::GetPolicyResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetPolicyResult& GetPolicyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Policy"))
   {
@@ -36,6 +36,7 @@ InvokeResult::InvokeResult(InvokeResult&& toMove) :
     m_logResult(std::move(toMove.m_logResult)),
     m_payload(std::move(toMove.m_payload))
 {
+  SetRequestTimings(toMove.GetRequestTimings());
 }
 
 InvokeResult& InvokeResult::operator=(InvokeResult&& toMove)
@@ -45,6 +46,7 @@ InvokeResult& InvokeResult::operator=(InvokeResult&& toMove)
       return *this;
    }
 
+   SetRequestTimings(toMove.GetRequestTimings());
    m_statusCode = toMove.m_statusCode;
    m_functionError = std::move(toMove.m_functionError);
    m_logResult = std::move(toMove.m_logResult);
@@ -61,6 +63,7 @@ InvokeResult::InvokeResult(AmazonWebServiceResult<ResponseStream>&& result) :
 
 InvokeResult& InvokeResult::operator =(AmazonWebServiceResult<ResponseStream>&& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   m_payload = result.TakeOwnershipOfPayload();
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -35,6 +35,7 @@ ListEventSourceMappingsResult::ListEventSourceMappingsResult(const AmazonWebServ
 
 ListEventSourceMappingsResult& ListEventSourceMappingsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
@@ -35,6 +35,7 @@ ListFunctionsResult::ListFunctionsResult(const AmazonWebServiceResult<JsonValue>
 
 ListFunctionsResult& ListFunctionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
@@ -35,6 +35,7 @@ ListVersionsByFunctionResult::ListVersionsByFunctionResult(const AmazonWebServic
 
 ListVersionsByFunctionResult& ListVersionsByFunctionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
@@ -41,6 +41,7 @@ PublishVersionResult::PublishVersionResult(const AmazonWebServiceResult<JsonValu
 
 PublishVersionResult& PublishVersionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FunctionName"))
   {
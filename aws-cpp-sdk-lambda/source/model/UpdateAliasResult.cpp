@@ -35,6 +35,7 @@ UpdateAliasResult::UpdateAliasResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateAliasResult& UpdateAliasResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AliasArn"))
   {
@@ -39,6 +39,7 @@ UpdateEventSourceMappingResult::UpdateEventSourceMappingResult(const AmazonWebSe
 
 UpdateEventSourceMappingResult& UpdateEventSourceMappingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UUID"))
   {
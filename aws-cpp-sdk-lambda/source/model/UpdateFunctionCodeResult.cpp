@@ -41,6 +41,7 @@ UpdateFunctionCodeResult::UpdateFunctionCodeResult(const AmazonWebServiceResult<
 
 UpdateFunctionCodeResult& UpdateFunctionCodeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FunctionName"))
   {
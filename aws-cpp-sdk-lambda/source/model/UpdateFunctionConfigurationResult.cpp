@@ -41,6 +41,7 @@ UpdateFunctionConfigurationResult::UpdateFunctionConfigurationResult(const Amazo
 
 UpdateFunctionConfigurationResult& UpdateFunctionConfigurationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FunctionName"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/logs/CloudWatchLogs_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace CloudWatchLogs
 {
 namespace Model
 {
-  class AWS_CLOUDWATCHLOGS_API CreateExportTaskResult
+  class AWS_CLOUDWATCHLOGS_API CreateExportTaskResult : public AmazonWebServiceResultBase
   {
   public:
     CreateExportTaskResult();
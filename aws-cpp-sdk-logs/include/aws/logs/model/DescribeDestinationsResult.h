@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/logs/CloudWatchLogs_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/logs/model/Destination.h>
@@ -34,7 +35,7 @@ namespace CloudWatchLogs
 {
 namespace Model
 {
-  class AWS_CLOUDWATCHLOGS_API DescribeDestinationsResult
+  class AWS_CLOUDWATCHLOGS_API DescribeDestinationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDestinationsResult();
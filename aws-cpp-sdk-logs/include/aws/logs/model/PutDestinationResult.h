@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/logs/CloudWatchLogs_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/logs/model/Destination.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace CloudWatchLogs
 {
 namespace Model
 {
-  class AWS_CLOUDWATCHLOGS_API PutDestinationResult
+  class AWS_CLOUDWATCHLOGS_API PutDestinationResult : public AmazonWebServiceResultBase
   {
   public:
     PutDestinationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/logs/CloudWatchLogs_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/logs/model/RejectedLogEventsInfo.h>
 
@@ -33,7 +34,7 @@ namespace CloudWatchLogs
 {
 namespace Model
 {
-  class AWS_CLOUDWATCHLOGS_API PutLogEventsResult
+  class AWS_CLOUDWATCHLOGS_API PutLogEventsResult : public AmazonWebServiceResultBase
   {
   public:
     PutLogEventsResult();
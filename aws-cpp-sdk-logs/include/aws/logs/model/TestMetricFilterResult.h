@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/logs/CloudWatchLogs_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/logs/model/MetricFilterMatchRecord.h>
 
@@ -33,7 +34,7 @@ namespace CloudWatchLogs
 {
 namespace Model
 {
-  class AWS_CLOUDWATCHLOGS_API TestMetricFilterResult
+  class AWS_CLOUDWATCHLOGS_API TestMetricFilterResult : public AmazonWebServiceResultBase
   {
   public:
     TestMetricFilterResult();
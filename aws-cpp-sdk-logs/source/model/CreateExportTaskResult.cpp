@@ -35,6 +35,7 @@ CreateExportTaskResult::CreateExportTaskResult(const AmazonWebServiceResult<Json
 
 CreateExportTaskResult& CreateExportTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskId"))
   {
@@ -35,6 +35,7 @@ DescribeDestinationsResult::DescribeDestinationsResult(const AmazonWebServiceRes
 
 DescribeDestinationsResult& DescribeDestinationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("destinations"))
   {
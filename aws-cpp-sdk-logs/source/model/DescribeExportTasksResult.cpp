@@ -35,6 +35,7 @@ DescribeExportTasksResult::DescribeExportTasksResult(const AmazonWebServiceResul
 
 DescribeExportTasksResult& DescribeExportTasksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("exportTasks"))
   {
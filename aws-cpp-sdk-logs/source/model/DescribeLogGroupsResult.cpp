@@ -35,6 +35,7 @@ DescribeLogGroupsResult::DescribeLogGroupsResult(const AmazonWebServiceResult<Js
 
 DescribeLogGroupsResult& DescribeLogGroupsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("logGroups"))
   {
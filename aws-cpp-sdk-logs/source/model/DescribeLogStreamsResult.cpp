@@ -35,6 +35,7 @@ DescribeLogStreamsResult::DescribeLogStreamsResult(const AmazonWebServiceResult<
 
 DescribeLogStreamsResult& DescribeLogStreamsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("logStreams"))
   {
@@ -35,6 +35,7 @@ DescribeMetricFiltersResult::DescribeMetricFiltersResult(const AmazonWebServiceR
 
 DescribeMetricFiltersResult& DescribeMetricFiltersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("metricFilters"))
   {
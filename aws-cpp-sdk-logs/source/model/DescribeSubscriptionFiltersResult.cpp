@@ -35,6 +35,7 @@ DescribeSubscriptionFiltersResult::DescribeSubscriptionFiltersResult(const Amazo
 
 DescribeSubscriptionFiltersResult& DescribeSubscriptionFiltersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("subscriptionFilters"))
   {
@@ -35,6 +35,7 @@ FilterLogEventsResult::FilterLogEventsResult(const AmazonWebServiceResult<JsonVa
 
 FilterLogEventsResult& FilterLogEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("events"))
   {
@@ -35,6 +35,7 @@ GetLogEventsResult::GetLogEventsResult(const AmazonWebServiceResult<JsonValue>&
 
 GetLogEventsResult& GetLogEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("events"))
   {
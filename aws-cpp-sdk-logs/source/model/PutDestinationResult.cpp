@@ -35,6 +35,7 @@ PutDestinationResult::PutDestinationResult(const AmazonWebServiceResult<JsonValu
 
 PutDestinationResult& PutDestinationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("destination"))
   {
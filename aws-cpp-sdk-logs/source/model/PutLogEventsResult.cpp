@@ -35,6 +35,7 @@ PutLogEventsResult::PutLogEventsResult(const AmazonWebServiceResult<JsonValue>&
 
 PutLogEventsResult& PutLogEventsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("nextSequenceToken"))
   {
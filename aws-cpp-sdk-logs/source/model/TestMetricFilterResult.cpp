@@ -35,6 +35,7 @@ TestMetricFilterResult::TestMetricFilterResult(const AmazonWebServiceResult<Json
 
 TestMetricFilterResult& TestMetricFilterResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("matches"))
   {
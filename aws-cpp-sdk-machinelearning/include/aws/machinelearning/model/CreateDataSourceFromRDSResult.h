@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -42,7 +43,7 @@ namespace Model
    * progress of the copy operation by going to the <code>DataPipeline</code> console
    * and looking up the pipeline using the pipelineId from the describe call.</p>
    */
-  class AWS_MACHINELEARNING_API CreateDataSourceFromRDSResult
+  class AWS_MACHINELEARNING_API CreateDataSourceFromRDSResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDataSourceFromRDSResult();
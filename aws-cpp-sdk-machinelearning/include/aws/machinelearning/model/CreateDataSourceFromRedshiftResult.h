@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -39,7 +40,7 @@ namespace Model
    * updates by using the <a>GetBatchPrediction</a> operation and checking the
    * <code>Status</code> parameter. </p>
    */
-  class AWS_MACHINELEARNING_API CreateDataSourceFromRedshiftResult
+  class AWS_MACHINELEARNING_API CreateDataSourceFromRedshiftResult : public AmazonWebServiceResultBase
   {
   public:
     CreateDataSourceFromRedshiftResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/RealtimeEndpointInfo.h>
 
@@ -40,7 +41,7 @@ namespace Model
    * the URI of the <code>MLModel</code>; that is, the location to send online
    * prediction requests for the specified <code>MLModel</code>.</p> </note>
    */
-  class AWS_MACHINELEARNING_API CreateRealtimeEndpointResult
+  class AWS_MACHINELEARNING_API CreateRealtimeEndpointResult : public AmazonWebServiceResultBase
   {
   public:
     CreateRealtimeEndpointResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p> Represents the output of a <a>DeleteDataSource</a> operation.</p>
    */
-  class AWS_MACHINELEARNING_API DeleteDataSourceResult
+  class AWS_MACHINELEARNING_API DeleteDataSourceResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteDataSourceResult();
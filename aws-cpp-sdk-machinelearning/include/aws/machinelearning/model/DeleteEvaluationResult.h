@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -39,7 +40,7 @@ namespace Model
    * <code>Status</code> parameter to see whether an <code>Evaluation</code> is
    * marked as <code>DELETED</code>.</p>
    */
-  class AWS_MACHINELEARNING_API DeleteEvaluationResult
+  class AWS_MACHINELEARNING_API DeleteEvaluationResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteEvaluationResult();
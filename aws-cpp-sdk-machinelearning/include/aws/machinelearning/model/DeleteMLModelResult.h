@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -38,7 +39,7 @@ namespace Model
    * parameter to see whether an <code>MLModel</code> is marked as
    * <code>DELETED</code>.</p>
    */
-  class AWS_MACHINELEARNING_API DeleteMLModelResult
+  class AWS_MACHINELEARNING_API DeleteMLModelResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteMLModelResult();
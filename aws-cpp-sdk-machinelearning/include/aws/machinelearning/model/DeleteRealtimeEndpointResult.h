@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/RealtimeEndpointInfo.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * <p>The result contains the <code>MLModelId</code> and the endpoint information
    * for the <code>MLModel</code>. </p>
    */
-  class AWS_MACHINELEARNING_API DeleteRealtimeEndpointResult
+  class AWS_MACHINELEARNING_API DeleteRealtimeEndpointResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteRealtimeEndpointResult();
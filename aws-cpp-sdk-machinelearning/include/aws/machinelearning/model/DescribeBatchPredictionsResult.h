@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/BatchPrediction.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the output of a <a>DescribeBatchPredictions</a> operation. The
    * content is essentially a list of <code>BatchPrediction</code>s.</p>
    */
-  class AWS_MACHINELEARNING_API DescribeBatchPredictionsResult
+  class AWS_MACHINELEARNING_API DescribeBatchPredictionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeBatchPredictionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/Evaluation.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the query results from a <a>DescribeEvaluations</a> operation. The
    * content is essentially a list of <code>Evaluation</code>.</p>
    */
-  class AWS_MACHINELEARNING_API DescribeEvaluationsResult
+  class AWS_MACHINELEARNING_API DescribeEvaluationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEvaluationsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/MLModel.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the output of a <a>DescribeMLModels</a> operation. The content is
    * essentially a list of <code>MLModel</code>.</p>
    */
-  class AWS_MACHINELEARNING_API DescribeMLModelsResult
+  class AWS_MACHINELEARNING_API DescribeMLModelsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeMLModelsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/EntityStatus.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Represents the output of a <a>GetBatchPrediction</a> operation and describes
    * a <code>BatchPrediction</code>.</p>
    */
-  class AWS_MACHINELEARNING_API GetBatchPredictionResult
+  class AWS_MACHINELEARNING_API GetBatchPredictionResult : public AmazonWebServiceResultBase
   {
   public:
     GetBatchPredictionResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/EntityStatus.h>
 #include <aws/machinelearning/model/RedshiftMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p>Represents the output of a <a>GetDataSource</a> operation and describes a
    * <code>DataSource</code>.</p>
    */
-  class AWS_MACHINELEARNING_API GetDataSourceResult
+  class AWS_MACHINELEARNING_API GetDataSourceResult : public AmazonWebServiceResultBase
   {
   public:
     GetDataSourceResult();
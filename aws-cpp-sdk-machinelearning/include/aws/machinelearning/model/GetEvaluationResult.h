@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/EntityStatus.h>
 #include <aws/machinelearning/model/PerformanceMetrics.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Represents the output of a <a>GetEvaluation</a> operation and describes an
    * <code>Evaluation</code>.</p>
    */
-  class AWS_MACHINELEARNING_API GetEvaluationResult
+  class AWS_MACHINELEARNING_API GetEvaluationResult : public AmazonWebServiceResultBase
   {
   public:
     GetEvaluationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/machinelearning/model/EntityStatus.h>
 #include <aws/machinelearning/model/RealtimeEndpointInfo.h>
@@ -40,7 +41,7 @@ namespace Model
    * <p>Represents the output of a <a>GetMLModel</a> operation, and provides detailed
    * information about a <code>MLModel</code>.</p>
    */
-  class AWS_MACHINELEARNING_API GetMLModelResult
+  class AWS_MACHINELEARNING_API GetMLModelResult : public AmazonWebServiceResultBase
   {
   public:
     GetMLModelResult();
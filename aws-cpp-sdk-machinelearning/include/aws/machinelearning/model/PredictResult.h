@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/machinelearning/model/Prediction.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace MachineLearning
 {
 namespace Model
 {
-  class AWS_MACHINELEARNING_API PredictResult
+  class AWS_MACHINELEARNING_API PredictResult : public AmazonWebServiceResultBase
   {
   public:
     PredictResult();
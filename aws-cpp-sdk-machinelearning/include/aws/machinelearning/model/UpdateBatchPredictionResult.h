@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -37,7 +38,7 @@ namespace Model
    * <p>You can see the updated content by using the <a>GetBatchPrediction</a>
    * operation.</p>
    */
-  class AWS_MACHINELEARNING_API UpdateBatchPredictionResult
+  class AWS_MACHINELEARNING_API UpdateBatchPredictionResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateBatchPredictionResult();
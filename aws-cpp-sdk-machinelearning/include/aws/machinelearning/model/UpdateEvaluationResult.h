@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/machinelearning/MachineLearning_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>Represents the output of an <a>UpdateEvaluation</a> operation.</p> <p>You can
    * see the updated content by using the <a>GetEvaluation</a> operation.</p>
    */
-  class AWS_MACHINELEARNING_API UpdateEvaluationResult
+  class AWS_MACHINELEARNING_API UpdateEvaluationResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateEvaluationResult();
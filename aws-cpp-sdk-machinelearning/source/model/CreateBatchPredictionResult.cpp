@@ -35,6 +35,7 @@ CreateBatchPredictionResult::CreateBatchPredictionResult(const AmazonWebServiceR
 
 CreateBatchPredictionResult& CreateBatchPredictionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("BatchPredictionId"))
   {
@@ -35,6 +35,7 @@ CreateDataSourceFromRDSResult::CreateDataSourceFromRDSResult(const AmazonWebServ
 
 CreateDataSourceFromRDSResult& CreateDataSourceFromRDSResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DataSourceId"))
   {
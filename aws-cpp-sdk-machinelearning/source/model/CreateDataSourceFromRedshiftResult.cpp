@@ -35,6 +35,7 @@ CreateDataSourceFromRedshiftResult::CreateDataSourceFromRedshiftResult(const Ama
 
 CreateDataSourceFromRedshiftResult& CreateDataSourceFromRedshiftResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DataSourceId"))
   {
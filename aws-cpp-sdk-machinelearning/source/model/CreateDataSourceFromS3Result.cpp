@@ -35,6 +35,7 @@ CreateDataSourceFromS3Result::CreateDataSourceFromS3Result(const AmazonWebServic
 
 CreateDataSourceFromS3Result& CreateDataSourceFromS3Result::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DataSourceId"))
   {
@@ -35,6 +35,7 @@ CreateEvaluationResult::CreateEvaluationResult(const AmazonWebServiceResult<Json
 
 CreateEvaluationResult& CreateEvaluationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EvaluationId"))
   {
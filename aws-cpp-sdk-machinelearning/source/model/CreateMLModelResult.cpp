@@ -35,6 +35,7 @@ CreateMLModelResult::CreateMLModelResult(const AmazonWebServiceResult<JsonValue>
 
 CreateMLModelResult& CreateMLModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MLModelId"))
   {
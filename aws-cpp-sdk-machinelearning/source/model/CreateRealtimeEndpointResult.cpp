@@ -35,6 +35,7 @@ CreateRealtimeEndpointResult::CreateRealtimeEndpointResult(const AmazonWebServic
 
 CreateRealtimeEndpointResult& CreateRealtimeEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MLModelId"))
   {
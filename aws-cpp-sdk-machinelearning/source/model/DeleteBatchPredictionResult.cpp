@@ -35,6 +35,7 @@ DeleteBatchPredictionResult::DeleteBatchPredictionResult(const AmazonWebServiceR
 
 DeleteBatchPredictionResult& DeleteBatchPredictionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("BatchPredictionId"))
   {
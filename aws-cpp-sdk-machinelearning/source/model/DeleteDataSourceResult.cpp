@@ -35,6 +35,7 @@ DeleteDataSourceResult::DeleteDataSourceResult(const AmazonWebServiceResult<Json
 
 DeleteDataSourceResult& DeleteDataSourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DataSourceId"))
   {
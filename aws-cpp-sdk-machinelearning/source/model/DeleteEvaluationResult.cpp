@@ -35,6 +35,7 @@ DeleteEvaluationResult::DeleteEvaluationResult(const AmazonWebServiceResult<Json
 
 DeleteEvaluationResult& DeleteEvaluationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EvaluationId"))
   {
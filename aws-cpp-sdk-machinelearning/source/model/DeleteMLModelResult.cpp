@@ -35,6 +35,7 @@ DeleteMLModelResult::DeleteMLModelResult(const AmazonWebServiceResult<JsonValue>
 
 DeleteMLModelResult& DeleteMLModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MLModelId"))
   {
@@ -35,6 +35,7 @@ DeleteRealtimeEndpointResult::DeleteRealtimeEndpointResult(const AmazonWebServic
 
 DeleteRealtimeEndpointResult& DeleteRealtimeEndpointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MLModelId"))
   {
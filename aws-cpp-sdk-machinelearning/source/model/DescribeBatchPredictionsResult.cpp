@@ -35,6 +35,7 @@ DescribeBatchPredictionsResult::DescribeBatchPredictionsResult(const AmazonWebSe
 
 DescribeBatchPredictionsResult& DescribeBatchPredictionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Results"))
   {
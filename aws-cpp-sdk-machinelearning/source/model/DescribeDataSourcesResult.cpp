@@ -35,6 +35,7 @@ DescribeDataSourcesResult::DescribeDataSourcesResult(const AmazonWebServiceResul
 
 DescribeDataSourcesResult& DescribeDataSourcesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Results"))
   {
@@ -35,6 +35,7 @@ DescribeEvaluationsResult::DescribeEvaluationsResult(const AmazonWebServiceResul
 
 DescribeEvaluationsResult& DescribeEvaluationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Results"))
   {
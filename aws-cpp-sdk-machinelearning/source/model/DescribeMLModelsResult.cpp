@@ -35,6 +35,7 @@ DescribeMLModelsResult::DescribeMLModelsResult(const AmazonWebServiceResult<Json
 
 DescribeMLModelsResult& DescribeMLModelsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Results"))
   {
@@ -39,6 +39,7 @@ GetBatchPredictionResult::GetBatchPredictionResult(const AmazonWebServiceResult<
 
 GetBatchPredictionResult& GetBatchPredictionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("BatchPredictionId"))
   {
@@ -45,6 +45,7 @@ GetDataSourceResult::GetDataSourceResult(const AmazonWebServiceResult<JsonValue>
 
 GetDataSourceResult& GetDataSourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DataSourceId"))
   {
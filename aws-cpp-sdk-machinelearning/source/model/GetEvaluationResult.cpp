@@ -39,6 +39,7 @@ GetEvaluationResult::GetEvaluationResult(const AmazonWebServiceResult<JsonValue>
 
 GetEvaluationResult& GetEvaluationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EvaluationId"))
   {
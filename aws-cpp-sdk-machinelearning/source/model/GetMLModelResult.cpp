@@ -45,6 +45,7 @@ GetMLModelResult::GetMLModelResult(const AmazonWebServiceResult<JsonValue>& resu
 
 GetMLModelResult& GetMLModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MLModelId"))
   {
@@ -35,6 +35,7 @@ PredictResult::PredictResult(const AmazonWebServiceResult<JsonValue>& result)
 
 PredictResult& PredictResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Prediction"))
   {
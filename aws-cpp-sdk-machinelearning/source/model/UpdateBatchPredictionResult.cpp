@@ -35,6 +35,7 @@ UpdateBatchPredictionResult::UpdateBatchPredictionResult(const AmazonWebServiceR
 
 UpdateBatchPredictionResult& UpdateBatchPredictionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("BatchPredictionId"))
   {
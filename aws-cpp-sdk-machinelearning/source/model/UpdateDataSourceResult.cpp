@@ -35,6 +35,7 @@ UpdateDataSourceResult::UpdateDataSourceResult(const AmazonWebServiceResult<Json
 
 UpdateDataSourceResult& UpdateDataSourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DataSourceId"))
   {
@@ -35,6 +35,7 @@ UpdateEvaluationResult::UpdateEvaluationResult(const AmazonWebServiceResult<Json
 
 UpdateEvaluationResult& UpdateEvaluationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EvaluationId"))
   {
@@ -35,6 +35,7 @@ UpdateMLModelResult::UpdateMLModelResult(const AmazonWebServiceResult<JsonValue>
 
 UpdateMLModelResult& UpdateMLModelResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MLModelId"))
   {
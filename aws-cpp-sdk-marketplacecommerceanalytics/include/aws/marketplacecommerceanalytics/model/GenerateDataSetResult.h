@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/marketplacecommerceanalytics/MarketplaceCommerceAnalytics_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * Container for the result of the GenerateDataSet operation.
    */
-  class AWS_MARKETPLACECOMMERCEANALYTICS_API GenerateDataSetResult
+  class AWS_MARKETPLACECOMMERCEANALYTICS_API GenerateDataSetResult : public AmazonWebServiceResultBase
   {
   public:
     GenerateDataSetResult();
@@ -35,6 +35,7 @@ GenerateDataSetResult::GenerateDataSetResult(const AmazonWebServiceResult<JsonVa
 
 GenerateDataSetResult& GenerateDataSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("dataSetRequestId"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/meteringmarketplace/MarketplaceMetering_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace MarketplaceMetering
 {
 namespace Model
 {
-  class AWS_MARKETPLACEMETERING_API MeterUsageResult
+  class AWS_MARKETPLACEMETERING_API MeterUsageResult : public AmazonWebServiceResultBase
   {
   public:
     MeterUsageResult();
@@ -35,6 +35,7 @@ MeterUsageResult::MeterUsageResult(const AmazonWebServiceResult<JsonValue>& resu
 
 MeterUsageResult& MeterUsageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("MeteringRecordId"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/monitoring/CloudWatch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/monitoring/model/ResponseMetadata.h>
 #include <aws/monitoring/model/MetricAlarm.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p> The output for the <a>DescribeAlarmsForMetric</a> action. </p>
    */
-  class AWS_CLOUDWATCH_API DescribeAlarmsForMetricResult
+  class AWS_CLOUDWATCH_API DescribeAlarmsForMetricResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAlarmsForMetricResult();
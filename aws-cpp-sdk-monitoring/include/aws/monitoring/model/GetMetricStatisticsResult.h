@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/monitoring/CloudWatch_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/monitoring/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p> The output for the <a>GetMetricStatistics</a> action. </p>
    */
-  class AWS_CLOUDWATCH_API GetMetricStatisticsResult
+  class AWS_CLOUDWATCH_API GetMetricStatisticsResult : public AmazonWebServiceResultBase
   {
   public:
     GetMetricStatisticsResult();
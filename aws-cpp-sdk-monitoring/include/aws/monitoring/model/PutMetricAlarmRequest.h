@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     PutMetricAlarmRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "PutMetricAlarm"; }
+
     Aws::String SerializePayload() const override;
 
     /**
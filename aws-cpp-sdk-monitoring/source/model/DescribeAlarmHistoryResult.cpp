@@ -37,6 +37,7 @@ DescribeAlarmHistoryResult::DescribeAlarmHistoryResult(const AmazonWebServiceRes
 
 DescribeAlarmHistoryResult& DescribeAlarmHistoryResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeAlarmsForMetricResult::DescribeAlarmsForMetricResult(const AmazonWebServ
 
 DescribeAlarmsForMetricResult& DescribeAlarmsForMetricResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
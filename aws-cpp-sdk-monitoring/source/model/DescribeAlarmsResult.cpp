@@ -37,6 +37,7 @@ DescribeAlarmsResult::DescribeAlarmsResult(const AmazonWebServiceResult<XmlDocum
 
 DescribeAlarmsResult& DescribeAlarmsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
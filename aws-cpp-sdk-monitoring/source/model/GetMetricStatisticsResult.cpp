@@ -37,6 +37,7 @@ GetMetricStatisticsResult::GetMetricStatisticsResult(const AmazonWebServiceResul
 
 GetMetricStatisticsResult& GetMetricStatisticsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListMetricsResult::ListMetricsResult(const AmazonWebServiceResult<XmlDocument>&
 
 ListMetricsResult& ListMetricsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/opsworks/model/AgentVersion.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>DescribeAgentVersions</code> request.</p>
    */
-  class AWS_OPSWORKS_API DescribeAgentVersionsResult
+  class AWS_OPSWORKS_API DescribeAgentVersionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAgentVersionsResult();
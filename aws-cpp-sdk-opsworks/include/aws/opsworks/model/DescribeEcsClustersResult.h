@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/opsworks/model/EcsCluster.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>DescribeEcsClusters</code> request.</p>
    */
-  class AWS_OPSWORKS_API DescribeEcsClustersResult
+  class AWS_OPSWORKS_API DescribeEcsClustersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEcsClustersResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/opsworks/model/ElasticLoadBalancer.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Contains the response to a <code>DescribeElasticLoadBalancers</code>
    * request.</p>
    */
-  class AWS_OPSWORKS_API DescribeElasticLoadBalancersResult
+  class AWS_OPSWORKS_API DescribeElasticLoadBalancersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeElasticLoadBalancersResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/opsworks/model/LoadBasedAutoScalingConfiguration.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Contains the response to a <code>DescribeLoadBasedAutoScaling</code>
    * request.</p>
    */
-  class AWS_OPSWORKS_API DescribeLoadBasedAutoScalingResult
+  class AWS_OPSWORKS_API DescribeLoadBasedAutoScalingResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeLoadBasedAutoScalingResult();
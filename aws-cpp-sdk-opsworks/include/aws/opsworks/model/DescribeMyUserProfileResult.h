@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/opsworks/model/SelfUserProfile.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>DescribeMyUserProfile</code> request.</p>
    */
-  class AWS_OPSWORKS_API DescribeMyUserProfileResult
+  class AWS_OPSWORKS_API DescribeMyUserProfileResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeMyUserProfileResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/opsworks/model/RaidArray.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>DescribeRaidArrays</code> request.</p>
    */
-  class AWS_OPSWORKS_API DescribeRaidArraysResult
+  class AWS_OPSWORKS_API DescribeRaidArraysResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeRaidArraysResult();
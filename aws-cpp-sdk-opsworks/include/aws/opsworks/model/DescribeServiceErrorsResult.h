@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/opsworks/model/ServiceError.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>DescribeServiceErrors</code> request.</p>
    */
-  class AWS_OPSWORKS_API DescribeServiceErrorsResult
+  class AWS_OPSWORKS_API DescribeServiceErrorsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeServiceErrorsResult();
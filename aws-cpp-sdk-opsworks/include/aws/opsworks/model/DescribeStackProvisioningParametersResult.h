@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Contains the response to a <code>DescribeStackProvisioningParameters</code>
    * request.</p>
    */
-  class AWS_OPSWORKS_API DescribeStackProvisioningParametersResult
+  class AWS_OPSWORKS_API DescribeStackProvisioningParametersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeStackProvisioningParametersResult();
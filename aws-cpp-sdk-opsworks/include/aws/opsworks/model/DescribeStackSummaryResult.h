@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/opsworks/model/StackSummary.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>DescribeStackSummary</code> request.</p>
    */
-  class AWS_OPSWORKS_API DescribeStackSummaryResult
+  class AWS_OPSWORKS_API DescribeStackSummaryResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeStackSummaryResult();
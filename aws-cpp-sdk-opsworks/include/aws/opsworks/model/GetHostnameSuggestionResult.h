@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>GetHostnameSuggestion</code> request.</p>
    */
-  class AWS_OPSWORKS_API GetHostnameSuggestionResult
+  class AWS_OPSWORKS_API GetHostnameSuggestionResult : public AmazonWebServiceResultBase
   {
   public:
     GetHostnameSuggestionResult();
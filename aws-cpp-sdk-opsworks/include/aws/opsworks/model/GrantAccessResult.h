@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/opsworks/model/TemporaryCredential.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>GrantAccess</code> request.</p>
    */
-  class AWS_OPSWORKS_API GrantAccessResult
+  class AWS_OPSWORKS_API GrantAccessResult : public AmazonWebServiceResultBase
   {
   public:
     GrantAccessResult();
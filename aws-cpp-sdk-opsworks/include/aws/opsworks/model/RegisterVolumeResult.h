@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/opsworks/OpsWorks_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Contains the response to a <code>RegisterVolume</code> request.</p>
    */
-  class AWS_OPSWORKS_API RegisterVolumeResult
+  class AWS_OPSWORKS_API RegisterVolumeResult : public AmazonWebServiceResultBase
   {
   public:
     RegisterVolumeResult();
@@ -35,6 +35,7 @@ CloneStackResult::CloneStackResult(const AmazonWebServiceResult<JsonValue>& resu
 
 CloneStackResult& CloneStackResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StackId"))
   {
@@ -35,6 +35,7 @@ CreateAppResult::CreateAppResult(const AmazonWebServiceResult<JsonValue>& result
 
 CreateAppResult& CreateAppResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AppId"))
   {
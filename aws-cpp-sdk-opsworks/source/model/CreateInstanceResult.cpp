@@ -35,6 +35,7 @@ CreateInstanceResult::CreateInstanceResult(const AmazonWebServiceResult<JsonValu
 
 CreateInstanceResult& CreateInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("InstanceId"))
   {
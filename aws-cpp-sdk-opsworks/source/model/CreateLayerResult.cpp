@@ -35,6 +35,7 @@ CreateLayerResult::CreateLayerResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateLayerResult& CreateLayerResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("LayerId"))
   {
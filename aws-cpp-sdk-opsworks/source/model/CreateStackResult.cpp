@@ -35,6 +35,7 @@ CreateStackResult::CreateStackResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateStackResult& CreateStackResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StackId"))
   {
@@ -35,6 +35,7 @@ CreateUserProfileResult::CreateUserProfileResult(const AmazonWebServiceResult<Js
 
 CreateUserProfileResult& CreateUserProfileResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IamUserArn"))
   {
@@ -35,6 +35,7 @@ DescribeAgentVersionsResult::DescribeAgentVersionsResult(const AmazonWebServiceR
 
 DescribeAgentVersionsResult& DescribeAgentVersionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AgentVersions"))
   {
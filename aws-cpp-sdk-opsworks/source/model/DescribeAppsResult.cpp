@@ -35,6 +35,7 @@ DescribeAppsResult::DescribeAppsResult(const AmazonWebServiceResult<JsonValue>&
 
 DescribeAppsResult& DescribeAppsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Apps"))
   {
@@ -35,6 +35,7 @@ DescribeCommandsResult::DescribeCommandsResult(const AmazonWebServiceResult<Json
 
 DescribeCommandsResult& DescribeCommandsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Commands"))
   {
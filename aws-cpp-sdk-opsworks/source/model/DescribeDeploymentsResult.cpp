@@ -35,6 +35,7 @@ DescribeDeploymentsResult::DescribeDeploymentsResult(const AmazonWebServiceResul
 
 DescribeDeploymentsResult& DescribeDeploymentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Deployments"))
   {
@@ -35,6 +35,7 @@ DescribeEcsClustersResult::DescribeEcsClustersResult(const AmazonWebServiceResul
 
 DescribeEcsClustersResult& DescribeEcsClustersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EcsClusters"))
   {
@@ -35,6 +35,7 @@ DescribeElasticIpsResult::DescribeElasticIpsResult(const AmazonWebServiceResult<
 
 DescribeElasticIpsResult& DescribeElasticIpsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ElasticIps"))
   {
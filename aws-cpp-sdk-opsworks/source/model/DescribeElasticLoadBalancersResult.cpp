@@ -35,6 +35,7 @@ DescribeElasticLoadBalancersResult::DescribeElasticLoadBalancersResult(const Ama
 
 DescribeElasticLoadBalancersResult& DescribeElasticLoadBalancersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ElasticLoadBalancers"))
   {
@@ -35,6 +35,7 @@ DescribeInstancesResult::DescribeInstancesResult(const AmazonWebServiceResult<Js
 
 DescribeInstancesResult& DescribeInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Instances"))
   {
@@ -35,6 +35,7 @@ DescribeLayersResult::DescribeLayersResult(const AmazonWebServiceResult<JsonValu
 
 DescribeLayersResult& DescribeLayersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Layers"))
   {
@@ -35,6 +35,7 @@ DescribeLoadBasedAutoScalingResult::DescribeLoadBasedAutoScalingResult(const Ama
 
 DescribeLoadBasedAutoScalingResult& DescribeLoadBasedAutoScalingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("LoadBasedAutoScalingConfigurations"))
   {
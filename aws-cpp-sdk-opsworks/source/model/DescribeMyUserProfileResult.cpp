@@ -35,6 +35,7 @@ DescribeMyUserProfileResult::DescribeMyUserProfileResult(const AmazonWebServiceR
 
 DescribeMyUserProfileResult& DescribeMyUserProfileResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UserProfile"))
   {
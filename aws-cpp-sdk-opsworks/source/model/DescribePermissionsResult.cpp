@@ -35,6 +35,7 @@ DescribePermissionsResult::DescribePermissionsResult(const AmazonWebServiceResul
 
 DescribePermissionsResult& DescribePermissionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Permissions"))
   {
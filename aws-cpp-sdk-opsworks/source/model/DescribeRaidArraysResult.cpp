@@ -35,6 +35,7 @@ DescribeRaidArraysResult::DescribeRaidArraysResult(const AmazonWebServiceResult<
 
 DescribeRaidArraysResult& DescribeRaidArraysResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("RaidArrays"))
   {
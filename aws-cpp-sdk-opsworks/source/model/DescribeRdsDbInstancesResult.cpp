@@ -35,6 +35,7 @@ DescribeRdsDbInstancesResult::DescribeRdsDbInstancesResult(const AmazonWebServic
 
 DescribeRdsDbInstancesResult& DescribeRdsDbInstancesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("RdsDbInstances"))
   {
@@ -35,6 +35,7 @@ DescribeServiceErrorsResult::DescribeServiceErrorsResult(const AmazonWebServiceR
 
 DescribeServiceErrorsResult& DescribeServiceErrorsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ServiceErrors"))
   {
@@ -35,6 +35,7 @@ DescribeStackProvisioningParametersResult::DescribeStackProvisioningParametersRe
 
 DescribeStackProvisioningParametersResult& DescribeStackProvisioningParametersResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AgentInstallerUrl"))
   {
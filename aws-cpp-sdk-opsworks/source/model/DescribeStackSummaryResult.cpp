@@ -35,6 +35,7 @@ DescribeStackSummaryResult::DescribeStackSummaryResult(const AmazonWebServiceRes
 
 DescribeStackSummaryResult& DescribeStackSummaryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StackSummary"))
   {
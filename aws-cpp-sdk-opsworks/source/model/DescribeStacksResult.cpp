@@ -35,6 +35,7 @@ DescribeStacksResult::DescribeStacksResult(const AmazonWebServiceResult<JsonValu
 
 DescribeStacksResult& DescribeStacksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Stacks"))
   {
@@ -35,6 +35,7 @@ DescribeTimeBasedAutoScalingResult::DescribeTimeBasedAutoScalingResult(const Ama
 
 DescribeTimeBasedAutoScalingResult& DescribeTimeBasedAutoScalingResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TimeBasedAutoScalingConfigurations"))
   {
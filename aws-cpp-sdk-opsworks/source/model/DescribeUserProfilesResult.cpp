@@ -35,6 +35,7 @@ DescribeUserProfilesResult::DescribeUserProfilesResult(const AmazonWebServiceRes
 
 DescribeUserProfilesResult& DescribeUserProfilesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("UserProfiles"))
   {
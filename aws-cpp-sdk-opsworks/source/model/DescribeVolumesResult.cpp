@@ -35,6 +35,7 @@ DescribeVolumesResult::DescribeVolumesResult(const AmazonWebServiceResult<JsonVa
 
 DescribeVolumesResult& DescribeVolumesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Volumes"))
   {
@@ -35,6 +35,7 @@ GetHostnameSuggestionResult::GetHostnameSuggestionResult(const AmazonWebServiceR
 
 GetHostnameSuggestionResult& GetHostnameSuggestionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("LayerId"))
   {
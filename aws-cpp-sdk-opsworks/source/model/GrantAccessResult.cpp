@@ -35,6 +35,7 @@ GrantAccessResult::GrantAccessResult(const AmazonWebServiceResult<JsonValue>& re
 
 GrantAccessResult& GrantAccessResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TemporaryCredential"))
   {
@@ -35,6 +35,7 @@ RegisterEcsClusterResult::RegisterEcsClusterResult(const AmazonWebServiceResult<
 
 RegisterEcsClusterResult& RegisterEcsClusterResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("EcsClusterArn"))
   {
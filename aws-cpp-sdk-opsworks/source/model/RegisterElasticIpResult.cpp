@@ -35,6 +35,7 @@ RegisterElasticIpResult::RegisterElasticIpResult(const AmazonWebServiceResult<Js
 
 RegisterElasticIpResult& RegisterElasticIpResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ElasticIp"))
   {
@@ -35,6 +35,7 @@ RegisterInstanceResult::RegisterInstanceResult(const AmazonWebServiceResult<Json
 
 RegisterInstanceResult& RegisterInstanceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("InstanceId"))
   {
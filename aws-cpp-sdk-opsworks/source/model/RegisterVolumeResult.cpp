@@ -35,6 +35,7 @@ RegisterVolumeResult::RegisterVolumeResult(const AmazonWebServiceResult<JsonValu
 
 RegisterVolumeResult& RegisterVolumeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeId"))
   {
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateDBClusterRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateDBCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateDBClusterSnapshotRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateDBClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
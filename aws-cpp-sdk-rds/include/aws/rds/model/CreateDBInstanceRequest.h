@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateDBInstanceRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateDBInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateDBSnapshotRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateDBSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
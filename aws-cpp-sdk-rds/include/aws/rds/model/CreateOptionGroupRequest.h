@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateOptionGroupRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateOptionGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
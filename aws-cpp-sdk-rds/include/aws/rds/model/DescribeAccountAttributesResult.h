@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/rds/model/ResponseMetadata.h>
 #include <aws/rds/model/AccountQuota.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Data returned by the <b>DescribeAccountAttributes</b> action.</p>
    */
-  class AWS_RDS_API DescribeAccountAttributesResult
+  class AWS_RDS_API DescribeAccountAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAccountAttributesResult();
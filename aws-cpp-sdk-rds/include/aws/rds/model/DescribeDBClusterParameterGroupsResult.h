@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/rds/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p/>
    */
-  class AWS_RDS_API DescribeDBClusterParameterGroupsResult
+  class AWS_RDS_API DescribeDBClusterParameterGroupsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDBClusterParameterGroupsResult();
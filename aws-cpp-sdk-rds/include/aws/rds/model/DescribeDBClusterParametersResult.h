@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/rds/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p>Provides details about a DB cluster parameter group including the parameters
    * in the DB cluster parameter group.</p>
    */
-  class AWS_RDS_API DescribeDBClusterParametersResult
+  class AWS_RDS_API DescribeDBClusterParametersResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDBClusterParametersResult();
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     DescribeDBClusterSnapshotsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeDBClusterSnapshots"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/rds/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p> Provides a list of DB cluster snapshots for the user as the result of a call
    * to the <a>DescribeDBClusterSnapshots</a> action. </p>
    */
-  class AWS_RDS_API DescribeDBClusterSnapshotsResult
+  class AWS_RDS_API DescribeDBClusterSnapshotsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDBClusterSnapshotsResult();
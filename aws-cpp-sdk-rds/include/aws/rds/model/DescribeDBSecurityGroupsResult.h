@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/rds/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p> Contains the result of a successful invocation of the
    * <a>DescribeDBSecurityGroups</a> action. </p>
    */
-  class AWS_RDS_API DescribeDBSecurityGroupsResult
+  class AWS_RDS_API DescribeDBSecurityGroupsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDBSecurityGroupsResult();
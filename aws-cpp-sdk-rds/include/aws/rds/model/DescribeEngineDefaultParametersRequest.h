@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     DescribeEngineDefaultParametersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeEngineDefaultParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/rds/model/ResponseMetadata.h>
 #include <aws/rds/model/EventCategoriesMap.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Data returned from the <b>DescribeEventCategories</b> action.</p>
    */
-  class AWS_RDS_API DescribeEventCategoriesResult
+  class AWS_RDS_API DescribeEventCategoriesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEventCategoriesResult();
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     DescribeOrderableDBInstanceOptionsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeOrderableDBInstanceOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
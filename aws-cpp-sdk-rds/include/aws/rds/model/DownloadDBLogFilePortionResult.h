@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/rds/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>This data type is used as a response element to
    * <a>DownloadDBLogFilePortion</a>.</p>
    */
-  class AWS_RDS_API DownloadDBLogFilePortionResult
+  class AWS_RDS_API DownloadDBLogFilePortionResult : public AmazonWebServiceResultBase
   {
   public:
     DownloadDBLogFilePortionResult();
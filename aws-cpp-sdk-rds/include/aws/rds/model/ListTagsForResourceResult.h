@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/rds/model/ResponseMetadata.h>
 #include <aws/rds/model/Tag.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p/>
    */
-  class AWS_RDS_API ListTagsForResourceResult
+  class AWS_RDS_API ListTagsForResourceResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForResourceResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/rds/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p/>
    */
-  class AWS_RDS_API ModifyDBClusterParameterGroupResult
+  class AWS_RDS_API ModifyDBClusterParameterGroupResult : public AmazonWebServiceResultBase
   {
   public:
     ModifyDBClusterParameterGroupResult();
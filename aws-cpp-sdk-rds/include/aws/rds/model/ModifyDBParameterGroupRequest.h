@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     ModifyDBParameterGroupRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ModifyDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
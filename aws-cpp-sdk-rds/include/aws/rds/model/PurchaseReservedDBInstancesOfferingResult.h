@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/rds/model/ReservedDBInstance.h>
 #include <aws/rds/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace RDS
 {
 namespace Model
 {
-  class AWS_RDS_API PurchaseReservedDBInstancesOfferingResult
+  class AWS_RDS_API PurchaseReservedDBInstancesOfferingResult : public AmazonWebServiceResultBase
   {
   public:
     PurchaseReservedDBInstancesOfferingResult();
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     ResetDBParameterGroupRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ResetDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/rds/RDS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/rds/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p> Contains the result of a successful invocation of the
    * <a>ModifyDBParameterGroup</a> or <a>ResetDBParameterGroup</a> action. </p>
    */
-  class AWS_RDS_API ResetDBParameterGroupResult
+  class AWS_RDS_API ResetDBParameterGroupResult : public AmazonWebServiceResultBase
   {
   public:
     ResetDBParameterGroupResult();
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     RestoreDBClusterToPointInTimeRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "RestoreDBClusterToPointInTime"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -37,6 +37,7 @@ ApplyPendingMaintenanceActionResult::ApplyPendingMaintenanceActionResult(const A
 
 ApplyPendingMaintenanceActionResult& ApplyPendingMaintenanceActionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CopyDBClusterSnapshotResult::CopyDBClusterSnapshotResult(const AmazonWebServiceR
 
 CopyDBClusterSnapshotResult& CopyDBClusterSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CopyDBSnapshotResult::CopyDBSnapshotResult(const AmazonWebServiceResult<XmlDocum
 
 CopyDBSnapshotResult& CopyDBSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateDBClusterParameterGroupResult::CreateDBClusterParameterGroupResult(const A
 
 CreateDBClusterParameterGroupResult& CreateDBClusterParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
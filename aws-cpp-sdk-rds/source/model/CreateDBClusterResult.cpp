@@ -37,6 +37,7 @@ CreateDBClusterResult::CreateDBClusterResult(const AmazonWebServiceResult<XmlDoc
 
 CreateDBClusterResult& CreateDBClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateDBInstanceReadReplicaResult::CreateDBInstanceReadReplicaResult(const Amazo
 
 CreateDBInstanceReadReplicaResult& CreateDBInstanceReadReplicaResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateDBSnapshotResult::CreateDBSnapshotResult(const AmazonWebServiceResult<XmlD
 
 CreateDBSnapshotResult& CreateDBSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteDBClusterResult::DeleteDBClusterResult(const AmazonWebServiceResult<XmlDoc
 
 DeleteDBClusterResult& DeleteDBClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
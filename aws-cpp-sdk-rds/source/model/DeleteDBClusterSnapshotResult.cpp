@@ -37,6 +37,7 @@ DeleteDBClusterSnapshotResult::DeleteDBClusterSnapshotResult(const AmazonWebServ
 
 DeleteDBClusterSnapshotResult& DeleteDBClusterSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DeleteDBInstanceResult::DeleteDBInstanceResult(const AmazonWebServiceResult<XmlD
 
 DeleteDBInstanceResult& DeleteDBInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
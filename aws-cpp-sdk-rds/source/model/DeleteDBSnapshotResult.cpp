@@ -37,6 +37,7 @@ DeleteDBSnapshotResult::DeleteDBSnapshotResult(const AmazonWebServiceResult<XmlD
 
 DeleteDBSnapshotResult& DeleteDBSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
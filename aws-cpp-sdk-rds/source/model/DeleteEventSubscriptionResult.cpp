@@ -37,6 +37,7 @@ DeleteEventSubscriptionResult::DeleteEventSubscriptionResult(const AmazonWebServ
 
 DeleteEventSubscriptionResult& DeleteEventSubscriptionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeAccountAttributesResult::DescribeAccountAttributesResult(const AmazonWeb
 
 DescribeAccountAttributesResult& DescribeAccountAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeDBClusterParametersResult::DescribeDBClusterParametersResult(const Amazo
 
 DescribeDBClusterParametersResult& DescribeDBClusterParametersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
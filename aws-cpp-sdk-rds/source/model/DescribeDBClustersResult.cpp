@@ -37,6 +37,7 @@ DescribeDBClustersResult::DescribeDBClustersResult(const AmazonWebServiceResult<
 
 DescribeDBClustersResult& DescribeDBClustersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeDBEngineVersionsResult::DescribeDBEngineVersionsResult(const AmazonWebSe
 
 DescribeDBEngineVersionsResult& DescribeDBEngineVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
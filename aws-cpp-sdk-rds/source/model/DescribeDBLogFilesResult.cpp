@@ -37,6 +37,7 @@ DescribeDBLogFilesResult::DescribeDBLogFilesResult(const AmazonWebServiceResult<
 
 DescribeDBLogFilesResult& DescribeDBLogFilesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeDBParameterGroupsResult::DescribeDBParameterGroupsResult(const AmazonWeb
 
 DescribeDBParameterGroupsResult& DescribeDBParameterGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
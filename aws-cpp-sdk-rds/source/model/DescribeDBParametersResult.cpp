@@ -37,6 +37,7 @@ DescribeDBParametersResult::DescribeDBParametersResult(const AmazonWebServiceRes
 
 DescribeDBParametersResult& DescribeDBParametersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
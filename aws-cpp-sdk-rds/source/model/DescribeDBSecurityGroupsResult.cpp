@@ -37,6 +37,7 @@ DescribeDBSecurityGroupsResult::DescribeDBSecurityGroupsResult(const AmazonWebSe
 
 DescribeDBSecurityGroupsResult& DescribeDBSecurityGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeDBSnapshotAttributesResult::DescribeDBSnapshotAttributesResult(const Ama
 
 DescribeDBSnapshotAttributesResult& DescribeDBSnapshotAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeEventCategoriesResult::DescribeEventCategoriesResult(const AmazonWebServ
 
 DescribeEventCategoriesResult& DescribeEventCategoriesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeOptionGroupOptionsResult::DescribeOptionGroupOptionsResult(const AmazonW
 
 DescribeOptionGroupOptionsResult& DescribeOptionGroupOptionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
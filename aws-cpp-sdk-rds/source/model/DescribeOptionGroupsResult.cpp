@@ -37,6 +37,7 @@ DescribeOptionGroupsResult::DescribeOptionGroupsResult(const AmazonWebServiceRes
 
 DescribeOptionGroupsResult& DescribeOptionGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeReservedDBInstancesResult::DescribeReservedDBInstancesResult(const Amazo
 
 DescribeReservedDBInstancesResult& DescribeReservedDBInstancesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ DownloadDBLogFilePortionResult::DownloadDBLogFilePortionResult(const AmazonWebSe
 
 DownloadDBLogFilePortionResult& DownloadDBLogFilePortionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ FailoverDBClusterResult::FailoverDBClusterResult(const AmazonWebServiceResult<Xm
 
 FailoverDBClusterResult& FailoverDBClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyDBClusterResult::ModifyDBClusterResult(const AmazonWebServiceResult<XmlDoc
 
 ModifyDBClusterResult& ModifyDBClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyDBInstanceResult::ModifyDBInstanceResult(const AmazonWebServiceResult<XmlD
 
 ModifyDBInstanceResult& ModifyDBInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
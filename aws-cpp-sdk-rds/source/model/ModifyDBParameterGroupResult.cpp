@@ -37,6 +37,7 @@ ModifyDBParameterGroupResult::ModifyDBParameterGroupResult(const AmazonWebServic
 
 ModifyDBParameterGroupResult& ModifyDBParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
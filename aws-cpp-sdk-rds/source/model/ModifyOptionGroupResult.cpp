@@ -37,6 +37,7 @@ ModifyOptionGroupResult::ModifyOptionGroupResult(const AmazonWebServiceResult<Xm
 
 ModifyOptionGroupResult& ModifyOptionGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ PromoteReadReplicaResult::PromoteReadReplicaResult(const AmazonWebServiceResult<
 
 PromoteReadReplicaResult& PromoteReadReplicaResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RebootDBInstanceResult::RebootDBInstanceResult(const AmazonWebServiceResult<XmlD
 
 RebootDBInstanceResult& RebootDBInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ResetDBClusterParameterGroupResult::ResetDBClusterParameterGroupResult(const Ama
 
 ResetDBClusterParameterGroupResult& ResetDBClusterParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
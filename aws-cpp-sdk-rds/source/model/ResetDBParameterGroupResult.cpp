@@ -37,6 +37,7 @@ ResetDBParameterGroupResult::ResetDBParameterGroupResult(const AmazonWebServiceR
 
 ResetDBParameterGroupResult& ResetDBParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
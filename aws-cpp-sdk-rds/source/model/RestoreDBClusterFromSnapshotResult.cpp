@@ -37,6 +37,7 @@ RestoreDBClusterFromSnapshotResult::RestoreDBClusterFromSnapshotResult(const Ama
 
 RestoreDBClusterFromSnapshotResult& RestoreDBClusterFromSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
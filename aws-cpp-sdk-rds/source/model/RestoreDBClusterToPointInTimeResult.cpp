@@ -37,6 +37,7 @@ RestoreDBClusterToPointInTimeResult::RestoreDBClusterToPointInTimeResult(const A
 
 RestoreDBClusterToPointInTimeResult& RestoreDBClusterToPointInTimeResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RevokeDBSecurityGroupIngressResult::RevokeDBSecurityGroupIngressResult(const Ama
 
 RevokeDBSecurityGroupIngressResult& RevokeDBSecurityGroupIngressResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     CopyClusterSnapshotRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CopyClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,10 @@ namespace Model
   {
   public:
     CreateClusterParameterGroupRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
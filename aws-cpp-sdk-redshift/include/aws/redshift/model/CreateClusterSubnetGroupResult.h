@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/redshift/model/ClusterSubnetGroup.h>
 #include <aws/redshift/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace Redshift
 {
 namespace Model
 {
-  class AWS_REDSHIFT_API CreateClusterSubnetGroupResult
+  class AWS_REDSHIFT_API CreateClusterSubnetGroupResult : public AmazonWebServiceResultBase
   {
   public:
     CreateClusterSubnetGroupResult();
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     DeleteClusterSecurityGroupRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteClusterSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
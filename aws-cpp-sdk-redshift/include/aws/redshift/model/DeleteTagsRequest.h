@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DeleteTagsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteTags"; }
+
     Aws::String SerializePayload() const override;
 
     /**
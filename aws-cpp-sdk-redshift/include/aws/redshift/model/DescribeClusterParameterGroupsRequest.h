@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeClusterParameterGroupsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterParameterGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     DescribeClustersRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DescribeClusters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/redshift/model/ResponseMetadata.h>
 #include <aws/redshift/model/EventCategoriesMap.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p> </p>
    */
-  class AWS_REDSHIFT_API DescribeEventCategoriesResult
+  class AWS_REDSHIFT_API DescribeEventCategoriesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeEventCategoriesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/redshift/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p/>
    */
-  class AWS_REDSHIFT_API DescribeHsmConfigurationsResult
+  class AWS_REDSHIFT_API DescribeHsmConfigurationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeHsmConfigurationsResult();
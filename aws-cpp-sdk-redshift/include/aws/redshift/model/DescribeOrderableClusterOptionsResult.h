@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/redshift/model/ResponseMetadata.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p> Contains the output from the <a>DescribeOrderableClusterOptions</a> action.
    * </p>
    */
-  class AWS_REDSHIFT_API DescribeOrderableClusterOptionsResult
+  class AWS_REDSHIFT_API DescribeOrderableClusterOptionsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeOrderableClusterOptionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/redshift/model/ResponseMetadata.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Describes the result of a cluster resize operation.</p>
    */
-  class AWS_REDSHIFT_API DescribeResizeResult
+  class AWS_REDSHIFT_API DescribeResizeResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeResizeResult();
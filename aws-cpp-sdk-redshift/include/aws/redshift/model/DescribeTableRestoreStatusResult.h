@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/redshift/model/ResponseMetadata.h>
@@ -35,7 +36,7 @@ namespace Redshift
 {
 namespace Model
 {
-  class AWS_REDSHIFT_API DescribeTableRestoreStatusResult
+  class AWS_REDSHIFT_API DescribeTableRestoreStatusResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTableRestoreStatusResult();
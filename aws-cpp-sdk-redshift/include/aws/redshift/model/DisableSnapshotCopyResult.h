@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/redshift/model/Cluster.h>
 #include <aws/redshift/model/ResponseMetadata.h>
 
@@ -33,7 +34,7 @@ namespace Redshift
 {
 namespace Model
 {
-  class AWS_REDSHIFT_API DisableSnapshotCopyResult
+  class AWS_REDSHIFT_API DisableSnapshotCopyResult : public AmazonWebServiceResultBase
   {
   public:
     DisableSnapshotCopyResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/redshift/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Describes the status of logging for a cluster.</p>
    */
-  class AWS_REDSHIFT_API EnableLoggingResult
+  class AWS_REDSHIFT_API EnableLoggingResult : public AmazonWebServiceResultBase
   {
   public:
     EnableLoggingResult();
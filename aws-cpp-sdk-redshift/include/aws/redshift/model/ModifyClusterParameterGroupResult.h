@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/redshift/Redshift_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/redshift/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p> </p>
    */
-  class AWS_REDSHIFT_API ModifyClusterParameterGroupResult
+  class AWS_REDSHIFT_API ModifyClusterParameterGroupResult : public AmazonWebServiceResultBase
   {
   public:
     ModifyClusterParameterGroupResult();
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     ModifySnapshotCopyRetentionPeriodRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ModifySnapshotCopyRetentionPeriod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
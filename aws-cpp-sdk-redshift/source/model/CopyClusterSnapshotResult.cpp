@@ -37,6 +37,7 @@ CopyClusterSnapshotResult::CopyClusterSnapshotResult(const AmazonWebServiceResul
 
 CopyClusterSnapshotResult& CopyClusterSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
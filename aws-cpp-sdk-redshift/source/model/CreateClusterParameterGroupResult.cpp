@@ -37,6 +37,7 @@ CreateClusterParameterGroupResult::CreateClusterParameterGroupResult(const Amazo
 
 CreateClusterParameterGroupResult& CreateClusterParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
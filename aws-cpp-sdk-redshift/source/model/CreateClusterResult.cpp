@@ -37,6 +37,7 @@ CreateClusterResult::CreateClusterResult(const AmazonWebServiceResult<XmlDocumen
 
 CreateClusterResult& CreateClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateClusterSnapshotResult::CreateClusterSnapshotResult(const AmazonWebServiceR
 
 CreateClusterSnapshotResult& CreateClusterSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateClusterSubnetGroupResult::CreateClusterSubnetGroupResult(const AmazonWebSe
 
 CreateClusterSubnetGroupResult& CreateClusterSubnetGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateEventSubscriptionResult::CreateEventSubscriptionResult(const AmazonWebServ
 
 CreateEventSubscriptionResult& CreateEventSubscriptionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateHsmClientCertificateResult::CreateHsmClientCertificateResult(const AmazonW
 
 CreateHsmClientCertificateResult& CreateHsmClientCertificateResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
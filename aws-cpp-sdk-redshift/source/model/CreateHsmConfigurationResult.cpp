@@ -37,6 +37,7 @@ CreateHsmConfigurationResult::CreateHsmConfigurationResult(const AmazonWebServic
 
 CreateHsmConfigurationResult& CreateHsmConfigurationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateSnapshotCopyGrantResult::CreateSnapshotCopyGrantResult(const AmazonWebServ
 
 CreateSnapshotCopyGrantResult& CreateSnapshotCopyGrantResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
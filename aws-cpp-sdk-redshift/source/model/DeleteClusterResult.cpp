@@ -37,6 +37,7 @@ DeleteClusterResult::DeleteClusterResult(const AmazonWebServiceResult<XmlDocumen
 
 DeleteClusterResult& DeleteClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
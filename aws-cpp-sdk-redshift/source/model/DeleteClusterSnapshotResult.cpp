@@ -37,6 +37,7 @@ DeleteClusterSnapshotResult::DeleteClusterSnapshotResult(const AmazonWebServiceR
 
 DeleteClusterSnapshotResult& DeleteClusterSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeClusterParametersResult::DescribeClusterParametersResult(const AmazonWeb
 
 DescribeClusterParametersResult& DescribeClusterParametersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeClusterSecurityGroupsResult::DescribeClusterSecurityGroupsResult(const A
 
 DescribeClusterSecurityGroupsResult& DescribeClusterSecurityGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
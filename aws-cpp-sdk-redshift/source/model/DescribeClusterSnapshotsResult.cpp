@@ -37,6 +37,7 @@ DescribeClusterSnapshotsResult::DescribeClusterSnapshotsResult(const AmazonWebSe
 
 DescribeClusterSnapshotsResult& DescribeClusterSnapshotsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeClusterSubnetGroupsResult::DescribeClusterSubnetGroupsResult(const Amazo
 
 DescribeClusterSubnetGroupsResult& DescribeClusterSubnetGroupsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
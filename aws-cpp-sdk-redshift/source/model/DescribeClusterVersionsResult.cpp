@@ -37,6 +37,7 @@ DescribeClusterVersionsResult::DescribeClusterVersionsResult(const AmazonWebServ
 
 DescribeClusterVersionsResult& DescribeClusterVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeClustersResult::DescribeClustersResult(const AmazonWebServiceResult<XmlD
 
 DescribeClustersResult& DescribeClustersResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeEventSubscriptionsResult::DescribeEventSubscriptionsResult(const AmazonW
 
 DescribeEventSubscriptionsResult& DescribeEventSubscriptionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
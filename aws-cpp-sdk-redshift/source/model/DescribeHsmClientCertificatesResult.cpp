@@ -37,6 +37,7 @@ DescribeHsmClientCertificatesResult::DescribeHsmClientCertificatesResult(const A
 
 DescribeHsmClientCertificatesResult& DescribeHsmClientCertificatesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
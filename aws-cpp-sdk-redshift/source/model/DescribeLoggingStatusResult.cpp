@@ -43,6 +43,7 @@ DescribeLoggingStatusResult::DescribeLoggingStatusResult(const AmazonWebServiceR
 
 DescribeLoggingStatusResult& DescribeLoggingStatusResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
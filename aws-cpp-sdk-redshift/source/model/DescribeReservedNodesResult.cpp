@@ -37,6 +37,7 @@ DescribeReservedNodesResult::DescribeReservedNodesResult(const AmazonWebServiceR
 
 DescribeReservedNodesResult& DescribeReservedNodesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -49,6 +49,7 @@ DescribeResizeResult::DescribeResizeResult(const AmazonWebServiceResult<XmlDocum
 
 DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DescribeSnapshotCopyGrantsResult::DescribeSnapshotCopyGrantsResult(const AmazonW
 
 DescribeSnapshotCopyGrantsResult& DescribeSnapshotCopyGrantsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
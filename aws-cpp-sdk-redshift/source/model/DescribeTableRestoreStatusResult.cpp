@@ -37,6 +37,7 @@ DescribeTableRestoreStatusResult::DescribeTableRestoreStatusResult(const AmazonW
 
 DescribeTableRestoreStatusResult& DescribeTableRestoreStatusResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
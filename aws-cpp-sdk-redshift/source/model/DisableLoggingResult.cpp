@@ -43,6 +43,7 @@ DisableLoggingResult::DisableLoggingResult(const AmazonWebServiceResult<XmlDocum
 
 DisableLoggingResult& DisableLoggingResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -43,6 +43,7 @@ EnableLoggingResult::EnableLoggingResult(const AmazonWebServiceResult<XmlDocumen
 
 EnableLoggingResult& EnableLoggingResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyClusterParameterGroupResult::ModifyClusterParameterGroupResult(const Amazo
 
 ModifyClusterParameterGroupResult& ModifyClusterParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
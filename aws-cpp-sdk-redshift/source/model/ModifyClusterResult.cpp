@@ -37,6 +37,7 @@ ModifyClusterResult::ModifyClusterResult(const AmazonWebServiceResult<XmlDocumen
 
 ModifyClusterResult& ModifyClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyClusterSubnetGroupResult::ModifyClusterSubnetGroupResult(const AmazonWebSe
 
 ModifyClusterSubnetGroupResult& ModifyClusterSubnetGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifyEventSubscriptionResult::ModifyEventSubscriptionResult(const AmazonWebServ
 
 ModifyEventSubscriptionResult& ModifyEventSubscriptionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ModifySnapshotCopyRetentionPeriodResult::ModifySnapshotCopyRetentionPeriodResult
 
 ModifySnapshotCopyRetentionPeriodResult& ModifySnapshotCopyRetentionPeriodResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ PurchaseReservedNodeOfferingResult::PurchaseReservedNodeOfferingResult(const Ama
 
 PurchaseReservedNodeOfferingResult& PurchaseReservedNodeOfferingResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RebootClusterResult::RebootClusterResult(const AmazonWebServiceResult<XmlDocumen
 
 RebootClusterResult& RebootClusterResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
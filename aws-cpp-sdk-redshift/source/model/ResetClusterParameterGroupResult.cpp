@@ -37,6 +37,7 @@ ResetClusterParameterGroupResult::ResetClusterParameterGroupResult(const AmazonW
 
 ResetClusterParameterGroupResult& ResetClusterParameterGroupResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RestoreFromClusterSnapshotResult::RestoreFromClusterSnapshotResult(const AmazonW
 
 RestoreFromClusterSnapshotResult& RestoreFromClusterSnapshotResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ RevokeSnapshotAccessResult::RevokeSnapshotAccessResult(const AmazonWebServiceRes
 
 RevokeSnapshotAccessResult& RevokeSnapshotAccessResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     ChangeTagsForResourceRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ChangeTagsForResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
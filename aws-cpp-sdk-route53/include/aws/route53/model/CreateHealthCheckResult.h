@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/HealthCheck.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>A complex type containing the response information for the new health
    * check.</p>
    */
-  class AWS_ROUTE53_API CreateHealthCheckResult
+  class AWS_ROUTE53_API CreateHealthCheckResult : public AmazonWebServiceResultBase
   {
   public:
     CreateHealthCheckResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/HostedZone.h>
 #include <aws/route53/model/ChangeInfo.h>
 #include <aws/route53/model/DelegationSet.h>
@@ -40,7 +41,7 @@ namespace Model
    * <p>A complex type containing the response information for the new hosted
    * zone.</p>
    */
-  class AWS_ROUTE53_API CreateHostedZoneResult
+  class AWS_ROUTE53_API CreateHostedZoneResult : public AmazonWebServiceResultBase
   {
   public:
     CreateHostedZoneResult();
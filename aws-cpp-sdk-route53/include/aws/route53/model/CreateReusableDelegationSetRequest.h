@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     CreateReusableDelegationSetRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CreateReusableDelegationSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
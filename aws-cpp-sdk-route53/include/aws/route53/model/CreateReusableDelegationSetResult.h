@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/DelegationSet.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace Route53
 {
 namespace Model
 {
-  class AWS_ROUTE53_API CreateReusableDelegationSetResult
+  class AWS_ROUTE53_API CreateReusableDelegationSetResult : public AmazonWebServiceResultBase
   {
   public:
     CreateReusableDelegationSetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/TrafficPolicyInstance.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>A complex type that contains the response information for the
    * <code>CreateTrafficPolicyInstance</code> request.</p>
    */
-  class AWS_ROUTE53_API CreateTrafficPolicyInstanceResult
+  class AWS_ROUTE53_API CreateTrafficPolicyInstanceResult : public AmazonWebServiceResultBase
   {
   public:
     CreateTrafficPolicyInstanceResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/TrafficPolicy.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>A complex type that contains the response information for the
    * <code>CreateTrafficPolicy</code> request.</p>
    */
-  class AWS_ROUTE53_API CreateTrafficPolicyResult
+  class AWS_ROUTE53_API CreateTrafficPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     CreateTrafficPolicyResult();
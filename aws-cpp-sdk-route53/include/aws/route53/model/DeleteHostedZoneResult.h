@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/ChangeInfo.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A complex type containing the response information for the request.</p>
    */
-  class AWS_ROUTE53_API DeleteHostedZoneResult
+  class AWS_ROUTE53_API DeleteHostedZoneResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteHostedZoneResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Empty response for the request.</p>
    */
-  class AWS_ROUTE53_API DeleteReusableDelegationSetResult
+  class AWS_ROUTE53_API DeleteReusableDelegationSetResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteReusableDelegationSetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/ChangeInfo.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A complex type that contains the <code>ChangeInfo</code> element.</p>
    */
-  class AWS_ROUTE53_API GetChangeResult
+  class AWS_ROUTE53_API GetChangeResult : public AmazonWebServiceResultBase
   {
   public:
     GetChangeResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>A complex type that contains the <code>CheckerIpRanges</code> element.</p>
    */
-  class AWS_ROUTE53_API GetCheckerIpRangesResult
+  class AWS_ROUTE53_API GetCheckerIpRangesResult : public AmazonWebServiceResultBase
   {
   public:
     GetCheckerIpRangesResult();
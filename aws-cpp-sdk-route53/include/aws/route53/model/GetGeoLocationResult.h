@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/GeoLocationDetails.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A complex type containing information about the specified geo location.</p>
    */
-  class AWS_ROUTE53_API GetGeoLocationResult
+  class AWS_ROUTE53_API GetGeoLocationResult : public AmazonWebServiceResultBase
   {
   public:
     GetGeoLocationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -35,7 +36,7 @@ namespace Model
    * <p>A complex type that contains the count of health checks associated with the
    * current AWS account.</p>
    */
-  class AWS_ROUTE53_API GetHealthCheckCountResult
+  class AWS_ROUTE53_API GetHealthCheckCountResult : public AmazonWebServiceResultBase
   {
   public:
     GetHealthCheckCountResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/route53/model/HealthCheckObservation.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>A complex type that contains information about the most recent failure for
    * the specified health check.</p>
    */
-  class AWS_ROUTE53_API GetHealthCheckLastFailureReasonResult
+  class AWS_ROUTE53_API GetHealthCheckLastFailureReasonResult : public AmazonWebServiceResultBase
   {
   public:
     GetHealthCheckLastFailureReasonResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/HealthCheck.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A complex type containing information about the specified health check.</p>
    */
-  class AWS_ROUTE53_API GetHealthCheckResult
+  class AWS_ROUTE53_API GetHealthCheckResult : public AmazonWebServiceResultBase
   {
   public:
     GetHealthCheckResult();
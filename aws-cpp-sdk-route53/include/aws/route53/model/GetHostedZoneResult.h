@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/HostedZone.h>
 #include <aws/route53/model/DelegationSet.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>A complex type containing information about the specified hosted zone.</p>
    */
-  class AWS_ROUTE53_API GetHostedZoneResult
+  class AWS_ROUTE53_API GetHostedZoneResult : public AmazonWebServiceResultBase
   {
   public:
     GetHostedZoneResult();
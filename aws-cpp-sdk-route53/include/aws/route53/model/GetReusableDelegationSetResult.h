@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/DelegationSet.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>A complex type containing information about the specified reusable delegation
    * set.</p>
    */
-  class AWS_ROUTE53_API GetReusableDelegationSetResult
+  class AWS_ROUTE53_API GetReusableDelegationSetResult : public AmazonWebServiceResultBase
   {
   public:
     GetReusableDelegationSetResult();
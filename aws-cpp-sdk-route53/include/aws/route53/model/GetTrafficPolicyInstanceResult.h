@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/TrafficPolicyInstance.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>A complex type that contains information about the resource record sets that
    * Amazon Route 53 created based on a specified traffic policy.</p>
    */
-  class AWS_ROUTE53_API GetTrafficPolicyInstanceResult
+  class AWS_ROUTE53_API GetTrafficPolicyInstanceResult : public AmazonWebServiceResultBase
   {
   public:
     GetTrafficPolicyInstanceResult();
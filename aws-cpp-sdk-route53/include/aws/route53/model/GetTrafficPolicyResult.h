@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/TrafficPolicy.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A complex type that contains the response information for the request.</p>
    */
-  class AWS_ROUTE53_API GetTrafficPolicyResult
+  class AWS_ROUTE53_API GetTrafficPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetTrafficPolicyResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/route53/model/GeoLocationDetails.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>A complex type that contains information about the geo locations that are
    * returned by the request and information about the response.</p>
    */
-  class AWS_ROUTE53_API ListGeoLocationsResult
+  class AWS_ROUTE53_API ListGeoLocationsResult : public AmazonWebServiceResultBase
   {
   public:
     ListGeoLocationsResult();
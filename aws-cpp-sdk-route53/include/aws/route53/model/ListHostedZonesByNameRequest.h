@@ -47,6 +47,10 @@ namespace Model
   {
   public:
     ListHostedZonesByNameRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListHostedZonesByName"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/route53/model/RRType.h>
@@ -39,7 +40,7 @@ namespace Model
    * <p>A complex type that contains information about the resource record sets that
    * are returned by the request and information about the response.</p>
    */
-  class AWS_ROUTE53_API ListResourceRecordSetsResult
+  class AWS_ROUTE53_API ListResourceRecordSetsResult : public AmazonWebServiceResultBase
   {
   public:
     ListResourceRecordSetsResult();
@@ -44,6 +44,10 @@ namespace Model
   {
   public:
     ListReusableDelegationSetsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListReusableDelegationSets"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
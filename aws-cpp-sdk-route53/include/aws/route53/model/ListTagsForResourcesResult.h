@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/route53/model/ResourceTagSet.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>A complex type containing tags for the specified resources.</p>
    */
-  class AWS_ROUTE53_API ListTagsForResourcesResult
+  class AWS_ROUTE53_API ListTagsForResourcesResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForResourcesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/route53/model/RRType.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>A complex type that contains the response information for the request.</p>
    */
-  class AWS_ROUTE53_API ListTrafficPolicyInstancesByPolicyResult
+  class AWS_ROUTE53_API ListTrafficPolicyInstancesByPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     ListTrafficPolicyInstancesByPolicyResult();
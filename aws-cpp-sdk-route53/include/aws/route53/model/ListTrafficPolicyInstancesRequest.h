@@ -37,6 +37,10 @@ namespace Model
   {
   public:
     ListTrafficPolicyInstancesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicyInstances"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
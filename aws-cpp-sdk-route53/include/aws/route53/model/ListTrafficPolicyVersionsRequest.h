@@ -36,6 +36,10 @@ namespace Model
   {
   public:
     ListTrafficPolicyVersionsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicyVersions"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
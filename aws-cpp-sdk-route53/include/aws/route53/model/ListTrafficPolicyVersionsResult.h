@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/route53/model/TrafficPolicy.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>A complex type that contains the response information for the request.</p>
    */
-  class AWS_ROUTE53_API ListTrafficPolicyVersionsResult
+  class AWS_ROUTE53_API ListTrafficPolicyVersionsResult : public AmazonWebServiceResultBase
   {
   public:
     ListTrafficPolicyVersionsResult();
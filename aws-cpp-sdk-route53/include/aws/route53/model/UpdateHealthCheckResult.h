@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/HealthCheck.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace Route53
 {
 namespace Model
 {
-  class AWS_ROUTE53_API UpdateHealthCheckResult
+  class AWS_ROUTE53_API UpdateHealthCheckResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateHealthCheckResult();
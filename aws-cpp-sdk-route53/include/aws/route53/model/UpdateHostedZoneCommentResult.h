@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53/Route53_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53/model/HostedZone.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>A complex type containing information about the specified hosted zone after
    * the update.</p>
    */
-  class AWS_ROUTE53_API UpdateHostedZoneCommentResult
+  class AWS_ROUTE53_API UpdateHostedZoneCommentResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateHostedZoneCommentResult();
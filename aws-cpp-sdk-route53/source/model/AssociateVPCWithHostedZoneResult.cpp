@@ -35,6 +35,7 @@ AssociateVPCWithHostedZoneResult::AssociateVPCWithHostedZoneResult(const AmazonW
 
 AssociateVPCWithHostedZoneResult& AssociateVPCWithHostedZoneResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
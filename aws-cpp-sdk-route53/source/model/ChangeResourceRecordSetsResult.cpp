@@ -35,6 +35,7 @@ ChangeResourceRecordSetsResult::ChangeResourceRecordSetsResult(const AmazonWebSe
 
 ChangeResourceRecordSetsResult& ChangeResourceRecordSetsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ ChangeTagsForResourceResult::ChangeTagsForResourceResult(const AmazonWebServiceR
 
 ChangeTagsForResourceResult& ChangeTagsForResourceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ CreateHealthCheckResult::CreateHealthCheckResult(const AmazonWebServiceResult<Xm
 
 CreateHealthCheckResult& CreateHealthCheckResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ CreateHostedZoneResult::CreateHostedZoneResult(const AmazonWebServiceResult<XmlD
 
 CreateHostedZoneResult& CreateHostedZoneResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ CreateReusableDelegationSetResult::CreateReusableDelegationSetResult(const Amazo
 
 CreateReusableDelegationSetResult& CreateReusableDelegationSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
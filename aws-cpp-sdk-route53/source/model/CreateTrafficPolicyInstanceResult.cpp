@@ -36,6 +36,7 @@ CreateTrafficPolicyInstanceResult::CreateTrafficPolicyInstanceResult(const Amazo
 
 CreateTrafficPolicyInstanceResult& CreateTrafficPolicyInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
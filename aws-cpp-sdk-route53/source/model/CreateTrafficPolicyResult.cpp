@@ -36,6 +36,7 @@ CreateTrafficPolicyResult::CreateTrafficPolicyResult(const AmazonWebServiceResul
 
 CreateTrafficPolicyResult& CreateTrafficPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
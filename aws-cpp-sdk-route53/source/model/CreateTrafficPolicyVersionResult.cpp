@@ -36,6 +36,7 @@ CreateTrafficPolicyVersionResult::CreateTrafficPolicyVersionResult(const AmazonW
 
 CreateTrafficPolicyVersionResult& CreateTrafficPolicyVersionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ DeleteHealthCheckResult::DeleteHealthCheckResult(const AmazonWebServiceResult<Xm
 
 DeleteHealthCheckResult& DeleteHealthCheckResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
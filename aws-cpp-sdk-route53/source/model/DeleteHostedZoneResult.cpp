@@ -35,6 +35,7 @@ DeleteHostedZoneResult::DeleteHostedZoneResult(const AmazonWebServiceResult<XmlD
 
 DeleteHostedZoneResult& DeleteHostedZoneResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ DeleteReusableDelegationSetResult::DeleteReusableDelegationSetResult(const Amazo
 
 DeleteReusableDelegationSetResult& DeleteReusableDelegationSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
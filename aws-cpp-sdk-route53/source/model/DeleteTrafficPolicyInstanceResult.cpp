@@ -35,6 +35,7 @@ DeleteTrafficPolicyInstanceResult::DeleteTrafficPolicyInstanceResult(const Amazo
 
 DeleteTrafficPolicyInstanceResult& DeleteTrafficPolicyInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ DeleteTrafficPolicyResult::DeleteTrafficPolicyResult(const AmazonWebServiceResul
 
 DeleteTrafficPolicyResult& DeleteTrafficPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
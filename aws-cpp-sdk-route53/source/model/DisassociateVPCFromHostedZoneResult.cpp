@@ -35,6 +35,7 @@ DisassociateVPCFromHostedZoneResult::DisassociateVPCFromHostedZoneResult(const A
 
 DisassociateVPCFromHostedZoneResult& DisassociateVPCFromHostedZoneResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetChangeResult::GetChangeResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 GetChangeResult& GetChangeResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetCheckerIpRangesResult::GetCheckerIpRangesResult(const AmazonWebServiceResult<
 
 GetCheckerIpRangesResult& GetCheckerIpRangesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
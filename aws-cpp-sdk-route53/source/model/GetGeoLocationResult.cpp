@@ -35,6 +35,7 @@ GetGeoLocationResult::GetGeoLocationResult(const AmazonWebServiceResult<XmlDocum
 
 GetGeoLocationResult& GetGeoLocationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ GetHealthCheckCountResult::GetHealthCheckCountResult(const AmazonWebServiceResul
 
 GetHealthCheckCountResult& GetHealthCheckCountResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
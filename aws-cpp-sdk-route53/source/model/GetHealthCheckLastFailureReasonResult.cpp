@@ -35,6 +35,7 @@ GetHealthCheckLastFailureReasonResult::GetHealthCheckLastFailureReasonResult(con
 
 GetHealthCheckLastFailureReasonResult& GetHealthCheckLastFailureReasonResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
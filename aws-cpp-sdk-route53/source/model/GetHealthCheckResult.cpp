@@ -35,6 +35,7 @@ GetHealthCheckResult::GetHealthCheckResult(const AmazonWebServiceResult<XmlDocum
 
 GetHealthCheckResult& GetHealthCheckResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
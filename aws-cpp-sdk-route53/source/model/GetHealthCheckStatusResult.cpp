@@ -35,6 +35,7 @@ GetHealthCheckStatusResult::GetHealthCheckStatusResult(const AmazonWebServiceRes
 
 GetHealthCheckStatusResult& GetHealthCheckStatusResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ GetHostedZoneCountResult::GetHostedZoneCountResult(const AmazonWebServiceResult<
 
 GetHostedZoneCountResult& GetHostedZoneCountResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetHostedZoneResult::GetHostedZoneResult(const AmazonWebServiceResult<XmlDocumen
 
 GetHostedZoneResult& GetHostedZoneResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetReusableDelegationSetResult::GetReusableDelegationSetResult(const AmazonWebSe
 
 GetReusableDelegationSetResult& GetReusableDelegationSetResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ GetTrafficPolicyInstanceCountResult::GetTrafficPolicyInstanceCountResult(const A
 
 GetTrafficPolicyInstanceCountResult& GetTrafficPolicyInstanceCountResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
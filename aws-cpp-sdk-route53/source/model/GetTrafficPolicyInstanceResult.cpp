@@ -35,6 +35,7 @@ GetTrafficPolicyInstanceResult::GetTrafficPolicyInstanceResult(const AmazonWebSe
 
 GetTrafficPolicyInstanceResult& GetTrafficPolicyInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetTrafficPolicyResult::GetTrafficPolicyResult(const AmazonWebServiceResult<XmlD
 
 GetTrafficPolicyResult& GetTrafficPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ ListGeoLocationsResult::ListGeoLocationsResult(const AmazonWebServiceResult<XmlD
 
 ListGeoLocationsResult& ListGeoLocationsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
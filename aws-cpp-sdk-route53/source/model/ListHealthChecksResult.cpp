@@ -37,6 +37,7 @@ ListHealthChecksResult::ListHealthChecksResult(const AmazonWebServiceResult<XmlD
 
 ListHealthChecksResult& ListHealthChecksResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ ListHostedZonesByNameResult::ListHostedZonesByNameResult(const AmazonWebServiceR
 
 ListHostedZonesByNameResult& ListHostedZonesByNameResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ ListHostedZonesResult::ListHostedZonesResult(const AmazonWebServiceResult<XmlDoc
 
 ListHostedZonesResult& ListHostedZonesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
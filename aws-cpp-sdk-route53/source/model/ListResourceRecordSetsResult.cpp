@@ -37,6 +37,7 @@ ListResourceRecordSetsResult::ListResourceRecordSetsResult(const AmazonWebServic
 
 ListResourceRecordSetsResult& ListResourceRecordSetsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
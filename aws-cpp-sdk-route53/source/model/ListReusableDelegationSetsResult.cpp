@@ -37,6 +37,7 @@ ListReusableDelegationSetsResult::ListReusableDelegationSetsResult(const AmazonW
 
 ListReusableDelegationSetsResult& ListReusableDelegationSetsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
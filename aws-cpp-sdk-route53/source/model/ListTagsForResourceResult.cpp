@@ -35,6 +35,7 @@ ListTagsForResourceResult::ListTagsForResourceResult(const AmazonWebServiceResul
 
 ListTagsForResourceResult& ListTagsForResourceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
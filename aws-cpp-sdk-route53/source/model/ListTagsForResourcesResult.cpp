@@ -35,6 +35,7 @@ ListTagsForResourcesResult::ListTagsForResourcesResult(const AmazonWebServiceRes
 
 ListTagsForResourcesResult& ListTagsForResourcesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ ListTrafficPoliciesResult::ListTrafficPoliciesResult(const AmazonWebServiceResul
 
 ListTrafficPoliciesResult& ListTrafficPoliciesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
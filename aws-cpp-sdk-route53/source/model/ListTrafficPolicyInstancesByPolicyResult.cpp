@@ -37,6 +37,7 @@ ListTrafficPolicyInstancesByPolicyResult::ListTrafficPolicyInstancesByPolicyResu
 
 ListTrafficPolicyInstancesByPolicyResult& ListTrafficPolicyInstancesByPolicyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -37,6 +37,7 @@ ListTrafficPolicyInstancesResult::ListTrafficPolicyInstancesResult(const AmazonW
 
 ListTrafficPolicyInstancesResult& ListTrafficPolicyInstancesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
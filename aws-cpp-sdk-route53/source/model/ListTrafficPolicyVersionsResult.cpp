@@ -37,6 +37,7 @@ ListTrafficPolicyVersionsResult::ListTrafficPolicyVersionsResult(const AmazonWeb
 
 ListTrafficPolicyVersionsResult& ListTrafficPolicyVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ UpdateHealthCheckResult::UpdateHealthCheckResult(const AmazonWebServiceResult<Xm
 
 UpdateHealthCheckResult& UpdateHealthCheckResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ UpdateHostedZoneCommentResult::UpdateHostedZoneCommentResult(const AmazonWebServ
 
 UpdateHostedZoneCommentResult& UpdateHostedZoneCommentResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ UpdateTrafficPolicyCommentResult::UpdateTrafficPolicyCommentResult(const AmazonW
 
 UpdateTrafficPolicyCommentResult& UpdateTrafficPolicyCommentResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
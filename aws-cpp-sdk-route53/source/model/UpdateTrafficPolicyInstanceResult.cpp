@@ -35,6 +35,7 @@ UpdateTrafficPolicyInstanceResult::UpdateTrafficPolicyInstanceResult(const Amazo
 
 UpdateTrafficPolicyInstanceResult& UpdateTrafficPolicyInstanceResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
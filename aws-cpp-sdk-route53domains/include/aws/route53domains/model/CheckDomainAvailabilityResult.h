@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/route53domains/model/DomainAvailability.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The CheckDomainAvailability response includes the following elements.</p>
    */
-  class AWS_ROUTE53DOMAINS_API CheckDomainAvailabilityResult
+  class AWS_ROUTE53DOMAINS_API CheckDomainAvailabilityResult : public AmazonWebServiceResultBase
   {
   public:
     CheckDomainAvailabilityResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -31,7 +32,7 @@ namespace Route53Domains
 {
 namespace Model
 {
-  class AWS_ROUTE53DOMAINS_API DisableDomainAutoRenewResult
+  class AWS_ROUTE53DOMAINS_API DisableDomainAutoRenewResult : public AmazonWebServiceResultBase
   {
   public:
     DisableDomainAutoRenewResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/route53domains/model/ContactDetail.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>The GetDomainDetail response includes the following elements.</p>
    */
-  class AWS_ROUTE53DOMAINS_API GetDomainDetailResult
+  class AWS_ROUTE53DOMAINS_API GetDomainDetailResult : public AmazonWebServiceResultBase
   {
   public:
     GetDomainDetailResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/route53domains/model/DomainSummary.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The ListDomains response includes the following elements.</p>
    */
-  class AWS_ROUTE53DOMAINS_API ListDomainsResult
+  class AWS_ROUTE53DOMAINS_API ListDomainsResult : public AmazonWebServiceResultBase
   {
   public:
     ListDomainsResult();
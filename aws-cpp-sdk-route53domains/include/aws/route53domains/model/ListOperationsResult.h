@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/route53domains/model/OperationSummary.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The ListOperations response includes the following elements.</p>
    */
-  class AWS_ROUTE53DOMAINS_API ListOperationsResult
+  class AWS_ROUTE53DOMAINS_API ListOperationsResult : public AmazonWebServiceResultBase
   {
   public:
     ListOperationsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/route53domains/model/Tag.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The ListTagsForDomain response includes the following elements.</p>
    */
-  class AWS_ROUTE53DOMAINS_API ListTagsForDomainResult
+  class AWS_ROUTE53DOMAINS_API ListTagsForDomainResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForDomainResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/route53domains/Route53Domains_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The UpdateDomainContactPrivacy response includes the following element.</p>
    */
-  class AWS_ROUTE53DOMAINS_API UpdateDomainContactPrivacyResult
+  class AWS_ROUTE53DOMAINS_API UpdateDomainContactPrivacyResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateDomainContactPrivacyResult();
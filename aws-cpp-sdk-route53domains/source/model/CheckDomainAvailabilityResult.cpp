@@ -35,6 +35,7 @@ CheckDomainAvailabilityResult::CheckDomainAvailabilityResult(const AmazonWebServ
 
 CheckDomainAvailabilityResult& CheckDomainAvailabilityResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Availability"))
   {
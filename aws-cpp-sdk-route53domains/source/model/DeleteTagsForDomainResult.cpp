@@ -35,6 +35,7 @@ DeleteTagsForDomainResult::DeleteTagsForDomainResult(const AmazonWebServiceResul
 
 DeleteTagsForDomainResult& DeleteTagsForDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DisableDomainAutoRenewResult::DisableDomainAutoRenewResult(const AmazonWebServic
 
 DisableDomainAutoRenewResult& DisableDomainAutoRenewResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
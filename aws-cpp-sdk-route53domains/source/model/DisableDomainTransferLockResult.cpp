@@ -35,6 +35,7 @@ DisableDomainTransferLockResult::DisableDomainTransferLockResult(const AmazonWeb
 
 DisableDomainTransferLockResult& DisableDomainTransferLockResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
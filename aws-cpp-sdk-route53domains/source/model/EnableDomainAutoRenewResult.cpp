@@ -35,6 +35,7 @@ EnableDomainAutoRenewResult::EnableDomainAutoRenewResult(const AmazonWebServiceR
 
 EnableDomainAutoRenewResult& EnableDomainAutoRenewResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
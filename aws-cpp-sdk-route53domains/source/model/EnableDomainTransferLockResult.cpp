@@ -35,6 +35,7 @@ EnableDomainTransferLockResult::EnableDomainTransferLockResult(const AmazonWebSe
 
 EnableDomainTransferLockResult& EnableDomainTransferLockResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
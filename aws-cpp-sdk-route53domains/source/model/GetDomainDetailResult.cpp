@@ -49,6 +49,7 @@ GetDomainDetailResult::GetDomainDetailResult(const AmazonWebServiceResult<JsonVa
 
 GetDomainDetailResult& GetDomainDetailResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DomainName"))
   {
@@ -37,6 +37,7 @@ GetOperationDetailResult::GetOperationDetailResult(const AmazonWebServiceResult<
 
 GetOperationDetailResult& GetOperationDetailResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
@@ -35,6 +35,7 @@ ListOperationsResult::ListOperationsResult(const AmazonWebServiceResult<JsonValu
 
 ListOperationsResult& ListOperationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Operations"))
   {
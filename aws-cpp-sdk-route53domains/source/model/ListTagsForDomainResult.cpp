@@ -35,6 +35,7 @@ ListTagsForDomainResult::ListTagsForDomainResult(const AmazonWebServiceResult<Js
 
 ListTagsForDomainResult& ListTagsForDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TagList"))
   {
@@ -35,6 +35,7 @@ RegisterDomainResult::RegisterDomainResult(const AmazonWebServiceResult<JsonValu
 
 RegisterDomainResult& RegisterDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
@@ -35,6 +35,7 @@ RetrieveDomainAuthCodeResult::RetrieveDomainAuthCodeResult(const AmazonWebServic
 
 RetrieveDomainAuthCodeResult& RetrieveDomainAuthCodeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AuthCode"))
   {
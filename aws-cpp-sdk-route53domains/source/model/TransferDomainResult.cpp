@@ -35,6 +35,7 @@ TransferDomainResult::TransferDomainResult(const AmazonWebServiceResult<JsonValu
 
 TransferDomainResult& TransferDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
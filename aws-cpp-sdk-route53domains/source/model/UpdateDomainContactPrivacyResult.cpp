@@ -35,6 +35,7 @@ UpdateDomainContactPrivacyResult::UpdateDomainContactPrivacyResult(const AmazonW
 
 UpdateDomainContactPrivacyResult& UpdateDomainContactPrivacyResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
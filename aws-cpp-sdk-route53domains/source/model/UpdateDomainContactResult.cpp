@@ -35,6 +35,7 @@ UpdateDomainContactResult::UpdateDomainContactResult(const AmazonWebServiceResul
 
 UpdateDomainContactResult& UpdateDomainContactResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
@@ -35,6 +35,7 @@ UpdateDomainNameserversResult::UpdateDomainNameserversResult(const AmazonWebServ
 
 UpdateDomainNameserversResult& UpdateDomainNameserversResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("OperationId"))
   {
@@ -35,6 +35,7 @@ UpdateTagsForDomainResult::UpdateTagsForDomainResult(const AmazonWebServiceResul
 
 UpdateTagsForDomainResult& UpdateTagsForDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -333,7 +333,7 @@ namespace
         getObjectRequest.SetBucket(fullBucketName);
         getObjectRequest.SetKey(TEST_OBJ_KEY);
 
-        // because we use std::launch::async we know this will go to another thread
+        // the callable runs on the client executor, so it will go to another thread
         auto&& getCallable = Client->GetObjectCallable(getObjectRequest);
 
         Client->DisableRequestProcessing();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/s3/model/ServerSideEncryption.h>
 #include <aws/s3/model/RequestCharged.h>
@@ -34,7 +35,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API CompleteMultipartUploadResult
+  class AWS_S3_API CompleteMultipartUploadResult : public AmazonWebServiceResultBase
   {
   public:
     CompleteMultipartUploadResult();
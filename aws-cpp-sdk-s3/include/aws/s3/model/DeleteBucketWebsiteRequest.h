@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteBucketWebsiteRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketWebsite"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/RequestCharged.h>
 #include <aws/s3/model/DeletedObject.h>
@@ -35,7 +36,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API DeleteObjectsResult
+  class AWS_S3_API DeleteObjectsResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteObjectsResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     GetBucketAclRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetBucketAcl"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/CORSRule.h>
 
@@ -33,7 +34,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API GetBucketCorsResult
+  class AWS_S3_API GetBucketCorsResult : public AmazonWebServiceResultBase
   {
   public:
     GetBucketCorsResult();
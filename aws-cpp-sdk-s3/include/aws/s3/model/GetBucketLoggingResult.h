@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/s3/model/LoggingEnabled.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API GetBucketLoggingResult
+  class AWS_S3_API GetBucketLoggingResult : public AmazonWebServiceResultBase
   {
   public:
     GetBucketLoggingResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/TopicConfiguration.h>
 #include <aws/s3/model/QueueConfiguration.h>
@@ -39,7 +40,7 @@ namespace Model
    * Container for specifying the notification configuration of the bucket. If this
    * element is empty, notifications are turned off on the bucket.
    */
-  class AWS_S3_API GetBucketNotificationConfigurationResult
+  class AWS_S3_API GetBucketNotificationConfigurationResult : public AmazonWebServiceResultBase
   {
   public:
     GetBucketNotificationConfigurationResult();
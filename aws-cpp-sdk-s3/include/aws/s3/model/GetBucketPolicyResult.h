@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -26,7 +27,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API GetBucketPolicyResult
+  class AWS_S3_API GetBucketPolicyResult : public AmazonWebServiceResultBase
   {
   public:
     GetBucketPolicyResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     GetBucketReplicationRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "GetBucketReplication"; }
+
     Aws::String SerializePayload() const override;
 
     
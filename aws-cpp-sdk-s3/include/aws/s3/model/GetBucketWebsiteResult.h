@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/s3/model/RedirectAllRequestsTo.h>
 #include <aws/s3/model/IndexDocument.h>
 #include <aws/s3/model/ErrorDocument.h>
@@ -36,7 +37,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API GetBucketWebsiteResult
+  class AWS_S3_API GetBucketWebsiteResult : public AmazonWebServiceResultBase
   {
   public:
     GetBucketWebsiteResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/s3/model/Owner.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/RequestCharged.h>
@@ -35,7 +36,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API GetObjectAclResult
+  class AWS_S3_API GetObjectAclResult : public AmazonWebServiceResultBase
   {
   public:
     GetObjectAclResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/Array.h>
 #include <aws/s3/model/RequestCharged.h>
@@ -27,7 +28,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API GetObjectTorrentResult
+  class AWS_S3_API GetObjectTorrentResult : public AmazonWebServiceResultBase
   {
   public:
     GetObjectTorrentResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     HeadBucketRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "HeadBucket"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/Owner.h>
 #include <aws/s3/model/Bucket.h>
@@ -34,7 +35,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API ListBucketsResult
+  class AWS_S3_API ListBucketsResult : public AmazonWebServiceResultBase
   {
   public:
     ListBucketsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/EncodingType.h>
@@ -36,7 +37,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API ListMultipartUploadsResult
+  class AWS_S3_API ListMultipartUploadsResult : public AmazonWebServiceResultBase
   {
   public:
     ListMultipartUploadsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/s3/model/Initiator.h>
@@ -38,7 +39,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API ListPartsResult
+  class AWS_S3_API ListPartsResult : public AmazonWebServiceResultBase
   {
   public:
     ListPartsResult();
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     PutBucketLifecycleConfigurationRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "PutBucketLifecycleConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     inline bool ShouldComputeContentMd5() const override { return true; }
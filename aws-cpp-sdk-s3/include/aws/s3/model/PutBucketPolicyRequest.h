@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     PutBucketPolicyRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "PutBucketPolicy"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     inline bool ShouldComputeContentMd5() const override { return true; }
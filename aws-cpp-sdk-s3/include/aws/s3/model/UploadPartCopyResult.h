@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/s3/S3_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/s3/model/CopyPartResult.h>
 #include <aws/s3/model/ServerSideEncryption.h>
@@ -35,7 +36,7 @@ namespace S3
 {
 namespace Model
 {
-  class AWS_S3_API UploadPartCopyResult
+  class AWS_S3_API UploadPartCopyResult : public AmazonWebServiceResultBase
   {
   public:
     UploadPartCopyResult();
@@ -36,6 +36,7 @@ AbortMultipartUploadResult::AbortMultipartUploadResult(const AmazonWebServiceRes
 
 AbortMultipartUploadResult& AbortMultipartUploadResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
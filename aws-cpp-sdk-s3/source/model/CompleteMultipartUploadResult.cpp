@@ -36,6 +36,7 @@ CompleteMultipartUploadResult::CompleteMultipartUploadResult(const AmazonWebServ
 
 CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
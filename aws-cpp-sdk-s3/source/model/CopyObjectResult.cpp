@@ -37,6 +37,7 @@ CopyObjectResult::CopyObjectResult(const AmazonWebServiceResult<XmlDocument>& re
 
 CopyObjectResult& CopyObjectResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
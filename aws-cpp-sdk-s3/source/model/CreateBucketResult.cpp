@@ -36,6 +36,7 @@ CreateBucketResult::CreateBucketResult(const AmazonWebServiceResult<XmlDocument>
 
 CreateBucketResult& CreateBucketResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -38,6 +38,7 @@ CreateMultipartUploadResult::CreateMultipartUploadResult(const AmazonWebServiceR
 
 CreateMultipartUploadResult& CreateMultipartUploadResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -38,6 +38,7 @@ DeleteObjectResult::DeleteObjectResult(const AmazonWebServiceResult<XmlDocument>
 
 DeleteObjectResult& DeleteObjectResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ DeleteObjectsResult::DeleteObjectsResult(const AmazonWebServiceResult<XmlDocumen
 
 DeleteObjectsResult& DeleteObjectsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
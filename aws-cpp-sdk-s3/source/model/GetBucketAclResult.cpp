@@ -35,6 +35,7 @@ GetBucketAclResult::GetBucketAclResult(const AmazonWebServiceResult<XmlDocument>
 
 GetBucketAclResult& GetBucketAclResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetBucketCorsResult::GetBucketCorsResult(const AmazonWebServiceResult<XmlDocumen
 
 GetBucketCorsResult& GetBucketCorsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
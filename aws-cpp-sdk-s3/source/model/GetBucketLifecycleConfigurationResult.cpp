@@ -35,6 +35,7 @@ GetBucketLifecycleConfigurationResult::GetBucketLifecycleConfigurationResult(con
 
 GetBucketLifecycleConfigurationResult& GetBucketLifecycleConfigurationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
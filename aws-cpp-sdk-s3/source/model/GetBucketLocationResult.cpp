@@ -35,6 +35,7 @@ GetBucketLocationResult::GetBucketLocationResult(const AmazonWebServiceResult<Xm
 
 GetBucketLocationResult& GetBucketLocationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+    SetRequestTimings(result.GetRequestTimings());
     const XmlDocument& xmlDocument = result.GetPayload();
     XmlNode resultNode = xmlDocument.GetRootElement();
 
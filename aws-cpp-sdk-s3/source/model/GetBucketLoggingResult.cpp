@@ -35,6 +35,7 @@ GetBucketLoggingResult::GetBucketLoggingResult(const AmazonWebServiceResult<XmlD
 
 GetBucketLoggingResult& GetBucketLoggingResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetBucketNotificationConfigurationResult::GetBucketNotificationConfigurationResu
 
 GetBucketNotificationConfigurationResult& GetBucketNotificationConfigurationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
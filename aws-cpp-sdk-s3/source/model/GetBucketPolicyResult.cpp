@@ -30,6 +30,7 @@ GetBucketPolicyResult::GetBucketPolicyResult()
 GetBucketPolicyResult::GetBucketPolicyResult(GetBucketPolicyResult&& toMove) : 
     m_policy(std::move(toMove.m_policy))
 {
+  SetRequestTimings(toMove.GetRequestTimings());
 }
 
 GetBucketPolicyResult& GetBucketPolicyResult::operator=(GetBucketPolicyResult&& toMove)
@@ -39,6 +40,7 @@ GetBucketPolicyResult& GetBucketPolicyResult::operator=(GetBucketPolicyResult&&
       return *this;
    }
 
+   SetRequestTimings(toMove.GetRequestTimings());
    m_policy = std::move(toMove.m_policy);
 
    return *this;
@@ -51,6 +53,7 @@ GetBucketPolicyResult::GetBucketPolicyResult(AmazonWebServiceResult<ResponseStre
 
 GetBucketPolicyResult& GetBucketPolicyResult::operator =(AmazonWebServiceResult<ResponseStream>&& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   m_policy = result.TakeOwnershipOfPayload();
 
    return *this;
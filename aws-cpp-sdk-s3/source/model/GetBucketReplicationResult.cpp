@@ -35,6 +35,7 @@ GetBucketReplicationResult::GetBucketReplicationResult(const AmazonWebServiceRes
 
 GetBucketReplicationResult& GetBucketReplicationResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
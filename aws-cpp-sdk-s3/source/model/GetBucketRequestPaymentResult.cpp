@@ -35,6 +35,7 @@ GetBucketRequestPaymentResult::GetBucketRequestPaymentResult(const AmazonWebServ
 
 GetBucketRequestPaymentResult& GetBucketRequestPaymentResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
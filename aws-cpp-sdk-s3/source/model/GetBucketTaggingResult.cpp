@@ -35,6 +35,7 @@ GetBucketTaggingResult::GetBucketTaggingResult(const AmazonWebServiceResult<XmlD
 
 GetBucketTaggingResult& GetBucketTaggingResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
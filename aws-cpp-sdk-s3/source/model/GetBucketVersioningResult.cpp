@@ -35,6 +35,7 @@ GetBucketVersioningResult::GetBucketVersioningResult(const AmazonWebServiceResul
 
 GetBucketVersioningResult& GetBucketVersioningResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ GetBucketWebsiteResult::GetBucketWebsiteResult(const AmazonWebServiceResult<XmlD
 
 GetBucketWebsiteResult& GetBucketWebsiteResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
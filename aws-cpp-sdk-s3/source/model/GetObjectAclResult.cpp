@@ -36,6 +36,7 @@ GetObjectAclResult::GetObjectAclResult(const AmazonWebServiceResult<XmlDocument>
 
 GetObjectAclResult& GetObjectAclResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
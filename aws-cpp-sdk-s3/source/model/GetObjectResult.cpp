@@ -62,6 +62,7 @@ GetObjectResult::GetObjectResult(GetObjectResult&& toMove) :
     m_requestCharged(toMove.m_requestCharged),
     m_replicationStatus(toMove.m_replicationStatus)
 {
+  SetRequestTimings(toMove.GetRequestTimings());
 }
 
 GetObjectResult& GetObjectResult::operator=(GetObjectResult&& toMove)
@@ -71,6 +72,7 @@ GetObjectResult& GetObjectResult::operator=(GetObjectResult&& toMove)
       return *this;
    }
 
+   SetRequestTimings(toMove.GetRequestTimings());
    m_body = std::move(toMove.m_body);
    m_deleteMarker = toMove.m_deleteMarker;
    m_acceptRanges = std::move(toMove.m_acceptRanges);
@@ -113,6 +115,7 @@ GetObjectResult::GetObjectResult(AmazonWebServiceResult<ResponseStream>&& result
 
 GetObjectResult& GetObjectResult::operator =(AmazonWebServiceResult<ResponseStream>&& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   m_body = result.TakeOwnershipOfPayload();
 
   const auto& headers = result.GetHeaderValueCollection();
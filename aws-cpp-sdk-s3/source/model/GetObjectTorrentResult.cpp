@@ -33,6 +33,7 @@ GetObjectTorrentResult::GetObjectTorrentResult(GetObjectTorrentResult&& toMove)
     m_body(std::move(toMove.m_body)),
     m_requestCharged(toMove.m_requestCharged)
 {
+  SetRequestTimings(toMove.GetRequestTimings());
 }
 
 GetObjectTorrentResult& GetObjectTorrentResult::operator=(GetObjectTorrentResult&& toMove)
@@ -42,6 +43,7 @@ GetObjectTorrentResult& GetObjectTorrentResult::operator=(GetObjectTorrentResult
       return *this;
    }
 
+   SetRequestTimings(toMove.GetRequestTimings());
    m_body = std::move(toMove.m_body);
    m_requestCharged = toMove.m_requestCharged;
 
@@ -55,6 +57,7 @@ GetObjectTorrentResult::GetObjectTorrentResult(AmazonWebServiceResult<ResponseSt
 
 GetObjectTorrentResult& GetObjectTorrentResult::operator =(AmazonWebServiceResult<ResponseStream>&& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   m_body = result.TakeOwnershipOfPayload();
 
   const auto& headers = result.GetHeaderValueCollection();
@@ -46,6 +46,7 @@ HeadObjectResult::HeadObjectResult(const AmazonWebServiceResult<XmlDocument>& re
 
 HeadObjectResult& HeadObjectResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -35,6 +35,7 @@ ListBucketsResult::ListBucketsResult(const AmazonWebServiceResult<XmlDocument>&
 
 ListBucketsResult& ListBucketsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
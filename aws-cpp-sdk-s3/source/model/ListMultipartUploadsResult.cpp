@@ -39,6 +39,7 @@ ListMultipartUploadsResult::ListMultipartUploadsResult(const AmazonWebServiceRes
 
 ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
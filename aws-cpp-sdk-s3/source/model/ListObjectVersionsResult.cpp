@@ -39,6 +39,7 @@ ListObjectVersionsResult::ListObjectVersionsResult(const AmazonWebServiceResult<
 
 ListObjectVersionsResult& ListObjectVersionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -39,6 +39,7 @@ ListObjectsResult::ListObjectsResult(const AmazonWebServiceResult<XmlDocument>&
 
 ListObjectsResult& ListObjectsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -46,6 +46,7 @@ ListPartsResult::ListPartsResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 ListPartsResult& ListPartsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
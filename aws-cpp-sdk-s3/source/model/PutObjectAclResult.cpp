@@ -36,6 +36,7 @@ PutObjectAclResult::PutObjectAclResult(const AmazonWebServiceResult<XmlDocument>
 
 PutObjectAclResult& PutObjectAclResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ PutObjectResult::PutObjectResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 PutObjectResult& PutObjectResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ RestoreObjectResult::RestoreObjectResult(const AmazonWebServiceResult<XmlDocumen
 
 RestoreObjectResult& RestoreObjectResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -36,6 +36,7 @@ UploadPartCopyResult::UploadPartCopyResult(const AmazonWebServiceResult<XmlDocum
 
 UploadPartCopyResult& UploadPartCopyResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
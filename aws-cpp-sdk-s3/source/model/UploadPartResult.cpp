@@ -36,6 +36,7 @@ UploadPartResult::UploadPartResult(const AmazonWebServiceResult<XmlDocument>& re
 
 UploadPartResult& UploadPartResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode resultNode = xmlDocument.GetRootElement();
 
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sdb/SimpleDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/sdb/model/ResponseMetadata.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace SimpleDB
 {
 namespace Model
 {
-  class AWS_SIMPLEDB_API DomainMetadataResult
+  class AWS_SIMPLEDB_API DomainMetadataResult : public AmazonWebServiceResultBase
   {
   public:
     DomainMetadataResult();
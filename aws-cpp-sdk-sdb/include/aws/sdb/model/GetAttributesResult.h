@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sdb/SimpleDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/sdb/model/ResponseMetadata.h>
 #include <aws/sdb/model/Attribute.h>
@@ -34,7 +35,7 @@ namespace SimpleDB
 {
 namespace Model
 {
-  class AWS_SIMPLEDB_API GetAttributesResult
+  class AWS_SIMPLEDB_API GetAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     GetAttributesResult();
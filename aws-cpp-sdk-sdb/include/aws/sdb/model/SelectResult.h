@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sdb/SimpleDB_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sdb/model/ResponseMetadata.h>
@@ -35,7 +36,7 @@ namespace SimpleDB
 {
 namespace Model
 {
-  class AWS_SIMPLEDB_API SelectResult
+  class AWS_SIMPLEDB_API SelectResult : public AmazonWebServiceResultBase
   {
   public:
     SelectResult();
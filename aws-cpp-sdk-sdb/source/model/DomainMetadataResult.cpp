@@ -51,6 +51,7 @@ DomainMetadataResult::DomainMetadataResult(const AmazonWebServiceResult<XmlDocum
 
 DomainMetadataResult& DomainMetadataResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
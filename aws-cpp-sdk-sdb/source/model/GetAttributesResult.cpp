@@ -37,6 +37,7 @@ GetAttributesResult::GetAttributesResult(const AmazonWebServiceResult<XmlDocumen
 
 GetAttributesResult& GetAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
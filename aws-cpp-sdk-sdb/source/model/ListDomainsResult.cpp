@@ -37,6 +37,7 @@ ListDomainsResult::ListDomainsResult(const AmazonWebServiceResult<XmlDocument>&
 
 ListDomainsResult& ListDomainsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ SelectResult::SelectResult(const AmazonWebServiceResult<XmlDocument>& result)
 
 SelectResult& SelectResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -31,6 +31,10 @@ namespace Model
   {
   public:
     ConfirmSubscriptionRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ConfirmSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
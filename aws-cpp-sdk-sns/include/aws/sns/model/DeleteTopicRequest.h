@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteTopicRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteTopic"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sns/SNS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/sns/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Response from GetEndpointAttributes of the EndpointArn.</p>
    */
-  class AWS_SNS_API GetEndpointAttributesResult
+  class AWS_SNS_API GetEndpointAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     GetEndpointAttributesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sns/SNS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/sns/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Response for GetPlatformApplicationAttributes action.</p>
    */
-  class AWS_SNS_API GetPlatformApplicationAttributesResult
+  class AWS_SNS_API GetPlatformApplicationAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     GetPlatformApplicationAttributesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sns/SNS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sns/model/ResponseMetadata.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Response for ListEndpointsByPlatformApplication action.</p>
    */
-  class AWS_SNS_API ListEndpointsByPlatformApplicationResult
+  class AWS_SNS_API ListEndpointsByPlatformApplicationResult : public AmazonWebServiceResultBase
   {
   public:
     ListEndpointsByPlatformApplicationResult();
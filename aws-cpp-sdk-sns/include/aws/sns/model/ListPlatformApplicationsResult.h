@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sns/SNS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sns/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Response for ListPlatformApplications action.</p>
    */
-  class AWS_SNS_API ListPlatformApplicationsResult
+  class AWS_SNS_API ListPlatformApplicationsResult : public AmazonWebServiceResultBase
   {
   public:
     ListPlatformApplicationsResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     ListTopicsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "ListTopics"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sns/SNS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sns/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Response for Publish action.</p>
    */
-  class AWS_SNS_API PublishResult
+  class AWS_SNS_API PublishResult : public AmazonWebServiceResultBase
   {
   public:
     PublishResult();
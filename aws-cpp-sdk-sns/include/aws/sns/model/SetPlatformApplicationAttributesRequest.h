@@ -32,6 +32,10 @@ namespace Model
   {
   public:
     SetPlatformApplicationAttributesRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "SetPlatformApplicationAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sns/SNS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sns/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * Response for Subscribe action.
    */
-  class AWS_SNS_API SubscribeResult
+  class AWS_SNS_API SubscribeResult : public AmazonWebServiceResultBase
   {
   public:
     SubscribeResult();
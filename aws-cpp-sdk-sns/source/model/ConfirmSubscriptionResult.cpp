@@ -37,6 +37,7 @@ ConfirmSubscriptionResult::ConfirmSubscriptionResult(const AmazonWebServiceResul
 
 ConfirmSubscriptionResult& ConfirmSubscriptionResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
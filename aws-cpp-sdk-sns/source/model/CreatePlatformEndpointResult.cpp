@@ -37,6 +37,7 @@ CreatePlatformEndpointResult::CreatePlatformEndpointResult(const AmazonWebServic
 
 CreatePlatformEndpointResult& CreatePlatformEndpointResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ CreateTopicResult::CreateTopicResult(const AmazonWebServiceResult<XmlDocument>&
 
 CreateTopicResult& CreateTopicResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
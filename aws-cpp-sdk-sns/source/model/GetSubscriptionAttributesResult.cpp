@@ -37,6 +37,7 @@ GetSubscriptionAttributesResult::GetSubscriptionAttributesResult(const AmazonWeb
 
 GetSubscriptionAttributesResult& GetSubscriptionAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetTopicAttributesResult::GetTopicAttributesResult(const AmazonWebServiceResult<
 
 GetTopicAttributesResult& GetTopicAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListSubscriptionsByTopicResult::ListSubscriptionsByTopicResult(const AmazonWebSe
 
 ListSubscriptionsByTopicResult& ListSubscriptionsByTopicResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListSubscriptionsResult::ListSubscriptionsResult(const AmazonWebServiceResult<Xm
 
 ListSubscriptionsResult& ListSubscriptionsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
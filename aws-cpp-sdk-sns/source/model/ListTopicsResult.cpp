@@ -37,6 +37,7 @@ ListTopicsResult::ListTopicsResult(const AmazonWebServiceResult<XmlDocument>& re
 
 ListTopicsResult& ListTopicsResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ PublishResult::PublishResult(const AmazonWebServiceResult<XmlDocument>& result)
 
 PublishResult& PublishResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
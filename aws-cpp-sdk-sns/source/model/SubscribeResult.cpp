@@ -37,6 +37,7 @@ SubscribeResult::SubscribeResult(const AmazonWebServiceResult<XmlDocument>& resu
 
 SubscribeResult& SubscribeResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/sqs/model/ChangeMessageVisibilityBatchResultEntry.h>
@@ -40,7 +41,7 @@ namespace Model
    * <a>ChangeMessageVisibilityBatchResultEntry</a> tag if the message succeeds or a
    * <a>BatchResultErrorEntry</a> tag if the message fails. </p>
    */
-  class AWS_SQS_API ChangeMessageVisibilityBatchResult
+  class AWS_SQS_API ChangeMessageVisibilityBatchResult : public AmazonWebServiceResultBase
   {
   public:
     ChangeMessageVisibilityBatchResult();
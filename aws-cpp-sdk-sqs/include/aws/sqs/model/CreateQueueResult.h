@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Returns the QueueUrl element of the created queue.</p>
    */
-  class AWS_SQS_API CreateQueueResult
+  class AWS_SQS_API CreateQueueResult : public AmazonWebServiceResultBase
   {
   public:
     CreateQueueResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/sqs/model/DeleteMessageBatchResultEntry.h>
@@ -40,7 +41,7 @@ namespace Model
    * <a>DeleteMessageBatchResultEntry</a> tag if the message is deleted or a
    * <a>BatchResultErrorEntry</a> tag if the message cannot be deleted. </p>
    */
-  class AWS_SQS_API DeleteMessageBatchResult
+  class AWS_SQS_API DeleteMessageBatchResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteMessageBatchResult();
@@ -30,6 +30,10 @@ namespace Model
   {
   public:
     DeleteMessageRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "DeleteMessage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/sqs/model/QueueAttributeName.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * A list of returned queue attributes.
    */
-  class AWS_SQS_API GetQueueAttributesResult
+  class AWS_SQS_API GetQueueAttributesResult : public AmazonWebServiceResultBase
   {
   public:
     GetQueueAttributesResult();
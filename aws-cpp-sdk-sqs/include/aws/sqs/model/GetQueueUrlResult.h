@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/UnderstandingResponses.html">Responses</a>
    * in the <i>Amazon SQS Developer Guide</i>.</p>
    */
-  class AWS_SQS_API GetQueueUrlResult
+  class AWS_SQS_API GetQueueUrlResult : public AmazonWebServiceResultBase
   {
   public:
     GetQueueUrlResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * A list of your queues.
    */
-  class AWS_SQS_API ListQueuesResult
+  class AWS_SQS_API ListQueuesResult : public AmazonWebServiceResultBase
   {
   public:
     ListQueuesResult();
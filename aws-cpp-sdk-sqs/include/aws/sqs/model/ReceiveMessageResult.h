@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/sqs/model/Message.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * A list of received messages.
    */
-  class AWS_SQS_API ReceiveMessageResult
+  class AWS_SQS_API ReceiveMessageResult : public AmazonWebServiceResultBase
   {
   public:
     ReceiveMessageResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/sqs/model/SendMessageBatchResultEntry.h>
@@ -40,7 +41,7 @@ namespace Model
    * <a>SendMessageBatchResultEntry</a> tag if the message succeeds or a
    * <a>BatchResultErrorEntry</a> tag if the message fails.</p>
    */
-  class AWS_SQS_API SendMessageBatchResult
+  class AWS_SQS_API SendMessageBatchResult : public AmazonWebServiceResultBase
   {
   public:
     SendMessageBatchResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sqs/SQS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sqs/model/ResponseMetadata.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The MD5OfMessageBody and MessageId elements.</p>
    */
-  class AWS_SQS_API SendMessageResult
+  class AWS_SQS_API SendMessageResult : public AmazonWebServiceResultBase
   {
   public:
     SendMessageResult();
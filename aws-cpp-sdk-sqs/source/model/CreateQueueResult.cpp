@@ -37,6 +37,7 @@ CreateQueueResult::CreateQueueResult(const AmazonWebServiceResult<XmlDocument>&
 
 CreateQueueResult& CreateQueueResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetQueueAttributesResult::GetQueueAttributesResult(const AmazonWebServiceResult<
 
 GetQueueAttributesResult& GetQueueAttributesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
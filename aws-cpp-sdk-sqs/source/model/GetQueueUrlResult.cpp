@@ -37,6 +37,7 @@ GetQueueUrlResult::GetQueueUrlResult(const AmazonWebServiceResult<XmlDocument>&
 
 GetQueueUrlResult& GetQueueUrlResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
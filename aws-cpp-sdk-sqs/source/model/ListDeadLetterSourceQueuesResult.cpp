@@ -37,6 +37,7 @@ ListDeadLetterSourceQueuesResult::ListDeadLetterSourceQueuesResult(const AmazonW
 
 ListDeadLetterSourceQueuesResult& ListDeadLetterSourceQueuesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ListQueuesResult::ListQueuesResult(const AmazonWebServiceResult<XmlDocument>& re
 
 ListQueuesResult& ListQueuesResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ ReceiveMessageResult::ReceiveMessageResult(const AmazonWebServiceResult<XmlDocum
 
 ReceiveMessageResult& ReceiveMessageResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ SendMessageBatchResult::SendMessageBatchResult(const AmazonWebServiceResult<XmlD
 
 SendMessageBatchResult& SendMessageBatchResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ SendMessageResult::SendMessageResult(const AmazonWebServiceResult<XmlDocument>&
 
 SendMessageResult& SendMessageResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -35,7 +36,7 @@ namespace Model
    * <p>Whether or not the command was successfully canceled. There is no guarantee
    * that a request can be canceled.</p>
    */
-  class AWS_SSM_API CancelCommandResult
+  class AWS_SSM_API CancelCommandResult : public AmazonWebServiceResultBase
   {
   public:
     CancelCommandResult();
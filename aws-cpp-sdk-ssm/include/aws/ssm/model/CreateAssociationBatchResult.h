@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/ssm/model/AssociationDescription.h>
 #include <aws/ssm/model/FailedCreateAssociation.h>
@@ -34,7 +35,7 @@ namespace SSM
 {
 namespace Model
 {
-  class AWS_SSM_API CreateAssociationBatchResult
+  class AWS_SSM_API CreateAssociationBatchResult : public AmazonWebServiceResultBase
   {
   public:
     CreateAssociationBatchResult();
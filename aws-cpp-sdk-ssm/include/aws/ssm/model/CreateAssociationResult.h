@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/ssm/model/AssociationDescription.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace SSM
 {
 namespace Model
 {
-  class AWS_SSM_API CreateAssociationResult
+  class AWS_SSM_API CreateAssociationResult : public AmazonWebServiceResultBase
   {
   public:
     CreateAssociationResult();
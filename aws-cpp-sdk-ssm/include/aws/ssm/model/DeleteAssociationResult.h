@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -31,7 +32,7 @@ namespace SSM
 {
 namespace Model
 {
-  class AWS_SSM_API DeleteAssociationResult
+  class AWS_SSM_API DeleteAssociationResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteAssociationResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ssm/model/InstanceInformation.h>
@@ -34,7 +35,7 @@ namespace SSM
 {
 namespace Model
 {
-  class AWS_SSM_API DescribeInstanceInformationResult
+  class AWS_SSM_API DescribeInstanceInformationResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeInstanceInformationResult();
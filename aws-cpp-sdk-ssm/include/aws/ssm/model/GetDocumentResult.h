@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace SSM
 {
 namespace Model
 {
-  class AWS_SSM_API GetDocumentResult
+  class AWS_SSM_API GetDocumentResult : public AmazonWebServiceResultBase
   {
   public:
     GetDocumentResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/ssm/SSM_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/ssm/model/Command.h>
@@ -34,7 +35,7 @@ namespace SSM
 {
 namespace Model
 {
-  class AWS_SSM_API ListCommandsResult
+  class AWS_SSM_API ListCommandsResult : public AmazonWebServiceResultBase
   {
   public:
     ListCommandsResult();
@@ -35,6 +35,7 @@ CancelCommandResult::CancelCommandResult(const AmazonWebServiceResult<JsonValue>
 
 CancelCommandResult& CancelCommandResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ CreateAssociationBatchResult::CreateAssociationBatchResult(const AmazonWebServic
 
 CreateAssociationBatchResult& CreateAssociationBatchResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Successful"))
   {
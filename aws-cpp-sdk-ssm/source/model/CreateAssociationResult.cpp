@@ -35,6 +35,7 @@ CreateAssociationResult::CreateAssociationResult(const AmazonWebServiceResult<Js
 
 CreateAssociationResult& CreateAssociationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AssociationDescription"))
   {
@@ -35,6 +35,7 @@ CreateDocumentResult::CreateDocumentResult(const AmazonWebServiceResult<JsonValu
 
 CreateDocumentResult& CreateDocumentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DocumentDescription"))
   {
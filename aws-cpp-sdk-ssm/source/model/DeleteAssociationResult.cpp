@@ -35,6 +35,7 @@ DeleteAssociationResult::DeleteAssociationResult(const AmazonWebServiceResult<Js
 
 DeleteAssociationResult& DeleteAssociationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DeleteDocumentResult::DeleteDocumentResult(const AmazonWebServiceResult<JsonValu
 
 DeleteDocumentResult& DeleteDocumentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   AWS_UNREFERENCED_PARAM(result);
 
 
@@ -35,6 +35,7 @@ DescribeAssociationResult::DescribeAssociationResult(const AmazonWebServiceResul
 
 DescribeAssociationResult& DescribeAssociationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AssociationDescription"))
   {
@@ -35,6 +35,7 @@ DescribeDocumentResult::DescribeDocumentResult(const AmazonWebServiceResult<Json
 
 DescribeDocumentResult& DescribeDocumentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Document"))
   {
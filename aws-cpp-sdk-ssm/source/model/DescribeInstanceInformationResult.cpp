@@ -35,6 +35,7 @@ DescribeInstanceInformationResult::DescribeInstanceInformationResult(const Amazo
 
 DescribeInstanceInformationResult& DescribeInstanceInformationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("InstanceInformationList"))
   {
@@ -35,6 +35,7 @@ GetDocumentResult::GetDocumentResult(const AmazonWebServiceResult<JsonValue>& re
 
 GetDocumentResult& GetDocumentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Name"))
   {
@@ -35,6 +35,7 @@ ListAssociationsResult::ListAssociationsResult(const AmazonWebServiceResult<Json
 
 ListAssociationsResult& ListAssociationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Associations"))
   {
@@ -35,6 +35,7 @@ ListCommandInvocationsResult::ListCommandInvocationsResult(const AmazonWebServic
 
 ListCommandInvocationsResult& ListCommandInvocationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CommandInvocations"))
   {
@@ -35,6 +35,7 @@ ListCommandsResult::ListCommandsResult(const AmazonWebServiceResult<JsonValue>&
 
 ListCommandsResult& ListCommandsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Commands"))
   {
@@ -35,6 +35,7 @@ ListDocumentsResult::ListDocumentsResult(const AmazonWebServiceResult<JsonValue>
 
 ListDocumentsResult& ListDocumentsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("DocumentIdentifiers"))
   {
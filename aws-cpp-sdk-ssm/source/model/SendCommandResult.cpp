@@ -35,6 +35,7 @@ SendCommandResult::SendCommandResult(const AmazonWebServiceResult<JsonValue>& re
 
 SendCommandResult& SendCommandResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Command"))
   {
@@ -35,6 +35,7 @@ UpdateAssociationStatusResult::UpdateAssociationStatusResult(const AmazonWebServ
 
 UpdateAssociationStatusResult& UpdateAssociationStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("AssociationDescription"))
   {
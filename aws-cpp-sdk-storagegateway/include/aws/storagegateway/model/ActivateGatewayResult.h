@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -41,7 +42,7 @@ namespace Model
    * gateway id. Changing the name of the gateway has no effect on the gateway
    * ARN.</note>
    */
-  class AWS_STORAGEGATEWAY_API ActivateGatewayResult
+  class AWS_STORAGEGATEWAY_API ActivateGatewayResult : public AmazonWebServiceResultBase
   {
   public:
     ActivateGatewayResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>A JSON object containing the of the gateway for which working storage was
    * configured.</p>
    */
-  class AWS_STORAGEGATEWAY_API AddWorkingStorageResult
+  class AWS_STORAGEGATEWAY_API AddWorkingStorageResult : public AmazonWebServiceResultBase
   {
   public:
     AddWorkingStorageResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>CancelRetrievalOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API CancelRetrievalResult
+  class AWS_STORAGEGATEWAY_API CancelRetrievalResult : public AmazonWebServiceResultBase
   {
   public:
     CancelRetrievalResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace StorageGateway
 {
 namespace Model
 {
-  class AWS_STORAGEGATEWAY_API CreateCachediSCSIVolumeResult
+  class AWS_STORAGEGATEWAY_API CreateCachediSCSIVolumeResult : public AmazonWebServiceResultBase
   {
   public:
     CreateCachediSCSIVolumeResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A JSON object containing the following fields:</p>
    */
-  class AWS_STORAGEGATEWAY_API CreateSnapshotResult
+  class AWS_STORAGEGATEWAY_API CreateSnapshotResult : public AmazonWebServiceResultBase
   {
   public:
     CreateSnapshotResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>CreateTapeOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API CreateTapesResult
+  class AWS_STORAGEGATEWAY_API CreateTapesResult : public AmazonWebServiceResultBase
   {
   public:
     CreateTapesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>DeleteTapeArchiveOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API DeleteTapeArchiveResult
+  class AWS_STORAGEGATEWAY_API DeleteTapeArchiveResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteTapeArchiveResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/CachediSCSIVolume.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>A JSON object containing the following fields:</p>
    */
-  class AWS_STORAGEGATEWAY_API DescribeCachediSCSIVolumesResult
+  class AWS_STORAGEGATEWAY_API DescribeCachediSCSIVolumesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeCachediSCSIVolumesResult();
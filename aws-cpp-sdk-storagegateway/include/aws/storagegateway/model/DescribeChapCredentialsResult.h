@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/ChapInfo.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>A JSON object containing a .</p>
    */
-  class AWS_STORAGEGATEWAY_API DescribeChapCredentialsResult
+  class AWS_STORAGEGATEWAY_API DescribeChapCredentialsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeChapCredentialsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/NetworkInterface.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>A JSON object containing the following fields:</p>
    */
-  class AWS_STORAGEGATEWAY_API DescribeGatewayInformationResult
+  class AWS_STORAGEGATEWAY_API DescribeGatewayInformationResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeGatewayInformationResult();
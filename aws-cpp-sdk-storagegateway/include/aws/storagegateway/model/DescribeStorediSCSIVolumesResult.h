@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/StorediSCSIVolume.h>
 
@@ -33,7 +34,7 @@ namespace StorageGateway
 {
 namespace Model
 {
-  class AWS_STORAGEGATEWAY_API DescribeStorediSCSIVolumesResult
+  class AWS_STORAGEGATEWAY_API DescribeStorediSCSIVolumesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeStorediSCSIVolumesResult();
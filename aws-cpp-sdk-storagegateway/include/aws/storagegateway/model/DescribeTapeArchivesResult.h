@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/storagegateway/model/TapeArchive.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>DescribeTapeArchivesOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API DescribeTapeArchivesResult
+  class AWS_STORAGEGATEWAY_API DescribeTapeArchivesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTapeArchivesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 
@@ -33,7 +34,7 @@ namespace StorageGateway
 {
 namespace Model
 {
-  class AWS_STORAGEGATEWAY_API DescribeUploadBufferResult
+  class AWS_STORAGEGATEWAY_API DescribeUploadBufferResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeUploadBufferResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/VTLDevice.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>DescribeVTLDevicesOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API DescribeVTLDevicesResult
+  class AWS_STORAGEGATEWAY_API DescribeVTLDevicesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeVTLDevicesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>DisableGatewayOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API DisableGatewayResult
+  class AWS_STORAGEGATEWAY_API DisableGatewayResult : public AmazonWebServiceResultBase
   {
   public:
     DisableGatewayResult();
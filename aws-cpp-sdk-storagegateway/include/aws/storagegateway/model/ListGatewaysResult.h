@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/storagegateway/model/GatewayInfo.h>
@@ -34,7 +35,7 @@ namespace StorageGateway
 {
 namespace Model
 {
-  class AWS_STORAGEGATEWAY_API ListGatewaysResult
+  class AWS_STORAGEGATEWAY_API ListGatewaysResult : public AmazonWebServiceResultBase
   {
   public:
     ListGatewaysResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/Disk.h>
@@ -34,7 +35,7 @@ namespace StorageGateway
 {
 namespace Model
 {
-  class AWS_STORAGEGATEWAY_API ListLocalDisksResult
+  class AWS_STORAGEGATEWAY_API ListLocalDisksResult : public AmazonWebServiceResultBase
   {
   public:
     ListLocalDisksResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/storagegateway/model/Tag.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>ListTagsForResourceOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API ListTagsForResourceResult
+  class AWS_STORAGEGATEWAY_API ListTagsForResourceResult : public AmazonWebServiceResultBase
   {
   public:
     ListTagsForResourceResult();
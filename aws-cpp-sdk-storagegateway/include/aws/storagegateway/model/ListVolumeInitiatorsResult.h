@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>ListVolumeInitiatorsOutput</p>
    */
-  class AWS_STORAGEGATEWAY_API ListVolumeInitiatorsResult
+  class AWS_STORAGEGATEWAY_API ListVolumeInitiatorsResult : public AmazonWebServiceResultBase
   {
   public:
     ListVolumeInitiatorsResult();
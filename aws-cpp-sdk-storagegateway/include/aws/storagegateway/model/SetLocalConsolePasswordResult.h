@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace StorageGateway
 {
 namespace Model
 {
-  class AWS_STORAGEGATEWAY_API SetLocalConsolePasswordResult
+  class AWS_STORAGEGATEWAY_API SetLocalConsolePasswordResult : public AmazonWebServiceResultBase
   {
   public:
     SetLocalConsolePasswordResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A JSON object containing the of the gateway that was shut down.</p>
    */
-  class AWS_STORAGEGATEWAY_API ShutdownGatewayResult
+  class AWS_STORAGEGATEWAY_API ShutdownGatewayResult : public AmazonWebServiceResultBase
   {
   public:
     ShutdownGatewayResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>A JSON object containing the of the gateway whose throttle information was
    * updated.</p>
    */
-  class AWS_STORAGEGATEWAY_API UpdateBandwidthRateLimitResult
+  class AWS_STORAGEGATEWAY_API UpdateBandwidthRateLimitResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateBandwidthRateLimitResult();
@@ -34,6 +34,10 @@ namespace Model
   {
   public:
     UpdateMaintenanceStartTimeRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "UpdateMaintenanceStartTime"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>A JSON object containing the of the gateway whose maintenance start time is
    * updated.</p>
    */
-  class AWS_STORAGEGATEWAY_API UpdateMaintenanceStartTimeResult
+  class AWS_STORAGEGATEWAY_API UpdateMaintenanceStartTimeResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateMaintenanceStartTimeResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/storagegateway/StorageGateway_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>A JSON object containing the of the updated storage volume.</p>
    */
-  class AWS_STORAGEGATEWAY_API UpdateSnapshotScheduleResult
+  class AWS_STORAGEGATEWAY_API UpdateSnapshotScheduleResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateSnapshotScheduleResult();
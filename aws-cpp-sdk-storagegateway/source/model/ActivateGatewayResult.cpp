@@ -35,6 +35,7 @@ ActivateGatewayResult::ActivateGatewayResult(const AmazonWebServiceResult<JsonVa
 
 ActivateGatewayResult& ActivateGatewayResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
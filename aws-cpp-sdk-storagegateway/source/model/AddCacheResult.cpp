@@ -35,6 +35,7 @@ AddCacheResult::AddCacheResult(const AmazonWebServiceResult<JsonValue>& result)
 
 AddCacheResult& AddCacheResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
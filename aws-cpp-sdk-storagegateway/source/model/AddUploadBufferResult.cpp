@@ -35,6 +35,7 @@ AddUploadBufferResult::AddUploadBufferResult(const AmazonWebServiceResult<JsonVa
 
 AddUploadBufferResult& AddUploadBufferResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ AddWorkingStorageResult::AddWorkingStorageResult(const AmazonWebServiceResult<Js
 
 AddWorkingStorageResult& AddWorkingStorageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
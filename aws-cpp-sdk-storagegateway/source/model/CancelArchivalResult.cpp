@@ -35,6 +35,7 @@ CancelArchivalResult::CancelArchivalResult(const AmazonWebServiceResult<JsonValu
 
 CancelArchivalResult& CancelArchivalResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
@@ -35,6 +35,7 @@ CancelRetrievalResult::CancelRetrievalResult(const AmazonWebServiceResult<JsonVa
 
 CancelRetrievalResult& CancelRetrievalResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
@@ -35,6 +35,7 @@ CreateCachediSCSIVolumeResult::CreateCachediSCSIVolumeResult(const AmazonWebServ
 
 CreateCachediSCSIVolumeResult& CreateCachediSCSIVolumeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeARN"))
   {
@@ -35,6 +35,7 @@ CreateSnapshotFromVolumeRecoveryPointResult::CreateSnapshotFromVolumeRecoveryPoi
 
 CreateSnapshotFromVolumeRecoveryPointResult& CreateSnapshotFromVolumeRecoveryPointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SnapshotId"))
   {
@@ -37,6 +37,7 @@ CreateStorediSCSIVolumeResult::CreateStorediSCSIVolumeResult(const AmazonWebServ
 
 CreateStorediSCSIVolumeResult& CreateStorediSCSIVolumeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeARN"))
   {
@@ -35,6 +35,7 @@ CreateTapeWithBarcodeResult::CreateTapeWithBarcodeResult(const AmazonWebServiceR
 
 CreateTapeWithBarcodeResult& CreateTapeWithBarcodeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
@@ -35,6 +35,7 @@ CreateTapesResult::CreateTapesResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateTapesResult& CreateTapesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARNs"))
   {
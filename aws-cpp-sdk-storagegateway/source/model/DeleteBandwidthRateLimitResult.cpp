@@ -35,6 +35,7 @@ DeleteBandwidthRateLimitResult::DeleteBandwidthRateLimitResult(const AmazonWebSe
 
 DeleteBandwidthRateLimitResult& DeleteBandwidthRateLimitResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ DeleteChapCredentialsResult::DeleteChapCredentialsResult(const AmazonWebServiceR
 
 DeleteChapCredentialsResult& DeleteChapCredentialsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TargetARN"))
   {
@@ -35,6 +35,7 @@ DeleteGatewayResult::DeleteGatewayResult(const AmazonWebServiceResult<JsonValue>
 
 DeleteGatewayResult& DeleteGatewayResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
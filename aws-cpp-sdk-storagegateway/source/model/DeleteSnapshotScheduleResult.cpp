@@ -35,6 +35,7 @@ DeleteSnapshotScheduleResult::DeleteSnapshotScheduleResult(const AmazonWebServic
 
 DeleteSnapshotScheduleResult& DeleteSnapshotScheduleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeARN"))
   {
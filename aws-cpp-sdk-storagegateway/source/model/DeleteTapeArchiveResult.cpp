@@ -35,6 +35,7 @@ DeleteTapeArchiveResult::DeleteTapeArchiveResult(const AmazonWebServiceResult<Js
 
 DeleteTapeArchiveResult& DeleteTapeArchiveResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
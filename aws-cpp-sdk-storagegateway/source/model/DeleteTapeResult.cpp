@@ -35,6 +35,7 @@ DeleteTapeResult::DeleteTapeResult(const AmazonWebServiceResult<JsonValue>& resu
 
 DeleteTapeResult& DeleteTapeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
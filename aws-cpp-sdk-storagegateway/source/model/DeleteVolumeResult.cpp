@@ -35,6 +35,7 @@ DeleteVolumeResult::DeleteVolumeResult(const AmazonWebServiceResult<JsonValue>&
 
 DeleteVolumeResult& DeleteVolumeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeARN"))
   {
@@ -39,6 +39,7 @@ DescribeBandwidthRateLimitResult::DescribeBandwidthRateLimitResult(const AmazonW
 
 DescribeBandwidthRateLimitResult& DescribeBandwidthRateLimitResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -45,6 +45,7 @@ DescribeCacheResult::DescribeCacheResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeCacheResult& DescribeCacheResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ DescribeCachediSCSIVolumesResult::DescribeCachediSCSIVolumesResult(const AmazonW
 
 DescribeCachediSCSIVolumesResult& DescribeCachediSCSIVolumesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("CachediSCSIVolumes"))
   {
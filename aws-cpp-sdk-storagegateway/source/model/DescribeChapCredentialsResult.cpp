@@ -35,6 +35,7 @@ DescribeChapCredentialsResult::DescribeChapCredentialsResult(const AmazonWebServ
 
 DescribeChapCredentialsResult& DescribeChapCredentialsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChapCredentials"))
   {
@@ -35,6 +35,7 @@ DescribeGatewayInformationResult::DescribeGatewayInformationResult(const AmazonW
 
 DescribeGatewayInformationResult& DescribeGatewayInformationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
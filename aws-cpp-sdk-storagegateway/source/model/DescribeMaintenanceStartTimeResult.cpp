@@ -41,6 +41,7 @@ DescribeMaintenanceStartTimeResult::DescribeMaintenanceStartTimeResult(const Ama
 
 DescribeMaintenanceStartTimeResult& DescribeMaintenanceStartTimeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
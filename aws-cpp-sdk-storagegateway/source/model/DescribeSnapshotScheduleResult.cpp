@@ -39,6 +39,7 @@ DescribeSnapshotScheduleResult::DescribeSnapshotScheduleResult(const AmazonWebSe
 
 DescribeSnapshotScheduleResult& DescribeSnapshotScheduleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeARN"))
   {
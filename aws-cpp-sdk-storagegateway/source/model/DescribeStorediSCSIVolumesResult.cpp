@@ -35,6 +35,7 @@ DescribeStorediSCSIVolumesResult::DescribeStorediSCSIVolumesResult(const AmazonW
 
 DescribeStorediSCSIVolumesResult& DescribeStorediSCSIVolumesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("StorediSCSIVolumes"))
   {
@@ -35,6 +35,7 @@ DescribeTapeArchivesResult::DescribeTapeArchivesResult(const AmazonWebServiceRes
 
 DescribeTapeArchivesResult& DescribeTapeArchivesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeArchives"))
   {
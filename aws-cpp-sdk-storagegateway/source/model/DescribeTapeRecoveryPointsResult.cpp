@@ -35,6 +35,7 @@ DescribeTapeRecoveryPointsResult::DescribeTapeRecoveryPointsResult(const AmazonW
 
 DescribeTapeRecoveryPointsResult& DescribeTapeRecoveryPointsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ DescribeTapesResult::DescribeTapesResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeTapesResult& DescribeTapesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Tapes"))
   {
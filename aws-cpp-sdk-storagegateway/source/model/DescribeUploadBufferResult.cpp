@@ -39,6 +39,7 @@ DescribeUploadBufferResult::DescribeUploadBufferResult(const AmazonWebServiceRes
 
 DescribeUploadBufferResult& DescribeUploadBufferResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ DescribeVTLDevicesResult::DescribeVTLDevicesResult(const AmazonWebServiceResult<
 
 DescribeVTLDevicesResult& DescribeVTLDevicesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -39,6 +39,7 @@ DescribeWorkingStorageResult::DescribeWorkingStorageResult(const AmazonWebServic
 
 DescribeWorkingStorageResult& DescribeWorkingStorageResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ DisableGatewayResult::DisableGatewayResult(const AmazonWebServiceResult<JsonValu
 
 DisableGatewayResult& DisableGatewayResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
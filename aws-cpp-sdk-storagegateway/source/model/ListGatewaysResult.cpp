@@ -35,6 +35,7 @@ ListGatewaysResult::ListGatewaysResult(const AmazonWebServiceResult<JsonValue>&
 
 ListGatewaysResult& ListGatewaysResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Gateways"))
   {
@@ -35,6 +35,7 @@ ListLocalDisksResult::ListLocalDisksResult(const AmazonWebServiceResult<JsonValu
 
 ListLocalDisksResult& ListLocalDisksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
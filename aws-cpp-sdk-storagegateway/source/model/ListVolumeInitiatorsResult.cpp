@@ -35,6 +35,7 @@ ListVolumeInitiatorsResult::ListVolumeInitiatorsResult(const AmazonWebServiceRes
 
 ListVolumeInitiatorsResult& ListVolumeInitiatorsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Initiators"))
   {
@@ -35,6 +35,7 @@ ListVolumeRecoveryPointsResult::ListVolumeRecoveryPointsResult(const AmazonWebSe
 
 ListVolumeRecoveryPointsResult& ListVolumeRecoveryPointsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ ListVolumesResult::ListVolumesResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListVolumesResult& ListVolumesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
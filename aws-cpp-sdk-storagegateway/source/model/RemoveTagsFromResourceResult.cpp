@@ -35,6 +35,7 @@ RemoveTagsFromResourceResult::RemoveTagsFromResourceResult(const AmazonWebServic
 
 RemoveTagsFromResourceResult& RemoveTagsFromResourceResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ResourceARN"))
   {
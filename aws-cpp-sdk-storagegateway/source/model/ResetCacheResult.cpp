@@ -35,6 +35,7 @@ ResetCacheResult::ResetCacheResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ResetCacheResult& ResetCacheResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
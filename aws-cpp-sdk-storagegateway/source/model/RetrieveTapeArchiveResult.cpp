@@ -35,6 +35,7 @@ RetrieveTapeArchiveResult::RetrieveTapeArchiveResult(const AmazonWebServiceResul
 
 RetrieveTapeArchiveResult& RetrieveTapeArchiveResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
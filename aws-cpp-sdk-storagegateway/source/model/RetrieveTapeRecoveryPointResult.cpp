@@ -35,6 +35,7 @@ RetrieveTapeRecoveryPointResult::RetrieveTapeRecoveryPointResult(const AmazonWeb
 
 RetrieveTapeRecoveryPointResult& RetrieveTapeRecoveryPointResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TapeARN"))
   {
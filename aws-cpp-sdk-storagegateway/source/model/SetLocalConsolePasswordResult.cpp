@@ -35,6 +35,7 @@ SetLocalConsolePasswordResult::SetLocalConsolePasswordResult(const AmazonWebServ
 
 SetLocalConsolePasswordResult& SetLocalConsolePasswordResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
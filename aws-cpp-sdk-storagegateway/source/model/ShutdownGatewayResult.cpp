@@ -35,6 +35,7 @@ ShutdownGatewayResult::ShutdownGatewayResult(const AmazonWebServiceResult<JsonVa
 
 ShutdownGatewayResult& ShutdownGatewayResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
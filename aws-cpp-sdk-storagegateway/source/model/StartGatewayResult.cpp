@@ -35,6 +35,7 @@ StartGatewayResult::StartGatewayResult(const AmazonWebServiceResult<JsonValue>&
 
 StartGatewayResult& StartGatewayResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ UpdateBandwidthRateLimitResult::UpdateBandwidthRateLimitResult(const AmazonWebSe
 
 UpdateBandwidthRateLimitResult& UpdateBandwidthRateLimitResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ UpdateChapCredentialsResult::UpdateChapCredentialsResult(const AmazonWebServiceR
 
 UpdateChapCredentialsResult& UpdateChapCredentialsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("TargetARN"))
   {
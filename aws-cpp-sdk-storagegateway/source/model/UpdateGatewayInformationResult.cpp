@@ -35,6 +35,7 @@ UpdateGatewayInformationResult::UpdateGatewayInformationResult(const AmazonWebSe
 
 UpdateGatewayInformationResult& UpdateGatewayInformationResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ UpdateGatewaySoftwareNowResult::UpdateGatewaySoftwareNowResult(const AmazonWebSe
 
 UpdateGatewaySoftwareNowResult& UpdateGatewaySoftwareNowResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
@@ -35,6 +35,7 @@ UpdateMaintenanceStartTimeResult::UpdateMaintenanceStartTimeResult(const AmazonW
 
 UpdateMaintenanceStartTimeResult& UpdateMaintenanceStartTimeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("GatewayARN"))
   {
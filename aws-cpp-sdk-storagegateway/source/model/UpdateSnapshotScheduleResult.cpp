@@ -35,6 +35,7 @@ UpdateSnapshotScheduleResult::UpdateSnapshotScheduleResult(const AmazonWebServic
 
 UpdateSnapshotScheduleResult& UpdateSnapshotScheduleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VolumeARN"))
   {
@@ -35,6 +35,7 @@ UpdateVTLDeviceTypeResult::UpdateVTLDeviceTypeResult(const AmazonWebServiceResul
 
 UpdateVTLDeviceTypeResult& UpdateVTLDeviceTypeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("VTLDeviceARN"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sts/STS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/sts/model/Credentials.h>
 #include <aws/sts/model/AssumedRoleUser.h>
 #include <aws/sts/model/ResponseMetadata.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains the response to a successful <a>AssumeRole</a> request, including
    * temporary AWS credentials that can be used to make AWS requests. </p>
    */
-  class AWS_STS_API AssumeRoleResult
+  class AWS_STS_API AssumeRoleResult : public AmazonWebServiceResultBase
   {
   public:
     AssumeRoleResult();
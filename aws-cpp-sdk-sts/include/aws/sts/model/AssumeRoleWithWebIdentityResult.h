@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sts/STS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/sts/model/Credentials.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sts/model/AssumedRoleUser.h>
@@ -40,7 +41,7 @@ namespace Model
    * request, including temporary AWS credentials that can be used to make AWS
    * requests. </p>
    */
-  class AWS_STS_API AssumeRoleWithWebIdentityResult
+  class AWS_STS_API AssumeRoleWithWebIdentityResult : public AmazonWebServiceResultBase
   {
   public:
     AssumeRoleWithWebIdentityResult();
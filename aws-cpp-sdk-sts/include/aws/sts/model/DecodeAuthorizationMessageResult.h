@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sts/STS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/sts/model/ResponseMetadata.h>
 
@@ -38,7 +39,7 @@ namespace Model
    * status of a request from an encoded message that is returned in response to an
    * AWS request. </p>
    */
-  class AWS_STS_API DecodeAuthorizationMessageResult
+  class AWS_STS_API DecodeAuthorizationMessageResult : public AmazonWebServiceResultBase
   {
   public:
     DecodeAuthorizationMessageResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/sts/STS_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/sts/model/Credentials.h>
 #include <aws/sts/model/ResponseMetadata.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Contains the response to a successful <a>GetSessionToken</a> request,
    * including temporary AWS credentials that can be used to make AWS requests. </p>
    */
-  class AWS_STS_API GetSessionTokenResult
+  class AWS_STS_API GetSessionTokenResult : public AmazonWebServiceResultBase
   {
   public:
     GetSessionTokenResult();
@@ -39,6 +39,7 @@ AssumeRoleResult::AssumeRoleResult(const AmazonWebServiceResult<XmlDocument>& re
 
 AssumeRoleResult& AssumeRoleResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
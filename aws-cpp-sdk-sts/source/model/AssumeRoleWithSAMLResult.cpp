@@ -39,6 +39,7 @@ AssumeRoleWithSAMLResult::AssumeRoleWithSAMLResult(const AmazonWebServiceResult<
 
 AssumeRoleWithSAMLResult& AssumeRoleWithSAMLResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ AssumeRoleWithWebIdentityResult::AssumeRoleWithWebIdentityResult(const AmazonWeb
 
 AssumeRoleWithWebIdentityResult& AssumeRoleWithWebIdentityResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ DecodeAuthorizationMessageResult::DecodeAuthorizationMessageResult(const AmazonW
 
 DecodeAuthorizationMessageResult& DecodeAuthorizationMessageResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -39,6 +39,7 @@ GetFederationTokenResult::GetFederationTokenResult(const AmazonWebServiceResult<
 
 GetFederationTokenResult& GetFederationTokenResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
@@ -37,6 +37,7 @@ GetSessionTokenResult::GetSessionTokenResult(const AmazonWebServiceResult<XmlDoc
 
 GetSessionTokenResult& GetSessionTokenResult::operator =(const AmazonWebServiceResult<XmlDocument>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
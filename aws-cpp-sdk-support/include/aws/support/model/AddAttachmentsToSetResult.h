@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The ID and expiry time of the attachment set returned by the
    * <a>AddAttachmentsToSet</a> operation.</p>
    */
-  class AWS_SUPPORT_API AddAttachmentsToSetResult
+  class AWS_SUPPORT_API AddAttachmentsToSetResult : public AmazonWebServiceResultBase
   {
   public:
     AddAttachmentsToSetResult();
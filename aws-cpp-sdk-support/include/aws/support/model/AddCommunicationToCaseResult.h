@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>The result of the <a>AddCommunicationToCase</a> operation.</p>
    */
-  class AWS_SUPPORT_API AddCommunicationToCaseResult
+  class AWS_SUPPORT_API AddCommunicationToCaseResult : public AmazonWebServiceResultBase
   {
   public:
     AddCommunicationToCaseResult();
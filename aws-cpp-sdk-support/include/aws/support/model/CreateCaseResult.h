@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The AWS Support case ID returned by a successful completion of the
    * <a>CreateCase</a> operation. </p>
    */
-  class AWS_SUPPORT_API CreateCaseResult
+  class AWS_SUPPORT_API CreateCaseResult : public AmazonWebServiceResultBase
   {
   public:
     CreateCaseResult();
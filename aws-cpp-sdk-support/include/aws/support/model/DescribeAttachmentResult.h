@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/support/model/Attachment.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The content and file name of the attachment returned by the
    * <a>DescribeAttachment</a> operation.</p>
    */
-  class AWS_SUPPORT_API DescribeAttachmentResult
+  class AWS_SUPPORT_API DescribeAttachmentResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeAttachmentResult();
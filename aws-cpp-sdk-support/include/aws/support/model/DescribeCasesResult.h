@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/support/model/CaseDetails.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Returns an array of <a>CaseDetails</a> objects and a <code>NextToken</code>
    * that defines a point for pagination in the result set.</p>
    */
-  class AWS_SUPPORT_API DescribeCasesResult
+  class AWS_SUPPORT_API DescribeCasesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeCasesResult();
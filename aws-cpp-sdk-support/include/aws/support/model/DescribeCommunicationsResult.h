@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/support/model/Communication.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>The communications returned by the <a>DescribeCommunications</a>
    * operation.</p>
    */
-  class AWS_SUPPORT_API DescribeCommunicationsResult
+  class AWS_SUPPORT_API DescribeCommunicationsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeCommunicationsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/support/model/Service.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The list of AWS services returned by the <a>DescribeServices</a>
    * operation.</p>
    */
-  class AWS_SUPPORT_API DescribeServicesResult
+  class AWS_SUPPORT_API DescribeServicesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeServicesResult();
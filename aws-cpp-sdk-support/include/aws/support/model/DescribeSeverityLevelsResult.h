@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/support/model/SeverityLevel.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The list of severity levels returned by the <a>DescribeSeverityLevels</a>
    * operation.</p>
    */
-  class AWS_SUPPORT_API DescribeSeverityLevelsResult
+  class AWS_SUPPORT_API DescribeSeverityLevelsResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeSeverityLevelsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/support/model/TrustedAdvisorCheckRefreshStatus.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The statuses of the Trusted Advisor checks returned by the
    * <a>DescribeTrustedAdvisorCheckRefreshStatuses</a> operation.</p>
    */
-  class AWS_SUPPORT_API DescribeTrustedAdvisorCheckRefreshStatusesResult
+  class AWS_SUPPORT_API DescribeTrustedAdvisorCheckRefreshStatusesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTrustedAdvisorCheckRefreshStatusesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/support/model/TrustedAdvisorCheckResult.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The result of the Trusted Advisor check returned by the
    * <a>DescribeTrustedAdvisorCheckResult</a> operation.</p>
    */
-  class AWS_SUPPORT_API DescribeTrustedAdvisorCheckResultResult
+  class AWS_SUPPORT_API DescribeTrustedAdvisorCheckResultResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTrustedAdvisorCheckResultResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/support/model/TrustedAdvisorCheckSummary.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>The summaries of the Trusted Advisor checks returned by the
    * <a>DescribeTrustedAdvisorCheckSummaries</a> operation.</p>
    */
-  class AWS_SUPPORT_API DescribeTrustedAdvisorCheckSummariesResult
+  class AWS_SUPPORT_API DescribeTrustedAdvisorCheckSummariesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTrustedAdvisorCheckSummariesResult();
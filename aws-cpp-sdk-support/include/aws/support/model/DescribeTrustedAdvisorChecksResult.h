@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/support/model/TrustedAdvisorCheckDescription.h>
 
@@ -37,7 +38,7 @@ namespace Model
    * <p>Information about the Trusted Advisor checks returned by the
    * <a>DescribeTrustedAdvisorChecks</a> operation.</p>
    */
-  class AWS_SUPPORT_API DescribeTrustedAdvisorChecksResult
+  class AWS_SUPPORT_API DescribeTrustedAdvisorChecksResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeTrustedAdvisorChecksResult();
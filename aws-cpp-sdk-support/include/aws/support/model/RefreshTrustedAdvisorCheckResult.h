@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/support/model/TrustedAdvisorCheckRefreshStatus.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The current refresh status of a Trusted Advisor check.</p>
    */
-  class AWS_SUPPORT_API RefreshTrustedAdvisorCheckResult
+  class AWS_SUPPORT_API RefreshTrustedAdvisorCheckResult : public AmazonWebServiceResultBase
   {
   public:
     RefreshTrustedAdvisorCheckResult();
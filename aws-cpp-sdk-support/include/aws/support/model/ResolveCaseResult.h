@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/support/Support_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The status of the case returned by the <a>ResolveCase</a> operation.</p>
    */
-  class AWS_SUPPORT_API ResolveCaseResult
+  class AWS_SUPPORT_API ResolveCaseResult : public AmazonWebServiceResultBase
   {
   public:
     ResolveCaseResult();
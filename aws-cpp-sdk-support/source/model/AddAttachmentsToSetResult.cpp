@@ -35,6 +35,7 @@ AddAttachmentsToSetResult::AddAttachmentsToSetResult(const AmazonWebServiceResul
 
 AddAttachmentsToSetResult& AddAttachmentsToSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("attachmentSetId"))
   {
@@ -37,6 +37,7 @@ AddCommunicationToCaseResult::AddCommunicationToCaseResult(const AmazonWebServic
 
 AddCommunicationToCaseResult& AddCommunicationToCaseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("result"))
   {
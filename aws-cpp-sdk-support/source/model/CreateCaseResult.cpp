@@ -35,6 +35,7 @@ CreateCaseResult::CreateCaseResult(const AmazonWebServiceResult<JsonValue>& resu
 
 CreateCaseResult& CreateCaseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("caseId"))
   {
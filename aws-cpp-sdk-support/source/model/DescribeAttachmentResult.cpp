@@ -35,6 +35,7 @@ DescribeAttachmentResult::DescribeAttachmentResult(const AmazonWebServiceResult<
 
 DescribeAttachmentResult& DescribeAttachmentResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("attachment"))
   {
@@ -35,6 +35,7 @@ DescribeCasesResult::DescribeCasesResult(const AmazonWebServiceResult<JsonValue>
 
 DescribeCasesResult& DescribeCasesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("cases"))
   {
@@ -35,6 +35,7 @@ DescribeCommunicationsResult::DescribeCommunicationsResult(const AmazonWebServic
 
 DescribeCommunicationsResult& DescribeCommunicationsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("communications"))
   {
@@ -35,6 +35,7 @@ DescribeSeverityLevelsResult::DescribeSeverityLevelsResult(const AmazonWebServic
 
 DescribeSeverityLevelsResult& DescribeSeverityLevelsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("severityLevels"))
   {
@@ -35,6 +35,7 @@ DescribeTrustedAdvisorCheckRefreshStatusesResult::DescribeTrustedAdvisorCheckRef
 
 DescribeTrustedAdvisorCheckRefreshStatusesResult& DescribeTrustedAdvisorCheckRefreshStatusesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("statuses"))
   {
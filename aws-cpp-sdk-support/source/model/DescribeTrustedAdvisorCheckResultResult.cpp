@@ -35,6 +35,7 @@ DescribeTrustedAdvisorCheckResultResult::DescribeTrustedAdvisorCheckResultResult
 
 DescribeTrustedAdvisorCheckResultResult& DescribeTrustedAdvisorCheckResultResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("result"))
   {
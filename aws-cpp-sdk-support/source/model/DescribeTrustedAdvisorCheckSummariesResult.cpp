@@ -35,6 +35,7 @@ DescribeTrustedAdvisorCheckSummariesResult::DescribeTrustedAdvisorCheckSummaries
 
 DescribeTrustedAdvisorCheckSummariesResult& DescribeTrustedAdvisorCheckSummariesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("summaries"))
   {
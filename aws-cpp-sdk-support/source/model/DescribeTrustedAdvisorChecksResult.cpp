@@ -35,6 +35,7 @@ DescribeTrustedAdvisorChecksResult::DescribeTrustedAdvisorChecksResult(const Ama
 
 DescribeTrustedAdvisorChecksResult& DescribeTrustedAdvisorChecksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("checks"))
   {
@@ -35,6 +35,7 @@ RefreshTrustedAdvisorCheckResult::RefreshTrustedAdvisorCheckResult(const AmazonW
 
 RefreshTrustedAdvisorCheckResult& RefreshTrustedAdvisorCheckResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("status"))
   {
@@ -35,6 +35,7 @@ ResolveCaseResult::ResolveCaseResult(const AmazonWebServiceResult<JsonValue>& re
 
 ResolveCaseResult& ResolveCaseResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("initialCaseStatus"))
   {
@@ -35,6 +35,10 @@ namespace Model
   {
   public:
     CountClosedWorkflowExecutionsRequest();
+
+    //the operation that sends this request, which names it in client metrics
+    inline const char* GetServiceRequestName() const override { return "CountClosedWorkflowExecutions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -35,7 +36,7 @@ namespace Model
    * <p>Contains the count of workflow executions returned from
    * <a>CountOpenWorkflowExecutions</a> or <a>CountClosedWorkflowExecutions</a></p>
    */
-  class AWS_SWF_API CountOpenWorkflowExecutionsResult
+  class AWS_SWF_API CountOpenWorkflowExecutionsResult : public AmazonWebServiceResultBase
   {
   public:
     CountOpenWorkflowExecutionsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Contains the count of tasks in a task list.</p>
    */
-  class AWS_SWF_API CountPendingActivityTasksResult
+  class AWS_SWF_API CountPendingActivityTasksResult : public AmazonWebServiceResultBase
   {
   public:
     CountPendingActivityTasksResult();
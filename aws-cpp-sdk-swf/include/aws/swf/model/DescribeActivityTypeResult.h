@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/swf/model/ActivityTypeInfo.h>
 #include <aws/swf/model/ActivityTypeConfiguration.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Detailed information about an activity type.</p>
    */
-  class AWS_SWF_API DescribeActivityTypeResult
+  class AWS_SWF_API DescribeActivityTypeResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeActivityTypeResult();
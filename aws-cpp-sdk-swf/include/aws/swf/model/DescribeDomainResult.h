@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/swf/model/DomainInfo.h>
 #include <aws/swf/model/DomainConfiguration.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains details of a domain.</p>
    */
-  class AWS_SWF_API DescribeDomainResult
+  class AWS_SWF_API DescribeDomainResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeDomainResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/swf/model/WorkflowExecutionInfo.h>
 #include <aws/swf/model/WorkflowExecutionConfiguration.h>
 #include <aws/swf/model/WorkflowExecutionOpenCounts.h>
@@ -38,7 +39,7 @@ namespace Model
   /**
    * <p>Contains details about a workflow execution.</p>
    */
-  class AWS_SWF_API DescribeWorkflowExecutionResult
+  class AWS_SWF_API DescribeWorkflowExecutionResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeWorkflowExecutionResult();
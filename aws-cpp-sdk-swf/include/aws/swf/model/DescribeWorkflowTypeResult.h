@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/swf/model/WorkflowTypeInfo.h>
 #include <aws/swf/model/WorkflowTypeConfiguration.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains details about a workflow type.</p>
    */
-  class AWS_SWF_API DescribeWorkflowTypeResult
+  class AWS_SWF_API DescribeWorkflowTypeResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeWorkflowTypeResult();
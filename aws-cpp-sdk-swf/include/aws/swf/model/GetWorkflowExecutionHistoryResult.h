@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/swf/model/HistoryEvent.h>
@@ -39,7 +40,7 @@ namespace Model
    * is the up to date, complete and authoritative record of the events related to
    * all tasks and events in the life of the workflow execution.</p>
    */
-  class AWS_SWF_API GetWorkflowExecutionHistoryResult
+  class AWS_SWF_API GetWorkflowExecutionHistoryResult : public AmazonWebServiceResultBase
   {
   public:
     GetWorkflowExecutionHistoryResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/swf/model/WorkflowExecutionInfo.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains a paginated list of information about workflow executions.</p>
    */
-  class AWS_SWF_API ListClosedWorkflowExecutionsResult
+  class AWS_SWF_API ListClosedWorkflowExecutionsResult : public AmazonWebServiceResultBase
   {
   public:
     ListClosedWorkflowExecutionsResult();
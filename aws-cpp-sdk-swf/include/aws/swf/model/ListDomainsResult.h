@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/swf/model/DomainInfo.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains a paginated collection of DomainInfo structures.</p>
    */
-  class AWS_SWF_API ListDomainsResult
+  class AWS_SWF_API ListDomainsResult : public AmazonWebServiceResultBase
   {
   public:
     ListDomainsResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/swf/model/WorkflowTypeInfo.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains a paginated list of information structures about workflow types.</p>
    */
-  class AWS_SWF_API ListWorkflowTypesResult
+  class AWS_SWF_API ListWorkflowTypesResult : public AmazonWebServiceResultBase
   {
   public:
     ListWorkflowTypesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/swf/model/WorkflowExecution.h>
 #include <aws/swf/model/ActivityType.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Unit of work sent to an activity worker.</p>
    */
-  class AWS_SWF_API PollForActivityTaskResult
+  class AWS_SWF_API PollForActivityTaskResult : public AmazonWebServiceResultBase
   {
   public:
     PollForActivityTaskResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/swf/model/WorkflowExecution.h>
 #include <aws/swf/model/WorkflowType.h>
@@ -40,7 +41,7 @@ namespace Model
    * <p>A structure that represents a decision task. Decision tasks are sent to
    * deciders in order for them to make decisions.</p>
    */
-  class AWS_SWF_API PollForDecisionTaskResult
+  class AWS_SWF_API PollForDecisionTaskResult : public AmazonWebServiceResultBase
   {
   public:
     PollForDecisionTaskResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 
 namespace Aws
 {
@@ -34,7 +35,7 @@ namespace Model
   /**
    * <p>Status information about an activity task.</p>
    */
-  class AWS_SWF_API RecordActivityTaskHeartbeatResult
+  class AWS_SWF_API RecordActivityTaskHeartbeatResult : public AmazonWebServiceResultBase
   {
   public:
     RecordActivityTaskHeartbeatResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/swf/SWF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>Specifies the <code>runId</code> of a workflow execution.</p>
    */
-  class AWS_SWF_API StartWorkflowExecutionResult
+  class AWS_SWF_API StartWorkflowExecutionResult : public AmazonWebServiceResultBase
   {
   public:
     StartWorkflowExecutionResult();
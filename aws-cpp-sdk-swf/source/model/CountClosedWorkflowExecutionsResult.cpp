@@ -39,6 +39,7 @@ CountClosedWorkflowExecutionsResult::CountClosedWorkflowExecutionsResult(const A
 
 CountClosedWorkflowExecutionsResult& CountClosedWorkflowExecutionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("count"))
   {
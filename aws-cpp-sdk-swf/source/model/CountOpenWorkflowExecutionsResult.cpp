@@ -39,6 +39,7 @@ CountOpenWorkflowExecutionsResult::CountOpenWorkflowExecutionsResult(const Amazo
 
 CountOpenWorkflowExecutionsResult& CountOpenWorkflowExecutionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("count"))
   {
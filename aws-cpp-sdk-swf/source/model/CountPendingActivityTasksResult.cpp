@@ -39,6 +39,7 @@ CountPendingActivityTasksResult::CountPendingActivityTasksResult(const AmazonWeb
 
 CountPendingActivityTasksResult& CountPendingActivityTasksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("count"))
   {
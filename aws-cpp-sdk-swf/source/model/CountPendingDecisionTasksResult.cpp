@@ -39,6 +39,7 @@ CountPendingDecisionTasksResult::CountPendingDecisionTasksResult(const AmazonWeb
 
 CountPendingDecisionTasksResult& CountPendingDecisionTasksResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("count"))
   {
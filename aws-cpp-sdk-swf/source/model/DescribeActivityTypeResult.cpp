@@ -35,6 +35,7 @@ DescribeActivityTypeResult::DescribeActivityTypeResult(const AmazonWebServiceRes
 
 DescribeActivityTypeResult& DescribeActivityTypeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("typeInfo"))
   {
@@ -35,6 +35,7 @@ DescribeDomainResult::DescribeDomainResult(const AmazonWebServiceResult<JsonValu
 
 DescribeDomainResult& DescribeDomainResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("domainInfo"))
   {
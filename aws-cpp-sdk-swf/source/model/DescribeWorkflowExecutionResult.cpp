@@ -37,6 +37,7 @@ DescribeWorkflowExecutionResult::DescribeWorkflowExecutionResult(const AmazonWeb
 
 DescribeWorkflowExecutionResult& DescribeWorkflowExecutionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("executionInfo"))
   {
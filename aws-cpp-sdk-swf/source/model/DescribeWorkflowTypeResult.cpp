@@ -35,6 +35,7 @@ DescribeWorkflowTypeResult::DescribeWorkflowTypeResult(const AmazonWebServiceRes
 
 DescribeWorkflowTypeResult& DescribeWorkflowTypeResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("typeInfo"))
   {
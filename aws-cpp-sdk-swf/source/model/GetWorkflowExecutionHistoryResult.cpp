@@ -35,6 +35,7 @@ GetWorkflowExecutionHistoryResult::GetWorkflowExecutionHistoryResult(const Amazo
 
 GetWorkflowExecutionHistoryResult& GetWorkflowExecutionHistoryResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("events"))
   {
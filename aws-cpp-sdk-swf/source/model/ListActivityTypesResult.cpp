@@ -35,6 +35,7 @@ ListActivityTypesResult::ListActivityTypesResult(const AmazonWebServiceResult<Js
 
 ListActivityTypesResult& ListActivityTypesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("typeInfos"))
   {
@@ -35,6 +35,7 @@ ListClosedWorkflowExecutionsResult::ListClosedWorkflowExecutionsResult(const Ama
 
 ListClosedWorkflowExecutionsResult& ListClosedWorkflowExecutionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("executionInfos"))
   {
@@ -35,6 +35,7 @@ ListDomainsResult::ListDomainsResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListDomainsResult& ListDomainsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("domainInfos"))
   {
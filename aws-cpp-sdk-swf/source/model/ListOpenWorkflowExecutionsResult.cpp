@@ -35,6 +35,7 @@ ListOpenWorkflowExecutionsResult::ListOpenWorkflowExecutionsResult(const AmazonW
 
 ListOpenWorkflowExecutionsResult& ListOpenWorkflowExecutionsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("executionInfos"))
   {
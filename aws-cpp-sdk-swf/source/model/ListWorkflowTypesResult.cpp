@@ -35,6 +35,7 @@ ListWorkflowTypesResult::ListWorkflowTypesResult(const AmazonWebServiceResult<Js
 
 ListWorkflowTypesResult& ListWorkflowTypesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("typeInfos"))
   {
@@ -37,6 +37,7 @@ PollForActivityTaskResult::PollForActivityTaskResult(const AmazonWebServiceResul
 
 PollForActivityTaskResult& PollForActivityTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskToken"))
   {
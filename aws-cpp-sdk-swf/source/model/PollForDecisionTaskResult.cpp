@@ -39,6 +39,7 @@ PollForDecisionTaskResult::PollForDecisionTaskResult(const AmazonWebServiceResul
 
 PollForDecisionTaskResult& PollForDecisionTaskResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("taskToken"))
   {
@@ -37,6 +37,7 @@ RecordActivityTaskHeartbeatResult::RecordActivityTaskHeartbeatResult(const Amazo
 
 RecordActivityTaskHeartbeatResult& RecordActivityTaskHeartbeatResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("cancelRequested"))
   {
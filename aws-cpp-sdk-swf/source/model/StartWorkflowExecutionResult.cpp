@@ -35,6 +35,7 @@ StartWorkflowExecutionResult::StartWorkflowExecutionResult(const AmazonWebServic
 
 StartWorkflowExecutionResult& StartWorkflowExecutionResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("runId"))
   {
@@ -78,6 +78,13 @@ class AWS_TRANSFER_API TransferClient
         // User requested download cancels should go through here
         void CancelDownload(std::shared_ptr<DownloadFileRequest>& fileRequest) const;
 
+        // Reads length bytes of an object, starting at firstByte, straight into buffer which must hold at least length bytes.
+        // The body is written directly into buffer with no intermediate copies or reallocations; the outcome's body reads it back, so buffer has to outlive the outcome.
+        // The result's content length is how many bytes were actually read, which is less than length if the object ends first.
+        Aws::S3::Model::GetObjectOutcome DownloadRange(const Aws::String& bucketName, const Aws::String& keyName, uint64_t firstByte, unsigned char* buffer, size_t length) const;
+        // As above, reading buffer->GetLength() bytes into buffer, which the outcome keeps alive
+        Aws::S3::Model::GetObjectOutcome DownloadRange(const Aws::String& bucketName, const Aws::String& keyName, uint64_t firstByte, const std::shared_ptr<Aws::Utils::ByteBuffer>& buffer) const;
+
         const std::shared_ptr<Aws::S3::S3Client>& GetS3Client() { return m_s3Client; }
 
         uint32_t GetConfigBufferCount() const { return m_config.m_uploadBufferCount; }
@@ -152,6 +152,7 @@ private:
     // TransferClient uses these calls
     bool ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffer);
  
+    // Fills buffer with the next part of the file; streamBuf reads straight out of buffer
     uint64_t ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, std::shared_ptr<Aws::IOStream>& streamBuf, uint32_t& partNum);
 
     void AddCompletedPart(PartRequestRecord& partRequest, const Aws::String& eTag);
@@ -23,6 +23,9 @@
 #include <aws/transfer/resource/FairBoundedResourceManager.h>
 #include <aws/transfer/resource/ScopedResourceSet.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/PreallocatedStream.h>
+#include <aws/s3/model/GetObjectRequest.h>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
@@ -155,6 +158,47 @@ void TransferClient::GetContentsInternal(std::shared_ptr<DownloadFileRequest>& r
     request->GetContents();
 }
 
+static GetObjectRequest BuildRangeRequest(const Aws::String& bucketName, const Aws::String& keyName, uint64_t firstByte, size_t length, const Aws::IOStreamFactory& bodyFactory)
+{
+    GetObjectRequest getObjectRequest;
+    getObjectRequest.SetBucket(bucketName);
+    getObjectRequest.SetKey(keyName);
+
+    Aws::StringStream range;
+    range << "bytes=" << firstByte << "-" << firstByte + length - 1;
+    getObjectRequest.SetRange(range.str());
+    getObjectRequest.SetResponseStreamFactory(bodyFactory);
+
+    return getObjectRequest;
+}
+
+static GetObjectOutcome EmptyRangeOutcome()
+{
+    return GetObjectOutcome(Aws::Client::AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::INVALID_PARAMETER_VALUE, "InvalidParameterValue",
+        "A ranged download needs a buffer of at least one byte", false));
+}
+
+GetObjectOutcome TransferClient::DownloadRange(const Aws::String& bucketName, const Aws::String& keyName, uint64_t firstByte, unsigned char* buffer, size_t length) const
+{
+    if (buffer == nullptr || length == 0)
+    {
+        return EmptyRangeOutcome();
+    }
+
+    return m_s3Client->GetObject(BuildRangeRequest(bucketName, keyName, firstByte, length, Stream::PreallocatedResponseStreamFactory(buffer, length)));
+}
+
+GetObjectOutcome TransferClient::DownloadRange(const Aws::String& bucketName, const Aws::String& keyName, uint64_t firstByte, const std::shared_ptr<ByteBuffer>& buffer) const
+{
+    if (!buffer || buffer->GetLength() == 0)
+    {
+        return EmptyRangeOutcome();
+    }
+
+    //the factory holds on to the buffer, so it stays valid however long the outcome's body is kept around
+    return m_s3Client->GetObject(BuildRangeRequest(bucketName, keyName, firstByte, buffer->GetLength(), Stream::PreallocatedResponseStreamFactory(buffer)));
+}
+
 void TransferClient::OnCreateBucket(const Aws::S3::S3Client* s3Client,
     const Aws::S3::Model::CreateBucketRequest& request,
     const Aws::S3::Model::CreateBucketOutcome& outcome,
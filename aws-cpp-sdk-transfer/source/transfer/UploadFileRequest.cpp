@@ -33,6 +33,10 @@
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/MultiDigest.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/stream/ReadOnlyMemoryStream.h>
 
 #include <algorithm>
 
@@ -51,6 +55,23 @@ static const uint32_t PART_RETRY_MAX = 2; // How many failures on a single part
 
 static const uint32_t CONSISTENCY_RETRY_MAX = 20; // If we're checking for consistency in S3 we may need to perform HeadObject, GetObject, and ListObjects checks several times to ensure the object has propagated
 
+// The md5 of a body goes into content-md5 (and is checked against the returned etag), while the signer needs its sha256.
+// Take both in a single read of the body; sha256 is left empty on failure and the signer computes it itself.
+static void CalculateBodyDigests(Aws::IOStream& body, ByteBuffer& md5, ByteBuffer& sha256)
+{
+    Crypto::MultiDigest digests({ Aws::MakeShared<Crypto::MD5>(ALLOCATION_TAG), Aws::MakeShared<Crypto::Sha256>(ALLOCATION_TAG) });
+    auto hashResults = digests.Calculate(body);
+    if (!hashResults[0].IsSuccess() || !hashResults[1].IsSuccess())
+    {
+        md5 = HashingUtils::CalculateMD5(body);
+        sha256 = ByteBuffer();
+        return;
+    }
+
+    md5 = hashResults[0].GetResult();
+    sha256 = hashResults[1].GetResult();
+}
+
 UploadFileRequest::UploadFileRequest(const Aws::String& fileName, 
                                      const Aws::String& bucketName, 
                                      const Aws::String& keyName, 
@@ -507,14 +528,9 @@ uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& bu
         }
     }
 
-    // This is not ideal!  You're thinking "Wait, we got this buffer up there and now we're making a copy anyway.." You are right!
-    // This needs to be done in a better way.  pubsetbuf it turns out does not work as I'd hoped.  The buffer is still essentially acting a shared
-    // resource throttle, albeit double what is intended currently with the stream copy happening.  
-    // S3Client could be made to accept a buffer.. I'm thinking we're not doing that either.
-    // At this point this is considered a not horrible solution but one we'd like to try to revisit  
-    streamBuf->write((char*)buffer->GetUnderlyingData(), bytesRead);
-
-    streamBuf->seekg(0);
+    // The request body reads straight out of the buffer, so the buffer is all the memory a part takes.  The buffer is held by the
+    // pending part (or, for a single object upload, by our resources) until the upload is done with it, so it won't be refilled underneath the request.
+    streamBuf = Aws::MakeShared<Stream::ReadOnlyMemoryStream>(ALLOCATION_TAG, buffer->GetUnderlyingData(), static_cast<size_t>(bytesRead), buffer);
 
     return bytesRead;
 }
@@ -527,7 +543,7 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
         return false;
     }
 
-    std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    std::shared_ptr<Aws::IOStream> streamBuf;
     uint32_t partNum = 0;
     uint64_t bytesRead = ReadNextPart(buffer, streamBuf, partNum);
 
@@ -548,8 +564,10 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
     thisRequest.m_partRequest.SetPartNumber(partNum);
     thisRequest.m_partRequest.SetUploadId(GetUploadId());
     thisRequest.m_partRequest.SetBody(streamBuf);
-    thisRequest.m_partMd5 = HashingUtils::CalculateMD5(*streamBuf);
+    ByteBuffer partSha256;
+    CalculateBodyDigests(*streamBuf, thisRequest.m_partMd5, partSha256);
     thisRequest.m_partRequest.SetContentMD5(HashingUtils::Base64Encode(thisRequest.m_partMd5));
+    thisRequest.m_partRequest.SetContentSha256Digest(partSha256);
     thisRequest.m_partRequest.SetContentLength(static_cast<long>(bytesRead));
 
     thisRequest.m_partRequest.SetDataSentEventHandler(std::bind(&UploadFileRequest::OnDataSent, this, std::placeholders::_1, std::placeholders::_2));
@@ -799,7 +817,11 @@ bool UploadFileRequest::DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& str
 
     putObjectRequest.SetBody(streamBuf);
     putObjectRequest.SetContentLength(static_cast<long>(bytesRead));
-    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(HashingUtils::CalculateMD5(*putObjectRequest.GetBody())));
+    ByteBuffer md5;
+    ByteBuffer sha256;
+    CalculateBodyDigests(*streamBuf, md5, sha256);
+    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(md5));
+    putObjectRequest.SetContentSha256Digest(sha256);
     if (m_contentType.length())
     {
         putObjectRequest.SetContentType(m_contentType);
@@ -833,7 +855,8 @@ bool UploadFileRequest::HandlePutObjectOutcome(const Aws::S3::Model::PutObjectRe
 {
     //verify md5 sums between what was sent and what s3 told us they received.
     Aws::StringStream ss;
-    ss << "\"" << HashingUtils::HexEncode(HashingUtils::CalculateMD5(*request.GetBody())) << "\"";
+    //the md5 was taken when the request was built, no need to read the body again for it
+    ss << "\"" << HashingUtils::HexEncode(HashingUtils::Base64Decode(request.GetContentMD5())) << "\"";
 
     if (outcome.IsSuccess() && (ss.str() == outcome.GetResult().GetETag()))
     {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/waf/model/ByteMatchSet.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API CreateByteMatchSetResult
+  class AWS_WAF_API CreateByteMatchSetResult : public AmazonWebServiceResultBase
   {
   public:
     CreateByteMatchSetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/waf/model/Rule.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -33,7 +34,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API CreateRuleResult
+  class AWS_WAF_API CreateRuleResult : public AmazonWebServiceResultBase
   {
   public:
     CreateRuleResult();
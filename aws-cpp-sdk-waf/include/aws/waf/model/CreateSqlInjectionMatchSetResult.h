@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/waf/model/SqlInjectionMatchSet.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>The response to a <code>CreateSqlInjectionMatchSet</code> request.</p>
    */
-  class AWS_WAF_API CreateSqlInjectionMatchSetResult
+  class AWS_WAF_API CreateSqlInjectionMatchSetResult : public AmazonWebServiceResultBase
   {
   public:
     CreateSqlInjectionMatchSetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -36,7 +37,7 @@ namespace Model
    * <p>The response to a request to delete a <a>SqlInjectionMatchSet</a> from AWS
    * WAF.</p>
    */
-  class AWS_WAF_API DeleteSqlInjectionMatchSetResult
+  class AWS_WAF_API DeleteSqlInjectionMatchSetResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteSqlInjectionMatchSetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API DeleteWebACLResult
+  class AWS_WAF_API DeleteWebACLResult : public AmazonWebServiceResultBase
   {
   public:
     DeleteWebACLResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/waf/model/ByteMatchSet.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API GetByteMatchSetResult
+  class AWS_WAF_API GetByteMatchSetResult : public AmazonWebServiceResultBase
   {
   public:
     GetByteMatchSetResult();
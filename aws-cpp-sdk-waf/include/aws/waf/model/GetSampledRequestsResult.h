@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/waf/model/TimeWindow.h>
 #include <aws/waf/model/SampledHTTPRequest.h>
@@ -34,7 +35,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API GetSampledRequestsResult
+  class AWS_WAF_API GetSampledRequestsResult : public AmazonWebServiceResultBase
   {
   public:
     GetSampledRequestsResult();
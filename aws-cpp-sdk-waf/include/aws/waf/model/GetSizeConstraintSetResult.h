@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/waf/model/SizeConstraintSet.h>
 
 namespace Aws
@@ -32,7 +33,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API GetSizeConstraintSetResult
+  class AWS_WAF_API GetSizeConstraintSetResult : public AmazonWebServiceResultBase
   {
   public:
     GetSizeConstraintSetResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/waf/model/SqlInjectionMatchSet.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The response to a <a>GetSqlInjectionMatchSet</a> request.</p>
    */
-  class AWS_WAF_API GetSqlInjectionMatchSetResult
+  class AWS_WAF_API GetSqlInjectionMatchSetResult : public AmazonWebServiceResultBase
   {
   public:
     GetSqlInjectionMatchSetResult();
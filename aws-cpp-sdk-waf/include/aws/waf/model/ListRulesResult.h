@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/waf/model/RuleSummary.h>
@@ -34,7 +35,7 @@ namespace WAF
 {
 namespace Model
 {
-  class AWS_WAF_API ListRulesResult
+  class AWS_WAF_API ListRulesResult : public AmazonWebServiceResultBase
   {
   public:
     ListRulesResult();
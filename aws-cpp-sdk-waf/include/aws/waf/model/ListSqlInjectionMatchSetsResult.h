@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/waf/model/SqlInjectionMatchSetSummary.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>The response to a <a>ListSqlInjectionMatchSets</a> request.</p>
    */
-  class AWS_WAF_API ListSqlInjectionMatchSetsResult
+  class AWS_WAF_API ListSqlInjectionMatchSetsResult : public AmazonWebServiceResultBase
   {
   public:
     ListSqlInjectionMatchSetsResult();
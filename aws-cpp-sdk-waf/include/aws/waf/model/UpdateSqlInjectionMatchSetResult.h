@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/waf/WAF_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 namespace Aws
@@ -35,7 +36,7 @@ namespace Model
   /**
    * <p>The response to an <a>UpdateSqlInjectionMatchSets</a> request.</p>
    */
-  class AWS_WAF_API UpdateSqlInjectionMatchSetResult
+  class AWS_WAF_API UpdateSqlInjectionMatchSetResult : public AmazonWebServiceResultBase
   {
   public:
     UpdateSqlInjectionMatchSetResult();
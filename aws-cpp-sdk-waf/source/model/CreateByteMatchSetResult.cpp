@@ -35,6 +35,7 @@ CreateByteMatchSetResult::CreateByteMatchSetResult(const AmazonWebServiceResult<
 
 CreateByteMatchSetResult& CreateByteMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ByteMatchSet"))
   {
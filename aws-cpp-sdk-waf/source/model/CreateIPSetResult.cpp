@@ -35,6 +35,7 @@ CreateIPSetResult::CreateIPSetResult(const AmazonWebServiceResult<JsonValue>& re
 
 CreateIPSetResult& CreateIPSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IPSet"))
   {
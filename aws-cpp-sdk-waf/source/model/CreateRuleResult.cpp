@@ -35,6 +35,7 @@ CreateRuleResult::CreateRuleResult(const AmazonWebServiceResult<JsonValue>& resu
 
 CreateRuleResult& CreateRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Rule"))
   {
@@ -35,6 +35,7 @@ CreateSizeConstraintSetResult::CreateSizeConstraintSetResult(const AmazonWebServ
 
 CreateSizeConstraintSetResult& CreateSizeConstraintSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SizeConstraintSet"))
   {
@@ -35,6 +35,7 @@ CreateSqlInjectionMatchSetResult::CreateSqlInjectionMatchSetResult(const AmazonW
 
 CreateSqlInjectionMatchSetResult& CreateSqlInjectionMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SqlInjectionMatchSet"))
   {
@@ -35,6 +35,7 @@ CreateWebACLResult::CreateWebACLResult(const AmazonWebServiceResult<JsonValue>&
 
 CreateWebACLResult& CreateWebACLResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("WebACL"))
   {
@@ -35,6 +35,7 @@ DeleteByteMatchSetResult::DeleteByteMatchSetResult(const AmazonWebServiceResult<
 
 DeleteByteMatchSetResult& DeleteByteMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
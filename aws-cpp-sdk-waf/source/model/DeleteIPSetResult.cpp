@@ -35,6 +35,7 @@ DeleteIPSetResult::DeleteIPSetResult(const AmazonWebServiceResult<JsonValue>& re
 
 DeleteIPSetResult& DeleteIPSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
@@ -35,6 +35,7 @@ DeleteRuleResult::DeleteRuleResult(const AmazonWebServiceResult<JsonValue>& resu
 
 DeleteRuleResult& DeleteRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
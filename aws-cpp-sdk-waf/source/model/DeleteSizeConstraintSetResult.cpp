@@ -35,6 +35,7 @@ DeleteSizeConstraintSetResult::DeleteSizeConstraintSetResult(const AmazonWebServ
 
 DeleteSizeConstraintSetResult& DeleteSizeConstraintSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
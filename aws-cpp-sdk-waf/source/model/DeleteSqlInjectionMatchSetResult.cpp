@@ -35,6 +35,7 @@ DeleteSqlInjectionMatchSetResult::DeleteSqlInjectionMatchSetResult(const AmazonW
 
 DeleteSqlInjectionMatchSetResult& DeleteSqlInjectionMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
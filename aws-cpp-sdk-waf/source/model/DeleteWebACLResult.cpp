@@ -35,6 +35,7 @@ DeleteWebACLResult::DeleteWebACLResult(const AmazonWebServiceResult<JsonValue>&
 
 DeleteWebACLResult& DeleteWebACLResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
@@ -35,6 +35,7 @@ GetByteMatchSetResult::GetByteMatchSetResult(const AmazonWebServiceResult<JsonVa
 
 GetByteMatchSetResult& GetByteMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ByteMatchSet"))
   {
@@ -35,6 +35,7 @@ GetChangeTokenResult::GetChangeTokenResult(const AmazonWebServiceResult<JsonValu
 
 GetChangeTokenResult& GetChangeTokenResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
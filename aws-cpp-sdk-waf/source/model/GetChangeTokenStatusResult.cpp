@@ -35,6 +35,7 @@ GetChangeTokenStatusResult::GetChangeTokenStatusResult(const AmazonWebServiceRes
 
 GetChangeTokenStatusResult& GetChangeTokenStatusResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeTokenStatus"))
   {
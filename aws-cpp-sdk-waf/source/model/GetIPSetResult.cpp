@@ -35,6 +35,7 @@ GetIPSetResult::GetIPSetResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetIPSetResult& GetIPSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("IPSet"))
   {
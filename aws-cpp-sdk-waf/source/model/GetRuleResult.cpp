@@ -35,6 +35,7 @@ GetRuleResult::GetRuleResult(const AmazonWebServiceResult<JsonValue>& result)
 
 GetRuleResult& GetRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Rule"))
   {
@@ -37,6 +37,7 @@ GetSampledRequestsResult::GetSampledRequestsResult(const AmazonWebServiceResult<
 
 GetSampledRequestsResult& GetSampledRequestsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SampledRequests"))
   {
@@ -35,6 +35,7 @@ GetSizeConstraintSetResult::GetSizeConstraintSetResult(const AmazonWebServiceRes
 
 GetSizeConstraintSetResult& GetSizeConstraintSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SizeConstraintSet"))
   {
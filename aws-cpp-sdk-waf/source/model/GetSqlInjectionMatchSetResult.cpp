@@ -35,6 +35,7 @@ GetSqlInjectionMatchSetResult::GetSqlInjectionMatchSetResult(const AmazonWebServ
 
 GetSqlInjectionMatchSetResult& GetSqlInjectionMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("SqlInjectionMatchSet"))
   {
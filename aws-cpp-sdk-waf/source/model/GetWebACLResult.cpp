@@ -35,6 +35,7 @@ GetWebACLResult::GetWebACLResult(const AmazonWebServiceResult<JsonValue>& result
 
 GetWebACLResult& GetWebACLResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("WebACL"))
   {
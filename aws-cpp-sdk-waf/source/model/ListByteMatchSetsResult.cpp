@@ -35,6 +35,7 @@ ListByteMatchSetsResult::ListByteMatchSetsResult(const AmazonWebServiceResult<Js
 
 ListByteMatchSetsResult& ListByteMatchSetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
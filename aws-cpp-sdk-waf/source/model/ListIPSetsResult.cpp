@@ -35,6 +35,7 @@ ListIPSetsResult::ListIPSetsResult(const AmazonWebServiceResult<JsonValue>& resu
 
 ListIPSetsResult& ListIPSetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
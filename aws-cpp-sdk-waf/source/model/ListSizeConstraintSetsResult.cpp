@@ -35,6 +35,7 @@ ListSizeConstraintSetsResult::ListSizeConstraintSetsResult(const AmazonWebServic
 
 ListSizeConstraintSetsResult& ListSizeConstraintSetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
@@ -35,6 +35,7 @@ ListSqlInjectionMatchSetsResult::ListSqlInjectionMatchSetsResult(const AmazonWeb
 
 ListSqlInjectionMatchSetsResult& ListSqlInjectionMatchSetsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
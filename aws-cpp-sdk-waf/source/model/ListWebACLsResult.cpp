@@ -35,6 +35,7 @@ ListWebACLsResult::ListWebACLsResult(const AmazonWebServiceResult<JsonValue>& re
 
 ListWebACLsResult& ListWebACLsResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("NextMarker"))
   {
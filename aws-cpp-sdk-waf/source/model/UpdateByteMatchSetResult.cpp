@@ -35,6 +35,7 @@ UpdateByteMatchSetResult::UpdateByteMatchSetResult(const AmazonWebServiceResult<
 
 UpdateByteMatchSetResult& UpdateByteMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
@@ -35,6 +35,7 @@ UpdateIPSetResult::UpdateIPSetResult(const AmazonWebServiceResult<JsonValue>& re
 
 UpdateIPSetResult& UpdateIPSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
@@ -35,6 +35,7 @@ UpdateRuleResult::UpdateRuleResult(const AmazonWebServiceResult<JsonValue>& resu
 
 UpdateRuleResult& UpdateRuleResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
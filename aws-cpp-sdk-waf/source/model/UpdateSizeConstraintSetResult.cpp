@@ -35,6 +35,7 @@ UpdateSizeConstraintSetResult::UpdateSizeConstraintSetResult(const AmazonWebServ
 
 UpdateSizeConstraintSetResult& UpdateSizeConstraintSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
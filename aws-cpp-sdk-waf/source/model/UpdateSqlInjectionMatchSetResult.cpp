@@ -35,6 +35,7 @@ UpdateSqlInjectionMatchSetResult::UpdateSqlInjectionMatchSetResult(const AmazonW
 
 UpdateSqlInjectionMatchSetResult& UpdateSqlInjectionMatchSetResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
@@ -35,6 +35,7 @@ UpdateWebACLResult::UpdateWebACLResult(const AmazonWebServiceResult<JsonValue>&
 
 UpdateWebACLResult& UpdateWebACLResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("ChangeToken"))
   {
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/workspaces/WorkSpaces_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/workspaces/model/FailedCreateWorkspaceRequest.h>
 #include <aws/workspaces/model/Workspace.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the result of the <a>CreateWorkspaces</a> operation.</p>
    */
-  class AWS_WORKSPACES_API CreateWorkspacesResult
+  class AWS_WORKSPACES_API CreateWorkspacesResult : public AmazonWebServiceResultBase
   {
   public:
     CreateWorkspacesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/workspaces/WorkSpaces_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/workspaces/model/WorkspaceBundle.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>DescribeWorkspaceBundles</a> operation.</p>
    */
-  class AWS_WORKSPACES_API DescribeWorkspaceBundlesResult
+  class AWS_WORKSPACES_API DescribeWorkspaceBundlesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeWorkspaceBundlesResult();
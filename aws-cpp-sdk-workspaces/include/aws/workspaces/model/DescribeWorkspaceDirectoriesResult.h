@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/workspaces/WorkSpaces_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/workspaces/model/WorkspaceDirectory.h>
@@ -38,7 +39,7 @@ namespace Model
    * <p>Contains the results of the <a>DescribeWorkspaceDirectories</a>
    * operation.</p>
    */
-  class AWS_WORKSPACES_API DescribeWorkspaceDirectoriesResult
+  class AWS_WORKSPACES_API DescribeWorkspaceDirectoriesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeWorkspaceDirectoriesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/workspaces/WorkSpaces_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/workspaces/model/Workspace.h>
@@ -37,7 +38,7 @@ namespace Model
   /**
    * <p>Contains the results for the <a>DescribeWorkspaces</a> operation.</p>
    */
-  class AWS_WORKSPACES_API DescribeWorkspacesResult
+  class AWS_WORKSPACES_API DescribeWorkspacesResult : public AmazonWebServiceResultBase
   {
   public:
     DescribeWorkspacesResult();
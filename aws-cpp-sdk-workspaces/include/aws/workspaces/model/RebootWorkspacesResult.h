@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/workspaces/WorkSpaces_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/workspaces/model/FailedWorkspaceChangeRequest.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>RebootWorkspaces</a> operation.</p>
    */
-  class AWS_WORKSPACES_API RebootWorkspacesResult
+  class AWS_WORKSPACES_API RebootWorkspacesResult : public AmazonWebServiceResultBase
   {
   public:
     RebootWorkspacesResult();
@@ -14,6 +14,7 @@
 */
 #pragma once
 #include <aws/workspaces/WorkSpaces_EXPORTS.h>
+#include <aws/core/AmazonWebServiceResultBase.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/workspaces/model/FailedWorkspaceChangeRequest.h>
 
@@ -36,7 +37,7 @@ namespace Model
   /**
    * <p>Contains the results of the <a>RebuildWorkspaces</a> operation.</p>
    */
-  class AWS_WORKSPACES_API RebuildWorkspacesResult
+  class AWS_WORKSPACES_API RebuildWorkspacesResult : public AmazonWebServiceResultBase
   {
   public:
     RebuildWorkspacesResult();
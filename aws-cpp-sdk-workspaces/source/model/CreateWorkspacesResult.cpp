@@ -35,6 +35,7 @@ CreateWorkspacesResult::CreateWorkspacesResult(const AmazonWebServiceResult<Json
 
 CreateWorkspacesResult& CreateWorkspacesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedRequests"))
   {
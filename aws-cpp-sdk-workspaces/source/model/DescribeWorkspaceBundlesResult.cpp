@@ -35,6 +35,7 @@ DescribeWorkspaceBundlesResult::DescribeWorkspaceBundlesResult(const AmazonWebSe
 
 DescribeWorkspaceBundlesResult& DescribeWorkspaceBundlesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Bundles"))
   {
@@ -35,6 +35,7 @@ DescribeWorkspaceDirectoriesResult::DescribeWorkspaceDirectoriesResult(const Ama
 
 DescribeWorkspaceDirectoriesResult& DescribeWorkspaceDirectoriesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Directories"))
   {
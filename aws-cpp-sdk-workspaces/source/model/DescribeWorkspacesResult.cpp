@@ -35,6 +35,7 @@ DescribeWorkspacesResult::DescribeWorkspacesResult(const AmazonWebServiceResult<
 
 DescribeWorkspacesResult& DescribeWorkspacesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("Workspaces"))
   {
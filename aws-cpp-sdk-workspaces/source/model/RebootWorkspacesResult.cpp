@@ -35,6 +35,7 @@ RebootWorkspacesResult::RebootWorkspacesResult(const AmazonWebServiceResult<Json
 
 RebootWorkspacesResult& RebootWorkspacesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedRequests"))
   {
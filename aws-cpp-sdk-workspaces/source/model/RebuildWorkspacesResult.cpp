@@ -35,6 +35,7 @@ RebuildWorkspacesResult::RebuildWorkspacesResult(const AmazonWebServiceResult<Js
 
 RebuildWorkspacesResult& RebuildWorkspacesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedRequests"))
   {
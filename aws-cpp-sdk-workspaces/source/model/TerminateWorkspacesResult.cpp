@@ -35,6 +35,7 @@ TerminateWorkspacesResult::TerminateWorkspacesResult(const AmazonWebServiceResul
 
 TerminateWorkspacesResult& TerminateWorkspacesResult::operator =(const AmazonWebServiceResult<JsonValue>& result)
 {
+  SetRequestTimings(result.GetRequestTimings());
   const JsonValue& jsonValue = result.GetPayload();
   if(jsonValue.ValueExists("FailedRequests"))
   {
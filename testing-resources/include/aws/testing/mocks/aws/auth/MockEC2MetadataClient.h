@@ -15,19 +15,32 @@
 
 #include <aws/core/internal/EC2MetadataClient.h>
 
+#include <atomic>
+#include <mutex>
+
+//credentials providers call this from their background refresh thread, hence the locking
 class MockEC2MetadataClient : public Aws::Internal::EC2MetadataClient
 {
 public:
+    MockEC2MetadataClient() : m_callCount(0) {}
+
     inline Aws::String GetDefaultCredentials() const
     {
+        std::lock_guard<std::mutex> locker(m_lock);
+        ++m_callCount;
         return m_mockedValue;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         m_mockedValue = mockValue;
     }
 
+    inline int GetCallCount() const { return m_callCount.load(); }
+
 private:
+    mutable std::mutex m_lock;
+    mutable std::atomic<int> m_callCount;
     Aws::String m_mockedValue;
 };